@@ -0,0 +1,116 @@
+#version 330 core
+
+#define DEGREES_MAX   360.0f
+#define LONGITUDE_MAX 180.0f
+#define PI            3.1415926535897932384626433f
+#define RAD2DEG       57.295779513082320876798156332941f
+
+// WGS84 ellipsoid parameters
+#define EQUATORIAL_RADIUS     6378137.0f
+#define ECCENTRICITY_SQUARED  0.00669437999014f
+
+// Maximum number of radials is 720, requiring 10 search iterations
+#define MAX_SEARCH_ITERATIONS 10
+
+precision highp float;
+
+uniform sampler1D  uTexture;
+uniform usampler2D uSweep;
+uniform sampler1D  uAzimuths;
+
+uniform uint  uDataMomentOffset;
+uniform float uDataMomentScale;
+
+uniform bool uCFPEnabled;
+
+uniform vec2  uMapScreenCoord;
+uniform vec3  uSiteOrigin;
+uniform mat3  uSiteEnu;
+uniform vec2  uSiteRadii;
+uniform float uGateSize;
+
+smooth in vec2 mapCoord;
+
+layout (location = 0) out vec4 fragColor;
+
+vec2 screenCoordinateToLatLng(in vec2 p)
+{
+   float k = (p.y + LONGITUDE_MAX) / RAD2DEG;
+   return vec2((atan(exp(k)) - PI / 4) * DEGREES_MAX / PI,
+               p.x - LONGITUDE_MAX);
+}
+
+int findRadial(in float azimuth)
+{
+   int   radialCount  = textureSize(uAzimuths, 0);
+   float firstAzimuth = texelFetch(uAzimuths, 0, 0).r;
+
+   // Normalize the azimuth to [firstAzimuth, firstAzimuth + 360)
+   azimuth = firstAzimuth + mod(azimuth - firstAzimuth, DEGREES_MAX);
+
+   // Find the last radial starting at or before the azimuth
+   int low  = 0;
+   int high = radialCount;
+
+   for (int i = 0; i < MAX_SEARCH_ITERATIONS && high - low > 1; ++i)
+   {
+      int mid = (low + high) / 2;
+
+      if (texelFetch(uAzimuths, mid, 0).r <= azimuth)
+      {
+         low = mid;
+      }
+      else
+      {
+         high = mid;
+      }
+   }
+
+   return low;
+}
+
+void main()
+{
+   vec2 latLng = screenCoordinateToLatLng(mapCoord + uMapScreenCoord) / RAD2DEG;
+
+   // Offset from the radar site in east, north, up coordinates
+   float sinLat = sin(latLng.x);
+   float n      = EQUATORIAL_RADIUS / sqrt(1.0f - ECCENTRICITY_SQUARED * sinLat * sinLat);
+   vec3  ecef   = vec3(n * cos(latLng.x) * cos(latLng.y),
+                       n * cos(latLng.x) * sin(latLng.y),
+                       n * (1.0f - ECCENTRICITY_SQUARED) * sinLat);
+   vec3  d      = ecef - uSiteOrigin;
+   vec3  enu    = uSiteEnu * d;
+
+   // Azimuth and range along the normal section through the radar site
+   float alpha  = atan(enu.x, enu.y);
+   float cosA   = cos(alpha);
+   float sinA   = sin(alpha);
+   float radius = uSiteRadii.x * uSiteRadii.y /
+                  (uSiteRadii.y * cosA * cosA + uSiteRadii.x * sinA * sinA);
+   float range  = 2.0f * radius * asin(min(1.0f, length(d) / (2.0f * radius)));
+
+   int gate = int(range / uGateSize);
+   if (gate >= textureSize(uSweep, 0).x)
+   {
+      discard;
+   }
+
+   uvec2 moments = texelFetch(uSweep, ivec2(gate, findRadial(alpha * RAD2DEG)), 0).rg;
+   uint  dataMoment = moments.r;
+   uint  cfpMoment  = moments.g;
+
+   if (dataMoment == 0u)
+   {
+      discard;
+   }
+
+   float texCoord = float(dataMoment - uDataMomentOffset) / uDataMomentScale;
+
+   if (uCFPEnabled && cfpMoment > 8u)
+   {
+      texCoord = texCoord - float(cfpMoment - 8u) / 2.0f;
+   }
+
+   fragColor = texture(uTexture, texCoord);
+}
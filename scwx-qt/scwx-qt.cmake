@@ -47,6 +47,11 @@ find_package(Qt${QT_VERSION_MAJOR}
              REQUIRED)
 
 set(SRC_EXE_MAIN source/scwx/qt/main/main.cpp)
+set(SRC_EXE_RASTERIZE source/scwx/qt/main/rasterize.cpp)
+set(SRC_EXE_COUNTY_BENCHMARK source/scwx/qt/main/county_benchmark.cpp)
+set(SRC_EXE_LEVEL3_BENCHMARK source/scwx/qt/main/level3_benchmark.cpp)
+set(SRC_EXE_VOLUME_PRODUCTS_BENCHMARK source/scwx/qt/main/volume_products_benchmark.cpp)
+set(SRC_EXE_REPLAY source/scwx/qt/main/replay.cpp)
 
 set(HDR_MAIN source/scwx/qt/main/application.hpp
              source/scwx/qt/main/main_window.hpp)
@@ -54,16 +59,20 @@ set(SRC_MAIN source/scwx/qt/main/application.cpp
              source/scwx/qt/main/main_window.cpp)
 set(UI_MAIN  source/scwx/qt/main/main_window.ui)
 set(HDR_CONFIG source/scwx/qt/config/county_database.hpp
+               source/scwx/qt/config/county_store.hpp
                source/scwx/qt/config/radar_site.hpp)
 set(SRC_CONFIG source/scwx/qt/config/county_database.cpp
+               source/scwx/qt/config/county_store.cpp
                source/scwx/qt/config/radar_site.cpp)
 set(SRC_EXTERNAL source/scwx/qt/external/stb_image.cpp
                  source/scwx/qt/external/stb_rect_pack.cpp)
 set(HDR_GL source/scwx/qt/gl/gl.hpp
            source/scwx/qt/gl/gl_context.hpp
-           source/scwx/qt/gl/shader_program.hpp)
+           source/scwx/qt/gl/shader_program.hpp
+           source/scwx/qt/gl/upload_context.hpp)
 set(SRC_GL source/scwx/qt/gl/gl_context.cpp
-           source/scwx/qt/gl/shader_program.cpp)
+           source/scwx/qt/gl/shader_program.cpp
+           source/scwx/qt/gl/upload_context.cpp)
 set(HDR_GL_DRAW source/scwx/qt/gl/draw/draw_item.hpp
                 source/scwx/qt/gl/draw/geo_icons.hpp
                 source/scwx/qt/gl/draw/geo_lines.hpp
@@ -131,10 +140,12 @@ set(HDR_MAP source/scwx/qt/map/alert_layer.hpp
             source/scwx/qt/map/map_provider.hpp
             source/scwx/qt/map/map_settings.hpp
             source/scwx/qt/map/map_widget.hpp
+            source/scwx/qt/map/overlay_geometry.hpp
             source/scwx/qt/map/overlay_layer.hpp
             source/scwx/qt/map/overlay_product_layer.hpp
             source/scwx/qt/map/placefile_layer.hpp
             source/scwx/qt/map/marker_layer.hpp
+            source/scwx/qt/map/mosaic_layer.hpp
             source/scwx/qt/map/radar_product_layer.hpp
             source/scwx/qt/map/radar_range_layer.hpp
             source/scwx/qt/map/radar_site_layer.hpp)
@@ -146,10 +157,12 @@ set(SRC_MAP source/scwx/qt/map/alert_layer.cpp
             source/scwx/qt/map/map_context.cpp
             source/scwx/qt/map/map_provider.cpp
             source/scwx/qt/map/map_widget.cpp
+            source/scwx/qt/map/overlay_geometry.cpp
             source/scwx/qt/map/overlay_layer.cpp
             source/scwx/qt/map/overlay_product_layer.cpp
             source/scwx/qt/map/placefile_layer.cpp
             source/scwx/qt/map/marker_layer.cpp
+            source/scwx/qt/map/mosaic_layer.cpp
             source/scwx/qt/map/radar_product_layer.cpp
             source/scwx/qt/map/radar_range_layer.cpp
             source/scwx/qt/map/radar_site_layer.cpp)
@@ -251,6 +264,7 @@ set(HDR_UI source/scwx/qt/ui/about_dialog.hpp
            source/scwx/qt/ui/animation_dock_widget.hpp
            source/scwx/qt/ui/collapsible_group.hpp
            source/scwx/qt/ui/county_dialog.hpp
+           source/scwx/qt/ui/cross_section_dock_widget.hpp
            source/scwx/qt/ui/download_dialog.hpp
            source/scwx/qt/ui/edit_line_dialog.hpp
            source/scwx/qt/ui/flow_layout.hpp
@@ -281,6 +295,7 @@ set(SRC_UI source/scwx/qt/ui/about_dialog.cpp
            source/scwx/qt/ui/animation_dock_widget.cpp
            source/scwx/qt/ui/collapsible_group.cpp
            source/scwx/qt/ui/county_dialog.cpp
+           source/scwx/qt/ui/cross_section_dock_widget.cpp
            source/scwx/qt/ui/download_dialog.cpp
            source/scwx/qt/ui/edit_line_dialog.cpp
            source/scwx/qt/ui/flow_layout.cpp
@@ -346,27 +361,52 @@ set(SRC_UI_SETUP source/scwx/qt/ui/setup/audio_codec_page.cpp
                  source/scwx/qt/ui/setup/map_provider_page.cpp
                  source/scwx/qt/ui/setup/setup_wizard.cpp
                  source/scwx/qt/ui/setup/welcome_page.cpp)
-set(HDR_UTIL source/scwx/qt/util/color.hpp
+set(HDR_UTIL source/scwx/qt/util/area_index.hpp
+             source/scwx/qt/util/atlas_packer.hpp
+             source/scwx/qt/util/coalescing_cache.hpp
+             source/scwx/qt/util/color.hpp
+             source/scwx/qt/util/cross_section.hpp
              source/scwx/qt/util/file.hpp
+             source/scwx/qt/util/geo_grid_index.hpp
              source/scwx/qt/util/geographic_lib.hpp
+             source/scwx/qt/util/image_cache.hpp
              source/scwx/qt/util/imgui.hpp
              source/scwx/qt/util/json.hpp
              source/scwx/qt/util/maplibre.hpp
+             source/scwx/qt/util/metrics.hpp
+             source/scwx/qt/util/mosaic_grid.hpp
              source/scwx/qt/util/network.hpp
+             source/scwx/qt/util/polar_sweep.hpp
+             source/scwx/qt/util/prepared_area.hpp
              source/scwx/qt/util/streams.hpp
+             source/scwx/qt/util/sweep_rasterizer.hpp
+             source/scwx/qt/util/text_event_store.hpp
              source/scwx/qt/util/texture_atlas.hpp
+             source/scwx/qt/util/triangle_sweep.hpp
              source/scwx/qt/util/q_file_buffer.hpp
              source/scwx/qt/util/q_file_input_stream.hpp
              source/scwx/qt/util/time.hpp
+             source/scwx/qt/util/time_index.hpp
              source/scwx/qt/util/tooltip.hpp)
-set(SRC_UTIL source/scwx/qt/util/color.cpp
+set(SRC_UTIL source/scwx/qt/util/area_index.cpp
+             source/scwx/qt/util/atlas_packer.cpp
+             source/scwx/qt/util/color.cpp
+             source/scwx/qt/util/cross_section.cpp
              source/scwx/qt/util/file.cpp
              source/scwx/qt/util/geographic_lib.cpp
+             source/scwx/qt/util/image_cache.cpp
              source/scwx/qt/util/imgui.cpp
              source/scwx/qt/util/json.cpp
              source/scwx/qt/util/maplibre.cpp
+             source/scwx/qt/util/metrics.cpp
+             source/scwx/qt/util/mosaic_grid.cpp
              source/scwx/qt/util/network.cpp
+             source/scwx/qt/util/polar_sweep.cpp
+             source/scwx/qt/util/prepared_area.cpp
+             source/scwx/qt/util/sweep_rasterizer.cpp
+             source/scwx/qt/util/text_event_store.cpp
              source/scwx/qt/util/texture_atlas.cpp
+             source/scwx/qt/util/triangle_sweep.cpp
              source/scwx/qt/util/q_file_buffer.cpp
              source/scwx/qt/util/q_file_input_stream.cpp
              source/scwx/qt/util/time.cpp
@@ -375,6 +415,7 @@ set(HDR_VIEW source/scwx/qt/view/level2_product_view.hpp
              source/scwx/qt/view/level3_product_view.hpp
              source/scwx/qt/view/level3_radial_view.hpp
              source/scwx/qt/view/level3_raster_view.hpp
+             source/scwx/qt/view/mosaic_view.hpp
              source/scwx/qt/view/overlay_product_view.hpp
              source/scwx/qt/view/radar_product_view.hpp
              source/scwx/qt/view/radar_product_view_factory.hpp)
@@ -382,6 +423,7 @@ set(SRC_VIEW source/scwx/qt/view/level2_product_view.cpp
              source/scwx/qt/view/level3_product_view.cpp
              source/scwx/qt/view/level3_radial_view.cpp
              source/scwx/qt/view/level3_raster_view.cpp
+             source/scwx/qt/view/mosaic_view.cpp
              source/scwx/qt/view/overlay_product_view.cpp
              source/scwx/qt/view/radar_product_view.cpp
              source/scwx/qt/view/radar_product_view_factory.cpp)
@@ -395,6 +437,8 @@ set(SHADER_FILES gl/color.frag
                  gl/map_color.vert
                  gl/radar.frag
                  gl/radar.vert
+                 gl/radar_polar.frag
+                 gl/radar_polar.vert
                  gl/texture1d.frag
                  gl/texture1d.vert
                  gl/texture2d.frag
@@ -417,6 +461,7 @@ set(ZONE_DBF_FILES   ${SCWX_DIR}/data/db/fz05mr24.dbf
 set(STATE_DBF_FILES  ${SCWX_DIR}/data/db/s_05mr24.dbf)
 set(WFO_DBF_FILES    ${SCWX_DIR}/data/db/w_05mr24.dbf)
 set(COUNTIES_SQLITE_DB ${scwx-qt_BINARY_DIR}/res/db/counties.db)
+set(COUNTIES_STORE     ${scwx-qt_BINARY_DIR}/res/db/counties.bin)
 
 set(RESOURCE_INPUT  ${scwx-qt_SOURCE_DIR}/res/scwx-qt.rc.in)
 set(RESOURCE_OUTPUT ${scwx-qt_BINARY_DIR}/res/scwx-qt.rc)
@@ -506,6 +551,7 @@ add_library(scwx-qt OBJECT ${PROJECT_SOURCES})
 set_property(TARGET scwx-qt PROPERTY AUTOMOC ON)
 
 add_custom_command(OUTPUT  ${COUNTIES_SQLITE_DB}
+                           ${COUNTIES_STORE}
                    COMMAND ${Python_EXECUTABLE}
                            ${scwx-qt_SOURCE_DIR}/tools/generate_counties_db.py
                            -c ${COUNTY_DBF_FILES}
@@ -513,6 +559,7 @@ add_custom_command(OUTPUT  ${COUNTIES_SQLITE_DB}
                            -s ${STATE_DBF_FILES}
                            -w ${WFO_DBF_FILES}
                            -o ${COUNTIES_SQLITE_DB}
+                           -b ${COUNTIES_STORE}
                    DEPENDS ${scwx-qt_SOURCE_DIR}/tools/generate_counties_db.py
                            ${COUNTY_DB_FILES}
                            ${STATE_DBF_FILES}
@@ -520,7 +567,8 @@ add_custom_command(OUTPUT  ${COUNTIES_SQLITE_DB}
                            ${WFO_DBF_FILES})
 
 add_custom_target(scwx-qt_generate_counties_db ALL
-                  DEPENDS ${COUNTIES_SQLITE_DB})
+                  DEPENDS ${COUNTIES_SQLITE_DB}
+                          ${COUNTIES_STORE})
 
 add_dependencies(scwx-qt scwx-qt_generate_counties_db)
 
@@ -564,10 +612,12 @@ add_custom_target(scwx-qt_update_radar_sites
                           -u ${RADAR_SITES_FILE}
                           -t -w)
 
+# The county store is queried in place, and must not be compressed
 qt_add_resources(scwx-qt "generated"
                  PREFIX  "/"
                  BASE    ${scwx-qt_BINARY_DIR}
-                 FILES   ${COUNTIES_SQLITE_DB})
+                 OPTIONS --no-compress
+                 FILES   ${COUNTIES_STORE})
 
 qt_add_translations(scwx-qt TS_FILES ${TS_FILES}
                     INCLUDE_DIRECTORIES true
@@ -601,6 +651,21 @@ else()
     qt_add_executable(supercell-wx ${EXECUTABLE_SOURCES})
 endif()
 
+# Headless batch rasterizer
+qt_add_executable(scwx-rasterize ${SRC_EXE_RASTERIZE})
+
+# County database benchmark
+qt_add_executable(scwx-county-benchmark ${SRC_EXE_COUNTY_BENCHMARK})
+
+# Level 3 parsing benchmark
+qt_add_executable(scwx-level3-benchmark ${SRC_EXE_LEVEL3_BENCHMARK})
+
+# Level 2 derived product benchmark
+qt_add_executable(scwx-volume-products-benchmark ${SRC_EXE_VOLUME_PRODUCTS_BENCHMARK})
+
+# Offline replay harness
+qt_add_executable(scwx-replay ${SRC_EXE_REPLAY})
+
 if (WIN32)
     target_compile_definitions(scwx-qt      PUBLIC WIN32_LEAN_AND_MEAN)
     target_compile_definitions(supercell-wx PUBLIC WIN32_LEAN_AND_MEAN)
@@ -610,6 +675,11 @@ if (NOT MSVC)
     # Qt emit keyword is incompatible with TBB
     target_compile_definitions(scwx-qt      PRIVATE QT_NO_EMIT)
     target_compile_definitions(supercell-wx PRIVATE QT_NO_EMIT)
+    target_compile_definitions(scwx-rasterize PRIVATE QT_NO_EMIT)
+    target_compile_definitions(scwx-county-benchmark PRIVATE QT_NO_EMIT)
+    target_compile_definitions(scwx-level3-benchmark PRIVATE QT_NO_EMIT)
+    target_compile_definitions(scwx-volume-products-benchmark PRIVATE QT_NO_EMIT)
+    target_compile_definitions(scwx-replay PRIVATE QT_NO_EMIT)
 endif()
 
 target_include_directories(scwx-qt PUBLIC ${scwx-qt_SOURCE_DIR}/source
@@ -620,6 +690,11 @@ target_include_directories(scwx-qt PUBLIC ${scwx-qt_SOURCE_DIR}/source
                                           ${TEXTFLOWCPP_INCLUDE_DIR})
 
 target_include_directories(supercell-wx PUBLIC ${scwx-qt_SOURCE_DIR}/source)
+target_include_directories(scwx-rasterize PUBLIC ${scwx-qt_SOURCE_DIR}/source)
+target_include_directories(scwx-county-benchmark PUBLIC ${scwx-qt_SOURCE_DIR}/source)
+target_include_directories(scwx-level3-benchmark PUBLIC ${scwx-qt_SOURCE_DIR}/source)
+target_include_directories(scwx-volume-products-benchmark PUBLIC ${scwx-qt_SOURCE_DIR}/source)
+target_include_directories(scwx-replay PUBLIC ${scwx-qt_SOURCE_DIR}/source)
 
 target_compile_options(scwx-qt PRIVATE
     $<$<CXX_COMPILER_ID:MSVC>:/W4 /WX>
@@ -629,11 +704,40 @@ target_compile_options(supercell-wx PRIVATE
     $<$<CXX_COMPILER_ID:MSVC>:/W4 /WX>
     $<$<NOT:$<CXX_COMPILER_ID:MSVC>>:-Wall -Wextra -Wpedantic -Werror>
 )
+target_compile_options(scwx-rasterize PRIVATE
+    $<$<CXX_COMPILER_ID:MSVC>:/W4 /WX>
+    $<$<NOT:$<CXX_COMPILER_ID:MSVC>>:-Wall -Wextra -Wpedantic -Werror>
+)
+target_compile_options(scwx-county-benchmark PRIVATE
+    $<$<CXX_COMPILER_ID:MSVC>:/W4 /WX>
+    $<$<NOT:$<CXX_COMPILER_ID:MSVC>>:-Wall -Wextra -Wpedantic -Werror>
+)
+target_compile_options(scwx-level3-benchmark PRIVATE
+    $<$<CXX_COMPILER_ID:MSVC>:/W4 /WX>
+    $<$<NOT:$<CXX_COMPILER_ID:MSVC>>:-Wall -Wextra -Wpedantic -Werror>
+)
+target_compile_options(scwx-volume-products-benchmark PRIVATE
+    $<$<CXX_COMPILER_ID:MSVC>:/W4 /WX>
+    $<$<NOT:$<CXX_COMPILER_ID:MSVC>>:-Wall -Wextra -Wpedantic -Werror>
+)
+target_compile_options(scwx-replay PRIVATE
+    $<$<CXX_COMPILER_ID:MSVC>:/W4 /WX>
+    $<$<NOT:$<CXX_COMPILER_ID:MSVC>>:-Wall -Wextra -Wpedantic -Werror>
+)
+
+# The benchmark compares against the SQLite database generated at build time
+target_compile_definitions(scwx-county-benchmark
+    PRIVATE SCWX_COUNTIES_SQLITE_DB="${COUNTIES_SQLITE_DB}")
 
 if (MSVC)
     # Don't include Windows macros
     target_compile_options(scwx-qt PRIVATE -DNOMINMAX)
     target_compile_options(supercell-wx PRIVATE -DNOMINMAX)
+    target_compile_options(scwx-rasterize PRIVATE -DNOMINMAX)
+    target_compile_options(scwx-county-benchmark PRIVATE -DNOMINMAX)
+    target_compile_options(scwx-level3-benchmark PRIVATE -DNOMINMAX)
+    target_compile_options(scwx-volume-products-benchmark PRIVATE -DNOMINMAX)
+    target_compile_options(scwx-replay PRIVATE -DNOMINMAX)
 
     # Enable multi-processor compilation
     target_compile_options(scwx-qt PRIVATE "/MP")
@@ -691,6 +795,20 @@ target_link_libraries(scwx-qt PUBLIC Qt${QT_VERSION_MAJOR}::Widgets
 target_link_libraries(supercell-wx PRIVATE scwx-qt
                                            wxdata)
 
+target_link_libraries(scwx-rasterize PRIVATE scwx-qt
+                                             wxdata)
+
+target_link_libraries(scwx-county-benchmark PRIVATE scwx-qt
+                                                    wxdata)
+
+target_link_libraries(scwx-level3-benchmark PRIVATE wxdata)
+
+target_link_libraries(scwx-volume-products-benchmark PRIVATE wxdata)
+
+target_link_libraries(scwx-replay PRIVATE scwx-qt
+                                          wxdata
+                                          $<$<PLATFORM_ID:Windows>:psapi>)
+
 # Set DT_RUNPATH for Linux targets
 set_target_properties(MLNQtCore    PROPERTIES INSTALL_RPATH "\$ORIGIN/../lib") # QMapLibre::Core
 set_target_properties(supercell-wx PROPERTIES INSTALL_RPATH "\$ORIGIN/../lib")
@@ -2,7 +2,9 @@
 
 #include <memory>
 #include <string>
+#include <string_view>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace scwx
@@ -16,7 +18,7 @@ namespace CountyDatabase
 
 void        Initialize();
 std::string GetCountyName(const std::string& id);
-std::unordered_map<std::string, std::string>
+std::vector<std::pair<std::string_view, std::string_view>>
 GetCounties(const std::string& state);
 const std::unordered_map<std::string, std::string>& GetStates();
 const std::unordered_map<std::string, std::string>& GetWFOs();
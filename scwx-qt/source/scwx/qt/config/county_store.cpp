@@ -0,0 +1,219 @@
+#include <scwx/qt/config/county_store.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <cstring>
+
+#include <boost/endian/conversion.hpp>
+
+namespace scwx
+{
+namespace qt
+{
+namespace config
+{
+
+static const std::string logPrefix_ = "scwx::qt::config::county_store";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+static constexpr std::size_t kHeaderSize_ = 24u;
+static constexpr std::size_t kEntrySize_  = 12u;
+
+template<typename T>
+static T ReadValue(const char* data)
+{
+   T value;
+   std::memcpy(&value, data, sizeof(T));
+   return boost::endian::little_to_native(value);
+}
+
+CountyStore::CountyStore(std::string_view data)
+{
+   if (data.size() < kHeaderSize_ ||
+       data.substr(0, kMagic_.size()) != kMagic_)
+   {
+      logger_->error("Invalid county store");
+      return;
+   }
+
+   const std::size_t countyCount = ReadValue<std::uint32_t>(data.data() + 8);
+   const std::size_t stateCount  = ReadValue<std::uint32_t>(data.data() + 12);
+   const std::size_t wfoCount    = ReadValue<std::uint32_t>(data.data() + 16);
+   const std::size_t poolSize    = ReadValue<std::uint32_t>(data.data() + 20);
+
+   const std::size_t tableSize =
+      (countyCount + stateCount + wfoCount) * kEntrySize_;
+
+   if (data.size() != kHeaderSize_ + tableSize + poolSize)
+   {
+      logger_->error("Invalid county store size: {}", data.size());
+      return;
+   }
+
+   const char* tables = data.data() + kHeaderSize_;
+   stringPool_        = data.substr(kHeaderSize_ + tableSize);
+
+   counties_ = {tables, countyCount};
+   states_   = {tables + countyCount * kEntrySize_, stateCount};
+   wfos_     = {tables + (countyCount + stateCount) * kEntrySize_, wfoCount};
+
+   // Validate string references, such that queries need not be checked
+   for (const Table* table : {&counties_, &states_, &wfos_})
+   {
+      for (std::size_t i = 0; i < table->size_; ++i)
+      {
+         const char* entry = table->entries_ + i * kEntrySize_;
+
+         if (ReadValue<std::uint32_t>(entry) +
+                   std::size_t {ReadValue<std::uint16_t>(entry + 8)} >
+                poolSize ||
+             ReadValue<std::uint32_t>(entry + 4) +
+                   std::size_t {ReadValue<std::uint16_t>(entry + 10)} >
+                poolSize)
+         {
+            logger_->error("Invalid county store string reference");
+            *this = CountyStore {};
+            return;
+         }
+      }
+   }
+}
+
+bool CountyStore::empty() const
+{
+   return counties_.size_ == 0u && states_.size_ == 0u && wfos_.size_ == 0u;
+}
+
+std::size_t CountyStore::county_count() const
+{
+   return counties_.size_;
+}
+
+std::size_t CountyStore::state_count() const
+{
+   return states_.size_;
+}
+
+std::size_t CountyStore::wfo_count() const
+{
+   return wfos_.size_;
+}
+
+CountyStore::Entry CountyStore::GetEntry(const Table& table,
+                                         std::size_t  index) const
+{
+   const char* entry = table.entries_ + index * kEntrySize_;
+
+   return {stringPool_.substr(ReadValue<std::uint32_t>(entry),
+                              ReadValue<std::uint16_t>(entry + 8)),
+           stringPool_.substr(ReadValue<std::uint32_t>(entry + 4),
+                              ReadValue<std::uint16_t>(entry + 10))};
+}
+
+std::size_t CountyStore::LowerBound(const Table&     table,
+                                    std::string_view key) const
+{
+   std::size_t first = 0u;
+   std::size_t count = table.size_;
+
+   while (count > 0u)
+   {
+      const std::size_t step = count / 2u;
+      const std::size_t mid  = first + step;
+
+      if (GetEntry(table, mid).first < key)
+      {
+         first = mid + 1u;
+         count -= step + 1u;
+      }
+      else
+      {
+         count = step;
+      }
+   }
+
+   return first;
+}
+
+std::optional<std::string_view>
+CountyStore::Find(const Table& table, std::string_view key) const
+{
+   const std::size_t index = LowerBound(table, key);
+
+   if (index < table.size_)
+   {
+      const Entry entry = GetEntry(table, index);
+      if (entry.first == key)
+      {
+         return entry.second;
+      }
+   }
+
+   return std::nullopt;
+}
+
+std::optional<std::string_view>
+CountyStore::FindCounty(std::string_view id) const
+{
+   return Find(counties_, id);
+}
+
+std::optional<std::string_view>
+CountyStore::FindState(std::string_view state) const
+{
+   return Find(states_, state);
+}
+
+std::optional<std::string_view> CountyStore::FindWfo(std::string_view wfo) const
+{
+   return Find(wfos_, wfo);
+}
+
+std::vector<CountyStore::Entry>
+CountyStore::GetCounties(std::string_view state) const
+{
+   std::vector<Entry> counties {};
+
+   if (state.size() != 2u)
+   {
+      return counties;
+   }
+
+   // Counties of a state share the prefix "<state>C"
+   const char             prefix[3] = {state[0], state[1], 'C'};
+   const std::string_view prefixView {prefix, sizeof(prefix)};
+
+   for (std::size_t i = LowerBound(counties_, prefixView); i < counties_.size_;
+        ++i)
+   {
+      Entry entry = GetEntry(counties_, i);
+      if (!entry.first.starts_with(prefixView))
+      {
+         break;
+      }
+      counties.push_back(entry);
+   }
+
+   return counties;
+}
+
+void CountyStore::ForEachState(
+   const std::function<void(const Entry&)>& function) const
+{
+   for (std::size_t i = 0; i < states_.size_; ++i)
+   {
+      function(GetEntry(states_, i));
+   }
+}
+
+void CountyStore::ForEachWfo(
+   const std::function<void(const Entry&)>& function) const
+{
+   for (std::size_t i = 0; i < wfos_.size_; ++i)
+   {
+      function(GetEntry(wfos_, i));
+   }
+}
+
+} // namespace config
+} // namespace qt
+} // namespace scwx
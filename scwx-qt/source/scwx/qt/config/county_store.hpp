@@ -0,0 +1,108 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace scwx
+{
+namespace qt
+{
+namespace config
+{
+
+/**
+ * @brief Read-only view of a compact county, zone, state and WFO store.
+ *
+ * The store is generated at build time by tools/generate_counties_db.py, and
+ * is queried in place without copying. All strings returned reference the
+ * underlying data, which must outlive the store.
+ *
+ * Layout (little endian):
+ * - Header: magic "SCWXCTY1", county count, state count, WFO count and
+ *   string pool size (uint32)
+ * - County, state and WFO tables, each sorted by key. Each entry contains
+ *   the key offset, value offset (uint32), key length and value length
+ *   (uint16), relative to the string pool.
+ * - String pool
+ *
+ * County and zone IDs are in UGC format (e.g., "MOC183", "TXZ211"), such that
+ * the counties of a state occupy a contiguous range of the county table.
+ */
+class CountyStore
+{
+public:
+   typedef std::pair<std::string_view, std::string_view> Entry;
+
+   static constexpr std::string_view kMagic_ {"SCWXCTY1"};
+
+   /**
+    * @brief Creates an empty store.
+    */
+   explicit CountyStore() = default;
+
+   /**
+    * @brief Creates a store referencing the provided data. If the data is
+    * not a valid store, the store is empty.
+    *
+    * @param [in] data Store data
+    */
+   explicit CountyStore(std::string_view data);
+
+   bool        empty() const;
+   std::size_t county_count() const;
+   std::size_t state_count() const;
+   std::size_t wfo_count() const;
+
+   /**
+    * @brief Finds the name of a county or zone by UGC ID.
+    */
+   std::optional<std::string_view> FindCounty(std::string_view id) const;
+
+   /**
+    * @brief Finds the name of a state by abbreviation.
+    */
+   std::optional<std::string_view> FindState(std::string_view state) const;
+
+   /**
+    * @brief Finds the city and state of a WFO by ID.
+    */
+   std::optional<std::string_view> FindWfo(std::string_view wfo) const;
+
+   /**
+    * @brief Gets the counties of a state, sorted by ID. Zones are excluded.
+    *
+    * @param [in] state State abbreviation
+    *
+    * @return ID and name of each county
+    */
+   std::vector<Entry> GetCounties(std::string_view state) const;
+
+   void ForEachState(const std::function<void(const Entry&)>& function) const;
+   void ForEachWfo(const std::function<void(const Entry&)>& function) const;
+
+private:
+   struct Table
+   {
+      const char* entries_ {nullptr};
+      std::size_t size_ {0u};
+   };
+
+   Entry       GetEntry(const Table& table, std::size_t index) const;
+   std::size_t LowerBound(const Table& table, std::string_view key) const;
+
+   std::optional<std::string_view> Find(const Table&     table,
+                                         std::string_view key) const;
+
+   Table            counties_ {};
+   Table            states_ {};
+   Table            wfos_ {};
+   std::string_view stringPool_ {};
+};
+
+} // namespace config
+} // namespace qt
+} // namespace scwx
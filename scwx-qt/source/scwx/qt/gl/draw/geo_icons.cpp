@@ -3,6 +3,7 @@
 #include <scwx/qt/util/maplibre.hpp>
 #include <scwx/qt/util/texture_atlas.hpp>
 #include <scwx/qt/util/tooltip.hpp>
+#include <scwx/util/clock.hpp>
 #include <scwx/util/logger.hpp>
 
 #include <execution>
@@ -310,7 +311,7 @@ void GeoIcons::Render(const QMapLibre::CustomLayerRenderParameters& params,
       // Selected time
       std::chrono::system_clock::time_point selectedTime =
          (p->selectedTime_ == std::chrono::system_clock::time_point {}) ?
-            std::chrono::system_clock::now() :
+            scwx::util::clock::Now() :
             p->selectedTime_;
       gl.glUniform1i(
          p->uSelectedTimeLocation_,
@@ -928,7 +929,7 @@ bool GeoIcons::RunMousePicking(
    // If no time has been selected, use the current time
    std::chrono::system_clock::time_point selectedTime =
       (p->selectedTime_ == std::chrono::system_clock::time_point {}) ?
-         std::chrono::system_clock::now() :
+         scwx::util::clock::Now() :
          p->selectedTime_;
 
    // For each pickable icon
@@ -18,37 +18,27 @@ static const std::string logPrefix_ = "scwx::qt::gl::draw::linked_vectors";
 
 static const boost::gil::rgba32f_pixel_t kBlack {0.0f, 0.0f, 0.0f, 1.0f};
 
+static std::vector<common::Coordinate> CreateCoordinates(
+   const common::Coordinate&                                     center,
+   const std::shared_ptr<const wsr88d::rpg::LinkedVectorPacket>& vectorPacket);
+static std::vector<LinkedVectorGeometry::TickMark>
+CreateTicks(const std::vector<common::Coordinate>& coordinates,
+            units::length::meters<double>          tickRadius,
+            units::length::meters<double>          tickRadiusIncrement);
+
 struct LinkedVectorDrawItem
 {
-   LinkedVectorDrawItem(
-      const common::Coordinate& center,
-      const std::shared_ptr<const wsr88d::rpg::LinkedVectorPacket>&
-         vectorPacket)
+   explicit LinkedVectorDrawItem(
+      std::shared_ptr<const LinkedVectorGeometry> geometry) :
+       geometry_ {std::move(geometry)}
    {
-      coordinates_.push_back(util::GeographicLib::GetCoordinate(
-         center, vectorPacket->start_i_km(), vectorPacket->start_j_km()));
-
-      const auto endI = vectorPacket->end_i_km();
-      const auto endJ = vectorPacket->end_j_km();
-
-      std::for_each(
-         boost::make_zip_iterator(
-            boost::make_tuple(endI.begin(), endJ.begin())),
-         boost::make_zip_iterator(boost::make_tuple(endI.end(), endJ.end())),
-         [this,
-          &center](const boost::tuple<units::length::kilometers<double>,
-                                      units::length::kilometers<double>>& p)
-         {
-            coordinates_.push_back(util::GeographicLib::GetCoordinate(
-               center, p.get<0>(), p.get<1>()));
-         });
    }
 
+   std::shared_ptr<const LinkedVectorGeometry> geometry_;
+
    std::vector<std::shared_ptr<GeoLineDrawItem>> borderDrawItems_ {};
    std::vector<std::shared_ptr<GeoLineDrawItem>> lineDrawItems_ {};
 
-   std::vector<common::Coordinate> coordinates_ {};
-
    boost::gil::rgba32f_pixel_t modulate_ {1.0f, 1.0f, 1.0f, 1.0f};
    float                       width_ {5.0f};
    bool                        visible_ {true};
@@ -69,6 +59,10 @@ public:
 
    ~Impl() {}
 
+   void AddLines(const std::shared_ptr<LinkedVectorDrawItem>&       di,
+                 const std::vector<LinkedVectorGeometry::TickMark>* ticks,
+                 bool                                               border);
+
    std::shared_ptr<GlContext> context_;
 
    bool borderEnabled_ {true};
@@ -139,8 +133,88 @@ std::shared_ptr<LinkedVectorDrawItem> LinkedVectors::AddVector(
    const common::Coordinate&                                     center,
    const std::shared_ptr<const wsr88d::rpg::LinkedVectorPacket>& vectorPacket)
 {
-   return p->vectorList_.emplace_back(
-      std::make_shared<LinkedVectorDrawItem>(center, vectorPacket));
+   return p->vectorList_.emplace_back(std::make_shared<LinkedVectorDrawItem>(
+      std::make_shared<LinkedVectorGeometry>(LinkedVectorGeometry {
+         CreateCoordinates(center, vectorPacket), {}})));
+}
+
+std::shared_ptr<LinkedVectorDrawItem> LinkedVectors::AddVector(
+   const std::shared_ptr<const LinkedVectorGeometry>& geometry)
+{
+   auto di           = std::make_shared<LinkedVectorDrawItem>(geometry);
+   di->ticksEnabled_ = !geometry->ticks_.empty();
+
+   return p->vectorList_.emplace_back(std::move(di));
+}
+
+std::shared_ptr<const LinkedVectorGeometry> LinkedVectors::CreateGeometry(
+   const common::Coordinate&                                     center,
+   const std::shared_ptr<const wsr88d::rpg::LinkedVectorPacket>& vectorPacket,
+   units::length::meters<double>                                 tickRadius,
+   units::length::meters<double> tickRadiusIncrement)
+{
+   auto geometry          = std::make_shared<LinkedVectorGeometry>();
+   geometry->coordinates_ = CreateCoordinates(center, vectorPacket);
+   geometry->ticks_ =
+      CreateTicks(geometry->coordinates_, tickRadius, tickRadiusIncrement);
+
+   return geometry;
+}
+
+static std::vector<common::Coordinate> CreateCoordinates(
+   const common::Coordinate&                                     center,
+   const std::shared_ptr<const wsr88d::rpg::LinkedVectorPacket>& vectorPacket)
+{
+   std::vector<common::Coordinate> coordinates {};
+
+   coordinates.push_back(util::GeographicLib::GetCoordinate(
+      center, vectorPacket->start_i_km(), vectorPacket->start_j_km()));
+
+   const auto endI = vectorPacket->end_i_km();
+   const auto endJ = vectorPacket->end_j_km();
+
+   std::for_each(
+      boost::make_zip_iterator(boost::make_tuple(endI.begin(), endJ.begin())),
+      boost::make_zip_iterator(boost::make_tuple(endI.end(), endJ.end())),
+      [&coordinates,
+       &center](const boost::tuple<units::length::kilometers<double>,
+                                   units::length::kilometers<double>>& p)
+      {
+         coordinates.push_back(
+            util::GeographicLib::GetCoordinate(center, p.get<0>(), p.get<1>()));
+      });
+
+   return coordinates;
+}
+
+static std::vector<LinkedVectorGeometry::TickMark>
+CreateTicks(const std::vector<common::Coordinate>& coordinates,
+            units::length::meters<double>          tickRadius,
+            units::length::meters<double>          tickRadiusIncrement)
+{
+   std::vector<LinkedVectorGeometry::TickMark> ticks {};
+
+   // Each tick is perpendicular to the end of a line segment
+   for (std::size_t i = 0; i + 1 < coordinates.size(); ++i)
+   {
+      const common::Coordinate& coordinate1 = coordinates[i];
+      const common::Coordinate& coordinate2 = coordinates[i + 1];
+
+      auto angle = util::GeographicLib::GetAngle(coordinate1.latitude_,
+                                                 coordinate1.longitude_,
+                                                 coordinate2.latitude_,
+                                                 coordinate2.longitude_);
+      auto angle1 = angle + units::angle::degrees<double>(90.0);
+      auto angle2 = angle - units::angle::degrees<double>(90.0);
+
+      ticks.emplace_back(
+         util::GeographicLib::GetCoordinate(coordinate2, angle1, tickRadius),
+         util::GeographicLib::GetCoordinate(coordinate2, angle2, tickRadius));
+
+      tickRadius += tickRadiusIncrement;
+   }
+
+   return ticks;
 }
 
 void LinkedVectors::SetVectorModulate(
@@ -200,139 +274,108 @@ void LinkedVectors::SetVectorTickRadiusIncrement(
 
 void LinkedVectors::FinishVectors()
 {
-   // Generate borders
-   if (p->borderEnabled_)
-   {
-      for (auto& di : p->vectorList_)
-      {
-         auto tickRadius = di->tickRadius_;
-
-         for (std::size_t i = 0; i < di->coordinates_.size() - 1; ++i)
-         {
-            auto borderLine = p->geoLines_->AddLine();
-
-            const common::Coordinate& coordinate1 = di->coordinates_[i];
-            const common::Coordinate& coordinate2 = di->coordinates_[i + 1];
-
-            const double& latitude1  = coordinate1.latitude_;
-            const double& longitude1 = coordinate1.longitude_;
-            const double& latitude2  = coordinate2.latitude_;
-            const double& longitude2 = coordinate2.longitude_;
+   // Ticks are computed once per vector, unless provided by the geometry
+   std::vector<std::vector<LinkedVectorGeometry::TickMark>> computedTicks(
+      p->vectorList_.size());
+   std::vector<const std::vector<LinkedVectorGeometry::TickMark>*> vectorTicks(
+      p->vectorList_.size(), nullptr);
 
-            p->geoLines_->SetLineLocation(
-               borderLine, latitude1, longitude1, latitude2, longitude2);
-
-            p->geoLines_->SetLineModulate(borderLine, kBlack);
-            p->geoLines_->SetLineWidth(borderLine, di->width_ + 2.0f);
-            p->geoLines_->SetLineVisible(borderLine, di->visible_);
-            p->geoLines_->SetLineHoverText(borderLine, di->hoverText_);
-
-            di->borderDrawItems_.emplace_back(std::move(borderLine));
-
-            if (di->ticksEnabled_)
-            {
-               auto angle = util::GeographicLib::GetAngle(
-                  latitude1, longitude1, latitude2, longitude2);
-               auto angle1 = angle + units::angle::degrees<double>(90.0);
-               auto angle2 = angle - units::angle::degrees<double>(90.0);
-
-               auto tickCoord1 = util::GeographicLib::GetCoordinate(
-                  coordinate2, angle1, tickRadius);
-               auto tickCoord2 = util::GeographicLib::GetCoordinate(
-                  coordinate2, angle2, tickRadius);
-
-               const double& tickLat1 = tickCoord1.latitude_;
-               const double& tickLon1 = tickCoord1.longitude_;
-               const double& tickLat2 = tickCoord2.latitude_;
-               const double& tickLon2 = tickCoord2.longitude_;
-
-               auto tickBorderLine = p->geoLines_->AddLine();
-
-               p->geoLines_->SetLineLocation(
-                  tickBorderLine, tickLat1, tickLon1, tickLat2, tickLon2);
+   for (std::size_t i = 0; i < p->vectorList_.size(); ++i)
+   {
+      auto& di = p->vectorList_[i];
 
-               p->geoLines_->SetLineModulate(tickBorderLine, kBlack);
-               p->geoLines_->SetLineWidth(tickBorderLine, di->width_ + 2.0f);
-               p->geoLines_->SetLineVisible(tickBorderLine, di->visible_);
-               p->geoLines_->SetLineHoverText(tickBorderLine, di->hoverText_);
+      if (!di->ticksEnabled_)
+      {
+         continue;
+      }
 
-               tickRadius += di->tickRadiusIncrement_;
-            }
-         }
+      if (di->geometry_->ticks_.empty())
+      {
+         computedTicks[i] = CreateTicks(di->geometry_->coordinates_,
+                                        di->tickRadius_,
+                                        di->tickRadiusIncrement_);
+         vectorTicks[i]   = &computedTicks[i];
+      }
+      else
+      {
+         vectorTicks[i] = &di->geometry_->ticks_;
       }
    }
 
-   // Generate geo lines
-   for (auto& di : p->vectorList_)
+   // Generate borders
+   if (p->borderEnabled_)
    {
-      auto tickRadius = di->tickRadius_;
-
-      for (std::size_t i = 0; i < di->coordinates_.size() - 1; ++i)
+      for (std::size_t i = 0; i < p->vectorList_.size(); ++i)
       {
-         auto geoLine = p->geoLines_->AddLine();
-
-         const common::Coordinate& coordinate1 = di->coordinates_[i];
-         const common::Coordinate& coordinate2 = di->coordinates_[i + 1];
+         p->AddLines(p->vectorList_[i], vectorTicks[i], true);
+      }
+   }
 
-         const double& latitude1  = coordinate1.latitude_;
-         const double& longitude1 = coordinate1.longitude_;
-         const double& latitude2  = coordinate2.latitude_;
-         const double& longitude2 = coordinate2.longitude_;
+   // Generate geo lines
+   for (std::size_t i = 0; i < p->vectorList_.size(); ++i)
+   {
+      p->AddLines(p->vectorList_[i], vectorTicks[i], false);
+   }
 
-         p->geoLines_->SetLineLocation(
-            geoLine, latitude1, longitude1, latitude2, longitude2);
+   // Finish geo lines
+   p->geoLines_->FinishLines();
+}
 
-         p->geoLines_->SetLineModulate(geoLine, di->modulate_);
-         p->geoLines_->SetLineWidth(geoLine, di->width_);
-         p->geoLines_->SetLineVisible(geoLine, di->visible_);
+void LinkedVectors::Impl::AddLines(
+   const std::shared_ptr<LinkedVectorDrawItem>&       di,
+   const std::vector<LinkedVectorGeometry::TickMark>* ticks,
+   bool                                               border)
+{
+   const auto& coordinates = di->geometry_->coordinates_;
 
-         // If the border is not enabled, this line must have hover text instead
-         if (!p->borderEnabled_)
-         {
-            p->geoLines_->SetLineHoverText(geoLine, di->hoverText_);
-         }
+   const boost::gil::rgba32f_pixel_t modulate =
+      border ? kBlack : di->modulate_;
+   const float width = border ? di->width_ + 2.0f : di->width_;
 
-         di->lineDrawItems_.emplace_back(std::move(geoLine));
+   // If the border is not enabled, lines must have hover text instead
+   const bool hoverTextEnabled = border || !borderEnabled_;
 
-         if (di->ticksEnabled_)
-         {
-            auto angle = util::GeographicLib::GetAngle(
-               latitude1, longitude1, latitude2, longitude2);
-            auto angle1 = angle + units::angle::degrees<double>(90.0);
-            auto angle2 = angle - units::angle::degrees<double>(90.0);
+   auto AddLine = [&](const common::Coordinate& coordinate1,
+                      const common::Coordinate& coordinate2)
+   {
+      auto geoLine = geoLines_->AddLine();
 
-            auto tickCoord1 = util::GeographicLib::GetCoordinate(
-               coordinate2, angle1, tickRadius);
-            auto tickCoord2 = util::GeographicLib::GetCoordinate(
-               coordinate2, angle2, tickRadius);
+      geoLines_->SetLineLocation(geoLine,
+                                 coordinate1.latitude_,
+                                 coordinate1.longitude_,
+                                 coordinate2.latitude_,
+                                 coordinate2.longitude_);
 
-            const double& tickLat1 = tickCoord1.latitude_;
-            const double& tickLon1 = tickCoord1.longitude_;
-            const double& tickLat2 = tickCoord2.latitude_;
-            const double& tickLon2 = tickCoord2.longitude_;
+      geoLines_->SetLineModulate(geoLine, modulate);
+      geoLines_->SetLineWidth(geoLine, width);
+      geoLines_->SetLineVisible(geoLine, di->visible_);
 
-            auto tickGeoLine = p->geoLines_->AddLine();
+      if (hoverTextEnabled)
+      {
+         geoLines_->SetLineHoverText(geoLine, di->hoverText_);
+      }
 
-            p->geoLines_->SetLineLocation(
-               tickGeoLine, tickLat1, tickLon1, tickLat2, tickLon2);
+      return geoLine;
+   };
 
-            p->geoLines_->SetLineModulate(tickGeoLine, di->modulate_);
-            p->geoLines_->SetLineWidth(tickGeoLine, di->width_);
-            p->geoLines_->SetLineVisible(tickGeoLine, di->visible_);
+   for (std::size_t i = 0; i + 1 < coordinates.size(); ++i)
+   {
+      auto geoLine = AddLine(coordinates[i], coordinates[i + 1]);
 
-            // If the border is not enabled, this line must have hover text
-            if (!p->borderEnabled_)
-            {
-               p->geoLines_->SetLineHoverText(tickGeoLine, di->hoverText_);
-            }
+      if (border)
+      {
+         di->borderDrawItems_.emplace_back(std::move(geoLine));
+      }
+      else
+      {
+         di->lineDrawItems_.emplace_back(std::move(geoLine));
+      }
 
-            tickRadius += di->tickRadiusIncrement_;
-         }
+      if (ticks != nullptr && i < ticks->size())
+      {
+         AddLine((*ticks)[i].first, (*ticks)[i].second);
       }
    }
-
-   // Finish geo lines
-   p->geoLines_->FinishLines();
 }
 
 bool LinkedVectors::RunMousePicking(
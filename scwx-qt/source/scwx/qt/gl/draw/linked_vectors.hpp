@@ -3,6 +3,9 @@
 #include <scwx/qt/gl/gl_context.hpp>
 #include <scwx/qt/gl/draw/draw_item.hpp>
 
+#include <utility>
+#include <vector>
+
 #include <boost/gil.hpp>
 #include <units/length.h>
 
@@ -27,6 +30,19 @@ namespace draw
 
 struct LinkedVectorDrawItem;
 
+/**
+ * @brief Geographic coordinates of a linked vector, and optionally its tick
+ * marks. Geometry is immutable once created, and may be created on a worker
+ * thread and shared between draw items.
+ */
+struct LinkedVectorGeometry
+{
+   typedef std::pair<common::Coordinate, common::Coordinate> TickMark;
+
+   std::vector<common::Coordinate> coordinates_ {};
+   std::vector<TickMark>           ticks_ {};
+};
+
 class LinkedVectors : public DrawItem
 {
 public:
@@ -87,6 +103,38 @@ public:
              const std::shared_ptr<const wsr88d::rpg::LinkedVectorPacket>&
                 vectorPacket);
 
+   /**
+    * Adds a linked vector with precomputed geometry to the internal draw list.
+    * If the geometry contains tick marks, ticks are enabled.
+    *
+    * @param [in] geometry Linked vector geometry
+    *
+    * @return Linked vector draw item
+    */
+   std::shared_ptr<LinkedVectorDrawItem>
+   AddVector(const std::shared_ptr<const LinkedVectorGeometry>& geometry);
+
+   /**
+    * Creates linked vector geometry, including tick marks at the end of each
+    * line segment.
+    *
+    * @param [in] center Center coordinate on which the linked vectors are based
+    * @param [in] vectorPacket Linked vector packet containing start and end
+    * points
+    * @param [in] tickRadius Length of the first tick extending beyond the
+    * linked vector
+    * @param [in] tickRadiusIncrement Length increment of each tick beyond the
+    * first
+    *
+    * @return Linked vector geometry
+    */
+   static std::shared_ptr<const LinkedVectorGeometry>
+   CreateGeometry(const common::Coordinate& center,
+                  const std::shared_ptr<const wsr88d::rpg::LinkedVectorPacket>&
+                                                vectorPacket,
+                  units::length::meters<double> tickRadius,
+                  units::length::meters<double> tickRadiusIncrement);
+
    /**
     * Sets the modulate color of a linked vector.
     *
@@ -2,6 +2,7 @@
 #include <scwx/qt/util/maplibre.hpp>
 #include <scwx/qt/util/texture_atlas.hpp>
 #include <scwx/qt/util/tooltip.hpp>
+#include <scwx/util/clock.hpp>
 #include <scwx/util/logger.hpp>
 
 #include <execution>
@@ -292,7 +293,7 @@ void PlacefileIcons::Render(
       // Selected time
       std::chrono::system_clock::time_point selectedTime =
          (p->selectedTime_ == std::chrono::system_clock::time_point {}) ?
-            std::chrono::system_clock::now() :
+            scwx::util::clock::Now() :
             p->selectedTime_;
       gl.glUniform1i(
          p->uSelectedTimeLocation_,
@@ -718,7 +719,7 @@ bool PlacefileIcons::RunMousePicking(
    // If no time has been selected, use the current time
    std::chrono::system_clock::time_point selectedTime =
       (p->selectedTime_ == std::chrono::system_clock::time_point {}) ?
-         std::chrono::system_clock::now() :
+         scwx::util::clock::Now() :
          p->selectedTime_;
 
    // For each pickable icon
@@ -2,6 +2,7 @@
 #include <scwx/qt/util/geographic_lib.hpp>
 #include <scwx/qt/util/maplibre.hpp>
 #include <scwx/qt/util/tooltip.hpp>
+#include <scwx/util/clock.hpp>
 #include <scwx/util/logger.hpp>
 
 #include <execution>
@@ -245,7 +246,7 @@ void PlacefileLines::Render(
       // Selected time
       std::chrono::system_clock::time_point selectedTime =
          (p->selectedTime_ == std::chrono::system_clock::time_point {}) ?
-            std::chrono::system_clock::now() :
+            scwx::util::clock::Now() :
             p->selectedTime_;
       gl.glUniform1i(
          p->uSelectedTimeLocation_,
@@ -525,7 +526,7 @@ bool PlacefileLines::RunMousePicking(
    // If no time has been selected, use the current time
    std::chrono::system_clock::time_point selectedTime =
       (p->selectedTime_ == std::chrono::system_clock::time_point {}) ?
-         std::chrono::system_clock::now() :
+         scwx::util::clock::Now() :
          p->selectedTime_;
 
    // For each pickable line
@@ -1,5 +1,6 @@
 #include <scwx/qt/gl/draw/placefile_polygons.hpp>
 #include <scwx/qt/util/maplibre.hpp>
+#include <scwx/util/clock.hpp>
 #include <scwx/util/logger.hpp>
 
 #include <mutex>
@@ -250,7 +251,7 @@ void PlacefilePolygons::Render(
       // Selected time
       std::chrono::system_clock::time_point selectedTime =
          (p->selectedTime_ == std::chrono::system_clock::time_point {}) ?
-            std::chrono::system_clock::now() :
+            scwx::util::clock::Now() :
             p->selectedTime_;
       gl.glUniform1i(
          p->uSelectedTimeLocation_,
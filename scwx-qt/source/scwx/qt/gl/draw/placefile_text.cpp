@@ -2,8 +2,10 @@
 #include <scwx/qt/manager/font_manager.hpp>
 #include <scwx/qt/manager/placefile_manager.hpp>
 #include <scwx/qt/settings/text_settings.hpp>
+#include <scwx/qt/util/geo_grid_index.hpp>
 #include <scwx/qt/util/maplibre.hpp>
 #include <scwx/qt/util/tooltip.hpp>
+#include <scwx/util/clock.hpp>
 #include <scwx/util/logger.hpp>
 
 #include <fmt/format.h>
@@ -22,9 +24,17 @@ namespace draw
 static const std::string logPrefix_ = "scwx::qt::gl::draw::placefile_text";
 static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 
+// Margin allowing text anchored outside of the viewport to extend into view,
+// in addition to the largest text offset
+static constexpr float kViewportMarginPixels_ = 256.0f;
+
 class PlacefileText::Impl
 {
 public:
+   typedef util::GeoGridIndex<
+      std::shared_ptr<const gr::Placefile::TextDrawItem>>
+      TextIndex;
+
    explicit Impl(const std::shared_ptr<GlContext>& context,
                  const std::string&                placefileName) :
        context_ {context}, placefileName_ {placefileName}
@@ -63,9 +73,13 @@ public:
    units::length::nautical_miles<double> mapDistance_ {};
 
    std::mutex listMutex_ {};
-   std::vector<std::shared_ptr<const gr::Placefile::TextDrawItem>> textList_ {};
    std::vector<std::shared_ptr<const gr::Placefile::TextDrawItem>> newList_ {};
 
+   TextIndex textIndex_ {};
+   TextIndex newIndex_ {};
+   float     maxOffset_ {};
+   float     newMaxOffset_ {};
+
    std::vector<std::shared_ptr<types::ImGuiFont>> fonts_ {};
    std::vector<std::shared_ptr<types::ImGuiFont>> newFonts_ {};
 };
@@ -102,7 +116,7 @@ void PlacefileText::Render(const QMapLibre::CustomLayerRenderParameters& params)
 {
    std::unique_lock lock {p->listMutex_};
 
-   if (!p->textList_.empty())
+   if (!p->textIndex_.empty())
    {
       // Reset text ID per frame
       p->textId_ = 0;
@@ -119,10 +133,12 @@ void PlacefileText::Render(const QMapLibre::CustomLayerRenderParameters& params)
       p->halfHeight_    = params.height * 0.5f;
       p->mapDistance_   = util::maplibre::GetMapDistance(params);
 
-      for (auto& di : p->textList_)
-      {
-         p->RenderTextDrawItem(params, di);
-      }
+      // Only render text anchored within the viewport
+      p->textIndex_.Query(
+         util::maplibre::GetViewportBounds(
+            params, kViewportMarginPixels_ + p->maxOffset_),
+         [&](const std::shared_ptr<const gr::Placefile::TextDrawItem>& di)
+         { p->RenderTextDrawItem(params, di); });
    }
 }
 
@@ -133,7 +149,7 @@ void PlacefileText::Impl::RenderTextDrawItem(
    // If no time has been selected, use the current time
    std::chrono::system_clock::time_point selectedTime =
       (selectedTime_ == std::chrono::system_clock::time_point {}) ?
-         std::chrono::system_clock::now() :
+         scwx::util::clock::Now() :
          selectedTime_;
 
    if ((!thresholded_ || mapDistance_ <= di->threshold_) &&
@@ -232,8 +248,8 @@ void PlacefileText::Deinitialize()
 {
    std::unique_lock lock {p->listMutex_};
 
-   // Clear the text list
-   p->textList_.clear();
+   // Clear the text index
+   p->textIndex_.Clear();
 }
 
 bool PlacefileText::RunMousePicking(
@@ -295,14 +311,29 @@ void PlacefileText::AddText(
 
 void PlacefileText::FinishText()
 {
+   // Index the new text by location
+   p->newIndex_.Clear();
+   p->newMaxOffset_ = 0.0f;
+
+   for (auto& di : p->newList_)
+   {
+      p->newIndex_.Insert(di->latitude_, di->longitude_, di);
+      p->newMaxOffset_ =
+         std::max({p->newMaxOffset_,
+                   static_cast<float>(std::abs(di->x_)),
+                   static_cast<float>(std::abs(di->y_))});
+   }
+
    std::unique_lock lock {p->listMutex_};
 
-   // Swap text lists
-   p->textList_.swap(p->newList_);
+   // Swap text indices
+   std::swap(p->textIndex_, p->newIndex_);
+   std::swap(p->maxOffset_, p->newMaxOffset_);
    p->fonts_.swap(p->newFonts_);
 
    // Clear the new list
    p->newList_.clear();
+   p->newIndex_.Clear();
    p->newFonts_.clear();
 }
 
@@ -1,5 +1,6 @@
 #include <scwx/qt/gl/draw/placefile_triangles.hpp>
 #include <scwx/qt/util/maplibre.hpp>
+#include <scwx/util/clock.hpp>
 #include <scwx/util/logger.hpp>
 
 #include <mutex>
@@ -199,7 +200,7 @@ void PlacefileTriangles::Render(
       // Selected time
       std::chrono::system_clock::time_point selectedTime =
          (p->selectedTime_ == std::chrono::system_clock::time_point {}) ?
-            std::chrono::system_clock::now() :
+            scwx::util::clock::Now() :
             p->selectedTime_;
       gl.glUniform1i(
          p->uSelectedTimeLocation_,
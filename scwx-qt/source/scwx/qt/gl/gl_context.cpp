@@ -124,8 +124,8 @@ GLuint GlContext::GetTextureAtlas()
 
    if (p->textureBufferCount_ != textureAtlas.BuildCount())
    {
-      p->textureBufferCount_ = textureAtlas.BuildCount();
-      textureAtlas.BufferAtlas(p->gl_, p->textureAtlas_);
+      p->textureBufferCount_ = textureAtlas.BufferAtlas(
+         p->gl_, p->textureAtlas_, p->textureBufferCount_);
    }
 
    return p->textureAtlas_;
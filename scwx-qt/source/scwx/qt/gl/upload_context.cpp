@@ -0,0 +1,175 @@
+#include <scwx/qt/gl/upload_context.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <mutex>
+
+#include <QOffscreenSurface>
+#include <QOpenGLContext>
+#include <QThread>
+
+namespace scwx
+{
+namespace qt
+{
+namespace gl
+{
+
+static const std::string logPrefix_ = "scwx::qt::gl::upload_context";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+class UploadContext::Impl
+{
+public:
+   explicit Impl(UploadContext* self, QOpenGLContext* shareContext);
+   ~Impl();
+
+   void Execute(const std::function<void(gl::OpenGLFunctions&)>& task,
+                std::promise<bool>&                              promise);
+
+   UploadContext* self_;
+
+   QThread           thread_ {};
+   QObject           worker_ {};
+   QOffscreenSurface surface_ {};
+   QOpenGLContext    context_ {};
+
+   gl::OpenGLFunctions gl_ {};
+
+   bool valid_ {false};
+   bool glInitialized_ {false};
+};
+
+UploadContext::UploadContext(QOpenGLContext* shareContext) :
+    p(std::make_unique<Impl>(this, shareContext))
+{
+}
+UploadContext::~UploadContext() = default;
+
+UploadContext::Impl::Impl(UploadContext* self, QOpenGLContext* shareContext) :
+    self_ {self}
+{
+   if (shareContext == nullptr)
+   {
+      logger_->warn("No share context, uploading on the render thread");
+      return;
+   }
+
+   // The surface must be created on the GUI thread
+   surface_.setFormat(shareContext->format());
+   surface_.create();
+
+   context_.setFormat(shareContext->format());
+   context_.setShareContext(shareContext);
+
+   if (!surface_.isValid() || !context_.create())
+   {
+      logger_->warn("Unable to create upload context");
+      return;
+   }
+
+   thread_.setObjectName("gl_upload");
+   worker_.moveToThread(&thread_);
+   context_.moveToThread(&thread_);
+   thread_.start();
+
+   valid_ = true;
+}
+
+UploadContext::Impl::~Impl()
+{
+   if (!valid_)
+   {
+      return;
+   }
+
+   // Release the context on the upload thread after any pending tasks, and
+   // return ownership to this thread before destroying it
+   QThread* owner = QThread::currentThread();
+
+   QMetaObject::invokeMethod(
+      &worker_,
+      [this, owner]()
+      {
+         context_.doneCurrent();
+         context_.moveToThread(owner);
+         worker_.moveToThread(owner);
+      },
+      Qt::BlockingQueuedConnection);
+
+   thread_.quit();
+   thread_.wait();
+}
+
+bool UploadContext::IsValid() const
+{
+   return p->valid_;
+}
+
+std::future<bool>
+UploadContext::Post(std::function<void(gl::OpenGLFunctions&)> task)
+{
+   auto              promise = std::make_shared<std::promise<bool>>();
+   std::future<bool> future  = promise->get_future();
+
+   if (!p->valid_)
+   {
+      promise->set_value(false);
+      return future;
+   }
+
+   QMetaObject::invokeMethod(
+      &p->worker_,
+      [impl = p.get(), task = std::move(task), promise]()
+      {
+         impl->Execute(task, *promise);
+         Q_EMIT impl->self_->TaskCompleted();
+      });
+
+   return future;
+}
+
+void UploadContext::Impl::Execute(
+   const std::function<void(gl::OpenGLFunctions&)>& task,
+   std::promise<bool>&                              promise)
+{
+   if (!context_.makeCurrent(&surface_))
+   {
+      logger_->error("Unable to make upload context current");
+      promise.set_value(false);
+      return;
+   }
+
+   if (!glInitialized_)
+   {
+      gl_.initializeOpenGLFunctions();
+      glInitialized_ = true;
+   }
+
+   task(gl_);
+
+   promise.set_value(true);
+}
+
+std::shared_ptr<UploadContext> UploadContext::Instance()
+{
+   static std::weak_ptr<UploadContext> uploadContextReference_ {};
+   static std::mutex                   instanceMutex_ {};
+
+   std::unique_lock lock(instanceMutex_);
+
+   std::shared_ptr<UploadContext> uploadContext =
+      uploadContextReference_.lock();
+
+   if (uploadContext == nullptr)
+   {
+      uploadContext =
+         std::make_shared<UploadContext>(QOpenGLContext::globalShareContext());
+      uploadContextReference_ = uploadContext;
+   }
+
+   return uploadContext;
+}
+
+} // namespace gl
+} // namespace qt
+} // namespace scwx
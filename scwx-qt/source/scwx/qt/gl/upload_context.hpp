@@ -0,0 +1,80 @@
+#pragma once
+
+#include <scwx/qt/gl/gl.hpp>
+
+#include <functional>
+#include <future>
+#include <memory>
+
+#include <QObject>
+
+class QOpenGLContext;
+
+namespace scwx
+{
+namespace qt
+{
+namespace gl
+{
+
+/**
+ * @brief OpenGL context on a dedicated thread, sharing objects with the
+ * rendering contexts. Used to upload large buffers without blocking the render
+ * thread.
+ *
+ * Tasks are executed in the order they are posted. Vertex array objects are not
+ * shared between contexts, and must not be used by tasks. A task writing to
+ * shared objects should insert a fence, which is tested by the render thread
+ * before binding the objects.
+ */
+class UploadContext : public QObject
+{
+   Q_OBJECT
+   Q_DISABLE_COPY_MOVE(UploadContext)
+
+public:
+   /**
+    * @brief Creates the upload context. Must be called from the GUI thread.
+    *
+    * @param [in] shareContext Context with which objects are shared
+    */
+   explicit UploadContext(QOpenGLContext* shareContext);
+   ~UploadContext();
+
+   /**
+    * @brief Whether the shared context was created. If not, uploads must be
+    * performed on the render thread.
+    */
+   bool IsValid() const;
+
+   /**
+    * @brief Posts a task to the upload thread. The shared context is current
+    * while the task is executed.
+    *
+    * @param [in] task Upload task
+    *
+    * @return Future which is true once the task has been executed, or false if
+    * the task could not be executed
+    */
+   std::future<bool> Post(std::function<void(gl::OpenGLFunctions&)> task);
+
+   /**
+    * @brief Gets the upload context sharing objects with the global share
+    * context. The first call must be from the GUI thread.
+    */
+   static std::shared_ptr<UploadContext> Instance();
+
+signals:
+   /**
+    * @brief Emitted from the upload thread after each task is executed.
+    */
+   void TaskCompleted();
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace gl
+} // namespace qt
+} // namespace scwx
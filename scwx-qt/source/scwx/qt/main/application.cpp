@@ -18,6 +18,7 @@ static const auto        logger_    = util::Logger::Create(logPrefix_);
 static std::mutex              initializationMutex_ {};
 static std::condition_variable initializationCondition_ {};
 static bool                    initialized_ {false};
+static bool                    firstPaintFinished_ {false};
 
 void FinishInitialization()
 {
@@ -44,6 +45,37 @@ void WaitForInitialization()
    }
 }
 
+void FinishFirstPaint()
+{
+   std::unique_lock lock(initializationMutex_);
+
+   if (firstPaintFinished_)
+   {
+      return;
+   }
+
+   logger_->debug("First paint finished");
+
+   // Set first paint finished to true
+   firstPaintFinished_ = true;
+   lock.unlock();
+
+   // Notify any threads waiting for the first paint
+   initializationCondition_.notify_all();
+}
+
+void WaitForFirstPaint()
+{
+   std::unique_lock lock(initializationMutex_);
+
+   // While the first paint has not finished
+   while (!firstPaintFinished_)
+   {
+      // Wait for the first paint
+      initializationCondition_.wait(lock);
+   }
+}
+
 } // namespace Application
 } // namespace main
 } // namespace qt
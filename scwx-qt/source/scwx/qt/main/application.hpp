@@ -12,6 +12,13 @@ namespace Application
 void FinishInitialization();
 void WaitForInitialization();
 
+/**
+ * @brief Signals that the main window has been painted, releasing
+ * initialization which was deferred until after startup.
+ */
+void FinishFirstPaint();
+void WaitForFirstPaint();
+
 } // namespace Application
 } // namespace main
 } // namespace qt
@@ -0,0 +1,243 @@
+#include <scwx/qt/config/county_store.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <fmt/format.h>
+#include <QCoreApplication>
+#include <QResource>
+#include <sqlite3.h>
+
+static const std::string logPrefix_ = "scwx::county_benchmark";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+static const std::string kCountyStoreFilename_ = ":/res/db/counties.bin";
+
+namespace
+{
+
+typedef std::unordered_map<std::string, std::string> CountyMap;
+typedef std::unordered_map<std::string, CountyMap>   StateMap;
+typedef std::unordered_map<char, StateMap>           FormatMap;
+
+struct Options
+{
+   std::string sqlitePath_ {SCWX_COUNTIES_SQLITE_DB};
+   std::size_t iterations_ {20u};
+};
+
+} // namespace
+
+static FormatMap LoadSqliteDatabase(const std::string& path);
+static std::chrono::nanoseconds Measure(std::size_t                  iterations,
+                                        const std::function<void()>& function);
+static void PrintResult(const std::string&       name,
+                        std::chrono::nanoseconds legacy,
+                        std::chrono::nanoseconds compact,
+                        std::size_t              count);
+
+int main(int argc, char* argv[])
+{
+   QCoreApplication app(argc, argv);
+
+   Options options {};
+
+   for (int i = 1; i < argc; ++i)
+   {
+      const std::string arg {argv[i]};
+
+      if ((arg == "-n" || arg == "--iterations") && i + 1 < argc)
+      {
+         options.iterations_ =
+            static_cast<std::size_t>(std::max(1, std::atoi(argv[++i])));
+      }
+      else if (arg == "-h" || arg == "--help")
+      {
+         std::cout << fmt::format(
+            "Usage: {} [-n iterations] [counties.db]\n\n"
+            "Compares the SQLite county database loader with the compact "
+            "county store.\n",
+            argv[0]);
+         return 0;
+      }
+      else
+      {
+         options.sqlitePath_ = arg;
+      }
+   }
+
+   QResource resource {QString::fromStdString(kCountyStoreFilename_)};
+   if (!resource.isValid())
+   {
+      logger_->error("Unable to open county store");
+      return 1;
+   }
+
+   const QByteArray       storeData = resource.uncompressedData();
+   const std::string_view storeView {
+      storeData.constData(), static_cast<std::size_t>(storeData.size())};
+
+   FormatMap legacy = LoadSqliteDatabase(options.sqlitePath_);
+   scwx::qt::config::CountyStore store {storeView};
+
+   if (legacy.empty() || store.empty())
+   {
+      logger_->error("Unable to load county databases");
+      return 1;
+   }
+
+   // Collect query keys
+   std::vector<std::string> ids {};
+   std::vector<std::string> states {};
+
+   for (auto& [format, stateMap] : legacy)
+   {
+      for (auto& [state, countyMap] : stateMap)
+      {
+         states.push_back(state);
+         for (auto& county : countyMap)
+         {
+            ids.push_back(county.first);
+         }
+      }
+   }
+
+   std::cout << fmt::format("{} counties and zones, {} iterations\n\n",
+                            ids.size(),
+                            options.iterations_);
+   std::cout << fmt::format(
+      "{:<16} {:>14} {:>14} {:>8}\n", "", "SQLite (ns)", "Store (ns)", "Ratio");
+
+   // Load
+   PrintResult(
+      "Load",
+      Measure(options.iterations_,
+              [&]() { LoadSqliteDatabase(options.sqlitePath_); }),
+      Measure(options.iterations_,
+              [&]() { scwx::qt::config::CountyStore {storeView}; }),
+      1u);
+
+   // County name lookup
+   std::size_t found = 0u;
+
+   PrintResult("GetCountyName",
+               Measure(options.iterations_,
+                       [&]()
+                       {
+                          for (const std::string& id : ids)
+                          {
+                             auto& counties = legacy[id.at(2)][id.substr(0, 2)];
+                             found += counties.count(id);
+                          }
+                       }),
+               Measure(options.iterations_,
+                       [&]()
+                       {
+                          for (const std::string& id : ids)
+                          {
+                             found += store.FindCounty(id).has_value();
+                          }
+                       }),
+               ids.size());
+
+   // Counties by state
+   PrintResult("GetCounties",
+               Measure(options.iterations_,
+                       [&]()
+                       {
+                          for (const std::string& state : states)
+                          {
+                             CountyMap counties = legacy['C'][state];
+                             found += counties.size();
+                          }
+                       }),
+               Measure(options.iterations_,
+                       [&]()
+                       {
+                          for (const std::string& state : states)
+                          {
+                             found += store.GetCounties(state).size();
+                          }
+                       }),
+               states.size());
+
+   logger_->trace("Found {}", found);
+
+   return 0;
+}
+
+static std::chrono::nanoseconds Measure(std::size_t                  iterations,
+                                        const std::function<void()>& function)
+{
+   const auto start = std::chrono::steady_clock::now();
+
+   for (std::size_t i = 0; i < iterations; ++i)
+   {
+      function();
+   }
+
+   return (std::chrono::steady_clock::now() - start) / iterations;
+}
+
+static void PrintResult(const std::string&       name,
+                        std::chrono::nanoseconds legacy,
+                        std::chrono::nanoseconds compact,
+                        std::size_t              count)
+{
+   std::cout << fmt::format(
+      "{:<16} {:>14} {:>14} {:>7.1f}x\n",
+      name,
+      legacy.count() / static_cast<std::int64_t>(count),
+      compact.count() / static_cast<std::int64_t>(count),
+      static_cast<double>(legacy.count()) /
+         static_cast<double>(std::max<std::int64_t>(1, compact.count())));
+}
+
+// Loads the SQLite county database into nested maps, as the county database
+// did prior to the compact store
+static FormatMap LoadSqliteDatabase(const std::string& path)
+{
+   FormatMap countyDatabase {};
+   sqlite3*  db;
+
+   if (sqlite3_open_v2(path.c_str(), &db, SQLITE_OPEN_READONLY, nullptr) !=
+       SQLITE_OK)
+   {
+      logger_->error("Unable to open database: \"{}\"", path);
+      sqlite3_close(db);
+      return countyDatabase;
+   }
+
+   countyDatabase.emplace('C', StateMap {});
+
+   sqlite3_exec(
+      db,
+      "SELECT * FROM counties",
+      [](void* param, int columns, char** columnText, char**) -> int
+      {
+         if (columns == 2 && std::strlen(columnText[0]) == 6)
+         {
+            FormatMap&  database = *static_cast<FormatMap*>(param);
+            std::string fipsId   = columnText[0];
+            std::string state    = fipsId.substr(0, 2);
+            char        type     = fipsId.at(2);
+
+            database[type][state].emplace(
+               fipsId, columnText[1] != nullptr ? columnText[1] : "");
+         }
+         return 0;
+      },
+      &countyDatabase,
+      nullptr);
+
+   sqlite3_close(db);
+
+   return countyDatabase;
+}
@@ -0,0 +1,232 @@
+#include <scwx/util/logger.hpp>
+#include <scwx/wsr88d/level3_file.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+static const std::string logPrefix_ = "scwx::level3_benchmark";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+// Counts heap allocations made while parsing and releasing messages
+static std::atomic<std::size_t> allocationCount_ {0u};
+
+void* operator new(std::size_t size)
+{
+   ++allocationCount_;
+
+   void* ptr = std::malloc(std::max<std::size_t>(size, 1u));
+   if (ptr == nullptr)
+   {
+      throw std::bad_alloc();
+   }
+   return ptr;
+}
+
+void* operator new[](std::size_t size)
+{
+   return operator new(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+   std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+   std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+   std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+   std::free(ptr);
+}
+
+namespace
+{
+
+struct Options
+{
+   std::vector<std::string> paths_ {};
+   std::size_t              iterations_ {20u};
+};
+
+struct Result
+{
+   std::chrono::nanoseconds parseTime_ {};
+   std::chrono::nanoseconds releaseTime_ {};
+   std::size_t              allocations_ {0u};
+   std::size_t              arenaObjects_ {0u};
+   std::size_t              arenaBytes_ {0u};
+};
+
+} // namespace
+
+static bool Benchmark(const std::string& data,
+                      std::size_t        iterations,
+                      Result&            result);
+static void PrintResult(const std::string& name, const Result& result);
+static void AddFiles(const std::filesystem::path&        path,
+                     std::vector<std::filesystem::path>& files);
+
+int main(int argc, char* argv[])
+{
+   Options options {};
+
+   for (int i = 1; i < argc; ++i)
+   {
+      const std::string arg {argv[i]};
+
+      if ((arg == "-n" || arg == "--iterations") && i + 1 < argc)
+      {
+         options.iterations_ =
+            static_cast<std::size_t>(std::max(1, std::atoi(argv[++i])));
+      }
+      else if (arg == "-h" || arg == "--help")
+      {
+         std::cout << fmt::format(
+            "Usage: {} [-n iterations] <file|directory>...\n\n"
+            "Measures parsing and releasing Level 3 products, including heap "
+            "allocations and\npacket arena usage per message.\n",
+            argv[0]);
+         return 0;
+      }
+      else
+      {
+         options.paths_.push_back(arg);
+      }
+   }
+
+   if (options.paths_.empty())
+   {
+      logger_->error("No Level 3 files specified");
+      return 1;
+   }
+
+   std::vector<std::filesystem::path> files {};
+   for (const std::string& path : options.paths_)
+   {
+      AddFiles(path, files);
+   }
+
+   std::cout << fmt::format("{} files, {} iterations\n\n",
+                            files.size(),
+                            options.iterations_);
+   std::cout << fmt::format("{:<40} {:>12} {:>12} {:>10} {:>10} {:>10}\n",
+                            "",
+                            "Parse (ns)",
+                            "Release (ns)",
+                            "Heap",
+                            "Packets",
+                            "Arena (B)");
+
+   for (const std::filesystem::path& file : files)
+   {
+      std::ifstream      f {file, std::ios_base::in | std::ios_base::binary};
+      std::ostringstream ss {};
+      ss << f.rdbuf();
+
+      Result result {};
+      if (Benchmark(ss.str(), options.iterations_, result))
+      {
+         PrintResult(file.filename().string(), result);
+      }
+      else
+      {
+         logger_->warn("Unable to load: {}", file.string());
+      }
+   }
+
+   return 0;
+}
+
+static bool
+Benchmark(const std::string& data, std::size_t iterations, Result& result)
+{
+   for (std::size_t i = 0; i < iterations; ++i)
+   {
+      std::istringstream is {data};
+
+      const std::size_t allocationsStart = allocationCount_;
+      const auto        parseStart       = std::chrono::steady_clock::now();
+
+      auto file = std::make_shared<scwx::wsr88d::Level3File>();
+      if (!file->LoadData(is) || file->message() == nullptr)
+      {
+         return false;
+      }
+
+      const auto parseEnd = std::chrono::steady_clock::now();
+
+      const auto& arena = file->message()->packet_arena();
+      result.arenaObjects_ = arena->object_count();
+      result.arenaBytes_   = arena->bytes_allocated();
+
+      // Release the message and each of its packets
+      file.reset();
+
+      const auto releaseEnd = std::chrono::steady_clock::now();
+
+      result.allocations_ = allocationCount_ - allocationsStart;
+      result.parseTime_ += parseEnd - parseStart;
+      result.releaseTime_ += releaseEnd - parseEnd;
+   }
+
+   result.parseTime_ /= iterations;
+   result.releaseTime_ /= iterations;
+
+   return true;
+}
+
+static void PrintResult(const std::string& name, const Result& result)
+{
+   std::cout << fmt::format("{:<40} {:>12} {:>12} {:>10} {:>10} {:>10}\n",
+                            name,
+                            result.parseTime_.count(),
+                            result.releaseTime_.count(),
+                            result.allocations_,
+                            result.arenaObjects_,
+                            result.arenaBytes_);
+}
+
+static void AddFiles(const std::filesystem::path&        path,
+                     std::vector<std::filesystem::path>& files)
+{
+   std::error_code error;
+
+   if (std::filesystem::is_directory(path, error))
+   {
+      const std::size_t first = files.size();
+
+      for (auto& entry : std::filesystem::directory_iterator(path, error))
+      {
+         if (entry.is_regular_file())
+         {
+            files.push_back(entry.path());
+         }
+      }
+
+      std::sort(files.begin() + static_cast<std::ptrdiff_t>(first),
+                files.end());
+   }
+   else
+   {
+      files.push_back(path);
+   }
+}
@@ -2,6 +2,7 @@
 
 #include <scwx/qt/config/county_database.hpp>
 #include <scwx/qt/config/radar_site.hpp>
+#include <scwx/qt/main/application.hpp>
 #include <scwx/qt/main/main_window.hpp>
 #include <scwx/qt/main/versions.hpp>
 #include <scwx/qt/manager/log_manager.hpp>
@@ -14,6 +15,7 @@
 #include <scwx/qt/ui/setup/setup_wizard.hpp>
 #include <scwx/network/cpr.hpp>
 #include <scwx/util/environment.hpp>
+#include <scwx/util/initialization_graph.hpp>
 #include <scwx/util/logger.hpp>
 #include <scwx/util/threads.hpp>
 
@@ -93,19 +95,51 @@ int main(int argc, char* argv[])
                         }
                      });
 
-   // Initialize AWS SDK
-   Aws::SDKOptions awsSdkOptions;
-   Aws::InitAPI(awsSdkOptions);
+   // Initialize application. Independent steps run in parallel, and steps
+   // using Qt GUI classes run on the main thread.
+   using ThreadAffinity = scwx::util::InitializationGraph::ThreadAffinity;
+
+   Aws::SDKOptions                 awsSdkOptions;
+   scwx::util::InitializationGraph startup {"startup"};
+
+   startup.AddStep("log_file", [&]() { logManager.InitializeLogFile(); });
+   startup.AddStep(
+      "aws_sdk", [&]() { Aws::InitAPI(awsSdkOptions); }, {"log_file"});
+   startup.AddStep(
+      "radar_sites",
+      []() { scwx::qt::config::RadarSite::Initialize(); },
+      {"log_file"});
+   startup.AddStep(
+      "settings",
+      []() { scwx::qt::manager::SettingsManager::Instance().Initialize(); },
+      {"radar_sites"});
+   startup.AddStep(
+      "resources",
+      []() { scwx::qt::manager::ResourceManager::Initialize(); },
+      {"settings"},
+      ThreadAffinity::Caller);
+   startup.AddStep(
+      "theme",
+      [&]() { ConfigureTheme(args); },
+      {"settings"},
+      ThreadAffinity::Caller);
+
+   startup.Run();
+
+   // Steps not required to display the main window are deferred until after
+   // the first frame has been presented. Queries made before then wait for
+   // the step to complete.
+   scwx::util::InitializationGraph deferred {"deferred", 1u};
+
+   deferred.AddStep("county_database",
+                    []() { scwx::qt::config::CountyDatabase::Initialize(); });
 
-   // Initialize application
-   logManager.InitializeLogFile();
-   scwx::qt::config::RadarSite::Initialize();
-   scwx::qt::config::CountyDatabase::Initialize();
-   scwx::qt::manager::SettingsManager::Instance().Initialize();
-   scwx::qt::manager::ResourceManager::Initialize();
-
-   // Theme
-   ConfigureTheme(args);
+   boost::asio::post(threadPool,
+                     [&]()
+                     {
+                        scwx::qt::main::Application::WaitForFirstPaint();
+                        deferred.Run();
+                     });
 
    // Run initial setup if required
    if (scwx::qt::ui::setup::SetupWizard::IsSetupRequired())
@@ -123,6 +157,9 @@ int main(int argc, char* argv[])
       result = a.exec();
    }
 
+   // Release deferred initialization if the main window was never painted
+   scwx::qt::main::Application::FinishFirstPaint();
+
    // Deinitialize application
    scwx::qt::manager::RadarProductManager::Cleanup();
 
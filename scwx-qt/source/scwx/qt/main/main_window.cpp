@@ -23,6 +23,7 @@
 #include <scwx/qt/ui/alert_dock_widget.hpp>
 #include <scwx/qt/ui/animation_dock_widget.hpp>
 #include <scwx/qt/ui/collapsible_group.hpp>
+#include <scwx/qt/ui/cross_section_dock_widget.hpp>
 #include <scwx/qt/ui/flow_layout.hpp>
 #include <scwx/qt/ui/gps_info_dialog.hpp>
 #include <scwx/qt/ui/imgui_debug_dialog.hpp>
@@ -38,6 +39,7 @@
 #include <scwx/common/characters.hpp>
 #include <scwx/common/products.hpp>
 #include <scwx/common/vcp.hpp>
+#include <scwx/util/clock.hpp>
 #include <scwx/util/logger.hpp>
 #include <scwx/util/time.hpp>
 
@@ -64,6 +66,8 @@ namespace main
 static const std::string logPrefix_ = "scwx::qt::main::main_window";
 static const auto        logger_    = util::Logger::Create(logPrefix_);
 
+static constexpr std::chrono::seconds kFirstPaintTimeout_ {5};
+
 class MainWindowImpl : public QObject
 {
    Q_OBJECT
@@ -83,6 +87,7 @@ public:
        level3ProductsWidget_ {nullptr},
        alertDockWidget_ {nullptr},
        animationDockWidget_ {nullptr},
+       crossSectionDockWidget_ {nullptr},
        aboutDialog_ {nullptr},
        gpsInfoDialog_ {nullptr},
        imGuiDebugDialog_ {nullptr},
@@ -200,17 +205,21 @@ public:
    QLabel* coordinateLabel_ {nullptr};
    QLabel* timeLabel_ {nullptr};
 
-   ui::AlertDockWidget*     alertDockWidget_;
-   ui::AnimationDockWidget* animationDockWidget_;
-   ui::AboutDialog*         aboutDialog_;
-   ui::GpsInfoDialog*       gpsInfoDialog_;
-   ui::ImGuiDebugDialog*    imGuiDebugDialog_;
-   ui::LayerDialog*         layerDialog_;
-   ui::PlacefileDialog*     placefileDialog_;
-   ui::MarkerDialog*        markerDialog_;
-   ui::RadarSiteDialog*     radarSiteDialog_;
-   ui::SettingsDialog*      settingsDialog_;
-   ui::UpdateDialog*        updateDialog_;
+   ui::AlertDockWidget*        alertDockWidget_;
+   ui::AnimationDockWidget*    animationDockWidget_;
+   ui::CrossSectionDockWidget* crossSectionDockWidget_;
+   ui::AboutDialog*            aboutDialog_;
+   ui::GpsInfoDialog*          gpsInfoDialog_;
+   ui::ImGuiDebugDialog*       imGuiDebugDialog_;
+   ui::LayerDialog*            layerDialog_;
+   ui::PlacefileDialog*        placefileDialog_;
+   ui::MarkerDialog*           markerDialog_;
+   ui::RadarSiteDialog*        radarSiteDialog_;
+   ui::SettingsDialog*         settingsDialog_;
+   ui::UpdateDialog*           updateDialog_;
+
+   // Map on which the cross-section line was drawn
+   map::MapWidget* crossSectionMap_ {nullptr};
 
    QTimer clockTimer_ {};
 
@@ -283,6 +292,11 @@ MainWindow::MainWindow(QWidget* parent) :
    p->alertDockWidget_ = new ui::AlertDockWidget(this);
    addDockWidget(Qt::BottomDockWidgetArea, p->alertDockWidget_);
 
+   // Configure Cross-Section Dock
+   p->crossSectionDockWidget_ = new ui::CrossSectionDockWidget(this);
+   addDockWidget(Qt::BottomDockWidgetArea, p->crossSectionDockWidget_);
+   p->crossSectionDockWidget_->hide();
+
    // GPS Info Dialog
    p->gpsInfoDialog_ = new ui::GpsInfoDialog(this);
 
@@ -295,6 +309,10 @@ MainWindow::MainWindow(QWidget* parent) :
    ui->menuView->insertAction(ui->actionAlerts,
                               p->alertDockWidget_->toggleViewAction());
    p->alertDockWidget_->toggleViewAction()->setText(tr("&Alerts"));
+   ui->menuView->insertAction(ui->actionAlerts,
+                              p->crossSectionDockWidget_->toggleViewAction());
+   p->crossSectionDockWidget_->toggleViewAction()->setText(
+      tr("&Cross-Section"));
    ui->actionAlerts->setVisible(false);
 
    ui->menuDebug->menuAction()->setVisible(
@@ -419,6 +437,17 @@ MainWindow::MainWindow(QWidget* parent) :
    p->HandleFocusChange(p->activeMap_);
    p->AsyncSetup();
 
+   // Deferred initialization begins once the first frame has been presented,
+   // or after a timeout if the window is not visible
+   connect(p->maps_.at(0),
+           &QOpenGLWidget::frameSwapped,
+           this,
+           []() { Application::FinishFirstPaint(); },
+           Qt::SingleShotConnection);
+   QTimer::singleShot(kFirstPaintTimeout_,
+                      this,
+                      []() { Application::FinishFirstPaint(); });
+
    Application::FinishInitialization();
 }
 
@@ -634,6 +663,14 @@ void MainWindow::on_actionImGuiDebug_triggered()
    p->imGuiDebugDialog_->show();
 }
 
+void MainWindow::on_actionPipelineMetrics_triggered(bool checked)
+{
+   for (map::MapWidget* map : p->maps_)
+   {
+      map->SetMetricsOverlayVisible(checked);
+   }
+}
+
 void MainWindow::on_actionDumpLayerList_triggered()
 {
    p->activeMap_->DumpLayerList();
@@ -644,6 +681,11 @@ void MainWindow::on_actionDumpRadarProductRecords_triggered()
    manager::RadarProductManager::DumpRecords();
 }
 
+void MainWindow::on_actionDumpPipelineMetrics_triggered()
+{
+   map::MapWidget::DumpPipelineMetrics();
+}
+
 void MainWindow::on_actionUserManual_triggered()
 {
    QDesktopServices::openUrl(QUrl {"https://supercell-wx.readthedocs.io/"});
@@ -723,6 +765,9 @@ void MainWindowImpl::AsyncSetup()
       boost::asio::post(threadPool_,
                         [this]()
                         {
+                           // Don't compete with startup for the network
+                           main::Application::WaitForFirstPaint();
+
                            try
                            {
                               manager::UpdateManager::RemoveTemporaryReleases();
@@ -872,6 +917,21 @@ void MainWindowImpl::ConnectMapSignals()
               &map::MapWidget::AlertSelected,
               alertDockWidget_,
               &ui::AlertDockWidget::SelectAlert);
+      connect(mapWidget,
+              &map::MapWidget::CrossSectionLineChanged,
+              this,
+              [=, this](common::Coordinate start, common::Coordinate end)
+              {
+                 if (crossSectionMap_ != nullptr &&
+                     crossSectionMap_ != mapWidget)
+                 {
+                    crossSectionMap_->ClearCrossSectionLine();
+                 }
+                 crossSectionMap_ = mapWidget;
+
+                 crossSectionDockWidget_->SelectLine(
+                    mapWidget->GetRadarProductView(), start, end);
+              });
       connect(mapWidget,
               &map::MapWidget::MapParametersChanged,
               this,
@@ -936,6 +996,12 @@ void MainWindowImpl::ConnectMapSignals()
                UpdateRadarSite();
                UpdateVcp();
             }
+
+            if (mapWidget == crossSectionMap_)
+            {
+               crossSectionDockWidget_->UpdateProduct(
+                  mapWidget->GetRadarProductView());
+            }
          },
          Qt::QueuedConnection);
 
@@ -1149,6 +1215,22 @@ void MainWindowImpl::ConnectOtherSignals()
            &MainWindow::ActiveMapMoved,
            radarSiteDialog_,
            &ui::RadarSiteDialog::HandleMapUpdate);
+   connect(crossSectionDockWidget_->toggleViewAction(),
+           &QAction::toggled,
+           this,
+           [this](bool checked)
+           {
+              if (!checked)
+              {
+                 // Remove the cross-section line when the dock is closed
+                 if (crossSectionMap_ != nullptr)
+                 {
+                    crossSectionMap_->ClearCrossSectionLine();
+                    crossSectionMap_ = nullptr;
+                 }
+                 crossSectionDockWidget_->ClearLine();
+              }
+           });
    connect(layerModel_.get(),
            &model::LayerModel::LayerDisplayChanged,
            this,
@@ -1233,7 +1315,7 @@ void MainWindowImpl::ConnectOtherSignals()
            [this]()
            {
               timeLabel_->setText(QString::fromStdString(
-                 util::TimeString(std::chrono::system_clock::now())));
+                 util::TimeString(util::clock::Now())));
               timeLabel_->setVisible(true);
            });
    clockTimer_.start(1000);
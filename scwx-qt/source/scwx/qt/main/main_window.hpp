@@ -47,8 +47,10 @@ private slots:
    void on_actionMarkerManager_triggered();
    void on_actionLayerManager_triggered();
    void on_actionImGuiDebug_triggered();
+   void on_actionPipelineMetrics_triggered(bool checked);
    void on_actionDumpLayerList_triggered();
    void on_actionDumpRadarProductRecords_triggered();
+   void on_actionDumpPipelineMetrics_triggered();
    void on_actionUserManual_triggered();
    void on_actionDiscord_triggered();
    void on_actionGitHubRepository_triggered();
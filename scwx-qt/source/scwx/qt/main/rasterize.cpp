@@ -0,0 +1,410 @@
+#include <scwx/qt/config/radar_site.hpp>
+#include <scwx/qt/main/versions.hpp>
+#include <scwx/qt/manager/log_manager.hpp>
+#include <scwx/qt/manager/radar_product_manager.hpp>
+#include <scwx/qt/manager/settings_manager.hpp>
+#include <scwx/qt/request/nexrad_file_request.hpp>
+#include <scwx/qt/settings/palette_settings.hpp>
+#include <scwx/qt/util/file.hpp>
+#include <scwx/qt/util/sweep_rasterizer.hpp>
+#include <scwx/qt/view/radar_product_view_factory.hpp>
+#include <scwx/util/logger.hpp>
+#include <scwx/util/metrics.hpp>
+#include <scwx/wsr88d/nexrad_file_factory.hpp>
+
+#include <atomic>
+#include <cmath>
+#include <filesystem>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/algorithm/string.hpp>
+#include <boost/asio.hpp>
+#include <fmt/format.h>
+#include <QCoreApplication>
+
+static const std::string logPrefix_ = "scwx::rasterize";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+namespace
+{
+
+enum class OutputFormat
+{
+   Png,
+   GeoTiff
+};
+
+struct Options
+{
+   std::vector<std::string> files_ {};
+   std::filesystem::path    outputDirectory_ {"."};
+   OutputFormat             format_ {OutputFormat::Png};
+   std::string              level2Product_ {"REF"};
+   float                    elevation_ {0.5f};
+   double                   resolution_ {0.005};
+   std::size_t              jobs_ {std::max(1u,
+                                   std::thread::hardware_concurrency())};
+
+   std::optional<scwx::qt::util::RasterExtent> extent_ {};
+};
+
+} // namespace
+
+static void PrintUsage(const char* program);
+static std::optional<Options> ParseOptions(int argc, char* argv[]);
+static bool RasterizeFile(const Options& options, const std::string& filename);
+
+int main(int argc, char* argv[])
+{
+   std::optional<Options> options = ParseOptions(argc, argv);
+   if (!options.has_value())
+   {
+      PrintUsage(argv[0]);
+      return 1;
+   }
+
+   // Initialize logger
+   auto& logManager = scwx::qt::manager::LogManager::Instance();
+   logManager.Initialize();
+
+   logger_->info("Supercell Wx Rasterizer v{} ({})",
+                 scwx::qt::main::kVersionString_,
+                 scwx::qt::main::kCommitString_);
+
+   // Palettes and unit settings are read from the user's settings, but no
+   // windowing system is required
+   QCoreApplication a(argc, argv);
+   QCoreApplication::setApplicationName("Supercell Wx");
+
+   scwx::qt::config::RadarSite::Initialize();
+   scwx::qt::manager::SettingsManager::Instance().Initialize();
+
+   std::filesystem::create_directories(options->outputDirectory_);
+
+   // Volumes are rasterized independently, in parallel
+   std::atomic<std::size_t> failures {0};
+   {
+      boost::asio::thread_pool threadPool {options->jobs_};
+
+      for (const std::string& file : options->files_)
+      {
+         boost::asio::post(threadPool,
+                           [&]()
+                           {
+                              try
+                              {
+                                 if (!RasterizeFile(*options, file))
+                                 {
+                                    ++failures;
+                                 }
+                              }
+                              catch (const std::exception& ex)
+                              {
+                                 logger_->error("{}: {}", file, ex.what());
+                                 ++failures;
+                              }
+                           });
+      }
+
+      threadPool.join();
+   }
+
+   for (auto& metric : scwx::util::metrics::Registry::Instance().Snapshot())
+   {
+      if (metric.type_ == scwx::util::metrics::MetricType::Histogram)
+      {
+         logger_->info("{}: count {}, mean {} ms, max {} ms",
+                       metric.name_,
+                       metric.count_,
+                       metric.mean_ / 1'000'000,
+                       metric.max_ / 1'000'000);
+      }
+   }
+
+   logger_->info("Rasterized {} of {} files",
+                 options->files_.size() - failures,
+                 options->files_.size());
+
+   // Shutdown application
+   scwx::qt::manager::RadarProductManager::Cleanup();
+   scwx::qt::manager::SettingsManager::Instance().Shutdown();
+
+   return (failures == 0) ? 0 : 2;
+}
+
+static void PrintUsage(const char* program)
+{
+   std::cerr
+      << "Usage: " << program << " [options] <file>...\n"
+      << "\n"
+      << "Renders NEXRAD Level 2 and Level 3 products to images without a "
+         "GPU.\n"
+      << "\n"
+      << "Options:\n"
+      << "  --output <dir>          Output directory (default: .)\n"
+      << "  --format <png|tif>      Output format (default: png)\n"
+      << "  --product <name>        Level 2 product (default: REF)\n"
+      << "  --elevation <degrees>   Level 2 elevation (default: 0.5)\n"
+      << "  --resolution <degrees>  Pixel size (default: 0.005)\n"
+      << "  --extent <minLat,minLon,maxLat,maxLon>\n"
+      << "                          Image extent (default: product range)\n"
+      << "  --jobs <n>              Files processed in parallel\n";
+}
+
+static std::optional<Options> ParseOptions(int argc, char* argv[])
+{
+   Options options {};
+
+   try
+   {
+      for (int i = 1; i < argc; ++i)
+      {
+         const std::string arg {argv[i]};
+
+         if (arg.starts_with("--"))
+         {
+            if (i + 1 >= argc)
+            {
+               std::cerr << "Missing value for " << arg << "\n";
+               return std::nullopt;
+            }
+
+            const std::string value {argv[++i]};
+
+            if (arg == "--output")
+            {
+               options.outputDirectory_ = value;
+            }
+            else if (arg == "--format" && (value == "png"))
+            {
+               options.format_ = OutputFormat::Png;
+            }
+            else if (arg == "--format" && (value == "tif" || value == "tiff"))
+            {
+               options.format_ = OutputFormat::GeoTiff;
+            }
+            else if (arg == "--product")
+            {
+               options.level2Product_ = value;
+            }
+            else if (arg == "--elevation")
+            {
+               options.elevation_ = std::stof(value);
+            }
+            else if (arg == "--resolution" && std::stod(value) > 0.0)
+            {
+               options.resolution_ = std::stod(value);
+            }
+            else if (arg == "--jobs" && std::stoul(value) > 0)
+            {
+               options.jobs_ = std::stoul(value);
+            }
+            else if (arg == "--extent")
+            {
+               std::vector<std::string> tokens {};
+               boost::split(tokens, value, boost::is_any_of(","));
+               if (tokens.size() != 4)
+               {
+                  std::cerr << "Invalid extent: " << value << "\n";
+                  return std::nullopt;
+               }
+
+               scwx::qt::util::RasterExtent extent {};
+               extent.minLatitude_  = std::stod(tokens[0]);
+               extent.minLongitude_ = std::stod(tokens[1]);
+               extent.maxLatitude_  = std::stod(tokens[2]);
+               extent.maxLongitude_ = std::stod(tokens[3]);
+
+               if (extent.maxLatitude_ <= extent.minLatitude_ ||
+                   extent.maxLongitude_ <= extent.minLongitude_)
+               {
+                  std::cerr << "Invalid extent: " << value << "\n";
+                  return std::nullopt;
+               }
+
+               options.extent_ = extent;
+            }
+            else
+            {
+               std::cerr << "Invalid option: " << arg << " " << value << "\n";
+               return std::nullopt;
+            }
+         }
+         else
+         {
+            options.files_.push_back(arg);
+         }
+      }
+   }
+   catch (const std::exception&)
+   {
+      std::cerr << "Invalid numeric option\n";
+      return std::nullopt;
+   }
+
+   if (options.extent_.has_value())
+   {
+      // Size the image from the resolution
+      auto& extent   = options.extent_.value();
+      extent.width_  = static_cast<std::size_t>(std::ceil(
+         (extent.maxLongitude_ - extent.minLongitude_) / options.resolution_));
+      extent.height_ = static_cast<std::size_t>(std::ceil(
+         (extent.maxLatitude_ - extent.minLatitude_) / options.resolution_));
+   }
+
+   if (options.files_.empty())
+   {
+      return std::nullopt;
+   }
+
+   return options;
+}
+
+static std::shared_ptr<scwx::common::ColorTable>
+LoadColorTable(const std::string& palette)
+{
+   auto& paletteSettings = scwx::qt::settings::PaletteSettings::Instance();
+
+   std::string colorTableFile = paletteSettings.palette(palette).GetValue();
+   if (colorTableFile.empty())
+   {
+      return nullptr;
+   }
+
+   std::unique_ptr<std::istream> colorTableStream =
+      scwx::qt::util::OpenFile(colorTableFile);
+   return scwx::common::ColorTable::Load(*colorTableStream);
+}
+
+static bool RasterizeFile(const Options& options, const std::string& filename)
+{
+   using namespace scwx;
+   using namespace scwx::qt;
+
+   // Parse the file on this thread, so files are parsed in parallel
+   std::shared_ptr<wsr88d::NexradFile> nexradFile =
+      wsr88d::NexradFileFactory::Create(filename);
+   if (nexradFile == nullptr)
+   {
+      logger_->error("Unrecognized NEXRAD product: {}", filename);
+      return false;
+   }
+
+   auto request = std::make_shared<request::NexradFileRequest>();
+   manager::RadarProductManager::LoadNexradFile(nexradFile, request);
+
+   std::shared_ptr<types::RadarProductRecord> record =
+      request->radar_product_record();
+   if (record == nullptr)
+   {
+      logger_->error("Could not load: {}", filename);
+      return false;
+   }
+
+   // Create the view
+   auto radarProductManager =
+      manager::RadarProductManager::Instance(record->radar_id());
+
+   const common::RadarProductGroup group = record->radar_product_group();
+   const std::string               product =
+      (group == common::RadarProductGroup::Level2) ? options.level2Product_ :
+                                                     record->radar_product();
+   const std::int16_t productCode = record->product_code();
+
+   std::shared_ptr<view::RadarProductView> radarProductView =
+      view::RadarProductViewFactory::Create(
+         group, product, productCode, radarProductManager);
+   if (radarProductView == nullptr)
+   {
+      logger_->error("Unsupported product: {} ({})", product, filename);
+      return false;
+   }
+
+   const std::string palette =
+      (group == common::RadarProductGroup::Level2) ?
+         common::GetLevel2Palette(common::GetLevel2Product(product)) :
+         common::GetLevel3Palette(productCode);
+   radarProductView->LoadColorTable(LoadColorTable(palette));
+   radarProductView->SelectTime(record->time());
+   radarProductView->SelectElevation(options.elevation_);
+
+   // Compute the sweep synchronously
+   radarProductView->Initialize();
+
+   // Rasterize
+   std::unique_lock sweepLock {radarProductView->sweep_mutex()};
+
+   const std::shared_ptr<config::RadarSite> radarSite =
+      radarProductManager->radar_site();
+
+   util::RasterExtent extent = options.extent_.value_or(
+      util::RasterExtent::Centered({radarSite->latitude(),
+                                    radarSite->longitude()},
+                                   radarProductView->range() * 1000.0,
+                                   options.resolution_));
+
+   util::SweepBuffers buffers {};
+   buffers.vertices_ = &radarProductView->vertices();
+   std::tie(buffers.dataMoments_,
+            std::ignore,
+            buffers.dataMomentsComponentSize_) =
+      radarProductView->GetMomentData();
+   std::tie(
+      buffers.cfpMoments_, std::ignore, buffers.cfpMomentsComponentSize_) =
+      radarProductView->GetCfpMomentData();
+
+   util::RasterColorTable colorTable {&radarProductView->color_table_lut(),
+                                      radarProductView->color_table_min(),
+                                      radarProductView->color_table_max()};
+
+   util::SweepRasterizer rasterizer {extent};
+
+   // Polar sweeps are sampled per pixel, otherwise triangles are drawn
+   std::shared_ptr<const util::PolarSweep> polarSweep =
+      radarProductView->polar_sweep();
+
+   scwx::util::metrics::ScopedTimer timer {
+      scwx::util::metrics::Registry::Instance().GetHistogram(
+         scwx::util::metrics::MetricName("rasterize", product))};
+   std::size_t elements =
+      (polarSweep != nullptr) ?
+         rasterizer.DrawPolar(*polarSweep,
+                              util::PolarSiteFrame::Create(
+                                 radarSite->latitude(), radarSite->longitude()),
+                              colorTable,
+                              polarSweep->componentCount_ > 1) :
+         rasterizer.Draw(buffers, colorTable, buffers.cfpMoments_ != nullptr);
+   timer.Stop();
+
+   sweepLock.unlock();
+
+   // Write the image
+   const std::string extension =
+      (options.format_ == OutputFormat::GeoTiff) ? "tif" : "png";
+   const std::filesystem::path outputFile =
+      options.outputDirectory_ /
+      fmt::format("{}_{}.{}",
+                  std::filesystem::path(filename).stem().string(),
+                  product,
+                  extension);
+
+   bool success = (options.format_ == OutputFormat::GeoTiff) ?
+                     rasterizer.WriteGeoTiff(outputFile.string()) :
+                     rasterizer.WritePng(outputFile.string());
+
+   if (success)
+   {
+      logger_->info("{}: {} {}, {}x{} pixels",
+                    outputFile.string(),
+                    elements,
+                    (polarSweep != nullptr) ? "samples" : "triangles",
+                    extent.width_,
+                    extent.height_);
+   }
+
+   return success;
+}
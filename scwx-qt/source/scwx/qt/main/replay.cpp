@@ -0,0 +1,435 @@
+#include <scwx/qt/config/radar_site.hpp>
+#include <scwx/qt/main/application.hpp>
+#include <scwx/qt/main/versions.hpp>
+#include <scwx/qt/manager/log_manager.hpp>
+#include <scwx/qt/manager/radar_product_manager.hpp>
+#include <scwx/qt/manager/settings_manager.hpp>
+#include <scwx/qt/manager/text_event_manager.hpp>
+#include <scwx/qt/manager/timeline_manager.hpp>
+#include <scwx/qt/request/nexrad_file_request.hpp>
+#include <scwx/network/replay_transport.hpp>
+#include <scwx/util/clock.hpp>
+#include <scwx/util/logger.hpp>
+#include <scwx/util/metrics.hpp>
+#include <scwx/util/time.hpp>
+
+#include <atomic>
+#include <filesystem>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <boost/algorithm/string.hpp>
+#include <boost/uuid/random_generator.hpp>
+#include <fmt/format.h>
+#include <QCoreApplication>
+#include <QTimer>
+
+#if defined(_WIN32)
+#   include <Windows.h>
+#   include <psapi.h>
+#else
+#   include <sys/resource.h>
+#endif
+
+static const std::string logPrefix_ = "scwx::replay";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+namespace
+{
+
+struct Options
+{
+   std::filesystem::path                 recording_ {};
+   std::string                           radarSite_ {};
+   std::chrono::system_clock::time_point startTime_ {};
+   std::chrono::minutes                  duration_ {60};
+   double                                speed_ {10.0};
+   std::vector<std::string>              level3Products_ {};
+};
+
+struct Statistics
+{
+   std::atomic<std::size_t> requested_ {0u};
+   std::atomic<std::size_t> loaded_ {0u};
+   std::atomic<std::size_t> failed_ {0u};
+   std::atomic<std::size_t> textEvents_ {0u};
+};
+
+} // namespace
+
+static void PrintUsage(const char* program);
+static std::optional<Options> ParseOptions(int argc, char* argv[]);
+static std::size_t            GetPeakMemoryUsage();
+static void PrintReport(const Options&                      options,
+                        const Statistics&                   statistics,
+                        std::chrono::steady_clock::duration elapsed);
+
+int main(int argc, char* argv[])
+{
+   using namespace scwx;
+   using namespace scwx::qt;
+
+   std::optional<Options> options = ParseOptions(argc, argv);
+   if (!options.has_value())
+   {
+      PrintUsage(argv[0]);
+      return 1;
+   }
+
+   // Initialize logger
+   auto& logManager = manager::LogManager::Instance();
+   logManager.Initialize();
+
+   logger_->info("Supercell Wx Replay v{} ({})",
+                 main::kVersionString_,
+                 main::kCommitString_);
+
+   QCoreApplication a(argc, argv);
+   QCoreApplication::setApplicationName("Supercell Wx");
+
+   config::RadarSite::Initialize();
+   manager::SettingsManager::Instance().Initialize();
+
+   // Replace the network with the recording, and start the replay clock
+   network::SetTransport(
+      std::make_shared<network::ReplayTransport>(options->recording_));
+
+   auto replayClock = std::make_shared<util::clock::ReplayClock>(
+      options->startTime_, options->speed_);
+   util::clock::SetReplayClock(replayClock);
+
+   main::Application::FinishInitialization();
+
+   Statistics statistics {};
+
+   util::metrics::Registry::Instance().Reset();
+
+   auto radarProductManager =
+      manager::RadarProductManager::Instance(options->radarSite_);
+   auto textEventManager = manager::TextEventManager::Instance();
+   auto timelineManager  = manager::TimelineManager::Instance();
+
+   radarProductManager->Initialize();
+
+   timelineManager->SetRadarSite(options->radarSite_);
+   timelineManager->SetViewType(types::MapTime::Archive);
+
+   // Load each product as it becomes available, as the map would
+   QObject::connect(
+      radarProductManager.get(),
+      &manager::RadarProductManager::NewDataAvailable,
+      &a,
+      [&](common::RadarProductGroup             group,
+          const std::string&                    product,
+          std::chrono::system_clock::time_point latestTime)
+      {
+         const std::string label =
+            (group == common::RadarProductGroup::Level2) ?
+               "L2" :
+               fmt::format("L3 {}", product);
+
+         util::metrics::Histogram* loadHistogram =
+            &util::metrics::Registry::Instance().GetHistogram(
+               util::metrics::MetricName("replay_load", label));
+         auto request =
+            std::make_shared<request::NexradFileRequest>(options->radarSite_);
+         auto requestTime = std::chrono::steady_clock::now();
+
+         QObject::connect(
+            request.get(),
+            &request::NexradFileRequest::RequestComplete,
+            &a,
+            [&statistics,
+             &timelineManager,
+             loadHistogram,
+             requestTime,
+             latestTime](std::shared_ptr<request::NexradFileRequest> request)
+            {
+               loadHistogram->Record(std::chrono::steady_clock::now() -
+                                     requestTime);
+
+               if (request->radar_product_record() != nullptr)
+               {
+                  ++statistics.loaded_;
+                  timelineManager->SetDateTime(latestTime);
+               }
+               else
+               {
+                  ++statistics.failed_;
+               }
+            });
+
+         ++statistics.requested_;
+
+         if (group == common::RadarProductGroup::Level2)
+         {
+            radarProductManager->LoadLevel2Data(latestTime, request);
+         }
+         else
+         {
+            radarProductManager->LoadLevel3Data(product, latestTime, request);
+         }
+      });
+
+   QObject::connect(textEventManager.get(),
+                    &manager::TextEventManager::AlertUpdated,
+                    &a,
+                    [&]() { ++statistics.textEvents_; });
+
+   // Each product refresh is enabled under a unique identifier
+   boost::uuids::random_generator uuidGenerator {};
+   std::vector<std::pair<std::string, boost::uuids::uuid>> refreshes {};
+
+   refreshes.emplace_back(std::string {}, uuidGenerator());
+   for (const std::string& product : options->level3Products_)
+   {
+      refreshes.emplace_back(product, uuidGenerator());
+   }
+
+   for (auto& [product, uuid] : refreshes)
+   {
+      radarProductManager->EnableRefresh(
+         product.empty() ? common::RadarProductGroup::Level2 :
+                           common::RadarProductGroup::Level3,
+         product,
+         true,
+         uuid);
+   }
+
+   // Stop when the replay clock reaches the end of the replay
+   const auto endTime   = options->startTime_ + options->duration_;
+   const auto startTime = std::chrono::steady_clock::now();
+
+   QTimer stopTimer {};
+   QObject::connect(&stopTimer,
+                    &QTimer::timeout,
+                    &a,
+                    [&]()
+                    {
+                       if (replayClock->now() >= endTime)
+                       {
+                          QCoreApplication::quit();
+                       }
+                    });
+   stopTimer.start(100);
+
+   a.exec();
+
+   const auto elapsed = std::chrono::steady_clock::now() - startTime;
+
+   for (auto& [product, uuid] : refreshes)
+   {
+      radarProductManager->EnableRefresh(
+         product.empty() ? common::RadarProductGroup::Level2 :
+                           common::RadarProductGroup::Level3,
+         product,
+         false,
+         uuid);
+   }
+
+   PrintReport(*options, statistics, elapsed);
+
+   // Shutdown application
+   timelineManager.reset();
+   textEventManager.reset();
+   radarProductManager.reset();
+   manager::RadarProductManager::Cleanup();
+   manager::SettingsManager::Instance().Shutdown();
+
+   util::clock::SetReplayClock(nullptr);
+   network::SetTransport(nullptr);
+
+   return (statistics.failed_ == 0) ? 0 : 2;
+}
+
+static void PrintUsage(const char* program)
+{
+   std::cerr
+      << "Usage: " << program << " [options] <recording>\n"
+      << "\n"
+      << "Replays a recorded event through the data pipeline without network "
+         "access,\nand reports ingest throughput, latency and memory usage.\n"
+      << "\n"
+      << "The recording directory contains S3 objects as s3/<bucket>/<key>, "
+         "and HTTP\nresources as http/<host>/<path>. Files are revealed at "
+         "their modification time.\n"
+      << "\n"
+      << "Options:\n"
+      << "  --site <id>             Radar site (required)\n"
+      << "  --start <time>          Replay start time, as \"YYYY-MM-DD "
+         "HH:MM:SS\" UTC\n"
+      << "                          (required)\n"
+      << "  --duration <minutes>    Replay duration (default: 60)\n"
+      << "  --speed <multiple>      Multiple of real time (default: 10)\n"
+      << "  --level3 <products>     Comma-separated Level 3 products\n";
+}
+
+static std::optional<Options> ParseOptions(int argc, char* argv[])
+{
+   Options options {};
+
+   try
+   {
+      for (int i = 1; i < argc; ++i)
+      {
+         const std::string arg {argv[i]};
+
+         if (arg.starts_with("--"))
+         {
+            if (i + 1 >= argc)
+            {
+               std::cerr << "Missing value for " << arg << "\n";
+               return std::nullopt;
+            }
+
+            const std::string value {argv[++i]};
+
+            if (arg == "--site")
+            {
+               options.radarSite_ = boost::to_upper_copy(value);
+            }
+            else if (arg == "--start")
+            {
+               auto startTime =
+                  scwx::util::TryParseDateTime<std::chrono::seconds>(
+                     "%Y-%m-%d %H:%M:%S", value);
+               if (!startTime.has_value())
+               {
+                  std::cerr << "Invalid start time: " << value << "\n";
+                  return std::nullopt;
+               }
+               options.startTime_ = startTime.value();
+            }
+            else if (arg == "--duration" && std::stol(value) > 0)
+            {
+               options.duration_ = std::chrono::minutes {std::stol(value)};
+            }
+            else if (arg == "--speed" && std::stod(value) > 0.0)
+            {
+               options.speed_ = std::stod(value);
+            }
+            else if (arg == "--level3")
+            {
+               boost::split(
+                  options.level3Products_, value, boost::is_any_of(","));
+               std::erase(options.level3Products_, std::string {});
+            }
+            else
+            {
+               std::cerr << "Invalid option: " << arg << " " << value << "\n";
+               return std::nullopt;
+            }
+         }
+         else
+         {
+            options.recording_ = arg;
+         }
+      }
+   }
+   catch (const std::exception&)
+   {
+      std::cerr << "Invalid numeric option\n";
+      return std::nullopt;
+   }
+
+   if (options.recording_.empty() || options.radarSite_.empty() ||
+       options.startTime_ == std::chrono::system_clock::time_point {})
+   {
+      return std::nullopt;
+   }
+
+   return options;
+}
+
+static std::size_t GetPeakMemoryUsage()
+{
+#if defined(_WIN32)
+   PROCESS_MEMORY_COUNTERS counters {};
+   if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+   {
+      return counters.PeakWorkingSetSize;
+   }
+   return 0u;
+#else
+   struct rusage usage
+   {
+   };
+   getrusage(RUSAGE_SELF, &usage);
+#   if defined(__APPLE__)
+   return static_cast<std::size_t>(usage.ru_maxrss);
+#   else
+   return static_cast<std::size_t>(usage.ru_maxrss) * 1024u;
+#   endif
+#endif
+}
+
+static void PrintReport(const Options&                      options,
+                        const Statistics&                   statistics,
+                        std::chrono::steady_clock::duration elapsed)
+{
+   using namespace scwx::util;
+
+   const double elapsedSeconds =
+      std::chrono::duration<double>(elapsed).count();
+
+   std::uint64_t downloadBytes = 0u;
+   for (auto& metric : metrics::Registry::Instance().Snapshot())
+   {
+      if (metric.name_.starts_with("download_bytes"))
+      {
+         downloadBytes += static_cast<std::uint64_t>(metric.value_);
+      }
+   }
+
+   const double seconds    = std::max(elapsedSeconds, 1e-9);
+   const double megabytes  = static_cast<double>(downloadBytes) / 1048576.0;
+   const double peakMemory = static_cast<double>(GetPeakMemoryUsage()) /
+                             1048576.0;
+
+   std::cout << fmt::format("Replayed {} from {} for {} min at {}x in "
+                            "{:.1f} s\n\n",
+                            options.radarSite_,
+                            TimeString(options.startTime_),
+                            options.duration_.count(),
+                            options.speed_,
+                            elapsedSeconds);
+
+   auto PrintValue = [](const std::string& name, auto value)
+   { std::cout << fmt::format("{:<24} {:>12}\n", name, value); };
+
+   PrintValue("Products requested", statistics.requested_.load());
+   PrintValue("Products loaded", statistics.loaded_.load());
+   PrintValue("Products failed", statistics.failed_.load());
+   PrintValue("Text events", statistics.textEvents_.load());
+   PrintValue("Products/s",
+              fmt::format("{:.2f}",
+                          static_cast<double>(statistics.loaded_.load()) /
+                             seconds));
+   PrintValue("MiB/s", fmt::format("{:.2f}", megabytes / seconds));
+   PrintValue("Peak memory (MiB)", fmt::format("{:.1f}", peakMemory));
+
+   std::cout << fmt::format("\n{:<32} {:>8} {:>10} {:>10} {:>10} {:>10}\n",
+                            "Stage (ms)",
+                            "Count",
+                            "p50",
+                            "p90",
+                            "p99",
+                            "Max");
+
+   for (auto& metric : metrics::Registry::Instance().Snapshot())
+   {
+      if (metric.type_ == metrics::MetricType::Histogram && metric.count_ > 0)
+      {
+         std::cout << fmt::format(
+            "{:<32} {:>8} {:>10.1f} {:>10.1f} {:>10.1f} {:>10.1f}\n",
+            metric.name_,
+            metric.count_,
+            static_cast<double>(metric.p50_) / 1e6,
+            static_cast<double>(metric.p90_) / 1e6,
+            static_cast<double>(metric.p99_) / 1e6,
+            static_cast<double>(metric.max_) / 1e6);
+      }
+   }
+}
@@ -0,0 +1,188 @@
+#include <scwx/util/logger.hpp>
+#include <scwx/wsr88d/ar2v_file.hpp>
+#include <scwx/wsr88d/volume_products.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+static const std::string logPrefix_ = "scwx::volume_products_benchmark";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+namespace
+{
+
+struct Options
+{
+   std::vector<std::string> paths_ {};
+   std::size_t              iterations_ {20u};
+};
+
+} // namespace
+
+static const std::vector<scwx::common::Level2Product> kProducts_ {
+   scwx::common::Level2Product::CompositeReflectivity,
+   scwx::common::Level2Product::EchoTops,
+   scwx::common::Level2Product::VerticallyIntegratedLiquid};
+
+static void Benchmark(const std::filesystem::path& path,
+                      std::size_t                  iterations);
+static void AddFiles(const std::filesystem::path&        path,
+                     std::vector<std::filesystem::path>& files);
+
+int main(int argc, char* argv[])
+{
+   Options options {};
+
+   for (int i = 1; i < argc; ++i)
+   {
+      const std::string arg {argv[i]};
+
+      if ((arg == "-n" || arg == "--iterations") && i + 1 < argc)
+      {
+         options.iterations_ =
+            static_cast<std::size_t>(std::max(1, std::atoi(argv[++i])));
+      }
+      else if (arg == "-h" || arg == "--help")
+      {
+         std::cout << fmt::format(
+            "Usage: {} [-n iterations] <file|directory>...\n\n"
+            "Measures resampling Level 2 reflectivity volumes onto a common "
+            "grid, and\ncomputing composite reflectivity, echo tops and "
+            "vertically integrated liquid.\n",
+            argv[0]);
+         return 0;
+      }
+      else
+      {
+         options.paths_.push_back(arg);
+      }
+   }
+
+   if (options.paths_.empty())
+   {
+      logger_->error("No Level 2 files specified");
+      return 1;
+   }
+
+   std::vector<std::filesystem::path> files {};
+   for (const std::string& path : options.paths_)
+   {
+      AddFiles(path, files);
+   }
+
+   std::cout << fmt::format("{} files, {} iterations\n\n",
+                            files.size(),
+                            options.iterations_);
+   std::cout << fmt::format("{:<40} {:>6} {:>12} {:>8} {:>12} {:>12}\n",
+                            "",
+                            "Cuts",
+                            "Create (us)",
+                            "Product",
+                            "Compute (us)",
+                            "Mgates/s");
+
+   for (const std::filesystem::path& file : files)
+   {
+      Benchmark(file, options.iterations_);
+   }
+
+   return 0;
+}
+
+static void Benchmark(const std::filesystem::path& path,
+                      std::size_t                  iterations)
+{
+   auto file = std::make_shared<scwx::wsr88d::Ar2vFile>();
+   if (!file->LoadFile(path.string()))
+   {
+      logger_->warn("Unable to load: {}", path.string());
+      return;
+   }
+
+   std::shared_ptr<scwx::wsr88d::VolumeProducts> volume {};
+   std::chrono::nanoseconds                      createTime {};
+
+   for (std::size_t i = 0; i < iterations; ++i)
+   {
+      const auto start = std::chrono::steady_clock::now();
+      volume           = scwx::wsr88d::VolumeProducts::Create(file);
+      createTime += std::chrono::steady_clock::now() - start;
+   }
+
+   if (volume == nullptr)
+   {
+      logger_->warn("No reflectivity data: {}", path.string());
+      return;
+   }
+
+   createTime /= iterations;
+
+   const auto&       grid = volume->grid();
+   const std::size_t gates =
+      volume->cuts().size() * grid.radials_ * grid.gates_;
+
+   for (scwx::common::Level2Product product : kProducts_)
+   {
+      std::chrono::nanoseconds computeTime {};
+
+      for (std::size_t i = 0; i < iterations; ++i)
+      {
+         const auto start = std::chrono::steady_clock::now();
+         auto       data  = volume->Compute(product);
+         computeTime += std::chrono::steady_clock::now() - start;
+      }
+
+      computeTime /= iterations;
+
+      // Input gates processed per second
+      const double throughput =
+         static_cast<double>(gates) /
+         std::max<double>(
+            1.0,
+            std::chrono::duration<double, std::micro>(computeTime).count());
+
+      std::cout << fmt::format(
+         "{:<40} {:>6} {:>12} {:>8} {:>12} {:>12.1f}\n",
+         path.filename().string(),
+         volume->cuts().size(),
+         std::chrono::duration_cast<std::chrono::microseconds>(createTime)
+            .count(),
+         scwx::common::GetLevel2Name(product),
+         std::chrono::duration_cast<std::chrono::microseconds>(computeTime)
+            .count(),
+         throughput);
+   }
+}
+
+static void AddFiles(const std::filesystem::path&        path,
+                     std::vector<std::filesystem::path>& files)
+{
+   std::error_code error;
+
+   if (std::filesystem::is_directory(path, error))
+   {
+      const std::size_t first = files.size();
+
+      for (auto& entry : std::filesystem::directory_iterator(path, error))
+      {
+         if (entry.is_regular_file())
+         {
+            files.push_back(entry.path());
+         }
+      }
+
+      std::sort(files.begin() + static_cast<std::ptrdiff_t>(first),
+                files.end());
+   }
+   else
+   {
+      files.push_back(path);
+   }
+}
@@ -4,11 +4,16 @@
 #include <scwx/qt/manager/text_event_manager.hpp>
 #include <scwx/qt/settings/audio_settings.hpp>
 #include <scwx/qt/types/location_types.hpp>
-#include <scwx/qt/util/geographic_lib.hpp>
+#include <scwx/qt/types/text_event_key.hpp>
+#include <scwx/qt/util/area_index.hpp>
+#include <scwx/util/clock.hpp>
 #include <scwx/util/logger.hpp>
 #include <scwx/qt/config/radar_site.hpp>
 #include <scwx/qt/settings/general_settings.hpp>
 
+#include <optional>
+#include <unordered_set>
+
 #include <boost/asio/post.hpp>
 #include <boost/asio/thread_pool.hpp>
 #include <boost/uuid/random_generator.hpp>
@@ -62,7 +67,12 @@ public:
 
    common::Coordinate
         CurrentCoordinate(types::LocationMethod locationMethod) const;
-   void HandleAlert(const types::TextEventKey& key, size_t messageIndex) const;
+   void HandleAlert(const types::TextEventKey& key, size_t messageIndex);
+   void InsertAlertArea(const std::shared_ptr<const util::PreparedArea>& area);
+   void PruneAlertAreas();
+   void RemoveAlertArea(const std::shared_ptr<const util::PreparedArea>& area);
+   void UpdateCandidateAreas(const common::Coordinate&     coordinate,
+                             units::length::meters<double> radius);
    void UpdateLocationTracking(const std::string& value) const;
 
    boost::asio::thread_pool threadPool_ {1u};
@@ -78,6 +88,27 @@ public:
       TextEventManager::Instance()};
 
    std::shared_ptr<config::RadarSite> radarSite_ {};
+
+   struct AlertArea
+   {
+      std::shared_ptr<const util::PreparedArea> area_;
+      std::chrono::system_clock::time_point     eventEnd_;
+   };
+
+   // Prepared areas of active alert segments, only accessed from the thread
+   // pool
+   std::unordered_map<types::TextEventKey,
+                      std::vector<AlertArea>,
+                      types::TextEventHash<types::TextEventKey>>
+                   alertAreas_ {};
+   util::AreaIndex areaIndex_ {};
+
+   // Areas whose bounds are in range of the alert location, updated by
+   // querying the area index when the location or radius changes
+   std::optional<std::pair<common::Coordinate, units::length::meters<double>>>
+      candidateLocation_ {};
+   util::PreparedArea::Bounds                    candidateBounds_ {};
+   std::unordered_set<const util::PreparedArea*> candidateAreas_ {};
 };
 
 AlertManager::AlertManager() : p(std::make_unique<Impl>(this)) {}
@@ -136,7 +167,7 @@ common::Coordinate AlertManager::Impl::CurrentCoordinate(
 }
 
 void AlertManager::Impl::HandleAlert(const types::TextEventKey& key,
-                                     size_t messageIndex) const
+                                     size_t                     messageIndex)
 {
    // Skip alert if there are more messages to be processed
    if (messageIndex + 1 < textEventManager_->message_count(key))
@@ -155,6 +186,24 @@ void AlertManager::Impl::HandleAlert(const types::TextEventKey& key,
 
    auto message = textEventManager_->message_list(key).at(messageIndex);
 
+   // Replace the prepared areas of the alert with the areas of the newest
+   // message, and remove areas of any alerts which have ended
+   PruneAlertAreas();
+
+   auto alertAreasIt = alertAreas_.find(key);
+   if (alertAreasIt != alertAreas_.cend())
+   {
+      for (auto& alertArea : alertAreasIt->second)
+      {
+         RemoveAlertArea(alertArea.area_);
+      }
+      alertAreas_.erase(alertAreasIt);
+   }
+
+   std::vector<std::pair<std::shared_ptr<const awips::Segment>,
+                         std::shared_ptr<const util::PreparedArea>>>
+      activeSegments {};
+
    for (auto& segment : message->segments())
    {
       if (!segment->codedLocation_.has_value())
@@ -162,16 +211,31 @@ void AlertManager::Impl::HandleAlert(const types::TextEventKey& key,
          continue;
       }
 
+      auto& vtec     = segment->header_->vtecString_.front();
+      auto  action   = vtec.pVtec_.action();
+      auto  eventEnd = vtec.pVtec_.event_end();
+
+      if (eventEnd < scwx::util::clock::Now() ||
+          action == awips::PVtec::Action::Canceled)
+      {
+         continue;
+      }
+
+      auto area = std::make_shared<const util::PreparedArea>(
+         segment->codedLocation_->coordinates());
+
+      alertAreas_[key].push_back({area, eventEnd});
+      InsertAlertArea(area);
+      activeSegments.emplace_back(segment, area);
+   }
+
+   for (auto& [segment, area] : activeSegments)
+   {
       auto&             vtec       = segment->header_->vtecString_.front();
-      auto              action     = vtec.pVtec_.action();
       awips::Phenomenon phenomenon = vtec.pVtec_.phenomenon();
-      auto              eventEnd   = vtec.pVtec_.event_end();
-      bool alertActive             = (action != awips::PVtec::Action::Canceled);
 
-      // If the event has ended or is inactive, or if the alert is not enabled,
-      // skip it
-      if (eventEnd < std::chrono::system_clock::now() || !alertActive ||
-          !audioSettings.alert_enabled(phenomenon).GetValue())
+      // If the alert is not enabled, skip it
+      if (!audioSettings.alert_enabled(phenomenon).GetValue())
       {
          continue;
       }
@@ -182,11 +246,14 @@ void AlertManager::Impl::HandleAlert(const types::TextEventKey& key,
           locationMethod == types::LocationMethod::Track ||
           locationMethod == types::LocationMethod::RadarSite)
       {
-         // Determine if the alert is active at the current coordinte
-         auto alertCoordinates = segment->codedLocation_->coordinates();
-
-         activeAtLocation = util::GeographicLib::AreaInRangeOfPoint(
-            alertCoordinates, currentCoordinate, alertRadius);
+         // Determine if the alert is active at the current coordinate. Areas
+         // whose bounds are out of range are rejected using the candidate
+         // areas, which are only queried when the location changes.
+         UpdateCandidateAreas(currentCoordinate, alertRadius);
+
+         activeAtLocation =
+            candidateAreas_.contains(area.get()) &&
+            area->InRangeOfPoint(currentCoordinate, alertRadius);
       }
       else if (locationMethod == types::LocationMethod::County)
       {
@@ -215,6 +282,74 @@ void AlertManager::Impl::HandleAlert(const types::TextEventKey& key,
    }
 }
 
+void AlertManager::Impl::PruneAlertAreas()
+{
+   const auto now = scwx::util::clock::Now();
+
+   for (auto it = alertAreas_.begin(); it != alertAreas_.end();)
+   {
+      std::erase_if(it->second,
+                    [&](const AlertArea& alertArea)
+                    {
+                       if (alertArea.eventEnd_ < now)
+                       {
+                          RemoveAlertArea(alertArea.area_);
+                          return true;
+                       }
+                       return false;
+                    });
+
+      if (it->second.empty())
+      {
+         it = alertAreas_.erase(it);
+      }
+      else
+      {
+         ++it;
+      }
+   }
+}
+
+void AlertManager::Impl::InsertAlertArea(
+   const std::shared_ptr<const util::PreparedArea>& area)
+{
+   areaIndex_.Insert(area);
+
+   if (candidateLocation_.has_value() &&
+       area->bounds().Intersects(candidateBounds_))
+   {
+      candidateAreas_.insert(area.get());
+   }
+}
+
+void AlertManager::Impl::RemoveAlertArea(
+   const std::shared_ptr<const util::PreparedArea>& area)
+{
+   areaIndex_.Remove(area);
+   candidateAreas_.erase(area.get());
+}
+
+void AlertManager::Impl::UpdateCandidateAreas(
+   const common::Coordinate& coordinate, units::length::meters<double> radius)
+{
+   if (candidateLocation_.has_value() &&
+       candidateLocation_->first == coordinate &&
+       candidateLocation_->second == radius)
+   {
+      // Candidate areas are current
+      return;
+   }
+
+   candidateLocation_.emplace(coordinate, radius);
+   candidateBounds_ = util::PreparedArea::GetQueryBounds(coordinate, radius);
+   candidateAreas_.clear();
+
+   for (auto& area : areaIndex_.Query(coordinate, radius))
+   {
+      candidateAreas_.insert(area.get());
+   }
+}
+
 void AlertManager::Impl::UpdateLocationTracking(
    const std::string& locationMethodName) const
 {
@@ -6,6 +6,8 @@
 #include <scwx/qt/util/network.hpp>
 #include <scwx/gr/placefile.hpp>
 #include <scwx/network/cpr.hpp>
+#include <scwx/network/transport.hpp>
+#include <scwx/util/clock.hpp>
 #include <scwx/util/logger.hpp>
 
 #include <shared_mutex>
@@ -165,8 +167,10 @@ PlacefileManager::PlacefileManager() : p(std::make_unique<Impl>(this))
                         {
                            p->InitializePlacefileSettings();
 
-                           // Read placefile settings on startup
-                           main::Application::WaitForInitialization();
+                           // Read placefile settings after the main window has
+                           // been presented, such that placefile fetches do not
+                           // delay startup
+                           main::Application::WaitForFirstPaint();
                            p->ReadPlacefileSettings();
                            Q_EMIT PlacefilesInitialized();
                         }
@@ -603,21 +607,17 @@ void PlacefileManager::Impl::PlacefileRecord::Update()
       }
 
       // Send HTTP GET request
-      auto response =
-         cpr::Get(cpr::Url {decodedUrl}, network::cpr::GetHeader(), parameters);
+      auto response = network::GetTransport()->Get(
+         decodedUrl, network::cpr::GetHeader(), parameters);
 
-      if (cpr::status::is_success(response.status_code))
+      if (cpr::status::is_success(response.statusCode_))
       {
-         std::istringstream responseBody {response.text};
+         std::istringstream responseBody {response.text_};
          updatedPlacefile = gr::Placefile::Load(name, responseBody);
       }
-      else if (response.status_code == 0)
-      {
-         logger_->error("Error loading placefile: {}", response.error.message);
-      }
       else
       {
-         logger_->error("Error loading placefile: {}", response.status_line);
+         logger_->error("Error loading placefile: {}", response.error_);
       }
    }
 
@@ -633,7 +633,7 @@ void PlacefileManager::Impl::PlacefileRecord::Update()
          // Update the placefile
          placefile_      = updatedPlacefile;
          title_          = placefile_->title();
-         lastUpdateTime_ = std::chrono::system_clock::now();
+         lastUpdateTime_ = scwx::util::clock::Now();
          failureCount_   = 0;
 
          // Update font resources
@@ -694,7 +694,7 @@ void PlacefileManager::Impl::PlacefileRecord::ScheduleRefresh()
    std::unique_lock lock {timerMutex_};
 
    auto nextUpdateTime      = lastUpdateTime_ + refresh_time();
-   auto timeUntilNextUpdate = nextUpdateTime - std::chrono::system_clock::now();
+   auto timeUntilNextUpdate = nextUpdateTime - scwx::util::clock::Now();
 
    ScheduleRefresh(timeUntilNextUpdate);
 }
@@ -707,7 +707,9 @@ void PlacefileManager::Impl::PlacefileRecord::ScheduleRefresh(
       std::chrono::duration_cast<std::chrono::seconds>(timeUntilNextUpdate),
       name_);
 
-   refreshTimer_.expires_after(timeUntilNextUpdate);
+   refreshTimer_.expires_after(scwx::util::clock::RealInterval(
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+         timeUntilNextUpdate)));
    refreshTimer_.async_wait(
       [this](const boost::system::error_code& e)
       {
@@ -3,10 +3,12 @@
 #include <scwx/qt/settings/general_settings.hpp>
 #include <scwx/qt/types/time_types.hpp>
 #include <scwx/qt/util/geographic_lib.hpp>
+#include <scwx/qt/util/time_index.hpp>
 #include <scwx/common/constants.hpp>
 #include <scwx/provider/nexrad_data_provider_factory.hpp>
+#include <scwx/util/clock.hpp>
 #include <scwx/util/logger.hpp>
-#include <scwx/util/map.hpp>
+#include <scwx/util/metrics.hpp>
 #include <scwx/util/threads.hpp>
 #include <scwx/wsr88d/nexrad_file_factory.hpp>
 
@@ -46,9 +48,7 @@ static const auto logger_ = scwx::util::Logger::Create(logPrefix_);
 
 typedef std::function<std::shared_ptr<wsr88d::NexradFile>()>
    CreateNexradFileFunction;
-typedef std::map<std::chrono::system_clock::time_point,
-                 std::weak_ptr<types::RadarProductRecord>>
-   RadarProductRecordMap;
+typedef util::TimeIndex<types::RadarProductRecord> RadarProductTimeIndex;
 typedef std::list<std::shared_ptr<types::RadarProductRecord>>
    RadarProductRecordList;
 
@@ -218,8 +218,7 @@ public:
    void
         LoadProviderData(std::chrono::system_clock::time_point time,
                          std::shared_ptr<ProviderManager>      providerManager,
-                         RadarProductRecordMap&                recordMap,
-                         std::shared_mutex&                    recordMutex,
+                         RadarProductTimeIndex&                recordIndex,
                          std::mutex&                           loadDataMutex,
                          const std::shared_ptr<request::NexradFileRequest>& request);
    void PopulateLevel2ProductTimes(std::chrono::system_clock::time_point time);
@@ -228,10 +227,11 @@ public:
 
    void UpdateAvailableProductsSync();
 
+   RadarProductTimeIndex& GetLevel3ProductIndex(const std::string& product);
+
    static void
-   PopulateProductTimes(std::shared_ptr<ProviderManager> providerManager,
-                        RadarProductRecordMap&           productRecordMap,
-                        std::shared_mutex&               productRecordMutex,
+   PopulateProductTimes(std::shared_ptr<ProviderManager>      providerManager,
+                        RadarProductTimeIndex&                productIndex,
                         std::chrono::system_clock::time_point time);
 
    static void
@@ -250,9 +250,9 @@ public:
    std::vector<float> coordinates0_5Degree_;
    std::vector<float> coordinates1Degree_;
 
-   RadarProductRecordMap  level2ProductRecords_;
+   RadarProductTimeIndex  level2ProductRecords_;
    RadarProductRecordList level2ProductRecentRecords_;
-   std::unordered_map<std::string, RadarProductRecordMap>
+   std::unordered_map<std::string, RadarProductTimeIndex>
       level3ProductRecordsMap_;
    std::unordered_map<std::string, RadarProductRecordList>
                      level3ProductRecentRecordsMap_;
@@ -343,17 +343,12 @@ void RadarProductManager::DumpRecords()
                logger_->info(" {}", radarProductManager->radar_site()->id());
                logger_->info("  Level 2");
 
+               for (auto& record :
+                    *radarProductManager->p->level2ProductRecords_.snapshot())
                {
-                  std::shared_lock level2ProductLock {
-                     radarProductManager->p->level2ProductRecordMutex_};
-
-                  for (auto& record :
-                       radarProductManager->p->level2ProductRecords_)
-                  {
-                     logger_->info("   {}{}",
-                                   scwx::util::TimeString(record.first),
-                                   record.second.expired() ? " (expired)" : "");
-                  }
+                  logger_->info("   {}{}",
+                                scwx::util::TimeString(record.time_),
+                                record.record_->expired() ? " (expired)" : "");
                }
 
                logger_->info("  Level 3");
@@ -368,12 +363,12 @@ void RadarProductManager::DumpRecords()
                      // Product Name
                      logger_->info("   {}", recordMap.first);
 
-                     for (auto& record : recordMap.second)
+                     for (auto& record : *recordMap.second.snapshot())
                      {
                         logger_->info("    {}{}",
-                                      scwx::util::TimeString(record.first),
-                                      record.second.expired() ? " (expired)" :
-                                                                "");
+                                      scwx::util::TimeString(record.time_),
+                                      record.record_->expired() ? " (expired)" :
+                                                                 "");
                      }
                   }
                }
@@ -496,6 +491,10 @@ void RadarProductManager::Initialize()
    timer.stop();
    logger_->debug("Coordinates (0.5 degree) calculated in {}",
                   timer.format(6, "%ws"));
+   scwx::util::metrics::Registry::Instance()
+      .GetHistogram(scwx::util::metrics::MetricName(
+         "radar_coordinates", "0.5 degree"))
+      .Record(static_cast<std::uint64_t>(timer.elapsed().wall));
 
    // Calculate 1 degree azimuth coordinates
    timer.start();
@@ -533,6 +532,10 @@ void RadarProductManager::Initialize()
    timer.stop();
    logger_->debug("Coordinates (1 degree) calculated in {}",
                   timer.format(6, "%ws"));
+   scwx::util::metrics::Registry::Instance()
+      .GetHistogram(scwx::util::metrics::MetricName(
+         "radar_coordinates", "1 degree"))
+      .Record(static_cast<std::uint64_t>(timer.elapsed().wall));
 
    p->initialized_ = true;
 }
@@ -704,7 +707,7 @@ void RadarProductManagerImpl::RefreshDataSync(
 
       auto updatePeriod      = providerManager->provider_->update_period();
       auto lastModified      = providerManager->provider_->last_modified();
-      auto sinceLastModified = std::chrono::system_clock::now() - lastModified;
+      auto sinceLastModified = scwx::util::clock::Now() - lastModified;
 
       // For the default interval, assume products are updated at a
       // constant rate. Expect the next product at a time based on the
@@ -748,7 +751,8 @@ void RadarProductManagerImpl::RefreshDataSync(
          std::chrono::duration_cast<std::chrono::seconds>(interval));
 
       {
-         providerManager->refreshTimer_.expires_after(interval);
+         providerManager->refreshTimer_.expires_after(
+            scwx::util::clock::RealInterval(interval));
          providerManager->refreshTimer_.async_wait(
             [=, this](const boost::system::error_code& e)
             {
@@ -819,7 +823,7 @@ RadarProductManager::GetActiveVolumeTimes(
                        [&](const auto& date)
                        {
                           // Don't query for a time point in the future
-                          if (date > std::chrono::system_clock::now())
+                          if (date > scwx::util::clock::Now())
                           {
                              return;
                           }
@@ -848,8 +852,7 @@ RadarProductManager::GetActiveVolumeTimes(
 void RadarProductManagerImpl::LoadProviderData(
    std::chrono::system_clock::time_point              time,
    std::shared_ptr<ProviderManager>                   providerManager,
-   RadarProductRecordMap&                             recordMap,
-   std::shared_mutex&                                 recordMutex,
+   RadarProductTimeIndex&                             recordIndex,
    std::mutex&                                        loadDataMutex,
    const std::shared_ptr<request::NexradFileRequest>& request)
 {
@@ -858,25 +861,15 @@ void RadarProductManagerImpl::LoadProviderData(
                   scwx::util::TimeString(time));
 
    LoadNexradFileAsync(
-      [=, &recordMap, &recordMutex]() -> std::shared_ptr<wsr88d::NexradFile>
+      [=, &recordIndex]() -> std::shared_ptr<wsr88d::NexradFile>
       {
-         std::shared_ptr<types::RadarProductRecord> existingRecord = nullptr;
-         std::shared_ptr<wsr88d::NexradFile>        nexradFile     = nullptr;
+         std::shared_ptr<types::RadarProductRecord> existingRecord =
+            recordIndex.Find(time);
+         std::shared_ptr<wsr88d::NexradFile> nexradFile = nullptr;
 
+         if (existingRecord != nullptr)
          {
-            std::shared_lock sharedLock {recordMutex};
-
-            auto it = recordMap.find(time);
-            if (it != recordMap.cend())
-            {
-               existingRecord = it->second.lock();
-
-               if (existingRecord != nullptr)
-               {
-                  logger_->debug(
-                     "Data previously loaded, loading from data cache");
-               }
-            }
+            logger_->debug("Data previously loaded, loading from data cache");
          }
 
          if (existingRecord == nullptr)
@@ -914,7 +907,6 @@ void RadarProductManager::LoadLevel2Data(
    p->LoadProviderData(time,
                        p->level2ProviderManager_,
                        p->level2ProductRecords_,
-                       p->level2ProductRecordMutex_,
                        p->loadLevel2DataMutex_,
                        request);
 }
@@ -936,17 +928,14 @@ void RadarProductManager::LoadLevel3Data(
    }
    providerManagerLock.unlock();
 
-   // Look up product record
-   std::unique_lock       productRecordLock(p->level3ProductRecordMutex_);
-   RadarProductRecordMap& level3ProductRecords =
-      p->level3ProductRecordsMap_[product];
-   productRecordLock.unlock();
+   // Look up product records
+   RadarProductTimeIndex& level3ProductRecords =
+      p->GetLevel3ProductIndex(product);
 
    // Load provider data
    p->LoadProviderData(time,
                        level3ProviderManager->second,
                        level3ProductRecords,
-                       p->level3ProductRecordMutex_,
                        p->loadLevel3DataMutex_,
                        request);
 }
@@ -1018,6 +1007,16 @@ void RadarProductManager::LoadFile(
    }
 }
 
+void RadarProductManager::LoadNexradFile(
+   const std::shared_ptr<wsr88d::NexradFile>&         nexradFile,
+   const std::shared_ptr<request::NexradFileRequest>& request)
+{
+   RadarProductManagerImpl::LoadNexradFile(
+      [=]() -> std::shared_ptr<wsr88d::NexradFile> { return nexradFile; },
+      request,
+      fileLoadMutex_);
+}
+
 void RadarProductManagerImpl::LoadNexradFileAsync(
    CreateNexradFileFunction                           load,
    const std::shared_ptr<request::NexradFileRequest>& request,
@@ -1089,10 +1088,7 @@ void RadarProductManagerImpl::LoadNexradFile(
 void RadarProductManagerImpl::PopulateLevel2ProductTimes(
    std::chrono::system_clock::time_point time)
 {
-   PopulateProductTimes(level2ProviderManager_,
-                        level2ProductRecords_,
-                        level2ProductRecordMutex_,
-                        time);
+   PopulateProductTimes(level2ProviderManager_, level2ProductRecords_, time);
 }
 
 void RadarProductManagerImpl::PopulateLevel3ProductTimes(
@@ -1102,20 +1098,32 @@ void RadarProductManagerImpl::PopulateLevel3ProductTimes(
    auto level3ProviderManager = GetLevel3ProviderManager(product);
 
    // Get product records
-   std::unique_lock level3ProductRecordLock {level3ProductRecordMutex_};
-   auto&            level3ProductRecords = level3ProductRecordsMap_[product];
-   level3ProductRecordLock.unlock();
-
-   PopulateProductTimes(level3ProviderManager,
-                        level3ProductRecords,
-                        level3ProductRecordMutex_,
-                        time);
+   auto& level3ProductRecords = GetLevel3ProductIndex(product);
+
+   PopulateProductTimes(level3ProviderManager, level3ProductRecords, time);
+}
+
+RadarProductTimeIndex&
+RadarProductManagerImpl::GetLevel3ProductIndex(const std::string& product)
+{
+   std::shared_lock sharedLock {level3ProductRecordMutex_};
+
+   auto it = level3ProductRecordsMap_.find(product);
+   if (it != level3ProductRecordsMap_.end())
+   {
+      return it->second;
+   }
+
+   sharedLock.unlock();
+
+   // Indices are never removed, and references remain valid after insertion
+   std::unique_lock lock {level3ProductRecordMutex_};
+   return level3ProductRecordsMap_.try_emplace(product).first->second;
 }
 
 void RadarProductManagerImpl::PopulateProductTimes(
    std::shared_ptr<ProviderManager>      providerManager,
-   RadarProductRecordMap&                productRecordMap,
-   std::shared_mutex&                    productRecordMutex,
+   RadarProductTimeIndex&                productIndex,
    std::chrono::system_clock::time_point time)
 {
    const auto today = std::chrono::floor<std::chrono::days>(time);
@@ -1130,8 +1138,8 @@ void RadarProductManagerImpl::PopulateProductTimes(
    const auto tomorrow  = today + std::chrono::days {1};
    const auto dates     = {yesterday, today, tomorrow};
 
-   std::set<std::chrono::system_clock::time_point> volumeTimes {};
-   std::mutex                                      volumeTimesMutex {};
+   std::vector<std::chrono::system_clock::time_point> volumeTimes {};
+   std::mutex                                         volumeTimesMutex {};
 
    // For yesterday, today and tomorrow (in parallel)
    std::for_each(std::execution::par_unseq,
@@ -1140,7 +1148,7 @@ void RadarProductManagerImpl::PopulateProductTimes(
                  [&](const auto& date)
                  {
                     // Don't query for a time point in the future
-                    if (date > std::chrono::system_clock::now())
+                    if (date > scwx::util::clock::Now())
                     {
                        return;
                     }
@@ -1153,24 +1161,13 @@ void RadarProductManagerImpl::PopulateProductTimes(
                     std::unique_lock volumeTimesLock {volumeTimesMutex};
 
                     // Copy time points to the merged list
-                    std::copy(timePoints.begin(),
-                              timePoints.end(),
-                              std::inserter(volumeTimes, volumeTimes.end()));
+                    volumeTimes.insert(
+                       volumeTimes.end(), timePoints.begin(), timePoints.end());
                  });
 
-   // Lock the product record map
-   std::unique_lock lock {productRecordMutex};
-
-   // Merge volume times into map
-   std::transform(volumeTimes.cbegin(),
-                  volumeTimes.cend(),
-                  std::inserter(productRecordMap, productRecordMap.begin()),
-                  [](const std::chrono::system_clock::time_point& time)
-                  {
-                     return std::pair<std::chrono::system_clock::time_point,
-                                      std::weak_ptr<types::RadarProductRecord>>(
-                        time, std::weak_ptr<types::RadarProductRecord> {});
-                  });
+   // Merge volume times into the index in a single batch. Readers are not
+   // blocked, and the index is unchanged if all volume times are present.
+   productIndex.Merge(std::move(volumeTimes));
 }
 
 std::tuple<std::shared_ptr<types::RadarProductRecord>,
@@ -1179,32 +1176,22 @@ RadarProductManagerImpl::GetLevel2ProductRecord(
    std::chrono::system_clock::time_point time)
 {
    std::shared_ptr<types::RadarProductRecord> record {nullptr};
-   RadarProductRecordMap::const_pointer       recordPtr {nullptr};
    std::chrono::system_clock::time_point      recordTime {time};
 
    // Ensure Level 2 product records are updated
    PopulateLevel2ProductTimes(time);
 
-   if (!level2ProductRecords_.empty() &&
-       time == std::chrono::system_clock::time_point {})
-   {
-      // If a default-initialized time point is given, return the latest record
-      recordPtr = &(*level2ProductRecords_.rbegin());
-   }
-   else
-   {
-      recordPtr =
-         scwx::util::GetBoundedElementPointer(level2ProductRecords_, time);
-   }
+   // If a default-initialized time point is given, the latest record is found.
+   // Don't check for an exact time match for level 2 products.
+   auto result = level2ProductRecords_.FindBounded(time);
 
-   if (recordPtr != nullptr)
+   if (result.has_value())
    {
-      // Don't check for an exact time match for level 2 products
-      recordTime = recordPtr->first;
-      record     = recordPtr->second.lock();
+      recordTime = result->time_;
+      record     = result->record_;
    }
 
-   if (recordPtr != nullptr && record == nullptr &&
+   if (result.has_value() && record == nullptr &&
        recordTime != std::chrono::system_clock::time_point {})
    {
       // Product is expired, reload it
@@ -1235,41 +1222,22 @@ RadarProductManagerImpl::GetLevel3ProductRecord(
    const std::string& product, std::chrono::system_clock::time_point time)
 {
    std::shared_ptr<types::RadarProductRecord> record {nullptr};
-   RadarProductRecordMap::const_pointer       recordPtr {nullptr};
    std::chrono::system_clock::time_point      recordTime {time};
 
    // Ensure Level 3 product records are updated
    PopulateLevel3ProductTimes(product, time);
 
-   std::unique_lock lock {level3ProductRecordMutex_};
-
-   auto it = level3ProductRecordsMap_.find(product);
+   // If a default-initialized time point is given, the latest record is found.
+   // Don't check for an exact time match for level 3 products.
+   auto result = GetLevel3ProductIndex(product).FindBounded(time);
 
-   if (it != level3ProductRecordsMap_.cend() && !it->second.empty())
+   if (result.has_value())
    {
-      if (time == std::chrono::system_clock::time_point {})
-      {
-         // If a default-initialized time point is given, return the latest
-         // record
-         recordPtr = &(*it->second.rbegin());
-      }
-      else
-      {
-         recordPtr = scwx::util::GetBoundedElementPointer(it->second, time);
-      }
-   }
-
-   // Lock is no longer needed
-   lock.unlock();
-
-   if (recordPtr != nullptr)
-   {
-      // Don't check for an exact time match for level 3 products
-      recordTime = recordPtr->first;
-      record     = recordPtr->second.lock();
+      recordTime = result->time_;
+      record     = result->record_;
    }
 
-   if (recordPtr != nullptr && record == nullptr &&
+   if (result.has_value() && record == nullptr &&
        recordTime != std::chrono::system_clock::time_point {})
    {
       // Product is expired, reload it
@@ -1308,51 +1276,30 @@ RadarProductManagerImpl::StoreRadarProductRecord(
 
    if (record->radar_product_group() == common::RadarProductGroup::Level2)
    {
-      std::unique_lock lock {level2ProductRecordMutex_};
+      storedRecord = level2ProductRecords_.Store(timeInSeconds, record);
 
-      auto it = level2ProductRecords_.find(timeInSeconds);
-      if (it != level2ProductRecords_.cend())
+      if (storedRecord != record)
       {
-         storedRecord = it->second.lock();
-
-         if (storedRecord != nullptr)
-         {
-            logger_->debug(
-               "Level 2 product previously loaded, loading from cache");
-         }
+         logger_->debug(
+            "Level 2 product previously loaded, loading from cache");
       }
 
-      if (storedRecord == nullptr)
-      {
-         storedRecord                         = record;
-         level2ProductRecords_[timeInSeconds] = record;
-      }
+      std::unique_lock lock {level2ProductRecordMutex_};
 
       UpdateRecentRecords(level2ProductRecentRecords_, storedRecord);
    }
    else if (record->radar_product_group() == common::RadarProductGroup::Level3)
    {
-      std::unique_lock lock {level3ProductRecordMutex_};
-
-      auto& productMap = level3ProductRecordsMap_[record->radar_product()];
+      storedRecord = GetLevel3ProductIndex(record->radar_product())
+                        .Store(timeInSeconds, record);
 
-      auto it = productMap.find(timeInSeconds);
-      if (it != productMap.cend())
+      if (storedRecord != record)
       {
-         storedRecord = it->second.lock();
-
-         if (storedRecord != nullptr)
-         {
-            logger_->debug(
-               "Level 3 product previously loaded, loading from cache");
-         }
+         logger_->debug(
+            "Level 3 product previously loaded, loading from cache");
       }
 
-      if (storedRecord == nullptr)
-      {
-         storedRecord              = record;
-         productMap[timeInSeconds] = record;
-      }
+      std::unique_lock lock {level3ProductRecordMutex_};
 
       UpdateRecentRecords(
          level3ProductRecentRecordsMap_[record->radar_product()], storedRecord);
@@ -1414,6 +1361,14 @@ RadarProductManager::GetLevel2Data(wsr88d::rda::DataBlockType dataBlockType,
    return {radarData, elevationCut, elevationCuts, time};
 }
 
+std::tuple<std::shared_ptr<types::RadarProductRecord>,
+           std::chrono::system_clock::time_point>
+RadarProductManager::GetLevel2ProductRecord(
+   std::chrono::system_clock::time_point time)
+{
+   return p->GetLevel2ProductRecord(time);
+}
+
 std::tuple<std::shared_ptr<wsr88d::rpg::Level3Message>,
            std::chrono::system_clock::time_point>
 RadarProductManager::GetLevel3Data(const std::string& product,
@@ -1432,6 +1387,14 @@ RadarProductManager::GetLevel3Data(const std::string& product,
    return {message, time};
 }
 
+std::tuple<std::shared_ptr<types::RadarProductRecord>,
+           std::chrono::system_clock::time_point>
+RadarProductManager::GetLevel3ProductRecord(
+   const std::string& product, std::chrono::system_clock::time_point time)
+{
+   return p->GetLevel3ProductRecord(product, time);
+}
+
 common::Level3ProductCategoryMap
 RadarProductManager::GetAvailableLevel3Categories()
 {
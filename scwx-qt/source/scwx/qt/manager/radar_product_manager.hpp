@@ -96,6 +96,17 @@ public:
                  float                                 elevation,
                  std::chrono::system_clock::time_point time = {});
 
+   /**
+    * @brief Get the level 2 product record for a time.
+    *
+    * @param [in] time Radar product time
+    *
+    * @return Level 2 product record and selected time
+    */
+   std::tuple<std::shared_ptr<types::RadarProductRecord>,
+              std::chrono::system_clock::time_point>
+   GetLevel2ProductRecord(std::chrono::system_clock::time_point time = {});
+
    /**
     * @brief Get level 3 message data for a product and time.
     *
@@ -109,6 +120,19 @@ public:
    GetLevel3Data(const std::string&                    product,
                  std::chrono::system_clock::time_point time = {});
 
+   /**
+    * @brief Get the level 3 product record for a product and time.
+    *
+    * @param [in] product Radar product name
+    * @param [in] time Radar product time
+    *
+    * @return Level 3 product record and selected time
+    */
+   std::tuple<std::shared_ptr<types::RadarProductRecord>,
+              std::chrono::system_clock::time_point>
+   GetLevel3ProductRecord(const std::string&                    product,
+                          std::chrono::system_clock::time_point time = {});
+
    static std::shared_ptr<RadarProductManager>
    Instance(const std::string& radarSite);
 
@@ -127,6 +151,18 @@ public:
       const std::string&                                 filename,
       const std::shared_ptr<request::NexradFileRequest>& request = nullptr);
 
+   /**
+    * @brief Stores a NEXRAD file which has already been parsed, such that
+    * files may be parsed concurrently by the caller. The request is completed
+    * before returning.
+    *
+    * @param [in] nexradFile Parsed NEXRAD file
+    * @param [in] request File request
+    */
+   static void
+   LoadNexradFile(const std::shared_ptr<wsr88d::NexradFile>&         nexradFile,
+                  const std::shared_ptr<request::NexradFileRequest>& request);
+
    common::Level3ProductCategoryMap GetAvailableLevel3Categories();
    std::vector<std::string>         GetLevel3Products();
 
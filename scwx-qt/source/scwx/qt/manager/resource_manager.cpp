@@ -5,9 +5,10 @@
 #include <scwx/qt/util/texture_atlas.hpp>
 #include <scwx/util/logger.hpp>
 
-#include <execution>
-#include <mutex>
+#include <algorithm>
 
+#include <boost/asio/post.hpp>
+#include <boost/asio/thread_pool.hpp>
 #include <imgui.h>
 
 namespace scwx
@@ -22,6 +23,10 @@ namespace ResourceManager
 static const std::string logPrefix_ = "scwx::qt::manager::resource_manager";
 static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 
+// Maximum number of images to load concurrently. Remote requests are further
+// bounded by the image cache connection pool.
+static constexpr std::size_t kMaxConcurrentLoads_ = 8u;
+
 static void LoadFonts();
 static void LoadTextures();
 
@@ -49,22 +54,27 @@ LoadImageResource(const std::string& urlString)
 std::vector<std::shared_ptr<boost::gil::rgba8_image_t>>
 LoadImageResources(const std::vector<std::string>& urlStrings)
 {
-   std::mutex                                              m {};
-   std::vector<std::shared_ptr<boost::gil::rgba8_image_t>> images {};
-
-   std::for_each(std::execution::par_unseq,
-                 urlStrings.begin(),
-                 urlStrings.end(),
-                 [&](auto& urlString)
-                 {
-                    auto image = LoadImageResource(urlString);
-
-                    if (image != nullptr)
-                    {
-                       std::unique_lock lock {m};
-                       images.emplace_back(std::move(image));
-                    }
-                 });
+   std::vector<std::shared_ptr<boost::gil::rgba8_image_t>> images(
+      urlStrings.size());
+
+   // Loads block on network and disk I/O. A parallel algorithm (TBB on Linux,
+   // the native implementation on MSVC) sizes its workers to the CPU count and
+   // has no bound on concurrent requests, so a dedicated pool is used instead.
+   {
+      boost::asio::thread_pool threadPool {
+         std::clamp<std::size_t>(urlStrings.size(), 1u, kMaxConcurrentLoads_)};
+
+      for (std::size_t i = 0; i < urlStrings.size(); ++i)
+      {
+         boost::asio::post(threadPool,
+                           [&, i]()
+                           { images[i] = LoadImageResource(urlStrings[i]); });
+      }
+
+      threadPool.join();
+   }
+
+   std::erase(images, nullptr);
 
    if (!images.empty())
    {
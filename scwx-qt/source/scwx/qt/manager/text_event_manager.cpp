@@ -1,8 +1,10 @@
 #include <scwx/qt/manager/text_event_manager.hpp>
 #include <scwx/qt/main/application.hpp>
 #include <scwx/qt/settings/general_settings.hpp>
+#include <scwx/qt/util/text_event_store.hpp>
 #include <scwx/awips/text_product_file.hpp>
 #include <scwx/provider/warnings_provider.hpp>
+#include <scwx/util/clock.hpp>
 #include <scwx/util/logger.hpp>
 
 #include <shared_mutex>
@@ -11,6 +13,7 @@
 #include <boost/asio/post.hpp>
 #include <boost/asio/steady_timer.hpp>
 #include <boost/asio/thread_pool.hpp>
+#include <QStandardPaths>
 
 namespace scwx
 {
@@ -25,6 +28,9 @@ static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 static const std::string& kDefaultWarningsProviderUrl {
    "https://warnings.allisonhouse.com"};
 
+// Stored text events are retained for at least the maximum backfill horizon
+static constexpr std::chrono::hours kTextEventRetention_ {24 * 30};
+
 class TextEventManager::Impl
 {
 public:
@@ -33,7 +39,12 @@ public:
        refreshTimer_ {threadPool_},
        refreshMutex_ {},
        textEventMap_ {},
-       textEventMutex_ {}
+       textEventMutex_ {},
+       textEventStore_ {
+          QStandardPaths::writableLocation(
+             QStandardPaths::AppLocalDataLocation)
+             .toStdString() +
+          "/text_events"}
    {
       auto& generalSettings = settings::GeneralSettings::Instance();
 
@@ -53,6 +64,7 @@ public:
                            try
                            {
                               main::Application::WaitForInitialization();
+                              LoadStoredEvents();
                               logger_->debug("Start Refresh");
                               Refresh();
                            }
@@ -76,7 +88,9 @@ public:
       threadPool_.join();
    }
 
-   void HandleMessage(std::shared_ptr<awips::TextProductMessage> message);
+   void HandleMessage(std::shared_ptr<awips::TextProductMessage> message,
+                      bool                                       persist);
+   void LoadStoredEvents();
    void RefreshAsync();
    void Refresh();
 
@@ -93,6 +107,9 @@ public:
                      textEventMap_;
    std::shared_mutex textEventMutex_;
 
+   util::TextEventStore                  textEventStore_;
+   std::chrono::system_clock::time_point newerThan_ {};
+
    std::shared_ptr<provider::WarningsProvider> warningsProvider_ {nullptr};
 
    boost::uuids::uuid warningsProviderChangedCallbackUuid_ {};
@@ -154,7 +171,7 @@ void TextEventManager::LoadFile(const std::string& filename)
                            auto messages = file.messages();
                            for (auto& message : messages)
                            {
-                              p->HandleMessage(message);
+                              p->HandleMessage(message, false);
                            }
                         }
                         catch (const std::exception& ex)
@@ -165,7 +182,7 @@ void TextEventManager::LoadFile(const std::string& filename)
 }
 
 void TextEventManager::Impl::HandleMessage(
-   std::shared_ptr<awips::TextProductMessage> message)
+   std::shared_ptr<awips::TextProductMessage> message, bool persist)
 {
    auto segments = message->segments();
 
@@ -221,12 +238,49 @@ void TextEventManager::Impl::HandleMessage(
 
    lock.unlock();
 
+   if (updated && persist)
+   {
+      textEventStore_.Append(
+         key, message->wmo_header()->GetDateTime(), *message);
+   }
+
    if (updated)
    {
       Q_EMIT self_->AlertUpdated(key, messageIndex);
    }
 }
 
+void TextEventManager::Impl::LoadStoredEvents()
+{
+   using namespace std::chrono;
+
+   const auto now = scwx::util::clock::Now();
+   const hours backfillHorizon {settings::GeneralSettings::Instance()
+                                   .warnings_backfill_hours()
+                                   .GetValue()};
+
+   textEventStore_.Prune(now - kTextEventRetention_);
+
+   // Events are populated from the store, within the backfill horizon
+   newerThan_    = now - backfillHorizon;
+   auto messages = textEventStore_.Read(newerThan_);
+
+   logger_->debug("Loading {} stored text event messages", messages.size());
+
+   for (auto& message : messages)
+   {
+      HandleMessage(message, false);
+   }
+
+   // Only warnings files after the high-water mark need to be loaded. The
+   // latest stored file is loaded again, as it may have since been updated.
+   const auto highWaterMark = textEventStore_.high_water_mark();
+   if (highWaterMark != system_clock::time_point {})
+   {
+      newerThan_ = std::max(newerThan_, highWaterMark - 1h);
+   }
+}
+
 void TextEventManager::Impl::RefreshAsync()
 {
    boost::asio::post(threadPool_,
@@ -255,26 +309,28 @@ void TextEventManager::Impl::Refresh()
       warningsProvider_;
 
    // Update the file listing from the warnings provider
-   auto [newFiles, totalFiles] = warningsProvider->ListFiles();
+   auto [newFiles, totalFiles] = warningsProvider->ListFiles(newerThan_);
 
    if (newFiles > 0)
    {
       // Load new files
-      auto updatedFiles = warningsProvider->LoadUpdatedFiles();
+      auto updatedFiles = warningsProvider->LoadUpdatedFiles(newerThan_);
 
       // Handle messages
       for (auto& file : updatedFiles)
       {
          for (auto& message : file->messages())
          {
-            HandleMessage(message);
+            HandleMessage(message, true);
          }
       }
+
+      textEventStore_.SetHighWaterMark(warningsProvider->latest_start_time());
    }
 
    // Schedule another update in 15 seconds
    using namespace std::chrono;
-   refreshTimer_.expires_after(15s);
+   refreshTimer_.expires_after(scwx::util::clock::RealInterval(15s));
    refreshTimer_.async_wait(
       [this](const boost::system::error_code& e)
       {
@@ -1,6 +1,7 @@
 #include <scwx/qt/manager/timeline_manager.hpp>
 #include <scwx/qt/manager/radar_product_manager.hpp>
 #include <scwx/qt/settings/general_settings.hpp>
+#include <scwx/util/clock.hpp>
 #include <scwx/util/logger.hpp>
 #include <scwx/util/map.hpp>
 #include <scwx/util/time.hpp>
@@ -208,7 +209,7 @@ void TimelineManager::AnimationStepBegin()
        p->pinnedTime_ == std::chrono::system_clock::time_point {})
    {
       // If the selected view type is live, select the current products
-      p->SelectTimeAsync(std::chrono::system_clock::now() - p->loopTime_);
+      p->SelectTimeAsync(scwx::util::clock::Now() - p->loopTime_);
    }
    else
    {
@@ -376,7 +377,7 @@ TimelineManager::Impl::GetLoopStartAndEndTimes()
        pinnedTime_ == std::chrono::system_clock::time_point {})
    {
       endTime = std::chrono::floor<std::chrono::minutes>(
-         std::chrono::system_clock::now());
+         scwx::util::clock::Now());
    }
    else
    {
@@ -643,7 +644,7 @@ void TimelineManager::Impl::Step(Direction direction)
    std::chrono::system_clock::time_point queryTime = adjustedTime_;
    if (queryTime == std::chrono::system_clock::time_point {})
    {
-      queryTime = std::chrono::system_clock::now();
+      queryTime = scwx::util::clock::Now();
    }
 
    // Request active volume times
@@ -1,5 +1,6 @@
 #include <scwx/qt/map/map_context.hpp>
 #include <scwx/qt/map/map_settings.hpp>
+#include <scwx/qt/view/mosaic_view.hpp>
 #include <scwx/qt/view/overlay_product_view.hpp>
 #include <scwx/qt/view/radar_product_view.hpp>
 
@@ -35,6 +36,10 @@ public:
    QMargins           colorTableMargins_ {};
    common::Coordinate mouseCoordinate_ {};
 
+   std::optional<std::pair<common::Coordinate, common::Coordinate>>
+      crossSectionLine_ {};
+
+   std::shared_ptr<view::MosaicView>         mosaicView_ {nullptr};
    std::shared_ptr<view::OverlayProductView> overlayProductView_ {nullptr};
    std::shared_ptr<view::RadarProductView>   radarProductView_;
 };
@@ -79,6 +84,17 @@ float MapContext::pixel_ratio() const
    return p->pixelRatio_;
 }
 
+std::shared_ptr<view::MosaicView> MapContext::mosaic_view() const
+{
+   return p->mosaicView_;
+}
+
+std::optional<std::pair<common::Coordinate, common::Coordinate>>
+MapContext::cross_section_line() const
+{
+   return p->crossSectionLine_;
+}
+
 common::Coordinate MapContext::mouse_coordinate() const
 {
    return p->mouseCoordinate_;
@@ -135,6 +151,19 @@ void MapContext::set_color_table_margins(const QMargins& margins)
    p->colorTableMargins_ = margins;
 }
 
+void MapContext::set_cross_section_line(
+   const std::optional<std::pair<common::Coordinate, common::Coordinate>>&
+      line)
+{
+   p->crossSectionLine_ = line;
+}
+
+void MapContext::set_mosaic_view(
+   const std::shared_ptr<view::MosaicView>& mosaicView)
+{
+   p->mosaicView_ = mosaicView;
+}
+
 void MapContext::set_mouse_coordinate(const common::Coordinate& coordinate)
 {
    p->mouseCoordinate_ = coordinate;
@@ -5,6 +5,9 @@
 #include <scwx/common/geographic.hpp>
 #include <scwx/common/products.hpp>
 
+#include <optional>
+#include <utility>
+
 #include <qmaplibre.hpp>
 #include <QMargins>
 
@@ -15,6 +18,7 @@ namespace qt
 namespace view
 {
 
+class MosaicView;
 class OverlayProductView;
 class RadarProductView;
 
@@ -43,7 +47,10 @@ public:
    MapProvider                               map_provider() const;
    MapSettings&                              settings();
    QMargins                                  color_table_margins() const;
+   std::optional<std::pair<common::Coordinate, common::Coordinate>>
+                                             cross_section_line() const;
    float                                     pixel_ratio() const;
+   std::shared_ptr<view::MosaicView>         mosaic_view() const;
    common::Coordinate                        mouse_coordinate() const;
    std::shared_ptr<view::OverlayProductView> overlay_product_view() const;
    std::shared_ptr<view::RadarProductView>   radar_product_view() const;
@@ -56,6 +63,10 @@ public:
    void set_map_copyrights(const std::string& copyrights);
    void set_map_provider(MapProvider provider);
    void set_color_table_margins(const QMargins& margins);
+   void set_cross_section_line(
+      const std::optional<std::pair<common::Coordinate, common::Coordinate>>&
+         line);
+   void set_mosaic_view(const std::shared_ptr<view::MosaicView>& mosaicView);
    void set_mouse_coordinate(const common::Coordinate& coordinate);
    void set_overlay_product_view(
       const std::shared_ptr<view::OverlayProductView>& overlayProductView);
@@ -13,6 +13,7 @@
 #include <scwx/qt/map/overlay_product_layer.hpp>
 #include <scwx/qt/map/placefile_layer.hpp>
 #include <scwx/qt/map/marker_layer.hpp>
+#include <scwx/qt/map/mosaic_layer.hpp>
 #include <scwx/qt/map/radar_product_layer.hpp>
 #include <scwx/qt/map/radar_range_layer.hpp>
 #include <scwx/qt/map/radar_site_layer.hpp>
@@ -22,12 +23,16 @@
 #include <scwx/qt/settings/palette_settings.hpp>
 #include <scwx/qt/util/file.hpp>
 #include <scwx/qt/util/maplibre.hpp>
+#include <scwx/qt/util/metrics.hpp>
 #include <scwx/qt/util/tooltip.hpp>
+#include <scwx/qt/view/mosaic_view.hpp>
 #include <scwx/qt/view/overlay_product_view.hpp>
 #include <scwx/qt/view/radar_product_view_factory.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/metrics.hpp>
 #include <scwx/util/time.hpp>
 
+#include <optional>
 #include <set>
 
 #include <backends/imgui_impl_opengl3.h>
@@ -113,6 +118,12 @@ public:
 
       SetRadarSite(generalSettings.default_radar_site().GetValue());
 
+      // Look up the frame render histogram once, as it is updated every frame
+      frameRenderHistogram_ =
+         &scwx::util::metrics::Registry::Instance().GetHistogram(
+            scwx::util::metrics::MetricName("frame_render",
+                                            fmt::format("pane {}", id_)));
+
       // Create ImGui Context
       static size_t currentMapId_ {0u};
       imGuiContextName_ = fmt::format("Map {}", ++currentMapId_);
@@ -164,6 +175,7 @@ public:
    void HandleHotkeyUpdates();
    void ImGuiCheckFonts();
    void InitializeCustomStyles();
+   void InitializeMosaicView();
    void InitializeNewRadarProductView(const std::string& colorPalette);
    void RadarProductManagerConnect();
    void RadarProductManagerDisconnect();
@@ -224,6 +236,7 @@ public:
    std::shared_ptr<RadarProductLayer>   radarProductLayer_;
    std::shared_ptr<OverlayLayer>        overlayLayer_;
    std::shared_ptr<OverlayProductLayer> overlayProductLayer_ {nullptr};
+   std::shared_ptr<MosaicLayer>         mosaicLayer_ {nullptr};
    std::shared_ptr<PlacefileLayer>      placefileLayer_;
    std::shared_ptr<MarkerLayer>            markerLayer_;
    std::shared_ptr<ColorTableLayer>     colorTableLayer_;
@@ -239,8 +252,12 @@ public:
    bool            hasMouse_ {false};
    bool            isPainting_ {false};
    bool            lastItemPicked_ {false};
+   bool            metricsOverlayVisible_ {false};
    QPointF         lastPos_ {};
    QPointF         lastGlobalPos_ {};
+
+   std::optional<common::Coordinate> crossSectionStart_ {};
+
    std::size_t     currentStyleIndex_;
    const MapStyle* currentStyle_;
    std::string     initialStyleName_ {};
@@ -252,6 +269,8 @@ public:
 
    uint64_t frameDraws_;
 
+   scwx::util::metrics::Histogram* frameRenderHistogram_ {nullptr};
+
    double prevLatitude_;
    double prevLongitude_;
    double prevZoom_;
@@ -686,6 +705,11 @@ std::string MapWidget::GetRadarProductName() const
    }
 }
 
+std::shared_ptr<view::RadarProductView> MapWidget::GetRadarProductView() const
+{
+   return p->context_->radar_product_view();
+}
+
 std::shared_ptr<config::RadarSite> MapWidget::GetRadarSite() const
 {
    std::shared_ptr<config::RadarSite> radarSite = nullptr;
@@ -1015,6 +1039,12 @@ void MapWidget::SetMapStyle(const std::string& styleName)
    }
 }
 
+void MapWidget::SetMetricsOverlayVisible(bool visible)
+{
+   p->metricsOverlayVisible_ = visible;
+   update();
+}
+
 void MapWidget::UpdateMouseCoordinate(const common::Coordinate& coordinate)
 {
    if (p->context_->mouse_coordinate() != coordinate)
@@ -1068,11 +1098,25 @@ void MapWidget::changeStyle()
    Q_EMIT MapStyleChanged(p->currentStyle_->name_);
 }
 
+void MapWidget::ClearCrossSectionLine()
+{
+   if (p->context_->cross_section_line().has_value())
+   {
+      p->context_->set_cross_section_line(std::nullopt);
+      update();
+   }
+}
+
 void MapWidget::DumpLayerList() const
 {
    logger_->info("Layers: {}", p->map_->layerIds().join(", ").toStdString());
 }
 
+void MapWidget::DumpPipelineMetrics()
+{
+   util::metrics::DumpMetrics();
+}
+
 std::string MapWidgetImpl::FindMapSymbologyLayer()
 {
    std::string before = "ferry";
@@ -1249,6 +1293,13 @@ void MapWidgetImpl::AddLayer(types::LayerType        type,
    {
       switch (std::get<types::DataLayer>(description))
       {
+      // Create the radar mosaic layer
+      case types::DataLayer::Mosaic:
+         InitializeMosaicView();
+         mosaicLayer_ = std::make_shared<MosaicLayer>(context_);
+         AddLayer(layerName, mosaicLayer_, before);
+         break;
+
       // If there is a radar product view, create the overlay product layer
       case types::DataLayer::OverlayProduct:
          if (radarProductView != nullptr)
@@ -1378,6 +1429,8 @@ void MapWidget::mousePressEvent(QMouseEvent* ev)
    p->lastPos_       = ev->position();
    p->lastGlobalPos_ = ev->globalPosition();
 
+   p->crossSectionStart_.reset();
+
    if (ev->type() == QEvent::Type::MouseButtonPress)
    {
       if (ev->buttons() ==
@@ -1385,6 +1438,14 @@ void MapWidget::mousePressEvent(QMouseEvent* ev)
       {
          changeStyle();
       }
+      else if (ev->buttons() == Qt::MouseButton::LeftButton &&
+               ev->modifiers() == Qt::KeyboardModifier::ShiftModifier)
+      {
+         // Start a cross-section line on shift + left click
+         auto coordinate = p->map_->coordinateForPixel(p->lastPos_);
+         p->crossSectionStart_ =
+            common::Coordinate {coordinate.first, coordinate.second};
+      }
       else if (ev->buttons() == Qt::MouseButton::MiddleButton)
       {
          // Select nearest WSR-88D radar on middle click
@@ -1415,7 +1476,19 @@ void MapWidget::mouseMoveEvent(QMouseEvent* ev)
 
    if (!delta.isNull())
    {
-      if (ev->buttons() == Qt::MouseButton::LeftButton)
+      if (ev->buttons() == Qt::MouseButton::LeftButton &&
+          p->crossSectionStart_.has_value())
+      {
+         auto coordinate = p->map_->coordinateForPixel(ev->position());
+         common::Coordinate start = *p->crossSectionStart_;
+         common::Coordinate end {coordinate.first, coordinate.second};
+
+         p->context_->set_cross_section_line(std::make_pair(start, end));
+         update();
+
+         Q_EMIT CrossSectionLineChanged(start, end);
+      }
+      else if (ev->buttons() == Qt::MouseButton::LeftButton)
       {
          p->map_->moveBy(delta);
       }
@@ -1535,7 +1608,11 @@ void MapWidget::paintGL()
    p->map_->resize(size());
    p->map_->setFramebufferObject(defaultFramebufferObject(),
                                  size() * pixelRatio());
-   p->map_->render();
+   {
+      scwx::util::metrics::ScopedTimer renderTimer {
+         *p->frameRenderHistogram_};
+      p->map_->render();
+   }
 
    // Perform mouse picking
    if (p->hasMouse_)
@@ -1550,6 +1627,12 @@ void MapWidget::paintGL()
       p->lastItemPicked_ = false;
    }
 
+   // Draw pipeline metrics overlay
+   if (p->metricsOverlayVisible_)
+   {
+      util::metrics::DrawMetricsOverlay();
+   }
+
    // Pop default font
    ImGui::PopFont();
 
@@ -1781,6 +1864,41 @@ void MapWidgetImpl::RadarProductManagerDisconnect()
    }
 }
 
+void MapWidgetImpl::InitializeMosaicView()
+{
+   std::shared_ptr<view::MosaicView> mosaicView = context_->mosaic_view();
+   if (mosaicView == nullptr)
+   {
+      return;
+   }
+
+   boost::asio::post(
+      threadPool_,
+      [mosaicView]()
+      {
+         try
+         {
+            std::string colorTableFile =
+               settings::PaletteSettings::Instance()
+                  .palette(common::GetLevel2Palette(
+                     common::Level2Product::Reflectivity))
+                  .GetValue();
+            if (!colorTableFile.empty())
+            {
+               std::unique_ptr<std::istream> colorTableStream =
+                  util::OpenFile(colorTableFile);
+               std::shared_ptr<common::ColorTable> colorTable =
+                  common::ColorTable::Load(*colorTableStream);
+               mosaicView->LoadColorTable(colorTable);
+            }
+         }
+         catch (const std::exception& ex)
+         {
+            logger_->error(ex.what());
+         }
+      });
+}
+
 void MapWidgetImpl::InitializeNewRadarProductView(
    const std::string& colorPalette)
 {
@@ -1904,6 +2022,13 @@ void MapWidgetImpl::SetRadarSite(const std::string& radarSite)
       context_->overlay_product_view()->set_radar_product_manager(
          radarProductManager_);
 
+      // Maps showing the same radar site share a mosaic view
+      context_->set_mosaic_view(view::MosaicView::Instance(radarSite));
+      if (mosaicLayer_ != nullptr)
+      {
+         InitializeMosaicView();
+      }
+
       // Connect signals to new RadarProductManager
       RadarProductManagerConnect();
 
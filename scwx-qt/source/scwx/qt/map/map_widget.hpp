@@ -24,6 +24,13 @@ namespace scwx
 {
 namespace qt
 {
+namespace view
+{
+
+class RadarProductView;
+
+} // namespace view
+
 namespace map
 {
 
@@ -37,18 +44,22 @@ public:
    explicit MapWidget(std::size_t id, const QMapLibre::Settings&);
    ~MapWidget();
 
+   void ClearCrossSectionLine();
    void DumpLayerList() const;
 
-   common::Level3ProductCategoryMap      GetAvailableLevel3Categories();
-   float                                 GetElevation() const;
-   std::vector<float>                    GetElevationCuts() const;
-   std::vector<std::string>              GetLevel3Products();
-   std::string                           GetMapStyle() const;
-   common::RadarProductGroup             GetRadarProductGroup() const;
-   std::string                           GetRadarProductName() const;
-   std::shared_ptr<config::RadarSite>    GetRadarSite() const;
-   std::chrono::system_clock::time_point GetSelectedTime() const;
-   std::uint16_t                         GetVcp() const;
+   static void DumpPipelineMetrics();
+
+   common::Level3ProductCategoryMap        GetAvailableLevel3Categories();
+   float                                   GetElevation() const;
+   std::vector<float>                      GetElevationCuts() const;
+   std::vector<std::string>                GetLevel3Products();
+   std::string                             GetMapStyle() const;
+   common::RadarProductGroup               GetRadarProductGroup() const;
+   std::string                             GetRadarProductName() const;
+   std::shared_ptr<view::RadarProductView> GetRadarProductView() const;
+   std::shared_ptr<config::RadarSite>      GetRadarSite() const;
+   std::chrono::system_clock::time_point   GetSelectedTime() const;
+   std::uint16_t                           GetVcp() const;
 
    void SelectElevation(float elevation);
 
@@ -117,6 +128,7 @@ public:
                          double pitch);
    void SetInitialMapStyle(const std::string& styleName);
    void SetMapStyle(const std::string& styleName);
+   void SetMetricsOverlayVisible(bool visible);
 
    /**
     * Updates the coordinates associated with mouse movement from another map.
@@ -152,6 +164,17 @@ private slots:
 
 signals:
    void AlertSelected(const types::TextEventKey& key);
+
+   /**
+    * This signal is emitted when a cross-section line is drawn on the map, by
+    * dragging the mouse with the left button while holding shift.
+    *
+    * @param [in] start Geographic coordinate of the start of the line
+    * @param [in] end Geographic coordinate of the end of the line
+    */
+   void CrossSectionLineChanged(common::Coordinate start,
+                                common::Coordinate end);
+
    void Level3ProductsChanged();
    void MapParametersChanged(double latitude,
                              double longitude,
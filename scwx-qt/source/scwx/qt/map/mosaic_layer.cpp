@@ -0,0 +1,444 @@
+#include <scwx/qt/map/mosaic_layer.hpp>
+#include <scwx/qt/gl/shader_program.hpp>
+#include <scwx/qt/util/maplibre.hpp>
+#include <scwx/qt/view/mosaic_view.hpp>
+#include <scwx/util/logger.hpp>
+#include <scwx/util/metrics.hpp>
+
+#include <numeric>
+
+#if defined(_MSC_VER)
+#   pragma warning(push, 0)
+#endif
+
+#include <boost/timer/timer.hpp>
+#include <boost/uuid/random_generator.hpp>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+#include <mbgl/util/constants.hpp>
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+namespace scwx
+{
+namespace qt
+{
+namespace map
+{
+
+static const std::string logPrefix_ = "scwx::qt::map::mosaic_layer";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+class MosaicLayer::Impl
+{
+public:
+   explicit Impl(MosaicLayer* self) :
+       self_ {self},
+       uMVPMatrixLocation_(GL_INVALID_INDEX),
+       uMapScreenCoordLocation_(GL_INVALID_INDEX),
+       uDataMomentOffsetLocation_(GL_INVALID_INDEX),
+       uDataMomentScaleLocation_(GL_INVALID_INDEX),
+       uCFPEnabledLocation_(GL_INVALID_INDEX),
+       vbo_ {GL_INVALID_INDEX},
+       vao_ {GL_INVALID_INDEX},
+       texture_ {GL_INVALID_INDEX}
+   {
+   }
+   ~Impl() = default;
+
+   void SetMosaicView(const std::shared_ptr<view::MosaicView>& mosaicView);
+
+   MosaicLayer*       self_;
+   boost::uuids::uuid uuid_ {boost::uuids::random_generator()()};
+
+   std::shared_ptr<view::MosaicView> mosaicView_ {nullptr};
+   bool                              initialized_ {false};
+
+   std::shared_ptr<gl::ShaderProgram> shaderProgram_ {nullptr};
+
+   GLint                 uMVPMatrixLocation_;
+   GLint                 uMapScreenCoordLocation_;
+   GLint                 uDataMomentOffsetLocation_;
+   GLint                 uDataMomentScaleLocation_;
+   GLint                 uCFPEnabledLocation_;
+   std::array<GLuint, 2> vbo_;
+   GLuint                vao_;
+   GLuint                texture_;
+
+   // Generation and vertex count of each tile in the vertex buffers
+   std::vector<std::uint64_t> tileGenerations_ {};
+   std::vector<GLint>         tileFirst_ {};
+   std::vector<GLsizei>       tileCount_ {};
+   GLsizeiptr                 numVertices_ {0};
+
+   bool colorTableNeedsUpdate_ {false};
+   bool mosaicNeedsUpdate_ {false};
+};
+
+MosaicLayer::MosaicLayer(std::shared_ptr<MapContext> context) :
+    GenericLayer(context), p(std::make_unique<Impl>(this))
+{
+   p->SetMosaicView(context->mosaic_view());
+}
+MosaicLayer::~MosaicLayer()
+{
+   p->SetMosaicView(nullptr);
+}
+
+void MosaicLayer::Impl::SetMosaicView(
+   const std::shared_ptr<view::MosaicView>& mosaicView)
+{
+   if (mosaicView_ != nullptr)
+   {
+      disconnect(mosaicView_.get(), nullptr, self_, nullptr);
+
+      if (initialized_)
+      {
+         mosaicView_->SetEnabled(uuid_, false);
+      }
+   }
+
+   mosaicView_ = mosaicView;
+
+   // Reallocate the vertex buffers and upload each tile from the new view
+   tileGenerations_.clear();
+   colorTableNeedsUpdate_ = true;
+   mosaicNeedsUpdate_     = true;
+
+   if (mosaicView_ == nullptr)
+   {
+      return;
+   }
+
+   connect(mosaicView_.get(),
+           &view::MosaicView::ColorTableLutUpdated,
+           self_,
+           [this]() { colorTableNeedsUpdate_ = true; });
+   connect(mosaicView_.get(),
+           &view::MosaicView::MosaicUpdated,
+           self_,
+           [this]() { mosaicNeedsUpdate_ = true; });
+
+   if (initialized_)
+   {
+      mosaicView_->SetEnabled(uuid_, true);
+   }
+}
+
+void MosaicLayer::Initialize()
+{
+   logger_->debug("Initialize()");
+
+   gl::OpenGLFunctions& gl = context()->gl();
+
+   // Load and configure radar shader
+   p->shaderProgram_ =
+      context()->GetShaderProgram(":/gl/radar.vert", ":/gl/radar.frag");
+
+   p->uMVPMatrixLocation_ =
+      gl.glGetUniformLocation(p->shaderProgram_->id(), "uMVPMatrix");
+   if (p->uMVPMatrixLocation_ == -1)
+   {
+      logger_->warn("Could not find uMVPMatrix");
+   }
+
+   p->uMapScreenCoordLocation_ =
+      gl.glGetUniformLocation(p->shaderProgram_->id(), "uMapScreenCoord");
+   if (p->uMapScreenCoordLocation_ == -1)
+   {
+      logger_->warn("Could not find uMapScreenCoord");
+   }
+
+   p->uDataMomentOffsetLocation_ =
+      gl.glGetUniformLocation(p->shaderProgram_->id(), "uDataMomentOffset");
+   if (p->uDataMomentOffsetLocation_ == -1)
+   {
+      logger_->warn("Could not find uDataMomentOffset");
+   }
+
+   p->uDataMomentScaleLocation_ =
+      gl.glGetUniformLocation(p->shaderProgram_->id(), "uDataMomentScale");
+   if (p->uDataMomentScaleLocation_ == -1)
+   {
+      logger_->warn("Could not find uDataMomentScale");
+   }
+
+   p->uCFPEnabledLocation_ =
+      gl.glGetUniformLocation(p->shaderProgram_->id(), "uCFPEnabled");
+   if (p->uCFPEnabledLocation_ == -1)
+   {
+      logger_->warn("Could not find uCFPEnabled");
+   }
+
+   p->shaderProgram_->Use();
+
+   // Generate a vertex array object
+   gl.glGenVertexArrays(1, &p->vao_);
+
+   // Generate vertex buffer objects
+   gl.glGenBuffers(2, p->vbo_.data());
+
+   // Update mosaic
+   p->mosaicNeedsUpdate_ = true;
+   UpdateMosaic();
+
+   // Create color table
+   gl.glGenTextures(1, &p->texture_);
+   p->colorTableNeedsUpdate_ = true;
+   UpdateColorTable();
+   gl.glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+   gl.glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+   gl.glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+
+   // Start collecting radar data
+   p->initialized_ = true;
+   if (p->mosaicView_ != nullptr)
+   {
+      p->mosaicView_->SetEnabled(p->uuid_, true);
+   }
+}
+
+void MosaicLayer::UpdateMosaic()
+{
+   logger_->debug("UpdateMosaic()");
+
+   gl::OpenGLFunctions& gl = context()->gl();
+
+   std::shared_ptr<view::MosaicView> mosaicView = p->mosaicView_;
+   if (mosaicView == nullptr)
+   {
+      return;
+   }
+
+   std::unique_lock mosaicLock(mosaicView->mosaic_mutex(), std::try_to_lock);
+   if (!mosaicLock.owns_lock())
+   {
+      logger_->debug("Mosaic locked, deferring update");
+      return;
+   }
+
+   p->mosaicNeedsUpdate_ = false;
+
+   const std::vector<view::MosaicView::Tile>& tiles = mosaicView->tiles();
+   constexpr std::size_t kMaxTileVertices = view::MosaicView::kMaxTileVertices;
+
+   boost::timer::cpu_timer timer;
+
+   // Bind a vertex array object
+   gl.glBindVertexArray(p->vao_);
+
+   // Allocate space for each tile when the number of tiles changes
+   if (p->tileGenerations_.size() != tiles.size())
+   {
+      p->tileGenerations_.assign(tiles.size(), 0u);
+      p->tileFirst_.assign(tiles.size(), 0);
+      p->tileCount_.assign(tiles.size(), 0);
+
+      gl.glBindBuffer(GL_ARRAY_BUFFER, p->vbo_[0]);
+      gl.glBufferData(GL_ARRAY_BUFFER,
+                      tiles.size() * kMaxTileVertices * 2 * sizeof(GLfloat),
+                      nullptr,
+                      GL_DYNAMIC_DRAW);
+
+      gl.glVertexAttribPointer(
+         0, 2, GL_FLOAT, GL_FALSE, 0, static_cast<void*>(0));
+      gl.glEnableVertexAttribArray(0);
+
+      gl.glBindBuffer(GL_ARRAY_BUFFER, p->vbo_[1]);
+      gl.glBufferData(GL_ARRAY_BUFFER,
+                      tiles.size() * kMaxTileVertices * sizeof(GLubyte),
+                      nullptr,
+                      GL_DYNAMIC_DRAW);
+
+      gl.glVertexAttribIPointer(
+         1, 1, GL_UNSIGNED_BYTE, 0, static_cast<void*>(0));
+      gl.glEnableVertexAttribArray(1);
+
+      // The mosaic has no CFP data
+      gl.glDisableVertexAttribArray(2);
+   }
+
+   // Upload only the tiles which have been regenerated
+   std::size_t uploadedTiles = 0;
+
+   for (std::size_t i = 0; i < tiles.size(); ++i)
+   {
+      const view::MosaicView::Tile& tile = tiles[i];
+
+      if (tile.generation_ == p->tileGenerations_[i])
+      {
+         continue;
+      }
+
+      const std::size_t vertexCount = tile.dataMoments_.size();
+      const std::size_t offset      = i * kMaxTileVertices;
+
+      gl.glBindBuffer(GL_ARRAY_BUFFER, p->vbo_[0]);
+      gl.glBufferSubData(GL_ARRAY_BUFFER,
+                         offset * 2 * sizeof(GLfloat),
+                         vertexCount * 2 * sizeof(GLfloat),
+                         tile.vertices_.data());
+
+      gl.glBindBuffer(GL_ARRAY_BUFFER, p->vbo_[1]);
+      gl.glBufferSubData(GL_ARRAY_BUFFER,
+                         offset * sizeof(GLubyte),
+                         vertexCount * sizeof(GLubyte),
+                         tile.dataMoments_.data());
+
+      p->tileGenerations_[i] = tile.generation_;
+      p->tileFirst_[i]       = static_cast<GLint>(offset);
+      p->tileCount_[i]       = static_cast<GLsizei>(vertexCount);
+
+      ++uploadedTiles;
+   }
+
+   timer.stop();
+
+   if (uploadedTiles > 0)
+   {
+      scwx::util::metrics::Registry::Instance()
+         .GetHistogram(scwx::util::metrics::MetricName("gpu_upload", "Mosaic"))
+         .Record(static_cast<std::uint64_t>(timer.elapsed().wall));
+   }
+
+   p->numVertices_ = std::accumulate(
+      p->tileCount_.cbegin(), p->tileCount_.cend(), GLsizeiptr {0});
+}
+
+void MosaicLayer::Render(const QMapLibre::CustomLayerRenderParameters& params)
+{
+   gl::OpenGLFunctions& gl = context()->gl();
+
+   p->shaderProgram_->Use();
+
+   // Set OpenGL blend mode for transparency
+   gl.glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+   // Follow the view of the selected radar site
+   if (context()->mosaic_view() != p->mosaicView_)
+   {
+      p->SetMosaicView(context()->mosaic_view());
+   }
+
+   if (p->colorTableNeedsUpdate_)
+   {
+      UpdateColorTable();
+   }
+
+   if (p->mosaicNeedsUpdate_)
+   {
+      UpdateMosaic();
+   }
+
+   if (p->numVertices_ == 0)
+   {
+      return;
+   }
+
+   const float scale = std::pow(2.0, params.zoom) * 2.0f *
+                       mbgl::util::tileSize_D / mbgl::util::DEGREES_MAX;
+   const float xScale = scale / params.width;
+   const float yScale = scale / params.height;
+
+   glm::mat4 uMVPMatrix(1.0f);
+   uMVPMatrix = glm::scale(uMVPMatrix, glm::vec3(xScale, yScale, 1.0f));
+   uMVPMatrix = glm::rotate(uMVPMatrix,
+                            glm::radians<float>(params.bearing),
+                            glm::vec3(0.0f, 0.0f, 1.0f));
+
+   gl.glUniform2fv(p->uMapScreenCoordLocation_,
+                   1,
+                   glm::value_ptr(util::maplibre::LatLongToScreenCoordinate(
+                      {params.latitude, params.longitude})));
+
+   gl.glUniformMatrix4fv(
+      p->uMVPMatrixLocation_, 1, GL_FALSE, glm::value_ptr(uMVPMatrix));
+
+   gl.glUniform1i(p->uCFPEnabledLocation_, 0);
+
+   gl.glActiveTexture(GL_TEXTURE0);
+   gl.glBindTexture(GL_TEXTURE_1D, p->texture_);
+   gl.glBindVertexArray(p->vao_);
+   gl.glMultiDrawArrays(GL_TRIANGLES,
+                        p->tileFirst_.data(),
+                        p->tileCount_.data(),
+                        static_cast<GLsizei>(p->tileCount_.size()));
+
+   SCWX_GL_CHECK_ERROR();
+}
+
+void MosaicLayer::Deinitialize()
+{
+   logger_->debug("Deinitialize()");
+
+   gl::OpenGLFunctions& gl = context()->gl();
+
+   // Stop collecting radar data
+   if (p->mosaicView_ != nullptr)
+   {
+      p->mosaicView_->SetEnabled(p->uuid_, false);
+   }
+   p->initialized_ = false;
+
+   gl.glDeleteVertexArrays(1, &p->vao_);
+   gl.glDeleteBuffers(2, p->vbo_.data());
+   gl.glDeleteTextures(1, &p->texture_);
+
+   p->uMVPMatrixLocation_        = GL_INVALID_INDEX;
+   p->uMapScreenCoordLocation_   = GL_INVALID_INDEX;
+   p->uDataMomentOffsetLocation_ = GL_INVALID_INDEX;
+   p->uDataMomentScaleLocation_  = GL_INVALID_INDEX;
+   p->uCFPEnabledLocation_       = GL_INVALID_INDEX;
+   p->vao_                       = GL_INVALID_INDEX;
+   p->vbo_                       = {GL_INVALID_INDEX};
+   p->texture_                   = GL_INVALID_INDEX;
+   p->numVertices_               = 0;
+
+   p->tileGenerations_.clear();
+   p->tileFirst_.clear();
+   p->tileCount_.clear();
+}
+
+void MosaicLayer::UpdateColorTable()
+{
+   logger_->debug("UpdateColorTable()");
+
+   p->colorTableNeedsUpdate_ = false;
+
+   gl::OpenGLFunctions&              gl         = context()->gl();
+   std::shared_ptr<view::MosaicView> mosaicView = p->mosaicView_;
+
+   if (mosaicView == nullptr)
+   {
+      return;
+   }
+
+   const std::vector<boost::gil::rgba8_pixel_t>& colorTable =
+      mosaicView->color_table_lut();
+   const std::uint16_t rangeMin = mosaicView->color_table_min();
+   const std::uint16_t rangeMax = mosaicView->color_table_max();
+
+   const float scale = rangeMax - rangeMin;
+
+   gl.glActiveTexture(GL_TEXTURE0);
+   gl.glBindTexture(GL_TEXTURE_1D, p->texture_);
+   gl.glTexImage1D(GL_TEXTURE_1D,
+                   0,
+                   GL_RGBA,
+                   static_cast<GLsizei>(colorTable.size()),
+                   0,
+                   GL_RGBA,
+                   GL_UNSIGNED_BYTE,
+                   colorTable.data());
+   gl.glGenerateMipmap(GL_TEXTURE_1D);
+
+   gl.glUniform1ui(p->uDataMomentOffsetLocation_, rangeMin);
+   gl.glUniform1f(p->uDataMomentScaleLocation_, scale);
+}
+
+} // namespace map
+} // namespace qt
+} // namespace scwx
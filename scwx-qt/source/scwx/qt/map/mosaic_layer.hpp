@@ -0,0 +1,35 @@
+#pragma once
+
+#include <scwx/qt/map/generic_layer.hpp>
+
+namespace scwx
+{
+namespace qt
+{
+namespace map
+{
+
+class MosaicLayer : public GenericLayer
+{
+   Q_DISABLE_COPY_MOVE(MosaicLayer)
+
+public:
+   explicit MosaicLayer(std::shared_ptr<MapContext> context);
+   ~MosaicLayer();
+
+   void Initialize() override final;
+   void Render(const QMapLibre::CustomLayerRenderParameters&) override final;
+   void Deinitialize() override final;
+
+private:
+   void UpdateColorTable();
+   void UpdateMosaic();
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace map
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,312 @@
+#include <scwx/qt/map/overlay_geometry.hpp>
+#include <scwx/qt/config/radar_site.hpp>
+#include <scwx/qt/types/radar_product_record.hpp>
+#include <scwx/wsr88d/rpg/linked_vector_packet.hpp>
+#include <scwx/wsr88d/rpg/rpg_types.hpp>
+#include <scwx/wsr88d/rpg/scit_data_packet.hpp>
+#include <scwx/wsr88d/rpg/storm_id_symbol_packet.hpp>
+#include <scwx/wsr88d/rpg/storm_tracking_information_message.hpp>
+#include <scwx/util/logger.hpp>
+#include <scwx/util/time.hpp>
+
+#include <fmt/format.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace map
+{
+
+static const std::string logPrefix_ = "scwx::qt::map::overlay_geometry";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+static const std::string kDerivedDataKey_ = "overlay_geometry";
+
+class OverlayGeometry::Impl
+{
+public:
+   explicit Impl() {}
+   ~Impl() = default;
+
+   void CreateStormTrackingGeometry(
+      const std::shared_ptr<const wsr88d::rpg::StormTrackingInformationMessage>&
+                                sti,
+      const common::Coordinate& center);
+
+   void HandleScitDataPacket(
+      const std::shared_ptr<const wsr88d::rpg::StormTrackingInformationMessage>&
+                                                        sti,
+      const std::shared_ptr<const wsr88d::rpg::Packet>& packet,
+      const common::Coordinate&                         center,
+      const std::string&                                stormId,
+      const std::string&                                hoverText);
+
+   static void HandleStormIdPacket(
+      const std::shared_ptr<const wsr88d::rpg::StormTrackingInformationMessage>&
+                                                        sti,
+      const std::shared_ptr<const wsr88d::rpg::Packet>& packet,
+      std::string&                                      stormId,
+      std::string&                                      hoverText);
+
+   static std::string BuildHoverText(
+      const std::shared_ptr<
+         const scwx::wsr88d::rpg::StormTrackingInformationMessage>& sti,
+      const std::string&                                            stormId);
+
+   std::vector<Vector> vectors_ {};
+};
+
+OverlayGeometry::OverlayGeometry(
+   const std::shared_ptr<const wsr88d::rpg::Level3Message>& message,
+   const common::Coordinate&                                center) :
+    p(std::make_unique<Impl>())
+{
+   auto sti = std::dynamic_pointer_cast<
+      const wsr88d::rpg::StormTrackingInformationMessage>(message);
+
+   if (sti != nullptr)
+   {
+      p->CreateStormTrackingGeometry(sti, center);
+   }
+}
+
+OverlayGeometry::~OverlayGeometry() = default;
+
+const std::vector<OverlayGeometry::Vector>& OverlayGeometry::vectors() const
+{
+   return p->vectors_;
+}
+
+std::shared_ptr<const OverlayGeometry>
+OverlayGeometry::Get(const std::shared_ptr<types::RadarProductRecord>& record)
+{
+   if (record == nullptr || record->level3_file() == nullptr)
+   {
+      return nullptr;
+   }
+
+   return record->GetDerivedData<OverlayGeometry>(
+      kDerivedDataKey_,
+      [&record]()
+      {
+         logger_->debug("Creating overlay geometry: {} {}",
+                        record->radar_product(),
+                        scwx::util::TimeString(record->time()));
+
+         common::Coordinate center {0.0, 0.0};
+
+         auto radarSite = config::RadarSite::Get(record->radar_id());
+         if (radarSite != nullptr)
+         {
+            center = {radarSite->latitude(), radarSite->longitude()};
+         }
+
+         return std::make_shared<const OverlayGeometry>(
+            record->level3_file()->message(), center);
+      });
+}
+
+void OverlayGeometry::Impl::CreateStormTrackingGeometry(
+   const std::shared_ptr<const wsr88d::rpg::StormTrackingInformationMessage>&
+                             sti,
+   const common::Coordinate& center)
+{
+   auto psb = sti->symbology_block();
+   if (psb == nullptr)
+   {
+      logger_->trace("No Storm Tracking Information found");
+      return;
+   }
+
+   std::string stormId = "?";
+   std::string hoverText {};
+
+   for (std::size_t i = 0; i < psb->number_of_layers(); ++i)
+   {
+      auto packetList = psb->packet_list(static_cast<std::uint16_t>(i));
+      for (auto& packet : packetList)
+      {
+         switch (packet->packet_code())
+         {
+         case static_cast<std::uint16_t>(wsr88d::rpg::PacketCode::StormId):
+            HandleStormIdPacket(sti, packet, stormId, hoverText);
+            break;
+
+         case static_cast<std::uint16_t>(
+            wsr88d::rpg::PacketCode::ScitPastData):
+         case static_cast<std::uint16_t>(
+            wsr88d::rpg::PacketCode::ScitForecastData):
+            HandleScitDataPacket(sti, packet, center, stormId, hoverText);
+            break;
+
+         default:
+            logger_->trace("Ignoring packet type: {}", packet->packet_code());
+            break;
+         }
+      }
+   }
+}
+
+void OverlayGeometry::Impl::HandleStormIdPacket(
+   const std::shared_ptr<const wsr88d::rpg::StormTrackingInformationMessage>&
+                                                     sti,
+   const std::shared_ptr<const wsr88d::rpg::Packet>& packet,
+   std::string&                                      stormId,
+   std::string&                                      hoverText)
+{
+   auto stormIdPacket =
+      std::dynamic_pointer_cast<const wsr88d::rpg::StormIdSymbolPacket>(packet);
+
+   if (stormIdPacket != nullptr && stormIdPacket->RecordCount() > 0)
+   {
+      stormId   = stormIdPacket->storm_id(0);
+      hoverText = BuildHoverText(sti, stormId);
+   }
+   else
+   {
+      logger_->warn("Invalid Storm ID Packet");
+
+      stormId = "?";
+      hoverText.clear();
+   }
+}
+
+void OverlayGeometry::Impl::HandleScitDataPacket(
+   const std::shared_ptr<const wsr88d::rpg::StormTrackingInformationMessage>&
+                                                     sti,
+   const std::shared_ptr<const wsr88d::rpg::Packet>& packet,
+   const common::Coordinate&                         center,
+   const std::string&                                stormId,
+   const std::string&                                hoverText)
+{
+   auto scitDataPacket =
+      std::dynamic_pointer_cast<const wsr88d::rpg::ScitDataPacket>(packet);
+
+   if (scitDataPacket == nullptr)
+   {
+      logger_->warn("Invalid SCIT Data Packet");
+      return;
+   }
+
+   VectorType                  type  = VectorType::StormTrackForecast;
+   boost::gil::rgba32f_pixel_t color = {1.0f, 1.0f, 1.0f, 1.0f};
+
+   units::length::nautical_miles<float> tickRadius {0.5f};
+   units::length::nautical_miles<float> tickRadiusIncrement {0.0f};
+
+   if (scitDataPacket->packet_code() ==
+       static_cast<std::uint16_t>(wsr88d::rpg::PacketCode::ScitPastData))
+   {
+      // If this is past data, the default tick radius and increment with a
+      // darker color
+      type  = VectorType::StormTrackPast;
+      color = {0.5f, 0.5f, 0.5f, 1.0f};
+   }
+   else
+   {
+      auto stiRecord = sti->sti_record(stormId);
+
+      if (stiRecord != nullptr && stiRecord->meanError_.has_value())
+      {
+         // If this is forecast data, use the mean error as the radius
+         // (minimum of the default value), incrementing by the mean error
+         tickRadiusIncrement = stiRecord->meanError_.value();
+         tickRadius          = std::max(tickRadius, tickRadiusIncrement);
+      }
+   }
+
+   for (const wsr88d::rpg::Packet* subpacket : scitDataPacket->packet_list())
+   {
+      // The subpacket handle shares ownership of the SCIT data packet
+      auto linkedVectorPacket =
+         std::shared_ptr<const wsr88d::rpg::LinkedVectorPacket>(
+            scitDataPacket,
+            dynamic_cast<const wsr88d::rpg::LinkedVectorPacket*>(subpacket));
+
+      if (subpacket->packet_code() !=
+          static_cast<std::uint16_t>(
+             wsr88d::rpg::PacketCode::LinkedVectorNoValue))
+      {
+         logger_->trace("Ignoring SCIT subpacket type: {}",
+                        subpacket->packet_code());
+      }
+      else if (linkedVectorPacket == nullptr)
+      {
+         logger_->warn("Invalid Linked Vector Packet");
+      }
+      else
+      {
+         vectors_.push_back(
+            {type,
+             color,
+             hoverText,
+             gl::draw::LinkedVectors::CreateGeometry(
+                center, linkedVectorPacket, tickRadius, tickRadiusIncrement)});
+      }
+   }
+}
+
+std::string OverlayGeometry::Impl::BuildHoverText(
+   const std::shared_ptr<
+      const scwx::wsr88d::rpg::StormTrackingInformationMessage>& sti,
+   const std::string&                                            stormId)
+{
+   std::string hoverText = fmt::format("Storm ID: {}", stormId);
+
+   auto stiRecord = sti->sti_record(stormId);
+
+   if (stiRecord != nullptr)
+   {
+      if (stiRecord->direction_.has_value() && stiRecord->speed_.has_value())
+      {
+         hoverText +=
+            fmt::format("\nMovement: {} @ {}",
+                        units::to_string(stiRecord->direction_.value()),
+                        units::to_string(stiRecord->speed_.value()));
+      }
+
+      if (stiRecord->maxDbz_.has_value() &&
+          stiRecord->maxDbzHeight_.has_value())
+      {
+         hoverText +=
+            fmt::format("\nMax dBZ: {} ({} kft)",
+                        stiRecord->maxDbz_.value(),
+                        stiRecord->maxDbzHeight_.value().value() / 1000.0f);
+      }
+
+      if (stiRecord->forecastError_.has_value())
+      {
+         hoverText +=
+            fmt::format("\nForecast Error: {}",
+                        units::to_string(stiRecord->forecastError_.value()));
+      }
+
+      if (stiRecord->meanError_.has_value())
+      {
+         hoverText +=
+            fmt::format("\nMean Error: {}",
+                        units::to_string(stiRecord->meanError_.value()));
+      }
+   }
+
+   auto dateTime = sti->date_time();
+   if (dateTime.has_value())
+   {
+      hoverText += fmt::format("\nDate/Time: {}",
+                               scwx::util::TimeString(dateTime.value()));
+   }
+
+   auto forecastInterval = sti->forecast_interval();
+   if (forecastInterval.has_value())
+   {
+      hoverText += fmt::format("\nForecast Interval: {} min",
+                               forecastInterval.value().count());
+   }
+
+   return hoverText;
+}
+
+} // namespace map
+} // namespace qt
+} // namespace scwx
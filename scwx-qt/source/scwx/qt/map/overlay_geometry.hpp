@@ -0,0 +1,98 @@
+#pragma once
+
+#include <scwx/qt/gl/draw/linked_vectors.hpp>
+#include <scwx/common/geographic.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/gil.hpp>
+
+namespace scwx
+{
+namespace wsr88d
+{
+namespace rpg
+{
+
+class Level3Message;
+
+} // namespace rpg
+} // namespace wsr88d
+
+namespace qt
+{
+namespace types
+{
+
+class RadarProductRecord;
+
+} // namespace types
+
+namespace map
+{
+
+/**
+ * @brief Overlay geometry derived from a Level 3 graphic product, such as
+ * storm tracking information.
+ *
+ * Deriving geometry requires geodesic calculations for each vertex and tick
+ * mark, and formatting hover text for each storm cell. Geometry is created
+ * once per product record, typically on a worker thread, and is immutable once
+ * created, such that it may be shared between layers and reused when the same
+ * product is selected again.
+ */
+class OverlayGeometry
+{
+public:
+   enum class VectorType
+   {
+      StormTrackPast,
+      StormTrackForecast
+   };
+
+   struct Vector
+   {
+      VectorType                                            type_;
+      boost::gil::rgba32f_pixel_t                           modulate_;
+      std::string                                           hoverText_;
+      std::shared_ptr<const gl::draw::LinkedVectorGeometry> geometry_;
+   };
+
+   /**
+    * Creates overlay geometry from a Level 3 message.
+    *
+    * @param [in] message Level 3 message
+    * @param [in] center Radar site location
+    */
+   explicit OverlayGeometry(
+      const std::shared_ptr<const wsr88d::rpg::Level3Message>& message,
+      const common::Coordinate&                                center);
+   ~OverlayGeometry();
+
+   OverlayGeometry(const OverlayGeometry&)            = delete;
+   OverlayGeometry& operator=(const OverlayGeometry&) = delete;
+
+   const std::vector<Vector>& vectors() const;
+
+   /**
+    * Gets the overlay geometry of a product record, creating it on first
+    * access. The geometry is cached with the record.
+    *
+    * @param [in] record Level 3 product record
+    *
+    * @return Overlay geometry, or nullptr if the record is not a Level 3
+    * product
+    */
+   static std::shared_ptr<const OverlayGeometry>
+   Get(const std::shared_ptr<types::RadarProductRecord>& record);
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace map
+} // namespace qt
+} // namespace scwx
@@ -1,5 +1,6 @@
 #include <scwx/qt/map/overlay_layer.hpp>
 #include <scwx/qt/gl/draw/geo_icons.hpp>
+#include <scwx/qt/gl/draw/geo_lines.hpp>
 #include <scwx/qt/gl/draw/icons.hpp>
 #include <scwx/qt/gl/draw/rectangle.hpp>
 #include <scwx/qt/manager/font_manager.hpp>
@@ -43,6 +44,7 @@ public:
        activeBoxOuter_ {std::make_shared<gl::draw::Rectangle>(context)},
        activeBoxInner_ {std::make_shared<gl::draw::Rectangle>(context)},
        geoIcons_ {std::make_shared<gl::draw::GeoIcons>(context)},
+       geoLines_ {std::make_shared<gl::draw::GeoLines>(context)},
        icons_ {std::make_shared<gl::draw::Icons>(context)}
    {
       auto& generalSettings = settings::GeneralSettings::Instance();
@@ -103,8 +105,12 @@ public:
    std::shared_ptr<gl::draw::Rectangle> activeBoxOuter_;
    std::shared_ptr<gl::draw::Rectangle> activeBoxInner_;
    std::shared_ptr<gl::draw::GeoIcons>  geoIcons_;
+   std::shared_ptr<gl::draw::GeoLines>  geoLines_;
    std::shared_ptr<gl::draw::Icons>     icons_;
 
+   std::shared_ptr<gl::draw::GeoLineDrawItem> crossSectionBorder_ {};
+   std::shared_ptr<gl::draw::GeoLineDrawItem> crossSectionLine_ {};
+
    const std::string& locationIconName_ {
       types::GetTextureName(types::ImageTexture::Crosshairs24)};
    std::shared_ptr<gl::draw::GeoIconDrawItem> locationIcon_ {};
@@ -147,6 +153,7 @@ OverlayLayer::OverlayLayer(std::shared_ptr<MapContext> context) :
 {
    AddDrawItem(p->activeBoxOuter_);
    AddDrawItem(p->activeBoxInner_);
+   AddDrawItem(p->geoLines_);
    AddDrawItem(p->geoIcons_);
    AddDrawItem(p->icons_);
 
@@ -174,6 +181,23 @@ void OverlayLayer::Initialize()
    p->currentPosition_ = p->positionManager_->position();
    auto coordinate     = p->currentPosition_.coordinate();
 
+   // Geo Lines
+   p->geoLines_->StartLines();
+
+   p->crossSectionBorder_ = p->geoLines_->AddLine();
+   p->geoLines_->SetLineModulate(p->crossSectionBorder_,
+                                 boost::gil::rgba8_pixel_t {0, 0, 0, 255});
+   p->geoLines_->SetLineWidth(p->crossSectionBorder_, 5.0f);
+   p->geoLines_->SetLineVisible(p->crossSectionBorder_, false);
+
+   p->crossSectionLine_ = p->geoLines_->AddLine();
+   p->geoLines_->SetLineModulate(
+      p->crossSectionLine_, boost::gil::rgba8_pixel_t {255, 255, 255, 255});
+   p->geoLines_->SetLineWidth(p->crossSectionLine_, 3.0f);
+   p->geoLines_->SetLineVisible(p->crossSectionLine_, false);
+
+   p->geoLines_->FinishLines();
+
    // Geo Icons
    p->geoIcons_->StartIconSheets();
    p->geoIcons_->AddIconSheet(p->cursorIconName_);
@@ -339,6 +363,22 @@ void OverlayLayer::Render(const QMapLibre::CustomLayerRenderParameters& params)
          p->cursorIcon_, mouseCoordinate.latitude_, mouseCoordinate.longitude_);
    }
 
+   // Cross-Section Line
+   auto crossSectionLine = context()->cross_section_line();
+   for (auto& di : {p->crossSectionBorder_, p->crossSectionLine_})
+   {
+      p->geoLines_->SetLineVisible(di, crossSectionLine.has_value());
+      if (crossSectionLine.has_value())
+      {
+         p->geoLines_->SetLineLocation(
+            di,
+            static_cast<float>(crossSectionLine->first.latitude_),
+            static_cast<float>(crossSectionLine->first.longitude_),
+            static_cast<float>(crossSectionLine->second.latitude_),
+            static_cast<float>(crossSectionLine->second.longitude_));
+      }
+   }
+
    // Location Icon
    p->geoIcons_->SetIconVisible(p->locationIcon_,
                                 p->currentPosition_.isValid() &&
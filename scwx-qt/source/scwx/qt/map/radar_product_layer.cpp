@@ -1,11 +1,15 @@
 #include <scwx/qt/map/radar_product_layer.hpp>
 #include <scwx/qt/gl/shader_program.hpp>
+#include <scwx/qt/gl/upload_context.hpp>
 #include <scwx/qt/util/maplibre.hpp>
+#include <scwx/qt/util/polar_sweep.hpp>
 #include <scwx/qt/util/tooltip.hpp>
 #include <scwx/qt/view/radar_product_view.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/metrics.hpp>
 
 #include <execution>
+#include <future>
 
 #if defined(_MSC_VER)
 #   pragma warning(push, 0)
@@ -34,6 +38,32 @@ namespace map
 static const std::string logPrefix_ = "scwx::qt::map::radar_product_layer";
 static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 
+// Lower bound of the length of a degree of latitude, such that the polar sweep
+// quad covers the full range of the sweep
+static constexpr double kMetersPerDegree_ = 110'000.0;
+static constexpr double kMaxLatitude_     = 85.0;
+
+// Time the upload thread waits for a sweep upload to complete
+static constexpr GLuint64 kUploadTimeout_ = 1'000'000'000u; // 1 second
+
+// Sweep buffers written by the upload thread (or the render thread, if an
+// upload context is not available), and the layout of the buffered data
+struct SweepUpload
+{
+   std::array<GLuint, 3> vbo_ {};
+   GLsync                fence_ {nullptr};
+   GLsizeiptr            numVertices_ {0};
+   GLenum                dataType_ {GL_UNSIGNED_BYTE};
+   GLenum                cfpType_ {GL_UNSIGNED_BYTE};
+   bool                  cfpPresent_ {false};
+   bool                  polar_ {false};
+   std::uint64_t         uploadTime_ {0};
+};
+
+static void BufferSweep(gl::OpenGLFunctions&     gl,
+                        view::RadarProductView& radarProductView,
+                        SweepUpload&             upload);
+
 class RadarProductLayerImpl
 {
 public:
@@ -45,16 +75,32 @@ public:
        uDataMomentScaleLocation_(GL_INVALID_INDEX),
        uCFPEnabledLocation_(GL_INVALID_INDEX),
        vbo_ {GL_INVALID_INDEX},
+       uploadVbo_ {GL_INVALID_INDEX},
        vao_ {GL_INVALID_INDEX},
        texture_ {GL_INVALID_INDEX},
+       polarShaderProgram_(nullptr),
+       polarUniforms_ {},
+       polarVbo_ {GL_INVALID_INDEX},
+       polarVao_ {GL_INVALID_INDEX},
+       sweepTexture_ {GL_INVALID_INDEX},
+       azimuthTexture_ {GL_INVALID_INDEX},
+       siteFrame_ {},
+       gateSize_ {0.0f},
        numVertices_ {0},
+       dataMomentOffset_ {0},
+       dataMomentScale_ {0.0f},
        cfpEnabled_ {false},
+       polar_ {false},
        colorTableNeedsUpdate_ {false},
        sweepNeedsUpdate_ {false}
    {
    }
    ~RadarProductLayerImpl() = default;
 
+   void BindSweepBuffers(gl::OpenGLFunctions& gl, const SweepUpload& upload);
+   scwx::util::metrics::Histogram&
+   GpuUploadHistogram(const std::string& productName);
+
    std::shared_ptr<gl::ShaderProgram> shaderProgram_;
 
    GLint                 uMVPMatrixLocation_;
@@ -63,15 +109,60 @@ public:
    GLint                 uDataMomentScaleLocation_;
    GLint                 uCFPEnabledLocation_;
    std::array<GLuint, 3> vbo_;
+   std::array<GLuint, 3> uploadVbo_;
    GLuint                vao_;
    GLuint                texture_;
 
+   // Sweeps are buffered into the upload buffers on the upload thread while the
+   // current sweep continues to be rendered. Once the upload fence has been
+   // signaled, the upload buffers are swapped into the render path.
+   std::shared_ptr<gl::UploadContext> uploadContext_ {};
+   std::shared_ptr<SweepUpload>       sweepUpload_ {};
+   std::future<bool>                  sweepUploadFuture_ {};
+
+   // Polar sweep rendering, used when the radar product view provides a
+   // polar sweep. The sweep is stored in a texture, and sampled by azimuth
+   // and range in the fragment shader.
+   struct PolarUniforms
+   {
+      GLint uMVPMatrix_ {-1};
+      GLint uMapScreenCoord_ {-1};
+      GLint uDataMomentOffset_ {-1};
+      GLint uDataMomentScale_ {-1};
+      GLint uCFPEnabled_ {-1};
+      GLint uTexture_ {-1};
+      GLint uSweep_ {-1};
+      GLint uAzimuths_ {-1};
+      GLint uSiteOrigin_ {-1};
+      GLint uSiteEnu_ {-1};
+      GLint uSiteRadii_ {-1};
+      GLint uGateSize_ {-1};
+   };
+
+   std::shared_ptr<gl::ShaderProgram> polarShaderProgram_;
+   PolarUniforms                      polarUniforms_;
+   GLuint                             polarVbo_;
+   GLuint                             polarVao_;
+   GLuint                             sweepTexture_;
+   GLuint                             azimuthTexture_;
+   util::PolarSiteFrame               siteFrame_;
+   float                              gateSize_;
+
    GLsizeiptr numVertices_;
 
+   GLuint  dataMomentOffset_;
+   GLfloat dataMomentScale_;
+
    bool cfpEnabled_;
+   bool polar_;
 
    bool colorTableNeedsUpdate_;
    bool sweepNeedsUpdate_;
+
+   // GPU upload histogram of the current radar product, looked up once per
+   // product as it is updated with every sweep
+   std::string                     gpuUploadProductName_ {};
+   scwx::util::metrics::Histogram* gpuUploadHistogram_ {nullptr};
 };
 
 RadarProductLayer::RadarProductLayer(std::shared_ptr<MapContext> context) :
@@ -134,13 +225,62 @@ void RadarProductLayer::Initialize()
       logger_->warn("Could not find uCFPEnabled");
    }
 
+   // Load polar radar shader
+   p->polarShaderProgram_ = context()->GetShaderProgram(
+      ":/gl/radar_polar.vert", ":/gl/radar_polar.frag");
+
+   auto GetUniformLocation = [&](const char* name)
+   {
+      GLint location =
+         gl.glGetUniformLocation(p->polarShaderProgram_->id(), name);
+      if (location == -1)
+      {
+         logger_->warn("Could not find {} (polar)", name);
+      }
+      return location;
+   };
+
+   RadarProductLayerImpl::PolarUniforms& uniforms = p->polarUniforms_;
+   uniforms.uMVPMatrix_        = GetUniformLocation("uMVPMatrix");
+   uniforms.uMapScreenCoord_   = GetUniformLocation("uMapScreenCoord");
+   uniforms.uDataMomentOffset_ = GetUniformLocation("uDataMomentOffset");
+   uniforms.uDataMomentScale_  = GetUniformLocation("uDataMomentScale");
+   uniforms.uCFPEnabled_       = GetUniformLocation("uCFPEnabled");
+   uniforms.uTexture_          = GetUniformLocation("uTexture");
+   uniforms.uSweep_            = GetUniformLocation("uSweep");
+   uniforms.uAzimuths_         = GetUniformLocation("uAzimuths");
+   uniforms.uSiteOrigin_       = GetUniformLocation("uSiteOrigin");
+   uniforms.uSiteEnu_          = GetUniformLocation("uSiteEnu");
+   uniforms.uSiteRadii_        = GetUniformLocation("uSiteRadii");
+   uniforms.uGateSize_         = GetUniformLocation("uGateSize");
+
    p->shaderProgram_->Use();
 
    // Generate a vertex array object
    gl.glGenVertexArrays(1, &p->vao_);
+   gl.glGenVertexArrays(1, &p->polarVao_);
 
    // Generate vertex buffer objects
    gl.glGenBuffers(3, p->vbo_.data());
+   gl.glGenBuffers(3, p->uploadVbo_.data());
+   gl.glGenBuffers(1, &p->polarVbo_);
+
+   // Generate polar sweep textures
+   gl.glGenTextures(1, &p->sweepTexture_);
+   gl.glGenTextures(1, &p->azimuthTexture_);
+
+   // Sweeps are uploaded on the upload thread if a shared context is available
+   p->uploadContext_ = gl::UploadContext::Instance();
+   connect(p->uploadContext_.get(),
+           &gl::UploadContext::TaskCompleted,
+           this,
+           [this]()
+           {
+              if (p->sweepUploadFuture_.valid())
+              {
+                 Q_EMIT NeedsRendering();
+              }
+           });
 
    // Update radar sweep
    p->sweepNeedsUpdate_ = true;
@@ -159,9 +299,13 @@ void RadarProductLayer::UpdateSweep()
 {
    logger_->debug("UpdateSweep()");
 
-   gl::OpenGLFunctions& gl = context()->gl();
+   if (p->sweepUploadFuture_.valid())
+   {
+      // A sweep upload is in progress, update once it has completed
+      return;
+   }
 
-   boost::timer::cpu_timer timer;
+   gl::OpenGLFunctions& gl = context()->gl();
 
    std::shared_ptr<view::RadarProductView> radarProductView =
       context()->radar_product_view();
@@ -176,77 +320,152 @@ void RadarProductLayer::UpdateSweep()
 
    p->sweepNeedsUpdate_ = false;
 
-   const std::vector<float>& vertices = radarProductView->vertices();
+   std::shared_ptr<const util::PolarSweep> polarSweep =
+      radarProductView->polar_sweep();
+   if (polarSweep != nullptr)
+   {
+      UpdatePolarSweep(*polarSweep);
+      return;
+   }
 
-   // Bind a vertex array object
-   gl.glBindVertexArray(p->vao_);
+   if (p->uploadContext_ != nullptr && p->uploadContext_->IsValid())
+   {
+      sweepLock.unlock();
 
-   // Buffer vertices
-   gl.glBindBuffer(GL_ARRAY_BUFFER, p->vbo_[0]);
-   timer.start();
-   gl.glBufferData(GL_ARRAY_BUFFER,
-                   vertices.size() * sizeof(GLfloat),
-                   vertices.data(),
-                   GL_STATIC_DRAW);
-   timer.stop();
-   logger_->debug("Vertices buffered in {}", timer.format(6, "%ws"));
+      auto upload  = std::make_shared<SweepUpload>();
+      upload->vbo_ = p->uploadVbo_;
 
-   gl.glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, static_cast<void*>(0));
-   gl.glEnableVertexAttribArray(0);
+      p->sweepUpload_       = upload;
+      p->sweepUploadFuture_ = p->uploadContext_->Post(
+         [upload, radarProductView](gl::OpenGLFunctions& gl)
+         {
+            std::unique_lock sweepLock(radarProductView->sweep_mutex());
 
-   // Buffer data moments
-   const GLvoid* data;
-   GLsizeiptr    dataSize;
-   size_t        componentSize;
-   GLenum        type;
+            if (radarProductView->polar_sweep() != nullptr)
+            {
+               // The sweep was replaced by a polar sweep after the upload was
+               // posted
+               upload->polar_ = true;
+               return;
+            }
+
+            BufferSweep(gl, *radarProductView, *upload);
+
+            sweepLock.unlock();
+
+            // Wait on the upload thread, such that the fence has normally been
+            // signaled by the time the render thread tests it
+            upload->fence_ = gl.glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            gl.glClientWaitSync(
+               upload->fence_, GL_SYNC_FLUSH_COMMANDS_BIT, kUploadTimeout_);
+         });
+
+      return;
+   }
+
+   // No upload context is available, upload on the render thread
+   SweepUpload upload {};
+   upload.vbo_ = p->vbo_;
 
-   std::tie(data, dataSize, componentSize) = radarProductView->GetMomentData();
+   BufferSweep(gl, *radarProductView, upload);
+   p->BindSweepBuffers(gl, upload);
+
+   p->GpuUploadHistogram(radarProductView->GetRadarProductName())
+      .Record(upload.uploadTime_);
+}
 
-   if (componentSize == 1)
+void RadarProductLayer::CompleteSweepUpload()
+{
+   if (p->sweepUploadFuture_.wait_for(std::chrono::seconds(0)) !=
+       std::future_status::ready)
    {
-      type = GL_UNSIGNED_BYTE;
+      return;
    }
-   else
+
+   gl::OpenGLFunctions& gl = context()->gl();
+
+   std::shared_ptr<SweepUpload> upload = p->sweepUpload_;
+
+   if (upload->fence_ != nullptr)
    {
-      type = GL_UNSIGNED_SHORT;
+      GLint status = GL_UNSIGNALED;
+      gl.glGetSynciv(upload->fence_, GL_SYNC_STATUS, 1, nullptr, &status);
+
+      if (status != GL_SIGNALED)
+      {
+         // Test the fence again on the next frame
+         Q_EMIT NeedsRendering();
+         return;
+      }
+
+      gl.glDeleteSync(upload->fence_);
+      upload->fence_ = nullptr;
    }
 
-   gl.glBindBuffer(GL_ARRAY_BUFFER, p->vbo_[1]);
-   timer.start();
-   gl.glBufferData(GL_ARRAY_BUFFER, dataSize, data, GL_STATIC_DRAW);
-   timer.stop();
-   logger_->debug("Data moments buffered in {}", timer.format(6, "%ws"));
+   const bool uploaded = p->sweepUploadFuture_.get();
 
-   gl.glVertexAttribIPointer(1, 1, type, 0, static_cast<void*>(0));
-   gl.glEnableVertexAttribArray(1);
+   p->sweepUploadFuture_ = {};
+   p->sweepUpload_.reset();
 
-   // Buffer CFP data
-   const GLvoid* cfpData;
-   GLsizeiptr    cfpDataSize;
-   size_t        cfpComponentSize;
-   GLenum        cfpType;
+   if (!uploaded)
+   {
+      logger_->warn("Sweep upload failed, uploading on the render thread");
+      p->uploadContext_.reset();
+   }
+
+   if (!uploaded || upload->polar_)
+   {
+      p->sweepNeedsUpdate_ = true;
+      return;
+   }
 
-   std::tie(cfpData, cfpDataSize, cfpComponentSize) =
-      radarProductView->GetCfpMomentData();
+   // Binding the upload buffers in this context makes their contents visible
+   std::swap(p->vbo_, p->uploadVbo_);
+   p->BindSweepBuffers(gl, *upload);
 
-   if (cfpData != nullptr)
+   std::shared_ptr<view::RadarProductView> radarProductView =
+      context()->radar_product_view();
+
+   p->GpuUploadHistogram(radarProductView->GetRadarProductName())
+      .Record(upload->uploadTime_);
+}
+
+scwx::util::metrics::Histogram&
+RadarProductLayerImpl::GpuUploadHistogram(const std::string& productName)
+{
+   if (gpuUploadHistogram_ == nullptr || productName != gpuUploadProductName_)
    {
-      if (cfpComponentSize == 1)
-      {
-         cfpType = GL_UNSIGNED_BYTE;
-      }
-      else
-      {
-         cfpType = GL_UNSIGNED_SHORT;
-      }
+      gpuUploadProductName_ = productName;
+      gpuUploadHistogram_   = &scwx::util::metrics::Registry::Instance()
+                                  .GetHistogram(scwx::util::metrics::MetricName(
+                                     "gpu_upload", productName));
+   }
+
+   return *gpuUploadHistogram_;
+}
+
+void RadarProductLayerImpl::BindSweepBuffers(gl::OpenGLFunctions& gl,
+                                             const SweepUpload&   upload)
+{
+   // Bind a vertex array object
+   gl.glBindVertexArray(vao_);
+
+   // Vertices
+   gl.glBindBuffer(GL_ARRAY_BUFFER, upload.vbo_[0]);
+   gl.glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, static_cast<void*>(0));
+   gl.glEnableVertexAttribArray(0);
 
-      gl.glBindBuffer(GL_ARRAY_BUFFER, p->vbo_[2]);
-      timer.start();
-      gl.glBufferData(GL_ARRAY_BUFFER, cfpDataSize, cfpData, GL_STATIC_DRAW);
-      timer.stop();
-      logger_->debug("CFP moments buffered in {}", timer.format(6, "%ws"));
+   // Data moments
+   gl.glBindBuffer(GL_ARRAY_BUFFER, upload.vbo_[1]);
+   gl.glVertexAttribIPointer(1, 1, upload.dataType_, 0, static_cast<void*>(0));
+   gl.glEnableVertexAttribArray(1);
 
-      gl.glVertexAttribIPointer(2, 1, cfpType, 0, static_cast<void*>(0));
+   // CFP data
+   if (upload.cfpPresent_)
+   {
+      gl.glBindBuffer(GL_ARRAY_BUFFER, upload.vbo_[2]);
+      gl.glVertexAttribIPointer(
+         2, 1, upload.cfpType_, 0, static_cast<void*>(0));
       gl.glEnableVertexAttribArray(2);
    }
    else
@@ -254,6 +473,155 @@ void RadarProductLayer::UpdateSweep()
       gl.glDisableVertexAttribArray(2);
    }
 
+   numVertices_ = upload.numVertices_;
+   polar_       = false;
+}
+
+static void BufferSweep(gl::OpenGLFunctions&     gl,
+                        view::RadarProductView& radarProductView,
+                        SweepUpload&             upload)
+{
+   boost::timer::cpu_timer timer;
+
+   const std::vector<float>& vertices = radarProductView.vertices();
+
+   // Buffer vertices
+   gl.glBindBuffer(GL_ARRAY_BUFFER, upload.vbo_[0]);
+   gl.glBufferData(GL_ARRAY_BUFFER,
+                   vertices.size() * sizeof(GLfloat),
+                   vertices.data(),
+                   GL_STATIC_DRAW);
+
+   // Buffer data moments
+   auto [data, dataSize, componentSize] = radarProductView.GetMomentData();
+
+   upload.dataType_ =
+      (componentSize == 1) ? GL_UNSIGNED_BYTE : GL_UNSIGNED_SHORT;
+
+   gl.glBindBuffer(GL_ARRAY_BUFFER, upload.vbo_[1]);
+   gl.glBufferData(GL_ARRAY_BUFFER,
+                   static_cast<GLsizeiptr>(dataSize),
+                   data,
+                   GL_STATIC_DRAW);
+
+   // Buffer CFP data
+   auto [cfpData, cfpDataSize, cfpComponentSize] =
+      radarProductView.GetCfpMomentData();
+
+   upload.cfpPresent_ = (cfpData != nullptr);
+
+   if (upload.cfpPresent_)
+   {
+      upload.cfpType_ =
+         (cfpComponentSize == 1) ? GL_UNSIGNED_BYTE : GL_UNSIGNED_SHORT;
+
+      gl.glBindBuffer(GL_ARRAY_BUFFER, upload.vbo_[2]);
+      gl.glBufferData(GL_ARRAY_BUFFER,
+                      static_cast<GLsizeiptr>(cfpDataSize),
+                      cfpData,
+                      GL_STATIC_DRAW);
+   }
+
+   gl.glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+   timer.stop();
+   logger_->debug("Sweep buffered in {}", timer.format(6, "%ws"));
+
+   upload.numVertices_ = static_cast<GLsizeiptr>(vertices.size() / 2);
+   upload.uploadTime_  = static_cast<std::uint64_t>(timer.elapsed().wall);
+}
+
+void RadarProductLayer::UpdatePolarSweep(const util::PolarSweep& sweep)
+{
+   gl::OpenGLFunctions& gl = context()->gl();
+
+   boost::timer::cpu_timer timer;
+
+   std::shared_ptr<view::RadarProductView> radarProductView =
+      context()->radar_product_view();
+   std::shared_ptr<config::RadarSite> radarSite =
+      radarProductView->radar_product_manager()->radar_site();
+
+   const double latitude  = radarSite->latitude();
+   const double longitude = radarSite->longitude();
+
+   p->polar_     = true;
+   p->siteFrame_ = util::PolarSiteFrame::Create(latitude, longitude);
+   p->gateSize_  = sweep.gateSize_;
+
+   // Buffer a quad covering the range of the sweep
+   const double range = static_cast<double>(sweep.gateCount_) * sweep.gateSize_;
+   const double latitudeDelta = range / kMetersPerDegree_;
+   const double maxLatitude =
+      std::min(std::abs(latitude) + latitudeDelta, kMaxLatitude_);
+   const double longitudeDelta =
+      latitudeDelta / std::cos(glm::radians(maxLatitude));
+
+   const float minLat = static_cast<float>(latitude - latitudeDelta);
+   const float maxLat = static_cast<float>(latitude + latitudeDelta);
+   const float minLon = static_cast<float>(longitude - longitudeDelta);
+   const float maxLon = static_cast<float>(longitude + longitudeDelta);
+
+   const std::array<GLfloat, 12> vertices {minLat, minLon, maxLat, minLon, //
+                                           minLat, maxLon, minLat, maxLon, //
+                                           maxLat, minLon, maxLat, maxLon};
+
+   timer.start();
+
+   gl.glBindVertexArray(p->polarVao_);
+   gl.glBindBuffer(GL_ARRAY_BUFFER, p->polarVbo_);
+   gl.glBufferData(GL_ARRAY_BUFFER,
+                   vertices.size() * sizeof(GLfloat),
+                   vertices.data(),
+                   GL_STATIC_DRAW);
+
+   gl.glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, static_cast<void*>(0));
+   gl.glEnableVertexAttribArray(0);
+
+   // Buffer the sweep, one radial per row
+   const bool cfpPresent = (sweep.componentCount_ > 1);
+
+   gl.glActiveTexture(GL_TEXTURE1);
+   gl.glBindTexture(GL_TEXTURE_2D, p->sweepTexture_);
+   gl.glPixelStorei(GL_UNPACK_ALIGNMENT, 2);
+   gl.glTexImage2D(GL_TEXTURE_2D,
+                   0,
+                   cfpPresent ? GL_RG16UI : GL_R16UI,
+                   static_cast<GLsizei>(sweep.gateCount_),
+                   static_cast<GLsizei>(sweep.radialCount_),
+                   0,
+                   cfpPresent ? GL_RG_INTEGER : GL_RED_INTEGER,
+                   GL_UNSIGNED_SHORT,
+                   sweep.data_.data());
+   gl.glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+   gl.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+   gl.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+   gl.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+   gl.glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+   // Buffer the start azimuth of each radial
+   gl.glActiveTexture(GL_TEXTURE2);
+   gl.glBindTexture(GL_TEXTURE_1D, p->azimuthTexture_);
+   gl.glTexImage1D(GL_TEXTURE_1D,
+                   0,
+                   GL_R32F,
+                   static_cast<GLsizei>(sweep.azimuths_.size()),
+                   0,
+                   GL_RED,
+                   GL_FLOAT,
+                   sweep.azimuths_.data());
+   gl.glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+   gl.glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+   gl.glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+
+   gl.glActiveTexture(GL_TEXTURE0);
+
+   timer.stop();
+   logger_->debug("Polar sweep buffered in {}", timer.format(6, "%ws"));
+
+   p->GpuUploadHistogram(radarProductView->GetRadarProductName())
+      .Record(static_cast<std::uint64_t>(timer.elapsed().wall));
+
    p->numVertices_ = vertices.size() / 2;
 }
 
@@ -262,8 +630,6 @@ void RadarProductLayer::Render(
 {
    gl::OpenGLFunctions& gl = context()->gl();
 
-   p->shaderProgram_->Use();
-
    // Set OpenGL blend mode for transparency
    gl.glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
@@ -272,6 +638,11 @@ void RadarProductLayer::Render(
       UpdateColorTable();
    }
 
+   if (p->sweepUploadFuture_.valid())
+   {
+      CompleteSweepUpload();
+   }
+
    if (p->sweepNeedsUpdate_)
    {
       UpdateSweep();
@@ -288,14 +659,25 @@ void RadarProductLayer::Render(
                             glm::radians<float>(params.bearing),
                             glm::vec3(0.0f, 0.0f, 1.0f));
 
-   gl.glUniform2fv(p->uMapScreenCoordLocation_,
-                   1,
-                   glm::value_ptr(util::maplibre::LatLongToScreenCoordinate(
-                      {params.latitude, params.longitude})));
+   const glm::vec2 mapScreenCoord = util::maplibre::LatLongToScreenCoordinate(
+      {params.latitude, params.longitude});
+
+   if (p->polar_)
+   {
+      RenderPolarSweep(uMVPMatrix, mapScreenCoord);
+      return;
+   }
+
+   p->shaderProgram_->Use();
+
+   gl.glUniform2fv(
+      p->uMapScreenCoordLocation_, 1, glm::value_ptr(mapScreenCoord));
 
    gl.glUniformMatrix4fv(
       p->uMVPMatrixLocation_, 1, GL_FALSE, glm::value_ptr(uMVPMatrix));
 
+   gl.glUniform1ui(p->uDataMomentOffsetLocation_, p->dataMomentOffset_);
+   gl.glUniform1f(p->uDataMomentScaleLocation_, p->dataMomentScale_);
    gl.glUniform1i(p->uCFPEnabledLocation_, p->cfpEnabled_ ? 1 : 0);
 
    gl.glActiveTexture(GL_TEXTURE0);
@@ -306,14 +688,82 @@ void RadarProductLayer::Render(
    SCWX_GL_CHECK_ERROR();
 }
 
+void RadarProductLayer::RenderPolarSweep(const glm::mat4& uMVPMatrix,
+                                         const glm::vec2& mapScreenCoord)
+{
+   gl::OpenGLFunctions&                        gl       = context()->gl();
+   const RadarProductLayerImpl::PolarUniforms& uniforms = p->polarUniforms_;
+   const util::PolarSiteFrame&                 frame    = p->siteFrame_;
+
+   p->polarShaderProgram_->Use();
+
+   gl.glUniform2fv(
+      uniforms.uMapScreenCoord_, 1, glm::value_ptr(mapScreenCoord));
+   gl.glUniformMatrix4fv(
+      uniforms.uMVPMatrix_, 1, GL_FALSE, glm::value_ptr(uMVPMatrix));
+
+   gl.glUniform1ui(uniforms.uDataMomentOffset_, p->dataMomentOffset_);
+   gl.glUniform1f(uniforms.uDataMomentScale_, p->dataMomentScale_);
+   gl.glUniform1i(uniforms.uCFPEnabled_, p->cfpEnabled_ ? 1 : 0);
+
+   // The site frame is row-major
+   gl.glUniform3fv(uniforms.uSiteOrigin_, 1, frame.origin_.data());
+   gl.glUniformMatrix3fv(uniforms.uSiteEnu_, 1, GL_TRUE, frame.enu_.data());
+   gl.glUniform2f(uniforms.uSiteRadii_,
+                  frame.meridionalRadius_,
+                  frame.primeVerticalRadius_);
+   gl.glUniform1f(uniforms.uGateSize_, p->gateSize_);
+
+   gl.glUniform1i(uniforms.uTexture_, 0);
+   gl.glUniform1i(uniforms.uSweep_, 1);
+   gl.glUniform1i(uniforms.uAzimuths_, 2);
+
+   gl.glActiveTexture(GL_TEXTURE2);
+   gl.glBindTexture(GL_TEXTURE_1D, p->azimuthTexture_);
+   gl.glActiveTexture(GL_TEXTURE1);
+   gl.glBindTexture(GL_TEXTURE_2D, p->sweepTexture_);
+   gl.glActiveTexture(GL_TEXTURE0);
+   gl.glBindTexture(GL_TEXTURE_1D, p->texture_);
+
+   gl.glBindVertexArray(p->polarVao_);
+   gl.glDrawArrays(GL_TRIANGLES, 0, p->numVertices_);
+
+   SCWX_GL_CHECK_ERROR();
+}
+
 void RadarProductLayer::Deinitialize()
 {
    logger_->debug("Deinitialize()");
 
    gl::OpenGLFunctions& gl = context()->gl();
 
+   // Wait for a sweep upload in progress before deleting its buffers
+   if (p->sweepUploadFuture_.valid())
+   {
+      p->sweepUploadFuture_.wait();
+
+      if (p->sweepUpload_->fence_ != nullptr)
+      {
+         gl.glDeleteSync(p->sweepUpload_->fence_);
+      }
+
+      p->sweepUploadFuture_ = {};
+      p->sweepUpload_.reset();
+   }
+
+   if (p->uploadContext_ != nullptr)
+   {
+      disconnect(p->uploadContext_.get(), nullptr, this, nullptr);
+      p->uploadContext_.reset();
+   }
+
    gl.glDeleteVertexArrays(1, &p->vao_);
    gl.glDeleteBuffers(3, p->vbo_.data());
+   gl.glDeleteBuffers(3, p->uploadVbo_.data());
+   gl.glDeleteVertexArrays(1, &p->polarVao_);
+   gl.glDeleteBuffers(1, &p->polarVbo_);
+   gl.glDeleteTextures(1, &p->sweepTexture_);
+   gl.glDeleteTextures(1, &p->azimuthTexture_);
 
    p->uMVPMatrixLocation_        = GL_INVALID_INDEX;
    p->uMapScreenCoordLocation_   = GL_INVALID_INDEX;
@@ -322,7 +772,13 @@ void RadarProductLayer::Deinitialize()
    p->uCFPEnabledLocation_       = GL_INVALID_INDEX;
    p->vao_                       = GL_INVALID_INDEX;
    p->vbo_                       = {GL_INVALID_INDEX};
+   p->uploadVbo_                 = {GL_INVALID_INDEX};
    p->texture_                   = GL_INVALID_INDEX;
+   p->polarUniforms_             = {};
+   p->polarVao_                  = GL_INVALID_INDEX;
+   p->polarVbo_                  = GL_INVALID_INDEX;
+   p->sweepTexture_              = GL_INVALID_INDEX;
+   p->azimuthTexture_            = GL_INVALID_INDEX;
 }
 
 bool RadarProductLayer::RunMousePicking(
@@ -480,8 +936,10 @@ void RadarProductLayer::UpdateColorTable()
                    colorTable.data());
    gl.glGenerateMipmap(GL_TEXTURE_1D);
 
-   gl.glUniform1ui(p->uDataMomentOffsetLocation_, rangeMin);
-   gl.glUniform1f(p->uDataMomentScaleLocation_, scale);
+   // Uniforms are set when rendering, as the shader program depends on the
+   // sweep type
+   p->dataMomentOffset_ = rangeMin;
+   p->dataMomentScale_  = scale;
 }
 
 } // namespace map
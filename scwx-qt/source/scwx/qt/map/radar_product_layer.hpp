@@ -1,6 +1,7 @@
 #pragma once
 
 #include <scwx/qt/map/generic_layer.hpp>
+#include <scwx/qt/util/polar_sweep.hpp>
 
 namespace scwx
 {
@@ -30,7 +31,11 @@ public:
                    std::shared_ptr<types::EventHandler>& eventHandler) override;
 
 private:
+   void CompleteSweepUpload();
+   void RenderPolarSweep(const glm::mat4& uMVPMatrix,
+                         const glm::vec2& mapScreenCoord);
    void UpdateColorTable();
+   void UpdatePolarSweep(const util::PolarSweep& sweep);
    void UpdateSweep();
 
 private:
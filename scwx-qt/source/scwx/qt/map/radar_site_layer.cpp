@@ -1,6 +1,7 @@
 #include <scwx/qt/map/radar_site_layer.hpp>
 #include <scwx/qt/config/radar_site.hpp>
 #include <scwx/qt/settings/text_settings.hpp>
+#include <scwx/qt/util/geo_grid_index.hpp>
 #include <scwx/qt/util/maplibre.hpp>
 #include <scwx/qt/util/tooltip.hpp>
 #include <scwx/common/geographic.hpp>
@@ -19,6 +20,10 @@ namespace map
 static const std::string logPrefix_ = "scwx::qt::map::radar_site_layer";
 static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 
+// Margin allowing radar site buttons centered just outside of the viewport to
+// be partially drawn
+static constexpr float kViewportMarginPixels_ = 32.0f;
+
 class RadarSiteLayer::Impl
 {
 public:
@@ -26,11 +31,12 @@ public:
    ~Impl() = default;
 
    void RenderRadarSite(const QMapLibre::CustomLayerRenderParameters& params,
-                        std::shared_ptr<config::RadarSite>& radarSite);
+                        const std::shared_ptr<config::RadarSite>& radarSite);
 
    RadarSiteLayer* self_;
 
-   std::vector<std::shared_ptr<config::RadarSite>> radarSites_ {};
+   std::vector<std::shared_ptr<config::RadarSite>>        radarSites_ {};
+   util::GeoGridIndex<std::shared_ptr<config::RadarSite>> radarSiteIndex_ {};
 
    glm::vec2 mapScreenCoordLocation_ {};
    float     mapScale_ {1.0f};
@@ -54,6 +60,13 @@ void RadarSiteLayer::Initialize()
    logger_->debug("Initialize()");
 
    p->radarSites_ = config::RadarSite::GetAll();
+
+   p->radarSiteIndex_.Clear();
+   for (auto& radarSite : p->radarSites_)
+   {
+      p->radarSiteIndex_.Insert(
+         radarSite->latitude(), radarSite->longitude(), radarSite);
+   }
 }
 
 void RadarSiteLayer::Render(
@@ -78,10 +91,11 @@ void RadarSiteLayer::Render(
    // Radar site ImGui windows shouldn't have padding
    ImGui::PushStyleVar(ImGuiStyleVar_WindowPadding, ImVec2 {0.0f, 0.0f});
 
-   for (auto& radarSite : p->radarSites_)
-   {
-      p->RenderRadarSite(params, radarSite);
-   }
+   // Only create windows for radar sites within the viewport
+   p->radarSiteIndex_.Query(
+      util::maplibre::GetViewportBounds(params, kViewportMarginPixels_),
+      [&](const std::shared_ptr<config::RadarSite>& radarSite)
+      { p->RenderRadarSite(params, radarSite); });
 
    ImGui::PopStyleVar();
 
@@ -90,7 +104,7 @@ void RadarSiteLayer::Render(
 
 void RadarSiteLayer::Impl::RenderRadarSite(
    const QMapLibre::CustomLayerRenderParameters& params,
-   std::shared_ptr<config::RadarSite>&           radarSite)
+   const std::shared_ptr<config::RadarSite>&     radarSite)
 {
    const std::string windowName = fmt::format("radar-site-{}", radarSite->id());
 
@@ -154,6 +168,7 @@ void RadarSiteLayer::Deinitialize()
    logger_->debug("Deinitialize()");
 
    p->radarSites_.clear();
+   p->radarSiteIndex_.Clear();
 }
 
 bool RadarSiteLayer::RunMousePicking(
@@ -10,10 +10,13 @@
 #include <scwx/util/strings.hpp>
 #include <scwx/util/time.hpp>
 
+#include <execution>
 #include <format>
+#include <optional>
 
 #include <QApplication>
 #include <QFontMetrics>
+#include <QTimer>
 
 namespace scwx
 {
@@ -30,12 +33,16 @@ static constexpr int kLastColumn =
    static_cast<int>(AlertModel::Column::Distance);
 static constexpr int kNumColumns = kLastColumn - kFirstColumn + 1;
 
+static constexpr std::chrono::milliseconds kDistanceUpdateInterval_ {250};
+
 class AlertModelImpl
 {
 public:
-   explicit AlertModelImpl();
+   explicit AlertModelImpl(AlertModel* self);
    ~AlertModelImpl() = default;
 
+   void UpdateDistances();
+
    bool                       GetObserved(const types::TextEventKey& key);
    awips::ibw::ThreatCategory GetThreatCategory(const types::TextEventKey& key);
    bool GetTornadoPossible(const types::TextEventKey& key);
@@ -49,6 +56,8 @@ public:
                       GetEndTime(const types::TextEventKey& key);
    static std::string GetEndTimeString(const types::TextEventKey& key);
 
+   AlertModel* self_;
+
    std::shared_ptr<manager::TextEventManager> textEventManager_;
 
    QList<types::TextEventKey> textEventKeys_;
@@ -71,15 +80,21 @@ public:
                       common::Coordinate,
                       types::TextEventHash<types::TextEventKey>>
       centroidMap_;
-   std::unordered_map<types::TextEventKey,
-                      double,
-                      types::TextEventHash<types::TextEventKey>>
-                            distanceMap_;
+
+   // Centroids and distances are stored by row, so distances may be updated
+   // in a single pass
+   std::vector<common::Coordinate> rowCentroids_ {};
+   std::vector<double>             rowDistances_ {};
+
    scwx::common::Coordinate previousPosition_;
+   scwx::common::Coordinate pendingPosition_ {};
+
+   QTimer                                distanceUpdateTimer_ {};
+   std::chrono::steady_clock::time_point lastDistanceUpdate_ {};
 };
 
 AlertModel::AlertModel(QObject* parent) :
-    QAbstractTableModel(parent), p(std::make_unique<AlertModelImpl>())
+    QAbstractTableModel(parent), p(std::make_unique<AlertModelImpl>(this))
 {
 }
 AlertModel::~AlertModel() = default;
@@ -192,14 +207,14 @@ QVariant AlertModel::data(const QModelIndex& index, int role) const
                types::GetDistanceUnitsAbbreviation(distanceUnits);
 
             return QString("%1 %2")
-               .arg(static_cast<uint32_t>(p->distanceMap_.at(textEventKey) *
+               .arg(static_cast<uint32_t>(p->rowDistances_.at(index.row()) *
                                           scwx::common::kKilometersPerMeter *
                                           distanceScale))
                .arg(QString::fromStdString(abbreviation));
          }
          else
          {
-            return p->distanceMap_.at(textEventKey);
+            return p->rowDistances_.at(index.row());
          }
 
       default:
@@ -333,8 +348,6 @@ void AlertModel::HandleAlert(const types::TextEventKey& alertKey,
 {
    logger_->trace("Handle alert: {}", alertKey.ToString());
 
-   double distanceInMeters;
-
    // Get the most recent segment for the event
    auto alertMessages = p->textEventManager_->message_list(alertKey);
    std::shared_ptr<const awips::Segment> alertSegment =
@@ -346,26 +359,28 @@ void AlertModel::HandleAlert(const types::TextEventKey& alertKey,
    p->tornadoPossibleMap_.insert_or_assign(alertKey,
                                            alertSegment->tornadoPossible_);
 
+   std::optional<common::Coordinate> centroid {};
+   double                            distanceInMeters = 0.0;
+
    if (alertSegment->codedLocation_.has_value())
    {
       // Update centroid and distance
-      common::Coordinate centroid =
+      centroid =
          common::GetCentroid(alertSegment->codedLocation_->coordinates());
 
       p->geodesic_.Inverse(p->previousPosition_.latitude_,
                            p->previousPosition_.longitude_,
-                           centroid.latitude_,
-                           centroid.longitude_,
+                           centroid->latitude_,
+                           centroid->longitude_,
                            distanceInMeters);
 
-      p->centroidMap_.insert_or_assign(alertKey, centroid);
-      p->distanceMap_.insert_or_assign(alertKey, distanceInMeters);
+      p->centroidMap_.insert_or_assign(alertKey, *centroid);
    }
    else if (!p->centroidMap_.contains(alertKey))
    {
       // The alert has no location, so provide a default
-      p->centroidMap_.insert_or_assign(alertKey, common::Coordinate {0.0, 0.0});
-      p->distanceMap_.insert_or_assign(alertKey, 0.0);
+      centroid = common::Coordinate {0.0, 0.0};
+      p->centroidMap_.insert_or_assign(alertKey, *centroid);
    }
 
    // Update row
@@ -374,11 +389,20 @@ void AlertModel::HandleAlert(const types::TextEventKey& alertKey,
       int newIndex = p->textEventKeys_.size();
       beginInsertRows(QModelIndex(), newIndex, newIndex);
       p->textEventKeys_.push_back(alertKey);
+      p->rowCentroids_.push_back(centroid.value_or(common::Coordinate {}));
+      p->rowDistances_.push_back(distanceInMeters);
       endInsertRows();
    }
    else
    {
-      const int   row         = p->textEventKeys_.indexOf(alertKey);
+      const int row = p->textEventKeys_.indexOf(alertKey);
+
+      if (centroid.has_value())
+      {
+         p->rowCentroids_[row] = *centroid;
+         p->rowDistances_[row] = distanceInMeters;
+      }
+
       QModelIndex topLeft     = createIndex(row, kFirstColumn);
       QModelIndex bottomRight = createIndex(row, kLastColumn);
 
@@ -390,39 +414,89 @@ void AlertModel::HandleMapUpdate(double latitude, double longitude)
 {
    logger_->trace("Handle map update: {}, {}", latitude, longitude);
 
-   double distanceInMeters;
+   p->pendingPosition_ = {latitude, longitude};
 
-   for (const auto& textEvent : p->textEventKeys_)
+   // Throttle distance updates while the map is moving. If an update is
+   // already scheduled, it will use the pending position.
+   if (p->distanceUpdateTimer_.isActive())
    {
-      auto& centroid = p->centroidMap_.at(textEvent);
+      return;
+   }
 
-      if (centroid != common::Coordinate {0.0, 0.0})
-      {
-         p->geodesic_.Inverse(latitude,
-                              longitude,
-                              centroid.latitude_,
-                              centroid.longitude_,
-                              distanceInMeters);
-         p->distanceMap_.insert_or_assign(textEvent, distanceInMeters);
-      }
+   auto elapsed = std::chrono::steady_clock::now() - p->lastDistanceUpdate_;
+
+   if (elapsed >= kDistanceUpdateInterval_)
+   {
+      p->UpdateDistances();
+   }
+   else
+   {
+      p->distanceUpdateTimer_.start(
+         std::chrono::duration_cast<std::chrono::milliseconds>(
+            kDistanceUpdateInterval_ - elapsed));
    }
+}
 
-   p->previousPosition_ = {latitude, longitude};
+void AlertModelImpl::UpdateDistances()
+{
+   lastDistanceUpdate_ = std::chrono::steady_clock::now();
 
-   QModelIndex topLeft = createIndex(0, static_cast<int>(Column::Distance));
+   if (pendingPosition_ == previousPosition_)
+   {
+      return;
+   }
+
+   const common::Coordinate position = pendingPosition_;
+
+   // Distances are independent, and are computed in parallel
+   std::transform(std::execution::par,
+                  rowCentroids_.cbegin(),
+                  rowCentroids_.cend(),
+                  rowDistances_.cbegin(),
+                  rowDistances_.begin(),
+                  [this, &position](const common::Coordinate& centroid,
+                                    double                    distance)
+                  {
+                     if (centroid != common::Coordinate {0.0, 0.0})
+                     {
+                        geodesic_.Inverse(position.latitude_,
+                                          position.longitude_,
+                                          centroid.latitude_,
+                                          centroid.longitude_,
+                                          distance);
+                     }
+                     return distance;
+                  });
+
+   previousPosition_ = position;
+
+   if (textEventKeys_.empty())
+   {
+      return;
+   }
+
+   QModelIndex topLeft =
+      self_->createIndex(0, static_cast<int>(AlertModel::Column::Distance));
    QModelIndex bottomRight =
-      createIndex(rowCount() - 1, static_cast<int>(Column::Distance));
+      self_->createIndex(self_->rowCount() - 1,
+                         static_cast<int>(AlertModel::Column::Distance));
 
-   Q_EMIT dataChanged(topLeft, bottomRight);
+   Q_EMIT self_->dataChanged(topLeft, bottomRight);
 }
 
-AlertModelImpl::AlertModelImpl() :
+AlertModelImpl::AlertModelImpl(AlertModel* self) :
+    self_ {self},
     textEventManager_ {manager::TextEventManager::Instance()},
     textEventKeys_ {},
     geodesic_(util::GeographicLib::DefaultGeodesic()),
-    distanceMap_ {},
     previousPosition_ {}
 {
+   distanceUpdateTimer_.setSingleShot(true);
+
+   QObject::connect(&distanceUpdateTimer_,
+                    &QTimer::timeout,
+                    self_,
+                    [this]() { UpdateDistances(); });
 }
 
 bool AlertModelImpl::GetObserved(const types::TextEventKey& key)
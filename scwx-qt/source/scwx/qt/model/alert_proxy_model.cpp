@@ -1,6 +1,7 @@
 #include <scwx/qt/model/alert_proxy_model.hpp>
 #include <scwx/qt/model/alert_model.hpp>
 #include <scwx/qt/types/qt_types.hpp>
+#include <scwx/util/clock.hpp>
 #include <scwx/util/logger.hpp>
 #include <scwx/util/threads.hpp>
 
@@ -67,7 +68,7 @@ bool AlertProxyModel::filterAcceptsRow(int                sourceRow,
                         .value<std::chrono::system_clock::time_point>();
 
       // Compare end time to current
-      if (endTime < std::chrono::system_clock::now())
+      if (endTime < scwx::util::clock::Now())
       {
          acceptAlertActiveFilter = false;
       }
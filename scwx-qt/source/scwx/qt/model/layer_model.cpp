@@ -53,6 +53,10 @@ static const std::vector<types::LayerInfo> kDefaultLayers_ {
    {types::LayerType::Map, types::MapLayer::MapSymbology, false},
    {types::LayerType::Data, types::DataLayer::OverlayProduct, true},
    {types::LayerType::Radar, std::monostate {}, true},
+   {types::LayerType::Data,
+    types::DataLayer::Mosaic,
+    true,
+    {false, false, false, false}},
    {types::LayerType::Map, types::MapLayer::MapUnderlay, false},
 };
 
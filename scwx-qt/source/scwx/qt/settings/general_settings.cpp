@@ -68,6 +68,7 @@ public:
       maptilerApiKey_.SetDefault("?");
       nmeaBaudRate_.SetDefault(9600);
       nmeaSource_.SetDefault("");
+      polarRenderingEnabled_.SetDefault(false);
       positioningPlugin_.SetDefault(defaultPositioningPlugin);
       showMapAttribution_.SetDefault(true);
       showMapCenter_.SetDefault(false);
@@ -75,6 +76,7 @@ public:
       theme_.SetDefault(defaultThemeValue);
       trackLocation_.SetDefault(false);
       updateNotificationsEnabled_.SetDefault(true);
+      warningsBackfillHours_.SetDefault(24);
       warningsProvider_.SetDefault(defaultWarningsProviderValue);
 
       fontSizes_.SetElementMinimum(1);
@@ -93,6 +95,8 @@ public:
       loopTime_.SetMaximum(1440);
       nmeaBaudRate_.SetMinimum(1);
       nmeaBaudRate_.SetMaximum(999999999);
+      warningsBackfillHours_.SetMinimum(1);
+      warningsBackfillHours_.SetMaximum(720);
 
       customStyleDrawLayer_.SetTransform([](const std::string& value)
                                          { return boost::trim_copy(value); });
@@ -156,6 +160,7 @@ public:
    SettingsVariable<std::string>  maptilerApiKey_ {"maptiler_api_key"};
    SettingsVariable<std::int64_t> nmeaBaudRate_ {"nmea_baud_rate"};
    SettingsVariable<std::string>  nmeaSource_ {"nmea_source"};
+   SettingsVariable<bool> polarRenderingEnabled_ {"polar_rendering_enabled"};
    SettingsVariable<std::string>  positioningPlugin_ {"positioning_plugin"};
    SettingsVariable<bool>         showMapAttribution_ {"show_map_attribution"};
    SettingsVariable<bool>         showMapCenter_ {"show_map_center"};
@@ -163,6 +168,8 @@ public:
    SettingsVariable<std::string>  theme_ {"theme"};
    SettingsVariable<bool>         trackLocation_ {"track_location"};
    SettingsVariable<bool> updateNotificationsEnabled_ {"update_notifications"};
+   SettingsVariable<std::int64_t> warningsBackfillHours_ {
+      "warnings_backfill_hours"};
    SettingsVariable<std::string> warningsProvider_ {"warnings_provider"};
 };
 
@@ -188,6 +195,7 @@ GeneralSettings::GeneralSettings() :
                       &p->maptilerApiKey_,
                       &p->nmeaBaudRate_,
                       &p->nmeaSource_,
+                      &p->polarRenderingEnabled_,
                       &p->positioningPlugin_,
                       &p->showMapAttribution_,
                       &p->showMapCenter_,
@@ -195,6 +203,7 @@ GeneralSettings::GeneralSettings() :
                       &p->theme_,
                       &p->trackLocation_,
                       &p->updateNotificationsEnabled_,
+                      &p->warningsBackfillHours_,
                       &p->warningsProvider_});
    SetDefaults();
 }
@@ -300,6 +309,11 @@ SettingsVariable<std::string>& GeneralSettings::nmea_source() const
    return p->nmeaSource_;
 }
 
+SettingsVariable<bool>& GeneralSettings::polar_rendering_enabled() const
+{
+   return p->polarRenderingEnabled_;
+}
+
 SettingsVariable<std::string>& GeneralSettings::positioning_plugin() const
 {
    return p->positioningPlugin_;
@@ -335,6 +349,11 @@ SettingsVariable<bool>& GeneralSettings::update_notifications_enabled() const
    return p->updateNotificationsEnabled_;
 }
 
+SettingsVariable<std::int64_t>& GeneralSettings::warnings_backfill_hours() const
+{
+   return p->warningsBackfillHours_;
+}
+
 SettingsVariable<std::string>& GeneralSettings::warnings_provider() const
 {
    return p->warningsProvider_;
@@ -380,6 +399,7 @@ bool operator==(const GeneralSettings& lhs, const GeneralSettings& rhs)
            lhs.p->maptilerApiKey_ == rhs.p->maptilerApiKey_ &&
            lhs.p->nmeaBaudRate_ == rhs.p->nmeaBaudRate_ &&
            lhs.p->nmeaSource_ == rhs.p->nmeaSource_ &&
+           lhs.p->polarRenderingEnabled_ == rhs.p->polarRenderingEnabled_ &&
            lhs.p->positioningPlugin_ == rhs.p->positioningPlugin_ &&
            lhs.p->showMapAttribution_ == rhs.p->showMapAttribution_ &&
            lhs.p->showMapCenter_ == rhs.p->showMapCenter_ &&
@@ -388,6 +408,7 @@ bool operator==(const GeneralSettings& lhs, const GeneralSettings& rhs)
            lhs.p->trackLocation_ == rhs.p->trackLocation_ &&
            lhs.p->updateNotificationsEnabled_ ==
               rhs.p->updateNotificationsEnabled_ &&
+           lhs.p->warningsBackfillHours_ == rhs.p->warningsBackfillHours_ &&
            lhs.p->warningsProvider_ == rhs.p->warningsProvider_);
 }
 
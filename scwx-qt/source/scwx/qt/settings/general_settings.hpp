@@ -44,14 +44,16 @@ public:
    SettingsVariable<std::string>&                maptiler_api_key() const;
    SettingsVariable<std::int64_t>&               nmea_baud_rate() const;
    SettingsVariable<std::string>&                nmea_source() const;
+   SettingsVariable<bool>&                       polar_rendering_enabled() const;
    SettingsVariable<std::string>&                positioning_plugin() const;
    SettingsVariable<bool>&                       show_map_attribution() const;
    SettingsVariable<bool>&                       show_map_center() const;
    SettingsVariable<bool>&                       show_map_logo() const;
    SettingsVariable<std::string>&                theme() const;
    SettingsVariable<bool>&                       track_location() const;
-   SettingsVariable<bool>&        update_notifications_enabled() const;
-   SettingsVariable<std::string>& warnings_provider() const;
+   SettingsVariable<bool>&         update_notifications_enabled() const;
+   SettingsVariable<std::int64_t>& warnings_backfill_hours() const;
+   SettingsVariable<std::string>&  warnings_provider() const;
 
    static GeneralSettings& Instance();
 
@@ -31,12 +31,13 @@ enum class LayerType
 
 enum class DataLayer
 {
+   Mosaic,
    OverlayProduct,
    RadarRange,
    Unknown
 };
 typedef scwx::util::
-   Iterator<DataLayer, DataLayer::OverlayProduct, DataLayer::RadarRange>
+   Iterator<DataLayer, DataLayer::Mosaic, DataLayer::RadarRange>
       DataLayerIterator;
 
 enum class InformationLayer
@@ -3,6 +3,9 @@
 #include <scwx/common/sites.hpp>
 #include <scwx/util/time.hpp>
 
+#include <mutex>
+#include <unordered_map>
+
 namespace scwx
 {
 namespace qt
@@ -35,6 +38,10 @@ public:
    common::RadarProductGroup             radarProductGroup_;
    std::string                           siteId_;
    std::chrono::system_clock::time_point time_;
+
+   std::mutex derivedDataMutex_ {};
+
+   std::unordered_map<std::string, std::shared_ptr<const void>> derivedData_ {};
 };
 
 RadarProductRecord::RadarProductRecord(
@@ -138,6 +145,25 @@ void RadarProductRecord::set_time(std::chrono::system_clock::time_point time)
    p->time_ = time;
 }
 
+std::shared_ptr<const void> RadarProductRecord::LoadDerivedData(
+   const std::string&                                  key,
+   const std::function<std::shared_ptr<const void>()>& create)
+{
+   // Hold the lock while creating, such that derived data is only created once
+   std::unique_lock lock {p->derivedDataMutex_};
+
+   auto it = p->derivedData_.find(key);
+   if (it != p->derivedData_.cend())
+   {
+      return it->second;
+   }
+
+   auto data = create();
+   p->derivedData_.emplace(key, data);
+
+   return data;
+}
+
 std::shared_ptr<RadarProductRecord>
 RadarProductRecord::Create(std::shared_ptr<wsr88d::NexradFile> nexradFile)
 {
@@ -5,7 +5,9 @@
 #include <scwx/wsr88d/level3_file.hpp>
 
 #include <chrono>
+#include <functional>
 #include <memory>
+#include <string>
 
 namespace scwx
 {
@@ -40,10 +42,34 @@ public:
 
    void set_time(std::chrono::system_clock::time_point time);
 
+   /**
+    * Gets data derived from the record, such as overlay geometry, creating it
+    * on first access. Derived data is cached for the lifetime of the record,
+    * and may be requested from any thread.
+    *
+    * @param [in] key Derived data key
+    * @param [in] create Function creating the derived data
+    *
+    * @return Derived data
+    */
+   template<typename T>
+   std::shared_ptr<const T>
+   GetDerivedData(const std::string&                               key,
+                  const std::function<std::shared_ptr<const T>()>& create)
+   {
+      return std::static_pointer_cast<const T>(
+         LoadDerivedData(key, [&]() -> std::shared_ptr<const void>
+                         { return create(); }));
+   }
+
    static std::shared_ptr<RadarProductRecord>
    Create(std::shared_ptr<wsr88d::NexradFile> nexradFile);
 
 private:
+   std::shared_ptr<const void>
+   LoadDerivedData(const std::string&                                 key,
+                   const std::function<std::shared_ptr<const void>()>& create);
+
    std::unique_ptr<RadarProductRecordImpl> p;
 };
 
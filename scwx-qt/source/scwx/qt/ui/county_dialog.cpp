@@ -161,11 +161,10 @@ void CountyDialog::Impl::UpdateModel(const std::string& stateName)
       QStandardItem* root = model_->invisibleRootItem();
 
       // Add each county to the model
-      for (auto& county : config::CountyDatabase::GetCounties(it->first))
+      for (auto& [id, name] : config::CountyDatabase::GetCounties(it->first))
       {
-         root->appendRow(
-            {new QStandardItem(QString::fromStdString(county.second)),
-             new QStandardItem(QString::fromStdString(county.first))});
+         root->appendRow({new QStandardItem(QString::fromUtf8(name)),
+                          new QStandardItem(QString::fromUtf8(id))});
       }
    }
 }
@@ -0,0 +1,429 @@
+#include <scwx/qt/ui/cross_section_dock_widget.hpp>
+#include <scwx/qt/config/radar_site.hpp>
+#include <scwx/qt/manager/radar_product_manager.hpp>
+#include <scwx/qt/util/cross_section.hpp>
+#include <scwx/qt/view/level2_product_view.hpp>
+#include <scwx/util/logger.hpp>
+#include <scwx/util/metrics.hpp>
+
+#include <chrono>
+#include <mutex>
+#include <optional>
+#include <tuple>
+
+#include <boost/asio/post.hpp>
+#include <boost/asio/thread_pool.hpp>
+#include <boost/timer/timer.hpp>
+#include <QPainter>
+#include <QWidget>
+
+namespace scwx
+{
+namespace qt
+{
+namespace ui
+{
+
+static const std::string logPrefix_ = "scwx::qt::ui::cross_section_dock_widget";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+// 75 m rows, up to 18 km above radar level
+static constexpr std::size_t kRows_      = 240;
+static constexpr std::size_t kColumns_   = 600;
+static constexpr float       kMaxHeight_ = 18'000.0f;
+
+static constexpr int kHeightTickInterval_ = 3; // km
+
+// Target time to sample and render a cross-section while dragging
+static constexpr std::chrono::milliseconds kFrameBudget_ {16};
+
+class CrossSectionWidget : public QWidget
+{
+public:
+   explicit CrossSectionWidget(QWidget* parent) : QWidget(parent)
+   {
+      setMinimumHeight(160);
+   }
+
+   void SetImage(const QImage& image, double length, float maxHeight)
+   {
+      image_     = image;
+      length_    = length;
+      maxHeight_ = maxHeight;
+      update();
+   }
+
+   void SetMessage(const QString& message)
+   {
+      image_   = {};
+      message_ = message;
+      update();
+   }
+
+protected:
+   void paintEvent(QPaintEvent*) override;
+
+private:
+   QImage  image_ {};
+   QString message_ {};
+   double  length_ {0.0};
+   float   maxHeight_ {0.0f};
+};
+
+class CrossSectionDockWidget::Impl
+{
+public:
+   struct Request
+   {
+      std::shared_ptr<manager::RadarProductManager> radarProductManager_;
+      std::chrono::system_clock::time_point         time_;
+      wsr88d::rda::DataBlockType                    dataBlockType_;
+      std::vector<boost::gil::rgba8_pixel_t>        colorTableLut_;
+      std::uint16_t                                 colorTableMin_;
+      common::Coordinate                            start_;
+      common::Coordinate                            end_;
+   };
+
+   explicit Impl(CrossSectionDockWidget* self) :
+       self_ {self}, widget_ {new CrossSectionWidget(self)}
+   {
+   }
+   ~Impl()
+   {
+      {
+         std::unique_lock lock {requestMutex_};
+         pendingRequest_.reset();
+      }
+      threadPool_.join();
+   }
+
+   Impl(const Impl&)            = delete;
+   Impl& operator=(const Impl&) = delete;
+   Impl(Impl&&)                 = delete;
+   Impl& operator=(Impl&&)      = delete;
+
+   void Submit(Request&& request);
+   void ProcessRequests();
+   void Process(const Request& request);
+   void ShowMessage(const QString& message);
+
+   QImage CreateImage(const Request& request) const;
+
+   CrossSectionDockWidget* self_;
+   CrossSectionWidget*     widget_;
+
+   std::optional<std::pair<common::Coordinate, common::Coordinate>> line_ {};
+
+   // Requests are serialized on a single thread, and only the latest pending
+   // request is processed
+   boost::asio::thread_pool threadPool_ {1u};
+   std::mutex               requestMutex_ {};
+   std::optional<Request>   pendingRequest_ {};
+   bool                     requestPosted_ {false};
+
+   // Only accessed from the thread pool
+   std::shared_ptr<wsr88d::Ar2vFile>   file_ {nullptr};
+   wsr88d::rda::DataBlockType          dataBlockType_ {};
+   std::shared_ptr<util::CrossSection> volume_ {nullptr};
+   util::CrossSectionGrid              grid_ {};
+
+   scwx::util::metrics::Histogram& sampleHistogram_ {
+      scwx::util::metrics::Registry::Instance().GetHistogram(
+         scwx::util::metrics::MetricName("cross_section", "sample"))};
+};
+
+CrossSectionDockWidget::CrossSectionDockWidget(QWidget* parent) :
+    QDockWidget(parent), p {std::make_unique<Impl>(this)}
+{
+   setObjectName("CrossSectionDockWidget");
+   setWindowTitle(tr("Cross-Section"));
+   setWidget(p->widget_);
+
+   p->widget_->SetMessage(
+      tr("Hold Shift and drag on the map to draw a cross-section"));
+}
+
+CrossSectionDockWidget::~CrossSectionDockWidget() = default;
+
+void CrossSectionDockWidget::SelectLine(
+   const std::shared_ptr<view::RadarProductView>& radarProductView,
+   common::Coordinate                             start,
+   common::Coordinate                             end)
+{
+   p->line_ = std::make_pair(start, end);
+
+   if (!isVisible())
+   {
+      show();
+   }
+
+   auto level2ProductView =
+      std::dynamic_pointer_cast<view::Level2ProductView>(radarProductView);
+
+   if (level2ProductView == nullptr ||
+       level2ProductView->radar_product_manager() == nullptr)
+   {
+      p->ShowMessage(tr("Cross-sections require a Level 2 product"));
+      return;
+   }
+
+   // Copy view state on the GUI thread
+   p->Submit({level2ProductView->radar_product_manager(),
+              level2ProductView->sweep_time(),
+              level2ProductView->data_block_type(),
+              level2ProductView->color_table_lut(),
+              level2ProductView->color_table_min(),
+              start,
+              end});
+}
+
+void CrossSectionDockWidget::UpdateProduct(
+   const std::shared_ptr<view::RadarProductView>& radarProductView)
+{
+   if (p->line_.has_value() && isVisible())
+   {
+      SelectLine(radarProductView, p->line_->first, p->line_->second);
+   }
+}
+
+void CrossSectionDockWidget::ClearLine()
+{
+   p->line_.reset();
+   p->widget_->SetMessage(
+      tr("Hold Shift and drag on the map to draw a cross-section"));
+}
+
+void CrossSectionDockWidget::Impl::Submit(Request&& request)
+{
+   std::unique_lock lock {requestMutex_};
+
+   pendingRequest_ = std::move(request);
+
+   if (!requestPosted_)
+   {
+      requestPosted_ = true;
+      boost::asio::post(threadPool_, [this]() { ProcessRequests(); });
+   }
+}
+
+void CrossSectionDockWidget::Impl::ProcessRequests()
+{
+   for (;;)
+   {
+      std::optional<Request> request {};
+
+      {
+         std::unique_lock lock {requestMutex_};
+         request.swap(pendingRequest_);
+
+         if (!request.has_value())
+         {
+            requestPosted_ = false;
+            return;
+         }
+      }
+
+      try
+      {
+         Process(*request);
+      }
+      catch (const std::exception& ex)
+      {
+         logger_->error(ex.what());
+      }
+   }
+}
+
+void CrossSectionDockWidget::Impl::Process(const Request& request)
+{
+   std::shared_ptr<types::RadarProductRecord> record;
+   std::tie(record, std::ignore) =
+      request.radarProductManager_->GetLevel2ProductRecord(request.time_);
+
+   std::shared_ptr<wsr88d::Ar2vFile> file =
+      (record != nullptr) ? record->level2_file() : nullptr;
+   auto radarSite = request.radarProductManager_->radar_site();
+
+   if (file == nullptr || radarSite == nullptr)
+   {
+      ShowMessage(tr("No Level 2 data available"));
+      return;
+   }
+
+   if (file != file_ || request.dataBlockType_ != dataBlockType_)
+   {
+      // Index the volume once, such that moving the line only resamples it
+      boost::timer::cpu_timer timer;
+      volume_ = util::CrossSection::Create(
+         file,
+         request.dataBlockType_,
+         {radarSite->latitude(), radarSite->longitude()});
+      timer.stop();
+
+      file_          = file;
+      dataBlockType_ = request.dataBlockType_;
+
+      logger_->debug("Cross-section volume indexed in {}",
+                     timer.format(6, "%ws"));
+   }
+
+   if (volume_ == nullptr)
+   {
+      ShowMessage(tr("No data available for the selected product"));
+      return;
+   }
+
+   const auto start = std::chrono::steady_clock::now();
+
+   util::CrossSection::Definition definition {};
+   definition.start_     = request.start_;
+   definition.end_       = request.end_;
+   definition.rows_      = kRows_;
+   definition.columns_   = kColumns_;
+   definition.maxHeight_ = kMaxHeight_;
+
+   volume_->Sample(definition, grid_);
+   QImage image = CreateImage(request);
+
+   const auto elapsed = std::chrono::steady_clock::now() - start;
+   sampleHistogram_.Record(elapsed);
+
+   if (elapsed > kFrameBudget_)
+   {
+      logger_->debug(
+         "Cross-section exceeded frame budget: {} us",
+         std::chrono::duration_cast<std::chrono::microseconds>(elapsed)
+            .count());
+   }
+
+   const double length    = grid_.length_;
+   const float  maxHeight = grid_.maxHeight_;
+
+   QMetaObject::invokeMethod(
+      self_,
+      [this, image, length, maxHeight]()
+      { widget_->SetImage(image, length, maxHeight); },
+      Qt::QueuedConnection);
+}
+
+void CrossSectionDockWidget::Impl::ShowMessage(const QString& message)
+{
+   QMetaObject::invokeMethod(
+      self_,
+      [this, message]() { widget_->SetMessage(message); },
+      Qt::QueuedConnection);
+}
+
+QImage CrossSectionDockWidget::Impl::CreateImage(const Request& request) const
+{
+   const int rows    = static_cast<int>(grid_.rows_);
+   const int columns = static_cast<int>(grid_.columns_);
+
+   const std::vector<boost::gil::rgba8_pixel_t>& lut = request.colorTableLut_;
+
+   QImage image {columns, rows, QImage::Format::Format_RGBA8888};
+   image.fill(Qt::GlobalColor::transparent);
+
+   // Grid rows are ordered lowest to highest, image rows highest to lowest
+   for (int r = 0; r < rows; ++r)
+   {
+      const std::uint16_t* data =
+         grid_.data_.data() + static_cast<std::size_t>(r) * grid_.columns_;
+      uchar* line = image.scanLine(rows - 1 - r);
+
+      for (int c = 0; c < columns; ++c)
+      {
+         const std::uint16_t value = data[c];
+
+         if (value == 0u || value < request.colorTableMin_)
+         {
+            continue;
+         }
+
+         const std::size_t index = value - request.colorTableMin_;
+         if (index < lut.size())
+         {
+            const boost::gil::rgba8_pixel_t& color = lut[index];
+
+            line[c * 4 + 0] = color[0];
+            line[c * 4 + 1] = color[1];
+            line[c * 4 + 2] = color[2];
+            line[c * 4 + 3] = color[3];
+         }
+      }
+   }
+
+   return image;
+}
+
+void CrossSectionWidget::paintEvent(QPaintEvent*)
+{
+   QPainter painter {this};
+   painter.fillRect(rect(), Qt::GlobalColor::black);
+   painter.setPen(Qt::GlobalColor::lightGray);
+
+   if (image_.isNull())
+   {
+      painter.drawText(rect(), Qt::AlignmentFlag::AlignCenter, message_);
+      return;
+   }
+
+   const QFontMetrics metrics      = fontMetrics();
+   const int          textHeight   = metrics.height();
+   const int          leftMargin   = metrics.horizontalAdvance("00 km") + 8;
+   const int          bottomMargin = textHeight + 6;
+
+   const QRect plot =
+      rect().adjusted(leftMargin, textHeight / 2, -16, -bottomMargin);
+
+   if (plot.width() <= 0 || plot.height() <= 0)
+   {
+      return;
+   }
+
+   painter.drawImage(plot, image_);
+   painter.drawRect(plot.adjusted(0, 0, -1, -1));
+
+   // Height axis
+   const int maxHeightKm = static_cast<int>(maxHeight_ / 1000.0f);
+   for (int km = 0; km <= maxHeightKm; km += kHeightTickInterval_)
+   {
+      const int y = plot.bottom() -
+                    static_cast<int>(km * 1000.0f / maxHeight_ *
+                                     static_cast<float>(plot.height()));
+
+      painter.drawLine(plot.left() - 4, y, plot.left(), y);
+      painter.drawText(
+         QRect {0, y - textHeight / 2, leftMargin - 6, textHeight},
+         Qt::AlignmentFlag::AlignRight | Qt::AlignmentFlag::AlignVCenter,
+         QString("%1 km").arg(km));
+   }
+
+   // Distance axis, with at most 8 intervals
+   const double lengthKm = length_ / 1000.0;
+   double       interval = 1.0;
+   for (double candidate : {1.0, 2.0, 5.0, 10.0, 25.0, 50.0, 100.0, 250.0})
+   {
+      interval = candidate;
+      if (lengthKm / candidate <= 8.0)
+      {
+         break;
+      }
+   }
+
+   for (double km = 0.0; km <= lengthKm && lengthKm > 0.0; km += interval)
+   {
+      const int x =
+         plot.left() + static_cast<int>(km / lengthKm * plot.width());
+
+      painter.drawLine(x, plot.bottom(), x, plot.bottom() + 4);
+      painter.drawText(QRect {x - 40, plot.bottom() + 4, 80, textHeight},
+                       Qt::AlignmentFlag::AlignHCenter |
+                          Qt::AlignmentFlag::AlignTop,
+                       QString("%1 km").arg(km));
+   }
+}
+
+} // namespace ui
+} // namespace qt
+} // namespace scwx
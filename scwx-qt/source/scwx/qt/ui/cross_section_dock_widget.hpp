@@ -0,0 +1,67 @@
+#pragma once
+
+#include <scwx/common/geographic.hpp>
+
+#include <memory>
+
+#include <QDockWidget>
+
+namespace scwx
+{
+namespace qt
+{
+namespace view
+{
+
+class RadarProductView;
+
+} // namespace view
+
+namespace ui
+{
+
+class CrossSectionDockWidget : public QDockWidget
+{
+   Q_OBJECT
+   Q_DISABLE_COPY_MOVE(CrossSectionDockWidget)
+
+public:
+   explicit CrossSectionDockWidget(QWidget* parent = nullptr);
+   ~CrossSectionDockWidget();
+
+public slots:
+   /**
+    * Samples a cross-section along a line through the Level 2 volume
+    * displayed by a radar product view.
+    *
+    * @param [in] radarProductView Radar product view
+    * @param [in] start Start of the cross-section line
+    * @param [in] end End of the cross-section line
+    */
+   void SelectLine(
+      const std::shared_ptr<view::RadarProductView>& radarProductView,
+      common::Coordinate                             start,
+      common::Coordinate                             end);
+
+   /**
+    * Resamples the selected cross-section line after the radar product view
+    * has been updated.
+    *
+    * @param [in] radarProductView Radar product view
+    */
+   void UpdateProduct(
+      const std::shared_ptr<view::RadarProductView>& radarProductView);
+
+   /**
+    * Clears the selected cross-section line.
+    */
+   void ClearLine();
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace ui
+} // namespace qt
+} // namespace scwx
@@ -130,7 +130,9 @@ public:
           &nmeaBaudRate_,
           &nmeaSource_,
           &warningsProvider_,
+          &warningsBackfillHours_,
           &antiAliasingEnabled_,
+          &polarRenderingEnabled_,
           &showMapAttribution_,
           &showMapCenter_,
           &showMapLogo_,
@@ -243,7 +245,9 @@ public:
    settings::SettingsInterface<std::string>  nmeaSource_ {};
    settings::SettingsInterface<std::string>  theme_ {};
    settings::SettingsInterface<std::string>  warningsProvider_ {};
+   settings::SettingsInterface<std::int64_t> warningsBackfillHours_ {};
    settings::SettingsInterface<bool>         antiAliasingEnabled_ {};
+   settings::SettingsInterface<bool>         polarRenderingEnabled_ {};
    settings::SettingsInterface<bool>         showMapAttribution_ {};
    settings::SettingsInterface<bool>         showMapCenter_ {};
    settings::SettingsInterface<bool>         showMapLogo_ {};
@@ -682,10 +686,22 @@ void SettingsDialogImpl::SetupGeneralTab()
    warningsProvider_.SetResetButton(self_->ui->resetWarningsProviderButton);
    warningsProvider_.EnableTrimming();
 
+   warningsBackfillHours_.SetSettingsVariable(
+      generalSettings.warnings_backfill_hours());
+   warningsBackfillHours_.SetEditWidget(
+      self_->ui->warningsBackfillHoursSpinBox);
+   warningsBackfillHours_.SetResetButton(
+      self_->ui->resetWarningsBackfillHoursButton);
+
    antiAliasingEnabled_.SetSettingsVariable(
       generalSettings.anti_aliasing_enabled());
    antiAliasingEnabled_.SetEditWidget(self_->ui->antiAliasingEnabledCheckBox);
 
+   polarRenderingEnabled_.SetSettingsVariable(
+      generalSettings.polar_rendering_enabled());
+   polarRenderingEnabled_.SetEditWidget(
+      self_->ui->polarRenderingEnabledCheckBox);
+
    showMapAttribution_.SetSettingsVariable(
       generalSettings.show_map_attribution());
    showMapAttribution_.SetEditWidget(self_->ui->showMapAttributionCheckBox);
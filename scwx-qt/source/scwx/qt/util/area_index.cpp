@@ -0,0 +1,179 @@
+#include <scwx/qt/util/area_index.hpp>
+
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <geos/geom/Envelope.h>
+#include <geos/index/strtree/TemplateSTRtree.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+// Minimum number of insertions and removals before the tree is rebuilt
+static constexpr std::size_t kMinRebuildCount_ = 64u;
+
+class AreaIndex::Impl
+{
+public:
+   explicit Impl() {}
+   ~Impl() = default;
+
+   void BuildTree();
+   bool RebuildRequired() const;
+
+   std::unordered_map<const PreparedArea*, std::shared_ptr<const PreparedArea>>
+      areas_ {};
+
+   // Areas inserted since the tree was built
+   std::unordered_set<const PreparedArea*> pending_ {};
+
+   // Number of areas removed since the tree was built
+   std::size_t removedCount_ {0u};
+
+   std::unique_ptr<geos::index::strtree::TemplateSTRtree<const PreparedArea*>>
+      tree_ {};
+};
+
+AreaIndex::AreaIndex() : p(std::make_unique<Impl>()) {}
+AreaIndex::~AreaIndex() = default;
+
+AreaIndex::AreaIndex(AreaIndex&&) noexcept            = default;
+AreaIndex& AreaIndex::operator=(AreaIndex&&) noexcept = default;
+
+bool AreaIndex::empty() const
+{
+   return p->areas_.empty();
+}
+
+std::size_t AreaIndex::size() const
+{
+   return p->areas_.size();
+}
+
+void AreaIndex::Clear()
+{
+   p->areas_.clear();
+   p->pending_.clear();
+   p->removedCount_ = 0u;
+   p->tree_.reset();
+}
+
+void AreaIndex::Insert(const std::shared_ptr<const PreparedArea>& area)
+{
+   if (area != nullptr && p->areas_.try_emplace(area.get(), area).second)
+   {
+      p->pending_.insert(area.get());
+   }
+}
+
+void AreaIndex::Remove(const std::shared_ptr<const PreparedArea>& area)
+{
+   if (p->areas_.erase(area.get()) > 0 && p->pending_.erase(area.get()) == 0)
+   {
+      // The area remains in the tree, and is skipped until the tree is
+      // rebuilt
+      ++p->removedCount_;
+   }
+}
+
+bool AreaIndex::Impl::RebuildRequired() const
+{
+   return pending_.size() + removedCount_ >
+          std::max(kMinRebuildCount_, areas_.size() / 2u);
+}
+
+void AreaIndex::Impl::BuildTree()
+{
+   tree_ = std::make_unique<
+      geos::index::strtree::TemplateSTRtree<const PreparedArea*>>(
+      areas_.size());
+
+   for (auto& area : areas_)
+   {
+      const PreparedArea::Bounds& bounds = area.second->bounds();
+
+      // Envelope x is longitude, y is latitude
+      geos::geom::Envelope envelope {bounds.minLongitude_,
+                                     bounds.maxLongitude_,
+                                     bounds.minLatitude_,
+                                     bounds.maxLatitude_};
+      tree_->insert(envelope, area.first);
+   }
+
+   pending_.clear();
+   removedCount_ = 0u;
+}
+
+std::vector<std::shared_ptr<const PreparedArea>>
+AreaIndex::Query(const common::Coordinate&     point,
+                 units::length::meters<double> distance)
+{
+   std::vector<std::shared_ptr<const PreparedArea>> candidates {};
+
+   if (p->areas_.empty())
+   {
+      return candidates;
+   }
+
+   if (p->RebuildRequired())
+   {
+      p->BuildTree();
+   }
+
+   const PreparedArea::Bounds queryBounds =
+      PreparedArea::GetQueryBounds(point, distance);
+
+   if (p->tree_ != nullptr)
+   {
+      geos::geom::Envelope envelope {queryBounds.minLongitude_,
+                                     queryBounds.maxLongitude_,
+                                     queryBounds.minLatitude_,
+                                     queryBounds.maxLatitude_};
+
+      p->tree_->query(envelope,
+                      [&](const PreparedArea* area)
+                      {
+                         // Skip removed areas, and pending areas which are
+                         // tested below
+                         auto it = p->areas_.find(area);
+                         if (it != p->areas_.cend() &&
+                             !p->pending_.contains(area))
+                         {
+                            candidates.push_back(it->second);
+                         }
+                      });
+   }
+
+   for (const PreparedArea* area : p->pending_)
+   {
+      if (area->bounds().Intersects(queryBounds))
+      {
+         candidates.push_back(p->areas_.at(area));
+      }
+   }
+
+   return candidates;
+}
+
+std::vector<std::shared_ptr<const PreparedArea>>
+AreaIndex::QueryInRange(const common::Coordinate&     point,
+                        units::length::meters<double> distance)
+{
+   std::vector<std::shared_ptr<const PreparedArea>> areas =
+      Query(point, distance);
+
+   std::erase_if(areas,
+                 [&](const std::shared_ptr<const PreparedArea>& area)
+                 { return !area->InRangeOfPoint(point, distance); });
+
+   return areas;
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <scwx/qt/util/prepared_area.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+/**
+ * @brief A spatial index of prepared areas, used to answer point against all
+ * areas queries without testing every area.
+ *
+ * Areas are indexed by their geographic bounds in an STR-tree. Areas inserted
+ * since the tree was built are tested directly, and removed areas are skipped,
+ * until enough modifications accumulate that the tree is rebuilt on the next
+ * query. The index is not thread-safe.
+ */
+class AreaIndex
+{
+public:
+   explicit AreaIndex();
+   ~AreaIndex();
+
+   AreaIndex(const AreaIndex&)            = delete;
+   AreaIndex& operator=(const AreaIndex&) = delete;
+
+   AreaIndex(AreaIndex&&) noexcept;
+   AreaIndex& operator=(AreaIndex&&) noexcept;
+
+   bool        empty() const;
+   std::size_t size() const;
+
+   void Clear();
+   void Insert(const std::shared_ptr<const PreparedArea>& area);
+   void Remove(const std::shared_ptr<const PreparedArea>& area);
+
+   /**
+    * Get the areas whose bounds may lie within a distance of a point. The
+    * result is a superset of the areas in range, and should be refined using
+    * PreparedArea::InRangeOfPoint.
+    *
+    * @param [in] point The point to query
+    * @param [in] distance The max distance in meters
+    *
+    * @return candidate areas
+    */
+   std::vector<std::shared_ptr<const PreparedArea>>
+   Query(const common::Coordinate&     point,
+         units::length::meters<double> distance);
+
+   /**
+    * Get the areas within a distance of a point.
+    *
+    * @param [in] point The point to query
+    * @param [in] distance The max distance in meters
+    *
+    * @return areas in range of the point
+    */
+   std::vector<std::shared_ptr<const PreparedArea>>
+   QueryInRange(const common::Coordinate&     point,
+                units::length::meters<double> distance);
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
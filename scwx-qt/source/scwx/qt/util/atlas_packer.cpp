@@ -0,0 +1,204 @@
+#include <scwx/qt/util/atlas_packer.hpp>
+
+#include <algorithm>
+
+#include <stb_rect_pack.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+class AtlasPacker::Impl
+{
+public:
+   struct Layer
+   {
+      explicit Layer(std::size_t width, std::size_t height) :
+          nodes_(width) // Optimal number of nodes = width
+      {
+         stbrp_init_target(&context_,
+                           static_cast<int>(width),
+                           static_cast<int>(height),
+                           nodes_.data(),
+                           static_cast<int>(nodes_.size()));
+      }
+
+      // The context references the node storage, and must not be moved
+      Layer(const Layer&)            = delete;
+      Layer& operator=(const Layer&) = delete;
+
+      stbrp_context           context_ {};
+      std::vector<stbrp_node> nodes_;
+   };
+
+   explicit Impl(std::size_t width,
+                 std::size_t height,
+                 std::size_t maxLayers) :
+       width_ {width}, height_ {height}, maxLayers_ {maxLayers}
+   {
+   }
+   ~Impl() = default;
+
+   std::size_t PackLayer(std::size_t                              layer,
+                         const std::vector<Size>&                 sizes,
+                         std::vector<std::size_t>&                pending,
+                         std::vector<std::optional<AtlasRegion>>& regions);
+
+   const std::size_t width_;
+   const std::size_t height_;
+   const std::size_t maxLayers_;
+
+   std::vector<std::unique_ptr<Layer>> layers_ {};
+
+   std::size_t packedArea_ {0u};
+   std::size_t fragmentedArea_ {0u};
+};
+
+AtlasPacker::AtlasPacker(std::size_t width,
+                         std::size_t height,
+                         std::size_t maxLayers) :
+    p(std::make_unique<Impl>(width, height, maxLayers))
+{
+}
+AtlasPacker::~AtlasPacker() = default;
+
+AtlasPacker::AtlasPacker(AtlasPacker&&) noexcept            = default;
+AtlasPacker& AtlasPacker::operator=(AtlasPacker&&) noexcept = default;
+
+std::size_t AtlasPacker::width() const
+{
+   return p->width_;
+}
+
+std::size_t AtlasPacker::height() const
+{
+   return p->height_;
+}
+
+std::size_t AtlasPacker::layer_count() const
+{
+   return p->layers_.size();
+}
+
+std::size_t AtlasPacker::packed_area() const
+{
+   return p->packedArea_;
+}
+
+std::size_t AtlasPacker::fragmented_area() const
+{
+   return p->fragmentedArea_;
+}
+
+std::vector<std::optional<AtlasRegion>>
+AtlasPacker::Pack(const std::vector<Size>& sizes)
+{
+   std::vector<std::optional<AtlasRegion>> regions(sizes.size());
+   std::vector<std::size_t>                pending {};
+
+   for (std::size_t i = 0; i < sizes.size(); ++i)
+   {
+      if (sizes[i].width_ > 0 && sizes[i].height_ > 0)
+      {
+         pending.push_back(i);
+      }
+   }
+
+   // Fill free space in existing layers first, such that existing placements
+   // remain stable
+   for (std::size_t layer = 0; layer < p->layers_.size() && !pending.empty();
+        ++layer)
+   {
+      p->PackLayer(layer, sizes, pending, regions);
+   }
+
+   // Add layers for the remaining rectangles
+   while (!pending.empty() && p->layers_.size() < p->maxLayers_)
+   {
+      p->layers_.emplace_back(
+         std::make_unique<Impl::Layer>(p->width_, p->height_));
+
+      if (p->PackLayer(p->layers_.size() - 1, sizes, pending, regions) == 0u)
+      {
+         // The remaining rectangles do not fit in an empty layer
+         p->layers_.pop_back();
+         break;
+      }
+   }
+
+   return regions;
+}
+
+std::size_t
+AtlasPacker::Impl::PackLayer(std::size_t                              layer,
+                             const std::vector<Size>&                 sizes,
+                             std::vector<std::size_t>&                pending,
+                             std::vector<std::optional<AtlasRegion>>& regions)
+{
+   std::vector<stbrp_rect> rects {};
+   rects.reserve(pending.size());
+
+   for (std::size_t i : pending)
+   {
+      rects.push_back(stbrp_rect {static_cast<int>(i),
+                                  static_cast<stbrp_coord>(sizes[i].width_),
+                                  static_cast<stbrp_coord>(sizes[i].height_),
+                                  0,
+                                  0,
+                                  0});
+   }
+
+   stbrp_pack_rects(&layers_[layer]->context_,
+                    rects.data(),
+                    static_cast<int>(rects.size()));
+
+   std::size_t numPacked = 0u;
+   pending.clear();
+
+   for (const stbrp_rect& rect : rects)
+   {
+      const std::size_t i = static_cast<std::size_t>(rect.id);
+
+      if (rect.was_packed != 0)
+      {
+         regions[i] = AtlasRegion {layer,
+                                   static_cast<std::int32_t>(rect.x),
+                                   static_cast<std::int32_t>(rect.y),
+                                   sizes[i].width_,
+                                   sizes[i].height_};
+
+         packedArea_ += static_cast<std::size_t>(sizes[i].width_) *
+                        static_cast<std::size_t>(sizes[i].height_);
+         ++numPacked;
+      }
+      else
+      {
+         pending.push_back(i);
+      }
+   }
+
+   return numPacked;
+}
+
+void AtlasPacker::Remove(const AtlasRegion& region)
+{
+   const std::size_t area = static_cast<std::size_t>(region.width_) *
+                            static_cast<std::size_t>(region.height_);
+
+   p->packedArea_ -= std::min(area, p->packedArea_);
+   p->fragmentedArea_ += area;
+}
+
+void AtlasPacker::Reset()
+{
+   p->layers_.clear();
+   p->packedArea_     = 0u;
+   p->fragmentedArea_ = 0u;
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+/**
+ * @brief Location of a packed rectangle within a layered texture atlas.
+ */
+struct AtlasRegion
+{
+   std::size_t  layer_ {0};
+   std::int32_t x_ {0};
+   std::int32_t y_ {0};
+   std::int32_t width_ {0};
+   std::int32_t height_ {0};
+};
+
+/**
+ * @brief Incremental rectangle packer for a layered texture atlas.
+ *
+ * Packed rectangles keep their placement until the packer is reset. New
+ * rectangles are packed into the free space of existing layers, in order,
+ * before a new layer is added. The space of removed rectangles is not reused,
+ * and is reported as fragmented until the packer is reset.
+ */
+class AtlasPacker
+{
+public:
+   struct Size
+   {
+      std::int32_t width_ {0};
+      std::int32_t height_ {0};
+   };
+
+   explicit AtlasPacker(std::size_t width,
+                        std::size_t height,
+                        std::size_t maxLayers);
+   ~AtlasPacker();
+
+   AtlasPacker(const AtlasPacker&)            = delete;
+   AtlasPacker& operator=(const AtlasPacker&) = delete;
+
+   AtlasPacker(AtlasPacker&&) noexcept;
+   AtlasPacker& operator=(AtlasPacker&&) noexcept;
+
+   std::size_t width() const;
+   std::size_t height() const;
+   std::size_t layer_count() const;
+
+   /**
+    * @brief Gets the area of rectangles currently packed.
+    */
+   std::size_t packed_area() const;
+
+   /**
+    * @brief Gets the area of rectangles which have been removed, and cannot be
+    * reused until the packer is reset.
+    */
+   std::size_t fragmented_area() const;
+
+   /**
+    * @brief Packs rectangles into the atlas, adding layers as required.
+    *
+    * @param [in] sizes Rectangle sizes
+    *
+    * @return Region of each rectangle, in the same order as the sizes. A
+    * rectangle which could not be packed has no region.
+    */
+   std::vector<std::optional<AtlasRegion>>
+   Pack(const std::vector<Size>& sizes);
+
+   /**
+    * @brief Removes a previously packed rectangle.
+    */
+   void Remove(const AtlasRegion& region);
+
+   /**
+    * @brief Removes all layers and rectangles.
+    */
+   void Reset();
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,192 @@
+#pragma once
+
+#include <exception>
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+/**
+ * @brief A cache of immutable, shared computation results.
+ *
+ * Results are held weakly, and remain cached only as long as a consumer
+ * references them. Concurrent requests for the same key are coalesced, such
+ * that the result is computed once and shared with each requester.
+ *
+ * @tparam Key Ordered key type
+ * @tparam T Result type
+ */
+template<class Key, class T>
+class CoalescingCache
+{
+public:
+   typedef std::shared_ptr<const T>       ResultPtr;
+   typedef std::function<ResultPtr(void)> ComputeFunction;
+
+   explicit CoalescingCache() = default;
+   ~CoalescingCache()         = default;
+
+   CoalescingCache(const CoalescingCache&)            = delete;
+   CoalescingCache& operator=(const CoalescingCache&) = delete;
+
+   /**
+    * @brief Gets the cached result for a key, computing it if necessary. If
+    * the result is being computed by another thread, waits for that
+    * computation to complete.
+    *
+    * The compute function is called on the calling thread, without holding
+    * the cache lock. A null result is returned to all waiting requesters, but
+    * is not cached. An exception thrown by the compute function is propagated
+    * to all waiting requesters.
+    *
+    * @param [in] key Result key
+    * @param [in] compute Function computing the result on a cache miss
+    *
+    * @return Shared result
+    */
+   ResultPtr GetOrCompute(const Key& key, const ComputeFunction& compute)
+   {
+      std::unique_lock lock {mutex_};
+
+      Entry& entry = entries_[key];
+
+      if (ResultPtr result = entry.result_.lock(); result != nullptr)
+      {
+         ++hits_;
+         return result;
+      }
+
+      if (entry.pending_.valid())
+      {
+         // Another thread is computing the result, wait for it outside of the
+         // lock
+         std::shared_future<ResultPtr> pending = entry.pending_;
+         ++coalesced_;
+         lock.unlock();
+
+         return pending.get();
+      }
+
+      std::promise<ResultPtr> promise {};
+      entry.pending_ = promise.get_future().share();
+      ++misses_;
+      lock.unlock();
+
+      ResultPtr result {};
+
+      try
+      {
+         result = compute();
+      }
+      catch (...)
+      {
+         lock.lock();
+         Complete(key, nullptr);
+         lock.unlock();
+
+         promise.set_exception(std::current_exception());
+         throw;
+      }
+
+      lock.lock();
+      Complete(key, result);
+      lock.unlock();
+
+      promise.set_value(result);
+
+      return result;
+   }
+
+   /**
+    * @brief Gets the cached result for a key, without computing it.
+    *
+    * @return Shared result, or nullptr if the result is not cached
+    */
+   ResultPtr Find(const Key& key) const
+   {
+      std::unique_lock lock {mutex_};
+
+      auto it = entries_.find(key);
+      if (it != entries_.cend())
+      {
+         return it->second.result_.lock();
+      }
+
+      return nullptr;
+   }
+
+   /**
+    * @brief Gets the number of results which are cached or being computed.
+    */
+   std::size_t size() const
+   {
+      std::unique_lock lock {mutex_};
+      return entries_.size();
+   }
+
+   std::size_t hits() const
+   {
+      std::unique_lock lock {mutex_};
+      return hits_;
+   }
+
+   std::size_t misses() const
+   {
+      std::unique_lock lock {mutex_};
+      return misses_;
+   }
+
+   std::size_t coalesced() const
+   {
+      std::unique_lock lock {mutex_};
+      return coalesced_;
+   }
+
+private:
+   struct Entry
+   {
+      std::weak_ptr<const T>        result_ {};
+      std::shared_future<ResultPtr> pending_ {};
+   };
+
+   void Complete(const Key& key, const ResultPtr& result)
+   {
+      if (result != nullptr)
+      {
+         Entry& entry   = entries_[key];
+         entry.result_  = result;
+         entry.pending_ = {};
+      }
+      else
+      {
+         entries_.erase(key);
+      }
+
+      // Prune results which are no longer referenced
+      std::erase_if(entries_,
+                    [](const auto& item)
+                    {
+                       return !item.second.pending_.valid() &&
+                              item.second.result_.expired();
+                    });
+   }
+
+   mutable std::mutex   mutex_ {};
+   std::map<Key, Entry> entries_ {};
+
+   std::size_t hits_ {0};
+   std::size_t misses_ {0};
+   std::size_t coalesced_ {0};
+};
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,407 @@
+#include <scwx/qt/util/cross_section.hpp>
+#include <scwx/qt/util/geographic_lib.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <execution>
+#include <numbers>
+#include <numeric>
+#include <tuple>
+
+#include <GeographicLib/GeodesicLine.hpp>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+static const std::string logPrefix_ = "scwx::qt::util::cross_section";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+// Azimuth lookup resolution, in bins per degree
+static constexpr std::size_t kAzimuthBinsPerDegree_ = 10;
+static constexpr std::size_t kAzimuthBins_ = 360 * kAzimuthBinsPerDegree_;
+
+// Maximum angular distance from a radial to be considered within its beam
+static constexpr float kMaxRadialGap_ = 1.0f;
+
+// Maximum angular distance below the lowest cut or above the highest cut to be
+// considered within the beam
+static constexpr double kHalfBeamWidth_ = 0.5;
+
+static constexpr std::uint16_t kNoRadial_    = 0xffff;
+static constexpr std::size_t   kNoCut_       = static_cast<std::size_t>(-1);
+static constexpr std::uint16_t kRangeFolded_ = 1u;
+
+// 4/3 effective earth radius, in meters
+static constexpr double kEffectiveEarthRadius_ = 6'371'000.0 * 4.0 / 3.0;
+
+static constexpr double kRadiansToDegrees_ = 180.0 / std::numbers::pi;
+
+class CrossSection::Impl
+{
+public:
+   explicit Impl(const common::Coordinate&    location,
+                 std::vector<CrossSectionCut> cuts) :
+       location_ {location}, cuts_ {std::move(cuts)}
+   {
+      std::stable_sort(cuts_.begin(),
+                       cuts_.end(),
+                       [](const CrossSectionCut& a, const CrossSectionCut& b)
+                       { return a.elevation_ < b.elevation_; });
+
+      elevations_.reserve(cuts_.size());
+      radialLuts_.reserve(cuts_.size());
+      for (const CrossSectionCut& cut : cuts_)
+      {
+         elevations_.push_back(cut.elevation_);
+         radialLuts_.push_back(BuildRadialLut(cut));
+      }
+   }
+   ~Impl() = default;
+
+   std::size_t   SelectCut(double elevation) const;
+   std::uint16_t SampleCut(std::size_t cutIndex,
+                           std::size_t azimuthBin,
+                           double      range) const;
+
+   static std::vector<std::uint16_t> BuildRadialLut(const CrossSectionCut& cut);
+
+   common::Coordinate           location_;
+   std::vector<CrossSectionCut> cuts_;
+
+   // Elevation of each cut, in degrees
+   std::vector<float> elevations_ {};
+
+   // Radial index for each azimuth bin, for each cut
+   std::vector<std::vector<std::uint16_t>> radialLuts_ {};
+};
+
+CrossSection::CrossSection(const common::Coordinate&    location,
+                           std::vector<CrossSectionCut> cuts) :
+    p(std::make_unique<Impl>(location, std::move(cuts)))
+{
+}
+CrossSection::~CrossSection() = default;
+
+CrossSection::CrossSection(CrossSection&&) noexcept            = default;
+CrossSection& CrossSection::operator=(CrossSection&&) noexcept = default;
+
+const std::vector<CrossSectionCut>& CrossSection::cuts() const
+{
+   return p->cuts_;
+}
+
+const common::Coordinate& CrossSection::location() const
+{
+   return p->location_;
+}
+
+void CrossSection::Sample(const Definition& definition,
+                          CrossSectionGrid& grid) const
+{
+   const std::size_t rows    = definition.rows_;
+   const std::size_t columns = definition.columns_;
+
+   grid.rows_      = rows;
+   grid.columns_   = columns;
+   grid.maxHeight_ = definition.maxHeight_;
+   grid.data_.assign(rows * columns, 0u);
+
+   const ::GeographicLib::Geodesic& geodesic = GeographicLib::DefaultGeodesic();
+   const ::GeographicLib::GeodesicLine line =
+      geodesic.InverseLine(definition.start_.latitude_,
+                           definition.start_.longitude_,
+                           definition.end_.latitude_,
+                           definition.end_.longitude_);
+
+   grid.length_ = line.Distance();
+
+   if (rows == 0 || columns == 0 || p->cuts_.empty())
+   {
+      return;
+   }
+
+   std::vector<std::size_t> columnIndices(columns);
+   std::iota(columnIndices.begin(), columnIndices.end(), 0u);
+
+   std::for_each(
+      std::execution::par,
+      columnIndices.cbegin(),
+      columnIndices.cend(),
+      [&](std::size_t c)
+      {
+         // Locate the column along the path, relative to the radar
+         const double distance = grid.length_ * (static_cast<double>(c) + 0.5) /
+                                 static_cast<double>(columns);
+
+         double latitude;
+         double longitude;
+         line.Position(distance, latitude, longitude);
+
+         double groundRange;
+         double azimuth1;
+         double azimuth2;
+         geodesic.Inverse(p->location_.latitude_,
+                          p->location_.longitude_,
+                          latitude,
+                          longitude,
+                          groundRange,
+                          azimuth1,
+                          azimuth2);
+
+         if (azimuth1 < 0.0)
+         {
+            azimuth1 += 360.0;
+         }
+
+         const std::size_t azimuthBin = std::min(
+            static_cast<std::size_t>(azimuth1 * kAzimuthBinsPerDegree_),
+            kAzimuthBins_ - 1);
+
+         const double phi    = groundRange / kEffectiveEarthRadius_;
+         const double sinPhi = std::sin(phi);
+         const double cosPhi = std::cos(phi);
+
+         for (std::size_t r = 0; r < rows; ++r)
+         {
+            // Elevation angle and slant range of the beam passing through the
+            // cell
+            const double height = definition.maxHeight_ *
+                                  (static_cast<double>(r) + 0.5) /
+                                  static_cast<double>(rows);
+            const double dx = (kEffectiveEarthRadius_ + height) * sinPhi;
+            const double dy =
+               (kEffectiveEarthRadius_ + height) * cosPhi -
+               kEffectiveEarthRadius_;
+
+            const double elevation = std::atan2(dy, dx) * kRadiansToDegrees_;
+
+            const std::size_t cutIndex = p->SelectCut(elevation);
+            if (cutIndex != kNoCut_)
+            {
+               grid.data_[r * columns + c] =
+                  p->SampleCut(cutIndex, azimuthBin, std::hypot(dx, dy));
+            }
+         }
+      });
+}
+
+std::size_t CrossSection::Impl::SelectCut(double elevation) const
+{
+   if (elevation < elevations_.front() - kHalfBeamWidth_ ||
+       elevation > elevations_.back() + kHalfBeamWidth_)
+   {
+      return kNoCut_;
+   }
+
+   // Select the nearest cut
+   auto upper = std::lower_bound(
+      elevations_.cbegin(), elevations_.cend(), static_cast<float>(elevation));
+
+   if (upper == elevations_.cend())
+   {
+      return elevations_.size() - 1;
+   }
+   if (upper != elevations_.cbegin() &&
+       elevation - *std::prev(upper) < *upper - elevation)
+   {
+      --upper;
+   }
+
+   return static_cast<std::size_t>(upper - elevations_.cbegin());
+}
+
+std::uint16_t CrossSection::Impl::SampleCut(std::size_t cutIndex,
+                                            std::size_t azimuthBin,
+                                            double      range) const
+{
+   const CrossSectionCut& cut    = cuts_[cutIndex];
+   const std::uint16_t    radial = radialLuts_[cutIndex][azimuthBin];
+
+   if (radial == kNoRadial_)
+   {
+      return 0u;
+   }
+
+   const double gate =
+      (range - (cut.firstGateRange_ - cut.gateSpacing_ * 0.5)) /
+      cut.gateSpacing_;
+
+   if (gate < 0.0 || gate >= static_cast<double>(cut.gateCount_))
+   {
+      return 0u;
+   }
+
+   const std::uint16_t value =
+      cut.data_[radial * cut.gateCount_ + static_cast<std::size_t>(gate)];
+
+   if (value < cut.threshold_ && value != kRangeFolded_)
+   {
+      return 0u;
+   }
+
+   return value;
+}
+
+std::vector<std::uint16_t>
+CrossSection::Impl::BuildRadialLut(const CrossSectionCut& cut)
+{
+   std::vector<std::uint16_t> radialLut(kAzimuthBins_, kNoRadial_);
+
+   if (cut.azimuths_.empty() || cut.gateSpacing_ <= 0.0f)
+   {
+      return radialLut;
+   }
+
+   // Sort radials by azimuth
+   std::vector<std::pair<float, std::uint16_t>> radials {};
+   radials.reserve(cut.azimuths_.size());
+   for (std::size_t i = 0; i < cut.azimuths_.size(); ++i)
+   {
+      float azimuth = std::fmod(cut.azimuths_[i], 360.0f);
+      if (azimuth < 0.0f)
+      {
+         azimuth += 360.0f;
+      }
+      radials.emplace_back(azimuth, static_cast<std::uint16_t>(i));
+   }
+   std::sort(radials.begin(), radials.end());
+
+   // Select the nearest radial for each azimuth bin
+   for (std::size_t bin = 0; bin < kAzimuthBins_; ++bin)
+   {
+      const float azimuth = (static_cast<float>(bin) + 0.5f) /
+                            static_cast<float>(kAzimuthBinsPerDegree_);
+
+      auto upper = std::lower_bound(
+         radials.cbegin(),
+         radials.cend(),
+         azimuth,
+         [](const std::pair<float, std::uint16_t>& radial, float value)
+         { return radial.first < value; });
+      auto lower = (upper == radials.cbegin()) ? std::prev(radials.cend()) :
+                                                 std::prev(upper);
+      if (upper == radials.cend())
+      {
+         upper = radials.cbegin();
+      }
+
+      float upperDelta = std::fmod(upper->first - azimuth + 360.0f, 360.0f);
+      float lowerDelta = std::fmod(azimuth - lower->first + 360.0f, 360.0f);
+
+      if (upperDelta <= lowerDelta && upperDelta <= kMaxRadialGap_)
+      {
+         radialLut[bin] = upper->second;
+      }
+      else if (lowerDelta <= kMaxRadialGap_)
+      {
+         radialLut[bin] = lower->second;
+      }
+   }
+
+   return radialLut;
+}
+
+std::shared_ptr<CrossSection>
+CrossSection::Create(const std::shared_ptr<wsr88d::Ar2vFile>& file,
+                     wsr88d::rda::DataBlockType               dataBlockType,
+                     const common::Coordinate&                location)
+{
+   if (file == nullptr)
+   {
+      return nullptr;
+   }
+
+   std::vector<float> elevationCuts;
+   std::tie(std::ignore, std::ignore, elevationCuts) =
+      file->GetElevationScan(dataBlockType, 0.0f, {});
+
+   std::vector<CrossSectionCut> cuts {};
+   cuts.reserve(elevationCuts.size());
+
+   for (float elevationCut : elevationCuts)
+   {
+      std::shared_ptr<wsr88d::rda::ElevationScan> scan;
+      float                                       elevation;
+      std::tie(scan, elevation, std::ignore) =
+         file->GetElevationScan(dataBlockType, elevationCut, {});
+
+      if (scan == nullptr || scan->empty())
+      {
+         continue;
+      }
+
+      auto momentData0 =
+         scan->cbegin()->second->moment_data_block(dataBlockType);
+      if (momentData0 == nullptr)
+      {
+         continue;
+      }
+
+      const std::uint8_t wordSize = momentData0->data_word_size();
+
+      CrossSectionCut& cut = cuts.emplace_back();
+
+      cut.elevation_ = elevation;
+      cut.firstGateRange_ =
+         static_cast<float>(momentData0->data_moment_range_raw());
+      cut.gateSpacing_ = static_cast<float>(
+         momentData0->data_moment_range_sample_interval_raw());
+      cut.gateCount_ = momentData0->number_of_data_moment_gates();
+      cut.threshold_ = static_cast<std::uint16_t>(
+         std::max<std::int16_t>(2, momentData0->snr_threshold_raw()));
+
+      cut.azimuths_.reserve(scan->size());
+      cut.data_.resize(scan->size() * cut.gateCount_, 0u);
+
+      std::size_t radial = 0;
+      for (auto& radialPair : *scan)
+      {
+         auto& radialData = radialPair.second;
+         auto  momentData = radialData->moment_data_block(dataBlockType);
+
+         cut.azimuths_.push_back(radialData->azimuth_angle().value());
+
+         if (momentData != nullptr && momentData->data_word_size() == wordSize)
+         {
+            const std::size_t gates =
+               std::min<std::size_t>(momentData->number_of_data_moment_gates(),
+                                     cut.gateCount_);
+            auto output = cut.data_.begin() +
+                          static_cast<std::ptrdiff_t>(radial * cut.gateCount_);
+
+            if (wordSize == 8)
+            {
+               const std::uint8_t* dataMoments =
+                  static_cast<const std::uint8_t*>(momentData->data_moments());
+               std::copy(dataMoments, dataMoments + gates, output);
+            }
+            else if (wordSize == 16)
+            {
+               const std::uint16_t* dataMoments =
+                  static_cast<const std::uint16_t*>(momentData->data_moments());
+               std::copy(dataMoments, dataMoments + gates, output);
+            }
+         }
+
+         ++radial;
+      }
+   }
+
+   if (cuts.empty())
+   {
+      return nullptr;
+   }
+
+   logger_->debug("Created cross-section volume with {} cuts", cuts.size());
+
+   return std::make_shared<CrossSection>(location, std::move(cuts));
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
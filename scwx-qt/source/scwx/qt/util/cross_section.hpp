@@ -0,0 +1,141 @@
+#pragma once
+
+#include <scwx/common/geographic.hpp>
+#include <scwx/wsr88d/ar2v_file.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+/**
+ * @brief A single elevation cut of a radar volume.
+ */
+struct CrossSectionCut
+{
+   // Elevation angle of the cut, in degrees
+   float elevation_ {0.0f};
+
+   // Azimuth of each radial, in degrees
+   std::vector<float> azimuths_ {};
+
+   // Range to the center of the first gate and gate spacing, in meters
+   float firstGateRange_ {0.0f};
+   float gateSpacing_ {250.0f};
+
+   std::size_t gateCount_ {0};
+
+   // Data moments below the threshold are considered to have no data, with the
+   // exception of range folded data
+   std::uint16_t threshold_ {2};
+
+   // Data moments, ordered by radial then gate
+   std::vector<std::uint16_t> data_ {};
+};
+
+/**
+ * @brief Vertical cross-section sampled from a radar volume.
+ */
+struct CrossSectionGrid
+{
+   std::size_t rows_ {0};
+   std::size_t columns_ {0};
+
+   // Length of the cross-section along the surface, in meters
+   double length_ {0.0};
+
+   // Height of the top row, above radar level, in meters
+   float maxHeight_ {0.0f};
+
+   /**
+    * @brief Data moments, ordered by row (lowest to highest) then column
+    * (start to end). A value of 0 indicates no data.
+    */
+   std::vector<std::uint16_t> data_ {};
+};
+
+/**
+ * @brief Samples each elevation cut of a radar volume along a geodesic, to
+ * produce a range-height cross-section.
+ *
+ * Beam height is computed using the 4/3 effective earth radius model. An
+ * azimuth lookup table is built for each cut when the volume is created, such
+ * that sampling a cross-section only requires a table lookup per cut and
+ * column, and a gate index computation per cell. The volume is immutable once
+ * created, and may be sampled concurrently.
+ */
+class CrossSection
+{
+public:
+   struct Definition
+   {
+      common::Coordinate start_ {};
+      common::Coordinate end_ {};
+
+      std::size_t rows_ {200};
+      std::size_t columns_ {400};
+
+      // Height of the top row, above radar level, in meters
+      float maxHeight_ {18'000.0f};
+   };
+
+   /**
+    * @brief Creates a cross-section volume from a set of elevation cuts.
+    *
+    * @param [in] location Radar location
+    * @param [in] cuts Elevation cuts, in any order
+    */
+   explicit CrossSection(const common::Coordinate&    location,
+                         std::vector<CrossSectionCut> cuts);
+   ~CrossSection();
+
+   CrossSection(const CrossSection&)            = delete;
+   CrossSection& operator=(const CrossSection&) = delete;
+
+   CrossSection(CrossSection&&) noexcept;
+   CrossSection& operator=(CrossSection&&) noexcept;
+
+   /**
+    * @brief Elevation cuts, ordered by elevation angle
+    */
+   const std::vector<CrossSectionCut>& cuts() const;
+   const common::Coordinate&           location() const;
+
+   /**
+    * @brief Samples a cross-section from the volume.
+    *
+    * @param [in] definition Cross-section path and dimensions
+    * @param [out] grid Sampled cross-section. The existing data buffer is
+    * reused where possible.
+    */
+   void Sample(const Definition& definition, CrossSectionGrid& grid) const;
+
+   /**
+    * @brief Creates a cross-section volume from each elevation cut of a Level
+    * 2 file containing a data moment.
+    *
+    * @param [in] file Level 2 file
+    * @param [in] dataBlockType Data moment
+    * @param [in] location Radar location
+    *
+    * @return Cross-section volume, or nullptr if the data moment is not present
+    */
+   static std::shared_ptr<CrossSection>
+   Create(const std::shared_ptr<wsr88d::Ar2vFile>& file,
+          wsr88d::rda::DataBlockType               dataBlockType,
+          const common::Coordinate&                location);
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,205 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include <boost/unordered/unordered_flat_map.hpp>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+/**
+ * @brief Geographic bounds in degrees. If the minimum longitude is greater
+ * than the maximum longitude, the bounds cross the antimeridian.
+ */
+struct GeoBounds
+{
+   double minLatitude_ {-90.0};
+   double maxLatitude_ {90.0};
+   double minLongitude_ {-180.0};
+   double maxLongitude_ {180.0};
+
+   bool crosses_antimeridian() const { return minLongitude_ > maxLongitude_; }
+
+   bool Contains(double latitude, double longitude) const
+   {
+      if (latitude < minLatitude_ || latitude > maxLatitude_)
+      {
+         return false;
+      }
+
+      if (crosses_antimeridian())
+      {
+         return longitude >= minLongitude_ || longitude <= maxLongitude_;
+      }
+
+      return longitude >= minLongitude_ && longitude <= maxLongitude_;
+   }
+};
+
+/**
+ * @brief A grid index of point items, used to cull items against the map
+ * viewport.
+ *
+ * Items are bucketed into fixed-size latitude/longitude cells on insertion.
+ * Queries visit only the cells overlapping the requested bounds, and return
+ * items in insertion order, such that draw order is preserved. The index is
+ * not thread-safe.
+ *
+ * @tparam T Item type
+ */
+template<typename T>
+class GeoGridIndex
+{
+public:
+   /**
+    * @param [in] cellSize Cell size in degrees
+    */
+   explicit GeoGridIndex(double cellSize = 1.0) :
+       cellSize_ {cellSize},
+       rows_ {static_cast<std::int32_t>(std::ceil(180.0 / cellSize))},
+       columns_ {static_cast<std::int32_t>(std::ceil(360.0 / cellSize))}
+   {
+   }
+
+   bool        empty() const { return items_.empty(); }
+   std::size_t size() const { return items_.size(); }
+
+   void Clear()
+   {
+      items_.clear();
+      cells_.clear();
+   }
+
+   void Insert(double latitude, double longitude, const T& item)
+   {
+      const std::size_t index = items_.size();
+      items_.push_back({latitude, longitude, item});
+      cells_[CellKey(Row(latitude), Column(longitude))].push_back(index);
+   }
+
+   /**
+    * Calls a function for each item within the bounds, in insertion order.
+    *
+    * @param [in] bounds Geographic bounds
+    * @param [in] function Function called for each item
+    */
+   template<typename F>
+   void Query(const GeoBounds& bounds, F&& function) const
+   {
+      std::vector<std::size_t> indices {};
+
+      const std::int32_t firstRow = Row(bounds.minLatitude_);
+      const std::int32_t lastRow  = Row(bounds.maxLatitude_);
+
+      // Column ranges, split at the antimeridian
+      std::int32_t ranges[2][2] {
+         {Column(bounds.minLongitude_), Column(bounds.maxLongitude_)}, {1, 0}};
+      if (bounds.crosses_antimeridian())
+      {
+         ranges[0][1] = columns_ - 1;
+         ranges[1][0] = 0;
+         ranges[1][1] = Column(bounds.maxLongitude_);
+      }
+
+      std::size_t cellCount = 0u;
+      for (auto& range : ranges)
+      {
+         cellCount += static_cast<std::size_t>(
+            std::max(0, range[1] - range[0] + 1) * (lastRow - firstRow + 1));
+      }
+
+      auto AppendCell = [&](const std::vector<std::size_t>& cell)
+      {
+         for (std::size_t index : cell)
+         {
+            const Item& item = items_[index];
+            if (bounds.Contains(item.latitude_, item.longitude_))
+            {
+               indices.push_back(index);
+            }
+         }
+      };
+
+      if (cellCount > cells_.size())
+      {
+         // Zoomed out views overlap more cells than are occupied
+         for (auto& cell : cells_)
+         {
+            AppendCell(cell.second);
+         }
+      }
+      else
+      {
+         for (std::int32_t row = firstRow; row <= lastRow; ++row)
+         {
+            for (auto& range : ranges)
+            {
+               for (std::int32_t column = range[0]; column <= range[1];
+                    ++column)
+               {
+                  auto it = cells_.find(CellKey(row, column));
+                  if (it != cells_.cend())
+                  {
+                     AppendCell(it->second);
+                  }
+               }
+            }
+         }
+      }
+
+      std::sort(indices.begin(), indices.end());
+
+      for (std::size_t index : indices)
+      {
+         function(items_[index].item_);
+      }
+   }
+
+private:
+   struct Item
+   {
+      double latitude_;
+      double longitude_;
+      T      item_;
+   };
+
+   std::int32_t Row(double latitude) const
+   {
+      return std::clamp(
+         static_cast<std::int32_t>(std::floor((latitude + 90.0) / cellSize_)),
+         0,
+         rows_ - 1);
+   }
+
+   std::int32_t Column(double longitude) const
+   {
+      return std::clamp(
+         static_cast<std::int32_t>(std::floor((longitude + 180.0) / cellSize_)),
+         0,
+         columns_ - 1);
+   }
+
+   static std::int64_t CellKey(std::int32_t row, std::int32_t column)
+   {
+      return (static_cast<std::int64_t>(row) << 32) |
+             static_cast<std::uint32_t>(column);
+   }
+
+   double       cellSize_;
+   std::int32_t rows_;
+   std::int32_t columns_;
+
+   std::vector<Item>                                                 items_ {};
+   boost::unordered_flat_map<std::int64_t, std::vector<std::size_t>> cells_ {};
+};
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
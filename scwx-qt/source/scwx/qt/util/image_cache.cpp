@@ -0,0 +1,496 @@
+#include <scwx/qt/util/image_cache.hpp>
+#include <scwx/network/cpr.hpp>
+#include <scwx/util/logger.hpp>
+#include <scwx/util/metrics.hpp>
+
+#include <algorithm>
+#include <climits>
+#include <condition_variable>
+#include <execution>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <unordered_map>
+
+#if defined(_MSC_VER)
+#   pragma warning(push, 0)
+#endif
+
+#include <boost/gil/image.hpp>
+#include <boost/gil/image_view_factory.hpp>
+#include <cpr/cpr.h>
+#include <fmt/format.h>
+#include <stb_image.h>
+#include <QStandardPaths>
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+static const std::string logPrefix_ = "scwx::qt::util::image_cache";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+static constexpr long kHttpNotModified_ = 304;
+
+class ImageCache::Impl
+{
+public:
+   struct Entry
+   {
+      Validators               validators_ {};
+      std::weak_ptr<ImageType> image_ {};
+   };
+
+   explicit Impl(const std::string& cachePath,
+                 std::size_t        maxConnections,
+                 FetchFunction      fetch,
+                 DecodeFunction     decode) :
+       cachePath_ {cachePath},
+       maxConnections_ {std::max<std::size_t>(1u, maxConnections)},
+       fetch_ {std::move(fetch)},
+       decode_ {std::move(decode)}
+   {
+      if (fetch_ == nullptr)
+      {
+         fetch_ = [this](const std::string& url, const Validators& validators)
+         { return FetchRemote(url, validators); };
+      }
+      if (decode_ == nullptr)
+      {
+         decode_ = &ImageCache::DecodeImage;
+      }
+
+      InitializeCachePath();
+   }
+   ~Impl() = default;
+
+   void        InitializeCachePath();
+   FetchResult FetchRemote(const std::string& url,
+                           const Validators&  validators);
+   Validators  GetValidators(const std::string& url);
+   std::string ReadData(const std::string& url);
+   void        RemoveData(const std::string& url);
+   void        WriteData(const std::string& url,
+                         const Validators&  validators,
+                         const std::string& data);
+
+   std::filesystem::path MetadataPath(const std::string& url) const;
+   std::filesystem::path DataPath(const std::string& url) const;
+
+   std::filesystem::path cachePath_;
+   const std::size_t     maxConnections_;
+   FetchFunction         fetch_;
+   DecodeFunction        decode_;
+
+   std::unordered_map<std::string, Entry> entries_ {};
+   std::mutex                             entryMutex_ {};
+
+   // Connection pool. Each session retains its connection between requests.
+   std::vector<std::unique_ptr<cpr::Session>> idleSessions_ {};
+   std::size_t                                activeConnections_ {0u};
+   std::mutex                                 connectionMutex_ {};
+   std::condition_variable                    connectionCondition_ {};
+
+   scwx::util::metrics::Counter& downloadCounter_ {
+      scwx::util::metrics::Registry::Instance().GetCounter(
+         scwx::util::metrics::MetricName("image_cache", "downloaded"))};
+   scwx::util::metrics::Counter& notModifiedCounter_ {
+      scwx::util::metrics::Registry::Instance().GetCounter(
+         scwx::util::metrics::MetricName("image_cache", "not_modified"))};
+   scwx::util::metrics::Counter& decodeCounter_ {
+      scwx::util::metrics::Registry::Instance().GetCounter(
+         scwx::util::metrics::MetricName("image_cache", "decoded"))};
+};
+
+ImageCache::ImageCache(const std::string& cachePath,
+                       std::size_t        maxConnections,
+                       FetchFunction      fetch,
+                       DecodeFunction     decode) :
+    p(std::make_unique<Impl>(
+       cachePath, maxConnections, std::move(fetch), std::move(decode)))
+{
+}
+ImageCache::~ImageCache() = default;
+
+ImageCache::ImageCache(ImageCache&&) noexcept            = default;
+ImageCache& ImageCache::operator=(ImageCache&&) noexcept = default;
+
+void ImageCache::Impl::InitializeCachePath()
+{
+   if (cachePath_.empty() || std::filesystem::exists(cachePath_))
+   {
+      return;
+   }
+
+   std::error_code error;
+   if (!std::filesystem::create_directories(cachePath_, error))
+   {
+      logger_->error("Unable to create image cache directory: \"{}\" ({})",
+                     cachePath_.string(),
+                     error.message());
+      cachePath_.clear();
+   }
+}
+
+std::shared_ptr<ImageCache::ImageType> ImageCache::Get(const std::string& url)
+{
+   const Validators validators = p->GetValidators(url);
+
+   // Bound the number of concurrent requests
+   {
+      std::unique_lock lock {p->connectionMutex_};
+      p->connectionCondition_.wait(
+         lock, [this]() { return p->activeConnections_ < p->maxConnections_; });
+      ++p->activeConnections_;
+   }
+
+   FetchResult result {};
+
+   try
+   {
+      result = p->fetch_(url, validators);
+   }
+   catch (const std::exception& ex)
+   {
+      result.error_ = ex.what();
+   }
+
+   {
+      std::unique_lock lock {p->connectionMutex_};
+      --p->activeConnections_;
+   }
+   p->connectionCondition_.notify_one();
+
+   std::shared_ptr<ImageType> image = nullptr;
+
+   if (result.statusCode_ == kHttpNotModified_ && !validators.empty())
+   {
+      p->notModifiedCounter_.Increment();
+
+      std::unique_lock lock {p->entryMutex_};
+      image = p->entries_[url].image_.lock();
+      lock.unlock();
+
+      if (image != nullptr)
+      {
+         // The image is unchanged, and has already been decoded
+         return image;
+      }
+
+      // The image is unchanged, but was decoded by a previous session
+      const std::string data = p->ReadData(url);
+      if (!data.empty())
+      {
+         image = p->decode_(data);
+         p->decodeCounter_.Increment();
+      }
+
+      if (image == nullptr)
+      {
+         // The persisted image is unusable, request it unconditionally
+         p->RemoveData(url);
+         lock.lock();
+         p->entries_.erase(url);
+         lock.unlock();
+
+         return Get(url);
+      }
+
+      lock.lock();
+      p->entries_[url] = {validators, image};
+   }
+   else if (result.statusCode_ >= 200 && result.statusCode_ < 300)
+   {
+      p->downloadCounter_.Increment();
+
+      image = p->decode_(result.body_);
+      p->decodeCounter_.Increment();
+
+      if (image == nullptr)
+      {
+         logger_->error("Error decoding image: {}", url);
+         return nullptr;
+      }
+
+      if (!result.validators_.empty())
+      {
+         p->WriteData(url, result.validators_, result.body_);
+      }
+      else
+      {
+         p->RemoveData(url);
+      }
+
+      std::unique_lock lock {p->entryMutex_};
+      p->entries_[url] = {result.validators_, image};
+   }
+   else if (!result.error_.empty())
+   {
+      logger_->error("Error loading image: {} ({})", result.error_, url);
+   }
+   else
+   {
+      logger_->error(
+         "Error loading image: HTTP {} ({})", result.statusCode_, url);
+   }
+
+   return image;
+}
+
+ImageCache::Validators ImageCache::Impl::GetValidators(const std::string& url)
+{
+   std::unique_lock lock {entryMutex_};
+
+   auto it = entries_.find(url);
+   if (it != entries_.cend())
+   {
+      return it->second.validators_;
+   }
+
+   lock.unlock();
+
+   // Read persisted validators
+   Validators validators {};
+
+   if (!cachePath_.empty())
+   {
+      std::ifstream metadata {MetadataPath(url)};
+      std::string   storedUrl {};
+
+      if (std::getline(metadata, storedUrl) && storedUrl == url &&
+          std::getline(metadata, validators.etag_) &&
+          std::getline(metadata, validators.lastModified_) &&
+          std::filesystem::exists(DataPath(url)))
+      {
+         lock.lock();
+         entries_.emplace(url, Entry {validators, {}});
+      }
+      else
+      {
+         validators = {};
+      }
+   }
+
+   return validators;
+}
+
+std::string ImageCache::Impl::ReadData(const std::string& url)
+{
+   std::string data {};
+
+   if (!cachePath_.empty())
+   {
+      std::ifstream file {DataPath(url), std::ios_base::binary};
+      data.assign(std::istreambuf_iterator<char>(file),
+                  std::istreambuf_iterator<char>());
+   }
+
+   return data;
+}
+
+void ImageCache::Impl::WriteData(const std::string& url,
+                                 const Validators&  validators,
+                                 const std::string& data)
+{
+   if (cachePath_.empty())
+   {
+      return;
+   }
+
+   // Write the data before the metadata, such that the metadata only
+   // references complete data
+   std::error_code error;
+   std::filesystem::remove(MetadataPath(url), error);
+
+   const std::filesystem::path dataPath = DataPath(url);
+   std::filesystem::path       tempPath = dataPath;
+   tempPath += ".tmp";
+
+   {
+      std::ofstream file {tempPath, std::ios_base::binary};
+      file.write(data.data(), static_cast<std::streamsize>(data.size()));
+      if (!file)
+      {
+         logger_->warn("Unable to write cached image: {}", url);
+         return;
+      }
+   }
+
+   std::filesystem::rename(tempPath, dataPath, error);
+   if (error)
+   {
+      logger_->warn("Unable to write cached image: {}", error.message());
+      return;
+   }
+
+   std::ofstream metadata {MetadataPath(url)};
+   metadata << url << '\n'
+            << validators.etag_ << '\n'
+            << validators.lastModified_ << '\n';
+}
+
+void ImageCache::Impl::RemoveData(const std::string& url)
+{
+   if (cachePath_.empty())
+   {
+      return;
+   }
+
+   std::error_code error;
+   std::filesystem::remove(MetadataPath(url), error);
+   std::filesystem::remove(DataPath(url), error);
+}
+
+std::filesystem::path
+ImageCache::Impl::MetadataPath(const std::string& url) const
+{
+   return cachePath_ /
+          fmt::format("{:016x}.meta", std::hash<std::string> {}(url));
+}
+
+std::filesystem::path ImageCache::Impl::DataPath(const std::string& url) const
+{
+   return cachePath_ /
+          fmt::format("{:016x}.img", std::hash<std::string> {}(url));
+}
+
+ImageCache::FetchResult
+ImageCache::Impl::FetchRemote(const std::string& url,
+                              const Validators&  validators)
+{
+   std::unique_ptr<cpr::Session> session {};
+
+   {
+      std::unique_lock lock {connectionMutex_};
+      if (!idleSessions_.empty())
+      {
+         session = std::move(idleSessions_.back());
+         idleSessions_.pop_back();
+      }
+   }
+
+   if (session == nullptr)
+   {
+      session = std::make_unique<cpr::Session>();
+   }
+
+   cpr::Header header = network::cpr::GetHeader();
+   if (!validators.etag_.empty())
+   {
+      header.emplace("If-None-Match", validators.etag_);
+   }
+   if (!validators.lastModified_.empty())
+   {
+      header.emplace("If-Modified-Since", validators.lastModified_);
+   }
+
+   session->SetUrl(cpr::Url {url});
+   session->SetHeader(header);
+
+   cpr::Response response = session->Get();
+
+   FetchResult result {};
+   result.statusCode_ = response.status_code;
+   result.body_       = std::move(response.text);
+
+   if (auto it = response.header.find("ETag"); it != response.header.cend())
+   {
+      result.validators_.etag_ = it->second;
+   }
+   if (auto it = response.header.find("Last-Modified");
+       it != response.header.cend())
+   {
+      result.validators_.lastModified_ = it->second;
+   }
+
+   if (response.status_code == 0)
+   {
+      result.error_ = response.error.message;
+   }
+
+   {
+      // Return the session to the pool, retaining its connection
+      std::unique_lock lock {connectionMutex_};
+      idleSessions_.push_back(std::move(session));
+   }
+
+   return result;
+}
+
+std::shared_ptr<ImageCache::ImageType>
+ImageCache::DecodeImage(const std::string& data)
+{
+   // Use stbi, since we can only guess the image format
+   static constexpr int desiredChannels = 4;
+
+   int width;
+   int height;
+   int numChannels;
+
+   unsigned char* pixelData = stbi_load_from_memory(
+      reinterpret_cast<const unsigned char*>(data.data()),
+      static_cast<int>(std::clamp<std::size_t>(data.size(), 0, INT32_MAX)),
+      &width,
+      &height,
+      &numChannels,
+      desiredChannels);
+
+   if (pixelData == nullptr)
+   {
+      logger_->error("Error loading image: {}", stbi_failure_reason());
+      return nullptr;
+   }
+
+   // Create a view pointing to the STB image data
+   auto stbView = boost::gil::interleaved_view(
+      width,
+      height,
+      reinterpret_cast<boost::gil::rgba8_pixel_t*>(pixelData),
+      width * desiredChannels);
+
+   // Copy the view to the destination image
+   auto  image = std::make_shared<ImageType>();
+   *image      = ImageType(stbView);
+   auto& view  = boost::gil::view(*image);
+
+   // If no alpha channel, replace black with transparent
+   if (numChannels == 3)
+   {
+      std::for_each(
+         std::execution::par_unseq,
+         view.begin(),
+         view.end(),
+         [](boost::gil::rgba8_pixel_t& pixel)
+         {
+            static const boost::gil::rgba8_pixel_t kBlack {0, 0, 0, 255};
+            if (pixel == kBlack)
+            {
+               pixel[3] = 0;
+            }
+         });
+   }
+
+   stbi_image_free(pixelData);
+
+   return image;
+}
+
+ImageCache& ImageCache::Instance()
+{
+   static ImageCache instance_ {
+      QStandardPaths::writableLocation(QStandardPaths::CacheLocation)
+         .toStdString() +
+      "/images"};
+   return instance_;
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
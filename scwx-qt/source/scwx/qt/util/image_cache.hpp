@@ -0,0 +1,103 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+
+#include <boost/gil/typedefs.hpp>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+/**
+ * @brief A cache of decoded remote images, keyed by URL and validator.
+ *
+ * Images are revalidated on each request using the ETag and Last-Modified
+ * validators returned by the server. When a resource is unchanged, the
+ * previously decoded image is returned without downloading or decoding it
+ * again. Validators and encoded image data are persisted on disk, such that
+ * unchanged resources are not downloaded again after a restart.
+ *
+ * Concurrent requests are bounded by a maximum number of connections, which
+ * are reused between requests.
+ */
+class ImageCache
+{
+public:
+   typedef boost::gil::rgba8_image_t ImageType;
+
+   struct Validators
+   {
+      std::string etag_ {};
+      std::string lastModified_ {};
+
+      bool empty() const { return etag_.empty() && lastModified_.empty(); }
+   };
+
+   struct FetchResult
+   {
+      long        statusCode_ {0};
+      std::string body_ {};
+      Validators  validators_ {};
+      std::string error_ {};
+   };
+
+   /**
+    * @brief Performs a conditional request for a URL. If validators are
+    * present, the server may respond with 304 Not Modified.
+    */
+   typedef std::function<FetchResult(const std::string& url,
+                                     const Validators&  validators)>
+      FetchFunction;
+   typedef std::function<std::shared_ptr<ImageType>(const std::string& data)>
+      DecodeFunction;
+
+   /**
+    * @param [in] cachePath Directory in which to persist cached images. If
+    * empty, images are only cached in memory.
+    * @param [in] maxConnections Maximum number of concurrent requests
+    * @param [in] fetch Fetch function, or empty to use HTTP
+    * @param [in] decode Decode function, or empty to use stb_image
+    */
+   explicit ImageCache(const std::string& cachePath,
+                       std::size_t        maxConnections = 6u,
+                       FetchFunction      fetch          = {},
+                       DecodeFunction     decode         = {});
+   ~ImageCache();
+
+   ImageCache(const ImageCache&)            = delete;
+   ImageCache& operator=(const ImageCache&) = delete;
+
+   ImageCache(ImageCache&&) noexcept;
+   ImageCache& operator=(ImageCache&&) noexcept;
+
+   /**
+    * @brief Gets the image at a remote URL, blocking until it has been
+    * validated or downloaded. May be called concurrently.
+    *
+    * @param [in] url Remote image URL
+    *
+    * @return Decoded image, or nullptr if the image could not be loaded
+    */
+   std::shared_ptr<ImageType> Get(const std::string& url);
+
+   /**
+    * @brief Decodes an encoded image using stb_image. If the image has no
+    * alpha channel, black pixels are made transparent.
+    */
+   static std::shared_ptr<ImageType> DecodeImage(const std::string& data);
+
+   static ImageCache& Instance();
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
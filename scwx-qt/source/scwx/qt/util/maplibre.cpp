@@ -1,5 +1,7 @@
 #include <scwx/qt/util/maplibre.hpp>
 
+#include <limits>
+
 #include <QMapLibre/Utils>
 #include <mbgl/util/constants.hpp>
 
@@ -43,6 +45,85 @@ glm::vec2 GetMapScale(const QMapLibre::CustomLayerRenderParameters& params)
    return glm::vec2 {xScale, yScale};
 }
 
+GeoBounds GetViewportBounds(const QMapLibre::CustomLayerRenderParameters& params,
+                            float marginPixels)
+{
+   static constexpr double RAD2DEG_D = 180.0 / M_PI;
+   static constexpr double DEG2RAD_D = M_PI / 180.0;
+
+   // Screen coordinates are in degrees of longitude, scaled by the zoom level
+   const double mapScale = std::pow(2.0, params.zoom) *
+                           mbgl::util::tileSize_D / mbgl::util::DEGREES_MAX;
+   const glm::vec2 center =
+      LatLongToScreenCoordinate({params.latitude, params.longitude});
+
+   const double halfWidth  = params.width * 0.5 + marginPixels;
+   const double halfHeight = params.height * 0.5 + marginPixels;
+   const double bearingCos = std::cos(params.bearing * DEG2RAD_D);
+   const double bearingSin = std::sin(params.bearing * DEG2RAD_D);
+
+   // Rotate the viewport corners back into map space
+   double minX = std::numeric_limits<double>::max();
+   double maxX = std::numeric_limits<double>::lowest();
+   double minY = std::numeric_limits<double>::max();
+   double maxY = std::numeric_limits<double>::lowest();
+
+   for (double sx : {-halfWidth, halfWidth})
+   {
+      for (double sy : {-halfHeight, halfHeight})
+      {
+         const double x = sx * bearingCos + sy * bearingSin;
+         const double y = -sx * bearingSin + sy * bearingCos;
+
+         minX = std::min(minX, x);
+         maxX = std::max(maxX, x);
+         minY = std::min(minY, y);
+         maxY = std::max(maxY, y);
+      }
+   }
+
+   // Convert Web Mercator Y to latitude
+   auto ScreenYToLatitude = [](double y)
+   {
+      const double mercatorY = y + mbgl::util::LONGITUDE_MAX;
+
+      // Beyond the Web Mercator latitude limit, include the poles
+      if (std::abs(mercatorY) >= mbgl::util::LONGITUDE_MAX)
+      {
+         return std::copysign(90.0, mercatorY);
+      }
+
+      return (2.0 * std::atan(std::exp(mercatorY * DEG2RAD_D)) - M_PI / 2.0) *
+             RAD2DEG_D;
+   };
+
+   GeoBounds bounds {};
+
+   bounds.minLatitude_ = ScreenYToLatitude(center.y + minY / mapScale);
+   bounds.maxLatitude_ = ScreenYToLatitude(center.y + maxY / mapScale);
+
+   if ((maxX - minX) / mapScale < mbgl::util::DEGREES_MAX)
+   {
+      auto NormalizeLongitude = [](double longitude)
+      {
+         longitude = std::fmod(longitude + mbgl::util::LONGITUDE_MAX,
+                               mbgl::util::DEGREES_MAX);
+         if (longitude < 0.0)
+         {
+            longitude += mbgl::util::DEGREES_MAX;
+         }
+         return longitude - mbgl::util::LONGITUDE_MAX;
+      };
+
+      bounds.minLongitude_ =
+         NormalizeLongitude(params.longitude + minX / mapScale);
+      bounds.maxLongitude_ =
+         NormalizeLongitude(params.longitude + maxX / mapScale);
+   }
+
+   return bounds;
+}
+
 bool IsPointInPolygon(const std::vector<glm::vec2>& vertices,
                       const glm::vec2&              point)
 {
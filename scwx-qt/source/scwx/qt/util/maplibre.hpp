@@ -1,6 +1,7 @@
 #pragma once
 
 #include <scwx/qt/map/map_context.hpp>
+#include <scwx/qt/util/geo_grid_index.hpp>
 
 #include <QMapLibre/Map>
 #include <QMapLibre/Types>
@@ -21,6 +22,19 @@ units::length::meters<double>
 glm::mat4 GetMapMatrix(const QMapLibre::CustomLayerRenderParameters& params);
 glm::vec2 GetMapScale(const QMapLibre::CustomLayerRenderParameters& params);
 
+/**
+ * @brief Get the geographic bounds of the map viewport, accounting for map
+ * rotation.
+ *
+ * @param [in] params Map render parameters
+ * @param [in] marginPixels Margin added to each side of the viewport, such
+ * that items drawn with a screen offset or size are not culled prematurely
+ *
+ * @return Viewport bounds
+ */
+GeoBounds GetViewportBounds(const QMapLibre::CustomLayerRenderParameters& params,
+                            float marginPixels = 0.0f);
+
 /**
  * @brief Determine whether a point lies within a polygon
  *
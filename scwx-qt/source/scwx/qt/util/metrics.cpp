@@ -0,0 +1,120 @@
+#include <scwx/qt/util/metrics.hpp>
+#include <scwx/util/logger.hpp>
+#include <scwx/util/metrics.hpp>
+
+#include <boost/json.hpp>
+#include <imgui.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+namespace metrics
+{
+
+static const std::string logPrefix_ = "scwx::qt::util::metrics";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+static constexpr double kNanosecondsPerMillisecond_ = 1'000'000.0;
+
+static double ToMilliseconds(std::uint64_t nanoseconds)
+{
+   return static_cast<double>(nanoseconds) / kNanosecondsPerMillisecond_;
+}
+
+boost::json::value ToJson()
+{
+   boost::json::array metricsArray {};
+
+   for (auto& metric : scwx::util::metrics::Registry::Instance().Snapshot())
+   {
+      boost::json::object metricObject {
+         {"name", metric.name_},
+         {"type", scwx::util::metrics::GetMetricTypeName(metric.type_)}};
+
+      if (metric.type_ == scwx::util::metrics::MetricType::Histogram)
+      {
+         metricObject["count"]   = metric.count_;
+         metricObject["mean_ms"] = ToMilliseconds(metric.mean_);
+         metricObject["p50_ms"]  = ToMilliseconds(metric.p50_);
+         metricObject["p90_ms"]  = ToMilliseconds(metric.p90_);
+         metricObject["p99_ms"]  = ToMilliseconds(metric.p99_);
+         metricObject["max_ms"]  = ToMilliseconds(metric.max_);
+      }
+      else
+      {
+         metricObject["value"] = metric.value_;
+      }
+
+      metricsArray.emplace_back(std::move(metricObject));
+   }
+
+   return boost::json::object {{"metrics", std::move(metricsArray)}};
+}
+
+void DumpMetrics()
+{
+   logger_->info("Metrics: {}", boost::json::serialize(ToJson()));
+}
+
+void DrawMetricsOverlay()
+{
+   static constexpr int kColumnCount_ = 6;
+
+   ImGui::SetNextWindowPos(ImVec2 {10.0f, 10.0f}, ImGuiCond_FirstUseEver);
+   ImGui::SetNextWindowBgAlpha(0.75f);
+
+   if (ImGui::Begin("Pipeline Metrics",
+                    nullptr,
+                    ImGuiWindowFlags_AlwaysAutoResize |
+                       ImGuiWindowFlags_NoFocusOnAppearing))
+   {
+      if (ImGui::BeginTable("metrics", kColumnCount_))
+      {
+         ImGui::TableSetupColumn("Stage");
+         ImGui::TableSetupColumn("Count");
+         ImGui::TableSetupColumn("p50 (ms)");
+         ImGui::TableSetupColumn("p90 (ms)");
+         ImGui::TableSetupColumn("p99 (ms)");
+         ImGui::TableSetupColumn("Max (ms)");
+         ImGui::TableHeadersRow();
+
+         for (auto& metric :
+              scwx::util::metrics::Registry::Instance().Snapshot())
+         {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(metric.name_.c_str());
+
+            if (metric.type_ == scwx::util::metrics::MetricType::Histogram)
+            {
+               ImGui::TableNextColumn();
+               ImGui::Text("%llu",
+                           static_cast<unsigned long long>(metric.count_));
+
+               for (std::uint64_t value :
+                    {metric.p50_, metric.p90_, metric.p99_, metric.max_})
+               {
+                  ImGui::TableNextColumn();
+                  ImGui::Text("%.3f", ToMilliseconds(value));
+               }
+            }
+            else
+            {
+               ImGui::TableNextColumn();
+               ImGui::Text("%lld", static_cast<long long>(metric.value_));
+            }
+         }
+
+         ImGui::EndTable();
+      }
+   }
+   ImGui::End();
+}
+
+} // namespace metrics
+} // namespace util
+} // namespace qt
+} // namespace scwx
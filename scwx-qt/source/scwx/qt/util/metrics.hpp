@@ -0,0 +1,35 @@
+#pragma once
+
+#include <boost/json/value.hpp>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+namespace metrics
+{
+
+/**
+ * @brief Converts a snapshot of the pipeline metrics registry to JSON.
+ * Histogram values are reported in milliseconds.
+ */
+boost::json::value ToJson();
+
+/**
+ * @brief Writes a snapshot of the pipeline metrics registry to the log as
+ * JSON.
+ */
+void DumpMetrics();
+
+/**
+ * @brief Draws the pipeline metrics overlay window into the current ImGui
+ * frame.
+ */
+void DrawMetricsOverlay();
+
+} // namespace metrics
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,524 @@
+#include <scwx/qt/util/mosaic_grid.hpp>
+#include <scwx/qt/util/geographic_lib.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <execution>
+#include <limits>
+#include <numeric>
+#include <numbers>
+#include <unordered_map>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+static const std::string logPrefix_ = "scwx::qt::util::mosaic_grid";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+// Azimuth lookup resolution, in bins per degree
+static constexpr std::size_t kAzimuthBinsPerDegree_ = 10;
+static constexpr std::size_t kAzimuthBins_ = 360 * kAzimuthBinsPerDegree_;
+
+// Maximum angular distance from a radial to be considered within its beam
+static constexpr float kMaxRadialGap_ = 1.0f;
+
+static constexpr std::uint16_t kNoRadial_ = 0xffff;
+
+// Lower bound of the length of a degree of latitude, to ensure site coverage
+// is not underestimated
+static constexpr double kMetersPerDegree_  = 110'000.0;
+static constexpr double kMaxSiteLatitude_  = 89.0;
+static constexpr double kDegreesToRadians_ = std::numbers::pi / 180.0;
+
+struct MosaicSite
+{
+   std::shared_ptr<const MosaicSweep> sweep_ {};
+
+   // Radial index for each azimuth bin
+   std::vector<std::uint16_t> radialLut_ {};
+
+   // Grid cells covered by the site, [begin, end)
+   std::size_t rowBegin_ {0};
+   std::size_t rowEnd_ {0};
+   std::size_t columnBegin_ {0};
+   std::size_t columnEnd_ {0};
+
+   // Location and range for which the cell mapping was computed
+   common::Coordinate mappedLocation_ {};
+   float              mappedRange_ {0.0f};
+
+   // Azimuth (degrees) and range (meters) from the site to each covered cell
+   std::vector<float> azimuths_ {};
+   std::vector<float> ranges_ {};
+
+   std::size_t columns() const { return columnEnd_ - columnBegin_; }
+};
+
+class MosaicGrid::Impl
+{
+public:
+   explicit Impl(const Definition& definition, MosaicRule rule) :
+       definition_ {definition},
+       rule_ {rule},
+       tileRows_ {(definition.rows_ + kTileSize - 1) / kTileSize},
+       tileColumns_ {(definition.columns_ + kTileSize - 1) / kTileSize},
+       data_(definition.rows_ * definition.columns_, 0u)
+   {
+   }
+   ~Impl() = default;
+
+   void MapSite(MosaicSite& site) const;
+   void ResampleTile(std::size_t tile);
+   void ResampleTiles(const std::vector<std::size_t>& tiles);
+
+   std::vector<std::size_t> GetTiles(const MosaicSite& site) const;
+
+   static std::vector<std::uint16_t> BuildRadialLut(const MosaicSweep& sweep);
+
+   Definition  definition_;
+   MosaicRule  rule_;
+   std::size_t tileRows_;
+   std::size_t tileColumns_;
+
+   std::vector<std::uint8_t> data_;
+
+   std::unordered_map<std::string, MosaicSite> sites_ {};
+};
+
+MosaicGrid::MosaicGrid(const Definition& definition, MosaicRule rule) :
+    p(std::make_unique<Impl>(definition, rule))
+{
+}
+MosaicGrid::~MosaicGrid() = default;
+
+MosaicGrid::MosaicGrid(MosaicGrid&&) noexcept            = default;
+MosaicGrid& MosaicGrid::operator=(MosaicGrid&&) noexcept = default;
+
+float MosaicSweep::max_range() const
+{
+   return firstGateRange_ +
+          gateSpacing_ * (static_cast<float>(gateCount_) - 0.5f);
+}
+
+MosaicGrid::Definition
+MosaicGrid::Definition::Centered(const common::Coordinate& center,
+                                 double                    latitudeSpan,
+                                 double                    longitudeSpan,
+                                 double                    resolution)
+{
+   Definition definition {};
+
+   definition.resolution_ = resolution;
+   definition.rows_ =
+      static_cast<std::size_t>(std::ceil(latitudeSpan / resolution));
+   definition.columns_ =
+      static_cast<std::size_t>(std::ceil(longitudeSpan / resolution));
+   definition.minLatitude_ =
+      center.latitude_ -
+      static_cast<double>(definition.rows_) * resolution / 2.0;
+   definition.minLongitude_ =
+      center.longitude_ -
+      static_cast<double>(definition.columns_) * resolution / 2.0;
+
+   return definition;
+}
+
+common::Coordinate MosaicGrid::Definition::cell_center(std::size_t row,
+                                                       std::size_t column) const
+{
+   return {minLatitude_ + (static_cast<double>(row) + 0.5) * resolution_,
+           minLongitude_ + (static_cast<double>(column) + 0.5) * resolution_};
+}
+
+const std::vector<std::uint8_t>& MosaicGrid::data() const
+{
+   return p->data_;
+}
+
+const MosaicGrid::Definition& MosaicGrid::definition() const
+{
+   return p->definition_;
+}
+
+MosaicRule MosaicGrid::rule() const
+{
+   return p->rule_;
+}
+
+std::size_t MosaicGrid::site_count() const
+{
+   return p->sites_.size();
+}
+
+std::size_t MosaicGrid::tile_count() const
+{
+   return p->tileRows_ * p->tileColumns_;
+}
+
+MosaicGrid::TileExtent MosaicGrid::tile_extent(std::size_t tile) const
+{
+   const std::size_t rowBegin    = (tile / p->tileColumns_) * kTileSize;
+   const std::size_t columnBegin = (tile % p->tileColumns_) * kTileSize;
+
+   return {rowBegin,
+           std::min(rowBegin + kTileSize, p->definition_.rows_),
+           columnBegin,
+           std::min(columnBegin + kTileSize, p->definition_.columns_)};
+}
+
+std::vector<std::size_t> MosaicGrid::SetRule(MosaicRule rule)
+{
+   std::vector<std::size_t> tiles {};
+
+   if (p->rule_ != rule)
+   {
+      p->rule_ = rule;
+
+      tiles.resize(tile_count());
+      std::iota(tiles.begin(), tiles.end(), 0u);
+      p->ResampleTiles(tiles);
+   }
+
+   return tiles;
+}
+
+std::vector<std::size_t>
+MosaicGrid::UpdateSite(const std::string&                        siteId,
+                       const std::shared_ptr<const MosaicSweep>& sweep)
+{
+   if (sweep == nullptr)
+   {
+      return RemoveSite(siteId);
+   }
+
+   MosaicSite& site = p->sites_[siteId];
+
+   // Tiles previously covered by the site must also be resampled, in case the
+   // coverage has decreased
+   std::vector<std::size_t> tiles = p->GetTiles(site);
+
+   site.sweep_     = sweep;
+   site.radialLut_ = Impl::BuildRadialLut(*sweep);
+
+   if (site.mappedLocation_ != sweep->location_ ||
+       site.mappedRange_ < sweep->max_range())
+   {
+      // The cell mapping is only recomputed if the site moves or its range
+      // increases
+      p->MapSite(site);
+   }
+
+   std::vector<std::size_t> newTiles = p->GetTiles(site);
+   tiles.insert(tiles.end(), newTiles.cbegin(), newTiles.cend());
+   std::sort(tiles.begin(), tiles.end());
+   tiles.erase(std::unique(tiles.begin(), tiles.end()), tiles.end());
+
+   p->ResampleTiles(tiles);
+
+   return tiles;
+}
+
+std::vector<std::size_t> MosaicGrid::RemoveSite(const std::string& siteId)
+{
+   auto it = p->sites_.find(siteId);
+   if (it == p->sites_.end())
+   {
+      return {};
+   }
+
+   std::vector<std::size_t> tiles = p->GetTiles(it->second);
+   p->sites_.erase(it);
+
+   p->ResampleTiles(tiles);
+
+   return tiles;
+}
+
+std::vector<std::uint16_t>
+MosaicGrid::Impl::BuildRadialLut(const MosaicSweep& sweep)
+{
+   std::vector<std::uint16_t> radialLut(kAzimuthBins_, kNoRadial_);
+
+   if (sweep.azimuths_.empty())
+   {
+      return radialLut;
+   }
+
+   // Sort radials by azimuth
+   std::vector<std::pair<float, std::uint16_t>> radials {};
+   radials.reserve(sweep.azimuths_.size());
+   for (std::size_t i = 0; i < sweep.azimuths_.size(); ++i)
+   {
+      float azimuth = std::fmod(sweep.azimuths_[i], 360.0f);
+      if (azimuth < 0.0f)
+      {
+         azimuth += 360.0f;
+      }
+      radials.emplace_back(azimuth, static_cast<std::uint16_t>(i));
+   }
+   std::sort(radials.begin(), radials.end());
+
+   // Select the nearest radial for each azimuth bin
+   for (std::size_t bin = 0; bin < kAzimuthBins_; ++bin)
+   {
+      const float azimuth = (static_cast<float>(bin) + 0.5f) /
+                            static_cast<float>(kAzimuthBinsPerDegree_);
+
+      auto upper = std::lower_bound(
+         radials.cbegin(),
+         radials.cend(),
+         azimuth,
+         [](const std::pair<float, std::uint16_t>& radial, float value)
+         { return radial.first < value; });
+      auto lower = (upper == radials.cbegin()) ? std::prev(radials.cend()) :
+                                                 std::prev(upper);
+      if (upper == radials.cend())
+      {
+         upper = radials.cbegin();
+      }
+
+      float upperDelta = std::fmod(upper->first - azimuth + 360.0f, 360.0f);
+      float lowerDelta = std::fmod(azimuth - lower->first + 360.0f, 360.0f);
+
+      if (upperDelta <= lowerDelta && upperDelta <= kMaxRadialGap_)
+      {
+         radialLut[bin] = upper->second;
+      }
+      else if (lowerDelta <= kMaxRadialGap_)
+      {
+         radialLut[bin] = lower->second;
+      }
+   }
+
+   return radialLut;
+}
+
+void MosaicGrid::Impl::MapSite(MosaicSite& site) const
+{
+   const MosaicSweep& sweep    = *site.sweep_;
+   const double       maxRange = sweep.max_range();
+
+   // Determine the grid cells covered by the site
+   MosaicSweep::Extent extent {};
+
+   if (sweep.extent_.has_value())
+   {
+      extent = *sweep.extent_;
+   }
+   else
+   {
+      const double latitudeDelta = maxRange / kMetersPerDegree_;
+      const double maxLatitude =
+         std::min(std::abs(sweep.location_.latitude_) + latitudeDelta,
+                  kMaxSiteLatitude_);
+      const double longitudeDelta =
+         latitudeDelta / std::cos(maxLatitude * kDegreesToRadians_);
+
+      extent = {sweep.location_.latitude_ - latitudeDelta,
+                sweep.location_.longitude_ - longitudeDelta,
+                sweep.location_.latitude_ + latitudeDelta,
+                sweep.location_.longitude_ + longitudeDelta};
+   }
+
+   auto toIndex = [this](double value, double min, std::size_t count)
+   {
+      return static_cast<std::size_t>(
+         std::clamp((value - min) / definition_.resolution_,
+                    0.0,
+                    static_cast<double>(count)));
+   };
+
+   site.rowBegin_ = toIndex(
+      extent.minLatitude_, definition_.minLatitude_, definition_.rows_);
+   site.rowEnd_ = toIndex(
+      extent.maxLatitude_, definition_.minLatitude_, definition_.rows_);
+   site.columnBegin_ = toIndex(
+      extent.minLongitude_, definition_.minLongitude_, definition_.columns_);
+   site.columnEnd_ = toIndex(
+      extent.maxLongitude_, definition_.minLongitude_, definition_.columns_);
+
+   if (site.rowEnd_ < definition_.rows_)
+   {
+      ++site.rowEnd_;
+   }
+   if (site.columnEnd_ < definition_.columns_)
+   {
+      ++site.columnEnd_;
+   }
+
+   const std::size_t rows    = site.rowEnd_ - site.rowBegin_;
+   const std::size_t columns = site.columns();
+
+   site.azimuths_.resize(rows * columns);
+   site.ranges_.resize(rows * columns);
+   site.mappedLocation_ = sweep.location_;
+   site.mappedRange_    = static_cast<float>(maxRange);
+
+   // Compute the geodesic azimuth and range to each covered cell
+   std::vector<std::size_t> rowIndices(rows);
+   std::iota(rowIndices.begin(), rowIndices.end(), 0u);
+
+   const ::GeographicLib::Geodesic& geodesic = GeographicLib::DefaultGeodesic();
+
+   std::for_each(
+      std::execution::par,
+      rowIndices.cbegin(),
+      rowIndices.cend(),
+      [&](std::size_t r)
+      {
+         for (std::size_t c = 0; c < columns; ++c)
+         {
+            common::Coordinate cell = definition_.cell_center(
+               site.rowBegin_ + r, site.columnBegin_ + c);
+
+            double range;
+            double azimuth1;
+            double azimuth2;
+
+            geodesic.Inverse(sweep.location_.latitude_,
+                             sweep.location_.longitude_,
+                             cell.latitude_,
+                             cell.longitude_,
+                             range,
+                             azimuth1,
+                             azimuth2);
+
+            if (azimuth1 < 0.0)
+            {
+               azimuth1 += 360.0;
+            }
+
+            site.azimuths_[r * columns + c] = static_cast<float>(azimuth1);
+            site.ranges_[r * columns + c]   = static_cast<float>(range);
+         }
+      });
+
+   logger_->trace("Mapped {} cells", rows * columns);
+}
+
+std::vector<std::size_t>
+MosaicGrid::Impl::GetTiles(const MosaicSite& site) const
+{
+   std::vector<std::size_t> tiles {};
+
+   if (site.rowBegin_ >= site.rowEnd_ || site.columnBegin_ >= site.columnEnd_)
+   {
+      return tiles;
+   }
+
+   for (std::size_t tileRow = site.rowBegin_ / kTileSize;
+        tileRow <= (site.rowEnd_ - 1) / kTileSize;
+        ++tileRow)
+   {
+      for (std::size_t tileColumn = site.columnBegin_ / kTileSize;
+           tileColumn <= (site.columnEnd_ - 1) / kTileSize;
+           ++tileColumn)
+      {
+         tiles.push_back(tileRow * tileColumns_ + tileColumn);
+      }
+   }
+
+   return tiles;
+}
+
+void MosaicGrid::Impl::ResampleTiles(const std::vector<std::size_t>& tiles)
+{
+   std::for_each(std::execution::par,
+                 tiles.cbegin(),
+                 tiles.cend(),
+                 [this](std::size_t tile) { ResampleTile(tile); });
+}
+
+void MosaicGrid::Impl::ResampleTile(std::size_t tile)
+{
+   const std::size_t rowBegin    = (tile / tileColumns_) * kTileSize;
+   const std::size_t columnBegin = (tile % tileColumns_) * kTileSize;
+   const std::size_t rowEnd = std::min(rowBegin + kTileSize, definition_.rows_);
+   const std::size_t columnEnd =
+      std::min(columnBegin + kTileSize, definition_.columns_);
+
+   // Find the sites covering the tile
+   std::vector<const MosaicSite*> tileSites {};
+   for (auto& site : sites_)
+   {
+      const MosaicSite& s = site.second;
+      if (s.rowBegin_ < rowEnd && s.rowEnd_ > rowBegin &&
+          s.columnBegin_ < columnEnd && s.columnEnd_ > columnBegin)
+      {
+         tileSites.push_back(&s);
+      }
+   }
+
+   for (std::size_t row = rowBegin; row < rowEnd; ++row)
+   {
+      for (std::size_t column = columnBegin; column < columnEnd; ++column)
+      {
+         std::uint8_t value     = 0u;
+         float        bestRange = std::numeric_limits<float>::max();
+
+         for (const MosaicSite* site : tileSites)
+         {
+            if (row < site->rowBegin_ || row >= site->rowEnd_ ||
+                column < site->columnBegin_ || column >= site->columnEnd_)
+            {
+               continue;
+            }
+
+            const MosaicSweep& sweep = *site->sweep_;
+            const std::size_t  cell =
+               (row - site->rowBegin_) * site->columns() +
+               (column - site->columnBegin_);
+            const float range = site->ranges_[cell];
+
+            // Determine the gate containing the cell
+            const float gateOffset =
+               (range - sweep.firstGateRange_) / sweep.gateSpacing_ + 0.5f;
+            if (gateOffset < 0.0f ||
+                gateOffset >= static_cast<float>(sweep.gateCount_))
+            {
+               continue;
+            }
+
+            // Determine the radial containing the cell
+            const std::size_t bin =
+               static_cast<std::size_t>(site->azimuths_[cell] *
+                                        kAzimuthBinsPerDegree_) %
+               kAzimuthBins_;
+            const std::uint16_t radial = site->radialLut_[bin];
+            if (radial == kNoRadial_)
+            {
+               continue;
+            }
+
+            const std::uint8_t siteValue =
+               sweep.data_[radial * sweep.gateCount_ +
+                           static_cast<std::size_t>(gateOffset)];
+            if (siteValue < sweep.threshold_)
+            {
+               continue;
+            }
+
+            if (rule_ == MosaicRule::MaxValue)
+            {
+               value = std::max(value, siteValue);
+            }
+            else if (range < bestRange)
+            {
+               value     = siteValue;
+               bestRange = range;
+            }
+         }
+
+         data_[row * definition_.columns_ + column] = value;
+      }
+   }
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
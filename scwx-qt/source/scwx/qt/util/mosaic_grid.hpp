@@ -0,0 +1,180 @@
+#pragma once
+
+#include <scwx/common/geographic.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+enum class MosaicRule
+{
+   MaxValue,
+   NearestRadar
+};
+
+/**
+ * @brief A single radar sweep to be combined into a mosaic.
+ */
+struct MosaicSweep
+{
+   /**
+    * @brief Geographic extent of the sweep, in degrees.
+    */
+   struct Extent
+   {
+      double minLatitude_;
+      double minLongitude_;
+      double maxLatitude_;
+      double maxLongitude_;
+   };
+
+   // Radar location
+   common::Coordinate location_ {};
+
+   // Extent of the sweep coverage. If not set, the extent is estimated from
+   // the maximum range.
+   std::optional<Extent> extent_ {};
+
+   // Azimuth of each radial, in degrees
+   std::vector<float> azimuths_ {};
+
+   // Range to the center of the first gate and gate spacing, in meters
+   float firstGateRange_ {0.0f};
+   float gateSpacing_ {250.0f};
+
+   std::size_t gateCount_ {0};
+
+   // Data moments below the threshold are considered to have no data
+   std::uint8_t threshold_ {2};
+
+   // Data moments, ordered by radial then gate
+   std::vector<std::uint8_t> data_ {};
+
+   float max_range() const;
+};
+
+/**
+ * @brief Combines sweeps from multiple radars onto a shared latitude/longitude
+ * raster.
+ *
+ * The mapping from each raster cell to the azimuth and range of each radar is
+ * computed once per site and retained, such that new sweeps only require the
+ * raster to be resampled. The raster is divided into tiles, and only tiles
+ * covered by an updated site are resampled, in parallel. The grid is not
+ * thread-safe.
+ */
+class MosaicGrid
+{
+public:
+   struct Definition
+   {
+      // Southwest corner of the grid, in degrees
+      double minLatitude_ {0.0};
+      double minLongitude_ {0.0};
+
+      // Cell size, in degrees
+      double resolution_ {0.02};
+
+      std::size_t rows_ {0};
+      std::size_t columns_ {0};
+
+      /**
+       * @brief Creates a grid definition centered on a coordinate.
+       *
+       * @param [in] center Center of the grid
+       * @param [in] latitudeSpan Total height of the grid, in degrees
+       * @param [in] longitudeSpan Total width of the grid, in degrees
+       * @param [in] resolution Cell size, in degrees
+       */
+      static Definition Centered(const common::Coordinate& center,
+                                 double                    latitudeSpan,
+                                 double                    longitudeSpan,
+                                 double                    resolution);
+
+      common::Coordinate cell_center(std::size_t row, std::size_t column) const;
+   };
+
+   /**
+    * @brief Grid cells contained by a tile, [begin, end).
+    */
+   struct TileExtent
+   {
+      std::size_t rowBegin_;
+      std::size_t rowEnd_;
+      std::size_t columnBegin_;
+      std::size_t columnEnd_;
+   };
+
+   static constexpr std::size_t kTileSize = 64;
+
+   explicit MosaicGrid(const Definition& definition,
+                       MosaicRule        rule = MosaicRule::MaxValue);
+   ~MosaicGrid();
+
+   MosaicGrid(const MosaicGrid&)            = delete;
+   MosaicGrid& operator=(const MosaicGrid&) = delete;
+
+   MosaicGrid(MosaicGrid&&) noexcept;
+   MosaicGrid& operator=(MosaicGrid&&) noexcept;
+
+   /**
+    * @brief Mosaic data moments, ordered by row (south to north) then column
+    * (west to east). A value of 0 indicates no data.
+    */
+   const std::vector<std::uint8_t>& data() const;
+   const Definition&                definition() const;
+   MosaicRule                       rule() const;
+   std::size_t                      site_count() const;
+   std::size_t                      tile_count() const;
+   TileExtent                       tile_extent(std::size_t tile) const;
+
+   /**
+    * @brief Sets the rule used to resolve overlapping coverage, and resamples
+    * all tiles if the rule has changed.
+    *
+    * @param [in] rule Mosaic rule
+    *
+    * @return Tiles resampled
+    */
+   std::vector<std::size_t> SetRule(MosaicRule rule);
+
+   /**
+    * @brief Updates the sweep for a radar site, and resamples the tiles
+    * covered by the site.
+    *
+    * @param [in] siteId Radar site ID
+    * @param [in] sweep Latest sweep for the radar site
+    *
+    * @return Tiles resampled
+    */
+   std::vector<std::size_t>
+   UpdateSite(const std::string&                        siteId,
+              const std::shared_ptr<const MosaicSweep>& sweep);
+
+   /**
+    * @brief Removes a radar site from the mosaic, and resamples the tiles
+    * previously covered by the site.
+    *
+    * @param [in] siteId Radar site ID
+    *
+    * @return Tiles resampled
+    */
+   std::vector<std::size_t> RemoveSite(const std::string& siteId);
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,350 @@
+#include <scwx/qt/util/polar_sweep.hpp>
+#include <scwx/common/constants.hpp>
+#include <scwx/common/geographic.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+static constexpr std::uint16_t kRangeFolded_ = 1u;
+
+// WGS84 ellipsoid parameters
+static constexpr double kEquatorialRadius_ = 6378137.0;
+static constexpr double kFlattening_       = 1.0 / 298.257223563;
+static constexpr double kEccentricitySquared_ =
+   kFlattening_ * (2.0 - kFlattening_);
+
+static constexpr float kDefaultAzimuthDelta_ = 0.5f;
+
+std::size_t PolarSweep::FindRadial(float azimuth) const
+{
+   // Normalize the azimuth to [azimuths_[0], azimuths_[0] + 360)
+   const float firstAzimuth = azimuths_.front();
+
+   float offset = std::fmod(azimuth - firstAzimuth, 360.0f);
+   if (offset < 0.0f)
+   {
+      offset += 360.0f;
+   }
+
+   // Find the last row starting at or before the azimuth
+   auto it = std::upper_bound(
+      azimuths_.cbegin(), azimuths_.cend(), firstAzimuth + offset);
+
+   return static_cast<std::size_t>(std::distance(azimuths_.cbegin(), it)) - 1;
+}
+
+std::uint16_t
+PolarSweep::Sample(float azimuth, float range, std::size_t component) const
+{
+   if (radialCount_ == 0 || component >= componentCount_ || range < 0.0f)
+   {
+      return 0u;
+   }
+
+   const std::size_t row    = FindRadial(azimuth);
+   const std::size_t column = static_cast<std::size_t>(range / gateSize_);
+
+   if (column >= gateCount_)
+   {
+      return 0u;
+   }
+
+   return data_[(row * gateCount_ + column) * componentCount_ + component];
+}
+
+PolarSiteFrame PolarSiteFrame::Create(double latitude, double longitude)
+{
+   const double phi    = latitude * common::kDegreesToRadians;
+   const double lambda = longitude * common::kDegreesToRadians;
+
+   const double sinPhi    = std::sin(phi);
+   const double cosPhi    = std::cos(phi);
+   const double sinLambda = std::sin(lambda);
+   const double cosLambda = std::cos(lambda);
+
+   const double w = 1.0 - kEccentricitySquared_ * sinPhi * sinPhi;
+   const double n = kEquatorialRadius_ / std::sqrt(w);
+   const double m = kEquatorialRadius_ * (1.0 - kEccentricitySquared_) /
+                    (w * std::sqrt(w));
+
+   PolarSiteFrame frame {};
+
+   frame.origin_ = {static_cast<float>(n * cosPhi * cosLambda),
+                    static_cast<float>(n * cosPhi * sinLambda),
+                    static_cast<float>(n * (1.0 - kEccentricitySquared_) *
+                                       sinPhi)};
+
+   // East, north and up unit vectors
+   frame.enu_ = {static_cast<float>(-sinLambda),
+                 static_cast<float>(cosLambda),
+                 0.0f,
+                 static_cast<float>(-sinPhi * cosLambda),
+                 static_cast<float>(-sinPhi * sinLambda),
+                 static_cast<float>(cosPhi),
+                 static_cast<float>(cosPhi * cosLambda),
+                 static_cast<float>(cosPhi * sinLambda),
+                 static_cast<float>(sinPhi)};
+
+   frame.meridionalRadius_    = static_cast<float>(m);
+   frame.primeVerticalRadius_ = static_cast<float>(n);
+
+   return frame;
+}
+
+std::array<float, 2> PolarSiteFrame::AzimuthRange(double latitude,
+                                                  double longitude) const
+{
+   // Calculated in single precision, matching the fragment shader
+   constexpr float kDegreesToRadians =
+      static_cast<float>(common::kDegreesToRadians);
+   constexpr float kEccentricitySquared =
+      static_cast<float>(kEccentricitySquared_);
+
+   const float phi    = static_cast<float>(latitude) * kDegreesToRadians;
+   const float lambda = static_cast<float>(longitude) * kDegreesToRadians;
+
+   const float sinPhi = std::sin(phi);
+   const float cosPhi = std::cos(phi);
+   const float n      = static_cast<float>(kEquatorialRadius_) /
+                   std::sqrt(1.0f - kEccentricitySquared * sinPhi * sinPhi);
+
+   const std::array<float, 3> d {
+      n * cosPhi * std::cos(lambda) - origin_[0],
+      n * cosPhi * std::sin(lambda) - origin_[1],
+      n * (1.0f - kEccentricitySquared) * sinPhi - origin_[2]};
+
+   const float east  = enu_[0] * d[0] + enu_[1] * d[1] + enu_[2] * d[2];
+   const float north = enu_[3] * d[0] + enu_[4] * d[1] + enu_[5] * d[2];
+
+   const float alpha = std::atan2(east, north);
+   float       azimuth = alpha / kDegreesToRadians;
+   if (azimuth < 0.0f)
+   {
+      azimuth += 360.0f;
+   }
+
+   // Arc length along the normal section, using its radius of curvature
+   // (Euler's theorem)
+   const float cosAlpha = std::cos(alpha);
+   const float sinAlpha = std::sin(alpha);
+   const float radius =
+      meridionalRadius_ * primeVerticalRadius_ /
+      (primeVerticalRadius_ * cosAlpha * cosAlpha +
+       meridionalRadius_ * sinAlpha * sinAlpha);
+   const float chord = std::sqrt(d[0] * d[0] + d[1] * d[1] + d[2] * d[2]);
+   const float range =
+      2.0f * radius * std::asin(std::min(1.0f, chord / (2.0f * radius)));
+
+   return {azimuth, range};
+}
+
+bool IsPolarSweepIncomplete(float firstAzimuth, float lastAzimuth)
+{
+   // Assume the data is incomplete when the delta between the first and last
+   // angles is greater than 2.5 degrees.
+   constexpr units::degrees<float> kIncompleteDataAngleThreshold_ {2.5};
+
+   return common::GetAngleDelta(units::degrees<float> {firstAzimuth},
+                                units::degrees<float> {lastAzimuth}) >
+          kIncompleteDataAngleThreshold_;
+}
+
+PolarSweep PackPolarSweep(const std::vector<PolarRadial>& radials,
+                          float                           gateSize,
+                          std::uint16_t                   snrThreshold)
+{
+   PolarSweep sweep {};
+
+   if (radials.empty() || gateSize < 1.0f ||
+       radials.front().index_ >= common::MAX_0_5_DEGREE_RADIALS)
+   {
+      return sweep;
+   }
+
+   const PolarRadial& firstRadial = radials.front();
+   const PolarRadial& lastRadial  = radials.back();
+
+   // Determine the number of rows, including an empty row at the end of
+   // incomplete sweeps
+   std::size_t radialCount = lastRadial.index_ + 1u;
+   if (IsPolarSweepIncomplete(firstRadial.azimuth_, lastRadial.azimuth_))
+   {
+      ++radialCount;
+   }
+   radialCount =
+      std::min<std::size_t>(radialCount, common::MAX_0_5_DEGREE_RADIALS);
+
+   // Determine the number of columns
+   const std::int32_t gateSizeMeters = static_cast<std::int32_t>(gateSize);
+   const std::size_t  maxGates       = firstRadial.gateCount_;
+
+   struct GateRange
+   {
+      std::int32_t startGate_;
+      std::int32_t endGate_;
+      std::int32_t binSize_;
+   };
+
+   auto GetGateRange = [&](const PolarRadial& radial)
+   {
+      // Compute gate interval
+      const std::int32_t dataMomentInterval  = radial.gateInterval_;
+      const std::int32_t dataMomentIntervalH = dataMomentInterval / 2;
+      const std::int32_t dataMomentRange =
+         std::max<std::int32_t>(radial.firstGateRange_, dataMomentIntervalH);
+
+      // Compute bin size (number of base gates per bin)
+      const std::int32_t binSize =
+         std::max<std::int32_t>(1, dataMomentInterval / gateSizeMeters);
+
+      // Compute gate range [startGate, endGate)
+      const std::int32_t startGate =
+         (dataMomentRange - dataMomentIntervalH) / gateSizeMeters;
+      const std::int32_t numberOfDataMomentGates =
+         static_cast<std::int32_t>(std::min(radial.gateCount_, maxGates));
+      const std::int32_t endGate = std::min<std::int32_t>(
+         startGate + numberOfDataMomentGates * binSize,
+         static_cast<std::int32_t>(common::MAX_DATA_MOMENT_GATES));
+
+      return GateRange {startGate, endGate, binSize};
+   };
+
+   std::int32_t gateCount = 0;
+   bool         cfpPresent {false};
+
+   for (const PolarRadial& radial : radials)
+   {
+      gateCount  = std::max(gateCount, GetGateRange(radial).endGate_);
+      cfpPresent = cfpPresent || radial.cfpMoments_ != nullptr;
+   }
+
+   sweep.radialCount_    = radialCount;
+   sweep.gateCount_      = static_cast<std::size_t>(gateCount);
+   sweep.componentCount_ = cfpPresent ? 2u : 1u;
+   sweep.gateSize_       = gateSize;
+   sweep.azimuths_.resize(radialCount);
+   sweep.data_.resize(radialCount * sweep.gateCount_ * sweep.componentCount_);
+
+   // Assign azimuths of present radials, unwrapped to be non-decreasing
+   std::vector<bool> azimuthKnown(radialCount, false);
+   float             previousAzimuth = std::numeric_limits<float>::lowest();
+
+   for (const PolarRadial& radial : radials)
+   {
+      if (radial.index_ >= radialCount)
+      {
+         break;
+      }
+
+      float azimuth = radial.azimuth_;
+      while (azimuth < previousAzimuth - 180.0f)
+      {
+         azimuth += 360.0f;
+      }
+      azimuth = std::max(azimuth, previousAzimuth);
+
+      sweep.azimuths_[radial.index_] = azimuth;
+      azimuthKnown[radial.index_]    = true;
+      previousAzimuth                = azimuth;
+   }
+
+   // Extrapolate azimuths of missing radials. Leading radials are assumed to
+   // be a half degree apart, and subsequent radials continue the delta
+   // between the two preceding radials.
+   const std::size_t firstRow = firstRadial.index_;
+
+   for (std::size_t row = 0; row < firstRow && row < radialCount; ++row)
+   {
+      sweep.azimuths_[row] =
+         sweep.azimuths_[firstRow] -
+         kDefaultAzimuthDelta_ * static_cast<float>(firstRow - row);
+   }
+
+   for (std::size_t row = firstRow + 1; row < radialCount; ++row)
+   {
+      if (!azimuthKnown[row])
+      {
+         const float delta =
+            (row >= 2 && row - 2 >= firstRow) ?
+               sweep.azimuths_[row - 1] - sweep.azimuths_[row - 2] :
+               kDefaultAzimuthDelta_;
+
+         sweep.azimuths_[row] = sweep.azimuths_[row - 1] + delta;
+      }
+   }
+
+   // Rows may not extend beyond a full rotation
+   const float maxAzimuth = sweep.azimuths_.front() + 360.0f;
+   for (std::size_t row = 1; row < radialCount; ++row)
+   {
+      sweep.azimuths_[row] = std::clamp(
+         sweep.azimuths_[row], sweep.azimuths_[row - 1], maxAzimuth);
+   }
+
+   // Pack data moments
+   const std::size_t componentCount = sweep.componentCount_;
+
+   for (const PolarRadial& radial : radials)
+   {
+      if (radial.index_ >= radialCount)
+      {
+         break;
+      }
+
+      const GateRange gateRange = GetGateRange(radial);
+
+      std::uint16_t* row =
+         &sweep.data_[radial.index_ * sweep.gateCount_ * componentCount];
+
+      for (std::int32_t gate = gateRange.startGate_, i = 0;
+           gate + gateRange.binSize_ <= gateRange.endGate_;
+           gate += gateRange.binSize_, ++i)
+      {
+         if (gate < 0)
+         {
+            continue;
+         }
+
+         const std::uint16_t dataValue =
+            (radial.moments8_ != nullptr) ? radial.moments8_[i] :
+            (radial.moments16_ != nullptr) ? radial.moments16_[i] :
+                                              0u;
+         if (dataValue < snrThreshold && dataValue != kRangeFolded_)
+         {
+            continue;
+         }
+
+         const std::uint16_t cfpValue =
+            (radial.cfpMoments_ != nullptr) ? radial.cfpMoments_[i] : 0u;
+
+         // As with the triangle sweep, the first bin extends from the radar
+         // site to the first base gate
+         const std::int32_t columns = (gate > 0) ? gateRange.binSize_ : 1;
+
+         for (std::int32_t column = gate; column < gate + columns; ++column)
+         {
+            std::uint16_t* texel = &row[column * componentCount];
+
+            texel[0] = dataValue;
+            if (componentCount > 1)
+            {
+               texel[1] = cfpValue;
+            }
+         }
+      }
+   }
+
+   return sweep;
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+/**
+ * @brief Moment data of a single radial, as input to PackPolarSweep.
+ */
+struct PolarRadial
+{
+   std::uint16_t index_ {0};   ///< Radial index within the sweep
+   float         azimuth_ {0}; ///< Azimuth angle (degrees)
+
+   std::int32_t firstGateRange_ {0}; ///< Range to center of first gate (m)
+   std::int32_t gateInterval_ {0};   ///< Gate sample interval (m)
+   std::size_t  gateCount_ {0};      ///< Number of gates
+
+   const std::uint8_t*  moments8_ {nullptr};   ///< 8-bit data moments
+   const std::uint16_t* moments16_ {nullptr};  ///< 16-bit data moments
+   const std::uint8_t*  cfpMoments_ {nullptr}; ///< Clutter filter power removed
+};
+
+/**
+ * @brief A radial sweep packed as a radials x gates texture, for rendering
+ * with a polar lookup in a fragment shader.
+ *
+ * Each row holds one radial, covering azimuths from its start azimuth to the
+ * start azimuth of the following row. The last row extends to the first
+ * row's azimuth plus 360 degrees. Each column holds one base gate, covering
+ * ranges [column, column + 1) * gateSize_. A value of 0 is not displayed.
+ */
+struct PolarSweep
+{
+   std::size_t radialCount_ {0};    ///< Number of rows
+   std::size_t gateCount_ {0};      ///< Number of columns
+   std::size_t componentCount_ {1}; ///< 1, or 2 if CFP is present
+   float       gateSize_ {0.0f};    ///< Base gate size (m)
+
+   /**
+    * Start azimuth of each row (degrees). Azimuths are non-decreasing, and lie
+    * within [azimuths_[0], azimuths_[0] + 360).
+    */
+   std::vector<float> azimuths_ {};
+
+   /**
+    * Row-major data moments, with interleaved components (data moment,
+    * followed by CFP when present).
+    */
+   std::vector<std::uint16_t> data_ {};
+
+   /**
+    * @brief Finds the row containing an azimuth, as the fragment shader does.
+    *
+    * @param [in] azimuth Azimuth angle (degrees)
+    *
+    * @return Row index. Undefined if the sweep is empty.
+    */
+   std::size_t FindRadial(float azimuth) const;
+
+   /**
+    * @brief Samples the sweep at a polar coordinate, as the fragment shader
+    * does.
+    *
+    * @param [in] azimuth Azimuth angle (degrees)
+    * @param [in] range Range from the radar (m)
+    * @param [in] component Component index (0 for the data moment, 1 for CFP)
+    *
+    * @return Packed value, or 0 if outside of the sweep
+    */
+   std::uint16_t
+   Sample(float azimuth, float range, std::size_t component = 0) const;
+};
+
+/**
+ * @brief Earth-centered, earth-fixed frame of a radar site, used to convert
+ * coordinates to azimuth and range relative to the site on the WGS84
+ * ellipsoid. Values are single precision, as uploaded to the shader.
+ */
+struct PolarSiteFrame
+{
+   std::array<float, 3> origin_ {}; ///< Site ECEF position (m)
+   std::array<float, 9> enu_ {};    ///< ECEF to ENU rotation (row-major)
+
+   float meridionalRadius_ {0.0f};    ///< Meridional radius of curvature (m)
+   float primeVerticalRadius_ {0.0f}; ///< Prime vertical radius of curvature
+
+   /**
+    * @brief Calculates the azimuth and range of a coordinate relative to the
+    * site, using the normal section through the site. This is the CPU
+    * equivalent of the fragment shader lookup.
+    *
+    * @param [in] latitude Latitude (degrees)
+    * @param [in] longitude Longitude (degrees)
+    *
+    * @return Azimuth (degrees, [0, 360)) and range (m)
+    */
+   std::array<float, 2> AzimuthRange(double latitude, double longitude) const;
+
+   static PolarSiteFrame Create(double latitude, double longitude);
+};
+
+/**
+ * @brief Packs radials into a polar sweep texture.
+ *
+ * Gates are positioned identically to the triangle sweep vertices, using the
+ * base gate size. Gates with a coarser interval are repeated across multiple
+ * columns. Missing radials are left empty, with an azimuth extrapolated from
+ * the preceding radials. If the sweep is incomplete (the first and last
+ * azimuths are more than 2.5 degrees apart), an empty radial is appended to
+ * avoid stretching the last radial across the gap.
+ *
+ * @param [in] radials Radials, sorted by index
+ * @param [in] gateSize Base gate size (m)
+ * @param [in] snrThreshold Minimum data moment value to display. Range folded
+ * values are always displayed.
+ *
+ * @return Packed sweep
+ */
+PolarSweep PackPolarSweep(const std::vector<PolarRadial>& radials,
+                          float                           gateSize,
+                          std::uint16_t                   snrThreshold);
+
+/**
+ * @brief Determines whether a sweep is incomplete, based on the delta between
+ * the first and last azimuths being greater than 2.5 degrees.
+ */
+bool IsPolarSweepIncomplete(float firstAzimuth, float lastAzimuth);
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
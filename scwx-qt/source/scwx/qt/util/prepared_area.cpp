@@ -0,0 +1,562 @@
+#include <scwx/qt/util/prepared_area.hpp>
+#include <scwx/qt/util/geographic_lib.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <numbers>
+
+#include <GeographicLib/Gnomonic.hpp>
+#include <geos/geom/CoordinateSequence.h>
+#include <geos/geom/GeometryFactory.h>
+#include <geos/geom/LineSegment.h>
+#include <geos/geom/LinearRing.h>
+#include <geos/geom/Point.h>
+#include <geos/geom/Polygon.h>
+#include <geos/geom/prep/PreparedGeometry.h>
+#include <geos/geom/prep/PreparedGeometryFactory.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+static const std::string logPrefix_ = "scwx::qt::util::prepared_area";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+static const geos::geom::GeometryFactory* factory_ =
+   geos::geom::GeometryFactory::getDefaultInstance();
+
+// Accounts for the difference between geodesics on the ellipsoid and great
+// circles on the sphere, and only affects quick rejection
+static constexpr double kBoundsPadding_ = 0.05;
+
+// Lower bound of the length of a degree of latitude, to ensure the query
+// bounds are not smaller than the query distance
+static constexpr double kMetersPerDegree_ = 110'000.0;
+
+// Limit longitude expansion near the poles
+static constexpr double kMaxQueryLatitude_ = 89.0;
+
+// Relative difference between great circle distances on the sphere and
+// geodesic distances on the ellipsoid, used to select the edges which may be
+// closest to a point
+static constexpr double kEdgeDistanceMargin_ = 0.01;
+
+static constexpr double kDegreesToRadians_ = std::numbers::pi / 180.0;
+static constexpr double kRadiansToDegrees_ = 180.0 / std::numbers::pi;
+
+using Vector3 = std::array<double, 3>;
+
+static Vector3 ToVector(const common::Coordinate& coordinate);
+static Vector3 Cross(const Vector3& a, const Vector3& b);
+static double  Dot(const Vector3& a, const Vector3& b);
+static double  Angle(const Vector3& a, const Vector3& b);
+static Vector3 Normalize(const Vector3& v);
+static void    ExtendLatitudeBounds(const common::Coordinate& a,
+                                    const common::Coordinate& b,
+                                    double&                   minLatitude,
+                                    double&                   maxLatitude);
+
+class PreparedArea::Impl
+{
+public:
+   explicit Impl(const std::vector<common::Coordinate>& area);
+   ~Impl() = default;
+
+   struct Edge
+   {
+      std::size_t a_;
+      std::size_t b_;
+      Vector3     normal_; ///< Unit normal, or zero if degenerate
+   };
+
+   void   PrepareGeometry();
+   bool   BoundsContain(const common::Coordinate& point) const;
+   double EdgeAngle(const Vector3& point, const Edge& edge) const;
+   units::length::meters<double>
+   CentroidDistance(const common::Coordinate& point) const;
+
+   ::GeographicLib::Gnomonic gnomonic_ {GeographicLib::DefaultGeodesic()};
+
+   std::vector<common::Coordinate> area_;
+   common::Coordinate              centroid_ {};
+   Bounds                          bounds_ {};
+   bool                            valid_ {false};
+
+   // Vertices as unit vectors, and the great circle edges between them
+   std::vector<Vector3> vertices_ {};
+   std::vector<Edge>    edges_ {};
+
+   // Area projected around its centroid, in which great circle edges are
+   // straight lines, and prepared for containment queries
+   std::unique_ptr<geos::geom::Polygon>                polygon_ {};
+   std::unique_ptr<geos::geom::prep::PreparedGeometry> preparedPolygon_ {};
+};
+
+PreparedArea::PreparedArea(const std::vector<common::Coordinate>& area) :
+    p(std::make_unique<Impl>(area))
+{
+}
+PreparedArea::~PreparedArea() = default;
+
+PreparedArea::PreparedArea(PreparedArea&&) noexcept            = default;
+PreparedArea& PreparedArea::operator=(PreparedArea&&) noexcept = default;
+
+PreparedArea::Impl::Impl(const std::vector<common::Coordinate>& area) :
+    area_ {area}
+{
+   if (area.empty())
+   {
+      return;
+   }
+
+   centroid_ = common::GetCentroid(area);
+
+   // Cannot have an area with just two points
+   valid_ =
+      !(area.size() <= 2 || (area.size() == 3 && area.front() == area.back()));
+
+   // Determine the geographic bounds of the area, including the latitude
+   // reached by great circle edges which bow poleward of their vertices
+   auto [minLongitude, maxLongitude] = std::minmax_element(
+      area.cbegin(),
+      area.cend(),
+      [](const common::Coordinate& a, const common::Coordinate& b)
+      { return a.longitude_ < b.longitude_; });
+
+   double minLatitude = std::numeric_limits<double>::max();
+   double maxLatitude = std::numeric_limits<double>::lowest();
+
+   for (std::size_t i = 0; i < area.size(); ++i)
+   {
+      ExtendLatitudeBounds(area[i],
+                           area[(i + 1) % area.size()],
+                           minLatitude,
+                           maxLatitude);
+   }
+
+   bounds_.minLatitude_  = minLatitude - kBoundsPadding_;
+   bounds_.maxLatitude_  = maxLatitude + kBoundsPadding_;
+   bounds_.minLongitude_ = minLongitude->longitude_ - kBoundsPadding_;
+   bounds_.maxLongitude_ = maxLongitude->longitude_ + kBoundsPadding_;
+
+   if (bounds_.maxLongitude_ - bounds_.minLongitude_ > 180.0)
+   {
+      // The area crosses the antimeridian, don't constrain the longitude
+      bounds_.minLongitude_ = -180.0;
+      bounds_.maxLongitude_ = 180.0;
+   }
+
+   // An invalid area is measured along its vertices, without closure
+   vertices_.reserve(area.size());
+   for (auto& coordinate : area)
+   {
+      vertices_.push_back(ToVector(coordinate));
+   }
+
+   const std::size_t edgeCount =
+      (valid_ && area.front() != area.back()) ? area.size() : area.size() - 1;
+
+   edges_.reserve(edgeCount);
+   for (std::size_t i = 0; i < edgeCount; ++i)
+   {
+      const std::size_t b = (i + 1) % area.size();
+      edges_.push_back({i, b, Normalize(Cross(vertices_[i], vertices_[b]))});
+   }
+
+   if (valid_)
+   {
+      PrepareGeometry();
+   }
+}
+
+void PreparedArea::Impl::PrepareGeometry()
+{
+   auto   sequence = std::make_unique<geos::geom::CoordinateSequence>();
+   double x;
+   double y;
+
+   sequence->reserve(area_.size() + 1);
+
+   for (auto& areaCoordinate : area_)
+   {
+      gnomonic_.Forward(centroid_.latitude_,
+                        centroid_.longitude_,
+                        areaCoordinate.latitude_,
+                        areaCoordinate.longitude_,
+                        x,
+                        y);
+
+      // An area which is not in the hemisphere centered on its centroid cannot
+      // be projected, and does not contain any point
+      if (std::isnan(x) || std::isnan(y))
+      {
+         logger_->trace("Area cannot be projected");
+         return;
+      }
+
+      sequence->add(x, y);
+   }
+
+   // If the sequence is not a ring, add the first point again for closure
+   if (!sequence->isRing())
+   {
+      sequence->add(sequence->front(), false);
+   }
+
+   try
+   {
+      polygon_ = factory_->createPolygon(
+         factory_->createLinearRing(std::move(sequence)));
+      preparedPolygon_ =
+         geos::geom::prep::PreparedGeometryFactory::prepare(polygon_.get());
+
+      // The point locator of the prepared geometry is built on first use.
+      // Build it here, so concurrent queries do not modify the geometry.
+      auto point = factory_->createPoint(geos::geom::CoordinateXY {});
+      preparedPolygon_->covers(point.get());
+   }
+   catch (const std::exception&)
+   {
+      logger_->trace("Invalid area sequence");
+      preparedPolygon_.reset();
+      polygon_.reset();
+   }
+}
+
+double PreparedArea::Impl::EdgeAngle(const Vector3& point,
+                                     const Edge&    edge) const
+{
+   const Vector3& a = vertices_[edge.a_];
+   const Vector3& b = vertices_[edge.b_];
+   const Vector3& n = edge.normal_;
+
+   const double s = Dot(point, n);
+
+   // The closest point of the great circle lies between a and b
+   const Vector3 foot {
+      point[0] - s * n[0], point[1] - s * n[1], point[2] - s * n[2]};
+
+   if (Dot(n, n) > 0.0 && Dot(Cross(a, foot), n) >= 0.0 &&
+       Dot(Cross(foot, b), n) >= 0.0)
+   {
+      return std::asin(std::clamp(std::abs(s), 0.0, 1.0));
+   }
+
+   return std::min(Angle(point, a), Angle(point, b));
+}
+
+bool PreparedArea::Impl::BoundsContain(const common::Coordinate& point) const
+{
+   return point.latitude_ >= bounds_.minLatitude_ &&
+          point.latitude_ <= bounds_.maxLatitude_ &&
+          point.longitude_ >= bounds_.minLongitude_ &&
+          point.longitude_ <= bounds_.maxLongitude_;
+}
+
+units::length::meters<double>
+PreparedArea::Impl::CentroidDistance(const common::Coordinate& point) const
+{
+   return GeographicLib::GetDistance(point.latitude_,
+                                     point.longitude_,
+                                     centroid_.latitude_,
+                                     centroid_.longitude_);
+}
+
+bool PreparedArea::Bounds::Intersects(const Bounds& other) const
+{
+   return minLatitude_ <= other.maxLatitude_ &&
+          maxLatitude_ >= other.minLatitude_ &&
+          minLongitude_ <= other.maxLongitude_ &&
+          maxLongitude_ >= other.minLongitude_;
+}
+
+PreparedArea::Bounds
+PreparedArea::GetQueryBounds(const common::Coordinate&     point,
+                             units::length::meters<double> distance)
+{
+   // Expand the query point by the distance, in degrees
+   const double latitudeDelta =
+      std::max(distance.value(), 0.0) / kMetersPerDegree_;
+   const double maxLatitude = std::abs(point.latitude_) + latitudeDelta;
+
+   Bounds bounds {point.latitude_ - latitudeDelta,
+                  -180.0,
+                  point.latitude_ + latitudeDelta,
+                  180.0};
+
+   if (maxLatitude < kMaxQueryLatitude_)
+   {
+      const double longitudeDelta =
+         latitudeDelta / std::cos(maxLatitude * kDegreesToRadians_);
+
+      // Don't constrain the longitude if the bounds cross the antimeridian
+      if (point.longitude_ - longitudeDelta >= -180.0 &&
+          point.longitude_ + longitudeDelta <= 180.0)
+      {
+         bounds.minLongitude_ = point.longitude_ - longitudeDelta;
+         bounds.maxLongitude_ = point.longitude_ + longitudeDelta;
+      }
+   }
+
+   return bounds;
+}
+
+const PreparedArea::Bounds& PreparedArea::bounds() const
+{
+   return p->bounds_;
+}
+
+common::Coordinate PreparedArea::centroid() const
+{
+   return p->centroid_;
+}
+
+bool PreparedArea::is_valid() const
+{
+   return p->valid_;
+}
+
+bool PreparedArea::Contains(const common::Coordinate& point) const
+{
+   if (p->preparedPolygon_ == nullptr || !p->BoundsContain(point))
+   {
+      return false;
+   }
+
+   double x;
+   double y;
+
+   p->gnomonic_.Forward(p->centroid_.latitude_,
+                        p->centroid_.longitude_,
+                        point.latitude_,
+                        point.longitude_,
+                        x,
+                        y);
+
+   // A point which is not in the hemisphere centered on the centroid is not
+   // in the area
+   if (std::isnan(x) || std::isnan(y))
+   {
+      return false;
+   }
+
+   auto projectedPoint = factory_->createPoint(geos::geom::CoordinateXY {x, y});
+
+   return p->preparedPolygon_->covers(projectedPoint.get());
+}
+
+units::length::meters<double>
+PreparedArea::Distance(const common::Coordinate& point) const
+{
+   if (p->area_.empty())
+   {
+      return p->CentroidDistance(point);
+   }
+
+   if (Contains(point))
+   {
+      return units::length::meters<double>(0);
+   }
+
+   const Vector3 pointVector = ToVector(point);
+
+   // If the area is not fully on the hemisphere centered on the point, fall
+   // back to using the centroid
+   if (std::any_of(p->vertices_.cbegin(),
+                   p->vertices_.cend(),
+                   [&pointVector](const Vector3& vertex)
+                   { return Dot(pointVector, vertex) <= 0.0; }))
+   {
+      return p->CentroidDistance(point);
+   }
+
+   // Select the vertices and edges which may be closest to the point, using
+   // great circle distances on the sphere
+   std::vector<double> edgeAngles {};
+   edgeAngles.reserve(p->edges_.size());
+
+   double minAngle = Angle(pointVector, p->vertices_.front());
+   for (auto& edge : p->edges_)
+   {
+      edgeAngles.push_back(p->EdgeAngle(pointVector, edge));
+      minAngle = std::min(minAngle, edgeAngles.back());
+   }
+
+   const double maxAngle = minAngle * (1.0 + kEdgeDistanceMargin_) +
+                           std::numeric_limits<double>::epsilon();
+
+   // Using a gnomonic projection with the test point as the center
+   // latitude/longitude, the projected test point will be at (0, 0), and the
+   // closest point of each selected edge is measured on the ellipsoid
+   const geos::geom::Coordinate zero {0.0, 0.0};
+   geos::geom::CoordinateXY     closestPoint {};
+   double closestDistance = std::numeric_limits<double>::infinity();
+
+   auto project = [&](std::size_t i, geos::geom::CoordinateXY& coordinate)
+   {
+      p->gnomonic_.Forward(point.latitude_,
+                           point.longitude_,
+                           p->area_[i].latitude_,
+                           p->area_[i].longitude_,
+                           coordinate.x,
+                           coordinate.y);
+      return !std::isnan(coordinate.x) && !std::isnan(coordinate.y);
+   };
+
+   auto measure = [&](const geos::geom::CoordinateXY& candidate)
+   {
+      const double distance = candidate.distance(zero);
+      if (distance < closestDistance)
+      {
+         closestPoint    = candidate;
+         closestDistance = distance;
+      }
+   };
+
+   if (p->edges_.empty())
+   {
+      geos::geom::CoordinateXY vertex;
+      if (!project(0, vertex))
+      {
+         return p->CentroidDistance(point);
+      }
+      measure(vertex);
+   }
+
+   for (std::size_t i = 0; i < p->edges_.size(); ++i)
+   {
+      if (edgeAngles[i] > maxAngle)
+      {
+         continue;
+      }
+
+      geos::geom::CoordinateXY a;
+      geos::geom::CoordinateXY b;
+
+      if (!project(p->edges_[i].a_, a) || !project(p->edges_[i].b_, b))
+      {
+         return p->CentroidDistance(point);
+      }
+
+      geos::geom::LineSegment  segment {a, b};
+      geos::geom::CoordinateXY segmentPoint;
+
+      segment.closestPoint(zero, segmentPoint);
+      measure(segmentPoint);
+   }
+
+   double closestLat;
+   double closestLon;
+
+   p->gnomonic_.Reverse(point.latitude_,
+                        point.longitude_,
+                        closestPoint.x,
+                        closestPoint.y,
+                        closestLat,
+                        closestLon);
+
+   return GeographicLib::GetDistance(
+      point.latitude_, point.longitude_, closestLat, closestLon);
+}
+
+bool PreparedArea::InRangeOfPoint(const common::Coordinate&     point,
+                                  units::length::meters<double> distance) const
+{
+   if (!p->area_.empty() &&
+       !p->bounds_.Intersects(GetQueryBounds(point, distance)))
+   {
+      return false;
+   }
+
+   return Distance(point) <= distance;
+}
+
+static Vector3 ToVector(const common::Coordinate& coordinate)
+{
+   const double latitude  = coordinate.latitude_ * kDegreesToRadians_;
+   const double longitude = coordinate.longitude_ * kDegreesToRadians_;
+
+   return {std::cos(latitude) * std::cos(longitude),
+           std::cos(latitude) * std::sin(longitude),
+           std::sin(latitude)};
+}
+
+static Vector3 Cross(const Vector3& a, const Vector3& b)
+{
+   return {a[1] * b[2] - a[2] * b[1],
+           a[2] * b[0] - a[0] * b[2],
+           a[0] * b[1] - a[1] * b[0]};
+}
+
+static double Dot(const Vector3& a, const Vector3& b)
+{
+   return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+static double Angle(const Vector3& a, const Vector3& b)
+{
+   const Vector3 c = Cross(a, b);
+   return std::atan2(std::sqrt(Dot(c, c)), Dot(a, b));
+}
+
+static Vector3 Normalize(const Vector3& v)
+{
+   const double length = std::sqrt(Dot(v, v));
+
+   if (length < std::numeric_limits<double>::epsilon())
+   {
+      return {0.0, 0.0, 0.0};
+   }
+
+   return {v[0] / length, v[1] / length, v[2] / length};
+}
+
+static void ExtendLatitudeBounds(const common::Coordinate& a,
+                                 const common::Coordinate& b,
+                                 double&                   minLatitude,
+                                 double&                   maxLatitude)
+{
+   minLatitude = std::min({minLatitude, a.latitude_, b.latitude_});
+   maxLatitude = std::max({maxLatitude, a.latitude_, b.latitude_});
+
+   const Vector3 va     = ToVector(a);
+   const Vector3 vb     = ToVector(b);
+   const Vector3 normal = Cross(va, vb);
+
+   // The point of the great circle furthest from the equator is perpendicular
+   // to both the circle normal and the equator
+   Vector3      vertex = Cross(Cross(normal, {0.0, 0.0, 1.0}), normal);
+   const double length = std::sqrt(Dot(vertex, vertex));
+
+   if (length < std::numeric_limits<double>::epsilon())
+   {
+      // The edge is degenerate, or lies on a meridian or the equator
+      return;
+   }
+
+   for (double sign : {1.0, -1.0})
+   {
+      const Vector3 v {sign * vertex[0] / length,
+                       sign * vertex[1] / length,
+                       sign * vertex[2] / length};
+
+      // Only extend the bounds if the vertex lies between a and b
+      if (Dot(Cross(va, v), normal) >= 0.0 && Dot(Cross(v, vb), normal) >= 0.0)
+      {
+         const double latitude =
+            std::asin(std::clamp(v[2], -1.0, 1.0)) * kRadiansToDegrees_;
+         minLatitude = std::min(minLatitude, latitude);
+         maxLatitude = std::max(maxLatitude, latitude);
+      }
+   }
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <scwx/common/geographic.hpp>
+
+#include <memory>
+#include <vector>
+
+#include <units/length.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+/**
+ * @brief An area/ring which has been prepared for repeated containment and
+ * distance queries.
+ *
+ * The area is projected once using a gnomonic projection centered on its
+ * centroid, in which great circles are straight lines, and the projected
+ * polygon is prepared for containment queries. A geographic bounding box is
+ * used for quick rejection.
+ *
+ * Distances are measured to the closest edges, which are selected using great
+ * circle distances of the vertices cached as unit vectors. Only the vertices
+ * of the selected edges are projected around the query point, as
+ * GeographicLib::GetDistanceAreaPoint does.
+ */
+class PreparedArea
+{
+public:
+   /**
+    * @brief Bounding box of the area vertices, in degrees. The bounds are
+    * padded to account for great circle edges bowing outside of the vertices.
+    */
+   struct Bounds
+   {
+      double minLatitude_;
+      double minLongitude_;
+      double maxLatitude_;
+      double maxLongitude_;
+
+      bool Intersects(const Bounds& other) const;
+   };
+
+   explicit PreparedArea(const std::vector<common::Coordinate>& area);
+   ~PreparedArea();
+
+   PreparedArea(const PreparedArea&)            = delete;
+   PreparedArea& operator=(const PreparedArea&) = delete;
+
+   PreparedArea(PreparedArea&&) noexcept;
+   PreparedArea& operator=(PreparedArea&&) noexcept;
+
+   const Bounds&      bounds() const;
+   common::Coordinate centroid() const;
+
+   /**
+    * Get bounds which contain every point within a distance of a point.
+    *
+    * @param [in] point The point to query
+    * @param [in] distance The max distance in meters
+    *
+    * @return query bounds
+    */
+   static Bounds GetQueryBounds(const common::Coordinate&     point,
+                                units::length::meters<double> distance);
+
+   /**
+    * @brief Returns true if the area is a valid ring. An invalid area never
+    * contains a point, and its distance is measured from its vertices.
+    */
+   bool is_valid() const;
+
+   /**
+    * Determine if the area contains a point. A point lying on the area
+    * boundary is considered to be inside the area. Equivalent to
+    * GeographicLib::AreaContainsPoint. An area which cannot be projected
+    * around its centroid does not contain any point.
+    *
+    * @param [in] point The point to check against the area
+    *
+    * @return true if point is inside the area
+    */
+   bool Contains(const common::Coordinate& point) const;
+
+   /**
+    * Get the distance from the area to a point. If the point is in the area,
+    * the distance is 0. If the area does not lie entirely on the hemisphere
+    * centered on the point, the distance is measured to the area centroid.
+    * Equivalent to GeographicLib::GetDistanceAreaPoint.
+    *
+    * @param [in] point The point to check against the area
+    *
+    * @return distance between the area and the point
+    */
+   units::length::meters<double>
+   Distance(const common::Coordinate& point) const;
+
+   /**
+    * Determine if the area is within a distance of a point. Areas whose bounds
+    * are out of range are rejected without being projected. Equivalent to
+    * GeographicLib::AreaInRangeOfPoint.
+    *
+    * @param [in] point The point to check against the area
+    * @param [in] distance The max distance in meters
+    *
+    * @return true if area is inside the radius of the point
+    */
+   bool InRangeOfPoint(const common::Coordinate&     point,
+                       units::length::meters<double> distance) const;
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,545 @@
+#include <scwx/qt/util/sweep_rasterizer.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <fstream>
+#include <limits>
+
+#include <QImage>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+static const std::string logPrefix_ = "scwx::qt::util::sweep_rasterizer";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+// Lower bound of the length of a degree of latitude, to ensure the extent
+// covers the requested range
+static constexpr double kMetersPerDegree_  = 110'000.0;
+static constexpr double kMaxLatitude_      = 89.0;
+static constexpr double kDegreesToRadians_ = 0.017453292519943295;
+
+static constexpr std::size_t kVerticesPerTriangle_ = 3;
+
+static const boost::gil::rgba8_pixel_t kTransparent_ {0, 0, 0, 0};
+
+// TIFF tag types
+static constexpr std::uint16_t kTiffShort_  = 3;
+static constexpr std::uint16_t kTiffLong_   = 4;
+static constexpr std::uint16_t kTiffDouble_ = 12;
+
+class MomentReader
+{
+public:
+   explicit MomentReader(const void* data, std::size_t componentSize) :
+       data_ {data}, componentSize_ {componentSize}
+   {
+   }
+
+   bool valid() const { return data_ != nullptr; }
+
+   std::uint16_t operator[](std::size_t i) const
+   {
+      if (componentSize_ == 1)
+      {
+         return static_cast<const std::uint8_t*>(data_)[i];
+      }
+      return static_cast<const std::uint16_t*>(data_)[i];
+   }
+
+private:
+   const void* data_;
+   std::size_t componentSize_;
+};
+
+class SweepRasterizer::Impl
+{
+public:
+   explicit Impl(const RasterExtent& extent) :
+       extent_ {extent},
+       pixels_(extent.width_ * extent.height_, kTransparent_),
+       xScale_ {static_cast<double>(extent.width_) /
+                (extent.maxLongitude_ - extent.minLongitude_)},
+       yScale_ {static_cast<double>(extent.height_) /
+                (extent.maxLatitude_ - extent.minLatitude_)}
+   {
+   }
+   ~Impl() = default;
+
+   void Blend(boost::gil::rgba8_pixel_t&       dst,
+              const boost::gil::rgba8_pixel_t& src) const;
+
+   static const boost::gil::rgba8_pixel_t&
+   LookupColor(const RasterColorTable& colorTable,
+               std::uint16_t           dataMoment,
+               std::uint16_t           cfpMoment,
+               bool                    cfpEnabled);
+
+   RasterExtent                           extent_;
+   std::vector<boost::gil::rgba8_pixel_t> pixels_;
+
+   // Pixels per degree
+   double xScale_;
+   double yScale_;
+};
+
+RasterExtent RasterExtent::Centered(const common::Coordinate& center,
+                                    double                    range,
+                                    double                    resolution)
+{
+   const double latitudeDelta = range / kMetersPerDegree_;
+   const double maxLatitude =
+      std::min(std::abs(center.latitude_) + latitudeDelta, kMaxLatitude_);
+   const double longitudeDelta =
+      latitudeDelta / std::cos(maxLatitude * kDegreesToRadians_);
+
+   RasterExtent extent {};
+
+   extent.width_ =
+      static_cast<std::size_t>(std::ceil(2.0 * longitudeDelta / resolution));
+   extent.height_ =
+      static_cast<std::size_t>(std::ceil(2.0 * latitudeDelta / resolution));
+
+   // Snap the extent to the pixel size
+   const double halfWidth =
+      static_cast<double>(extent.width_) * resolution / 2.0;
+   const double halfHeight =
+      static_cast<double>(extent.height_) * resolution / 2.0;
+
+   extent.minLatitude_  = center.latitude_ - halfHeight;
+   extent.maxLatitude_  = center.latitude_ + halfHeight;
+   extent.minLongitude_ = center.longitude_ - halfWidth;
+   extent.maxLongitude_ = center.longitude_ + halfWidth;
+
+   return extent;
+}
+
+SweepRasterizer::SweepRasterizer(const RasterExtent& extent) :
+    p(std::make_unique<Impl>(extent))
+{
+}
+SweepRasterizer::~SweepRasterizer() = default;
+
+SweepRasterizer::SweepRasterizer(SweepRasterizer&&) noexcept = default;
+SweepRasterizer&
+SweepRasterizer::operator=(SweepRasterizer&&) noexcept = default;
+
+const RasterExtent& SweepRasterizer::extent() const
+{
+   return p->extent_;
+}
+
+const std::vector<boost::gil::rgba8_pixel_t>& SweepRasterizer::pixels() const
+{
+   return p->pixels_;
+}
+
+void SweepRasterizer::Clear()
+{
+   std::fill(p->pixels_.begin(), p->pixels_.end(), kTransparent_);
+}
+
+void SweepRasterizer::Impl::Blend(boost::gil::rgba8_pixel_t&       dst,
+                                  const boost::gil::rgba8_pixel_t& src) const
+{
+   // Equivalent to glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA)
+   const std::uint32_t a = src[3];
+
+   for (std::size_t c = 0; c < 4; ++c)
+   {
+      dst[c] = static_cast<std::uint8_t>(
+         (src[c] * a + dst[c] * (255u - a) + 127u) / 255u);
+   }
+}
+
+const boost::gil::rgba8_pixel_t&
+SweepRasterizer::Impl::LookupColor(const RasterColorTable& colorTable,
+                                   std::uint16_t           dataMoment,
+                                   std::uint16_t           cfpMoment,
+                                   bool                    cfpEnabled)
+{
+   // Determine the color, matching the radar fragment shader
+   const std::vector<boost::gil::rgba8_pixel_t>& lut = *colorTable.lut_;
+
+   const float dataMomentScale =
+      static_cast<float>(colorTable.max_ - colorTable.min_);
+   const float lutSize = static_cast<float>(lut.size());
+
+   float texCoord =
+      (dataMomentScale > 0.0f) ?
+         static_cast<float>(dataMoment - colorTable.min_) / dataMomentScale :
+         0.0f;
+
+   if (cfpEnabled && cfpMoment > 8u)
+   {
+      texCoord -= static_cast<float>(cfpMoment - 8u) / 2.0f;
+   }
+
+   const std::size_t lutIndex = static_cast<std::size_t>(
+      std::clamp(std::floor(texCoord * lutSize), 0.0f, lutSize - 1.0f));
+
+   return lut[lutIndex];
+}
+
+std::size_t SweepRasterizer::Draw(const SweepBuffers&     buffers,
+                                  const RasterColorTable& colorTable,
+                                  bool                    cfpEnabled)
+{
+   if (buffers.vertices_ == nullptr || buffers.dataMoments_ == nullptr ||
+       colorTable.lut_ == nullptr || colorTable.lut_->empty())
+   {
+      return 0u;
+   }
+
+   const std::vector<float>& vertices = *buffers.vertices_;
+
+   const MomentReader dataMoments {buffers.dataMoments_,
+                                   buffers.dataMomentsComponentSize_};
+   const MomentReader cfpMoments {buffers.cfpMoments_,
+                                  buffers.cfpMomentsComponentSize_};
+
+   const std::size_t width  = p->extent_.width_;
+   const std::size_t height = p->extent_.height_;
+
+   const std::size_t triangleCount =
+      vertices.size() / 2 / kVerticesPerTriangle_;
+   std::size_t trianglesDrawn = 0;
+
+   for (std::size_t t = 0; t < triangleCount; ++t)
+   {
+      const std::size_t v = t * kVerticesPerTriangle_;
+
+      // Flat shading uses the last (provoking) vertex
+      const std::uint16_t dataMoment = dataMoments[v + 2];
+      if (dataMoment < colorTable.min_)
+      {
+         continue;
+      }
+
+      const std::uint16_t cfpMoment =
+         cfpMoments.valid() ? cfpMoments[v + 2] : std::uint16_t {0u};
+      const boost::gil::rgba8_pixel_t& color =
+         Impl::LookupColor(colorTable, dataMoment, cfpMoment, cfpEnabled);
+
+      if (color[3] == 0u)
+      {
+         continue;
+      }
+
+      // Project vertices to pixel space
+      std::array<double, kVerticesPerTriangle_> x {};
+      std::array<double, kVerticesPerTriangle_> y {};
+      for (std::size_t i = 0; i < kVerticesPerTriangle_; ++i)
+      {
+         const double latitude  = vertices[(v + i) * 2];
+         const double longitude = vertices[(v + i) * 2 + 1];
+
+         x[i] = (longitude - p->extent_.minLongitude_) * p->xScale_;
+         y[i] = (p->extent_.maxLatitude_ - latitude) * p->yScale_;
+      }
+
+      double area =
+         (x[1] - x[0]) * (y[2] - y[0]) - (x[2] - x[0]) * (y[1] - y[0]);
+      if (area == 0.0)
+      {
+         continue;
+      }
+      if (area < 0.0)
+      {
+         // Use a consistent winding order
+         std::swap(x[1], x[2]);
+         std::swap(y[1], y[2]);
+      }
+
+      // Determine the pixel bounds of the triangle
+      const double minX = std::min({x[0], x[1], x[2]});
+      const double maxX = std::max({x[0], x[1], x[2]});
+      const double minY = std::min({y[0], y[1], y[2]});
+      const double maxY = std::max({y[0], y[1], y[2]});
+
+      if (maxX < 0.0 || maxY < 0.0 || minX >= static_cast<double>(width) ||
+          minY >= static_cast<double>(height))
+      {
+         continue;
+      }
+
+      const std::size_t column0 =
+         static_cast<std::size_t>(std::max(0.0, std::floor(minX)));
+      const std::size_t column1 = static_cast<std::size_t>(
+         std::min(static_cast<double>(width - 1), std::floor(maxX)));
+      const std::size_t row0 =
+         static_cast<std::size_t>(std::max(0.0, std::floor(minY)));
+      const std::size_t row1 = static_cast<std::size_t>(
+         std::min(static_cast<double>(height - 1), std::floor(maxY)));
+
+      // Edge equations, with a top-left fill rule such that pixels on an edge
+      // shared by adjacent triangles are only drawn once
+      std::array<double, kVerticesPerTriangle_> a {};
+      std::array<double, kVerticesPerTriangle_> b {};
+      std::array<double, kVerticesPerTriangle_> c {};
+      std::array<bool, kVerticesPerTriangle_>   inclusive {};
+      for (std::size_t i = 0; i < kVerticesPerTriangle_; ++i)
+      {
+         const std::size_t j = (i + 1) % kVerticesPerTriangle_;
+
+         a[i] = y[i] - y[j];
+         b[i] = x[j] - x[i];
+         c[i] = x[i] * y[j] - x[j] * y[i];
+
+         inclusive[i] = (a[i] < 0.0) || (a[i] == 0.0 && b[i] < 0.0);
+      }
+
+      bool drawn = false;
+
+      for (std::size_t row = row0; row <= row1; ++row)
+      {
+         const double py = static_cast<double>(row) + 0.5;
+
+         for (std::size_t column = column0; column <= column1; ++column)
+         {
+            const double px = static_cast<double>(column) + 0.5;
+
+            bool inside = true;
+            for (std::size_t i = 0; i < kVerticesPerTriangle_ && inside; ++i)
+            {
+               const double w = a[i] * px + b[i] * py + c[i];
+               inside = (w > 0.0) || (w == 0.0 && inclusive[i]);
+            }
+
+            if (inside)
+            {
+               p->Blend(p->pixels_[row * width + column], color);
+               drawn = true;
+            }
+         }
+      }
+
+      if (drawn)
+      {
+         ++trianglesDrawn;
+      }
+   }
+
+   return trianglesDrawn;
+}
+
+std::size_t SweepRasterizer::DrawPolar(const PolarSweep&       sweep,
+                                       const PolarSiteFrame&   siteFrame,
+                                       const RasterColorTable& colorTable,
+                                       bool                    cfpEnabled)
+{
+   if (sweep.radialCount_ == 0 || colorTable.lut_ == nullptr ||
+       colorTable.lut_->empty())
+   {
+      return 0u;
+   }
+
+   const std::size_t width  = p->extent_.width_;
+   const std::size_t height = p->extent_.height_;
+
+   std::size_t pixelsDrawn = 0;
+
+   for (std::size_t row = 0; row < height; ++row)
+   {
+      const double latitude = p->extent_.maxLatitude_ -
+                              (static_cast<double>(row) + 0.5) / p->yScale_;
+
+      for (std::size_t column = 0; column < width; ++column)
+      {
+         const double longitude =
+            p->extent_.minLongitude_ +
+            (static_cast<double>(column) + 0.5) / p->xScale_;
+
+         const auto [azimuth, range] =
+            siteFrame.AzimuthRange(latitude, longitude);
+
+         const std::uint16_t dataMoment = sweep.Sample(azimuth, range, 0);
+         if (dataMoment == 0u || dataMoment < colorTable.min_)
+         {
+            continue;
+         }
+
+         const std::uint16_t cfpMoment =
+            (sweep.componentCount_ > 1) ? sweep.Sample(azimuth, range, 1) :
+                                          std::uint16_t {0u};
+         const boost::gil::rgba8_pixel_t& color =
+            Impl::LookupColor(colorTable, dataMoment, cfpMoment, cfpEnabled);
+
+         if (color[3] == 0u)
+         {
+            continue;
+         }
+
+         p->Blend(p->pixels_[row * width + column], color);
+         ++pixelsDrawn;
+      }
+   }
+
+   return pixelsDrawn;
+}
+
+bool SweepRasterizer::WritePng(const std::string& filename) const
+{
+   QImage image(reinterpret_cast<const uchar*>(p->pixels_.data()),
+                static_cast<int>(p->extent_.width_),
+                static_cast<int>(p->extent_.height_),
+                static_cast<qsizetype>(p->extent_.width_ *
+                                       sizeof(boost::gil::rgba8_pixel_t)),
+                QImage::Format::Format_RGBA8888);
+
+   bool success = image.save(QString::fromStdString(filename), "PNG");
+   if (!success)
+   {
+      logger_->error("Could not write PNG: {}", filename);
+   }
+
+   return success;
+}
+
+template<class T>
+static void WriteLittleEndian(std::vector<char>& buffer, T value)
+{
+   auto bytes = std::bit_cast<std::array<char, sizeof(T)>>(value);
+   if constexpr (std::endian::native == std::endian::big)
+   {
+      std::reverse(bytes.begin(), bytes.end());
+   }
+   buffer.insert(buffer.end(), bytes.cbegin(), bytes.cend());
+}
+
+bool SweepRasterizer::WriteGeoTiff(const std::string& filename) const
+{
+   const std::uint32_t width  = static_cast<std::uint32_t>(p->extent_.width_);
+   const std::uint32_t height = static_cast<std::uint32_t>(p->extent_.height_);
+   const std::uint64_t imageSize =
+      static_cast<std::uint64_t>(width) * height * 4u;
+
+   if (imageSize > std::numeric_limits<std::uint32_t>::max() / 2)
+   {
+      logger_->error("Image too large for TIFF: {}x{}", width, height);
+      return false;
+   }
+
+   // Georeferencing
+   const std::array<double, 3> pixelScale {
+      (p->extent_.maxLongitude_ - p->extent_.minLongitude_) / width,
+      (p->extent_.maxLatitude_ - p->extent_.minLatitude_) / height,
+      0.0};
+   const std::array<double, 6> tiepoint {
+      0.0, 0.0, 0.0, p->extent_.minLongitude_, p->extent_.maxLatitude_, 0.0};
+   const std::array<std::uint16_t, 16> geoKeys {
+      1, 1, 0, 3,       // Version 1.1.0, 3 keys
+      1024, 0, 1, 2,    // GTModelTypeGeoKey: ModelTypeGeographic
+      1025, 0, 1, 1,    // GTRasterTypeGeoKey: RasterPixelIsArea
+      2048, 0, 1, 4326, // GeographicTypeGeoKey: WGS 84
+   };
+   const std::array<std::uint16_t, 4> bitsPerSample {8, 8, 8, 8};
+
+   struct Entry
+   {
+      std::uint16_t tag_;
+      std::uint16_t type_;
+      std::uint32_t count_;
+      std::uint32_t value_;
+   };
+
+   constexpr std::uint32_t kHeaderSize = 8;
+   constexpr std::uint32_t kEntryCount = 14;
+   constexpr std::uint32_t kIfdSize    = 2 + kEntryCount * 12 + 4;
+
+   // Values which don't fit within an entry follow the IFD
+   const std::uint32_t bitsPerSampleOffset = kHeaderSize + kIfdSize;
+   const std::uint32_t pixelScaleOffset =
+      bitsPerSampleOffset + sizeof(bitsPerSample);
+   const std::uint32_t tiepointOffset = pixelScaleOffset + sizeof(pixelScale);
+   const std::uint32_t geoKeysOffset  = tiepointOffset + sizeof(tiepoint);
+   const std::uint32_t imageOffset    = geoKeysOffset + sizeof(geoKeys);
+
+   const std::array<Entry, kEntryCount> entries {{
+      {256, kTiffLong_, 1, width},                     // ImageWidth
+      {257, kTiffLong_, 1, height},                    // ImageLength
+      {258, kTiffShort_, 4, bitsPerSampleOffset},      // BitsPerSample
+      {259, kTiffShort_, 1, 1},                        // Compression: None
+      {262, kTiffShort_, 1, 2},                        // Photometric: RGB
+      {273, kTiffLong_, 1, imageOffset},               // StripOffsets
+      {277, kTiffShort_, 1, 4},                        // SamplesPerPixel
+      {278, kTiffLong_, 1, height},                    // RowsPerStrip
+      {279, kTiffLong_, 1, static_cast<std::uint32_t>(imageSize)},
+      {284, kTiffShort_, 1, 1},                        // PlanarConfig: Chunky
+      {338, kTiffShort_, 1, 2},                        // ExtraSamples: Alpha
+      {33550, kTiffDouble_, 3, pixelScaleOffset},      // ModelPixelScale
+      {33922, kTiffDouble_, 6, tiepointOffset},        // ModelTiepoint
+      {34735, kTiffShort_, 16, geoKeysOffset},         // GeoKeyDirectory
+   }};
+
+   std::vector<char> buffer {};
+   buffer.reserve(imageOffset);
+
+   // Header: little endian, version 42, IFD offset
+   buffer.insert(buffer.end(), {'I', 'I'});
+   WriteLittleEndian<std::uint16_t>(buffer, 42);
+   WriteLittleEndian<std::uint32_t>(buffer, kHeaderSize);
+
+   // Image file directory
+   WriteLittleEndian<std::uint16_t>(buffer, kEntryCount);
+   for (const Entry& entry : entries)
+   {
+      WriteLittleEndian(buffer, entry.tag_);
+      WriteLittleEndian(buffer, entry.type_);
+      WriteLittleEndian(buffer, entry.count_);
+
+      if (entry.type_ == kTiffShort_ && entry.count_ == 1)
+      {
+         // Short values are left-justified within the value field
+         WriteLittleEndian<std::uint16_t>(
+            buffer, static_cast<std::uint16_t>(entry.value_));
+         WriteLittleEndian<std::uint16_t>(buffer, 0);
+      }
+      else
+      {
+         WriteLittleEndian(buffer, entry.value_);
+      }
+   }
+   WriteLittleEndian<std::uint32_t>(buffer, 0); // No next IFD
+
+   for (std::uint16_t value : bitsPerSample)
+   {
+      WriteLittleEndian(buffer, value);
+   }
+   for (double value : pixelScale)
+   {
+      WriteLittleEndian(buffer, value);
+   }
+   for (double value : tiepoint)
+   {
+      WriteLittleEndian(buffer, value);
+   }
+   for (std::uint16_t value : geoKeys)
+   {
+      WriteLittleEndian(buffer, value);
+   }
+
+   std::ofstream ofs {filename, std::ios_base::out | std::ios_base::binary};
+   ofs.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+   ofs.write(reinterpret_cast<const char*>(p->pixels_.data()),
+             static_cast<std::streamsize>(imageSize));
+
+   if (!ofs.good())
+   {
+      logger_->error("Could not write GeoTIFF: {}", filename);
+      return false;
+   }
+
+   return true;
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,157 @@
+#pragma once
+
+#include <scwx/qt/util/polar_sweep.hpp>
+#include <scwx/common/geographic.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/gil.hpp>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+/**
+ * @brief Geographic extent and size of a raster image, using an
+ * equirectangular (EPSG:4326) projection.
+ */
+struct RasterExtent
+{
+   double minLatitude_ {0.0};
+   double minLongitude_ {0.0};
+   double maxLatitude_ {0.0};
+   double maxLongitude_ {0.0};
+
+   std::size_t width_ {0};
+   std::size_t height_ {0};
+
+   /**
+    * @brief Creates an extent centered on a coordinate.
+    *
+    * @param [in] center Center of the extent
+    * @param [in] range Distance from the center to each edge, in meters
+    * @param [in] resolution Pixel size, in degrees
+    */
+   static RasterExtent Centered(const common::Coordinate& center,
+                                double                    range,
+                                double                    resolution);
+};
+
+/**
+ * @brief Moment data associated with each vertex of a sweep, as produced by a
+ * radar product view. Triangles are flat shaded using the moment of their
+ * last vertex, matching the OpenGL provoking vertex convention.
+ */
+struct SweepBuffers
+{
+   // Latitude/longitude pairs, three vertices per triangle
+   const std::vector<float>* vertices_ {nullptr};
+
+   // Data moments, one per vertex, of the given component size (1 or 2)
+   const void* dataMoments_ {nullptr};
+   std::size_t dataMomentsComponentSize_ {1};
+
+   // Optional clutter filter power removed moments, one per vertex
+   const void* cfpMoments_ {nullptr};
+   std::size_t cfpMomentsComponentSize_ {1};
+};
+
+/**
+ * @brief Color lookup table for data moments, as produced by a radar product
+ * view.
+ */
+struct RasterColorTable
+{
+   const std::vector<boost::gil::rgba8_pixel_t>* lut_ {nullptr};
+   std::uint16_t                                 min_ {0};
+   std::uint16_t                                 max_ {0};
+};
+
+/**
+ * @brief Renders radar sweeps into an RGBA image on the CPU, without requiring
+ * an OpenGL context. The color mapping matches the radar shader. A rasterizer
+ * is not thread-safe, but separate rasterizers may be used concurrently.
+ */
+class SweepRasterizer
+{
+public:
+   explicit SweepRasterizer(const RasterExtent& extent);
+   ~SweepRasterizer();
+
+   SweepRasterizer(const SweepRasterizer&)            = delete;
+   SweepRasterizer& operator=(const SweepRasterizer&) = delete;
+
+   SweepRasterizer(SweepRasterizer&&) noexcept;
+   SweepRasterizer& operator=(SweepRasterizer&&) noexcept;
+
+   const RasterExtent& extent() const;
+
+   /**
+    * @brief Image pixels, ordered by row (north to south) then column (west to
+    * east).
+    */
+   const std::vector<boost::gil::rgba8_pixel_t>& pixels() const;
+
+   /**
+    * @brief Clears the image to transparent.
+    */
+   void Clear();
+
+   /**
+    * @brief Draws a sweep over the current image contents.
+    *
+    * @param [in] buffers Sweep vertices and data moments
+    * @param [in] colorTable Data moment color lookup table
+    * @param [in] cfpEnabled Whether to apply clutter filter power removed
+    *
+    * @return Number of triangles drawn
+    */
+   std::size_t Draw(const SweepBuffers&     buffers,
+                    const RasterColorTable& colorTable,
+                    bool                    cfpEnabled = false);
+
+   /**
+    * @brief Draws a polar sweep over the current image contents, sampling the
+    * sweep at each pixel center as the polar fragment shader does.
+    *
+    * @param [in] sweep Packed polar sweep
+    * @param [in] siteFrame Radar site frame
+    * @param [in] colorTable Data moment color lookup table
+    * @param [in] cfpEnabled Whether to apply clutter filter power removed
+    *
+    * @return Number of pixels drawn
+    */
+   std::size_t DrawPolar(const PolarSweep&       sweep,
+                         const PolarSiteFrame&   siteFrame,
+                         const RasterColorTable& colorTable,
+                         bool                    cfpEnabled = false);
+
+   /**
+    * @brief Writes the image to a PNG file.
+    *
+    * @return true if the file was written successfully
+    */
+   bool WritePng(const std::string& filename) const;
+
+   /**
+    * @brief Writes the image to an uncompressed GeoTIFF file, georeferenced
+    * in WGS 84 (EPSG:4326).
+    *
+    * @return true if the file was written successfully
+    */
+   bool WriteGeoTiff(const std::string& filename) const;
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,567 @@
+#include <scwx/qt/util/text_event_store.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+
+#include <boost/endian/conversion.hpp>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+static const std::string logPrefix_ = "scwx::qt::util::text_event_store";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+static const std::string kLogFilename_ {"text_events.log"};
+
+static constexpr std::size_t kSizeFieldSize_   = sizeof(std::uint32_t);
+static constexpr std::size_t kRecordHeaderSize_ = 9u; // Type, time
+static constexpr std::size_t kKeySizeFieldSize_ = sizeof(std::uint16_t);
+static constexpr std::size_t kMaxKeySize_ =
+   std::numeric_limits<std::uint16_t>::max();
+static constexpr std::size_t kMaxRecordSize_ =
+   std::numeric_limits<std::uint32_t>::max();
+
+enum class RecordType : std::uint8_t
+{
+   Message       = 1,
+   HighWaterMark = 2
+};
+
+template<typename T>
+static void AppendValue(std::string& buffer, T value)
+{
+   boost::endian::native_to_little_inplace(value);
+   buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template<typename T>
+static T ReadValue(const char* data)
+{
+   T value;
+   std::memcpy(&value, data, sizeof(T));
+   return boost::endian::little_to_native(value);
+}
+
+static std::int64_t ToNanoseconds(std::chrono::system_clock::time_point time)
+{
+   return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             time.time_since_epoch())
+      .count();
+}
+
+static std::chrono::system_clock::time_point FromNanoseconds(std::int64_t value)
+{
+   return std::chrono::system_clock::time_point {
+      std::chrono::duration_cast<std::chrono::system_clock::duration>(
+         std::chrono::nanoseconds {value})};
+}
+
+class TextEventStore::Impl
+{
+public:
+   struct Record
+   {
+      std::string                           key_ {};
+      std::chrono::system_clock::time_point time_ {};
+      std::uint64_t                         offset_ {};
+      std::size_t                           size_ {};
+
+      // Product text, if the store is not persisted
+      std::shared_ptr<const std::string> text_ {};
+   };
+
+   explicit Impl(const std::string& storePath) : storePath_ {storePath}
+   {
+      if (!storePath_.empty())
+      {
+         Open();
+      }
+   }
+   ~Impl() = default;
+
+   void Open();
+   void Index(std::ifstream& is, std::uint64_t fileSize);
+   void Reset();
+
+   void AddRecord(Record&& record);
+   bool WriteRecord(RecordType                            type,
+                    std::chrono::system_clock::time_point time,
+                    std::string_view                      key,
+                    std::string_view                      text);
+
+   std::vector<std::shared_ptr<awips::TextProductMessage>>
+   ReadRecords(const std::vector<std::size_t>& recordIndices) const;
+
+   std::filesystem::path storePath_;
+   std::filesystem::path logPath_ {};
+   std::ofstream         log_ {};
+   std::uint64_t         logSize_ {0u};
+
+   std::vector<Record>                                       records_ {};
+   std::unordered_map<std::string, std::vector<std::size_t>> keyIndex_ {};
+   std::multimap<std::chrono::system_clock::time_point, std::size_t>
+      timeIndex_ {};
+
+   std::chrono::system_clock::time_point highWaterMark_ {};
+
+   mutable std::mutex mutex_ {};
+};
+
+TextEventStore::TextEventStore(const std::string& storePath) :
+    p(std::make_unique<Impl>(storePath))
+{
+}
+TextEventStore::~TextEventStore() = default;
+
+TextEventStore::TextEventStore(TextEventStore&&) noexcept            = default;
+TextEventStore& TextEventStore::operator=(TextEventStore&&) noexcept = default;
+
+void TextEventStore::Impl::Open()
+{
+   std::error_code error;
+   std::filesystem::create_directories(storePath_, error);
+   if (error)
+   {
+      logger_->error("Unable to create text event store directory: {} ({})",
+                     storePath_.string(),
+                     error.message());
+      storePath_.clear();
+      return;
+   }
+
+   logPath_ = storePath_ / kLogFilename_;
+
+   const std::uint64_t fileSize =
+      std::filesystem::exists(logPath_, error) ?
+         std::filesystem::file_size(logPath_, error) :
+         0u;
+
+   if (fileSize > 0u)
+   {
+      std::ifstream is {logPath_, std::ios_base::binary};
+      Index(is, fileSize);
+   }
+
+   if (logSize_ == 0u)
+   {
+      // Begin a new log
+      std::ofstream os {logPath_,
+                        std::ios_base::binary | std::ios_base::trunc};
+      os.write(kMagic_.data(), static_cast<std::streamsize>(kMagic_.size()));
+      logSize_ = kMagic_.size();
+   }
+   else if (logSize_ < fileSize)
+   {
+      logger_->warn("Discarding incomplete text event record");
+      std::filesystem::resize_file(logPath_, logSize_, error);
+   }
+
+   log_.open(logPath_, std::ios_base::binary | std::ios_base::app);
+   if (!log_.is_open() || error)
+   {
+      logger_->error("Unable to open text event store: {}",
+                     logPath_.string());
+      log_.close();
+      Reset();
+      storePath_.clear();
+      return;
+   }
+
+   logger_->debug("Opened text event store with {} records",
+                  records_.size());
+}
+
+void TextEventStore::Impl::Index(std::ifstream& is, std::uint64_t fileSize)
+{
+   std::string magic(kMagic_.size(), '\0');
+   is.read(magic.data(), static_cast<std::streamsize>(magic.size()));
+
+   if (!is || magic != kMagic_)
+   {
+      logger_->error("Invalid text event store: {}", logPath_.string());
+      return;
+   }
+
+   std::uint64_t position = kMagic_.size();
+
+   // Read record headers, skipping product text
+   while (position + kSizeFieldSize_ + kRecordHeaderSize_ <= fileSize)
+   {
+      char header[kSizeFieldSize_ + kRecordHeaderSize_];
+      if (!is.read(header, sizeof(header)))
+      {
+         break;
+      }
+
+      const std::uint64_t recordSize = ReadValue<std::uint32_t>(header);
+      const std::uint64_t recordEnd  = position + kSizeFieldSize_ + recordSize;
+      const auto          type       = static_cast<RecordType>(
+         ReadValue<std::uint8_t>(header + kSizeFieldSize_));
+      const auto time = FromNanoseconds(
+         ReadValue<std::int64_t>(header + kSizeFieldSize_ + 1u));
+
+      if (recordSize < kRecordHeaderSize_ || recordEnd > fileSize)
+      {
+         break;
+      }
+
+      if (type == RecordType::Message)
+      {
+         char keySize[kKeySizeFieldSize_];
+         if (recordSize < kRecordHeaderSize_ + kKeySizeFieldSize_ ||
+             !is.read(keySize, sizeof(keySize)))
+         {
+            break;
+         }
+
+         Record record {};
+         record.key_.resize(ReadValue<std::uint16_t>(keySize));
+         record.time_   = time;
+         record.offset_ = position + kSizeFieldSize_ + kRecordHeaderSize_ +
+                          kKeySizeFieldSize_ + record.key_.size();
+
+         if (record.offset_ > recordEnd ||
+             !is.read(record.key_.data(),
+                      static_cast<std::streamsize>(record.key_.size())))
+         {
+            break;
+         }
+
+         record.size_ = static_cast<std::size_t>(recordEnd - record.offset_);
+         AddRecord(std::move(record));
+      }
+      else if (type == RecordType::HighWaterMark)
+      {
+         highWaterMark_ = std::max(highWaterMark_, time);
+      }
+      else
+      {
+         logger_->warn("Unknown text event record type: {}",
+                       static_cast<int>(type));
+      }
+
+      position = recordEnd;
+      logSize_ = recordEnd;
+      is.seekg(static_cast<std::streamoff>(position));
+   }
+
+   if (logSize_ == 0u)
+   {
+      // The header is valid, with no complete records
+      logSize_ = kMagic_.size();
+   }
+}
+
+void TextEventStore::Impl::Reset()
+{
+   records_.clear();
+   keyIndex_.clear();
+   timeIndex_.clear();
+   highWaterMark_ = {};
+   logSize_       = 0u;
+}
+
+void TextEventStore::Impl::AddRecord(Record&& record)
+{
+   const std::size_t index = records_.size();
+
+   keyIndex_[record.key_].push_back(index);
+   timeIndex_.emplace(record.time_, index);
+   records_.push_back(std::move(record));
+}
+
+bool TextEventStore::Impl::WriteRecord(
+   RecordType                            type,
+   std::chrono::system_clock::time_point time,
+   std::string_view                      key,
+   std::string_view                      text)
+{
+   const std::size_t bodySize =
+      (type == RecordType::Message) ?
+         kKeySizeFieldSize_ + key.size() + text.size() :
+         0u;
+
+   if (key.size() > kMaxKeySize_ ||
+       kRecordHeaderSize_ + bodySize > kMaxRecordSize_)
+   {
+      logger_->warn("Text event record too large: {}", key);
+      return false;
+   }
+
+   std::string buffer {};
+   buffer.reserve(kSizeFieldSize_ + kRecordHeaderSize_ + bodySize);
+
+   AppendValue(buffer,
+               static_cast<std::uint32_t>(kRecordHeaderSize_ + bodySize));
+   AppendValue(buffer, static_cast<std::uint8_t>(type));
+   AppendValue(buffer, ToNanoseconds(time));
+
+   if (type == RecordType::Message)
+   {
+      AppendValue(buffer, static_cast<std::uint16_t>(key.size()));
+      buffer.append(key);
+      buffer.append(text);
+   }
+
+   log_.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+   log_.flush();
+
+   if (!log_)
+   {
+      logger_->error("Unable to write text event store: {}",
+                     logPath_.string());
+
+      // Discard a partially written record
+      log_.close();
+      std::error_code error;
+      std::filesystem::resize_file(logPath_, logSize_, error);
+      log_.open(logPath_, std::ios_base::binary | std::ios_base::app);
+      return false;
+   }
+
+   logSize_ += buffer.size();
+   return true;
+}
+
+std::vector<std::shared_ptr<awips::TextProductMessage>>
+TextEventStore::Impl::ReadRecords(
+   const std::vector<std::size_t>& recordIndices) const
+{
+   std::vector<std::shared_ptr<awips::TextProductMessage>> messages {};
+   messages.reserve(recordIndices.size());
+
+   std::ifstream is {};
+   if (!storePath_.empty())
+   {
+      is.open(logPath_, std::ios_base::binary);
+   }
+
+   for (std::size_t index : recordIndices)
+   {
+      const Record& record = records_[index];
+      std::string   text {};
+
+      if (record.text_ != nullptr)
+      {
+         text = *record.text_;
+      }
+      else
+      {
+         text.resize(record.size_);
+         is.seekg(static_cast<std::streamoff>(record.offset_));
+         if (!is.read(text.data(), static_cast<std::streamsize>(text.size())))
+         {
+            logger_->warn("Unable to read text event record: {}",
+                          record.key_);
+            is.clear();
+            continue;
+         }
+      }
+
+      std::istringstream messageStream {text};
+      auto message = awips::TextProductMessage::Create(messageStream);
+      if (message != nullptr)
+      {
+         messages.push_back(std::move(message));
+      }
+   }
+
+   return messages;
+}
+
+std::size_t TextEventStore::record_count() const
+{
+   std::unique_lock lock(p->mutex_);
+   return p->records_.size();
+}
+
+std::chrono::system_clock::time_point TextEventStore::high_water_mark() const
+{
+   std::unique_lock lock(p->mutex_);
+   return p->highWaterMark_;
+}
+
+bool TextEventStore::Append(const types::TextEventKey&            key,
+                            std::chrono::system_clock::time_point time,
+                            const awips::TextProductMessage&      message)
+{
+   auto text = message.raw_text();
+   if (text == nullptr)
+   {
+      return false;
+   }
+
+   Impl::Record record {};
+   record.key_  = key.ToString();
+   record.time_ = time;
+   record.size_ = text->size();
+
+   std::unique_lock lock(p->mutex_);
+
+   if (p->storePath_.empty())
+   {
+      record.text_ = std::move(text);
+   }
+   else
+   {
+      record.offset_ = p->logSize_ + kSizeFieldSize_ + kRecordHeaderSize_ +
+                       kKeySizeFieldSize_ + record.key_.size();
+
+      if (!p->WriteRecord(RecordType::Message, time, record.key_, *text))
+      {
+         return false;
+      }
+   }
+
+   p->AddRecord(std::move(record));
+   return true;
+}
+
+void TextEventStore::SetHighWaterMark(
+   std::chrono::system_clock::time_point time)
+{
+   std::unique_lock lock(p->mutex_);
+
+   if (time <= p->highWaterMark_)
+   {
+      return;
+   }
+
+   if (p->storePath_.empty() ||
+       p->WriteRecord(RecordType::HighWaterMark, time, {}, {}))
+   {
+      p->highWaterMark_ = time;
+   }
+}
+
+std::vector<std::shared_ptr<awips::TextProductMessage>>
+TextEventStore::Read(const types::TextEventKey& key) const
+{
+   std::unique_lock lock(p->mutex_);
+
+   auto it = p->keyIndex_.find(key.ToString());
+   if (it == p->keyIndex_.cend())
+   {
+      return {};
+   }
+
+   return p->ReadRecords(it->second);
+}
+
+std::vector<std::shared_ptr<awips::TextProductMessage>>
+TextEventStore::Read(std::chrono::system_clock::time_point begin,
+                     std::chrono::system_clock::time_point end) const
+{
+   std::unique_lock lock(p->mutex_);
+
+   std::vector<std::size_t> recordIndices {};
+
+   for (auto it = p->timeIndex_.lower_bound(begin);
+        it != p->timeIndex_.cend() && it->first < end;
+        ++it)
+   {
+      recordIndices.push_back(it->second);
+   }
+
+   return p->ReadRecords(recordIndices);
+}
+
+std::size_t
+TextEventStore::Prune(std::chrono::system_clock::time_point before)
+{
+   std::unique_lock lock(p->mutex_);
+
+   auto firstKept = p->timeIndex_.lower_bound(before);
+   if (firstKept == p->timeIndex_.cbegin())
+   {
+      return 0u;
+   }
+
+   std::vector<std::size_t> keptIndices {};
+   for (auto it = firstKept; it != p->timeIndex_.cend(); ++it)
+   {
+      keptIndices.push_back(it->second);
+   }
+   std::sort(keptIndices.begin(), keptIndices.end());
+
+   const std::size_t removed = p->records_.size() - keptIndices.size();
+   const auto        highWaterMark = p->highWaterMark_;
+
+   std::vector<Impl::Record> records = std::move(p->records_);
+   p->Reset();
+
+   if (p->storePath_.empty())
+   {
+      for (std::size_t index : keptIndices)
+      {
+         p->AddRecord(std::move(records[index]));
+      }
+      p->highWaterMark_ = highWaterMark;
+      return removed;
+   }
+
+   // Copy the remaining records to a new log, and replace the existing log
+   std::ifstream         is {p->logPath_, std::ios_base::binary};
+   std::filesystem::path tempPath = p->logPath_;
+   tempPath += ".tmp";
+
+   p->log_.close();
+   p->log_.open(tempPath, std::ios_base::binary | std::ios_base::trunc);
+   p->log_.write(kMagic_.data(), static_cast<std::streamsize>(kMagic_.size()));
+   p->logSize_ = kMagic_.size();
+
+   bool success =
+      static_cast<bool>(p->log_) &&
+      p->WriteRecord(RecordType::HighWaterMark, highWaterMark, {}, {});
+
+   std::string text {};
+   for (auto it = keptIndices.cbegin(); success && it != keptIndices.cend();
+        ++it)
+   {
+      const Impl::Record& record = records[*it];
+
+      text.resize(record.size_);
+      is.seekg(static_cast<std::streamoff>(record.offset_));
+      is.read(text.data(), static_cast<std::streamsize>(text.size()));
+
+      success = static_cast<bool>(is) &&
+                p->WriteRecord(
+                   RecordType::Message, record.time_, record.key_, text);
+   }
+
+   p->log_.close();
+   is.close();
+
+   std::error_code error;
+   if (success)
+   {
+      std::filesystem::rename(tempPath, p->logPath_, error);
+   }
+
+   if (!success || error)
+   {
+      logger_->error("Unable to prune text event store");
+      std::filesystem::remove(tempPath, error);
+   }
+
+   // Index the resulting log
+   p->Reset();
+   p->Open();
+
+   return success ? removed : 0u;
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
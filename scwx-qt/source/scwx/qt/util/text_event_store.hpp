@@ -0,0 +1,108 @@
+#pragma once
+
+#include <scwx/awips/text_product_message.hpp>
+#include <scwx/qt/types/text_event_key.hpp>
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+/**
+ * @brief A persistent, append-only store of text event messages.
+ *
+ * Messages are appended to a log on disk as raw product text, along with the
+ * text event key and issuance time. The log is indexed by key and time when
+ * the store is opened, reading only record headers. Messages are parsed when
+ * read.
+ *
+ * The store also records a high-water mark, the start time of the latest
+ * source data which has been stored, such that source data need not be
+ * retrieved again.
+ *
+ * Log layout (little endian):
+ * - Header: magic "SCWXTEV1"
+ * - Records: record size (uint32, excluding the size), record type (uint8)
+ *   and time (int64, nanoseconds since the epoch), followed by the record
+ *   body. Message record bodies contain the key length (uint16), key and
+ *   product text. High-water mark records have no body.
+ *
+ * An incomplete record at the end of the log is discarded when the store is
+ * opened.
+ */
+class TextEventStore
+{
+public:
+   static constexpr std::string_view kMagic_ {"SCWXTEV1"};
+
+   /**
+    * @param [in] storePath Directory in which to persist the store. If empty,
+    * messages are only stored in memory.
+    */
+   explicit TextEventStore(const std::string& storePath);
+   ~TextEventStore();
+
+   TextEventStore(const TextEventStore&)            = delete;
+   TextEventStore& operator=(const TextEventStore&) = delete;
+
+   TextEventStore(TextEventStore&&) noexcept;
+   TextEventStore& operator=(TextEventStore&&) noexcept;
+
+   std::size_t                           record_count() const;
+   std::chrono::system_clock::time_point high_water_mark() const;
+
+   /**
+    * @brief Appends a message to the store.
+    *
+    * @param [in] key Text event key
+    * @param [in] time Issuance time
+    * @param [in] message Text product message
+    *
+    * @return true if the message was stored
+    */
+   bool Append(const types::TextEventKey&            key,
+               std::chrono::system_clock::time_point time,
+               const awips::TextProductMessage&      message);
+
+   /**
+    * @brief Advances the high-water mark. Earlier times are ignored.
+    */
+   void SetHighWaterMark(std::chrono::system_clock::time_point time);
+
+   /**
+    * @brief Reads the messages of a text event, in the order appended.
+    */
+   std::vector<std::shared_ptr<awips::TextProductMessage>>
+   Read(const types::TextEventKey& key) const;
+
+   /**
+    * @brief Reads the messages issued in the time range [begin, end), ordered
+    * by issuance time.
+    */
+   std::vector<std::shared_ptr<awips::TextProductMessage>>
+   Read(std::chrono::system_clock::time_point begin,
+        std::chrono::system_clock::time_point end =
+           std::chrono::system_clock::time_point::max()) const;
+
+   /**
+    * @brief Removes messages issued before a time, rewriting the log.
+    *
+    * @return Number of messages removed
+    */
+   std::size_t Prune(std::chrono::system_clock::time_point before);
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
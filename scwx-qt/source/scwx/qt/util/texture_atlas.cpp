@@ -1,9 +1,12 @@
 #include <scwx/qt/util/texture_atlas.hpp>
+#include <scwx/qt/util/atlas_packer.hpp>
+#include <scwx/qt/util/image_cache.hpp>
 #include <scwx/qt/util/streams.hpp>
-#include <scwx/network/cpr.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/metrics.hpp>
 
-#include <execution>
+#include <atomic>
+#include <mutex>
 #include <shared_mutex>
 #include <unordered_map>
 
@@ -13,12 +16,11 @@
 #   pragma warning(disable : 4714)
 #endif
 
+#include <boost/asio/post.hpp>
+#include <boost/asio/thread_pool.hpp>
 #include <boost/gil/extension/io/png.hpp>
 #include <boost/iostreams/stream.hpp>
 #include <boost/timer/timer.hpp>
-#include <cpr/cpr.h>
-#include <stb_image.h>
-#include <stb_rect_pack.h>
 #include <QFile>
 #include <QFileInfo>
 #include <QPainter>
@@ -43,11 +45,32 @@ namespace util
 static const std::string logPrefix_ = "scwx::qt::util::texture_atlas";
 static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 
+// GL_MAX_ARRAY_TEXTURE_LAYERS is guaranteed to be at least 256 in OpenGL 3.3
+static constexpr std::size_t kMaxLayers_ = 256u;
+
+// Maximum number of regions to track for partial buffering, before buffering
+// the entire atlas
+static constexpr std::size_t kMaxDirtyRegions_ = 1024u;
+
+// Fraction of a layer which may be occupied by removed textures before the
+// atlas is compacted
+static constexpr double kCompactionThreshold_ = 0.5;
+
 class TextureAtlas::Impl
 {
 public:
+   typedef boost::gil::rgba8_image_t ImageType;
+   typedef std::unordered_map<std::string, std::shared_ptr<ImageType>>
+      ImageMap;
+
+   struct DirtyRegion
+   {
+      std::uint64_t buildCount_;
+      AtlasRegion   region_;
+   };
+
    explicit Impl() {}
-   ~Impl() {}
+   ~Impl() { threadPool_.join(); }
 
    static std::shared_ptr<boost::gil::rgba8_image_t>
    LoadImage(const std::string& imagePath);
@@ -57,6 +80,23 @@ public:
    static std::shared_ptr<boost::gil::rgba8_image_t>
    ReadSvgFile(const QString& imagePath);
 
+   static boost::gil::rgba8_image_t CreateLayer(std::size_t width,
+                                                std::size_t height);
+   static void CopyImage(boost::gil::rgba8_image_t& atlas,
+                         const AtlasRegion&         region,
+                         const ImageType&           image);
+   static TextureAttributes CreateAttributes(const AtlasRegion& region,
+                                             std::size_t        width,
+                                             std::size_t        height);
+
+   void BufferRegion(gl::OpenGLFunctions& gl, const AtlasRegion& region) const;
+   ImageMap GetCachedImages();
+   void Rebuild(std::size_t width, std::size_t height, const ImageMap& images);
+   void ScheduleCompaction();
+   void Update(const ImageMap& images);
+
+   boost::asio::thread_pool threadPool_ {1u};
+
    std::vector<std::shared_ptr<boost::gil::rgba8_image_t>>
                      registeredTextures_ {};
    std::shared_mutex registeredTextureMutex_ {};
@@ -65,11 +105,19 @@ public:
    std::unordered_map<std::string, std::weak_ptr<boost::gil::rgba8_image_t>>
       textureCache_ {};
 
-   std::vector<boost::gil::rgba8_image_t>             atlasArray_ {};
-   std::unordered_map<std::string, TextureAttributes> atlasMap_ {};
-   std::shared_mutex                                  atlasMutex_ {};
+   // Packing state, protected by the build mutex
+   std::unique_ptr<AtlasPacker> packer_ {};
+   std::mutex                   buildMutex_ {};
+   std::atomic<bool>            compactionPending_ {false};
 
-   std::uint64_t buildCount_ {0u};
+   std::vector<boost::gil::rgba8_image_t>                    atlasArray_ {};
+   std::unordered_map<std::string, TextureAttributes>        atlasMap_ {};
+   std::unordered_map<std::string, std::weak_ptr<ImageType>> atlasImages_ {};
+   std::vector<DirtyRegion>                                  dirtyRegions_ {};
+   std::shared_mutex                                         atlasMutex_ {};
+
+   std::atomic<std::uint64_t> buildCount_ {0u};
+   std::uint64_t              layoutBuildCount_ {0u};
 };
 
 TextureAtlas::TextureAtlas() : p(std::make_unique<Impl>()) {}
@@ -126,224 +174,335 @@ void TextureAtlas::BuildAtlas(std::size_t width, std::size_t height)
       return;
    }
 
-   typedef std::vector<
-      std::pair<std::string, std::shared_ptr<boost::gil::rgba8_image_t>>>
-      ImageVector;
+   std::unique_lock buildLock(p->buildMutex_);
 
-   ImageVector             images {};
-   std::vector<stbrp_rect> stbrpRects {};
+   Impl::ImageMap images = p->GetCachedImages();
 
-   // Cached images
+   if (p->packer_ == nullptr || p->packer_->width() != width ||
+       p->packer_->height() != height)
+   {
+      // The atlas has not been built with the requested size
+      p->Rebuild(width, height, images);
+   }
+   else
    {
-      // Take a lock on the texture cache map while adding textures images to
-      // the atlas vector.
-      std::unique_lock textureCacheLock(p->textureCacheMutex_);
+      // Pack new textures around existing textures
+      p->Update(images);
+   }
 
-      // For each cached texture
-      for (auto it = p->textureCache_.begin(); it != p->textureCache_.end();)
-      {
-         auto& texture = *it;
-         auto  image   = texture.second.lock();
+   timer.stop();
+   logger_->debug("Texture atlas built in {}", timer.format(6, "%ws"));
+}
 
-         if (image == nullptr)
-         {
-            logger_->trace("Removing texture from the cache: {}",
-                           texture.first);
+TextureAtlas::Impl::ImageMap TextureAtlas::Impl::GetCachedImages()
+{
+   ImageMap images {};
 
-            // If the image is no longer cached, erase the iterator and continue
-            it = p->textureCache_.erase(it);
-            continue;
-         }
-         else if (image->width() > 0u && image->height() > 0u)
-         {
-            // Store STB rectangle pack data in a vector
-            stbrpRects.push_back(
-               stbrp_rect {0,
-                           static_cast<stbrp_coord>(image->width()),
-                           static_cast<stbrp_coord>(image->height()),
-                           0,
-                           0,
-                           0});
-
-            // Store image data in a vector
-            images.push_back({texture.first, image});
-         }
+   // Take a lock on the texture cache map while adding textures images to the
+   // image map
+   std::unique_lock textureCacheLock(textureCacheMutex_);
+
+   // For each cached texture
+   for (auto it = textureCache_.begin(); it != textureCache_.end();)
+   {
+      auto& texture = *it;
+      auto  image   = texture.second.lock();
 
-         // Increment iterator
-         ++it;
+      if (image == nullptr)
+      {
+         logger_->trace("Removing texture from the cache: {}", texture.first);
+
+         // If the image is no longer cached, erase the iterator and continue
+         it = textureCache_.erase(it);
+         continue;
       }
+      else if (image->width() > 0u && image->height() > 0u)
+      {
+         images.emplace(texture.first, std::move(image));
+      }
+
+      // Increment iterator
+      ++it;
    }
 
-   // GL_MAX_ARRAY_TEXTURE_LAYERS is guaranteed to be at least 256 in OpenGL 3.3
-   constexpr std::size_t kMaxLayers = 256u;
+   return images;
+}
 
-   const float xStep = 1.0f / width;
-   const float yStep = 1.0f / height;
-   const float xMin  = xStep * 0.5f;
-   const float yMin  = yStep * 0.5f;
+void TextureAtlas::Impl::Rebuild(std::size_t     width,
+                                 std::size_t     height,
+                                 const ImageMap& images)
+{
+   logger_->trace("Packing {} images", images.size());
 
-   // Optimal number of nodes = width
-   stbrp_context           stbrpContext;
-   std::vector<stbrp_node> stbrpNodes(width);
-   ImageVector             unpackedImages {};
-   std::vector<stbrp_rect> unpackedRects {};
+   auto packer = std::make_unique<AtlasPacker>(width, height, kMaxLayers_);
 
-   std::vector<boost::gil::rgba8_image_t>             newAtlasArray {};
-   std::unordered_map<std::string, TextureAttributes> newAtlasMap {};
+   std::vector<ImageMap::const_iterator> imageList {};
+   std::vector<AtlasPacker::Size>        sizes {};
+
+   for (auto it = images.cbegin(); it != images.cend(); ++it)
+   {
+      imageList.push_back(it);
+      sizes.push_back({static_cast<std::int32_t>(it->second->width()),
+                       static_cast<std::int32_t>(it->second->height())});
+   }
+
+   std::vector<std::optional<AtlasRegion>> regions = packer->Pack(sizes);
+
+   // Populate atlas
+   logger_->trace("Populating atlas");
+
+   std::vector<boost::gil::rgba8_image_t> newAtlasArray {};
+   std::unordered_map<std::string, TextureAttributes>         newAtlasMap {};
+   std::unordered_map<std::string, std::weak_ptr<ImageType>> newAtlasImages {};
+
+   for (std::size_t layer = 0; layer < packer->layer_count(); ++layer)
+   {
+      newAtlasArray.emplace_back(CreateLayer(width, height));
+   }
 
-   for (std::size_t layer = 0; layer < kMaxLayers; ++layer)
+   for (std::size_t i = 0; i < imageList.size(); ++i)
    {
-      logger_->trace("Processing layer {}", layer);
+      const std::string&                name  = imageList[i]->first;
+      const std::shared_ptr<ImageType>& image = imageList[i]->second;
 
-      // Pack images
+      if (!regions[i].has_value())
       {
-         logger_->trace("Packing {} images", images.size());
-
-         stbrp_init_target(&stbrpContext,
-                           static_cast<int>(width),
-                           static_cast<int>(height),
-                           stbrpNodes.data(),
-                           static_cast<int>(stbrpNodes.size()));
-
-         // Pack loaded textures
-         stbrp_pack_rects(&stbrpContext,
-                          stbrpRects.data(),
-                          static_cast<int>(stbrpRects.size()));
+         logger_->warn("Unable to pack texture: {}", name);
+         continue;
       }
 
-      // Clear atlas
-      boost::gil::rgba8_image_t atlas(width, height);
-      boost::gil::rgba8_view_t  atlasView = boost::gil::view(atlas);
-      boost::gil::fill_pixels(atlasView,
-                              boost::gil::rgba8_pixel_t {255, 0, 255, 255});
+      CopyImage(newAtlasArray[regions[i]->layer_], *regions[i], *image);
+
+      newAtlasMap.insert_or_assign(
+         name, CreateAttributes(*regions[i], width, height));
+      newAtlasImages.insert_or_assign(name, image);
+   }
+
+   // Lock atlas
+   std::unique_lock lock(atlasMutex_);
 
-      // Populate atlas
-      logger_->trace("Populating atlas");
+   packer_ = std::move(packer);
+   atlasArray_.swap(newAtlasArray);
+   atlasMap_.swap(newAtlasMap);
+   atlasImages_.swap(newAtlasImages);
 
-      std::size_t numPackedImages = 0u;
+   // Mark the need to buffer the entire atlas
+   dirtyRegions_.clear();
+   layoutBuildCount_ = ++buildCount_;
+}
 
-      for (std::size_t i = 0; i < images.size(); ++i)
+void TextureAtlas::Impl::Update(const ImageMap& images)
+{
+   const std::size_t width  = packer_->width();
+   const std::size_t height = packer_->height();
+
+   // Determine which textures have been removed from the cache, or replaced
+   // with a new image
+   std::vector<std::string> removedTextures {};
+
+   for (auto& atlasImage : atlasImages_)
+   {
+      auto it = images.find(atlasImage.first);
+      if (it == images.cend() || it->second != atlasImage.second.lock())
       {
-         // If the image was packed successfully
-         if (stbrpRects[i].was_packed != 0)
-         {
-            // Populate the atlas
-            boost::gil::rgba8c_view_t imageView =
-               boost::gil::const_view(*images[i].second);
-
-            boost::gil::rgba8_view_t atlasSubView =
-               boost::gil::subimage_view(atlasView,
-                                         stbrpRects[i].x,
-                                         stbrpRects[i].y,
-                                         imageView.width(),
-                                         imageView.height());
-
-            boost::gil::copy_pixels(imageView, atlasSubView);
-
-            // Add texture image to the index
-            const stbrp_coord x = stbrpRects[i].x;
-            const stbrp_coord y = stbrpRects[i].y;
-
-            const float sLeft = x * xStep + xMin;
-            const float sRight =
-               sLeft + static_cast<float>(imageView.width() - 1) / width;
-            const float tTop = y * yStep + yMin;
-            const float tBottom =
-               tTop + static_cast<float>(imageView.height() - 1) / height;
-
-            newAtlasMap.emplace(
-               std::piecewise_construct,
-               std::forward_as_tuple(images[i].first),
-               std::forward_as_tuple(
-                  layer,
-                  boost::gil::point_t {x, y},
-                  boost::gil::point_t {imageView.width(), imageView.height()},
-                  sLeft,
-                  sRight,
-                  tTop,
-                  tBottom));
-
-            numPackedImages++;
-         }
-         else
-         {
-            unpackedImages.push_back(std::move(images[i]));
-            unpackedRects.push_back(stbrpRects[i]);
-         }
+         removedTextures.push_back(atlasImage.first);
       }
+   }
+
+   // Determine which textures need to be added
+   std::vector<ImageMap::const_iterator> addedTextures {};
+   std::vector<AtlasPacker::Size>        sizes {};
 
-      if (numPackedImages > 0u)
+   for (auto it = images.cbegin(); it != images.cend(); ++it)
+   {
+      auto atlasImage = atlasImages_.find(it->first);
+      if (atlasImage == atlasImages_.cend() ||
+          atlasImage->second.lock() != it->second)
       {
-         // The new atlas layer has images that were able to be packed
-         newAtlasArray.emplace_back(std::move(atlas));
+         addedTextures.push_back(it);
+         sizes.push_back({static_cast<std::int32_t>(it->second->width()),
+                          static_cast<std::int32_t>(it->second->height())});
       }
+   }
+
+   if (removedTextures.empty() && addedTextures.empty())
+   {
+      logger_->trace("Texture atlas is up to date");
+      return;
+   }
 
-      if (unpackedImages.empty())
+   logger_->trace("Packing {} images, removing {} images",
+                  addedTextures.size(),
+                  removedTextures.size());
+
+   // Pack new textures into free space, without moving existing textures
+   std::vector<std::optional<AtlasRegion>> regions = packer_->Pack(sizes);
+
+   // Lock atlas
+   std::unique_lock lock(atlasMutex_);
+
+   const bool layersAdded = packer_->layer_count() > atlasArray_.size();
+   while (atlasArray_.size() < packer_->layer_count())
+   {
+      atlasArray_.emplace_back(CreateLayer(width, height));
+   }
+
+   for (const std::string& name : removedTextures)
+   {
+      const TextureAttributes& attributes = atlasMap_.at(name);
+
+      packer_->Remove(
+         AtlasRegion {attributes.layerId_,
+                      static_cast<std::int32_t>(attributes.position_.x),
+                      static_cast<std::int32_t>(attributes.position_.y),
+                      static_cast<std::int32_t>(attributes.size_.x),
+                      static_cast<std::int32_t>(attributes.size_.y)});
+
+      atlasMap_.erase(name);
+      atlasImages_.erase(name);
+   }
+
+   const std::uint64_t buildCount = buildCount_ + 1u;
+
+   for (std::size_t i = 0; i < addedTextures.size(); ++i)
+   {
+      const std::string&                name  = addedTextures[i]->first;
+      const std::shared_ptr<ImageType>& image = addedTextures[i]->second;
+
+      if (!regions[i].has_value())
       {
-         // All images have been packed into the texture atlas
-         break;
+         logger_->warn("Unable to pack texture: {}", name);
+         continue;
       }
-      else if (layer == kMaxLayers - 1u || numPackedImages == 0u)
+
+      CopyImage(atlasArray_[regions[i]->layer_], *regions[i], *image);
+
+      atlasMap_.insert_or_assign(name,
+                                 CreateAttributes(*regions[i], width, height));
+      atlasImages_.insert_or_assign(name, image);
+
+      dirtyRegions_.push_back({buildCount, *regions[i]});
+   }
+
+   buildCount_ = buildCount;
+
+   if (layersAdded || dirtyRegions_.size() > kMaxDirtyRegions_)
+   {
+      // Texture storage must be reallocated to add layers, buffer the entire
+      // atlas
+      dirtyRegions_.clear();
+      layoutBuildCount_ = buildCount;
+   }
+
+   lock.unlock();
+
+   // Space of removed textures is not reused until the atlas is rebuilt
+   if (packer_->fragmented_area() >
+       static_cast<std::size_t>(width * height * kCompactionThreshold_))
+   {
+      ScheduleCompaction();
+   }
+}
+
+void TextureAtlas::Impl::ScheduleCompaction()
+{
+   if (compactionPending_.exchange(true))
+   {
+      // Compaction is already scheduled
+      return;
+   }
+
+   boost::asio::post(
+      threadPool_,
+      [this]()
       {
-         // Some images were unable to be packed into the texture atlas
-         for (auto& image : unpackedImages)
+         std::unique_lock buildLock(buildMutex_);
+
+         compactionPending_ = false;
+
+         if (packer_ != nullptr)
          {
-            logger_->warn("Unable to pack texture: {}", image.first);
+            logger_->debug("Compacting texture atlas, {} pixels fragmented",
+                           packer_->fragmented_area());
+
+            Rebuild(packer_->width(), packer_->height(), GetCachedImages());
          }
-      }
-      else
-      {
-         // Swap in unpacked images for processing the next atlas layer
-         images.swap(unpackedImages);
-         stbrpRects.swap(unpackedRects);
-         unpackedImages.clear();
-         unpackedRects.clear();
-      }
-   }
+      });
+}
 
-   // Lock atlas
-   std::unique_lock lock(p->atlasMutex_);
+boost::gil::rgba8_image_t TextureAtlas::Impl::CreateLayer(std::size_t width,
+                                                          std::size_t height)
+{
+   boost::gil::rgba8_image_t atlas(width, height);
+   boost::gil::fill_pixels(boost::gil::view(atlas),
+                           boost::gil::rgba8_pixel_t {255, 0, 255, 255});
+   return atlas;
+}
 
-   p->atlasArray_.swap(newAtlasArray);
-   p->atlasMap_.swap(newAtlasMap);
+void TextureAtlas::Impl::CopyImage(boost::gil::rgba8_image_t& atlas,
+                                   const AtlasRegion&         region,
+                                   const ImageType&           image)
+{
+   boost::gil::rgba8c_view_t imageView = boost::gil::const_view(image);
+   boost::gil::rgba8_view_t  atlasSubView =
+      boost::gil::subimage_view(boost::gil::view(atlas),
+                                region.x_,
+                                region.y_,
+                                imageView.width(),
+                                imageView.height());
+
+   boost::gil::copy_pixels(imageView, atlasSubView);
+}
 
-   // Mark the need to buffer the atlas
-   ++p->buildCount_;
+TextureAttributes TextureAtlas::Impl::CreateAttributes(
+   const AtlasRegion& region, std::size_t width, std::size_t height)
+{
+   const float xStep = 1.0f / width;
+   const float yStep = 1.0f / height;
+   const float xMin  = xStep * 0.5f;
+   const float yMin  = yStep * 0.5f;
 
-   timer.stop();
-   logger_->debug("Texture atlas built in {}", timer.format(6, "%ws"));
+   const float sLeft = region.x_ * xStep + xMin;
+   const float sRight =
+      sLeft + static_cast<float>(region.width_ - 1) / width;
+   const float tTop = region.y_ * yStep + yMin;
+   const float tBottom =
+      tTop + static_cast<float>(region.height_ - 1) / height;
+
+   return TextureAttributes(region.layer_,
+                            boost::gil::point_t {region.x_, region.y_},
+                            boost::gil::point_t {region.width_, region.height_},
+                            sLeft,
+                            sRight,
+                            tTop,
+                            tBottom);
 }
 
-void TextureAtlas::BufferAtlas(gl::OpenGLFunctions& gl, GLuint texture)
+std::uint64_t TextureAtlas::BufferAtlas(gl::OpenGLFunctions& gl,
+                                        GLuint               texture,
+                                        std::uint64_t        bufferedBuildCount)
 {
    std::shared_lock lock(p->atlasMutex_);
 
-   if (p->atlasArray_.size() > 0u && p->atlasArray_[0].width() > 0 &&
-       p->atlasArray_[0].height() > 0)
-   {
-      const std::size_t numLayers = p->atlasArray_.size();
-      const std::size_t width     = p->atlasArray_[0].width();
-      const std::size_t height    = p->atlasArray_[0].height();
-      const std::size_t layerSize = width * height;
+   const std::uint64_t buildCount = p->buildCount_;
 
-      std::vector<boost::gil::rgba8_pixel_t> pixelData {layerSize * numLayers};
+   if (p->atlasArray_.empty() || p->atlasArray_[0].width() <= 0 ||
+       p->atlasArray_[0].height() <= 0)
+   {
+      return buildCount;
+   }
 
-      for (std::size_t i = 0; i < numLayers; ++i)
-      {
-         boost::gil::rgba8_view_t view = boost::gil::view(p->atlasArray_[i]);
-
-         boost::gil::copy_pixels(
-            view,
-            boost::gil::interleaved_view(view.width(),
-                                         view.height(),
-                                         pixelData.data() + (i * layerSize),
-                                         view.width() *
-                                            sizeof(boost::gil::rgba8_pixel_t)));
-      }
+   boost::timer::cpu_timer timer {};
+   timer.start();
 
-      lock.unlock();
+   gl.glBindTexture(GL_TEXTURE_2D_ARRAY, texture);
 
-      gl.glBindTexture(GL_TEXTURE_2D_ARRAY, texture);
+   if (bufferedBuildCount < p->layoutBuildCount_)
+   {
+      // Allocate texture storage, and buffer each layer
+      const std::size_t numLayers = p->atlasArray_.size();
+      const std::size_t width     = p->atlasArray_[0].width();
+      const std::size_t height    = p->atlasArray_[0].height();
 
       gl.glTexParameteri(
          GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
@@ -361,8 +520,68 @@ void TextureAtlas::BufferAtlas(gl::OpenGLFunctions& gl, GLuint texture)
                       0,
                       GL_RGBA,
                       GL_UNSIGNED_BYTE,
-                      pixelData.data());
+                      nullptr);
+
+      for (std::size_t layer = 0; layer < numLayers; ++layer)
+      {
+         p->BufferRegion(gl,
+                         AtlasRegion {layer,
+                                      0,
+                                      0,
+                                      static_cast<std::int32_t>(width),
+                                      static_cast<std::int32_t>(height)});
+      }
+   }
+   else
+   {
+      // Buffer only the regions which changed since the last buffer
+      std::size_t numRegions = 0u;
+
+      for (const Impl::DirtyRegion& dirtyRegion : p->dirtyRegions_)
+      {
+         if (dirtyRegion.buildCount_ > bufferedBuildCount)
+         {
+            p->BufferRegion(gl, dirtyRegion.region_);
+            ++numRegions;
+         }
+      }
+
+      logger_->trace("Buffered {} texture atlas regions", numRegions);
    }
+
+   lock.unlock();
+
+   timer.stop();
+   logger_->debug("Texture atlas buffered in {}", timer.format(6, "%ws"));
+
+   scwx::util::metrics::Registry::Instance()
+      .GetHistogram(
+         scwx::util::metrics::MetricName("gpu_upload", "texture_atlas"))
+      .Record(static_cast<std::uint64_t>(timer.elapsed().wall));
+
+   return buildCount;
+}
+
+void TextureAtlas::Impl::BufferRegion(gl::OpenGLFunctions& gl,
+                                      const AtlasRegion&   region) const
+{
+   boost::gil::rgba8c_view_t view =
+      boost::gil::const_view(atlasArray_[region.layer_]);
+
+   // Buffer directly from the atlas layer, which has unpadded rows
+   gl.glPixelStorei(GL_UNPACK_ROW_LENGTH, static_cast<GLint>(view.width()));
+   gl.glTexSubImage3D(GL_TEXTURE_2D_ARRAY,
+                      0,
+                      region.x_,
+                      region.y_,
+                      static_cast<GLint>(region.layer_),
+                      region.width_,
+                      region.height_,
+                      1,
+                      GL_RGBA,
+                      GL_UNSIGNED_BYTE,
+                      &view(region.x_, region.y_));
+   gl.glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
 }
 
 TextureAttributes TextureAtlas::GetTextureAttributes(const std::string& name)
@@ -390,7 +609,6 @@ TextureAtlas::Impl::LoadImage(const std::string& imagePath)
 
    QUrl url = QUrl::fromUserInput(qImagePath);
 
-
    if (url.isLocalFile())
    {
       QString suffix = QFileInfo(qImagePath).suffix().toLower();
@@ -407,71 +625,9 @@ TextureAtlas::Impl::LoadImage(const std::string& imagePath)
    }
    else
    {
-      auto response = cpr::Get(cpr::Url {imagePath}, network::cpr::GetHeader());
-
-      if (cpr::status::is_success(response.status_code))
-      {
-         // Use stbi, since we can only guess the image format
-         static constexpr int desiredChannels = 4;
-
-         int width;
-         int height;
-         int numChannels;
-
-         unsigned char* pixelData = stbi_load_from_memory(
-            reinterpret_cast<const unsigned char*>(response.text.data()),
-            static_cast<int>(
-               std::clamp<std::size_t>(response.text.size(), 0, INT32_MAX)),
-            &width,
-            &height,
-            &numChannels,
-            desiredChannels);
-
-         if (pixelData == nullptr)
-         {
-            logger_->error("Error loading image: {}", stbi_failure_reason());
-            return nullptr;
-         }
-
-         // Create a view pointing to the STB image data
-         auto stbView = boost::gil::interleaved_view(
-            width,
-            height,
-            reinterpret_cast<boost::gil::rgba8_pixel_t*>(pixelData),
-            width * desiredChannels);
-
-         // Copy the view to the destination image
-         image      = std::make_shared<boost::gil::rgba8_image_t>();
-         *image     = boost::gil::rgba8_image_t(stbView);
-         auto& view = boost::gil::view(*image);
-
-         // If no alpha channel, replace black with transparent
-         if (numChannels == 3)
-         {
-            std::for_each(
-               std::execution::par_unseq,
-               view.begin(),
-               view.end(),
-               [](boost::gil::rgba8_pixel_t& pixel)
-               {
-                  static const boost::gil::rgba8_pixel_t kBlack {0, 0, 0, 255};
-                  if (pixel == kBlack)
-                  {
-                     pixel[3] = 0;
-                  }
-               });
-         }
-
-         stbi_image_free(pixelData);
-      }
-      else if (response.status_code == 0)
-      {
-         logger_->error("Error loading image: {}", response.error.message);
-      }
-      else
-      {
-         logger_->error("Error loading image: {}", response.status_line);
-      }
+      // Remote images are revalidated, and only downloaded and decoded when
+      // changed
+      image = ImageCache::Instance().Get(imagePath);
    }
 
    return image;
@@ -71,13 +71,39 @@ public:
 
    static TextureAtlas& Instance();
 
+   /**
+    * @brief Gets the number of times the atlas contents have changed. Texture
+    * attributes must be queried again after the build count changes.
+    */
    std::uint64_t BuildCount() const;
 
    void RegisterTexture(const std::string& name, const std::string& path);
    std::shared_ptr<boost::gil::rgba8_image_t>
         CacheTexture(const std::string& name, const std::string& path);
+
+   /**
+    * @brief Packs cached textures into the atlas. Existing textures keep their
+    * placement, and new textures are packed into free space or a new layer.
+    * The atlas is repacked in the background once enough space is occupied by
+    * textures no longer cached, or immediately if the size changes.
+    */
    void BuildAtlas(std::size_t width, std::size_t height);
-   void BufferAtlas(gl::OpenGLFunctions& gl, GLuint texture);
+
+   /**
+    * @brief Buffers the atlas to a 2D array texture. Only the regions which
+    * changed since the previously buffered build are updated, unless the
+    * texture storage must be reallocated.
+    *
+    * @param [in] gl OpenGL functions
+    * @param [in] texture 2D array texture
+    * @param [in] bufferedBuildCount Build count previously buffered to the
+    * texture, or 0 if the texture has not been buffered
+    *
+    * @return Build count buffered to the texture
+    */
+   std::uint64_t BufferAtlas(gl::OpenGLFunctions& gl,
+                             GLuint               texture,
+                             std::uint64_t        bufferedBuildCount);
 
    TextureAttributes GetTextureAttributes(const std::string& name);
 
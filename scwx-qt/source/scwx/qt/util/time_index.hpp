@@ -0,0 +1,304 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+/**
+ * @brief A sorted index of time points, each with a weakly referenced record.
+ *
+ * Entries are stored in a flat vector sorted by time, published as immutable
+ * snapshots. Readers load the current snapshot without locking, and are never
+ * blocked by writers. Writers are serialized, and publish a new snapshot only
+ * when time points are added. Time points are typically merged in batches
+ * from provider listings, and batches already present in the index do not
+ * publish a new snapshot.
+ *
+ * Records are held in slots shared between snapshots, so storing a record at
+ * a time point already present updates the slot rather than copying the
+ * snapshot.
+ *
+ * @tparam T Record type
+ */
+template<typename T>
+class TimeIndex
+{
+public:
+   typedef std::chrono::system_clock::time_point TimePoint;
+
+   /**
+    * Weakly referenced record of an entry
+    */
+   class RecordSlot
+   {
+   public:
+      explicit RecordSlot(std::weak_ptr<T> record = {}) :
+          record_ {std::move(record)}
+      {
+      }
+
+      RecordSlot(const RecordSlot&)            = delete;
+      RecordSlot& operator=(const RecordSlot&) = delete;
+
+      std::shared_ptr<T> lock() const
+      {
+         std::unique_lock lock {mutex_};
+         return record_.lock();
+      }
+
+      bool expired() const
+      {
+         std::unique_lock lock {mutex_};
+         return record_.expired();
+      }
+
+   private:
+      friend class TimeIndex;
+
+      mutable std::mutex mutex_ {};
+      std::weak_ptr<T>   record_;
+   };
+
+   struct Entry
+   {
+      TimePoint                   time_;
+      std::shared_ptr<RecordSlot> record_;
+   };
+
+   typedef std::vector<Entry> Snapshot;
+
+   struct Result
+   {
+      TimePoint          time_;
+      std::shared_ptr<T> record_;
+   };
+
+   explicit TimeIndex() : snapshot_ {std::make_shared<const Snapshot>()} {}
+
+   TimeIndex(const TimeIndex&)            = delete;
+   TimeIndex& operator=(const TimeIndex&) = delete;
+
+   /**
+    * Gets the current snapshot of the index. The time points of the snapshot
+    * remain valid and unchanged while held, regardless of subsequent
+    * modifications. Records stored after the snapshot was taken are visible
+    * through the slots of existing entries.
+    */
+   std::shared_ptr<const Snapshot> snapshot() const
+   {
+#if defined(__cpp_lib_atomic_shared_ptr)
+      return snapshot_.load();
+#else
+      return std::atomic_load(&snapshot_);
+#endif
+   }
+
+   bool        empty() const { return snapshot()->empty(); }
+   std::size_t size() const { return snapshot()->size(); }
+
+   /**
+    * Finds the record at a time.
+    *
+    * @param [in] time Time point
+    *
+    * @return Record if the time is present and the record has not expired
+    */
+   std::shared_ptr<T> Find(TimePoint time) const
+   {
+      auto snapshot = this->snapshot();
+      auto it       = LowerBound(*snapshot, time);
+
+      if (it != snapshot->cend() && it->time_ == time)
+      {
+         return it->record_->lock();
+      }
+
+      return nullptr;
+   }
+
+   /**
+    * Finds the entry bounding a time: the latest entry at or before the time,
+    * or the first entry if the time precedes all entries. If a
+    * default-initialized time is given, the latest entry is returned.
+    *
+    * @param [in] time Time point
+    *
+    * @return Time of the entry found, and its record if not expired
+    */
+   std::optional<Result> FindBounded(TimePoint time) const
+   {
+      auto snapshot = this->snapshot();
+
+      if (snapshot->empty())
+      {
+         return std::nullopt;
+      }
+
+      auto it = std::prev(snapshot->cend());
+
+      if (time != TimePoint {})
+      {
+         // Find the first element greater than the time requested
+         it = std::upper_bound(snapshot->cbegin(),
+                               snapshot->cend(),
+                               time,
+                               [](const TimePoint& value, const Entry& entry)
+                               { return value < entry.time_; });
+
+         // The preceding element is the element requested, if it exists
+         if (it != snapshot->cbegin())
+         {
+            --it;
+         }
+      }
+
+      return Result {it->time_, it->record_->lock()};
+   }
+
+   /**
+    * Merges a batch of time points into the index. Existing entries and their
+    * records are retained.
+    *
+    * @param [in] times Time points, in any order
+    *
+    * @return Number of time points added
+    */
+   std::size_t Merge(std::vector<TimePoint> times)
+   {
+      std::sort(times.begin(), times.end());
+      times.erase(std::unique(times.begin(), times.end()), times.end());
+
+      std::unique_lock lock {writeMutex_};
+
+      auto current = snapshot();
+
+      // Remove time points already present, without modifying the index
+      std::erase_if(times,
+                    [&current](const TimePoint& time)
+                    {
+                       auto it = LowerBound(*current, time);
+                       return it != current->cend() && it->time_ == time;
+                    });
+
+      if (times.empty())
+      {
+         return 0u;
+      }
+
+      auto next = std::make_shared<Snapshot>();
+      next->reserve(current->size() + times.size());
+
+      if (current->empty() || current->back().time_ < times.front())
+      {
+         // Append newer time points, the common case for refreshes
+         next->assign(current->cbegin(), current->cend());
+         for (const TimePoint& time : times)
+         {
+            next->push_back({time, std::make_shared<RecordSlot>()});
+         }
+      }
+      else
+      {
+         // Merge two sorted ranges with distinct time points
+         auto it = current->cbegin();
+         for (const TimePoint& time : times)
+         {
+            for (; it != current->cend() && it->time_ < time; ++it)
+            {
+               next->push_back(*it);
+            }
+            next->push_back({time, std::make_shared<RecordSlot>()});
+         }
+         next->insert(next->cend(), it, current->cend());
+      }
+
+      Publish(std::move(next));
+
+      return times.size();
+   }
+
+   /**
+    * Stores a record at a time, unless a record at the time has not expired.
+    * A new snapshot is published only if the time is not present.
+    *
+    * @param [in] time Time point
+    * @param [in] record Record to store
+    *
+    * @return The record stored at the time
+    */
+   std::shared_ptr<T> Store(TimePoint time, const std::shared_ptr<T>& record)
+   {
+      std::unique_lock lock {writeMutex_};
+
+      auto current = snapshot();
+      auto it      = LowerBound(*current, time);
+
+      if (it != current->cend() && it->time_ == time)
+      {
+         RecordSlot&      slot = *it->record_;
+         std::unique_lock slotLock {slot.mutex_};
+
+         auto existing = slot.record_.lock();
+         if (existing != nullptr)
+         {
+            return existing;
+         }
+
+         slot.record_ = record;
+         return record;
+      }
+
+      auto next = std::make_shared<Snapshot>();
+      next->reserve(current->size() + 1u);
+      next->assign(current->cbegin(), it);
+      next->push_back({time, std::make_shared<RecordSlot>(record)});
+      next->insert(next->cend(), it, current->cend());
+
+      Publish(std::move(next));
+
+      return record;
+   }
+
+private:
+   static typename Snapshot::const_iterator LowerBound(const Snapshot& snapshot,
+                                                       TimePoint       time)
+   {
+      return std::lower_bound(snapshot.cbegin(),
+                              snapshot.cend(),
+                              time,
+                              [](const Entry& entry, const TimePoint& value)
+                              { return entry.time_ < value; });
+   }
+
+   void Publish(std::shared_ptr<const Snapshot> snapshot)
+   {
+#if defined(__cpp_lib_atomic_shared_ptr)
+      snapshot_.store(std::move(snapshot));
+#else
+      std::atomic_store(&snapshot_, std::move(snapshot));
+#endif
+   }
+
+#if defined(__cpp_lib_atomic_shared_ptr)
+   std::atomic<std::shared_ptr<const Snapshot>> snapshot_;
+#else
+   std::shared_ptr<const Snapshot> snapshot_;
+#endif
+
+   std::mutex writeMutex_ {};
+};
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
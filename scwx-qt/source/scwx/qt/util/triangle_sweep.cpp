@@ -0,0 +1,392 @@
+#include <scwx/qt/util/triangle_sweep.hpp>
+#include <scwx/common/constants.hpp>
+
+#include <algorithm>
+#include <type_traits>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+static constexpr std::uint16_t kRangeFolded_     = 1u;
+static constexpr std::size_t   kVerticesPerBin_  = 6u;
+static constexpr std::size_t   kValuesPerVertex_ = 2u;
+
+// Number of gates tested together while compacting a radial, such that blocks
+// of gates which are entirely displayed or entirely below the threshold are
+// handled without testing each gate individually
+static constexpr std::size_t kBlockGates_ = 16u;
+
+// Gates of a radial remaining after compaction
+template<typename T>
+struct CompactedRadial
+{
+   explicit CompactedRadial(std::size_t gates) :
+       gates_(gates), moments_(gates), cfpMoments_(gates)
+   {
+   }
+
+   std::vector<std::uint16_t> gates_;
+   std::vector<T>             moments_;
+   std::vector<std::uint8_t>  cfpMoments_;
+   std::size_t                count_ {0};
+};
+
+template<typename T, bool Cfp>
+static void BuildSweep(const std::vector<PolarRadial>& radials,
+                       const std::vector<float>&       coordinates,
+                       std::size_t                     vertexRadials,
+                       float                           gateSize,
+                       float                           latitude,
+                       float                           longitude,
+                       std::uint16_t                   snrThreshold,
+                       TriangleSweep&                  sweep,
+                       std::vector<T>&                 dataMoments);
+
+template<typename T, bool Cfp>
+static void CompactRadial(const T*            moments,
+                          const std::uint8_t* cfpMoments,
+                          std::size_t         first,
+                          std::size_t         last,
+                          std::uint16_t       snrThreshold,
+                          CompactedRadial<T>& compacted);
+
+template<typename T>
+static const T* GetMoments(const PolarRadial& radial)
+{
+   if constexpr (std::is_same_v<T, std::uint8_t>)
+   {
+      return radial.moments8_;
+   }
+   else
+   {
+      return radial.moments16_;
+   }
+}
+
+template<typename T>
+static inline std::uint32_t IsDisplayed(T value, std::uint16_t snrThreshold)
+{
+   return static_cast<std::uint32_t>(value >= snrThreshold) |
+          static_cast<std::uint32_t>(value == kRangeFolded_);
+}
+
+TriangleSweep BuildTriangleSweep(const std::vector<PolarRadial>& radials,
+                                 const std::vector<float>&       coordinates,
+                                 std::size_t                     vertexRadials,
+                                 float                           gateSize,
+                                 float                           latitude,
+                                 float                           longitude,
+                                 std::uint16_t                   snrThreshold)
+{
+   TriangleSweep sweep {};
+
+   if (radials.empty())
+   {
+      return sweep;
+   }
+
+   const PolarRadial& radial0 = radials.front();
+
+   if (radial0.moments8_ != nullptr)
+   {
+      if (radial0.cfpMoments_ != nullptr)
+      {
+         BuildSweep<std::uint8_t, true>(radials,
+                                        coordinates,
+                                        vertexRadials,
+                                        gateSize,
+                                        latitude,
+                                        longitude,
+                                        snrThreshold,
+                                        sweep,
+                                        sweep.dataMoments8_);
+      }
+      else
+      {
+         BuildSweep<std::uint8_t, false>(radials,
+                                         coordinates,
+                                         vertexRadials,
+                                         gateSize,
+                                         latitude,
+                                         longitude,
+                                         snrThreshold,
+                                         sweep,
+                                         sweep.dataMoments8_);
+      }
+   }
+   else
+   {
+      BuildSweep<std::uint16_t, false>(radials,
+                                       coordinates,
+                                       vertexRadials,
+                                       gateSize,
+                                       latitude,
+                                       longitude,
+                                       snrThreshold,
+                                       sweep,
+                                       sweep.dataMoments16_);
+
+      // CFP moments are only populated alongside 8-bit data moments
+      if (radial0.cfpMoments_ != nullptr)
+      {
+         sweep.cfpMoments_.resize(sweep.dataMoments16_.size());
+      }
+   }
+
+   return sweep;
+}
+
+template<typename T, bool Cfp>
+static void BuildSweep(const std::vector<PolarRadial>& radials,
+                       const std::vector<float>&       coordinates,
+                       std::size_t                     vertexRadials,
+                       float                           gateSize,
+                       float                           latitude,
+                       float                           longitude,
+                       std::uint16_t                   snrThreshold,
+                       TriangleSweep&                  sweep,
+                       std::vector<T>&                 dataMoments)
+{
+   const std::size_t gates       = radials.front().gateCount_;
+   const std::size_t radialCount = std::min<std::size_t>(
+      radials.back().index_ + 1u, common::MAX_0_5_DEGREE_RADIALS);
+
+   std::vector<float>&        vertices   = sweep.vertices_;
+   std::vector<std::uint8_t>& cfpMoments = sweep.cfpMoments_;
+
+   vertices.resize(vertexRadials * gates * kVerticesPerBin_ *
+                   kValuesPerVertex_);
+   dataMoments.resize(radialCount * gates * kVerticesPerBin_);
+
+   if constexpr (Cfp)
+   {
+      cfpMoments.resize(radialCount * gates * kVerticesPerBin_);
+   }
+
+   float*        vertex    = vertices.data();
+   T*            moment    = dataMoments.data();
+   std::uint8_t* cfpMoment = cfpMoments.data();
+
+   const std::int32_t gateSizeMeters = static_cast<std::int32_t>(gateSize);
+
+   CompactedRadial<T> compacted {gates};
+
+   for (const PolarRadial& radial : radials)
+   {
+      const T* moments = GetMoments<T>(radial);
+
+      if (moments == nullptr)
+      {
+         // Radial has a different word size
+         continue;
+      }
+
+      // Compute gate interval
+      const std::int32_t dataMomentInterval  = radial.gateInterval_;
+      const std::int32_t dataMomentIntervalH = dataMomentInterval / 2;
+      const std::int32_t dataMomentRange =
+         std::max<std::int32_t>(radial.firstGateRange_, dataMomentIntervalH);
+
+      // Compute bin size (number of base gates per bin)
+      const std::int32_t binSize =
+         std::max<std::int32_t>(1, dataMomentInterval / gateSizeMeters);
+
+      // Compute base gate range [startGate, endGate)
+      const std::int32_t startGate =
+         (dataMomentRange - dataMomentIntervalH) / gateSizeMeters;
+      const std::int32_t numberOfDataMomentGates = std::min<std::int32_t>(
+         static_cast<std::int32_t>(radial.gateCount_),
+         static_cast<std::int32_t>(gates));
+      const std::int32_t endGate = std::min<std::int32_t>(
+         startGate + numberOfDataMomentGates * binSize,
+         static_cast<std::int32_t>(common::MAX_DATA_MOMENT_GATES));
+
+      // Compute data moment range [first, last), excluding bins starting
+      // before the radar site or ending beyond the end gate
+      const std::int32_t first =
+         (startGate < 0) ? (binSize - 1 - startGate) / binSize : 0;
+      const std::int32_t last =
+         std::max<std::int32_t>(0, (endGate - startGate) / binSize);
+
+      if (first >= last)
+      {
+         continue;
+      }
+
+      CompactRadial<T, Cfp>(moments,
+                            radial.cfpMoments_,
+                            static_cast<std::size_t>(first),
+                            static_cast<std::size_t>(last),
+                            snrThreshold,
+                            compacted);
+
+      // Gate boundary coordinates of this radial and the following radial
+      const float* coordinates1 =
+         coordinates.data() + (radial.index_ % vertexRadials) *
+                                 common::MAX_DATA_MOMENT_GATES *
+                                 kValuesPerVertex_;
+      const float* coordinates2 =
+         coordinates.data() + ((radial.index_ + 1u) % vertexRadials) *
+                                 common::MAX_DATA_MOMENT_GATES *
+                                 kValuesPerVertex_;
+
+      std::size_t k = 0;
+
+      // A bin starting at the radar site is a single triangle
+      if (compacted.count_ > 0 &&
+          startGate + compacted.gates_[0] * binSize == 0)
+      {
+         vertex[0] = latitude;
+         vertex[1] = longitude;
+         vertex[2] = coordinates1[0];
+         vertex[3] = coordinates1[1];
+         vertex[4] = coordinates2[0];
+         vertex[5] = coordinates2[1];
+         vertex += 6;
+
+         std::fill_n(moment, 3, compacted.moments_[0]);
+         moment += 3;
+
+         if constexpr (Cfp)
+         {
+            std::fill_n(cfpMoment, 3, compacted.cfpMoments_[0]);
+            cfpMoment += 3;
+         }
+
+         k = 1;
+      }
+
+      // Remaining bins are quads of two triangles
+      for (; k < compacted.count_; ++k)
+      {
+         const std::int32_t gate = startGate + compacted.gates_[k] * binSize;
+
+         const float* c1 = coordinates1 + (gate - 1) * kValuesPerVertex_;
+         const float* c2 = c1 + binSize * kValuesPerVertex_;
+         const float* c3 = coordinates2 + (gate - 1) * kValuesPerVertex_;
+         const float* c4 = c3 + binSize * kValuesPerVertex_;
+
+         vertex[0]  = c1[0];
+         vertex[1]  = c1[1];
+         vertex[2]  = c2[0];
+         vertex[3]  = c2[1];
+         vertex[4]  = c3[0];
+         vertex[5]  = c3[1];
+         vertex[6]  = c3[0];
+         vertex[7]  = c3[1];
+         vertex[8]  = c4[0];
+         vertex[9]  = c4[1];
+         vertex[10] = c2[0];
+         vertex[11] = c2[1];
+         vertex += kVerticesPerBin_ * kValuesPerVertex_;
+
+         std::fill_n(moment, kVerticesPerBin_, compacted.moments_[k]);
+         moment += kVerticesPerBin_;
+
+         if constexpr (Cfp)
+         {
+            std::fill_n(cfpMoment, kVerticesPerBin_, compacted.cfpMoments_[k]);
+            cfpMoment += kVerticesPerBin_;
+         }
+      }
+   }
+
+   vertices.resize(static_cast<std::size_t>(vertex - vertices.data()));
+   vertices.shrink_to_fit();
+
+   const std::size_t momentCount =
+      static_cast<std::size_t>(moment - dataMoments.data());
+
+   dataMoments.resize(momentCount);
+   dataMoments.shrink_to_fit();
+
+   if constexpr (Cfp)
+   {
+      cfpMoments.resize(momentCount);
+      cfpMoments.shrink_to_fit();
+   }
+}
+
+template<typename T, bool Cfp>
+static void CompactRadial(const T*            moments,
+                          const std::uint8_t* cfpMoments,
+                          std::size_t         first,
+                          std::size_t         last,
+                          std::uint16_t       snrThreshold,
+                          CompactedRadial<T>& compacted)
+{
+   std::uint16_t* gates          = compacted.gates_.data();
+   T*             compactMoments = compacted.moments_.data();
+   std::uint8_t*  compactCfp     = compacted.cfpMoments_.data();
+
+   std::size_t n = 0;
+   std::size_t i = first;
+
+   // Each gate is written unconditionally, and the output advanced only if the
+   // gate is displayed, such that there are no data-dependent branches per gate
+   auto CompactGate = [&](std::size_t gate)
+   {
+      gates[n]          = static_cast<std::uint16_t>(gate);
+      compactMoments[n] = moments[gate];
+
+      if constexpr (Cfp)
+      {
+         compactCfp[n] = (cfpMoments != nullptr) ? cfpMoments[gate] : 0u;
+      }
+
+      n += IsDisplayed(moments[gate], snrThreshold);
+   };
+
+   for (; i + kBlockGates_ <= last; i += kBlockGates_)
+   {
+      // Count the displayed gates in the block (vectorized)
+      std::uint32_t displayed = 0;
+      for (std::size_t j = 0; j < kBlockGates_; ++j)
+      {
+         displayed += IsDisplayed(moments[i + j], snrThreshold);
+      }
+
+      if (displayed == 0)
+      {
+         continue;
+      }
+
+      if (displayed == kBlockGates_)
+      {
+         for (std::size_t j = 0; j < kBlockGates_; ++j)
+         {
+            gates[n + j]          = static_cast<std::uint16_t>(i + j);
+            compactMoments[n + j] = moments[i + j];
+
+            if constexpr (Cfp)
+            {
+               compactCfp[n + j] =
+                  (cfpMoments != nullptr) ? cfpMoments[i + j] : 0u;
+            }
+         }
+
+         n += kBlockGates_;
+         continue;
+      }
+
+      for (std::size_t j = 0; j < kBlockGates_; ++j)
+      {
+         CompactGate(i + j);
+      }
+   }
+
+   for (; i < last; ++i)
+   {
+      CompactGate(i);
+   }
+
+   compacted.count_ = n;
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
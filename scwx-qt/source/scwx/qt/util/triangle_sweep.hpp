@@ -0,0 +1,63 @@
+#pragma once
+
+#include <scwx/qt/util/polar_sweep.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+/**
+ * @brief Vertices and data moments of a sweep rendered as triangles.
+ *
+ * Each displayed bin is a quad of two triangles (6 vertices), except a bin
+ * starting at the radar site, which is a single triangle (3 vertices). Each
+ * vertex is a latitude/longitude pair, and has a data moment, and a clutter
+ * filter power removed moment when present.
+ */
+struct TriangleSweep
+{
+   std::vector<float>         vertices_ {};
+   std::vector<std::uint8_t>  dataMoments8_ {};
+   std::vector<std::uint16_t> dataMoments16_ {};
+   std::vector<std::uint8_t>  cfpMoments_ {};
+};
+
+/**
+ * @brief Builds the triangles of a sweep.
+ *
+ * Each radial is first compacted to the gates which are displayed, by a kernel
+ * specialized on data word size and CFP presence. Vertices and moments are
+ * then written for the compacted gates.
+ *
+ * @param [in] radials Radials, sorted by index. The word size, gate count and
+ * CFP presence of the first radial apply to the sweep. Radials with a
+ * different word size are skipped.
+ * @param [in] coordinates Latitude/longitude pairs for the boundaries of each
+ * base gate, common::MAX_DATA_MOMENT_GATES per radial
+ * @param [in] vertexRadials Number of radials of coordinates, including an
+ * empty radial appended to an incomplete sweep
+ * @param [in] gateSize Base gate size (m)
+ * @param [in] latitude Radar site latitude (degrees)
+ * @param [in] longitude Radar site longitude (degrees)
+ * @param [in] snrThreshold Minimum data moment value to display. Range folded
+ * values are always displayed.
+ *
+ * @return Triangle sweep
+ */
+TriangleSweep BuildTriangleSweep(const std::vector<PolarRadial>& radials,
+                                 const std::vector<float>&       coordinates,
+                                 std::size_t                     vertexRadials,
+                                 float                           gateSize,
+                                 float                           latitude,
+                                 float                           longitude,
+                                 std::uint16_t                   snrThreshold);
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -1,12 +1,19 @@
 #include <scwx/qt/view/level2_product_view.hpp>
+#include <scwx/qt/settings/general_settings.hpp>
 #include <scwx/qt/settings/unit_settings.hpp>
 #include <scwx/qt/types/unit_types.hpp>
+#include <scwx/qt/util/coalescing_cache.hpp>
 #include <scwx/qt/util/geographic_lib.hpp>
+#include <scwx/qt/util/triangle_sweep.hpp>
 #include <scwx/common/characters.hpp>
 #include <scwx/common/constants.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/metrics.hpp>
 #include <scwx/util/threads.hpp>
 #include <scwx/util/time.hpp>
+#include <scwx/wsr88d/volume_products.hpp>
+
+#include <atomic>
 
 #include <boost/range/irange.hpp>
 #include <boost/timer/timer.hpp>
@@ -25,9 +32,7 @@ static constexpr std::uint32_t kMaxRadialGates_ =
    common::MAX_0_5_DEGREE_RADIALS * common::MAX_DATA_MOMENT_GATES;
 static constexpr std::uint32_t kMaxCoordinates_ = kMaxRadialGates_ * 2u;
 
-static constexpr uint16_t RANGE_FOLDED      = 1u;
-static constexpr uint32_t VERTICES_PER_BIN  = 6u;
-static constexpr uint32_t VALUES_PER_VERTEX = 2u;
+static constexpr uint16_t RANGE_FOLDED = 1u;
 
 static const std::unordered_map<common::Level2Product,
                                 wsr88d::rda::DataBlockType>
@@ -44,14 +49,71 @@ static const std::unordered_map<common::Level2Product,
       {common::Level2Product::CorrelationCoefficient,
        wsr88d::rda::DataBlockType::MomentRho},
       {common::Level2Product::ClutterFilterPowerRemoved,
-       wsr88d::rda::DataBlockType::MomentCfp}};
+       wsr88d::rda::DataBlockType::MomentCfp},
+      {common::Level2Product::CompositeReflectivity,
+       wsr88d::rda::DataBlockType::MomentRef},
+      {common::Level2Product::EchoTops, wsr88d::rda::DataBlockType::MomentRef},
+      {common::Level2Product::VerticallyIntegratedLiquid,
+       wsr88d::rda::DataBlockType::MomentRef}};
 
 static const std::unordered_map<common::Level2Product, std::string>
    productUnits_ {{common::Level2Product::Reflectivity, "dBZ"},
                   {common::Level2Product::DifferentialReflectivity, "dB"},
                   {common::Level2Product::DifferentialPhase, "\302\260"},
                   {common::Level2Product::CorrelationCoefficient, "%"},
-                  {common::Level2Product::ClutterFilterPowerRemoved, "dB"}};
+                  {common::Level2Product::ClutterFilterPowerRemoved, "dB"},
+                  {common::Level2Product::CompositeReflectivity, "dBZ"},
+                  {common::Level2Product::EchoTops, "km"},
+                  {common::Level2Product::VerticallyIntegratedLiquid,
+                   "kg/m\302\262"}};
+
+struct Level2SweepKey
+{
+   std::string                           radarId_;
+   common::Level2Product                 product_;
+   float                                 elevationCut_;
+   std::chrono::system_clock::time_point volumeTime_;
+   float                                 gateSize_;
+   std::size_t                           radialCount_;
+   bool                                  polar_;
+
+   auto operator<=>(const Level2SweepKey&) const = default;
+};
+
+struct Level2Sweep
+{
+   std::vector<float>         vertices_ {};
+   std::vector<std::uint8_t>  dataMoments8_ {};
+   std::vector<std::uint16_t> dataMoments16_ {};
+   std::vector<std::uint8_t>  cfpMoments_ {};
+
+   // Packed sweep, used in place of vertices for texture-based rendering
+   bool             polar_ {false};
+   util::PolarSweep polarSweep_ {};
+};
+
+struct Level2DerivedKey
+{
+   std::string                           radarId_;
+   common::Level2Product                 product_;
+   std::chrono::system_clock::time_point volumeTime_;
+   std::size_t                           messageCount_;
+
+   auto operator<=>(const Level2DerivedKey&) const = default;
+};
+
+// Product derived from each elevation cut of a volume
+struct Level2DerivedScan
+{
+   std::shared_ptr<wsr88d::rda::ElevationScan> elevationScan_ {};
+   std::size_t                                 messageCount_ {0u};
+};
+
+static const std::vector<float> kEmptyVertices_ {};
+
+static util::CoalescingCache<Level2SweepKey, Level2Sweep> sweepCache_ {};
+static util::CoalescingCache<Level2DerivedKey, Level2DerivedScan>
+   derivedCache_ {};
 
 class Level2ProductViewImpl
 {
@@ -78,12 +140,24 @@ public:
        savedScale_ {0.0f},
        savedOffset_ {0.0f}
    {
-      auto& unitSettings = settings::UnitSettings::Instance();
-
-      coordinates_.resize(kMaxCoordinates_);
+      auto& generalSettings = settings::GeneralSettings::Instance();
+      auto& unitSettings    = settings::UnitSettings::Instance();
 
       SetProduct(product);
 
+      polarRenderingCallbackUuid_ =
+         generalSettings.polar_rendering_enabled().RegisterValueChangedCallback(
+            [this](const bool& value)
+            {
+               polarRenderingEnabled_ = value;
+
+               // Recompute the sweep for the new rendering mode
+               if (self_->IsInitialized())
+               {
+                  self_->Update();
+               }
+            });
+
       otherUnitsCallbackUuid_ =
          unitSettings.other_units().RegisterValueChangedCallback(
             [this](const std::string& value) { UpdateOtherUnits(value); });
@@ -93,11 +167,17 @@ public:
 
       UpdateOtherUnits(unitSettings.other_units().GetValue());
       UpdateSpeedUnits(unitSettings.speed_units().GetValue());
+
+      polarRenderingEnabled_ =
+         generalSettings.polar_rendering_enabled().GetValue();
    }
    ~Level2ProductViewImpl()
    {
-      auto& unitSettings = settings::UnitSettings::Instance();
+      auto& generalSettings = settings::GeneralSettings::Instance();
+      auto& unitSettings    = settings::UnitSettings::Instance();
 
+      generalSettings.polar_rendering_enabled().UnregisterValueChangedCallback(
+         polarRenderingCallbackUuid_);
       unitSettings.other_units().UnregisterValueChangedCallback(
          otherUnitsCallbackUuid_);
       unitSettings.speed_units().UnregisterValueChangedCallback(
@@ -108,6 +188,15 @@ public:
 
    void ComputeCoordinates(
       const std::shared_ptr<wsr88d::rda::ElevationScan>& radarData);
+   std::shared_ptr<const Level2Sweep>
+   ComputeSweep(const std::shared_ptr<wsr88d::rda::ElevationScan>& radarData);
+   std::shared_ptr<const Level2Sweep> ComputePolarSweep(
+      const std::shared_ptr<wsr88d::rda::ElevationScan>& radarData);
+   std::vector<util::PolarRadial>
+   CreateRadials(const std::shared_ptr<wsr88d::rda::ElevationScan>& radarData);
+   std::tuple<std::shared_ptr<wsr88d::rda::ElevationScan>,
+              std::chrono::system_clock::time_point>
+   GetDerivedData(std::chrono::system_clock::time_point time);
 
    void SetProduct(const std::string& productName);
    void SetProduct(common::Level2Product product);
@@ -124,17 +213,22 @@ public:
    common::Level2Product      product_;
    wsr88d::rda::DataBlockType dataBlockType_;
 
+   // Pipeline metrics of the selected product, looked up when the product is
+   // selected, as they are updated with every sweep
+   scwx::util::metrics::Counter*   sweepCacheHitCounter_ {nullptr};
+   scwx::util::metrics::Histogram* sweepComputeHistogram_ {nullptr};
+   scwx::util::metrics::Histogram* derivedComputeHistogram_ {nullptr};
+   scwx::util::metrics::Histogram* coordinatesHistogram_ {nullptr};
+
    float selectedElevation_;
 
    std::shared_ptr<wsr88d::rda::ElevationScan> elevationScan_;
    std::shared_ptr<wsr88d::rda::GenericRadarData::MomentDataBlock>
       momentDataBlock0_;
 
-   std::vector<float>    coordinates_ {};
-   std::vector<float>    vertices_ {};
-   std::vector<uint8_t>  dataMoments8_ {};
-   std::vector<uint16_t> dataMoments16_ {};
-   std::vector<uint8_t>  cfpMoments_ {};
+   std::vector<float>                       coordinates_ {};
+   std::shared_ptr<const Level2Sweep>       sweep_ {};
+   std::shared_ptr<const Level2DerivedScan> derivedScan_ {};
 
    float                    latitude_;
    float                    longitude_;
@@ -158,6 +252,9 @@ public:
    boost::uuids::uuid speedUnitsCallbackUuid_ {};
    types::OtherUnits  otherUnits_ {types::OtherUnits::Unknown};
    types::SpeedUnits  speedUnits_ {types::SpeedUnits::Unknown};
+
+   boost::uuids::uuid polarRenderingCallbackUuid_ {};
+   std::atomic<bool>  polarRenderingEnabled_ {false};
 };
 
 Level2ProductView::Level2ProductView(
@@ -248,6 +345,11 @@ uint16_t Level2ProductView::color_table_max() const
    }
 }
 
+wsr88d::rda::DataBlockType Level2ProductView::data_block_type() const
+{
+   return p->dataBlockType_;
+}
+
 float Level2ProductView::elevation() const
 {
    return p->elevationCut_;
@@ -307,9 +409,25 @@ uint16_t Level2ProductView::vcp() const
    return p->vcp_;
 }
 
+std::shared_ptr<const util::PolarSweep> Level2ProductView::polar_sweep() const
+{
+   if (p->sweep_ == nullptr || !p->sweep_->polar_)
+   {
+      return nullptr;
+   }
+
+   // Share ownership with the cached sweep
+   return {p->sweep_, &p->sweep_->polarSweep_};
+}
+
 const std::vector<float>& Level2ProductView::vertices() const
 {
-   return p->vertices_;
+   if (p->sweep_ == nullptr)
+   {
+      return kEmptyVertices_;
+   }
+
+   return p->sweep_->vertices_;
 }
 
 common::RadarProductGroup Level2ProductView::GetRadarProductGroup() const
@@ -329,20 +447,24 @@ std::vector<float> Level2ProductView::GetElevationCuts() const
 
 std::tuple<const void*, size_t, size_t> Level2ProductView::GetMomentData() const
 {
-   const void* data;
-   size_t      dataSize;
-   size_t      componentSize;
+   const void* data          = nullptr;
+   size_t      dataSize      = 0;
+   size_t      componentSize = 1;
 
-   if (p->dataMoments8_.size() > 0)
+   if (p->sweep_ == nullptr)
    {
-      data          = p->dataMoments8_.data();
-      dataSize      = p->dataMoments8_.size() * sizeof(uint8_t);
+      // No sweep has been computed
+   }
+   else if (p->sweep_->dataMoments8_.size() > 0)
+   {
+      data          = p->sweep_->dataMoments8_.data();
+      dataSize      = p->sweep_->dataMoments8_.size() * sizeof(uint8_t);
       componentSize = 1;
    }
    else
    {
-      data          = p->dataMoments16_.data();
-      dataSize      = p->dataMoments16_.size() * sizeof(uint16_t);
+      data          = p->sweep_->dataMoments16_.data();
+      dataSize      = p->sweep_->dataMoments16_.size() * sizeof(uint16_t);
       componentSize = 2;
    }
 
@@ -356,10 +478,10 @@ Level2ProductView::GetCfpMomentData() const
    size_t      dataSize      = 0;
    size_t      componentSize = 1;
 
-   if (p->cfpMoments_.size() > 0)
+   if (p->sweep_ != nullptr && p->sweep_->cfpMoments_.size() > 0)
    {
-      data     = p->cfpMoments_.data();
-      dataSize = p->cfpMoments_.size() * sizeof(uint8_t);
+      data     = p->sweep_->cfpMoments_.data();
+      dataSize = p->sweep_->cfpMoments_.size() * sizeof(uint8_t);
    }
 
    return std::tie(data, dataSize, componentSize);
@@ -402,6 +524,18 @@ void Level2ProductViewImpl::SetProduct(common::Level2Product product)
       logger_->warn("Unknown product: \"{}\"", common::GetLevel2Name(product));
       dataBlockType_ = wsr88d::rda::DataBlockType::Unknown;
    }
+
+   auto&             registry    = scwx::util::metrics::Registry::Instance();
+   const std::string productName = common::GetLevel2Name(product);
+
+   sweepCacheHitCounter_ = &registry.GetCounter(
+      scwx::util::metrics::MetricName("sweep_cache_hit", productName));
+   sweepComputeHistogram_ = &registry.GetHistogram(
+      scwx::util::metrics::MetricName("sweep_compute", productName));
+   derivedComputeHistogram_ = &registry.GetHistogram(
+      scwx::util::metrics::MetricName("derived_compute", productName));
+   coordinatesHistogram_ = &registry.GetHistogram(
+      scwx::util::metrics::MetricName("coordinates", productName));
 }
 
 void Level2ProductViewImpl::UpdateOtherUnits(const std::string& name)
@@ -502,8 +636,6 @@ void Level2ProductView::ComputeSweep()
 {
    logger_->debug("ComputeSweep()");
 
-   boost::timer::cpu_timer timer;
-
    if (p->dataBlockType_ == wsr88d::rda::DataBlockType::Unknown)
    {
       Q_EMIT SweepNotComputed(types::NoUpdateReason::InvalidProduct);
@@ -518,9 +650,32 @@ void Level2ProductView::ComputeSweep()
    std::shared_ptr<wsr88d::rda::ElevationScan> radarData;
    std::chrono::system_clock::time_point       requestedTime {selected_time()};
    std::chrono::system_clock::time_point       foundTime;
-   std::tie(radarData, p->elevationCut_, p->elevationCuts_, foundTime) =
-      radarProductManager->GetLevel2Data(
-         p->dataBlockType_, p->selectedElevation_, requestedTime);
+   std::size_t                                 radialCount = 0u;
+
+   if (wsr88d::VolumeProducts::IsDerivedProduct(p->product_))
+   {
+      // Derived products are computed from the entire volume, and have no
+      // elevation cuts
+      std::tie(radarData, foundTime) = p->GetDerivedData(requestedTime);
+      p->elevationCut_ = 0.0f;
+      p->elevationCuts_.clear();
+
+      if (p->derivedScan_ != nullptr)
+      {
+         radialCount = p->derivedScan_->messageCount_;
+      }
+   }
+   else
+   {
+      std::tie(radarData, p->elevationCut_, p->elevationCuts_, foundTime) =
+         radarProductManager->GetLevel2Data(
+            p->dataBlockType_, p->selectedElevation_, requestedTime);
+
+      if (radarData != nullptr)
+      {
+         radialCount = radarData->size();
+      }
+   }
 
    // If a different time was found than what was requested, update it
    if (requestedTime != foundTime)
@@ -533,33 +688,16 @@ void Level2ProductView::ComputeSweep()
       Q_EMIT SweepNotComputed(types::NoUpdateReason::NotLoaded);
       return;
    }
-   if (radarData == p->elevationScan_)
-   {
-      Q_EMIT SweepNotComputed(types::NoUpdateReason::NoChange);
-      return;
-   }
 
-   std::size_t radials       = radarData->crbegin()->first + 1;
-   std::size_t vertexRadials = radials;
+   const bool polar = p->polarRenderingEnabled_;
 
-   // When there is missing data, insert another empty vertex radial at the end
-   // to avoid stretching
-   const bool isRadarDataIncomplete =
-      Level2ProductViewImpl::IsRadarDataIncomplete(radarData);
-   if (isRadarDataIncomplete)
+   if (radarData == p->elevationScan_ && p->sweep_ != nullptr &&
+       p->sweep_->polar_ == polar)
    {
-      ++vertexRadials;
+      Q_EMIT SweepNotComputed(types::NoUpdateReason::NoChange);
+      return;
    }
 
-   // Limit radials
-   radials = std::min<std::size_t>(radials, common::MAX_0_5_DEGREE_RADIALS);
-   vertexRadials =
-      std::min<std::size_t>(vertexRadials, common::MAX_0_5_DEGREE_RADIALS);
-
-   p->ComputeCoordinates(radarData);
-
-   const std::vector<float>& coordinates = p->coordinates_;
-
    auto& radarData0     = (*radarData)[0];
    auto  momentData0    = radarData0->moment_data_block(p->dataBlockType_);
    p->elevationScan_    = radarData;
@@ -585,246 +723,249 @@ void Level2ProductView::ComputeSweep()
                                          radarData0->collection_time());
    p->vcp_       = radarData0->volume_coverage_pattern_number();
 
-   // Calculate vertices
-   timer.start();
+   // Other views of the same sweep share the computed vertices and moments.
+   // The radial count distinguishes an elevation scan which is still being
+   // received from its completed form. For derived products, the message
+   // count of the volume is used instead.
+   const Level2SweepKey key {radarSite->id(),
+                             p->product_,
+                             p->elevationCut_,
+                             foundTime,
+                             radarProductManager->gate_size(),
+                             radialCount,
+                             polar};
+
+   bool computed = false;
+
+   p->sweep_ = sweepCache_.GetOrCompute(
+      key,
+      [&]()
+      {
+         computed = true;
+         return polar ? p->ComputePolarSweep(radarData) :
+                        p->ComputeSweep(radarData);
+      });
 
-   // Setup vertex vector
-   std::vector<float>& vertices = p->vertices_;
-   size_t              vIndex   = 0;
-   vertices.clear();
-   vertices.resize(vertexRadials * gates * VERTICES_PER_BIN *
-                   VALUES_PER_VERTEX);
+   if (!computed)
+   {
+      p->sweepCacheHitCounter_->Increment();
+   }
 
-   // Setup data moment vector
-   std::vector<uint8_t>&  dataMoments8  = p->dataMoments8_;
-   std::vector<uint16_t>& dataMoments16 = p->dataMoments16_;
-   std::vector<uint8_t>&  cfpMoments    = p->cfpMoments_;
-   size_t                 mIndex        = 0;
+   UpdateColorTableLut();
 
-   if (momentData0->data_word_size() == 8)
-   {
-      dataMoments16.resize(0);
-      dataMoments16.shrink_to_fit();
+   Q_EMIT SweepComputed();
+}
 
-      dataMoments8.resize(radials * gates * VERTICES_PER_BIN);
-   }
-   else
-   {
-      dataMoments8.resize(0);
-      dataMoments8.shrink_to_fit();
+std::shared_ptr<const Level2Sweep> Level2ProductViewImpl::ComputeSweep(
+   const std::shared_ptr<wsr88d::rda::ElevationScan>& radarData)
+{
+   boost::timer::cpu_timer timer;
 
-      dataMoments16.resize(radials * gates * VERTICES_PER_BIN);
-   }
+   std::shared_ptr<manager::RadarProductManager> radarProductManager =
+      self_->radar_product_manager();
 
-   if (p->dataBlockType_ == wsr88d::rda::DataBlockType::MomentRef &&
-       radarData0->moment_data_block(wsr88d::rda::DataBlockType::MomentCfp) !=
-          nullptr)
-   {
-      cfpMoments.resize(radials * gates * VERTICES_PER_BIN);
-   }
-   else
+   std::size_t vertexRadials = radarData->crbegin()->first + 1;
+
+   // When there is missing data, insert another empty vertex radial at the end
+   // to avoid stretching
+   const bool isRadarDataIncomplete = IsRadarDataIncomplete(radarData);
+   if (isRadarDataIncomplete)
    {
-      cfpMoments.resize(0);
-      cfpMoments.shrink_to_fit();
+      ++vertexRadials;
    }
 
+   // Limit radials
+   vertexRadials =
+      std::min<std::size_t>(vertexRadials, common::MAX_0_5_DEGREE_RADIALS);
+
+   ComputeCoordinates(radarData);
+
+   auto& radarData0  = (*radarData)[0];
+   auto  momentData0 = radarData0->moment_data_block(dataBlockType_);
+
+   // Compute threshold at which to display an individual bin (minimum of 2)
+   const std::uint16_t snrThreshold =
+      std::max<std::int16_t>(2, momentData0->snr_threshold_raw());
+
+   const std::vector<util::PolarRadial> radials = CreateRadials(radarData);
+
+   auto sweep = std::make_shared<Level2Sweep>();
+
+   // Calculate vertices
+   timer.start();
+
+   util::TriangleSweep triangleSweep =
+      util::BuildTriangleSweep(radials,
+                               coordinates_,
+                               vertexRadials,
+                               radarProductManager->gate_size(),
+                               latitude_,
+                               longitude_,
+                               snrThreshold);
+
+   sweep->vertices_      = std::move(triangleSweep.vertices_);
+   sweep->dataMoments8_  = std::move(triangleSweep.dataMoments8_);
+   sweep->dataMoments16_ = std::move(triangleSweep.dataMoments16_);
+   sweep->cfpMoments_    = std::move(triangleSweep.cfpMoments_);
+
+   timer.stop();
+   logger_->debug("Vertices calculated in {}", timer.format(6, "%ws"));
+   sweepComputeHistogram_->Record(
+      static_cast<std::uint64_t>(timer.elapsed().wall));
+
+   return sweep;
+}
+
+std::shared_ptr<const Level2Sweep> Level2ProductViewImpl::ComputePolarSweep(
+   const std::shared_ptr<wsr88d::rda::ElevationScan>& radarData)
+{
+   boost::timer::cpu_timer timer;
+
+   auto& radarData0  = (*radarData)[0];
+   auto  momentData0 = radarData0->moment_data_block(dataBlockType_);
+
    // Compute threshold at which to display an individual bin (minimum of 2)
    const std::uint16_t snrThreshold =
       std::max<std::int16_t>(2, momentData0->snr_threshold_raw());
 
-   // Start radial is always 0, as coordinates are calculated for each sweep
-   constexpr std::uint16_t startRadial = 0u;
+   const std::vector<util::PolarRadial> radials = CreateRadials(radarData);
+
+   auto sweep    = std::make_shared<Level2Sweep>();
+   sweep->polar_ = true;
+
+   // Pack the sweep
+   timer.start();
+   sweep->polarSweep_ =
+      util::PackPolarSweep(radials,
+                           self_->radar_product_manager()->gate_size(),
+                           snrThreshold);
+   timer.stop();
+   logger_->debug("Sweep packed in {}", timer.format(6, "%ws"));
+   sweepComputeHistogram_->Record(
+      static_cast<std::uint64_t>(timer.elapsed().wall));
+
+   return sweep;
+}
+
+std::vector<util::PolarRadial> Level2ProductViewImpl::CreateRadials(
+   const std::shared_ptr<wsr88d::rda::ElevationScan>& radarData)
+{
+   auto& radarData0  = (*radarData)[0];
+   auto  momentData0 = radarData0->moment_data_block(dataBlockType_);
+
+   const bool cfpEnabled =
+      dataBlockType_ == wsr88d::rda::DataBlockType::MomentRef &&
+      radarData0->moment_data_block(wsr88d::rda::DataBlockType::MomentCfp) !=
+         nullptr;
+
+   // Describe each radial, referencing its data moments in place
+   std::vector<util::PolarRadial> radials {};
+   radials.reserve(radarData->size());
 
    for (auto& radialPair : *radarData)
    {
-      std::uint16_t radial     = radialPair.first;
-      auto&         radialData = radialPair.second;
-      auto momentData = radialData->moment_data_block(p->dataBlockType_);
+      auto& radialData = radialPair.second;
+      auto  momentData = radialData->moment_data_block(dataBlockType_);
+
+      if (momentData == nullptr)
+      {
+         continue;
+      }
 
       if (momentData0->data_word_size() != momentData->data_word_size())
       {
-         logger_->warn("Radial {} has different word size", radial);
+         logger_->warn("Radial {} has different word size", radialPair.first);
          continue;
       }
 
-      // Compute gate interval
-      const std::int32_t dataMomentInterval =
+      util::PolarRadial& radial = radials.emplace_back();
+      radial.index_             = radialPair.first;
+      radial.azimuth_           = radialData->azimuth_angle().value();
+      radial.firstGateRange_    = momentData->data_moment_range_raw();
+      radial.gateInterval_ =
          momentData->data_moment_range_sample_interval_raw();
-      const std::int32_t dataMomentIntervalH = dataMomentInterval / 2;
-      const std::int32_t dataMomentRange     = std::max<std::int32_t>(
-         momentData->data_moment_range_raw(), dataMomentIntervalH);
-
-      // Compute gate size (number of base 250m gates per bin)
-      const std::int32_t gateSizeMeters =
-         static_cast<std::int32_t>(radarProductManager->gate_size());
-      const std::int32_t gateSize =
-         std::max<std::int32_t>(1, dataMomentInterval / gateSizeMeters);
-
-      // Compute gate range [startGate, endGate)
-      const std::int32_t startGate =
-         (dataMomentRange - dataMomentIntervalH) / gateSizeMeters;
-      const std::int32_t numberOfDataMomentGates =
-         std::min<std::int32_t>(momentData->number_of_data_moment_gates(),
-                                static_cast<std::int32_t>(gates));
-      const std::int32_t endGate = std::min<std::int32_t>(
-         startGate + numberOfDataMomentGates * gateSize,
-         static_cast<std::int32_t>(common::MAX_DATA_MOMENT_GATES));
-
-      const std::uint8_t*  dataMomentsArray8  = nullptr;
-      const std::uint16_t* dataMomentsArray16 = nullptr;
-      const std::uint8_t*  cfpMomentsArray    = nullptr;
+      radial.gateCount_ = momentData->number_of_data_moment_gates();
 
       if (momentData->data_word_size() == 8)
       {
-         dataMomentsArray8 =
+         radial.moments8_ =
             reinterpret_cast<const std::uint8_t*>(momentData->data_moments());
       }
       else
       {
-         dataMomentsArray16 =
+         radial.moments16_ =
             reinterpret_cast<const std::uint16_t*>(momentData->data_moments());
       }
 
-      if (cfpMoments.size() > 0)
+      if (cfpEnabled)
       {
-         cfpMomentsArray = reinterpret_cast<const std::uint8_t*>(
+         radial.cfpMoments_ = reinterpret_cast<const std::uint8_t*>(
             radialData->moment_data_block(wsr88d::rda::DataBlockType::MomentCfp)
                ->data_moments());
       }
+   }
 
-      for (std::int32_t gate = startGate, i = 0; gate + gateSize <= endGate;
-           gate += gateSize, ++i)
-      {
-         if (gate < 0)
-         {
-            continue;
-         }
+   return radials;
+}
 
-         std::size_t vertexCount = (gate > 0) ? 6 : 3;
+std::tuple<std::shared_ptr<wsr88d::rda::ElevationScan>,
+           std::chrono::system_clock::time_point>
+Level2ProductViewImpl::GetDerivedData(
+   std::chrono::system_clock::time_point time)
+{
+   auto radarProductManager = self_->radar_product_manager();
 
-         // Store data moment value
-         if (dataMomentsArray8 != nullptr)
-         {
-            std::uint8_t dataValue = dataMomentsArray8[i];
-            if (dataValue < snrThreshold && dataValue != RANGE_FOLDED)
-            {
-               continue;
-            }
+   std::shared_ptr<types::RadarProductRecord> record;
+   std::tie(record, time) = radarProductManager->GetLevel2ProductRecord(time);
 
-            for (std::size_t m = 0; m < vertexCount; m++)
-            {
-               dataMoments8[mIndex++] = dataMomentsArray8[i];
+   std::shared_ptr<wsr88d::Ar2vFile> file =
+      (record != nullptr) ? record->level2_file() : nullptr;
 
-               if (cfpMomentsArray != nullptr)
-               {
-                  cfpMoments[mIndex - 1] = cfpMomentsArray[i];
-               }
-            }
-         }
-         else
-         {
-            std::uint16_t dataValue = dataMomentsArray16[i];
-            if (dataValue < snrThreshold && dataValue != RANGE_FOLDED)
-            {
-               continue;
-            }
+   if (file == nullptr)
+   {
+      derivedScan_ = nullptr;
+      return {nullptr, time};
+   }
 
-            for (std::size_t m = 0; m < vertexCount; m++)
-            {
-               dataMoments16[mIndex++] = dataMomentsArray16[i];
-            }
-         }
+   // Views of the same product share the derived scan. The message count
+   // distinguishes a volume which is still being received from its completed
+   // form.
+   const Level2DerivedKey key {radarProductManager->radar_site()->id(),
+                               product_,
+                               time,
+                               file->message_count()};
+
+   derivedScan_ = derivedCache_.GetOrCompute(
+      key,
+      [&]() -> std::shared_ptr<const Level2DerivedScan>
+      {
+         boost::timer::cpu_timer timer;
 
-         // Store vertices
-         if (gate > 0)
+         auto volume = wsr88d::VolumeProducts::Create(file);
+         if (volume == nullptr)
          {
-            const std::uint16_t baseCoord = gate - 1;
-
-            std::size_t offset1 = ((startRadial + radial) % vertexRadials *
-                                      common::MAX_DATA_MOMENT_GATES +
-                                   baseCoord) *
-                                  2;
-            std::size_t offset2 = offset1 + gateSize * 2;
-            std::size_t offset3 =
-               (((startRadial + radial + 1) % vertexRadials) *
-                   common::MAX_DATA_MOMENT_GATES +
-                baseCoord) *
-               2;
-            std::size_t offset4 = offset3 + gateSize * 2;
-
-            vertices[vIndex++] = coordinates[offset1];
-            vertices[vIndex++] = coordinates[offset1 + 1];
-
-            vertices[vIndex++] = coordinates[offset2];
-            vertices[vIndex++] = coordinates[offset2 + 1];
-
-            vertices[vIndex++] = coordinates[offset3];
-            vertices[vIndex++] = coordinates[offset3 + 1];
-
-            vertices[vIndex++] = coordinates[offset3];
-            vertices[vIndex++] = coordinates[offset3 + 1];
-
-            vertices[vIndex++] = coordinates[offset4];
-            vertices[vIndex++] = coordinates[offset4 + 1];
-
-            vertices[vIndex++] = coordinates[offset2];
-            vertices[vIndex++] = coordinates[offset2 + 1];
-
-            vertexCount = 6;
+            return nullptr;
          }
-         else
-         {
-            const std::uint16_t baseCoord = gate;
-
-            std::size_t offset1 = ((startRadial + radial) % vertexRadials *
-                                      common::MAX_DATA_MOMENT_GATES +
-                                   baseCoord) *
-                                  2;
-            std::size_t offset2 =
-               (((startRadial + radial + 1) % vertexRadials) *
-                   common::MAX_DATA_MOMENT_GATES +
-                baseCoord) *
-               2;
 
-            vertices[vIndex++] = p->latitude_;
-            vertices[vIndex++] = p->longitude_;
+         auto derivedScan            = std::make_shared<Level2DerivedScan>();
+         derivedScan->elevationScan_ = volume->CreateElevationScan(product_);
+         derivedScan->messageCount_  = key.messageCount_;
 
-            vertices[vIndex++] = coordinates[offset1];
-            vertices[vIndex++] = coordinates[offset1 + 1];
+         timer.stop();
+         logger_->debug("Derived product computed in {}",
+                        timer.format(6, "%ws"));
+         derivedComputeHistogram_->Record(
+            static_cast<std::uint64_t>(timer.elapsed().wall));
 
-            vertices[vIndex++] = coordinates[offset2];
-            vertices[vIndex++] = coordinates[offset2 + 1];
-
-            vertexCount = 3;
-         }
-      }
-   }
-   vertices.resize(vIndex);
-   vertices.shrink_to_fit();
-
-   if (momentData0->data_word_size() == 8)
-   {
-      dataMoments8.resize(mIndex);
-      dataMoments8.shrink_to_fit();
-   }
-   else
-   {
-      dataMoments16.resize(mIndex);
-      dataMoments16.shrink_to_fit();
-   }
+         return derivedScan;
+      });
 
-   if (cfpMoments.size() > 0)
+   if (derivedScan_ == nullptr)
    {
-      cfpMoments.resize(mIndex);
-      cfpMoments.shrink_to_fit();
+      return {nullptr, time};
    }
 
-   timer.stop();
-   logger_->debug("Vertices calculated in {}", timer.format(6, "%ws"));
-
-   UpdateColorTableLut();
-
-   Q_EMIT SweepComputed();
+   return {derivedScan_->elevationScan_, time};
 }
 
 void Level2ProductViewImpl::ComputeCoordinates(
@@ -843,6 +984,12 @@ void Level2ProductViewImpl::ComputeCoordinates(
    const double radarLatitude       = radarSite->latitude();
    const double radarLongitude      = radarSite->longitude();
 
+   // The coordinate buffer is only needed by views which compute sweeps
+   if (coordinates_.empty())
+   {
+      coordinates_.resize(kMaxCoordinates_);
+   }
+
    // Calculate azimuth coordinates
    timer.start();
 
@@ -946,6 +1093,8 @@ void Level2ProductViewImpl::ComputeCoordinates(
       });
    timer.stop();
    logger_->debug("Coordinates calculated in {}", timer.format(6, "%ws"));
+   coordinatesHistogram_->Record(
+      static_cast<std::uint64_t>(timer.elapsed().wall));
 }
 
 bool Level2ProductViewImpl::IsRadarDataIncomplete(
@@ -1155,6 +1304,7 @@ Level2ProductView::GetDataLevelCode(std::uint16_t level) const
    case common::Level2Product::DifferentialReflectivity:
    case common::Level2Product::DifferentialPhase:
    case common::Level2Product::CorrelationCoefficient:
+   case common::Level2Product::CompositeReflectivity:
       if (level == RANGE_FOLDED)
       {
          return wsr88d::DataLevelCode::RangeFolded;
@@ -1202,6 +1352,9 @@ std::optional<float> Level2ProductView::GetDataValue(std::uint16_t level) const
    case common::Level2Product::DifferentialReflectivity:
    case common::Level2Product::DifferentialPhase:
    case common::Level2Product::CorrelationCoefficient:
+   case common::Level2Product::CompositeReflectivity:
+   case common::Level2Product::EchoTops:
+   case common::Level2Product::VerticallyIntegratedLiquid:
       threshold = 2;
       break;
 
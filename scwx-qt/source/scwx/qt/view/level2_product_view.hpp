@@ -3,6 +3,7 @@
 #include <scwx/common/color_table.hpp>
 #include <scwx/common/products.hpp>
 #include <scwx/qt/view/radar_product_view.hpp>
+#include <scwx/wsr88d/rda/generic_radar_data.hpp>
 
 #include <chrono>
 #include <memory>
@@ -32,6 +33,7 @@ public:
                                          color_table_lut() const override;
    std::uint16_t                         color_table_min() const override;
    std::uint16_t                         color_table_max() const override;
+   wsr88d::rda::DataBlockType            data_block_type() const;
    float                                 elevation() const override;
    float                                 range() const override;
    std::chrono::system_clock::time_point sweep_time() const override;
@@ -40,6 +42,8 @@ public:
    std::uint16_t                         vcp() const override;
    const std::vector<float>&             vertices() const override;
 
+   std::shared_ptr<const util::PolarSweep> polar_sweep() const override;
+
    void LoadColorTable(std::shared_ptr<common::ColorTable> colorTable) override;
    void SelectElevation(float elevation) override;
    void SelectProduct(const std::string& productName) override;
@@ -2,6 +2,7 @@
 #include <scwx/qt/util/geographic_lib.hpp>
 #include <scwx/common/constants.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/metrics.hpp>
 #include <scwx/util/threads.hpp>
 #include <scwx/util/time.hpp>
 #include <scwx/wsr88d/rpg/digital_radial_data_array_packet.hpp>
@@ -194,7 +195,7 @@ void Level3RadialView::ComputeSweep()
 
    for (uint16_t layer = 0; layer < numberOfLayers; layer++)
    {
-      std::vector<std::shared_ptr<wsr88d::rpg::Packet>> packetList =
+      std::span<const std::shared_ptr<wsr88d::rpg::Packet>> packetList =
          symbologyBlock->packet_list(layer);
 
       for (auto it = packetList.begin(); it != packetList.end(); it++)
@@ -422,6 +423,10 @@ void Level3RadialView::ComputeSweep()
 
    timer.stop();
    logger_->debug("Vertices calculated in {}", timer.format(6, "%ws"));
+   scwx::util::metrics::Registry::Instance()
+      .GetHistogram(scwx::util::metrics::MetricName(
+         "sweep_compute", GetRadarProductName()))
+      .Record(static_cast<std::uint64_t>(timer.elapsed().wall));
 
    UpdateColorTableLut();
 
@@ -487,6 +492,10 @@ void Level3RadialView::Impl::ComputeCoordinates(
                  });
    timer.stop();
    logger_->debug("Coordinates calculated in {}", timer.format(6, "%ws"));
+   scwx::util::metrics::Registry::Instance()
+      .GetHistogram(scwx::util::metrics::MetricName(
+         "coordinates", self_->GetRadarProductName()))
+      .Record(static_cast<std::uint64_t>(timer.elapsed().wall));
 }
 
 std::optional<std::uint16_t>
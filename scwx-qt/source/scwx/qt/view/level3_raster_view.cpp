@@ -2,6 +2,7 @@
 #include <scwx/qt/util/geographic_lib.hpp>
 #include <scwx/common/constants.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/metrics.hpp>
 #include <scwx/util/threads.hpp>
 #include <scwx/util/time.hpp>
 #include <scwx/wsr88d/rpg/raster_data_packet.hpp>
@@ -174,7 +175,7 @@ void Level3RasterView::ComputeSweep()
 
    for (uint16_t layer = 0; layer < numberOfLayers; layer++)
    {
-      std::vector<std::shared_ptr<wsr88d::rpg::Packet>> packetList =
+      std::span<const std::shared_ptr<wsr88d::rpg::Packet>> packetList =
          symbologyBlock->packet_list(layer);
 
       for (auto it = packetList.begin(); it != packetList.end(); it++)
@@ -278,6 +279,10 @@ void Level3RasterView::ComputeSweep()
 
    timer.stop();
    logger_->debug("Coordinates calculated in {}", timer.format(6, "%ws"));
+   scwx::util::metrics::Registry::Instance()
+      .GetHistogram(scwx::util::metrics::MetricName(
+         "coordinates", GetRadarProductName()))
+      .Record(static_cast<std::uint64_t>(timer.elapsed().wall));
 
    // Calculate vertices
    timer.start();
@@ -351,6 +356,10 @@ void Level3RasterView::ComputeSweep()
 
    timer.stop();
    logger_->debug("Vertices calculated in {}", timer.format(6, "%ws"));
+   scwx::util::metrics::Registry::Instance()
+      .GetHistogram(scwx::util::metrics::MetricName(
+         "sweep_compute", GetRadarProductName()))
+      .Record(static_cast<std::uint64_t>(timer.elapsed().wall));
 
    UpdateColorTableLut();
 
@@ -0,0 +1,642 @@
+#include <scwx/qt/view/mosaic_view.hpp>
+#include <scwx/qt/config/radar_site.hpp>
+#include <scwx/qt/manager/radar_product_manager.hpp>
+#include <scwx/qt/util/geographic_lib.hpp>
+#include <scwx/util/logger.hpp>
+#include <scwx/util/time.hpp>
+#include <scwx/wsr88d/rda/generic_radar_data.hpp>
+
+#include <scwx/common/constants.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <execution>
+#include <numeric>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <boost/asio.hpp>
+#include <boost/container_hash/hash.hpp>
+#include <boost/range/irange.hpp>
+#include <boost/timer/timer.hpp>
+#include <boost/uuid/random_generator.hpp>
+
+namespace scwx
+{
+namespace qt
+{
+namespace view
+{
+
+static const std::string logPrefix_ = "scwx::qt::view::mosaic_view";
+static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
+
+// Mosaic extent surrounding the selected radar site, in degrees
+static constexpr double kLatitudeSpan_  = 10.0;
+static constexpr double kLongitudeSpan_ = 14.0;
+static constexpr double kResolution_    = 0.02;
+
+static constexpr std::size_t kMaxSites_ = 16;
+
+static constexpr float kElevation_ = 0.5f;
+
+// Level 2 reflectivity data moment scaling
+static constexpr float         kRefOffset_       = 66.0f;
+static constexpr float         kRefScale_        = 2.0f;
+static constexpr std::uint16_t kRefRangeMin_     = 1;
+static constexpr std::uint16_t kRefRangeMax_     = 255;
+static constexpr std::uint16_t kRefRangeFolded_  = 1;
+static constexpr std::size_t   kVerticesPerCell_ = 6;
+
+static std::unordered_map<std::string, std::weak_ptr<MosaicView>>
+                  instanceMap_ {};
+static std::mutex instanceMutex_ {};
+
+class MosaicView::Impl
+{
+public:
+   explicit Impl(MosaicView* self, const std::string& radarSiteId) :
+       self_ {self}, radarSiteId_ {radarSiteId}
+   {
+   }
+   ~Impl() { threadPool_.join(); }
+
+   void ConnectSite(const std::shared_ptr<manager::RadarProductManager>& site);
+   void ConnectSites();
+   void DisconnectSites();
+   void LoadSweep(const std::shared_ptr<manager::RadarProductManager>& site,
+                  std::chrono::system_clock::time_point                time);
+   void UpdateSweep(const std::shared_ptr<manager::RadarProductManager>& site,
+                    const std::shared_ptr<wsr88d::Ar2vFile>& level2File);
+   void UpdateTiles(const std::vector<std::size_t>& tiles);
+   void BuildTile(std::size_t tile, Tile& tileVertices) const;
+
+   static std::shared_ptr<util::MosaicSweep>
+   CreateSweep(const std::shared_ptr<manager::RadarProductManager>& site,
+               const std::shared_ptr<wsr88d::rda::ElevationScan>&   scan);
+   static std::optional<util::MosaicSweep::Extent>
+   GetSweepExtent(const std::shared_ptr<manager::RadarProductManager>& site,
+                  float maxRange);
+
+   MosaicView*        self_;
+   boost::uuids::uuid uuid_ {boost::uuids::random_generator()()};
+
+   // Mosaic updates are serialized on a single thread
+   boost::asio::thread_pool threadPool_ {1u};
+
+   const std::string             radarSiteId_;
+   std::atomic<util::MosaicRule> rule_ {util::MosaicRule::MaxValue};
+
+   // Unique identifiers for which radar data collection is enabled
+   std::unordered_set<boost::uuids::uuid, boost::hash<boost::uuids::uuid>>
+      enabledUuids_ {};
+
+   std::vector<std::shared_ptr<manager::RadarProductManager>> sites_ {};
+
+   // Only accessed from the thread pool
+   std::unique_ptr<util::MosaicGrid> grid_ {nullptr};
+   std::uint64_t                     generation_ {0u};
+
+   std::mutex        mosaicMutex_ {};
+   std::vector<Tile> tiles_ {};
+
+   std::shared_ptr<common::ColorTable>    colorTable_ {nullptr};
+   std::vector<boost::gil::rgba8_pixel_t> colorTableLut_ {};
+};
+
+MosaicView::MosaicView(const std::string& radarSite) :
+    p(std::make_unique<Impl>(this, radarSite))
+{
+}
+MosaicView::~MosaicView()
+{
+   p->DisconnectSites();
+}
+
+const std::vector<boost::gil::rgba8_pixel_t>&
+MosaicView::color_table_lut() const
+{
+   return p->colorTableLut_;
+}
+
+std::uint16_t MosaicView::color_table_min() const
+{
+   return kRefRangeMin_;
+}
+
+std::uint16_t MosaicView::color_table_max() const
+{
+   return kRefRangeMax_;
+}
+
+std::mutex& MosaicView::mosaic_mutex()
+{
+   return p->mosaicMutex_;
+}
+
+std::string MosaicView::radar_site() const
+{
+   return p->radarSiteId_;
+}
+
+util::MosaicRule MosaicView::rule() const
+{
+   return p->rule_;
+}
+
+std::size_t MosaicView::site_count() const
+{
+   return p->sites_.size();
+}
+
+const std::vector<MosaicView::Tile>& MosaicView::tiles() const
+{
+   return p->tiles_;
+}
+
+void MosaicView::set_rule(util::MosaicRule rule)
+{
+   if (p->rule_.exchange(rule) == rule)
+   {
+      return;
+   }
+
+   boost::asio::post(p->threadPool_,
+                     [rule, this]()
+                     {
+                        if (p->grid_ != nullptr)
+                        {
+                           p->UpdateTiles(p->grid_->SetRule(rule));
+                        }
+                     });
+}
+
+void MosaicView::LoadColorTable(std::shared_ptr<common::ColorTable> colorTable)
+{
+   if (colorTable == nullptr || !colorTable->IsValid())
+   {
+      return;
+   }
+
+   p->colorTable_ = colorTable;
+
+   boost::integer_range<std::uint16_t> dataRange =
+      boost::irange<std::uint16_t>(kRefRangeMin_, kRefRangeMax_ + 1);
+
+   std::vector<boost::gil::rgba8_pixel_t>& lut = p->colorTableLut_;
+   lut.resize(kRefRangeMax_ - kRefRangeMin_ + 1);
+   lut.shrink_to_fit();
+
+   std::for_each(std::execution::par_unseq,
+                 dataRange.begin(),
+                 dataRange.end(),
+                 [&](std::uint16_t i)
+                 {
+                    if (i == kRefRangeFolded_)
+                    {
+                       lut[i - kRefRangeMin_] = colorTable->rf_color();
+                    }
+                    else
+                    {
+                       float f = (i - kRefOffset_) / kRefScale_;
+                       lut[i - kRefRangeMin_] = colorTable->Color(f);
+                    }
+                 });
+
+   Q_EMIT ColorTableLutUpdated();
+}
+
+void MosaicView::SetEnabled(const boost::uuids::uuid& uuid, bool enabled)
+{
+   const bool wasEnabled = !p->enabledUuids_.empty();
+
+   if (enabled)
+   {
+      p->enabledUuids_.insert(uuid);
+   }
+   else
+   {
+      p->enabledUuids_.erase(uuid);
+   }
+
+   const bool isEnabled = !p->enabledUuids_.empty();
+
+   if (isEnabled && !wasEnabled)
+   {
+      p->ConnectSites();
+   }
+   else if (!isEnabled && wasEnabled)
+   {
+      p->DisconnectSites();
+   }
+}
+
+std::shared_ptr<MosaicView> MosaicView::Instance(const std::string& radarSite)
+{
+   std::unique_lock lock {instanceMutex_};
+
+   std::shared_ptr<MosaicView> instance = nullptr;
+
+   // Look up instance weak pointer
+   auto it = instanceMap_.find(radarSite);
+   if (it != instanceMap_.end())
+   {
+      instance = it->second.lock();
+   }
+
+   // If no active instance was found, create a new one
+   if (instance == nullptr)
+   {
+      instance = std::make_shared<MosaicView>(radarSite);
+      instanceMap_.insert_or_assign(radarSite, instance);
+   }
+
+   return instance;
+}
+
+void MosaicView::Impl::ConnectSites()
+{
+   std::shared_ptr<config::RadarSite> center =
+      config::RadarSite::Get(radarSiteId_);
+
+   if (center == nullptr)
+   {
+      logger_->debug("Radar site not found: {}", radarSiteId_);
+      return;
+   }
+
+   const common::Coordinate centerCoordinate {center->latitude(),
+                                              center->longitude()};
+
+   // Select the nearest WSR-88D sites within the mosaic extent
+   std::vector<std::pair<double, std::shared_ptr<config::RadarSite>>>
+      candidates {};
+
+   for (auto& radarSite : config::RadarSite::GetAll())
+   {
+      if (radarSite->type() == "wsr88d" &&
+          std::abs(radarSite->latitude() - centerCoordinate.latitude_) <
+             kLatitudeSpan_ / 2.0 &&
+          std::abs(radarSite->longitude() - centerCoordinate.longitude_) <
+             kLongitudeSpan_ / 2.0)
+      {
+         double distance = util::GeographicLib::GetDistance(
+                              centerCoordinate.latitude_,
+                              centerCoordinate.longitude_,
+                              radarSite->latitude(),
+                              radarSite->longitude())
+                              .value();
+         candidates.emplace_back(distance, radarSite);
+      }
+   }
+
+   std::sort(candidates.begin(),
+             candidates.end(),
+             [](const auto& a, const auto& b) { return a.first < b.first; });
+   if (candidates.size() > kMaxSites_)
+   {
+      candidates.resize(kMaxSites_);
+   }
+
+   logger_->debug("Creating mosaic around {} from {} sites",
+                  radarSiteId_,
+                  candidates.size());
+
+   // Retain the existing mosaic if the view is re-enabled
+   boost::asio::post(
+      threadPool_,
+      [centerCoordinate, this]()
+      {
+         if (grid_ != nullptr)
+         {
+            return;
+         }
+
+         grid_ = std::make_unique<util::MosaicGrid>(
+            util::MosaicGrid::Definition::Centered(
+               centerCoordinate, kLatitudeSpan_, kLongitudeSpan_, kResolution_),
+            rule_);
+
+         std::unique_lock lock {mosaicMutex_};
+         tiles_.resize(grid_->tile_count());
+      });
+
+   for (auto& candidate : candidates)
+   {
+      auto radarProductManager =
+         manager::RadarProductManager::Instance(candidate.second->id());
+
+      sites_.push_back(radarProductManager);
+      ConnectSite(radarProductManager);
+   }
+}
+
+void MosaicView::Impl::ConnectSite(
+   const std::shared_ptr<manager::RadarProductManager>& site)
+{
+   connect(
+      site.get(),
+      &manager::RadarProductManager::NewDataAvailable,
+      self_,
+      [site, this](common::RadarProductGroup group,
+                   const std::string& /* product */,
+                   std::chrono::system_clock::time_point latestTime)
+      {
+         if (!enabledUuids_.empty() &&
+             group == common::RadarProductGroup::Level2)
+         {
+            LoadSweep(site, latestTime);
+         }
+      },
+      Qt::QueuedConnection);
+
+   site->EnableRefresh(common::RadarProductGroup::Level2,
+                       common::GetLevel2Name(
+                          common::Level2Product::Reflectivity),
+                       true,
+                       uuid_);
+}
+
+void MosaicView::Impl::DisconnectSites()
+{
+   for (auto& site : sites_)
+   {
+      site->EnableRefresh(common::RadarProductGroup::Level2,
+                          common::GetLevel2Name(
+                             common::Level2Product::Reflectivity),
+                          false,
+                          uuid_);
+      disconnect(site.get(),
+                 &manager::RadarProductManager::NewDataAvailable,
+                 self_,
+                 nullptr);
+   }
+
+   sites_.clear();
+}
+
+void MosaicView::Impl::LoadSweep(
+   const std::shared_ptr<manager::RadarProductManager>& site,
+   std::chrono::system_clock::time_point                time)
+{
+   const std::string siteId = site->radar_id();
+
+   logger_->debug("Load Sweep: {}, {}", siteId, scwx::util::TimeString(time));
+
+   std::shared_ptr<request::NexradFileRequest> request =
+      std::make_shared<request::NexradFileRequest>(siteId);
+
+   connect(request.get(),
+           &request::NexradFileRequest::RequestComplete,
+           self_,
+           [site, this](std::shared_ptr<request::NexradFileRequest> request)
+           {
+              const auto& record = request->radar_product_record();
+
+              if (record != nullptr && record->level2_file() != nullptr)
+              {
+                 boost::asio::post(
+                    threadPool_,
+                    [site, level2File = record->level2_file(), this]()
+                    { UpdateSweep(site, level2File); });
+              }
+           });
+
+   boost::asio::post(threadPool_,
+                     [site, time, request]()
+                     {
+                        try
+                        {
+                           site->LoadLevel2Data(time, request);
+                        }
+                        catch (const std::exception& ex)
+                        {
+                           logger_->error(ex.what());
+                        }
+                     });
+}
+
+void MosaicView::Impl::UpdateSweep(
+   const std::shared_ptr<manager::RadarProductManager>& site,
+   const std::shared_ptr<wsr88d::Ar2vFile>&             level2File)
+{
+   const std::string siteId = site->radar_id();
+
+   if (grid_ == nullptr || site->radar_site() == nullptr)
+   {
+      return;
+   }
+
+   std::shared_ptr<wsr88d::rda::ElevationScan> scan;
+   std::tie(scan, std::ignore, std::ignore) = level2File->GetElevationScan(
+      wsr88d::rda::DataBlockType::MomentRef, kElevation_, {});
+
+   std::shared_ptr<util::MosaicSweep> sweep = CreateSweep(site, scan);
+   if (sweep == nullptr)
+   {
+      logger_->debug("No reflectivity data: {}", siteId);
+      return;
+   }
+
+   boost::timer::cpu_timer  timer;
+   std::vector<std::size_t> tiles = grid_->UpdateSite(siteId, sweep);
+   UpdateTiles(tiles);
+   timer.stop();
+
+   logger_->debug("Mosaic updated from {} ({} tiles) in {}",
+                  siteId,
+                  tiles.size(),
+                  timer.format(6, "%ws"));
+}
+
+std::shared_ptr<util::MosaicSweep> MosaicView::Impl::CreateSweep(
+   const std::shared_ptr<manager::RadarProductManager>& site,
+   const std::shared_ptr<wsr88d::rda::ElevationScan>&   scan)
+{
+   std::shared_ptr<config::RadarSite> radarSite = site->radar_site();
+
+   if (scan == nullptr || scan->empty())
+   {
+      return nullptr;
+   }
+
+   auto momentData0 = scan->cbegin()->second->moment_data_block(
+      wsr88d::rda::DataBlockType::MomentRef);
+   if (momentData0 == nullptr || momentData0->data_word_size() != 8)
+   {
+      return nullptr;
+   }
+
+   auto sweep = std::make_shared<util::MosaicSweep>();
+
+   sweep->location_ = {radarSite->latitude(), radarSite->longitude()};
+   sweep->firstGateRange_ =
+      static_cast<float>(momentData0->data_moment_range_raw());
+   sweep->gateSpacing_ = static_cast<float>(
+      momentData0->data_moment_range_sample_interval_raw());
+   sweep->gateCount_ = momentData0->number_of_data_moment_gates();
+   sweep->threshold_ = static_cast<std::uint8_t>(std::clamp<std::int16_t>(
+      momentData0->snr_threshold_raw(), 2, kRefRangeMax_));
+
+   if (sweep->gateSpacing_ <= 0.0f || sweep->gateCount_ == 0)
+   {
+      return nullptr;
+   }
+
+   sweep->extent_ = GetSweepExtent(site, sweep->max_range());
+
+   sweep->azimuths_.reserve(scan->size());
+   sweep->data_.resize(scan->size() * sweep->gateCount_, 0u);
+
+   std::size_t radial = 0;
+   for (auto& radialPair : *scan)
+   {
+      auto& radialData = radialPair.second;
+      auto  momentData =
+         radialData->moment_data_block(wsr88d::rda::DataBlockType::MomentRef);
+
+      sweep->azimuths_.push_back(radialData->azimuth_angle().value());
+
+      if (momentData != nullptr && momentData->data_word_size() == 8)
+      {
+         const std::uint8_t* dataMoments =
+            static_cast<const std::uint8_t*>(momentData->data_moments());
+         const std::size_t gates =
+            std::min<std::size_t>(momentData->number_of_data_moment_gates(),
+                                  sweep->gateCount_);
+
+         std::copy(dataMoments,
+                   dataMoments + gates,
+                   sweep->data_.begin() + radial * sweep->gateCount_);
+      }
+
+      ++radial;
+   }
+
+   return sweep;
+}
+
+std::optional<util::MosaicSweep::Extent> MosaicView::Impl::GetSweepExtent(
+   const std::shared_ptr<manager::RadarProductManager>& site, float maxRange)
+{
+   // Use the gate coordinates cached by the radar product manager, which are
+   // at the far edge of each 0.5 degree radial gate
+   const std::vector<float>& coordinates =
+      site->coordinates(common::RadialSize::_0_5Degree);
+   const float gateSize = site->gate_size();
+
+   if (coordinates.size() != common::MAX_0_5_DEGREE_RADIALS *
+                                common::MAX_DATA_MOMENT_GATES * 2 ||
+       maxRange > gateSize * common::MAX_DATA_MOMENT_GATES)
+   {
+      // The extent is estimated from the maximum range
+      return std::nullopt;
+   }
+
+   const std::size_t gate = static_cast<std::size_t>(
+      std::max(std::ceil(maxRange / gateSize) - 1.0f, 0.0f));
+
+   std::shared_ptr<config::RadarSite> radarSite = site->radar_site();
+
+   util::MosaicSweep::Extent extent {radarSite->latitude(),
+                                     radarSite->longitude(),
+                                     radarSite->latitude(),
+                                     radarSite->longitude()};
+
+   for (std::size_t radial = 0; radial < common::MAX_0_5_DEGREE_RADIALS;
+        ++radial)
+   {
+      const std::size_t offset =
+         (radial * common::MAX_DATA_MOMENT_GATES + gate) * 2;
+      const double latitude  = coordinates[offset];
+      const double longitude = coordinates[offset + 1];
+
+      extent.minLatitude_  = std::min(extent.minLatitude_, latitude);
+      extent.maxLatitude_  = std::max(extent.maxLatitude_, latitude);
+      extent.minLongitude_ = std::min(extent.minLongitude_, longitude);
+      extent.maxLongitude_ = std::max(extent.maxLongitude_, longitude);
+   }
+
+   // Account for the curvature of the outer edge between radials
+   extent.minLatitude_ -= kResolution_;
+   extent.maxLatitude_ += kResolution_;
+   extent.minLongitude_ -= kResolution_;
+   extent.maxLongitude_ += kResolution_;
+
+   return extent;
+}
+
+void MosaicView::Impl::UpdateTiles(const std::vector<std::size_t>& tiles)
+{
+   if (tiles.empty())
+   {
+      return;
+   }
+
+   // Regenerate the vertices of the updated tiles only
+   std::vector<Tile> updatedTiles(tiles.size());
+
+   std::vector<std::size_t> indices(tiles.size());
+   std::iota(indices.begin(), indices.end(), 0u);
+
+   std::for_each(std::execution::par,
+                 indices.cbegin(),
+                 indices.cend(),
+                 [&](std::size_t i) { BuildTile(tiles[i], updatedTiles[i]); });
+
+   const std::uint64_t generation = ++generation_;
+
+   std::unique_lock lock {mosaicMutex_};
+
+   for (std::size_t i = 0; i < tiles.size(); ++i)
+   {
+      updatedTiles[i].generation_ = generation;
+      tiles_[tiles[i]].vertices_.swap(updatedTiles[i].vertices_);
+      tiles_[tiles[i]].dataMoments_.swap(updatedTiles[i].dataMoments_);
+      tiles_[tiles[i]].generation_ = generation;
+   }
+
+   lock.unlock();
+
+   Q_EMIT self_->MosaicUpdated();
+}
+
+void MosaicView::Impl::BuildTile(std::size_t tile, Tile& tileVertices) const
+{
+   const util::MosaicGrid::Definition& definition = grid_->definition();
+   const util::MosaicGrid::TileExtent  extent     = grid_->tile_extent(tile);
+   const std::vector<std::uint8_t>&    data       = grid_->data();
+
+   std::vector<float>&        vertices    = tileVertices.vertices_;
+   std::vector<std::uint8_t>& dataMoments = tileVertices.dataMoments_;
+
+   const float halfCell = static_cast<float>(definition.resolution_ / 2.0);
+
+   for (std::size_t row = extent.rowBegin_; row < extent.rowEnd_; ++row)
+   {
+      for (std::size_t column = extent.columnBegin_; column < extent.columnEnd_;
+           ++column)
+      {
+         const std::uint8_t value = data[row * definition.columns_ + column];
+         if (value == 0u)
+         {
+            continue;
+         }
+
+         const common::Coordinate center = definition.cell_center(row, column);
+         const float lat1 = static_cast<float>(center.latitude_) - halfCell;
+         const float lat2 = static_cast<float>(center.latitude_) + halfCell;
+         const float lon1 = static_cast<float>(center.longitude_) - halfCell;
+         const float lon2 = static_cast<float>(center.longitude_) + halfCell;
+
+         vertices.insert(vertices.end(),
+                         {lat1, lon1, lat1, lon2, lat2, lon1, //
+                          lat2, lon1, lat1, lon2, lat2, lon2});
+         dataMoments.insert(dataMoments.end(), kVerticesPerCell_, value);
+      }
+   }
+}
+
+} // namespace view
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <scwx/common/color_table.hpp>
+#include <scwx/qt/util/mosaic_grid.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <QObject>
+#include <boost/uuid/uuid.hpp>
+
+namespace scwx
+{
+namespace qt
+{
+namespace view
+{
+
+/**
+ * @brief Combines the lowest reflectivity sweep of the radar sites surrounding
+ * a radar site into a single mosaic.
+ *
+ * A single view is shared by each map showing the same radar site. Vertices
+ * are generated per grid tile, and only tiles covered by an updated site are
+ * regenerated.
+ */
+class MosaicView : public QObject
+{
+   Q_OBJECT
+
+public:
+   /**
+    * @brief Vertices of a mosaic tile. Vertices are only generated for cells
+    * containing data.
+    */
+   struct Tile
+   {
+      // Changes each time the tile is regenerated
+      std::uint64_t generation_ {0u};
+
+      // Latitude/longitude pairs for each vertex
+      std::vector<float> vertices_ {};
+
+      // Data moments for each vertex
+      std::vector<std::uint8_t> dataMoments_ {};
+   };
+
+   static constexpr std::size_t kMaxTileVertices =
+      util::MosaicGrid::kTileSize * util::MosaicGrid::kTileSize * 6;
+
+   explicit MosaicView(const std::string& radarSite);
+   virtual ~MosaicView();
+
+   const std::vector<boost::gil::rgba8_pixel_t>& color_table_lut() const;
+   std::uint16_t                                 color_table_min() const;
+   std::uint16_t                                 color_table_max() const;
+   std::mutex&                                   mosaic_mutex();
+   std::string                                   radar_site() const;
+   util::MosaicRule                              rule() const;
+   std::size_t                                   site_count() const;
+
+   /**
+    * @brief Mosaic tiles, one for each tile of the mosaic grid. Must be
+    * accessed while holding the mosaic mutex.
+    */
+   const std::vector<Tile>& tiles() const;
+
+   void set_rule(util::MosaicRule rule);
+
+   void LoadColorTable(std::shared_ptr<common::ColorTable> colorTable);
+
+   /**
+    * @brief Enables or disables radar data collection associated with a
+    * unique identifier (UUID). Radar data is collected while enabled for any
+    * UUID.
+    *
+    * @param [in] uuid Unique identifier
+    * @param [in] enabled Whether radar data collection is enabled
+    */
+   void SetEnabled(const boost::uuids::uuid& uuid, bool enabled);
+
+   /**
+    * @brief Gets the mosaic view surrounding a radar site. The view is shared
+    * while any reference to it remains.
+    *
+    * @param [in] radarSite Radar site ID
+    *
+    * @return Mosaic view
+    */
+   static std::shared_ptr<MosaicView> Instance(const std::string& radarSite);
+
+signals:
+   void ColorTableLutUpdated();
+   void MosaicUpdated();
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace view
+} // namespace qt
+} // namespace scwx
@@ -1,5 +1,6 @@
 #include <scwx/qt/view/overlay_product_view.hpp>
 #include <scwx/qt/manager/radar_product_manager.hpp>
+#include <scwx/util/clock.hpp>
 #include <scwx/util/logger.hpp>
 #include <scwx/util/time.hpp>
 
@@ -47,9 +48,9 @@ public:
 
    std::shared_ptr<manager::RadarProductManager> radarProductManager_ {nullptr};
 
-   std::unordered_map<std::string, std::shared_ptr<wsr88d::rpg::Level3Message>>
-              messageMap_ {};
-   std::mutex messageMutex_ {};
+   std::unordered_map<std::string, std::shared_ptr<types::RadarProductRecord>>
+              recordMap_ {};
+   std::mutex recordMutex_ {};
 };
 
 OverlayProductView::OverlayProductView() : p(std::make_unique<Impl>(this)) {};
@@ -64,10 +65,22 @@ OverlayProductView::radar_product_manager() const
 std::shared_ptr<wsr88d::rpg::Level3Message>
 OverlayProductView::radar_product_message(const std::string& product) const
 {
-   std::unique_lock lock {p->messageMutex_};
+   auto record = radar_product_record(product);
+   if (record != nullptr)
+   {
+      return record->level3_file()->message();
+   }
+
+   return nullptr;
+}
+
+std::shared_ptr<types::RadarProductRecord>
+OverlayProductView::radar_product_record(const std::string& product) const
+{
+   std::unique_lock lock {p->recordMutex_};
 
-   auto it = p->messageMap_.find(product);
-   if (it != p->messageMap_.cend())
+   auto it = p->recordMap_.find(product);
+   if (it != p->recordMap_.cend())
    {
       return it->second;
    }
@@ -186,17 +199,17 @@ void OverlayProductView::Impl::LoadProduct(
                   header.date_of_message(), header.time_of_message() * 1000);
 
                // If the record is from the last 30 minutes
-               if (productTime + 30min >= std::chrono::system_clock::now() ||
+               if (productTime + 30min >= scwx::util::clock::Now() ||
                    (selectedTime_ != std::chrono::system_clock::time_point {} &&
                     productTime + 30min >= selectedTime_))
                {
                   // Store loaded record
-                  std::unique_lock lock {messageMutex_};
+                  std::unique_lock lock {recordMutex_};
 
-                  auto it = messageMap_.find(product);
-                  if (it == messageMap_.cend() || it->second != message)
+                  auto it = recordMap_.find(product);
+                  if (it == recordMap_.cend() || it->second != record)
                   {
-                     messageMap_.insert_or_assign(product, message);
+                     recordMap_.insert_or_assign(product, record);
 
                      lock.unlock();
 
@@ -206,8 +219,8 @@ void OverlayProductView::Impl::LoadProduct(
                else
                {
                   // If product is more than 30 minutes old, discard
-                  std::unique_lock lock {messageMutex_};
-                  std::size_t      elementsRemoved = messageMap_.erase(product);
+                  std::unique_lock lock {recordMutex_};
+                  std::size_t      elementsRemoved = recordMap_.erase(product);
                   lock.unlock();
 
                   if (elementsRemoved > 0)
@@ -222,8 +235,8 @@ void OverlayProductView::Impl::LoadProduct(
             else
             {
                // If the product doesn't exist, erase the stale product
-               std::unique_lock lock {messageMutex_};
-               std::size_t      elementsRemoved = messageMap_.erase(product);
+               std::unique_lock lock {recordMutex_};
+               std::size_t      elementsRemoved = recordMap_.erase(product);
                lock.unlock();
 
                if (elementsRemoved > 0)
@@ -254,8 +267,8 @@ void OverlayProductView::Impl::LoadProduct(
 
 void OverlayProductView::Impl::ResetProducts()
 {
-   std::unique_lock lock {messageMutex_};
-   messageMap_.clear();
+   std::unique_lock lock {recordMutex_};
+   recordMap_.clear();
    lock.unlock();
 
    Q_EMIT self_->ProductUpdated(kNst_);
@@ -281,12 +294,12 @@ void OverlayProductView::SetAutoRefresh(bool enabled)
 
 void OverlayProductView::Impl::Update(const std::string& product)
 {
-   // Retrieve message from Radar Product Manager
-   std::shared_ptr<wsr88d::rpg::Level3Message> message;
-   std::chrono::system_clock::time_point       requestedTime {selectedTime_};
-   std::chrono::system_clock::time_point       foundTime;
-   std::tie(message, foundTime) =
-      radarProductManager_->GetLevel3Data(product, requestedTime);
+   // Retrieve record from Radar Product Manager
+   std::shared_ptr<types::RadarProductRecord> record;
+   std::chrono::system_clock::time_point      requestedTime {selectedTime_};
+   std::chrono::system_clock::time_point      foundTime;
+   std::tie(record, foundTime) =
+      radarProductManager_->GetLevel3ProductRecord(product, requestedTime);
 
    // If a different time was found than what was requested, update it
    if (requestedTime != foundTime)
@@ -294,19 +307,19 @@ void OverlayProductView::Impl::Update(const std::string& product)
       selectedTime_ = foundTime;
    }
 
-   if (message == nullptr)
+   if (record == nullptr || record->level3_file()->message() == nullptr)
    {
       logger_->debug("{} data not found", product);
       return;
    }
 
-   std::unique_lock lock {messageMutex_};
+   std::unique_lock lock {recordMutex_};
 
-   // Update message in map
-   auto it = messageMap_.find(product);
-   if (it == messageMap_.cend() || it->second != message)
+   // Update record in map
+   auto it = recordMap_.find(product);
+   if (it == recordMap_.cend() || it->second != record)
    {
-      messageMap_.insert_or_assign(product, message);
+      recordMap_.insert_or_assign(product, record);
 
       lock.unlock();
 
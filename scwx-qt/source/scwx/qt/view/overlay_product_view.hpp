@@ -26,6 +26,13 @@ class RadarProductManager;
 
 } // namespace manager
 
+namespace types
+{
+
+class RadarProductRecord;
+
+} // namespace types
+
 namespace view
 {
 
@@ -40,6 +47,8 @@ public:
    std::shared_ptr<manager::RadarProductManager> radar_product_manager() const;
    std::shared_ptr<wsr88d::rpg::Level3Message>
    radar_product_message(const std::string& product) const;
+   std::shared_ptr<types::RadarProductRecord>
+   radar_product_record(const std::string& product) const;
    std::chrono::system_clock::time_point selected_time() const;
 
    void set_radar_product_manager(
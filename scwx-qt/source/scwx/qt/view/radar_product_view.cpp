@@ -77,6 +77,11 @@ RadarProductView::radar_product_manager() const
    return p->radarProductManager_;
 }
 
+std::shared_ptr<const util::PolarSweep> RadarProductView::polar_sweep() const
+{
+   return nullptr;
+}
+
 float RadarProductView::range() const
 {
    return 0.0f;
@@ -5,6 +5,7 @@
 #include <scwx/common/products.hpp>
 #include <scwx/qt/manager/radar_product_manager.hpp>
 #include <scwx/qt/types/map_types.hpp>
+#include <scwx/qt/util/polar_sweep.hpp>
 #include <scwx/wsr88d/wsr88d_types.hpp>
 
 #include <chrono>
@@ -47,6 +48,13 @@ public:
    virtual std::uint16_t                         vcp() const        = 0;
    virtual const std::vector<float>&             vertices() const   = 0;
 
+   /**
+    * @brief Gets the sweep packed for texture-based rendering.
+    *
+    * @return Packed sweep, or nullptr if the sweep was computed as vertices
+    */
+   virtual std::shared_ptr<const util::PolarSweep> polar_sweep() const;
+
    std::shared_ptr<manager::RadarProductManager> radar_product_manager() const;
    std::chrono::system_clock::time_point         selected_time() const;
    std::mutex&                                   sweep_mutex();
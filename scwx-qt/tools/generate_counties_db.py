@@ -2,6 +2,7 @@ import argparse
 import geopandas as gpd
 import pathlib
 import sqlite3
+import struct
 
 class DatabaseInfo:
     def __init__(self):
@@ -48,6 +49,12 @@ def ParseArguments():
                         dest     = "outputDb_",
                         type     = pathlib.Path,
                         required = True)
+    parser.add_argument("-b", "--output_bin",
+                        metavar  = "filename",
+                        help     = "output compact county store",
+                        dest     = "outputBin_",
+                        type     = pathlib.Path,
+                        default  = None)
     return parser.parse_args()
 
 def Prepare(dbInfo, outputDb):
@@ -159,6 +166,51 @@ def ProcessWfoDbf(dbInfo, dbfFilename):
         except:
             print("Error inserting WFO:", row.FULLSTAID, row.CITYSTATE)
 
+def WriteCountyStore(dbInfo, outputBin):
+    print("Writing compact county store:", outputBin)
+
+    # String pool, with each unique string stored once
+    pool       = bytearray()
+    poolOffset = {}
+
+    def AddString(value):
+        encoded = value.encode("utf-8")
+        if encoded not in poolOffset:
+            poolOffset[encoded] = len(pool)
+            pool.extend(encoded)
+        return (poolOffset[encoded], len(encoded))
+
+    def CreateTable(query):
+        rows = []
+        for row in dbInfo.sqlCursor_.execute(query):
+            key   = row[0] if row[0] is not None else ""
+            value = row[1] if row[1] is not None else ""
+            rows.append((key.encode("utf-8"), key, value))
+
+        # Sort by encoded key, matching byte-wise comparison at runtime
+        rows.sort(key = lambda row: row[0])
+
+        table = bytearray()
+        for (_, key, value) in rows:
+            (keyOffset, keyLength)     = AddString(key)
+            (valueOffset, valueLength) = AddString(value)
+            table.extend(struct.pack("<IIHH", keyOffset, valueOffset,
+                                     keyLength, valueLength))
+        return (len(rows), table)
+
+    (countyCount, countyTable) = CreateTable("SELECT id, name FROM counties")
+    (stateCount, stateTable)   = CreateTable("SELECT state, name FROM states")
+    (wfoCount, wfoTable)       = CreateTable("SELECT id, city_state FROM wfos")
+
+    with open(outputBin, "wb") as file:
+        file.write(b"SCWXCTY1")
+        file.write(struct.pack("<IIII", countyCount, stateCount, wfoCount,
+                               len(pool)))
+        file.write(countyTable)
+        file.write(stateTable)
+        file.write(wfoTable)
+        file.write(pool)
+
 def PostProcess(dbInfo):
     # Commit changes and close database
     dbInfo.sqlConnection_.commit()
@@ -180,4 +232,7 @@ for stateDb in args.inputStateDbs_:
 for wfoDb in args.inputWfoDbs_:
     ProcessWfoDbf(dbInfo, wfoDb)
 
+if args.outputBin_ is not None:
+    WriteCountyStore(dbInfo, args.outputBin_)
+
 PostProcess(dbInfo)
@@ -0,0 +1,617 @@
+#include <scwx/awips/text_product_message.hpp>
+#include <scwx/awips/text_product_file.hpp>
+
+#include <algorithm>
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace awips
+{
+
+static std::string
+Product(std::initializer_list<std::string_view> lines,
+        bool                                    terminated = true)
+{
+   std::string product {"\x01\r\r\n123 \r\r\n"};
+   for (std::string_view line : lines)
+   {
+      product.append(line);
+      product.append("\r\r\n");
+   }
+   if (terminated)
+   {
+      product.push_back('\x03');
+   }
+   return product;
+}
+
+static const std::string kSevereWeatherStatement_ = Product(
+   {"WWUS53 KLSX 042130",
+    "SVSLSX",
+    "",
+    "Severe Weather Statement",
+    "National Weather Service St Louis MO",
+    "430 PM CDT Fri Jun 4 2021",
+    "",
+    "MOC071-099-042145-",
+    "/O.CON.KLSX.TO.W.0012.000000T0000Z-210604T2145Z/",
+    "Franklin MO-Jefferson MO-",
+    "430 PM CDT Fri Jun 4 2021",
+    "",
+    "At 430 PM CDT, a confirmed tornado was located near Pacific.",
+    "",
+    "LAT...LON 3845 9100 3856 9100 3857 9070 3849 9069",
+    "",
+    "TIME...MOT...LOC 2130Z 270DEG 26KT 3849 9080",
+    "",
+    "TORNADO...OBSERVED",
+    "TORNADO DAMAGE THREAT...CONSIDERABLE",
+    "",
+    "$$",
+    "",
+    "MOC189-510-",
+    "042145-",
+    "/O.EXP.KLSX.TO.W.0012.000000T0000Z-210604T2145Z/",
+    "St. Louis MO-",
+    "St. Louis City MO-",
+    "430 PM CDT Fri Jun 4 2021",
+    "",
+    "The tornado warning for St. Louis County will expire at 445 PM CDT.",
+    "",
+    "LAT...LON 3860 9030 3870 9020 3865 9010",
+    "",
+    "$$",
+    "",
+    "Jones"});
+
+// Sample warnings, in the format of the warnings test data files. Expected
+// values were recorded from the stream-based text product parser.
+static const std::string kWarnings_ =
+   Product({"WUUS53 KLSX 042114",
+            "SVRLSX",
+            "",
+            "MOC071-219-042200-",
+            "/O.NEW.KLSX.SV.W.0154.210604T2114Z-210604T2200Z/",
+            "",
+            "BULLETIN - IMMEDIATE BROADCAST REQUESTED",
+            "Severe Thunderstorm Warning",
+            "National Weather Service St Louis MO",
+            "414 PM CDT Fri Jun 4 2021",
+            "",
+            "The National Weather Service in St Louis has issued a",
+            "",
+            "* Severe Thunderstorm Warning for...",
+            "  Franklin County in east central Missouri...",
+            "  Warren County in east central Missouri...",
+            "",
+            "LAT...LON 3873 9141 3882 9086 3850 9077 3843 9081",
+            "      3842 9124",
+            "",
+            "TIME...MOT...LOC 2114Z 251DEG 31KT 3864 9133",
+            "",
+            "HAIL...1.00IN",
+            "WIND...60MPH",
+            "",
+            "$$",
+            "",
+            "Smith"}) +
+   Product(
+      {"WWUS53 KLSX 042145",
+       "SVSLSX",
+       "",
+       "Severe Weather Statement",
+       "National Weather Service St Louis MO",
+       "445 PM CDT Fri Jun 4 2021",
+       "",
+       "MOC071-219-042200-",
+       "/O.CON.KLSX.SV.W.0154.000000T0000Z-210604T2200Z/",
+       "Franklin MO-Warren MO-",
+       "445 PM CDT Fri Jun 4 2021",
+       "",
+       "...A SEVERE THUNDERSTORM WARNING REMAINS IN EFFECT UNTIL 500 PM CDT...",
+       "",
+       "LAT...LON 3873 9120 3882 9086 3850 9077 3843 9081",
+       "",
+       "TIME...MOT...LOC 2145Z 250DEG 30KT 3866 9107",
+       "",
+       "TORNADO...POSSIBLE",
+       "HAIL THREAT...RADAR INDICATED",
+       "MAX HAIL SIZE...1.75 IN",
+       "WIND THREAT...OBSERVED",
+       "MAX WIND GUST...70 MPH",
+       "",
+       "$$",
+       "",
+       "ILC119-133-163-MOC189-510-042200-",
+       "/O.CAN.KLSX.SV.W.0154.000000T0000Z-210604T2200Z/",
+       "Madison IL-Monroe IL-St. Clair IL-St. Louis MO-",
+       "St. Louis City MO-",
+       "445 PM CDT Fri Jun 4 2021",
+       "",
+       "The storm which prompted the warning has weakened.",
+       "",
+       "LAT...LON 3873 9120 3882 9086 3850 9077",
+       "",
+       "$$",
+       "",
+       "Smith"}) +
+   Product({"WGUS53 KLSX 060345",
+            "FFWLSX",
+            "",
+            "MOC099-186-060945-",
+            "/O.NEW.KLSX.FF.W.0020.210606T0345Z-210606T0945Z/",
+            "/00000.0.ER.000000T0000Z.000000T0000Z.000000T0000Z.OO/",
+            "",
+            "BULLETIN - EAS ACTIVATION REQUESTED",
+            "Flash Flood Warning",
+            "National Weather Service St Louis MO",
+            "1045 PM CDT Sat Jun 5 2021",
+            "",
+            "...FLASH FLOOD WARNING IN EFFECT UNTIL 445 AM CDT...",
+            "",
+            "LAT...LON 3818 9062 3827 9049 3811 9025 3800 9043",
+            "",
+            "FLASH FLOOD...RADAR INDICATED",
+            "FLASH FLOOD DAMAGE THREAT...CONSIDERABLE",
+            "",
+            "$$",
+            "",
+            "Jones"}) +
+   Product({"WFUS53 KLSX 060415",
+            "TORLSX",
+            "",
+            "ILC027-060445-",
+            "/O.NEW.KLSX.TO.W.0013.210606T0415Z-210606T0445Z/",
+            "",
+            "BULLETIN - EAS ACTIVATION REQUESTED",
+            "Tornado Warning",
+            "National Weather Service St Louis MO",
+            "1115 PM CDT Sat Jun 5 2021",
+            "",
+            "* Tornado Warning for...",
+            "  Clinton County in south central Illinois...",
+            "",
+            "LAT...LON 3856 8952 3867 8913 3852 8909 3845 8946",
+            "",
+            "TIME...MOT...LOC 0415Z 245DEG 35KT 3855 8945",
+            "",
+            "TORNADO...OBSERVED",
+            "TORNADO DAMAGE THREAT...CONSIDERABLE",
+            "MAX HAIL SIZE...1.00 IN",
+            "",
+            "$$",
+            "",
+            "Smith"});
+
+static bool Contains(const std::string& text, std::string_view view)
+{
+   return view.empty() ||
+          (view.data() >= text.data() &&
+           view.data() + view.size() <= text.data() + text.size());
+}
+
+static void ExpectSegmentViewsInText(const Segment& segment)
+{
+   ASSERT_NE(segment.text_, nullptr);
+
+   for (std::string_view line : segment.productContent_)
+   {
+      EXPECT_TRUE(Contains(*segment.text_, line)) << line;
+   }
+
+   if (segment.header_.has_value())
+   {
+      for (std::string_view line : segment.header_->ugcString_)
+      {
+         EXPECT_TRUE(Contains(*segment.text_, line)) << line;
+      }
+      for (std::string_view line : segment.header_->ugcNames_)
+      {
+         EXPECT_TRUE(Contains(*segment.text_, line)) << line;
+      }
+      for (const Vtec& vtec : segment.header_->vtecString_)
+      {
+         EXPECT_TRUE(Contains(*segment.text_, vtec.hVtec_)) << vtec.hVtec_;
+      }
+      EXPECT_TRUE(
+         Contains(*segment.text_, segment.header_->issuanceDateTime_));
+   }
+}
+
+TEST(TextProductMessage, ParseSegments)
+{
+   std::istringstream is {kSevereWeatherStatement_};
+
+   auto message = TextProductMessage::Create(is);
+
+   ASSERT_NE(message, nullptr);
+   ASSERT_NE(message->wmo_header(), nullptr);
+   EXPECT_EQ(message->wmo_header()->sequence_number(), "123");
+   EXPECT_EQ(message->wmo_header()->icao(), "KLSX");
+   EXPECT_EQ(message->wmo_header()->product_category(), "SVS");
+   EXPECT_EQ(message->mnd_header(),
+             (std::vector<std::string> {"Severe Weather Statement",
+                                        "National Weather Service St Louis MO",
+                                        "430 PM CDT Fri Jun 4 2021"}));
+   EXPECT_TRUE(message->overview_block().empty());
+   ASSERT_EQ(message->segment_count(), 2u);
+
+   auto segment = message->segment(0);
+   ASSERT_TRUE(segment->header_.has_value());
+   EXPECT_EQ(segment->header_->ugc_.fips_ids(),
+             (std::vector<std::string> {"MOC071", "MOC099"}));
+   ASSERT_EQ(segment->header_->vtecString_.size(), 1u);
+   EXPECT_EQ(segment->header_->vtecString_[0].pVtec_.action(),
+             PVtec::Action::Continued);
+   EXPECT_EQ(segment->header_->ugcNames_,
+             (std::vector<std::string_view> {"Franklin MO-Jefferson MO-"}));
+   EXPECT_EQ(segment->header_->issuanceDateTime_, "430 PM CDT Fri Jun 4 2021");
+   ASSERT_EQ(segment->productContent_.size(), 10u);
+   EXPECT_EQ(segment->productContent_.front(),
+             "At 430 PM CDT, a confirmed tornado was located near Pacific.");
+   EXPECT_EQ(segment->productContent_.back(), "$$");
+   ASSERT_TRUE(segment->codedLocation_.has_value());
+   EXPECT_EQ(segment->codedLocation_->coordinates().size(), 4u);
+   ASSERT_TRUE(segment->codedMotion_.has_value());
+   EXPECT_EQ(segment->codedMotion_->direction(), 270u);
+   EXPECT_EQ(segment->codedMotion_->speed(), 26u);
+   EXPECT_TRUE(segment->observed_);
+   EXPECT_EQ(segment->threatCategory_, ibw::ThreatCategory::Considerable);
+
+   segment = message->segment(1);
+   ASSERT_TRUE(segment->header_.has_value());
+   EXPECT_EQ(segment->header_->ugcString_,
+             (std::vector<std::string_view> {"MOC189-510-", "042145-"}));
+   EXPECT_EQ(segment->header_->ugc_.fips_ids(),
+             (std::vector<std::string> {"MOC189", "MOC510"}));
+   EXPECT_EQ(segment->header_->ugcNames_,
+             (std::vector<std::string_view> {"St. Louis MO-",
+                                             "St. Louis City MO-"}));
+   ASSERT_EQ(segment->productContent_.size(), 5u);
+   ASSERT_TRUE(segment->codedLocation_.has_value());
+   EXPECT_EQ(segment->codedLocation_->coordinates().size(), 3u);
+   EXPECT_FALSE(segment->codedMotion_.has_value());
+}
+
+TEST(TextProductMessage, MessageContent)
+{
+   std::istringstream is {kSevereWeatherStatement_};
+
+   auto message = TextProductMessage::Create(is);
+
+   ASSERT_NE(message, nullptr);
+
+   const std::string content = message->message_content();
+   EXPECT_TRUE(content.starts_with("123 \nWWUS53 KLSX 042130\nSVSLSX\n"));
+   EXPECT_TRUE(content.ends_with("$$\n\nJones"));
+   EXPECT_EQ(content.find('\r'), std::string::npos);
+   EXPECT_EQ(content.find('\x03'), std::string::npos);
+}
+
+TEST(TextProductMessage, SegmentOutlivesMessage)
+{
+   std::shared_ptr<const Segment> segment {};
+
+   {
+      std::istringstream is {kSevereWeatherStatement_};
+
+      auto message = TextProductMessage::Create(is);
+      ASSERT_NE(message, nullptr);
+      ASSERT_EQ(message->segment_count(), 2u);
+
+      segment = message->segment(1);
+   }
+
+   ExpectSegmentViewsInText(*segment);
+   EXPECT_EQ(
+      segment->productContent_.front(),
+      "The tornado warning for St. Louis County will expire at 445 PM CDT.");
+}
+
+TEST(TextProductMessage, ConsecutiveProducts)
+{
+   std::istringstream is {kSevereWeatherStatement_ + kSevereWeatherStatement_};
+
+   auto first  = TextProductMessage::Create(is);
+   auto second = TextProductMessage::Create(is);
+
+   ASSERT_NE(first, nullptr);
+   ASSERT_NE(second, nullptr);
+   EXPECT_EQ(first->message_content(), second->message_content());
+   EXPECT_NE(first->segment(0)->text_, second->segment(0)->text_);
+}
+
+TEST(TextProductMessage, UnterminatedProduct)
+{
+   std::istringstream is {
+      Product({"WFUS53 KLSX 042114",
+               "TORLSX",
+               "MOC071-042145-",
+               "/O.NEW.KLSX.TO.W.0012.210604T2114Z-210604T2145Z/",
+               "",
+               "Tornado warning text"},
+              false)};
+
+   auto message = TextProductMessage::Create(is);
+
+   ASSERT_NE(message, nullptr);
+   ASSERT_EQ(message->segment_count(), 1u);
+
+   auto segment = message->segment(0);
+   ASSERT_TRUE(segment->header_.has_value());
+   EXPECT_EQ(segment->header_->ugc_.fips_ids(),
+             (std::vector<std::string> {"MOC071"}));
+   EXPECT_EQ(segment->productContent_,
+             (std::vector<std::string_view> {"Tornado warning text"}));
+}
+
+TEST(TextProductMessage, HeaderOnlyProduct)
+{
+   const std::string product = Product({"WWUS53 KLSX 042130", "SVSLSX"});
+
+   std::istringstream headerStream {product};
+   WmoHeader          header;
+   ASSERT_TRUE(header.Parse(headerStream));
+
+   std::istringstream is {product};
+   auto               message = TextProductMessage::Create(is);
+
+   ASSERT_NE(message, nullptr);
+   ASSERT_NE(message->wmo_header(), nullptr);
+   EXPECT_EQ(*message->wmo_header(), header);
+   EXPECT_EQ(message->wmo_header()->icao(), "KLSX");
+   EXPECT_EQ(message->wmo_header()->product_category(), "SVS");
+   EXPECT_EQ(message->segment_count(), 0u);
+}
+
+TEST(TextProductMessage, UnterminatedHeaderOnlyProduct)
+{
+   // The AWIPS identifier line ends at the end of the product text
+   std::string product = Product({"WWUS53 KLSX 042130", "SVSLSX"}, false);
+   product.resize(product.size() - 3);
+
+   std::istringstream headerStream {product};
+   WmoHeader          header;
+   ASSERT_TRUE(header.Parse(headerStream));
+
+   std::istringstream is {product};
+   auto               message = TextProductMessage::Create(is);
+
+   ASSERT_NE(message, nullptr);
+   EXPECT_EQ(message->wmo_header()->product_category(), "SVS");
+   EXPECT_EQ(message->segment_count(), 0u);
+}
+
+TEST(TextProductMessage, MissingAwipsIdentifier)
+{
+   const std::string product = Product({"WWUS53 KLSX 042130"});
+
+   std::istringstream headerStream {product};
+   WmoHeader          header;
+   EXPECT_FALSE(header.Parse(headerStream));
+
+   std::istringstream is {product};
+   EXPECT_EQ(TextProductMessage::Create(is), nullptr);
+}
+
+static bool HasLine(const Segment& segment, std::string_view line)
+{
+   return std::find(segment.productContent_.cbegin(),
+                    segment.productContent_.cend(),
+                    line) != segment.productContent_.cend();
+}
+
+TEST(TextProductMessage, Warnings)
+{
+   using namespace std::chrono;
+
+   std::istringstream is {kWarnings_};
+
+   // Severe Thunderstorm Warning
+   auto message = TextProductMessage::Create(is);
+   ASSERT_NE(message, nullptr);
+   EXPECT_EQ(message->wmo_header()->product_category(), "SVR");
+   EXPECT_TRUE(message->mnd_header().empty());
+   ASSERT_EQ(message->segment_count(), 1u);
+
+   auto segment = message->segment(0);
+   ASSERT_TRUE(segment->header_.has_value());
+   EXPECT_EQ(segment->header_->ugc_.states(),
+             (std::vector<std::string> {"MO"}));
+   EXPECT_EQ(segment->header_->ugc_.fips_ids(),
+             (std::vector<std::string> {"MOC071", "MOC219"}));
+   EXPECT_EQ(segment->header_->ugc_.product_expiration(), "042200");
+   ASSERT_EQ(segment->header_->vtecString_.size(), 1u);
+
+   const PVtec* pVtec = &segment->header_->vtecString_[0].pVtec_;
+   EXPECT_EQ(pVtec->fixed_identifier(), PVtec::ProductType::Operational);
+   EXPECT_EQ(pVtec->action(), PVtec::Action::New);
+   EXPECT_EQ(pVtec->office_id(), "KLSX");
+   EXPECT_EQ(pVtec->phenomenon(), Phenomenon::SevereThunderstorm);
+   EXPECT_EQ(pVtec->significance(), Significance::Warning);
+   EXPECT_EQ(pVtec->event_tracking_number(), 154);
+   EXPECT_EQ(pVtec->event_begin(),
+             sys_days {2021y / June / 4d} + 21h + 14min);
+   EXPECT_EQ(pVtec->event_end(), sys_days {2021y / June / 4d} + 22h);
+   EXPECT_TRUE(segment->header_->vtecString_[0].hVtec_.empty());
+   EXPECT_TRUE(segment->header_->ugcNames_.empty());
+   EXPECT_EQ(segment->productContent_.size(), 20u);
+
+   ASSERT_TRUE(segment->codedLocation_.has_value());
+   auto coordinates = segment->codedLocation_->coordinates();
+   ASSERT_EQ(coordinates.size(), 5u);
+   EXPECT_DOUBLE_EQ(coordinates[0].latitude_, 38.73);
+   EXPECT_DOUBLE_EQ(coordinates[0].longitude_, -91.41);
+   EXPECT_DOUBLE_EQ(coordinates[4].latitude_, 38.42);
+   EXPECT_DOUBLE_EQ(coordinates[4].longitude_, -91.24);
+
+   ASSERT_TRUE(segment->codedMotion_.has_value());
+   EXPECT_EQ(segment->codedMotion_->time().to_duration(), 21h + 14min);
+   EXPECT_EQ(segment->codedMotion_->direction(), 251u);
+   EXPECT_EQ(segment->codedMotion_->speed(), 31u);
+   coordinates = segment->codedMotion_->coordinates();
+   ASSERT_EQ(coordinates.size(), 1u);
+   EXPECT_DOUBLE_EQ(coordinates[0].latitude_, 38.64);
+   EXPECT_DOUBLE_EQ(coordinates[0].longitude_, -91.33);
+
+   EXPECT_TRUE(HasLine(*segment, "HAIL...1.00IN"));
+   EXPECT_TRUE(HasLine(*segment, "WIND...60MPH"));
+   EXPECT_FALSE(segment->observed_);
+   EXPECT_FALSE(segment->tornadoPossible_);
+   EXPECT_EQ(segment->threatCategory_, ibw::ThreatCategory::Base);
+
+   // Severe Weather Statement
+   message = TextProductMessage::Create(is);
+   ASSERT_NE(message, nullptr);
+   EXPECT_EQ(message->wmo_header()->product_category(), "SVS");
+   EXPECT_EQ(message->mnd_header().size(), 3u);
+   ASSERT_EQ(message->segment_count(), 2u);
+
+   segment = message->segment(0);
+   ASSERT_TRUE(segment->header_.has_value());
+   EXPECT_EQ(segment->header_->ugc_.fips_ids(),
+             (std::vector<std::string> {"MOC071", "MOC219"}));
+   ASSERT_EQ(segment->header_->vtecString_.size(), 1u);
+
+   pVtec = &segment->header_->vtecString_[0].pVtec_;
+   EXPECT_EQ(pVtec->action(), PVtec::Action::Continued);
+   EXPECT_EQ(pVtec->phenomenon(), Phenomenon::SevereThunderstorm);
+   EXPECT_EQ(pVtec->event_tracking_number(), 154);
+   EXPECT_EQ(pVtec->event_begin(), system_clock::time_point {});
+   EXPECT_EQ(pVtec->event_end(), sys_days {2021y / June / 4d} + 22h);
+   EXPECT_EQ(segment->header_->ugcNames_,
+             (std::vector<std::string_view> {"Franklin MO-Warren MO-"}));
+   EXPECT_EQ(segment->header_->issuanceDateTime_, "445 PM CDT Fri Jun 4 2021");
+   EXPECT_EQ(segment->productContent_.size(), 13u);
+
+   ASSERT_TRUE(segment->codedLocation_.has_value());
+   EXPECT_EQ(segment->codedLocation_->coordinates().size(), 4u);
+   ASSERT_TRUE(segment->codedMotion_.has_value());
+   EXPECT_EQ(segment->codedMotion_->time().to_duration(), 21h + 45min);
+   EXPECT_EQ(segment->codedMotion_->direction(), 250u);
+   EXPECT_EQ(segment->codedMotion_->speed(), 30u);
+
+   EXPECT_TRUE(HasLine(*segment, "MAX HAIL SIZE...1.75 IN"));
+   EXPECT_TRUE(HasLine(*segment, "MAX WIND GUST...70 MPH"));
+   EXPECT_TRUE(segment->observed_);
+   EXPECT_TRUE(segment->tornadoPossible_);
+   EXPECT_EQ(segment->threatCategory_, ibw::ThreatCategory::Base);
+
+   segment = message->segment(1);
+   ASSERT_TRUE(segment->header_.has_value());
+   EXPECT_EQ(segment->header_->ugc_.states(),
+             (std::vector<std::string> {"IL", "MO"}));
+   EXPECT_EQ(segment->header_->ugc_.fips_ids(),
+             (std::vector<std::string> {
+                "ILC119", "ILC133", "ILC163", "MOC189", "MOC510"}));
+   ASSERT_EQ(segment->header_->vtecString_.size(), 1u);
+   EXPECT_EQ(segment->header_->vtecString_[0].pVtec_.action(),
+             PVtec::Action::Canceled);
+   EXPECT_EQ(segment->header_->ugcNames_,
+             (std::vector<std::string_view> {
+                "Madison IL-Monroe IL-St. Clair IL-St. Louis MO-",
+                "St. Louis City MO-"}));
+   EXPECT_EQ(segment->productContent_.size(), 5u);
+   ASSERT_TRUE(segment->codedLocation_.has_value());
+   EXPECT_EQ(segment->codedLocation_->coordinates().size(), 3u);
+   EXPECT_FALSE(segment->codedMotion_.has_value());
+   EXPECT_FALSE(segment->observed_);
+   EXPECT_FALSE(segment->tornadoPossible_);
+
+   // Flash Flood Warning
+   message = TextProductMessage::Create(is);
+   ASSERT_NE(message, nullptr);
+   EXPECT_EQ(message->wmo_header()->product_category(), "FFW");
+   ASSERT_EQ(message->segment_count(), 1u);
+
+   segment = message->segment(0);
+   ASSERT_TRUE(segment->header_.has_value());
+   EXPECT_EQ(segment->header_->ugc_.fips_ids(),
+             (std::vector<std::string> {"MOC099", "MOC186"}));
+   ASSERT_EQ(segment->header_->vtecString_.size(), 1u);
+
+   pVtec = &segment->header_->vtecString_[0].pVtec_;
+   EXPECT_EQ(pVtec->action(), PVtec::Action::New);
+   EXPECT_EQ(pVtec->phenomenon(), Phenomenon::FlashFlood);
+   EXPECT_EQ(pVtec->event_tracking_number(), 20);
+   EXPECT_EQ(pVtec->event_begin(), sys_days {2021y / June / 6d} + 3h + 45min);
+   EXPECT_EQ(pVtec->event_end(), sys_days {2021y / June / 6d} + 9h + 45min);
+   EXPECT_EQ(segment->header_->vtecString_[0].hVtec_,
+             "/00000.0.ER.000000T0000Z.000000T0000Z.000000T0000Z.OO/");
+   EXPECT_EQ(segment->productContent_.size(), 13u);
+   ASSERT_TRUE(segment->codedLocation_.has_value());
+   EXPECT_EQ(segment->codedLocation_->coordinates().size(), 4u);
+   EXPECT_FALSE(segment->codedMotion_.has_value());
+   EXPECT_FALSE(segment->observed_);
+   EXPECT_EQ(segment->threatCategory_, ibw::ThreatCategory::Considerable);
+
+   // Tornado Warning
+   message = TextProductMessage::Create(is);
+   ASSERT_NE(message, nullptr);
+   EXPECT_EQ(message->wmo_header()->product_category(), "TOR");
+   ASSERT_EQ(message->segment_count(), 1u);
+
+   segment = message->segment(0);
+   ASSERT_TRUE(segment->header_.has_value());
+   EXPECT_EQ(segment->header_->ugc_.fips_ids(),
+             (std::vector<std::string> {"ILC027"}));
+   ASSERT_EQ(segment->header_->vtecString_.size(), 1u);
+
+   pVtec = &segment->header_->vtecString_[0].pVtec_;
+   EXPECT_EQ(pVtec->phenomenon(), Phenomenon::Tornado);
+   EXPECT_EQ(pVtec->event_tracking_number(), 13);
+   EXPECT_EQ(segment->productContent_.size(), 17u);
+   ASSERT_TRUE(segment->codedLocation_.has_value());
+   EXPECT_EQ(segment->codedLocation_->coordinates().size(), 4u);
+   ASSERT_TRUE(segment->codedMotion_.has_value());
+   EXPECT_EQ(segment->codedMotion_->time().to_duration(), 4h + 15min);
+   EXPECT_EQ(segment->codedMotion_->direction(), 245u);
+   EXPECT_EQ(segment->codedMotion_->speed(), 35u);
+
+   EXPECT_TRUE(HasLine(*segment, "MAX HAIL SIZE...1.00 IN"));
+   EXPECT_TRUE(segment->observed_);
+   EXPECT_FALSE(segment->tornadoPossible_);
+   EXPECT_EQ(segment->threatCategory_, ibw::ThreatCategory::Considerable);
+}
+
+class TextProductMessageFileTest : public testing::TestWithParam<std::string>
+{
+};
+
+TEST_P(TextProductMessageFileTest, SegmentViews)
+{
+   TextProductFile file;
+
+   const std::string filename {std::string(SCWX_TEST_DATA_DIR) + GetParam()};
+   ASSERT_TRUE(file.LoadFile(filename));
+
+   for (auto& message : file.messages())
+   {
+      ASSERT_NE(message->wmo_header(), nullptr);
+      EXPECT_FALSE(message->message_content().empty());
+
+      for (auto& segment : message->segments())
+      {
+         ExpectSegmentViewsInText(*segment);
+
+         if (segment->header_.has_value())
+         {
+            EXPECT_FALSE(segment->header_->ugc_.fips_ids().empty());
+         }
+      }
+   }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+   TextProductMessage,
+   TextProductMessageFileTest,
+   testing::Values("/warnings/warnings_20210604_21.txt",
+                   "/warnings/warnings_20210606_15.txt",
+                   "/nexrad/level3/KLSX_NOUS63_FTMLSX_202201041404",
+                   "/text/PGUM_WHPQ41_CFWPQ1_202201231710.nids"));
+
+} // namespace awips
+} // namespace scwx
@@ -0,0 +1,69 @@
+#include <scwx/awips/wmo_header.hpp>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace awips
+{
+
+using namespace std::chrono_literals;
+
+static std::chrono::system_clock::time_point
+Time(int y, unsigned int m, unsigned int d, std::chrono::minutes time)
+{
+   return std::chrono::sys_days {std::chrono::year_month_day {
+             std::chrono::year {y},
+             std::chrono::month {m},
+             std::chrono::day {d}}} +
+          time;
+}
+
+TEST(WmoHeader, Parse)
+{
+   WmoHeader header;
+
+   EXPECT_TRUE(header.Parse("123 ", "WWUS53 KLSX 042130 CCA", "SVSLSX"));
+   EXPECT_EQ(header.sequence_number(), "123");
+   EXPECT_EQ(header.data_type(), "WW");
+   EXPECT_EQ(header.geographic_designator(), "US");
+   EXPECT_EQ(header.bulletin_id(), "53");
+   EXPECT_EQ(header.icao(), "KLSX");
+   EXPECT_EQ(header.date_time(), "042130");
+   EXPECT_EQ(header.bbb_indicator(), "CCA");
+   EXPECT_EQ(header.product_category(), "SVS");
+   EXPECT_EQ(header.product_designator(), "LSX");
+}
+
+TEST(WmoHeader, GetDateTime)
+{
+   WmoHeader header;
+   ASSERT_TRUE(header.Parse("", "WWUS53 KLSX 042130", "SVSLSX"));
+
+   EXPECT_EQ(header.GetDateTime(Time(2021, 6, 4, 21h + 45min)),
+             Time(2021, 6, 4, 21h + 30min));
+   EXPECT_EQ(header.GetDateTime(Time(2021, 6, 30, 0min)),
+             Time(2021, 6, 4, 21h + 30min));
+
+   // Issued in the prior month, and the prior year
+   EXPECT_EQ(header.GetDateTime(Time(2021, 7, 2, 0min)),
+             Time(2021, 6, 4, 21h + 30min));
+   EXPECT_EQ(header.GetDateTime(Time(2022, 1, 3, 0min)),
+             Time(2021, 12, 4, 21h + 30min));
+}
+
+TEST(WmoHeader, GetDateTimeInvalid)
+{
+   WmoHeader header;
+
+   ASSERT_TRUE(header.Parse("", "WWUS53 KLSX 312130", "SVSLSX"));
+   EXPECT_EQ(header.GetDateTime(Time(2021, 7, 2, 0min)),
+             std::chrono::system_clock::time_point {});
+
+   ASSERT_TRUE(header.Parse("", "WWUS53 KLSX 042460", "SVSLSX"));
+   EXPECT_EQ(header.GetDateTime(Time(2021, 6, 5, 0min)),
+             std::chrono::system_clock::time_point {});
+}
+
+} // namespace awips
+} // namespace scwx
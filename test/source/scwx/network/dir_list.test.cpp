@@ -1,5 +1,7 @@
 #include <scwx/network/dir_list.hpp>
+#include <scwx/network/transport.hpp>
 
+#include <fmt/format.h>
 #include <gtest/gtest.h>
 
 namespace scwx
@@ -10,6 +12,182 @@ namespace network
 static const std::string& kDefaultUrl {"https://warnings.allisonhouse.com"};
 static const std::string& kAlternateUrl {"https://warnings.cod.edu"};
 
+static const std::string kListingUrl_ {"https://listing.test/warnings/"};
+
+// Default Apache directory listing
+static const std::string kListing_ {
+   "<!DOCTYPE HTML PUBLIC \"-//W3C//DTD HTML 3.2 Final//EN\">\n"
+   "<html>\n"
+   " <head>\n"
+   "  <title>Index of /warnings</title>\n"
+   " </head>\n"
+   " <body>\n"
+   "<h1>Index of /warnings</h1>\n"
+   "  <table>\n"
+   "   <tr><th valign=\"top\"><img src=\"/icons/blank.gif\" alt=\"[ICO]\">"
+   "</th><th><a href=\"?C=N;O=D\">Name</a></th>"
+   "<th><a href=\"?C=M;O=A\">Last modified</a></th>"
+   "<th><a href=\"?C=S;O=A\">Size</a></th></tr>\n"
+   "   <tr><th colspan=\"4\"><hr></th></tr>\n"
+   "<tr><td valign=\"top\"><img src=\"/icons/back.gif\" alt=\"[PARENTDIR]\">"
+   "</td><td><a href=\"/\">Parent Directory</a></td><td>&nbsp;</td>"
+   "<td align=\"right\">  - </td></tr>\n"
+   "<tr><td valign=\"top\"><img src=\"/icons/folder.gif\" alt=\"[DIR]\">"
+   "</td><td><a href=\"archive/\">archive/</a></td>"
+   "<td align=\"right\">2024-05-06 23:59  </td>"
+   "<td align=\"right\">  - </td></tr>\n"
+   "<tr><td valign=\"top\"><img src=\"/icons/text.gif\" alt=\"[TXT]\">"
+   "</td><td><a href=\"warnings_202405071100.txt\">"
+   "warnings_202405071100.txt</a></td>"
+   "<td align=\"right\">2024-05-07 11:58  </td>"
+   "<td align=\"right\">1.5K</td></tr>\n"
+   "<tr><td valign=\"top\"><img src=\"/icons/text.gif\" alt=\"[TXT]\">"
+   "</td><td><a href=\"warnings_202405071200.txt\">"
+   "warnings_202405071200.txt</a></td>"
+   "<td align=\"right\">2024-05-07 12:04  </td>"
+   "<td align=\"right\">312 </td></tr>\n"
+   "   <tr><th colspan=\"4\"><hr></th></tr>\n"
+   "</table>\n"
+   "</body></html>\n"};
+
+/**
+ * Serves a directory listing in fixed-size chunks, as an HTTP server would,
+ * and honors conditional requests. The listing is served for any URL
+ * beginning with the listing URL.
+ */
+class ListingServer : public Transport
+{
+public:
+   explicit ListingServer(std::size_t chunkSize) : chunkSize_ {chunkSize} {}
+
+   std::shared_ptr<ObjectStore> OpenObjectStore(const std::string&,
+                                                const std::string&) override
+   {
+      return nullptr;
+   }
+
+   HttpResponse Get(const std::string&       url,
+                    const ::cpr::Header&     header,
+                    const ::cpr::Parameters& parameters) override
+   {
+      std::string  text {};
+      HttpResponse response = GetStream(
+         url,
+         [&text](std::string_view data)
+         {
+            text.append(data);
+            return true;
+         },
+         header,
+         parameters);
+      response.text_ = std::move(text);
+      return response;
+   }
+
+   HttpResponse GetStream(const std::string&   url,
+                          const WriteFunction& write,
+                          const ::cpr::Header& header,
+                          const ::cpr::Parameters& /* parameters */) override
+   {
+      ++requestCount_;
+      requestHeader_ = header;
+
+      HttpResponse response {};
+
+      if (!url.starts_with(kListingUrl_))
+      {
+         response.statusCode_ = 404;
+         return response;
+      }
+
+      const std::string eTag = fmt::format("\"{}\"", version_);
+      response.header_.emplace("ETag", eTag);
+
+      if (notModifiedCount_ > 0u)
+      {
+         // Respond as a misbehaving cache would, regardless of validators
+         --notModifiedCount_;
+         response.statusCode_ = 304;
+         return response;
+      }
+
+      if (auto it = header.find("If-None-Match");
+          it != header.cend() && it->second == eTag)
+      {
+         response.statusCode_ = 304;
+         return response;
+      }
+
+      response.statusCode_ = 200;
+
+      for (std::size_t i = 0; i < listing_.size(); i += chunkSize_)
+      {
+         ++chunkCount_;
+         if (!write(std::string_view {listing_}.substr(i, chunkSize_)))
+         {
+            break;
+         }
+      }
+
+      return response;
+   }
+
+   void SetListing(const std::string& listing)
+   {
+      // Versions are unique across servers, as listings are cached by URL
+      static int nextVersion = 0;
+
+      listing_ = listing;
+      version_ = ++nextVersion;
+   }
+
+   std::size_t   chunkSize_;
+   std::string   listing_ {kListing_};
+   int           version_ {0};
+   std::size_t   requestCount_ {0u};
+   std::size_t   chunkCount_ {0u};
+   std::size_t   notModifiedCount_ {0u};
+   ::cpr::Header requestHeader_ {};
+};
+
+class DirListServerTest : public testing::TestWithParam<std::size_t>
+{
+protected:
+   void SetUp() override
+   {
+      server_ = std::make_shared<ListingServer>(GetParam());
+      server_->SetListing(kListing_);
+      SetTransport(server_);
+   }
+
+   void TearDown() override { SetTransport(nullptr); }
+
+   std::shared_ptr<ListingServer> server_ {};
+};
+
+static void ExpectListingRecords(const std::vector<DirListRecord>& records)
+{
+   using namespace std::chrono;
+
+   ASSERT_EQ(records.size(), 3u);
+
+   EXPECT_EQ(records[0].filename_, "archive");
+   EXPECT_EQ(records[0].type_, std::filesystem::file_type::directory);
+   EXPECT_EQ(records[0].mtime_,
+             sys_days {year {2024} / May / day {6}} + 23h + 59min);
+
+   EXPECT_EQ(records[1].filename_, "warnings_202405071100.txt");
+   EXPECT_EQ(records[1].type_, std::filesystem::file_type::regular);
+   EXPECT_EQ(records[1].mtime_,
+             sys_days {year {2024} / May / day {7}} + 11h + 58min);
+   EXPECT_EQ(records[1].size_, 1536u);
+
+   EXPECT_EQ(records[2].filename_, "warnings_202405071200.txt");
+   EXPECT_EQ(records[2].mtime_,
+             sys_days {year {2024} / May / day {7}} + 12h + 4min);
+   EXPECT_EQ(records[2].size_, 312u);
+}
+
 TEST(DirList, GetDefaultUrl)
 {
    auto records = DirList(kDefaultUrl);
@@ -36,5 +214,87 @@ TEST(DirList, GetAlternateUrl)
    EXPECT_GT(records.size(), 0);
 }
 
+TEST_P(DirListServerTest, ChunkedListing)
+{
+   ExpectListingRecords(DirList(kListingUrl_));
+   EXPECT_EQ(server_->chunkCount_,
+             (kListing_.size() + GetParam() - 1) / GetParam());
+}
+
+TEST_P(DirListServerTest, NotModified)
+{
+   auto records = DirList(kListingUrl_);
+   ExpectListingRecords(records);
+
+   const std::size_t chunkCount = server_->chunkCount_;
+
+   // The second request is conditional, and returns the cached records
+   records = DirList(kListingUrl_);
+   EXPECT_EQ(server_->requestCount_, 2u);
+   EXPECT_EQ(server_->requestHeader_["If-None-Match"],
+             fmt::format("\"{}\"", server_->version_));
+   EXPECT_EQ(server_->chunkCount_, chunkCount);
+   ExpectListingRecords(records);
+
+   // A modified listing is transferred again
+   std::string listing {kListing_};
+   const std::size_t lastRow = listing.rfind("<tr><td");
+   listing.erase(lastRow, listing.find("</tr>", lastRow) + 6 - lastRow);
+   server_->SetListing(listing);
+
+   records = DirList(kListingUrl_);
+   EXPECT_GT(server_->chunkCount_, chunkCount);
+   ASSERT_EQ(records.size(), 2u);
+   EXPECT_EQ(records[1].filename_, "warnings_202405071100.txt");
+}
+
+TEST_P(DirListServerTest, NotModifiedWithoutCachedListing)
+{
+   // A listing which is not cached is transferred again without validators
+   server_->notModifiedCount_ = 1u;
+
+   const std::string url = kListingUrl_ + "uncached/";
+
+   ExpectListingRecords(DirList(url));
+   EXPECT_EQ(server_->requestCount_, 2u);
+   EXPECT_FALSE(server_->requestHeader_.contains("If-None-Match"));
+}
+
+TEST_P(DirListServerTest, LeastRecentlyUsedEviction)
+{
+   static constexpr std::size_t kCacheEntries = 32u;
+
+   const std::string prefix = fmt::format("{}lru{}/", kListingUrl_, GetParam());
+
+   // Fill the cache with listings more recent than the listing URL
+   ExpectListingRecords(DirList(kListingUrl_));
+   for (std::size_t i = 0; i < kCacheEntries - 1u; ++i)
+   {
+      DirList(fmt::format("{}{}/", prefix, i));
+   }
+
+   // Revalidating the listing URL makes it the most recently used
+   DirList(kListingUrl_);
+   EXPECT_TRUE(server_->requestHeader_.contains("If-None-Match"));
+
+   // A new listing evicts the least recently used listing
+   DirList(prefix + "new/");
+
+   DirList(kListingUrl_);
+   EXPECT_TRUE(server_->requestHeader_.contains("If-None-Match"));
+
+   DirList(fmt::format("{}{}/", prefix, 0));
+   EXPECT_FALSE(server_->requestHeader_.contains("If-None-Match"));
+}
+
+TEST_P(DirListServerTest, NotFound)
+{
+   EXPECT_TRUE(DirList("https://listing.test/missing/").empty());
+}
+
+INSTANTIATE_TEST_SUITE_P(DirList,
+                         DirListServerTest,
+                         testing::Values(1u, 7u, 64u, 1u << 16));
+
 } // namespace network
 } // namespace scwx
@@ -0,0 +1,276 @@
+#include <scwx/network/replay_transport.hpp>
+#include <scwx/network/dir_list.hpp>
+#include <scwx/util/clock.hpp>
+
+#include <fstream>
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace network
+{
+
+using namespace std::chrono_literals;
+
+static const auto kStartTime_ =
+   std::chrono::sys_days {std::chrono::year_month_day {
+      std::chrono::year {2024}, std::chrono::May, std::chrono::day {7}}} +
+   12h;
+
+class ReplayTransportTest : public testing::Test
+{
+protected:
+   void SetUp() override
+   {
+      root_ = std::filesystem::temp_directory_path() /
+              ::testing::UnitTest::GetInstance()->current_test_info()->name();
+      std::filesystem::remove_all(root_);
+
+      WriteFile("s3/bucket/2024/05/07/KLSX/KLSX20240507_115500_V06",
+                "early",
+                kStartTime_ - 5min);
+      WriteFile("s3/bucket/2024/05/07/KLSX/KLSX20240507_120500_V06",
+                "late",
+                kStartTime_ + 5min);
+      WriteFile("s3/bucket/2024/05/07/KTLX/KTLX20240507_115000_V06",
+                "other",
+                kStartTime_ - 10min);
+      WriteFile("http/example.com/warnings/warnings_202405071150.txt",
+                "warning",
+                kStartTime_ - 10min);
+      WriteFile("http/example.com/warnings/warnings_202405071210.txt",
+                "future",
+                kStartTime_ + 10min);
+
+      clock_ = std::make_shared<util::clock::ReplayClock>(kStartTime_);
+      clock_->Pause();
+      util::clock::SetReplayClock(clock_);
+
+      transport_ = std::make_shared<ReplayTransport>(root_);
+   }
+
+   void TearDown() override
+   {
+      SetTransport(nullptr);
+      util::clock::SetReplayClock(nullptr);
+      std::filesystem::remove_all(root_);
+   }
+
+   void WriteFile(const std::string&                    relativePath,
+                  const std::string&                    contents,
+                  std::chrono::system_clock::time_point lastModified)
+   {
+      const std::filesystem::path path = root_ / relativePath;
+      std::filesystem::create_directories(path.parent_path());
+
+      {
+         std::ofstream file {path, std::ios_base::binary};
+         file << contents;
+      }
+
+#if (__cpp_lib_chrono >= 201907L)
+      std::filesystem::last_write_time(
+         path, std::chrono::clock_cast<std::chrono::file_clock>(lastModified));
+#else
+      std::filesystem::last_write_time(
+         path, std::chrono::file_clock::from_sys(lastModified));
+#endif
+   }
+
+   std::filesystem::path                     root_ {};
+   std::shared_ptr<util::clock::ReplayClock> clock_ {nullptr};
+   std::shared_ptr<ReplayTransport>          transport_ {nullptr};
+};
+
+TEST_F(ReplayTransportTest, ListObjectsHidesFutureObjects)
+{
+   auto store   = transport_->OpenObjectStore("bucket", "us-east-1");
+   auto listing = store->ListObjects("2024/05/07/KLSX/");
+
+   ASSERT_TRUE(listing.has_value());
+   ASSERT_EQ(listing->objects_.size(), 1u);
+   EXPECT_EQ(listing->objects_[0].key_,
+             "2024/05/07/KLSX/KLSX20240507_115500_V06");
+   EXPECT_EQ(listing->objects_[0].size_, 5u);
+   EXPECT_EQ(listing->objects_[0].lastModified_, kStartTime_ - 5min);
+
+   clock_->Advance(10min);
+
+   listing = store->ListObjects("2024/05/07/KLSX/");
+
+   ASSERT_TRUE(listing.has_value());
+   ASSERT_EQ(listing->objects_.size(), 2u);
+   EXPECT_EQ(listing->objects_[1].key_,
+             "2024/05/07/KLSX/KLSX20240507_120500_V06");
+}
+
+TEST_F(ReplayTransportTest, ListObjectsPartialPrefix)
+{
+   auto store   = transport_->OpenObjectStore("bucket", "us-east-1");
+   auto listing = store->ListObjects("2024/05/07/KT");
+
+   ASSERT_TRUE(listing.has_value());
+   ASSERT_EQ(listing->objects_.size(), 1u);
+   EXPECT_EQ(listing->objects_[0].key_,
+             "2024/05/07/KTLX/KTLX20240507_115000_V06");
+}
+
+TEST_F(ReplayTransportTest, ListObjectsDelimiter)
+{
+   auto store   = transport_->OpenObjectStore("bucket", "us-east-1");
+   auto listing = store->ListObjects("2024/05/07/", "/");
+
+   ASSERT_TRUE(listing.has_value());
+   EXPECT_TRUE(listing->objects_.empty());
+   EXPECT_EQ(listing->commonPrefixes_,
+             (std::vector<std::string> {"2024/05/07/KLSX/",
+                                        "2024/05/07/KTLX/"}));
+}
+
+TEST_F(ReplayTransportTest, ListObjectsRejectsParentPath)
+{
+   auto store   = transport_->OpenObjectStore("bucket", "us-east-1");
+   auto listing = store->ListObjects("../bucket/2024/");
+
+   ASSERT_TRUE(listing.has_value());
+   EXPECT_TRUE(listing->objects_.empty());
+}
+
+TEST_F(ReplayTransportTest, GetObject)
+{
+   auto store = transport_->OpenObjectStore("bucket", "us-east-1");
+   auto data  = store->GetObject("2024/05/07/KLSX/KLSX20240507_115500_V06");
+
+   ASSERT_TRUE(data.has_value());
+   ASSERT_NE(data->body_, nullptr);
+   EXPECT_EQ(data->size_, 5u);
+
+   std::ostringstream contents {};
+   contents << data->body_->rdbuf();
+   EXPECT_EQ(contents.str(), "early");
+
+   EXPECT_FALSE(
+      store->GetObject("2024/05/07/KLSX/KLSX20240507_120500_V06").has_value());
+   EXPECT_FALSE(store->GetObject("2024/05/07/KLSX/missing").has_value());
+}
+
+TEST_F(ReplayTransportTest, GetObjectStream)
+{
+   auto store = transport_->OpenObjectStore("bucket", "us-east-1");
+
+   const std::string key {"2024/05/07/KLSX/KLSX20240507_115500_V06"};
+   std::string       contents {};
+
+   auto write = [&contents](std::string_view data)
+   {
+      contents.append(data);
+      return true;
+   };
+
+   EXPECT_TRUE(store->GetObjectStream(key, write));
+   EXPECT_EQ(contents, "early");
+
+   contents.clear();
+   EXPECT_TRUE(store->GetObjectStream(key, write, 1u, 3u));
+   EXPECT_EQ(contents, "arl");
+
+   contents.clear();
+   EXPECT_TRUE(store->GetObjectStream(key, write, 2u));
+   EXPECT_EQ(contents, "rly");
+
+   // Requested range extends beyond the object
+   EXPECT_FALSE(store->GetObjectStream(key, write, 3u, 5u));
+
+   // Aborted by the write function
+   EXPECT_FALSE(store->GetObjectStream(
+      key, [](std::string_view) { return false; }));
+
+   EXPECT_FALSE(store->GetObjectStream(
+      "2024/05/07/KLSX/KLSX20240507_120500_V06", write));
+}
+
+TEST_F(ReplayTransportTest, GetFile)
+{
+   auto response = transport_->Get(
+      "https://example.com/warnings/warnings_202405071150.txt?ignored=1");
+
+   EXPECT_EQ(response.statusCode_, 200);
+   EXPECT_EQ(response.text_, "warning");
+
+   response =
+      transport_->Get("https://example.com/warnings/warnings_202405071210.txt");
+
+   EXPECT_EQ(response.statusCode_, 404);
+   EXPECT_FALSE(response.error_.empty());
+
+   response = transport_->Get("https://example.com/../s3/bucket");
+
+   EXPECT_EQ(response.statusCode_, 400);
+}
+
+TEST_F(ReplayTransportTest, DirList)
+{
+   SetTransport(transport_);
+
+   auto records = network::DirList("https://example.com/warnings/");
+
+   ASSERT_EQ(records.size(), 1u);
+   EXPECT_EQ(records[0].filename_, "warnings_202405071150.txt");
+   EXPECT_EQ(records[0].type_, std::filesystem::file_type::regular);
+   EXPECT_EQ(records[0].mtime_, kStartTime_ - 10min);
+
+   clock_->Advance(15min);
+
+   records = network::DirList("https://example.com/warnings/");
+
+   ASSERT_EQ(records.size(), 2u);
+   EXPECT_EQ(records[1].filename_, "warnings_202405071210.txt");
+}
+
+TEST_F(ReplayTransportTest, ConditionalGet)
+{
+   const std::string url {"https://example.com/warnings/"};
+
+   auto response = transport_->Get(url);
+
+   ASSERT_EQ(response.statusCode_, 200);
+   ASSERT_TRUE(response.header_.contains("ETag"));
+   ASSERT_TRUE(response.header_.contains("Last-Modified"));
+   EXPECT_EQ(response.header_["Last-Modified"],
+             "Tue, 07 May 2024 11:50:00 GMT");
+
+   const std::string eTag         = response.header_["ETag"];
+   const std::string lastModified = response.header_["Last-Modified"];
+
+   response = transport_->Get(url, {{"If-None-Match", eTag}});
+   EXPECT_EQ(response.statusCode_, 304);
+   EXPECT_TRUE(response.text_.empty());
+
+   response = transport_->Get(url, {{"If-Modified-Since", lastModified}});
+   EXPECT_EQ(response.statusCode_, 304);
+
+   response = transport_->Get(
+      url, {{"If-Modified-Since", "Tue, 07 May 2024 11:49:59 GMT"}});
+   EXPECT_EQ(response.statusCode_, 200);
+
+   // Revealing a file modifies the listing
+   clock_->Advance(15min);
+
+   response = transport_->Get(url, {{"If-None-Match", eTag}});
+   EXPECT_EQ(response.statusCode_, 200);
+   EXPECT_NE(response.header_["ETag"], eTag);
+
+   response = transport_->Get(url, {{"If-Modified-Since", lastModified}});
+   EXPECT_EQ(response.statusCode_, 200);
+   EXPECT_EQ(response.header_["Last-Modified"],
+             "Tue, 07 May 2024 12:10:00 GMT");
+
+   response = transport_->Get(url + "warnings_202405071150.txt",
+                              {{"If-Modified-Since", lastModified}});
+   EXPECT_EQ(response.statusCode_, 304);
+}
+
+} // namespace network
+} // namespace scwx
@@ -0,0 +1,232 @@
+#include <scwx/network/transport.hpp>
+#include <scwx/network/dir_list.hpp>
+
+#include <atomic>
+#include <thread>
+
+#include <boost/asio.hpp>
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace network
+{
+
+static const std::string kListingPath_ {"/listing/"};
+static const std::string kETag_ {"\"1\""};
+
+static constexpr std::size_t kChunkSize_ = 64u;
+
+/**
+ * HTTP/1.1 server on the loopback interface, serving a directory listing with
+ * chunked transfer encoding, so responses pass through the network transport.
+ */
+class LoopbackServer
+{
+public:
+   explicit LoopbackServer()
+   {
+      for (int i = 0; i < 100; ++i)
+      {
+         listing_ += fmt::format("<a href=\"file_{0}.txt\">file_{0}.txt</a>\n",
+                                 i);
+      }
+
+      acceptor_.open(boost::asio::ip::tcp::v4());
+      acceptor_.bind({boost::asio::ip::address_v4::loopback(), 0});
+      acceptor_.listen();
+
+      Accept();
+      thread_ = std::thread {[this]() { context_.run(); }};
+   }
+   ~LoopbackServer()
+   {
+      context_.stop();
+      thread_.join();
+   }
+
+   LoopbackServer(const LoopbackServer&)            = delete;
+   LoopbackServer& operator=(const LoopbackServer&) = delete;
+
+   std::string url(const std::string& path) const
+   {
+      return fmt::format(
+         "http://127.0.0.1:{}{}", acceptor_.local_endpoint().port(), path);
+   }
+
+   std::string              listing_ {};
+   std::atomic<std::size_t> requestCount_ {0u};
+   std::atomic<bool>        conditionalRequest_ {false};
+
+private:
+   void Accept()
+   {
+      acceptor_.async_accept(
+         [this](const boost::system::error_code&  error,
+                boost::asio::ip::tcp::socket socket)
+         {
+            if (!error)
+            {
+               Respond(socket);
+               Accept();
+            }
+         });
+   }
+
+   void Respond(boost::asio::ip::tcp::socket& socket)
+   {
+      boost::system::error_code error {};
+      std::string               request {};
+
+      boost::asio::read_until(
+         socket, boost::asio::dynamic_buffer(request), "\r\n\r\n", error);
+      if (error)
+      {
+         return;
+      }
+
+      ++requestCount_;
+
+      const std::string path =
+         request.substr(4, request.find(' ', 4) - 4); // "GET <path> HTTP/1.1"
+      conditionalRequest_ =
+         request.find("If-None-Match: " + kETag_) != std::string::npos;
+
+      std::string response {};
+
+      if (path != kListingPath_)
+      {
+         // The error body is not written to the caller
+         const std::string body {"<html><body>Not Found</body></html>"};
+         response = fmt::format("HTTP/1.1 404 Not Found\r\n"
+                                "Content-Length: {}\r\n"
+                                "Connection: close\r\n"
+                                "\r\n"
+                                "{}",
+                                body.size(),
+                                body);
+      }
+      else if (conditionalRequest_)
+      {
+         response = fmt::format("HTTP/1.1 304 Not Modified\r\n"
+                                "ETag: {}\r\n"
+                                "Connection: close\r\n"
+                                "\r\n",
+                                kETag_);
+      }
+      else
+      {
+         response = fmt::format("HTTP/1.1 200 OK\r\n"
+                                "ETag: {}\r\n"
+                                "Transfer-Encoding: chunked\r\n"
+                                "Connection: close\r\n"
+                                "\r\n",
+                                kETag_);
+
+         for (std::size_t i = 0; i < listing_.size(); i += kChunkSize_)
+         {
+            const std::string_view chunk =
+               std::string_view {listing_}.substr(i, kChunkSize_);
+            response += fmt::format("{:x}\r\n{}\r\n", chunk.size(), chunk);
+         }
+         response += "0\r\n\r\n";
+      }
+
+      boost::asio::write(socket, boost::asio::buffer(response), error);
+      socket.shutdown(boost::asio::ip::tcp::socket::shutdown_both, error);
+   }
+
+   boost::asio::io_context        context_ {};
+   boost::asio::ip::tcp::acceptor acceptor_ {context_};
+   std::thread                    thread_ {};
+};
+
+class NetworkTransportTest : public testing::Test
+{
+protected:
+   void SetUp() override
+   {
+      // Use the default network transport
+      SetTransport(nullptr);
+      server_ = std::make_unique<LoopbackServer>();
+   }
+
+   void TearDown() override { server_.reset(); }
+
+   std::unique_ptr<LoopbackServer> server_ {};
+};
+
+TEST_F(NetworkTransportTest, GetStream)
+{
+   std::string body {};
+   std::size_t writeCount = 0u;
+
+   HttpResponse response = GetTransport()->GetStream(
+      server_->url(kListingPath_),
+      [&](std::string_view data)
+      {
+         body.append(data);
+         ++writeCount;
+         return true;
+      });
+
+   EXPECT_EQ(response.statusCode_, 200);
+   EXPECT_EQ(response.header_["ETag"], kETag_);
+   EXPECT_TRUE(response.text_.empty());
+   EXPECT_EQ(body, server_->listing_);
+   EXPECT_GT(writeCount, 0u);
+}
+
+TEST_F(NetworkTransportTest, GetStreamError)
+{
+   std::string body {};
+
+   HttpResponse response = GetTransport()->GetStream(
+      server_->url("/missing"),
+      [&](std::string_view data)
+      {
+         body.append(data);
+         return true;
+      });
+
+   EXPECT_EQ(response.statusCode_, 404);
+   EXPECT_FALSE(response.error_.empty());
+   EXPECT_TRUE(body.empty());
+}
+
+TEST_F(NetworkTransportTest, GetStreamAbort)
+{
+   std::size_t writeCount = 0u;
+
+   GetTransport()->GetStream(server_->url(kListingPath_),
+                             [&](std::string_view /* data */)
+                             {
+                                ++writeCount;
+                                return false;
+                             });
+
+   // The transfer ends after the first write
+   EXPECT_EQ(writeCount, 1u);
+}
+
+TEST_F(NetworkTransportTest, DirListNotModified)
+{
+   const std::string url = server_->url(kListingPath_);
+
+   auto records = DirList(url);
+   ASSERT_EQ(records.size(), 100u);
+   EXPECT_EQ(records.front().filename_, "file_0.txt");
+   EXPECT_EQ(records.back().filename_, "file_99.txt");
+   EXPECT_FALSE(server_->conditionalRequest_);
+
+   // The second request is conditional, and returns the cached records
+   auto cachedRecords = DirList(url);
+   EXPECT_EQ(server_->requestCount_, 2u);
+   EXPECT_TRUE(server_->conditionalRequest_);
+   ASSERT_EQ(cachedRecords.size(), records.size());
+   EXPECT_EQ(cachedRecords.back().filename_, "file_99.txt");
+}
+
+} // namespace network
+} // namespace scwx
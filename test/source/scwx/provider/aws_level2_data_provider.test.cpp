@@ -1,4 +1,10 @@
 #include <scwx/provider/aws_level2_data_provider.hpp>
+#include <scwx/network/transport.hpp>
+#include <scwx/wsr88d/ar2v_file.hpp>
+
+#include <atomic>
+#include <fstream>
+#include <sstream>
 
 #include <gtest/gtest.h>
 
@@ -7,6 +13,104 @@ namespace scwx
 namespace provider
 {
 
+static const std::string kObjectKey_ {
+   "2021/05/27/KLSX/KLSX20210527_175717_V06"};
+static const std::string kObjectFile_ {
+   "/nexrad/level2/Level2_KLSX_20210527_1757.ar2v"};
+
+/**
+ * Object store containing a single object, where the first requests fail after
+ * writing half of the requested bytes
+ */
+class InterruptedObjectStore : public network::ObjectStore
+{
+public:
+   explicit InterruptedObjectStore(const std::string& data, int failures) :
+       failures_ {failures}, data_ {data}
+   {
+   }
+
+   std::optional<network::ObjectListing>
+   ListObjects(const std::string& prefix, const std::string&) override
+   {
+      network::ObjectListing listing {};
+
+      if (kObjectKey_.starts_with(prefix))
+      {
+         listing.objects_.push_back({kObjectKey_, {}, data_.size()});
+      }
+
+      return listing;
+   }
+
+   std::optional<network::ObjectData> GetObject(const std::string&) override
+   {
+      return std::nullopt;
+   }
+
+   bool GetObjectStream(const std::string&            key,
+                        const network::WriteFunction& write,
+                        std::size_t                   offset,
+                        std::size_t                   length) override
+   {
+      if (key != kObjectKey_ || offset >= data_.size())
+      {
+         return false;
+      }
+
+      std::string_view range = std::string_view {data_}.substr(
+         offset, (length > 0u) ? length : std::string_view::npos);
+      const bool interrupted = (failures_-- > 0);
+
+      if (interrupted)
+      {
+         range = range.substr(0, range.size() / 2);
+      }
+
+      for (std::size_t i = 0; i < range.size(); i += kChunkSize_)
+      {
+         if (!write(range.substr(i, kChunkSize_)))
+         {
+            return false;
+         }
+      }
+
+      return !interrupted && (length == 0u || range.size() == length);
+   }
+
+   std::atomic<int> failures_;
+
+private:
+   static constexpr std::size_t kChunkSize_ = 16u * 1024u;
+
+   const std::string& data_;
+};
+
+class InterruptedTransport : public network::Transport
+{
+public:
+   explicit InterruptedTransport(std::shared_ptr<network::ObjectStore> store) :
+       store_ {std::move(store)}
+   {
+   }
+
+   std::shared_ptr<network::ObjectStore>
+   OpenObjectStore(const std::string&, const std::string&) override
+   {
+      return store_;
+   }
+
+   network::HttpResponse Get(const std::string&,
+                             const ::cpr::Header&,
+                             const ::cpr::Parameters&) override
+   {
+      return {};
+   }
+
+private:
+   std::shared_ptr<network::ObjectStore> store_;
+};
+
 TEST(AwsLevel2DataProvider, FindKeyFixed)
 {
    using namespace std::chrono;
@@ -121,5 +225,74 @@ TEST(AwsLevel2DataProvider, TimePointBadKey)
    EXPECT_EQ(time, expectedTime);
 }
 
+class AwsLevel2DataProviderResumeTest :
+    public testing::TestWithParam<std::pair<std::size_t, int>>
+{
+protected:
+   void TearDown() override { network::SetTransport(nullptr); }
+};
+
+TEST_P(AwsLevel2DataProviderResumeTest, LoadObjectByKey)
+{
+   using namespace std::chrono;
+   using sys_days = time_point<system_clock, days>;
+
+   auto& [rangeCount, failures] = GetParam();
+
+   std::ifstream      f {std::string(SCWX_TEST_DATA_DIR) + kObjectFile_,
+                    std::ios_base::binary};
+   std::ostringstream data {};
+   data << f.rdbuf();
+   const std::string objectData = data.str();
+
+   wsr88d::Ar2vFile expectedFile {};
+   ASSERT_TRUE(
+      expectedFile.LoadFile(std::string(SCWX_TEST_DATA_DIR) + kObjectFile_));
+
+   auto store =
+      std::make_shared<InterruptedObjectStore>(objectData, failures);
+   network::SetTransport(std::make_shared<InterruptedTransport>(store));
+
+   AwsLevel2DataProvider provider("KLSX");
+   provider.SetRangeRequestCount(rangeCount);
+   provider.ListObjects(sys_days {2021y / May / 27d});
+
+   // Each interrupted request is resumed, without repeating the bytes which
+   // were already received
+   auto file = std::dynamic_pointer_cast<wsr88d::Ar2vFile>(
+      provider.LoadObjectByKey(kObjectKey_));
+
+   ASSERT_NE(file, nullptr);
+   EXPECT_EQ(file->message_count(), expectedFile.message_count());
+   EXPECT_EQ(file->end_time(), expectedFile.end_time());
+   EXPECT_LE(store->failures_.load(), 0);
+}
+
+TEST(AwsLevel2DataProvider, LoadObjectByKeyInterrupted)
+{
+   std::ifstream      f {std::string(SCWX_TEST_DATA_DIR) + kObjectFile_,
+                    std::ios_base::binary};
+   std::ostringstream data {};
+   data << f.rdbuf();
+   const std::string objectData = data.str();
+
+   // Every request is interrupted
+   auto store = std::make_shared<InterruptedObjectStore>(objectData, 1000);
+   network::SetTransport(std::make_shared<InterruptedTransport>(store));
+
+   AwsLevel2DataProvider provider("KLSX");
+   provider.SetRangeRequestCount(1u);
+
+   EXPECT_EQ(provider.LoadObjectByKey(kObjectKey_), nullptr);
+
+   network::SetTransport(nullptr);
+}
+
+INSTANTIATE_TEST_SUITE_P(AwsLevel2DataProvider,
+                         AwsLevel2DataProviderResumeTest,
+                         testing::Values(std::pair<std::size_t, int> {1u, 1},
+                                         std::pair<std::size_t, int> {1u, 2},
+                                         std::pair<std::size_t, int> {4u, 2}));
+
 } // namespace provider
 } // namespace scwx
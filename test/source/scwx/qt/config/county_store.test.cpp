@@ -0,0 +1,127 @@
+#include <scwx/qt/config/county_store.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace config
+{
+
+typedef std::vector<std::pair<std::string, std::string>> Rows;
+
+// Builds a store in the format written by tools/generate_counties_db.py
+static std::string BuildStore(Rows counties, Rows states, Rows wfos)
+{
+   std::string pool {};
+   std::string tables {};
+
+   auto Append = [](std::string& buffer, auto value)
+   {
+      // Test data is written in native byte order, assumed little endian
+      char bytes[sizeof(value)];
+      std::memcpy(bytes, &value, sizeof(value));
+      buffer.append(bytes, sizeof(value));
+   };
+
+   for (Rows* rows : {&counties, &states, &wfos})
+   {
+      std::sort(rows->begin(), rows->end());
+
+      for (auto& [key, value] : *rows)
+      {
+         Append(tables, static_cast<std::uint32_t>(pool.size()));
+         Append(tables, static_cast<std::uint32_t>(pool.size() + key.size()));
+         Append(tables, static_cast<std::uint16_t>(key.size()));
+         Append(tables, static_cast<std::uint16_t>(value.size()));
+         pool += key;
+         pool += value;
+      }
+   }
+
+   std::string store {CountyStore::kMagic_};
+   Append(store, static_cast<std::uint32_t>(counties.size()));
+   Append(store, static_cast<std::uint32_t>(states.size()));
+   Append(store, static_cast<std::uint32_t>(wfos.size()));
+   Append(store, static_cast<std::uint32_t>(pool.size()));
+
+   return store + tables + pool;
+}
+
+static const std::string kStore_ =
+   BuildStore({{"MOC183", "St. Charles"},
+               {"MOC189", "St. Louis"},
+               {"MOZ061", "St. Louis"},
+               {"MOC001", "Adair"},
+               {"MNC001", "Aitkin"},
+               {"TXZ211", "Austin"},
+               {"AZC013", "Maricopa"}},
+              {{"MO", "Missouri"}, {"AZ", "Arizona"}},
+              {{"KLSX", "St. Louis, MO"}});
+
+TEST(CountyStoreTest, FindCounty)
+{
+   CountyStore store {kStore_};
+
+   ASSERT_FALSE(store.empty());
+   EXPECT_EQ(store.county_count(), 7u);
+   EXPECT_EQ(store.FindCounty("MOC183"), "St. Charles");
+   EXPECT_EQ(store.FindCounty("TXZ211"), "Austin");
+   EXPECT_EQ(store.FindCounty("AZC013"), "Maricopa");
+   EXPECT_EQ(store.FindCounty("MOC184"), std::nullopt);
+   EXPECT_EQ(store.FindCounty(""), std::nullopt);
+   EXPECT_EQ(store.FindCounty("ZZZ999"), std::nullopt);
+}
+
+TEST(CountyStoreTest, GetCounties)
+{
+   CountyStore store {kStore_};
+
+   auto counties = store.GetCounties("MO");
+   ASSERT_EQ(counties.size(), 3u);
+   EXPECT_EQ(counties[0].first, "MOC001");
+   EXPECT_EQ(counties[1].second, "St. Charles");
+   EXPECT_EQ(counties[2].first, "MOC189");
+
+   // Zones are excluded
+   EXPECT_TRUE(store.GetCounties("TX").empty());
+   EXPECT_TRUE(store.GetCounties("GM").empty());
+   EXPECT_TRUE(store.GetCounties("M").empty());
+}
+
+TEST(CountyStoreTest, StatesAndWfos)
+{
+   CountyStore store {kStore_};
+
+   EXPECT_EQ(store.FindState("MO"), "Missouri");
+   EXPECT_EQ(store.FindState("TX"), std::nullopt);
+   EXPECT_EQ(store.FindWfo("KLSX"), "St. Louis, MO");
+
+   std::vector<std::string> states {};
+   store.ForEachState([&](const CountyStore::Entry& entry)
+                      { states.emplace_back(entry.first); });
+   EXPECT_EQ(states, (std::vector<std::string> {"AZ", "MO"}));
+}
+
+TEST(CountyStoreTest, InvalidStore)
+{
+   EXPECT_TRUE(CountyStore {}.empty());
+   EXPECT_TRUE(CountyStore {"SCWXCTY1"}.empty());
+
+   // Truncated
+   EXPECT_TRUE(CountyStore {kStore_.substr(0, kStore_.size() - 1)}.empty());
+
+   // String reference outside of the string pool
+   std::string invalid = BuildStore({{"MOC183", "St. Charles"}}, {}, {});
+   invalid[24]         = 0x7f;
+   EXPECT_TRUE(CountyStore {invalid}.empty());
+}
+
+} // namespace config
+} // namespace qt
+} // namespace scwx
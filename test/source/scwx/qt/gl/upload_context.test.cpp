@@ -0,0 +1,191 @@
+#include <scwx/qt/gl/upload_context.hpp>
+
+#include <array>
+#include <chrono>
+#include <numeric>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <QGuiApplication>
+#include <QOffscreenSurface>
+#include <QOpenGLContext>
+
+namespace scwx
+{
+namespace qt
+{
+namespace gl
+{
+
+class UploadContextTest : public testing::Test
+{
+protected:
+   void SetUp() override
+   {
+      // Run without a display unless a platform has been specified, such as
+      // xcb when testing with Mesa llvmpipe under Xvfb
+      if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM"))
+      {
+         qputenv("QT_QPA_PLATFORM", "offscreen");
+      }
+
+      application_ = std::make_unique<QGuiApplication>(argc_, argv_.data());
+
+      QSurfaceFormat format {};
+      format.setVersion(3, 3);
+      format.setProfile(QSurfaceFormat::OpenGLContextProfile::CoreProfile);
+
+      surface_ = std::make_unique<QOffscreenSurface>();
+      surface_->setFormat(format);
+      surface_->create();
+
+      context_ = std::make_unique<QOpenGLContext>();
+      context_->setFormat(format);
+
+      if (!surface_->isValid() || !context_->create() ||
+          !context_->makeCurrent(surface_.get()) ||
+          context_->format().version() < qMakePair(3, 3))
+      {
+         GTEST_SKIP() << "OpenGL 3.3 is not available";
+      }
+
+      gl_.initializeOpenGLFunctions();
+   }
+
+   void TearDown() override
+   {
+      if (context_ != nullptr)
+      {
+         context_->doneCurrent();
+      }
+
+      context_.reset();
+      surface_.reset();
+      application_.reset();
+   }
+
+   int                  argc_ {1};
+   std::array<char*, 2> argv_ {const_cast<char*>("wxtest"), nullptr};
+
+   std::unique_ptr<QGuiApplication>   application_ {};
+   std::unique_ptr<QOffscreenSurface> surface_ {};
+   std::unique_ptr<QOpenGLContext>    context_ {};
+   gl::OpenGLFunctions                gl_ {};
+};
+
+TEST_F(UploadContextTest, Upload)
+{
+   UploadContext uploadContext {context_.get()};
+   ASSERT_TRUE(uploadContext.IsValid());
+
+   // 4 MB of data, approximately the size of the data moments of a Super
+   // Resolution sweep
+   std::vector<std::uint32_t> data(1024 * 1024);
+   std::iota(data.begin(), data.end(), 0u);
+
+   GLuint buffer = GL_INVALID_INDEX;
+   gl_.glGenBuffers(1, &buffer);
+
+   GLsync            fence  = nullptr;
+   std::future<bool> future = uploadContext.Post(
+      [&](gl::OpenGLFunctions& gl)
+      {
+         gl.glBindBuffer(GL_ARRAY_BUFFER, buffer);
+         gl.glBufferData(GL_ARRAY_BUFFER,
+                         data.size() * sizeof(std::uint32_t),
+                         data.data(),
+                         GL_STATIC_DRAW);
+         gl.glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+         fence = gl.glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+         gl.glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1'000'000'000u);
+      });
+
+   ASSERT_TRUE(future.get());
+   ASSERT_NE(fence, nullptr);
+
+   // The fence is visible to the render context, and signaled
+   GLint status = GL_UNSIGNALED;
+   gl_.glGetSynciv(fence, GL_SYNC_STATUS, 1, nullptr, &status);
+   EXPECT_EQ(status, GL_SIGNALED);
+   gl_.glDeleteSync(fence);
+
+   // The buffer contents are visible once the buffer is bound
+   std::vector<std::uint32_t> result(data.size());
+   gl_.glBindBuffer(GL_ARRAY_BUFFER, buffer);
+   gl_.glGetBufferSubData(GL_ARRAY_BUFFER,
+                          0,
+                          result.size() * sizeof(std::uint32_t),
+                          result.data());
+   gl_.glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+   EXPECT_EQ(result, data);
+   EXPECT_EQ(gl_.glGetError(), GL_NO_ERROR);
+
+   gl_.glDeleteBuffers(1, &buffer);
+}
+
+TEST_F(UploadContextTest, Order)
+{
+   UploadContext uploadContext {context_.get()};
+   ASSERT_TRUE(uploadContext.IsValid());
+
+   std::vector<int>               order {};
+   std::vector<std::future<bool>> futures {};
+
+   for (int i = 0; i < 10; ++i)
+   {
+      futures.push_back(uploadContext.Post([&order, i](gl::OpenGLFunctions&)
+                                           { order.push_back(i); }));
+   }
+
+   for (auto& future : futures)
+   {
+      EXPECT_TRUE(future.get());
+   }
+
+   EXPECT_EQ(order, std::vector<int>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+}
+
+TEST_F(UploadContextTest, TaskCompleted)
+{
+   UploadContext uploadContext {context_.get()};
+   ASSERT_TRUE(uploadContext.IsValid());
+
+   int completed = 0;
+   QObject::connect(&uploadContext,
+                    &UploadContext::TaskCompleted,
+                    application_.get(),
+                    [&completed]() { ++completed; });
+
+   EXPECT_TRUE(uploadContext.Post([](gl::OpenGLFunctions&) {}).get());
+
+   // The signal is delivered to the receiver's thread
+   const auto deadline =
+      std::chrono::steady_clock::now() + std::chrono::seconds(5);
+   while (completed == 0 && std::chrono::steady_clock::now() < deadline)
+   {
+      QCoreApplication::processEvents();
+   }
+
+   EXPECT_EQ(completed, 1);
+}
+
+TEST_F(UploadContextTest, NoShareContext)
+{
+   UploadContext uploadContext {nullptr};
+   EXPECT_FALSE(uploadContext.IsValid());
+
+   bool              executed = false;
+   std::future<bool> future   = uploadContext.Post(
+      [&executed](gl::OpenGLFunctions&) { executed = true; });
+
+   ASSERT_EQ(future.wait_for(std::chrono::seconds(0)),
+             std::future_status::ready);
+   EXPECT_FALSE(future.get());
+   EXPECT_FALSE(executed);
+}
+
+} // namespace gl
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,177 @@
+#include <scwx/qt/map/overlay_geometry.hpp>
+#include <scwx/qt/types/radar_product_record.hpp>
+#include <scwx/qt/util/geographic_lib.hpp>
+#include <scwx/wsr88d/level3_file.hpp>
+#include <scwx/wsr88d/rpg/graphic_product_message.hpp>
+#include <scwx/wsr88d/rpg/linked_vector_packet.hpp>
+#include <scwx/wsr88d/rpg/rpg_types.hpp>
+#include <scwx/wsr88d/rpg/scit_data_packet.hpp>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace map
+{
+
+static const std::string kStormTrackingFile_ {
+   "/nexrad/level3/KLSX_SDUS33_NSTLSX_202112110215"};
+static const std::string kStormStructureFile_ {
+   "/nexrad/level3/KLSX_SDUS63_NSSLSX_202112110140"};
+
+static const common::Coordinate kCenter_ {38.6986, -90.6828};
+
+static std::shared_ptr<wsr88d::Level3File> LoadFile(const std::string& path)
+{
+   auto file = std::make_shared<wsr88d::Level3File>();
+   if (!file->LoadFile(std::string(SCWX_TEST_DATA_DIR) + path))
+   {
+      file.reset();
+   }
+   return file;
+}
+
+static void ExpectCoordinateEq(const common::Coordinate& actual,
+                               const common::Coordinate& expected)
+{
+   EXPECT_DOUBLE_EQ(actual.latitude_, expected.latitude_);
+   EXPECT_DOUBLE_EQ(actual.longitude_, expected.longitude_);
+}
+
+TEST(OverlayGeometry, StormTracking)
+{
+   auto file = LoadFile(kStormTrackingFile_);
+   ASSERT_NE(file, nullptr);
+
+   OverlayGeometry geometry {file->message(), kCenter_};
+
+   auto message = std::dynamic_pointer_cast<wsr88d::rpg::GraphicProductMessage>(
+      file->message());
+   ASSERT_NE(message, nullptr);
+   auto symbologyBlock = message->symbology_block();
+   ASSERT_NE(symbologyBlock, nullptr);
+
+   // Each linked vector in a SCIT data packet is a storm track
+   const auto& vectors = geometry.vectors();
+   std::size_t v       = 0u;
+
+   for (std::uint16_t i = 0; i < symbologyBlock->number_of_layers(); ++i)
+   {
+      for (auto& packet : symbologyBlock->packet_list(i))
+      {
+         auto scitDataPacket =
+            std::dynamic_pointer_cast<wsr88d::rpg::ScitDataPacket>(packet);
+         if (scitDataPacket == nullptr)
+         {
+            continue;
+         }
+
+         const OverlayGeometry::VectorType type =
+            (scitDataPacket->packet_code() ==
+             static_cast<std::uint16_t>(
+                wsr88d::rpg::PacketCode::ScitPastData)) ?
+               OverlayGeometry::VectorType::StormTrackPast :
+               OverlayGeometry::VectorType::StormTrackForecast;
+
+         for (const wsr88d::rpg::Packet* subpacket :
+              scitDataPacket->packet_list())
+         {
+            if (subpacket->packet_code() !=
+                static_cast<std::uint16_t>(
+                   wsr88d::rpg::PacketCode::LinkedVectorNoValue))
+            {
+               continue;
+            }
+
+            auto linkedVectorPacket =
+               dynamic_cast<const wsr88d::rpg::LinkedVectorPacket*>(
+                  subpacket);
+            ASSERT_NE(linkedVectorPacket, nullptr);
+
+            ASSERT_LT(v, vectors.size());
+            const OverlayGeometry::Vector& vector = vectors[v++];
+
+            EXPECT_EQ(vector.type_, type);
+            EXPECT_EQ(vector.hoverText_.rfind("Storm ID: ", 0), 0u);
+            ASSERT_NE(vector.geometry_, nullptr);
+
+            const auto& coordinates = vector.geometry_->coordinates_;
+            const auto  endI        = linkedVectorPacket->end_i_km();
+            const auto  endJ        = linkedVectorPacket->end_j_km();
+
+            // One vertex for the start of the track, and one for each end
+            ASSERT_EQ(coordinates.size(), endI.size() + 1u);
+            EXPECT_EQ(vector.geometry_->ticks_.size(), endI.size());
+
+            ExpectCoordinateEq(coordinates.front(),
+                               util::GeographicLib::GetCoordinate(
+                                  kCenter_,
+                                  linkedVectorPacket->start_i_km(),
+                                  linkedVectorPacket->start_j_km()));
+            ExpectCoordinateEq(
+               coordinates.back(),
+               util::GeographicLib::GetCoordinate(
+                  kCenter_, endI.back(), endJ.back()));
+
+            // Storm tracks are within range of the radar
+            for (const common::Coordinate& coordinate : coordinates)
+            {
+               auto distance =
+                  util::GeographicLib::GetDistance(kCenter_.latitude_,
+                                                   kCenter_.longitude_,
+                                                   coordinate.latitude_,
+                                                   coordinate.longitude_);
+               EXPECT_LT(distance.value(), 500'000.0);
+            }
+         }
+      }
+   }
+
+   EXPECT_GT(v, 0u);
+   EXPECT_EQ(vectors.size(), v);
+}
+
+TEST(OverlayGeometry, NoStormTracking)
+{
+   auto file = LoadFile(kStormStructureFile_);
+   ASSERT_NE(file, nullptr);
+
+   OverlayGeometry geometry {file->message(), kCenter_};
+
+   EXPECT_TRUE(geometry.vectors().empty());
+}
+
+TEST(OverlayGeometry, CachedWithRecord)
+{
+   auto record =
+      types::RadarProductRecord::Create(LoadFile(kStormTrackingFile_));
+   ASSERT_NE(record, nullptr);
+
+   auto geometry = OverlayGeometry::Get(record);
+   ASSERT_NE(geometry, nullptr);
+   EXPECT_FALSE(geometry->vectors().empty());
+
+   // The same record reuses the geometry
+   EXPECT_EQ(OverlayGeometry::Get(record), geometry);
+
+   // A different record of the same product creates its own geometry
+   auto otherRecord =
+      types::RadarProductRecord::Create(LoadFile(kStormTrackingFile_));
+   ASSERT_NE(otherRecord, nullptr);
+
+   auto otherGeometry = OverlayGeometry::Get(otherRecord);
+   ASSERT_NE(otherGeometry, nullptr);
+   EXPECT_NE(otherGeometry, geometry);
+   EXPECT_EQ(otherGeometry->vectors().size(), geometry->vectors().size());
+}
+
+TEST(OverlayGeometry, NoRecord)
+{
+   EXPECT_EQ(OverlayGeometry::Get(nullptr), nullptr);
+}
+
+} // namespace map
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,112 @@
+#include <scwx/qt/util/atlas_packer.hpp>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+static bool Overlaps(const AtlasRegion& a, const AtlasRegion& b)
+{
+   return a.layer_ == b.layer_ &&
+          a.x_ < b.x_ + b.width_ && b.x_ < a.x_ + a.width_ &&
+          a.y_ < b.y_ + b.height_ && b.y_ < a.y_ + a.height_;
+}
+
+TEST(AtlasPackerTest, PlacementsRemainStable)
+{
+   AtlasPacker packer {64, 64, 4};
+
+   auto first = packer.Pack({{16, 16}, {32, 8}});
+   ASSERT_EQ(first.size(), 2u);
+   ASSERT_TRUE(first[0].has_value());
+   ASSERT_TRUE(first[1].has_value());
+   EXPECT_FALSE(Overlaps(*first[0], *first[1]));
+
+   // New rectangles are packed around existing rectangles
+   auto second = packer.Pack({{16, 16}, {8, 8}});
+   ASSERT_EQ(second.size(), 2u);
+
+   for (auto& newRegion : second)
+   {
+      ASSERT_TRUE(newRegion.has_value());
+      EXPECT_EQ(newRegion->layer_, 0u);
+
+      for (auto& oldRegion : first)
+      {
+         EXPECT_FALSE(Overlaps(*newRegion, *oldRegion));
+      }
+   }
+
+   EXPECT_FALSE(Overlaps(*second[0], *second[1]));
+   EXPECT_EQ(packer.layer_count(), 1u);
+   EXPECT_EQ(packer.packed_area(), 16u * 16u + 32u * 8u + 16u * 16u + 8u * 8u);
+}
+
+TEST(AtlasPackerTest, AddsLayers)
+{
+   AtlasPacker packer {64, 64, 2};
+
+   auto regions = packer.Pack({{64, 64}});
+   ASSERT_TRUE(regions[0].has_value());
+   EXPECT_EQ(regions[0]->layer_, 0u);
+
+   regions = packer.Pack({{32, 32}});
+   ASSERT_TRUE(regions[0].has_value());
+   EXPECT_EQ(regions[0]->layer_, 1u);
+   EXPECT_EQ(packer.layer_count(), 2u);
+
+   // Free space in the second layer is used
+   regions = packer.Pack({{32, 32}});
+   ASSERT_TRUE(regions[0].has_value());
+   EXPECT_EQ(regions[0]->layer_, 1u);
+
+   // No more layers may be added
+   regions = packer.Pack({{64, 64}});
+   EXPECT_FALSE(regions[0].has_value());
+   EXPECT_EQ(packer.layer_count(), 2u);
+}
+
+TEST(AtlasPackerTest, RectangleTooLarge)
+{
+   AtlasPacker packer {64, 64, 4};
+
+   auto regions = packer.Pack({{65, 8}, {8, 8}, {0, 8}});
+   ASSERT_EQ(regions.size(), 3u);
+   EXPECT_FALSE(regions[0].has_value());
+   EXPECT_TRUE(regions[1].has_value());
+   EXPECT_FALSE(regions[2].has_value());
+
+   // An empty layer is not retained for a rectangle which does not fit
+   EXPECT_EQ(packer.layer_count(), 1u);
+}
+
+TEST(AtlasPackerTest, Fragmentation)
+{
+   AtlasPacker packer {64, 64, 4};
+
+   auto regions = packer.Pack({{16, 16}, {8, 8}});
+   ASSERT_TRUE(regions[0].has_value());
+
+   packer.Remove(*regions[0]);
+   EXPECT_EQ(packer.packed_area(), 8u * 8u);
+   EXPECT_EQ(packer.fragmented_area(), 16u * 16u);
+
+   // Removed space is not reused
+   auto newRegions = packer.Pack({{16, 16}});
+   ASSERT_TRUE(newRegions[0].has_value());
+   EXPECT_FALSE(Overlaps(*newRegions[0], *regions[0]));
+   EXPECT_FALSE(Overlaps(*newRegions[0], *regions[1]));
+
+   packer.Reset();
+   EXPECT_EQ(packer.layer_count(), 0u);
+   EXPECT_EQ(packer.packed_area(), 0u);
+   EXPECT_EQ(packer.fragmented_area(), 0u);
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,165 @@
+#include <scwx/qt/util/coalescing_cache.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+TEST(CoalescingCacheTest, SharesResult)
+{
+   CoalescingCache<std::string, int> cache {};
+
+   int computeCount = 0;
+
+   auto compute = [&]()
+   {
+      ++computeCount;
+      return std::make_shared<const int>(42);
+   };
+
+   std::shared_ptr<const int> a = cache.GetOrCompute("KLSX", compute);
+   std::shared_ptr<const int> b = cache.GetOrCompute("KLSX", compute);
+
+   ASSERT_NE(a, nullptr);
+   EXPECT_EQ(a, b);
+   EXPECT_EQ(*a, 42);
+   EXPECT_EQ(computeCount, 1);
+   EXPECT_EQ(cache.hits(), 1u);
+   EXPECT_EQ(cache.misses(), 1u);
+   EXPECT_EQ(cache.Find("KLSX"), a);
+   EXPECT_EQ(cache.Find("KTLX"), nullptr);
+}
+
+TEST(CoalescingCacheTest, ReleasesUnreferencedResults)
+{
+   CoalescingCache<int, int> cache {};
+
+   int computeCount = 0;
+
+   auto compute = [&]()
+   {
+      ++computeCount;
+      return std::make_shared<const int>(computeCount);
+   };
+
+   std::shared_ptr<const int> a = cache.GetOrCompute(1, compute);
+   a.reset();
+
+   EXPECT_EQ(cache.Find(1), nullptr);
+
+   // The expired result is recomputed, and the stale entry pruned
+   a = cache.GetOrCompute(1, compute);
+   std::shared_ptr<const int> b = cache.GetOrCompute(2, compute);
+
+   EXPECT_EQ(*a, 2);
+   EXPECT_EQ(*b, 3);
+   EXPECT_EQ(cache.size(), 2u);
+
+   a.reset();
+   std::shared_ptr<const int> c = cache.GetOrCompute(3, compute);
+
+   EXPECT_EQ(cache.size(), 2u);
+   EXPECT_EQ(cache.Find(1), nullptr);
+}
+
+TEST(CoalescingCacheTest, NullResultIsNotCached)
+{
+   CoalescingCache<int, int> cache {};
+
+   int computeCount = 0;
+
+   auto compute = [&]() -> std::shared_ptr<const int>
+   {
+      ++computeCount;
+      return nullptr;
+   };
+
+   EXPECT_EQ(cache.GetOrCompute(1, compute), nullptr);
+   EXPECT_EQ(cache.GetOrCompute(1, compute), nullptr);
+   EXPECT_EQ(computeCount, 2);
+   EXPECT_EQ(cache.size(), 0u);
+}
+
+TEST(CoalescingCacheTest, ExceptionIsPropagated)
+{
+   CoalescingCache<int, int> cache {};
+
+   EXPECT_THROW(cache.GetOrCompute(1,
+                                   []() -> std::shared_ptr<const int>
+                                   { throw std::runtime_error("failed"); }),
+                std::runtime_error);
+
+   // A failed computation does not prevent a later computation
+   std::shared_ptr<const int> a =
+      cache.GetOrCompute(1, []() { return std::make_shared<const int>(1); });
+
+   ASSERT_NE(a, nullptr);
+   EXPECT_EQ(*a, 1);
+}
+
+TEST(CoalescingCacheTest, CoalescesConcurrentRequests)
+{
+   static constexpr std::size_t kThreadCount = 8;
+
+   CoalescingCache<int, int> cache {};
+
+   std::atomic<int>  computeCount {0};
+   std::atomic<bool> release {false};
+
+   auto compute = [&]()
+   {
+      ++computeCount;
+
+      // Hold the computation until all other requests are waiting on it
+      while (!release)
+      {
+         std::this_thread::yield();
+      }
+
+      return std::make_shared<const int>(7);
+   };
+
+   std::vector<std::shared_ptr<const int>> results(kThreadCount);
+   std::vector<std::thread>                threads {};
+
+   for (std::size_t i = 0; i < kThreadCount; ++i)
+   {
+      threads.emplace_back([&, i]()
+                           { results[i] = cache.GetOrCompute(5, compute); });
+   }
+
+   while (cache.misses() + cache.coalesced() < kThreadCount)
+   {
+      std::this_thread::yield();
+   }
+   release = true;
+
+   for (auto& thread : threads)
+   {
+      thread.join();
+   }
+
+   EXPECT_EQ(computeCount, 1);
+   EXPECT_EQ(cache.misses(), 1u);
+   EXPECT_EQ(cache.coalesced(), kThreadCount - 1);
+
+   for (auto& result : results)
+   {
+      ASSERT_NE(result, nullptr);
+      EXPECT_EQ(result, results[0]);
+   }
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
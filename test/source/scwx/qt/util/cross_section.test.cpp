@@ -0,0 +1,183 @@
+#include <scwx/qt/util/cross_section.hpp>
+
+#include <algorithm>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+static const common::Coordinate kSite_ {38.0, -91.0};
+
+// Approximately 100 km east and west of the site
+static const common::Coordinate kEast_ {38.0, -89.8615};
+static const common::Coordinate kWest_ {38.0, -92.1385};
+
+static CrossSectionCut CreateCut(float         elevation,
+                                 std::uint16_t value,
+                                 float         maxAzimuth = 360.0f)
+{
+   CrossSectionCut cut {};
+
+   cut.elevation_      = elevation;
+   cut.firstGateRange_ = 125.0f;
+   cut.gateSpacing_    = 250.0f;
+   cut.gateCount_      = 400; // 100 km
+
+   for (float azimuth = 0.5f; azimuth < maxAzimuth; azimuth += 1.0f)
+   {
+      cut.azimuths_.push_back(azimuth);
+   }
+
+   cut.data_.resize(cut.azimuths_.size() * cut.gateCount_, value);
+
+   return cut;
+}
+
+static std::vector<CrossSectionCut> CreateVolume(float maxAzimuth = 360.0f)
+{
+   // Cuts are intentionally out of order
+   std::vector<CrossSectionCut> cuts {};
+   cuts.push_back(CreateCut(3.0f, 30, maxAzimuth));
+   cuts.push_back(CreateCut(0.5f, 10, maxAzimuth));
+   cuts.push_back(CreateCut(1.5f, 20, maxAzimuth));
+   return cuts;
+}
+
+static CrossSection::Definition
+CreateDefinition(const common::Coordinate& end = kEast_)
+{
+   // 100 m rows, approximately 1 km columns
+   CrossSection::Definition definition {};
+   definition.start_     = kSite_;
+   definition.end_       = end;
+   definition.rows_      = 100;
+   definition.columns_   = 100;
+   definition.maxHeight_ = 10'000.0f;
+   return definition;
+}
+
+static std::uint16_t
+GetValue(const CrossSectionGrid& grid, std::size_t row, std::size_t column)
+{
+   return grid.data_.at(row * grid.columns_ + column);
+}
+
+TEST(CrossSectionTest, Cuts)
+{
+   CrossSection volume {kSite_, CreateVolume()};
+
+   ASSERT_EQ(volume.cuts().size(), 3u);
+   EXPECT_EQ(volume.cuts()[0].elevation_, 0.5f);
+   EXPECT_EQ(volume.cuts()[1].elevation_, 1.5f);
+   EXPECT_EQ(volume.cuts()[2].elevation_, 3.0f);
+}
+
+TEST(CrossSectionTest, BeamHeight)
+{
+   CrossSection     volume {kSite_, CreateVolume()};
+   CrossSectionGrid grid {};
+
+   volume.Sample(CreateDefinition(), grid);
+
+   EXPECT_EQ(grid.rows_, 100u);
+   EXPECT_EQ(grid.columns_, 100u);
+   EXPECT_EQ(grid.data_.size(), 10000u);
+   EXPECT_NEAR(grid.length_, 100'000.0, 100.0);
+
+   // At 49.5 km, the 0.5 degree beam is centered near 580 m, the 1.5 degree
+   // beam near 1440 m, and the 3.0 degree beam near 2740 m
+   EXPECT_EQ(GetValue(grid, 5, 49), 10u);
+   EXPECT_EQ(GetValue(grid, 14, 49), 20u);
+   EXPECT_EQ(GetValue(grid, 27, 49), 30u);
+
+   // Above the highest cut
+   EXPECT_EQ(GetValue(grid, 40, 49), 0u);
+   EXPECT_EQ(GetValue(grid, 99, 49), 0u);
+
+   // Earth curvature raises the lowest beam with range, such that the lowest
+   // row is only sampled near the radar
+   EXPECT_EQ(GetValue(grid, 0, 20), 10u);
+   EXPECT_EQ(GetValue(grid, 0, 49), 0u);
+   EXPECT_EQ(GetValue(grid, 0, 90), 0u);
+   EXPECT_EQ(GetValue(grid, 12, 90), 10u);
+}
+
+TEST(CrossSectionTest, MaxRange)
+{
+   CrossSection     volume {kSite_, CreateVolume()};
+   CrossSectionGrid grid {};
+
+   // Extend the path to approximately 200 km
+   CrossSection::Definition definition = CreateDefinition({38.0, -88.723});
+   volume.Sample(definition, grid);
+
+   // Cells beyond the last gate have no data
+   for (std::size_t row = 0; row < grid.rows_; ++row)
+   {
+      EXPECT_EQ(GetValue(grid, row, 75), 0u);
+      EXPECT_EQ(GetValue(grid, row, 99), 0u);
+   }
+
+   EXPECT_EQ(GetValue(grid, 5, 24), 10u);
+}
+
+TEST(CrossSectionTest, MissingRadials)
+{
+   // Radials from 0 to 180 degrees only
+   CrossSection     volume {kSite_, CreateVolume(180.0f)};
+   CrossSectionGrid grid {};
+
+   volume.Sample(CreateDefinition(kEast_), grid);
+   EXPECT_EQ(GetValue(grid, 5, 49), 10u);
+
+   volume.Sample(CreateDefinition(kWest_), grid);
+   EXPECT_TRUE(std::all_of(grid.data_.cbegin(),
+                           grid.data_.cend(),
+                           [](std::uint16_t value) { return value == 0u; }));
+}
+
+TEST(CrossSectionTest, Threshold)
+{
+   std::vector<CrossSectionCut> cuts {};
+   cuts.push_back(CreateCut(0.5f, 5));
+   cuts.push_back(CreateCut(1.5f, 1));
+   cuts[0].threshold_ = 6;
+   cuts[1].threshold_ = 6;
+
+   CrossSection     volume {kSite_, std::move(cuts)};
+   CrossSectionGrid grid {};
+
+   volume.Sample(CreateDefinition(), grid);
+
+   // Values below the threshold have no data, except for range folded data
+   EXPECT_EQ(GetValue(grid, 5, 49), 0u);
+   EXPECT_EQ(GetValue(grid, 14, 49), 1u);
+}
+
+TEST(CrossSectionTest, Empty)
+{
+   CrossSection     volume {kSite_, {}};
+   CrossSectionGrid grid {};
+
+   volume.Sample(CreateDefinition(), grid);
+
+   EXPECT_EQ(grid.data_.size(), 10000u);
+   EXPECT_GT(grid.length_, 0.0);
+   EXPECT_TRUE(std::all_of(grid.data_.cbegin(),
+                           grid.data_.cend(),
+                           [](std::uint16_t value) { return value == 0u; }));
+
+   EXPECT_EQ(CrossSection::Create(nullptr,
+                                  wsr88d::rda::DataBlockType::MomentRef,
+                                  kSite_),
+             nullptr);
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,92 @@
+#include <scwx/qt/util/geo_grid_index.hpp>
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+static std::vector<std::string> QueryIds(const GeoGridIndex<std::string>& index,
+                                         const GeoBounds&                 bounds)
+{
+   std::vector<std::string> ids {};
+   index.Query(bounds, [&](const std::string& id) { ids.push_back(id); });
+   return ids;
+}
+
+static GeoGridIndex<std::string> CreateIndex()
+{
+   GeoGridIndex<std::string> index {};
+
+   // Inserted out of geographic order, to verify insertion order is preserved
+   index.Insert(38.6990, -90.6828, "KLSX");
+   index.Insert(32.5731, -97.3031, "KFWS");
+   index.Insert(39.7867, -104.5458, "KFTG");
+   index.Insert(64.5114, -165.2950, "PAEC");
+   index.Insert(13.4559, 144.8111, "PGUA");
+   index.Insert(38.9753, -77.4778, "KLWX");
+   index.Insert(90.0, 180.0, "POLE");
+
+   return index;
+}
+
+TEST(GeoGridIndexTest, QueryBounds)
+{
+   GeoGridIndex<std::string> index = CreateIndex();
+
+   EXPECT_EQ(index.size(), 7u);
+
+   EXPECT_EQ(QueryIds(index, {30.0, 40.0, -100.0, -75.0}),
+             (std::vector<std::string> {"KLSX", "KFWS", "KLWX"}));
+   EXPECT_EQ(QueryIds(index, {38.0, 39.0, -91.0, -90.0}),
+             (std::vector<std::string> {"KLSX"}));
+
+   // Items in an overlapping cell, but outside of the bounds, are excluded
+   EXPECT_TRUE(QueryIds(index, {38.0, 38.5, -91.0, -90.0}).empty());
+   EXPECT_TRUE(QueryIds(index, {0.0, 10.0, 0.0, 10.0}).empty());
+}
+
+TEST(GeoGridIndexTest, QueryAntimeridian)
+{
+   GeoGridIndex<std::string> index = CreateIndex();
+
+   EXPECT_EQ(QueryIds(index, {0.0, 70.0, 140.0, -160.0}),
+             (std::vector<std::string> {"PAEC", "PGUA"}));
+   EXPECT_EQ(QueryIds(index, {80.0, 90.0, 170.0, -170.0}),
+             (std::vector<std::string> {"POLE"}));
+}
+
+TEST(GeoGridIndexTest, QueryAll)
+{
+   GeoGridIndex<std::string> index = CreateIndex();
+
+   EXPECT_EQ(QueryIds(index, {}),
+             (std::vector<std::string> {
+                "KLSX", "KFWS", "KFTG", "PAEC", "PGUA", "KLWX", "POLE"}));
+
+   index.Clear();
+   EXPECT_TRUE(index.empty());
+   EXPECT_TRUE(QueryIds(index, {}).empty());
+}
+
+TEST(GeoGridIndexTest, CellSize)
+{
+   GeoGridIndex<std::string> index {0.1};
+
+   index.Insert(38.6990, -90.6828, "KLSX");
+   index.Insert(38.6450, -90.6500, "TEST");
+
+   EXPECT_EQ(QueryIds(index, {38.6, 38.7, -90.7, -90.6}),
+             (std::vector<std::string> {"KLSX", "TEST"}));
+   EXPECT_EQ(QueryIds(index, {38.68, 38.7, -90.7, -90.6}),
+             (std::vector<std::string> {"KLSX"}));
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
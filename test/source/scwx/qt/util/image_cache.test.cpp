@@ -0,0 +1,193 @@
+#include <scwx/qt/util/image_cache.hpp>
+
+#include <atomic>
+#include <filesystem>
+#include <thread>
+
+#include <boost/gil/image.hpp>
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+static const std::string kUrl_ {"https://example.com/icons.png"};
+static const std::string kLastModified_ {"Mon, 19 Oct 2026 00:00:00 GMT"};
+
+class ImageCacheTest : public testing::Test
+{
+protected:
+   void SetUp() override
+   {
+      cachePath_ = std::filesystem::temp_directory_path() /
+                   fmt::format("scwx-image-cache-{}",
+                               testing::UnitTest::GetInstance()
+                                  ->current_test_info()
+                                  ->name());
+      std::filesystem::remove_all(cachePath_);
+   }
+
+   void TearDown() override { std::filesystem::remove_all(cachePath_); }
+
+   // Simulates a server which returns 304 Not Modified when the ETag matches
+   ImageCache::FetchResult Fetch(const std::string&            url,
+                                 const ImageCache::Validators& validators)
+   {
+      ++fetchCount_;
+      lastValidators_ = validators;
+
+      ImageCache::FetchResult result {};
+      if (validators.etag_ == etag_)
+      {
+         result.statusCode_ = 304;
+      }
+      else
+      {
+         result.statusCode_               = 200;
+         result.body_                     = url;
+         result.validators_.etag_         = etag_;
+         result.validators_.lastModified_ = kLastModified_;
+      }
+      return result;
+   }
+
+   std::shared_ptr<ImageCache::ImageType> Decode(const std::string& data)
+   {
+      ++decodeCount_;
+      lastDecoded_ = data;
+      return std::make_shared<ImageCache::ImageType>(1, 1);
+   }
+
+   ImageCache CreateCache(const std::string& cachePath)
+   {
+      return ImageCache {
+         cachePath,
+         6u,
+         [this](const std::string& url, const ImageCache::Validators& v)
+         { return Fetch(url, v); },
+         [this](const std::string& data) { return Decode(data); }};
+   }
+
+   std::filesystem::path cachePath_ {};
+
+   std::string            etag_ {"\"v1\""};
+   std::atomic<int>       fetchCount_ {0};
+   std::atomic<int>       decodeCount_ {0};
+   ImageCache::Validators lastValidators_ {};
+   std::string            lastDecoded_ {};
+};
+
+TEST_F(ImageCacheTest, UnchangedImageIsNotDecoded)
+{
+   ImageCache cache = CreateCache({});
+
+   auto image1 = cache.Get(kUrl_);
+   ASSERT_NE(image1, nullptr);
+   EXPECT_TRUE(lastValidators_.empty());
+   EXPECT_EQ(decodeCount_, 1);
+
+   // The cached image is revalidated, and reused
+   auto image2 = cache.Get(kUrl_);
+   EXPECT_EQ(image2, image1);
+   EXPECT_EQ(lastValidators_.etag_, etag_);
+   EXPECT_EQ(fetchCount_, 2);
+   EXPECT_EQ(decodeCount_, 1);
+
+   // A changed image is downloaded and decoded
+   etag_       = "\"v2\"";
+   auto image3 = cache.Get(kUrl_);
+   ASSERT_NE(image3, nullptr);
+   EXPECT_NE(image3, image1);
+   EXPECT_EQ(decodeCount_, 2);
+}
+
+TEST_F(ImageCacheTest, ExpiredImageIsRequestedUnconditionally)
+{
+   ImageCache cache = CreateCache({});
+
+   cache.Get(kUrl_);
+
+   // Without a persistent cache, the image must be downloaded again once it
+   // is no longer referenced
+   auto image = cache.Get(kUrl_);
+   ASSERT_NE(image, nullptr);
+   EXPECT_EQ(fetchCount_, 3);
+   EXPECT_TRUE(lastValidators_.empty());
+   EXPECT_EQ(decodeCount_, 2);
+}
+
+TEST_F(ImageCacheTest, PersistedValidators)
+{
+   {
+      ImageCache cache = CreateCache(cachePath_.string());
+      ASSERT_NE(cache.Get(kUrl_), nullptr);
+   }
+
+   EXPECT_EQ(fetchCount_, 1);
+
+   // A new cache revalidates the persisted image, and decodes it from disk
+   ImageCache cache = CreateCache(cachePath_.string());
+   auto       image = cache.Get(kUrl_);
+   ASSERT_NE(image, nullptr);
+   EXPECT_EQ(fetchCount_, 2);
+   EXPECT_EQ(lastValidators_.etag_, etag_);
+   EXPECT_EQ(lastValidators_.lastModified_, kLastModified_);
+   EXPECT_EQ(decodeCount_, 2);
+   EXPECT_EQ(lastDecoded_, kUrl_);
+}
+
+TEST_F(ImageCacheTest, ConnectionLimit)
+{
+   static constexpr std::size_t kMaxConnections = 2u;
+
+   std::atomic<std::size_t> active {0u};
+   std::atomic<std::size_t> maxActive {0u};
+
+   ImageCache cache {
+      {},
+      kMaxConnections,
+      [&](const std::string& url, const ImageCache::Validators&)
+      {
+         std::size_t current  = ++active;
+         std::size_t previous = maxActive;
+         while (previous < current &&
+                !maxActive.compare_exchange_weak(previous, current))
+         {
+         }
+
+         std::this_thread::sleep_for(std::chrono::milliseconds(10));
+         --active;
+
+         ImageCache::FetchResult result {};
+         result.statusCode_ = 200;
+         result.body_       = url;
+         return result;
+      },
+      [this](const std::string&)
+      {
+         ++decodeCount_;
+         return std::make_shared<ImageCache::ImageType>(1, 1);
+      }};
+
+   std::vector<std::thread> threads {};
+   for (int i = 0; i < 8; ++i)
+   {
+      threads.emplace_back([&cache, i]()
+                           { cache.Get(fmt::format("{}?{}", kUrl_, i)); });
+   }
+   for (auto& thread : threads)
+   {
+      thread.join();
+   }
+
+   EXPECT_EQ(decodeCount_, 8);
+   EXPECT_LE(maxActive, kMaxConnections);
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,188 @@
+#include <scwx/qt/util/mosaic_grid.hpp>
+
+#include <algorithm>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+static const common::Coordinate kCenter_ {38.0, -91.0};
+static const common::Coordinate kSiteA_ {38.0, -91.5};
+static const common::Coordinate kSiteB_ {38.0, -90.5};
+
+static std::shared_ptr<MosaicSweep>
+CreateSweep(const common::Coordinate& location,
+            std::uint8_t              value,
+            float                     maxAzimuth = 360.0f)
+{
+   auto sweep = std::make_shared<MosaicSweep>();
+
+   sweep->location_       = location;
+   sweep->firstGateRange_ = 125.0f;
+   sweep->gateSpacing_    = 250.0f;
+   sweep->gateCount_      = 240; // 60 km
+
+   for (float azimuth = 0.5f; azimuth < maxAzimuth; azimuth += 1.0f)
+   {
+      sweep->azimuths_.push_back(azimuth);
+   }
+
+   sweep->data_.resize(sweep->azimuths_.size() * sweep->gateCount_, value);
+
+   return sweep;
+}
+
+static std::uint8_t GetValue(const MosaicGrid&         grid,
+                             const common::Coordinate& coordinate)
+{
+   const MosaicGrid::Definition& definition = grid.definition();
+
+   std::size_t row = static_cast<std::size_t>(
+      (coordinate.latitude_ - definition.minLatitude_) /
+      definition.resolution_);
+   std::size_t column = static_cast<std::size_t>(
+      (coordinate.longitude_ - definition.minLongitude_) /
+      definition.resolution_);
+
+   return grid.data().at(row * definition.columns_ + column);
+}
+
+static MosaicGrid::Definition CreateDefinition()
+{
+   // 100 rows x 200 columns, 2 x 4 tiles
+   return MosaicGrid::Definition::Centered(kCenter_, 2.0, 4.0, 0.02);
+}
+
+TEST(MosaicGridTest, Definition)
+{
+   MosaicGrid grid {CreateDefinition()};
+
+   EXPECT_EQ(grid.definition().rows_, 100u);
+   EXPECT_EQ(grid.definition().columns_, 200u);
+   EXPECT_EQ(grid.tile_count(), 8u);
+   EXPECT_EQ(grid.data().size(), 20000u);
+
+   common::Coordinate cell = grid.definition().cell_center(50, 100);
+   EXPECT_NEAR(cell.latitude_, 38.01, 1e-9);
+   EXPECT_NEAR(cell.longitude_, -90.99, 1e-9);
+
+   MosaicGrid::TileExtent extent = grid.tile_extent(7);
+   EXPECT_EQ(extent.rowBegin_, 64u);
+   EXPECT_EQ(extent.rowEnd_, 100u);
+   EXPECT_EQ(extent.columnBegin_, 192u);
+   EXPECT_EQ(extent.columnEnd_, 200u);
+}
+
+TEST(MosaicGridTest, SingleSite)
+{
+   MosaicGrid grid {CreateDefinition()};
+
+   std::vector<std::size_t> tiles =
+      grid.UpdateSite("KAAA", CreateSweep(kSiteA_, 10));
+
+   // Only tiles covered by the site are resampled
+   EXPECT_GT(tiles.size(), 0u);
+   EXPECT_LT(tiles.size(), grid.tile_count());
+   EXPECT_EQ(grid.site_count(), 1u);
+
+   EXPECT_EQ(GetValue(grid, kSiteA_), 10u);
+   EXPECT_EQ(GetValue(grid, {38.0, -91.2}), 10u);
+
+   // Beyond the maximum range
+   EXPECT_EQ(GetValue(grid, {38.0, -90.5}), 0u);
+   EXPECT_EQ(GetValue(grid, {38.9, -91.5}), 0u);
+
+   // Updating the site again resamples the same tiles
+   EXPECT_EQ(grid.UpdateSite("KAAA", CreateSweep(kSiteA_, 12)), tiles);
+   EXPECT_EQ(GetValue(grid, kSiteA_), 12u);
+
+   EXPECT_EQ(grid.RemoveSite("KAAA"), tiles);
+   EXPECT_EQ(grid.site_count(), 0u);
+   EXPECT_TRUE(std::all_of(grid.data().cbegin(),
+                           grid.data().cend(),
+                           [](std::uint8_t value) { return value == 0u; }));
+
+   EXPECT_TRUE(grid.RemoveSite("KAAA").empty());
+}
+
+TEST(MosaicGridTest, SiteExtent)
+{
+   MosaicGrid grid {CreateDefinition()};
+
+   std::vector<std::size_t> estimatedTiles =
+      grid.UpdateSite("KAAA", CreateSweep(kSiteA_, 10));
+
+   // A known extent limits the cells mapped to the site
+   auto sweep     = CreateSweep(kSiteA_, 10);
+   sweep->extent_ = {kSiteA_.latitude_ - 0.3,
+                     kSiteA_.longitude_ - 0.3,
+                     kSiteA_.latitude_ + 0.3,
+                     kSiteA_.longitude_ + 0.3};
+
+   MosaicGrid               extentGrid {CreateDefinition()};
+   std::vector<std::size_t> tiles = extentGrid.UpdateSite("KAAA", sweep);
+
+   EXPECT_LE(tiles.size(), estimatedTiles.size());
+   EXPECT_EQ(GetValue(extentGrid, kSiteA_), 10u);
+   EXPECT_EQ(GetValue(extentGrid, {38.25, -91.5}), 10u);
+   EXPECT_EQ(GetValue(extentGrid, {38.4, -91.5}), 0u);
+   EXPECT_EQ(GetValue(grid, {38.4, -91.5}), 10u);
+}
+
+TEST(MosaicGridTest, Rules)
+{
+   MosaicGrid grid {CreateDefinition(), MosaicRule::MaxValue};
+
+   grid.UpdateSite("KAAA", CreateSweep(kSiteA_, 10));
+   grid.UpdateSite("KBBB", CreateSweep(kSiteB_, 20));
+
+   // Overlapping coverage uses the maximum value
+   EXPECT_EQ(GetValue(grid, {38.0, -91.1}), 20u);
+   EXPECT_EQ(GetValue(grid, {38.0, -90.9}), 20u);
+
+   // Non-overlapping coverage
+   EXPECT_EQ(GetValue(grid, {38.0, -92.0}), 10u);
+   EXPECT_EQ(GetValue(grid, {38.0, -90.0}), 20u);
+
+   EXPECT_EQ(grid.SetRule(MosaicRule::NearestRadar).size(), grid.tile_count());
+   EXPECT_TRUE(grid.SetRule(MosaicRule::NearestRadar).empty());
+
+   // Overlapping coverage uses the nearest radar
+   EXPECT_EQ(GetValue(grid, {38.0, -91.1}), 10u);
+   EXPECT_EQ(GetValue(grid, {38.0, -90.9}), 20u);
+   EXPECT_EQ(GetValue(grid, {38.0, -92.0}), 10u);
+   EXPECT_EQ(GetValue(grid, {38.0, -90.0}), 20u);
+}
+
+TEST(MosaicGridTest, Threshold)
+{
+   MosaicGrid grid {CreateDefinition(), MosaicRule::NearestRadar};
+
+   // Values below the threshold (e.g., range folded) do not mask other radars
+   grid.UpdateSite("KAAA", CreateSweep(kSiteA_, 1));
+   grid.UpdateSite("KBBB", CreateSweep(kSiteB_, 20));
+
+   EXPECT_EQ(GetValue(grid, {38.0, -91.1}), 20u);
+   EXPECT_EQ(GetValue(grid, {38.0, -92.0}), 0u);
+}
+
+TEST(MosaicGridTest, MissingRadials)
+{
+   MosaicGrid grid {CreateDefinition()};
+
+   // Radials from 0 to 90 degrees only
+   grid.UpdateSite("KAAA", CreateSweep(kSiteA_, 10, 90.0f));
+
+   EXPECT_EQ(GetValue(grid, {38.2, -91.3}), 10u);
+   EXPECT_EQ(GetValue(grid, {37.8, -91.5}), 0u);
+   EXPECT_EQ(GetValue(grid, {38.0, -91.7}), 0u);
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,229 @@
+#include <scwx/qt/util/polar_sweep.hpp>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+static constexpr float kGateSize_ = 250.0f;
+
+static PolarRadial CreateRadial(std::uint16_t                    index,
+                                float                            azimuth,
+                                const std::vector<std::uint8_t>& moments,
+                                std::int32_t firstGateRange = 125,
+                                std::int32_t gateInterval   = 250)
+{
+   PolarRadial radial {};
+   radial.index_          = index;
+   radial.azimuth_        = azimuth;
+   radial.firstGateRange_ = firstGateRange;
+   radial.gateInterval_   = gateInterval;
+   radial.gateCount_      = moments.size();
+   radial.moments8_       = moments.data();
+   return radial;
+}
+
+TEST(PolarSweepTest, CompleteSweep)
+{
+   std::vector<std::uint8_t> moments {10, 20, 30, 40};
+   std::vector<PolarRadial>  radials {};
+
+   // A full rotation of 720 radials, starting at 180 degrees
+   for (std::uint16_t i = 0; i < 720; ++i)
+   {
+      radials.push_back(CreateRadial(i, 180.0f + i * 0.5f, moments));
+      if (radials.back().azimuth_ >= 360.0f)
+      {
+         radials.back().azimuth_ -= 360.0f;
+      }
+   }
+
+   PolarSweep sweep = PackPolarSweep(radials, kGateSize_, 2);
+
+   ASSERT_EQ(sweep.radialCount_, 720u);
+   EXPECT_EQ(sweep.gateCount_, 4u);
+   EXPECT_EQ(sweep.componentCount_, 1u);
+   ASSERT_EQ(sweep.data_.size(), 720u * 4u);
+
+   // Azimuths are unwrapped to be non-decreasing
+   EXPECT_FLOAT_EQ(sweep.azimuths_.front(), 180.0f);
+   EXPECT_FLOAT_EQ(sweep.azimuths_.back(), 180.0f + 719 * 0.5f);
+
+   EXPECT_EQ(sweep.FindRadial(180.0f), 0u);
+   EXPECT_EQ(sweep.FindRadial(180.49f), 0u);
+   EXPECT_EQ(sweep.FindRadial(180.5f), 1u);
+   EXPECT_EQ(sweep.FindRadial(0.0f), 360u);
+   EXPECT_EQ(sweep.FindRadial(360.0f), 360u);
+   EXPECT_EQ(sweep.FindRadial(179.9f), 719u);
+   EXPECT_EQ(sweep.FindRadial(-180.2f), 719u);
+
+   EXPECT_EQ(sweep.Sample(90.0f, 0.0f), 10u);
+   EXPECT_EQ(sweep.Sample(90.0f, 300.0f), 20u);
+   EXPECT_EQ(sweep.Sample(90.0f, 999.0f), 40u);
+   EXPECT_EQ(sweep.Sample(90.0f, 1000.0f), 0u);
+   EXPECT_EQ(sweep.Sample(90.0f, -1.0f), 0u);
+}
+
+TEST(PolarSweepTest, ThresholdAndRangeFolded)
+{
+   std::vector<std::uint8_t> moments {0, 1, 2, 5};
+   std::vector<PolarRadial>  radials {CreateRadial(0, 0.0f, moments),
+                                      CreateRadial(1, 0.5f, moments)};
+
+   PolarSweep sweep = PackPolarSweep(radials, kGateSize_, 3);
+
+   // Values below the threshold are omitted, range folded values are not
+   EXPECT_EQ(sweep.Sample(0.0f, 100.0f), 0u);
+   EXPECT_EQ(sweep.Sample(0.0f, 300.0f), 1u);
+   EXPECT_EQ(sweep.Sample(0.0f, 600.0f), 0u);
+   EXPECT_EQ(sweep.Sample(0.0f, 800.0f), 5u);
+}
+
+TEST(PolarSweepTest, VariableGateSpacing)
+{
+   std::vector<std::uint8_t> moments {10, 20, 30};
+
+   // 1 km gates starting 2 km from the radar, resampled to 250 m gates
+   std::vector<PolarRadial> radials {
+      CreateRadial(0, 0.0f, moments, 2000, 1000),
+      CreateRadial(1, 0.5f, moments, 2000, 1000)};
+
+   PolarSweep sweep = PackPolarSweep(radials, kGateSize_, 2);
+
+   // Gates span [1500, 2500), [2500, 3500) and [3500, 4500)
+   EXPECT_EQ(sweep.gateCount_, 18u);
+   EXPECT_EQ(sweep.Sample(0.0f, 1499.0f), 0u);
+   EXPECT_EQ(sweep.Sample(0.0f, 1500.0f), 10u);
+   EXPECT_EQ(sweep.Sample(0.0f, 2499.0f), 10u);
+   EXPECT_EQ(sweep.Sample(0.0f, 2500.0f), 20u);
+   EXPECT_EQ(sweep.Sample(0.0f, 4499.0f), 30u);
+   EXPECT_EQ(sweep.Sample(0.0f, 4500.0f), 0u);
+
+   // The first bin extends from the radar site to the first base gate only,
+   // matching the triangle sweep
+   radials = {CreateRadial(0, 0.0f, moments, 500, 1000),
+              CreateRadial(1, 0.5f, moments, 500, 1000)};
+   sweep   = PackPolarSweep(radials, kGateSize_, 2);
+
+   EXPECT_EQ(sweep.Sample(0.0f, 100.0f), 10u);
+   EXPECT_EQ(sweep.Sample(0.0f, 300.0f), 0u);
+   EXPECT_EQ(sweep.Sample(0.0f, 1000.0f), 20u);
+}
+
+TEST(PolarSweepTest, MissingRadials)
+{
+   std::vector<std::uint8_t> moments {10};
+
+   // Radials 2 and 3 are missing
+   std::vector<PolarRadial> radials {CreateRadial(0, 10.0f, moments),
+                                     CreateRadial(1, 10.5f, moments),
+                                     CreateRadial(4, 12.0f, moments),
+                                     CreateRadial(5, 12.5f, moments)};
+
+   PolarSweep sweep = PackPolarSweep(radials, kGateSize_, 2);
+
+   // The first and last azimuths are within 2.5 degrees, so the sweep is
+   // considered complete
+   ASSERT_EQ(sweep.radialCount_, 6u);
+   EXPECT_FLOAT_EQ(sweep.azimuths_[2], 11.0f);
+   EXPECT_FLOAT_EQ(sweep.azimuths_[3], 11.5f);
+
+   EXPECT_EQ(sweep.Sample(10.7f, 0.0f), 10u);
+   EXPECT_EQ(sweep.Sample(11.2f, 0.0f), 0u);
+   EXPECT_EQ(sweep.Sample(11.7f, 0.0f), 0u);
+   EXPECT_EQ(sweep.Sample(12.2f, 0.0f), 10u);
+
+   // The last radial extends to the first
+   EXPECT_EQ(sweep.Sample(200.0f, 0.0f), 10u);
+}
+
+TEST(PolarSweepTest, IncompleteSweep)
+{
+   std::vector<std::uint8_t> moments {10};
+   std::vector<PolarRadial>  radials {};
+
+   // A partial sweep from 350 degrees through 90 degrees
+   for (std::uint16_t i = 0; i < 200; ++i)
+   {
+      float azimuth = 350.0f + i * 0.5f;
+      radials.push_back(CreateRadial(
+         i, (azimuth >= 360.0f) ? azimuth - 360.0f : azimuth, moments));
+   }
+
+   EXPECT_TRUE(IsPolarSweepIncomplete(350.0f, 89.5f));
+   EXPECT_FALSE(IsPolarSweepIncomplete(0.25f, 359.0f));
+
+   PolarSweep sweep = PackPolarSweep(radials, kGateSize_, 2);
+
+   // An empty radial is appended after the last radial
+   ASSERT_EQ(sweep.radialCount_, 201u);
+   EXPECT_FLOAT_EQ(sweep.azimuths_[200], 450.0f);
+
+   EXPECT_EQ(sweep.Sample(350.0f, 0.0f), 10u);
+   EXPECT_EQ(sweep.Sample(89.7f, 0.0f), 10u);
+   EXPECT_EQ(sweep.Sample(90.0f, 0.0f), 0u);
+   EXPECT_EQ(sweep.Sample(180.0f, 0.0f), 0u);
+   EXPECT_EQ(sweep.Sample(349.9f, 0.0f), 0u);
+}
+
+TEST(PolarSweepTest, ClutterFilterPowerRemoved)
+{
+   std::vector<std::uint8_t> moments {10, 20};
+   std::vector<std::uint8_t> cfpMoments {3, 12};
+
+   std::vector<PolarRadial> radials {CreateRadial(0, 0.0f, moments),
+                                     CreateRadial(1, 0.5f, moments)};
+   radials[0].cfpMoments_ = cfpMoments.data();
+   radials[1].cfpMoments_ = cfpMoments.data();
+
+   PolarSweep sweep = PackPolarSweep(radials, kGateSize_, 2);
+
+   ASSERT_EQ(sweep.componentCount_, 2u);
+   EXPECT_EQ(sweep.Sample(0.0f, 0.0f, 0), 10u);
+   EXPECT_EQ(sweep.Sample(0.0f, 0.0f, 1), 3u);
+   EXPECT_EQ(sweep.Sample(0.0f, 300.0f, 0), 20u);
+   EXPECT_EQ(sweep.Sample(0.0f, 300.0f, 1), 12u);
+}
+
+TEST(PolarSweepTest, SiteFrame)
+{
+   struct Reference
+   {
+      double latitude_;
+      double longitude_;
+      float  azimuth_;
+      float  range_;
+   };
+
+   // Destinations from the KLSX radar site, calculated with the WGS84
+   // geodesic
+   static const std::vector<Reference> kReferences_ {
+      {38.788971488, -90.682780000, 0.0f, 10000.0f},
+      {39.332969237, -89.862656164, 45.0f, 100000.0f},
+      {37.212913291, -88.858642697, 135.25f, 230000.0f},
+      {36.153209281, -91.822641204, 200.0f, 300000.0f},
+      {38.687767548, -95.970905894, 271.5f, 460000.0f},
+      {39.149279191, -90.685303750, 359.75f, 50000.0f}};
+
+   PolarSiteFrame frame = PolarSiteFrame::Create(38.69889, -90.68278);
+
+   for (const Reference& reference : kReferences_)
+   {
+      std::array<float, 2> azimuthRange =
+         frame.AzimuthRange(reference.latitude_, reference.longitude_);
+
+      float azimuthDelta = std::abs(azimuthRange[0] - reference.azimuth_);
+      azimuthDelta       = std::min(azimuthDelta, 360.0f - azimuthDelta);
+
+      EXPECT_LT(azimuthDelta, 0.02f);
+      EXPECT_NEAR(azimuthRange[1], reference.range_, 5.0f);
+   }
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
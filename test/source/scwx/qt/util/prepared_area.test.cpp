@@ -0,0 +1,193 @@
+#include <scwx/qt/util/area_index.hpp>
+#include <scwx/qt/util/geographic_lib.hpp>
+#include <scwx/qt/util/prepared_area.hpp>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+static const std::vector<common::Coordinate> kArea_ = {
+   common::Coordinate(37.0193692, -91.8778413),
+   common::Coordinate(36.9719180, -91.3006973),
+   common::Coordinate(36.7270831, -91.6815753),
+};
+
+static const common::Coordinate kInside_ {36.9241584, -91.6425933};
+static const common::Coordinate kNear_ {36.8009181, -91.3922700};
+static const common::Coordinate kFar_ {37.6481966, -94.2163834};
+
+TEST(PreparedAreaTest, Contains)
+{
+   PreparedArea area {kArea_};
+
+   EXPECT_TRUE(area.is_valid());
+   EXPECT_TRUE(area.Contains(kInside_));
+   EXPECT_FALSE(area.Contains(kNear_));
+   EXPECT_FALSE(area.Contains(kFar_));
+
+   for (auto& point : {kInside_, kNear_, kFar_})
+   {
+      EXPECT_EQ(area.Contains(point),
+                GeographicLib::AreaContainsPoint(kArea_, point));
+   }
+}
+
+TEST(PreparedAreaTest, Distance)
+{
+   PreparedArea area {kArea_};
+
+   EXPECT_EQ(area.Distance(kInside_).value(), 0.0);
+
+   // Distances are within 10 meters of the point-centered projection
+   for (auto& point : {kNear_, kFar_})
+   {
+      EXPECT_NEAR(area.Distance(point).value(),
+                  GeographicLib::GetDistanceAreaPoint(kArea_, point).value(),
+                  10.0);
+   }
+}
+
+TEST(PreparedAreaTest, LargeAreaDistance)
+{
+   // Spans 10 degrees of longitude, and the northern edge bows poleward of
+   // its vertices
+   static const std::vector<common::Coordinate> kLargeArea {
+      {30.0, -100.0}, {30.0, -90.0}, {38.0, -90.0}, {38.0, -100.0}};
+
+   PreparedArea area {kLargeArea};
+
+   // Off-centre points, and a point inside the northern edge but north of its
+   // vertices
+   for (auto& point : {common::Coordinate {29.0, -89.0},
+                       common::Coordinate {38.5, -99.0},
+                       common::Coordinate {38.08, -95.0},
+                       common::Coordinate {45.0, -60.0}})
+   {
+      EXPECT_NEAR(
+         area.Distance(point).value(),
+         GeographicLib::GetDistanceAreaPoint(kLargeArea, point).value(),
+         1.0);
+      EXPECT_EQ(area.Contains(point),
+                GeographicLib::AreaContainsPoint(kLargeArea, point));
+   }
+
+   EXPECT_TRUE(area.Contains({38.08, -95.0}));
+
+   // A point on the opposite hemisphere is measured to the centroid
+   const common::Coordinate oppositePoint {-30.0, 80.0};
+
+   EXPECT_FALSE(area.Contains(oppositePoint));
+   EXPECT_NEAR(
+      area.Distance(oppositePoint).value(),
+      GeographicLib::GetDistanceAreaPoint(kLargeArea, oppositePoint).value(),
+      1.0);
+}
+
+TEST(PreparedAreaTest, InRangeOfPoint)
+{
+   PreparedArea area {kArea_};
+
+   using meters = units::length::meters<double>;
+
+   EXPECT_TRUE(area.InRangeOfPoint(kInside_, meters(0)));
+   EXPECT_FALSE(area.InRangeOfPoint(kNear_, meters(9000)));
+   EXPECT_TRUE(area.InRangeOfPoint(kNear_, meters(10100)));
+   EXPECT_FALSE(area.InRangeOfPoint(kFar_, meters(100e3)));
+   EXPECT_TRUE(area.InRangeOfPoint(kFar_, meters(300e3)));
+}
+
+TEST(PreparedAreaTest, InvalidArea)
+{
+   PreparedArea area {{kArea_[0], kArea_[1]}};
+
+   EXPECT_FALSE(area.is_valid());
+   EXPECT_FALSE(area.Contains(kInside_));
+}
+
+TEST(AreaIndexTest, Query)
+{
+   AreaIndex index {};
+
+   auto area = std::make_shared<const PreparedArea>(kArea_);
+   auto otherArea =
+      std::make_shared<const PreparedArea>(std::vector<common::Coordinate> {
+         {45.0, -100.0}, {45.5, -100.0}, {45.5, -100.5}});
+
+   index.Insert(area);
+   index.Insert(otherArea);
+   EXPECT_EQ(index.size(), 2u);
+
+   auto candidates = index.Query(kNear_, units::length::meters<double>(10100));
+   ASSERT_EQ(candidates.size(), 1u);
+   EXPECT_EQ(candidates[0], area);
+
+   EXPECT_TRUE(
+      index.QueryInRange(kNear_, units::length::meters<double>(9000)).empty());
+   EXPECT_EQ(
+      index.QueryInRange(kNear_, units::length::meters<double>(10100)).size(),
+      1u);
+   EXPECT_TRUE(
+      index.QueryInRange(kFar_, units::length::meters<double>(100e3)).empty());
+
+   index.Remove(area);
+   EXPECT_EQ(index.size(), 1u);
+   EXPECT_TRUE(index.Query(kInside_, units::length::meters<double>(0)).empty());
+}
+
+TEST(AreaIndexTest, InsertRemove)
+{
+   AreaIndex index {};
+
+   std::vector<std::shared_ptr<const PreparedArea>> areas {};
+
+   // Insert enough areas to build the tree, then modify the index without
+   // rebuilding it
+   for (int i = 0; i < 200; ++i)
+   {
+      const double longitude = -120.0 + i * 0.25;
+
+      areas.push_back(
+         std::make_shared<const PreparedArea>(std::vector<common::Coordinate> {
+            {40.0, longitude}, {40.1, longitude}, {40.1, longitude + 0.1}}));
+      index.Insert(areas.back());
+   }
+
+   const common::Coordinate point {40.05, -110.0};
+   const auto               distance = units::length::meters<double>(50e3);
+
+   const std::size_t expectedCount = index.QueryInRange(point, distance).size();
+   EXPECT_GT(expectedCount, 0u);
+
+   auto newArea =
+      std::make_shared<const PreparedArea>(std::vector<common::Coordinate> {
+         {40.0, -110.0}, {40.1, -110.0}, {40.1, -109.9}});
+   index.Insert(newArea);
+   index.Insert(newArea);
+   EXPECT_EQ(index.size(), 201u);
+   EXPECT_EQ(index.QueryInRange(point, distance).size(), expectedCount + 1);
+
+   index.Remove(newArea);
+   for (auto& area : areas)
+   {
+      if (area->InRangeOfPoint(point, distance))
+      {
+         index.Remove(area);
+         break;
+      }
+   }
+   EXPECT_EQ(index.size(), 199u);
+   EXPECT_EQ(index.QueryInRange(point, distance).size(), expectedCount - 1);
+
+   index.Clear();
+   EXPECT_TRUE(index.empty());
+   EXPECT_TRUE(index.Query(point, distance).empty());
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
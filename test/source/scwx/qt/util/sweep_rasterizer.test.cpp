@@ -0,0 +1,193 @@
+#include <scwx/qt/util/sweep_rasterizer.hpp>
+
+#include <filesystem>
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+// 10 x 10 pixels, 0.1 degree resolution
+static const RasterExtent kExtent_ {35.0, -98.0, 36.0, -97.0, 10, 10};
+
+static const std::vector<boost::gil::rgba8_pixel_t> kLut_ {
+   {255, 0, 0, 255}, {0, 255, 0, 255}, {0, 0, 255, 128}};
+
+static const RasterColorTable kColorTable_ {&kLut_, 1, 3};
+
+static std::vector<float> CreateSquare(float minLatitude,
+                                       float minLongitude,
+                                       float maxLatitude,
+                                       float maxLongitude)
+{
+   return {minLatitude, minLongitude, maxLatitude, minLongitude,
+           minLatitude, maxLongitude, //
+           minLatitude, maxLongitude, maxLatitude, minLongitude,
+           maxLatitude, maxLongitude};
+}
+
+TEST(SweepRasterizerTest, Centered)
+{
+   RasterExtent extent = RasterExtent::Centered({35.0, -97.0}, 110'000.0, 0.1);
+
+   EXPECT_EQ(extent.height_, 20u);
+   EXPECT_GE(extent.width_, 24u);
+   EXPECT_NEAR(extent.maxLatitude_ - extent.minLatitude_, 2.0, 1e-9);
+   EXPECT_NEAR((extent.minLongitude_ + extent.maxLongitude_) / 2.0,
+               -97.0,
+               1e-9);
+}
+
+TEST(SweepRasterizerTest, Draw)
+{
+   SweepRasterizer rasterizer {kExtent_};
+
+   // Northwest quadrant, code 1 (red)
+   std::vector<float>        vertices = CreateSquare(35.5f, -98.0f, 36.0f, -97.5f);
+   std::vector<std::uint8_t> moments(6, 1u);
+
+   SweepBuffers buffers {&vertices, moments.data(), 1};
+
+   EXPECT_EQ(rasterizer.Draw(buffers, kColorTable_), 2u);
+
+   const auto& pixels = rasterizer.pixels();
+   ASSERT_EQ(pixels.size(), 100u);
+
+   // Row 0 is the northern edge
+   EXPECT_EQ(pixels[0], boost::gil::rgba8_pixel_t(255, 0, 0, 255));
+   EXPECT_EQ(pixels[4 * 10 + 4], boost::gil::rgba8_pixel_t(255, 0, 0, 255));
+   EXPECT_EQ(pixels[5 * 10 + 4], boost::gil::rgba8_pixel_t(0, 0, 0, 0));
+   EXPECT_EQ(pixels[4 * 10 + 5], boost::gil::rgba8_pixel_t(0, 0, 0, 0));
+
+   std::size_t covered = std::count_if(
+      pixels.cbegin(),
+      pixels.cend(),
+      [](const boost::gil::rgba8_pixel_t& pixel) { return pixel[3] != 0u; });
+   EXPECT_EQ(covered, 25u);
+
+   rasterizer.Clear();
+   EXPECT_EQ(pixels[0], boost::gil::rgba8_pixel_t(0, 0, 0, 0));
+}
+
+TEST(SweepRasterizerTest, SharedEdgesBlendOnce)
+{
+   SweepRasterizer rasterizer {kExtent_};
+
+   // Entire extent, code 3 (translucent blue)
+   std::vector<float>         vertices = CreateSquare(35.0f, -98.0f, 36.0f, -97.0f);
+   std::vector<std::uint16_t> moments(6, 3u);
+
+   SweepBuffers buffers {&vertices, moments.data(), 2};
+
+   EXPECT_EQ(rasterizer.Draw(buffers, kColorTable_), 2u);
+
+   // Pixels along the diagonal are only blended once
+   for (const auto& pixel : rasterizer.pixels())
+   {
+      EXPECT_EQ(pixel, boost::gil::rgba8_pixel_t(0, 0, 128, 64));
+   }
+}
+
+TEST(SweepRasterizerTest, ProvokingVertexAndThreshold)
+{
+   SweepRasterizer rasterizer {kExtent_};
+
+   std::vector<float>        vertices = CreateSquare(35.0f, -98.0f, 36.0f, -97.0f);
+   std::vector<std::uint8_t> moments {0, 0, 0, 0, 0, 2};
+
+   SweepBuffers buffers {&vertices, moments.data(), 1};
+
+   // The first triangle is below the color table range, the second triangle
+   // uses the moment of its last vertex
+   EXPECT_EQ(rasterizer.Draw(buffers, kColorTable_), 1u);
+
+   // Southwest corner is in the first triangle, northeast in the second
+   EXPECT_EQ(rasterizer.pixels()[9 * 10], boost::gil::rgba8_pixel_t(0, 0, 0, 0));
+   EXPECT_EQ(rasterizer.pixels()[9],
+             boost::gil::rgba8_pixel_t(0, 255, 0, 255));
+}
+
+TEST(SweepRasterizerTest, DrawPolar)
+{
+   SweepRasterizer rasterizer {kExtent_};
+
+   // 40 km of data centered on the image, code 1 (red) east and code 2
+   // (green) west
+   std::vector<std::uint8_t> east(160, 1u);
+   std::vector<std::uint8_t> west(160, 2u);
+   std::vector<PolarRadial>  radials {};
+
+   for (std::uint16_t i = 0; i < 720; ++i)
+   {
+      PolarRadial& radial    = radials.emplace_back();
+      radial.index_          = i;
+      radial.azimuth_        = i * 0.5f;
+      radial.firstGateRange_ = 125;
+      radial.gateInterval_   = 250;
+      radial.gateCount_      = east.size();
+      radial.moments8_       = (i < 360) ? east.data() : west.data();
+   }
+
+   PolarSweep     sweep     = PackPolarSweep(radials, 250.0f, 1);
+   PolarSiteFrame siteFrame = PolarSiteFrame::Create(35.5, -97.5);
+
+   EXPECT_GT(rasterizer.DrawPolar(sweep, siteFrame, kColorTable_), 0u);
+
+   const auto& pixels = rasterizer.pixels();
+
+   EXPECT_EQ(pixels[4 * 10 + 5], boost::gil::rgba8_pixel_t(255, 0, 0, 255));
+   EXPECT_EQ(pixels[5 * 10 + 4], boost::gil::rgba8_pixel_t(0, 255, 0, 255));
+
+   // Corners are beyond the range of the sweep
+   EXPECT_EQ(pixels[0], boost::gil::rgba8_pixel_t(0, 0, 0, 0));
+   EXPECT_EQ(pixels[99], boost::gil::rgba8_pixel_t(0, 0, 0, 0));
+}
+
+TEST(SweepRasterizerTest, WriteGeoTiff)
+{
+   SweepRasterizer rasterizer {kExtent_};
+
+   std::vector<float>        vertices = CreateSquare(35.0f, -98.0f, 36.0f, -97.0f);
+   std::vector<std::uint8_t> moments(6, 1u);
+
+   SweepBuffers buffers {&vertices, moments.data(), 1};
+   rasterizer.Draw(buffers, kColorTable_);
+
+   const std::string filename =
+      (std::filesystem::temp_directory_path() / "sweep_rasterizer.tif")
+         .string();
+
+   ASSERT_TRUE(rasterizer.WriteGeoTiff(filename));
+
+   std::ifstream ifs {filename, std::ios_base::in | std::ios_base::binary};
+   std::vector<char> data {std::istreambuf_iterator<char>(ifs),
+                           std::istreambuf_iterator<char>()};
+   ifs.close();
+   std::filesystem::remove(filename);
+
+   // Header, directory and georeferencing precede the pixel data
+   ASSERT_GT(data.size(), 400u);
+   EXPECT_EQ(data[0], 'I');
+   EXPECT_EQ(data[1], 'I');
+   EXPECT_EQ(data[2], 42);
+
+   // Pixel data is at the end of the file
+   std::size_t imageOffset = data.size() - 400u;
+   EXPECT_EQ(static_cast<std::uint8_t>(data[imageOffset]), 255u);
+   EXPECT_EQ(static_cast<std::uint8_t>(data[imageOffset + 1]), 0u);
+   EXPECT_EQ(static_cast<std::uint8_t>(data[imageOffset + 3]), 255u);
+
+   // Strip offset entry (6th entry) points to the pixel data
+   std::uint32_t stripOffset = 0;
+   std::memcpy(&stripOffset, &data[8 + 2 + 5 * 12 + 8], sizeof(stripOffset));
+   EXPECT_EQ(stripOffset, imageOffset);
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
@@ -0,0 +1,232 @@
+#include <scwx/qt/util/text_event_store.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+using namespace std::chrono_literals;
+
+static const auto kIssuanceTime_ =
+   std::chrono::sys_days {std::chrono::year_month_day {
+      std::chrono::year {2021}, std::chrono::June, std::chrono::day {4}}} +
+   21h;
+
+static std::shared_ptr<awips::TextProductMessage>
+CreateMessage(const std::string& header,
+              const std::string& vtec,
+              const std::string& text)
+{
+   std::istringstream is {fmt::format("\x01\r\r\n123 \r\r\n"
+                                      "{}\r\r\n"
+                                      "SVSLSX\r\r\n"
+                                      "MOC071-042145-\r\r\n"
+                                      "{}\r\r\n"
+                                      "\r\r\n"
+                                      "{}\r\r\n"
+                                      "\r\r\n"
+                                      "$$\r\r\n"
+                                      "\x03",
+                                      header,
+                                      vtec,
+                                      text)};
+   return awips::TextProductMessage::Create(is);
+}
+
+static types::TextEventKey
+GetKey(const std::shared_ptr<awips::TextProductMessage>& message)
+{
+   return types::TextEventKey {
+      message->segment(0)->header_->vtecString_[0].pVtec_};
+}
+
+class TextEventStoreTest : public testing::Test
+{
+protected:
+   void SetUp() override
+   {
+      storePath_ = std::filesystem::temp_directory_path() /
+                   fmt::format("scwx-text-event-store-{}",
+                               testing::UnitTest::GetInstance()
+                                  ->current_test_info()
+                                  ->name());
+      std::filesystem::remove_all(storePath_);
+
+      tornadoNew_ = CreateMessage(
+         "WFUS53 KLSX 042114",
+         "/O.NEW.KLSX.TO.W.0012.210604T2114Z-210604T2145Z/",
+         "Tornado warning issued");
+      tornadoCon_ = CreateMessage(
+         "WWUS53 KLSX 042130",
+         "/O.CON.KLSX.TO.W.0012.000000T0000Z-210604T2145Z/",
+         "Tornado warning continued");
+      severeNew_ = CreateMessage(
+         "WUUS53 KLSX 042120",
+         "/O.NEW.KLSX.SV.W.0040.210604T2120Z-210604T2200Z/",
+         "Severe thunderstorm warning issued");
+   }
+
+   void TearDown() override { std::filesystem::remove_all(storePath_); }
+
+   void AppendMessages(TextEventStore& store)
+   {
+      EXPECT_TRUE(
+         store.Append(GetKey(tornadoNew_), kIssuanceTime_, *tornadoNew_));
+      EXPECT_TRUE(store.Append(
+         GetKey(tornadoCon_), kIssuanceTime_ + 30min, *tornadoCon_));
+      EXPECT_TRUE(store.Append(
+         GetKey(severeNew_), kIssuanceTime_ + 20min, *severeNew_));
+   }
+
+   std::filesystem::path                      storePath_ {};
+   std::shared_ptr<awips::TextProductMessage> tornadoNew_ {};
+   std::shared_ptr<awips::TextProductMessage> tornadoCon_ {};
+   std::shared_ptr<awips::TextProductMessage> severeNew_ {};
+};
+
+TEST_F(TextEventStoreTest, ReadByKey)
+{
+   {
+      TextEventStore store {storePath_.string()};
+      AppendMessages(store);
+   }
+
+   TextEventStore store {storePath_.string()};
+
+   EXPECT_EQ(store.record_count(), 3u);
+
+   auto messages = store.Read(GetKey(tornadoNew_));
+
+   ASSERT_EQ(messages.size(), 2u);
+   EXPECT_EQ(messages[0]->message_content(), tornadoNew_->message_content());
+   EXPECT_EQ(messages[1]->message_content(), tornadoCon_->message_content());
+   EXPECT_EQ(*messages[1]->wmo_header(), *tornadoCon_->wmo_header());
+   ASSERT_EQ(messages[1]->segment_count(), 1u);
+   EXPECT_EQ(messages[1]->segment(0)->productContent_,
+             tornadoCon_->segment(0)->productContent_);
+
+   EXPECT_TRUE(store.Read(types::TextEventKey {}).empty());
+}
+
+TEST_F(TextEventStoreTest, ReadByTime)
+{
+   TextEventStore store {storePath_.string()};
+   AppendMessages(store);
+
+   auto messages = store.Read(kIssuanceTime_ + 10min);
+
+   ASSERT_EQ(messages.size(), 2u);
+   EXPECT_EQ(messages[0]->message_content(), severeNew_->message_content());
+   EXPECT_EQ(messages[1]->message_content(), tornadoCon_->message_content());
+
+   messages = store.Read(kIssuanceTime_, kIssuanceTime_ + 20min);
+
+   ASSERT_EQ(messages.size(), 1u);
+   EXPECT_EQ(messages[0]->message_content(), tornadoNew_->message_content());
+}
+
+TEST_F(TextEventStoreTest, HighWaterMark)
+{
+   {
+      TextEventStore store {storePath_.string()};
+      EXPECT_EQ(store.high_water_mark(),
+                std::chrono::system_clock::time_point {});
+
+      store.SetHighWaterMark(kIssuanceTime_);
+      store.SetHighWaterMark(kIssuanceTime_ - 1h);
+      EXPECT_EQ(store.high_water_mark(), kIssuanceTime_);
+   }
+
+   TextEventStore store {storePath_.string()};
+   EXPECT_EQ(store.high_water_mark(), kIssuanceTime_);
+}
+
+TEST_F(TextEventStoreTest, IncompleteRecord)
+{
+   {
+      TextEventStore store {storePath_.string()};
+      AppendMessages(store);
+   }
+
+   // Simulate an interrupted append
+   const auto logPath = storePath_ / "text_events.log";
+   {
+      std::ofstream os {logPath, std::ios_base::binary | std::ios_base::app};
+      os.write("\xff\x00\x00\x00\x01", 5);
+   }
+
+   {
+      TextEventStore store {storePath_.string()};
+      EXPECT_EQ(store.record_count(), 3u);
+      EXPECT_TRUE(store.Append(
+         GetKey(severeNew_), kIssuanceTime_ + 40min, *severeNew_));
+   }
+
+   TextEventStore store {storePath_.string()};
+   EXPECT_EQ(store.record_count(), 4u);
+   EXPECT_EQ(store.Read(GetKey(severeNew_)).size(), 2u);
+}
+
+TEST_F(TextEventStoreTest, InvalidStore)
+{
+   std::filesystem::create_directories(storePath_);
+   {
+      std::ofstream os {storePath_ / "text_events.log"};
+      os << "not a text event store";
+   }
+
+   TextEventStore store {storePath_.string()};
+   EXPECT_EQ(store.record_count(), 0u);
+
+   AppendMessages(store);
+   EXPECT_EQ(store.record_count(), 3u);
+}
+
+TEST_F(TextEventStoreTest, Prune)
+{
+   {
+      TextEventStore store {storePath_.string()};
+      AppendMessages(store);
+      store.SetHighWaterMark(kIssuanceTime_ + 1h);
+
+      EXPECT_EQ(store.Prune(kIssuanceTime_ + 10min), 1u);
+      EXPECT_EQ(store.record_count(), 2u);
+      EXPECT_EQ(store.Prune(kIssuanceTime_ + 10min), 0u);
+   }
+
+   TextEventStore store {storePath_.string()};
+
+   EXPECT_EQ(store.record_count(), 2u);
+   EXPECT_EQ(store.high_water_mark(), kIssuanceTime_ + 1h);
+
+   auto messages = store.Read(GetKey(tornadoNew_));
+   ASSERT_EQ(messages.size(), 1u);
+   EXPECT_EQ(messages[0]->message_content(), tornadoCon_->message_content());
+}
+
+TEST_F(TextEventStoreTest, MemoryOnly)
+{
+   TextEventStore store {""};
+   AppendMessages(store);
+   store.SetHighWaterMark(kIssuanceTime_);
+
+   EXPECT_EQ(store.record_count(), 3u);
+   EXPECT_EQ(store.high_water_mark(), kIssuanceTime_);
+   EXPECT_EQ(store.Read(GetKey(tornadoNew_)).size(), 2u);
+   EXPECT_EQ(store.Prune(kIssuanceTime_ + 10min), 1u);
+   EXPECT_EQ(store.Read(GetKey(tornadoNew_)).size(), 1u);
+   EXPECT_FALSE(std::filesystem::exists(storePath_));
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
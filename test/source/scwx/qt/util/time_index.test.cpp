@@ -0,0 +1,166 @@
+#include <scwx/qt/util/time_index.hpp>
+
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+typedef TimeIndex<std::string> StringTimeIndex;
+
+static StringTimeIndex::TimePoint Time(int minutes)
+{
+   return StringTimeIndex::TimePoint {std::chrono::hours {24 * 365 * 50} +
+                                      std::chrono::minutes {minutes}};
+}
+
+static std::vector<StringTimeIndex::TimePoint>
+Times(const StringTimeIndex& index)
+{
+   std::vector<StringTimeIndex::TimePoint> times {};
+   for (auto& entry : *index.snapshot())
+   {
+      times.push_back(entry.time_);
+   }
+   return times;
+}
+
+TEST(TimeIndexTest, Merge)
+{
+   StringTimeIndex index {};
+
+   EXPECT_TRUE(index.empty());
+   EXPECT_EQ(index.Merge({Time(10), Time(5), Time(10), Time(0)}), 3u);
+   EXPECT_EQ(Times(index),
+             (std::vector<StringTimeIndex::TimePoint> {
+                Time(0), Time(5), Time(10)}));
+
+   // Time points already present do not publish a new snapshot
+   auto snapshot = index.snapshot();
+   EXPECT_EQ(index.Merge({Time(5), Time(0)}), 0u);
+   EXPECT_EQ(index.snapshot(), snapshot);
+
+   // Append
+   EXPECT_EQ(index.Merge({Time(15), Time(20)}), 2u);
+
+   // Interleave
+   EXPECT_EQ(index.Merge({Time(-5), Time(7), Time(12), Time(20)}), 3u);
+   EXPECT_EQ(Times(index),
+             (std::vector<StringTimeIndex::TimePoint> {Time(-5),
+                                                       Time(0),
+                                                       Time(5),
+                                                       Time(7),
+                                                       Time(10),
+                                                       Time(12),
+                                                       Time(15),
+                                                       Time(20)}));
+
+   // The previous snapshot is unchanged
+   EXPECT_EQ(snapshot->size(), 3u);
+}
+
+TEST(TimeIndexTest, Store)
+{
+   StringTimeIndex index {};
+   index.Merge({Time(0), Time(10)});
+
+   auto record1 = std::make_shared<std::string>("record1");
+   auto record2 = std::make_shared<std::string>("record2");
+
+   // Store into an existing slot, and a new time point
+   EXPECT_EQ(index.Store(Time(10), record1), record1);
+   EXPECT_EQ(index.Store(Time(5), record2), record2);
+   EXPECT_EQ(index.size(), 3u);
+   EXPECT_EQ(index.Find(Time(10)), record1);
+   EXPECT_EQ(index.Find(Time(5)), record2);
+   EXPECT_EQ(index.Find(Time(0)), nullptr);
+   EXPECT_EQ(index.Find(Time(1)), nullptr);
+
+   // An unexpired record is retained
+   auto record3 = std::make_shared<std::string>("record3");
+   EXPECT_EQ(index.Store(Time(10), record3), record1);
+
+   // An expired record is replaced
+   record1.reset();
+   EXPECT_EQ(index.Find(Time(10)), nullptr);
+   EXPECT_EQ(index.Store(Time(10), record3), record3);
+
+   // Merging retains records
+   index.Merge({Time(7)});
+   EXPECT_EQ(index.Find(Time(10)), record3);
+
+   // Storing at an existing time point does not publish a new snapshot, and
+   // the record is visible through a held snapshot
+   auto snapshot = index.snapshot();
+   EXPECT_EQ(index.Store(Time(0), record2), record2);
+   EXPECT_EQ(index.snapshot(), snapshot);
+   EXPECT_EQ(snapshot->front().record_->lock(), record2);
+}
+
+TEST(TimeIndexTest, FindBounded)
+{
+   StringTimeIndex index {};
+
+   EXPECT_FALSE(index.FindBounded(Time(0)).has_value());
+
+   auto record = std::make_shared<std::string>("record");
+   index.Merge({Time(0), Time(10), Time(20)});
+   index.Store(Time(10), record);
+
+   EXPECT_EQ(index.FindBounded(Time(10))->time_, Time(10));
+   EXPECT_EQ(index.FindBounded(Time(10))->record_, record);
+   EXPECT_EQ(index.FindBounded(Time(15))->time_, Time(10));
+   EXPECT_EQ(index.FindBounded(Time(25))->time_, Time(20));
+   EXPECT_EQ(index.FindBounded(Time(25))->record_, nullptr);
+
+   // Before the first entry, the first entry is a substitute
+   EXPECT_EQ(index.FindBounded(Time(-5))->time_, Time(0));
+
+   // A default time point returns the latest entry
+   EXPECT_EQ(index.FindBounded({})->time_, Time(20));
+}
+
+TEST(TimeIndexTest, ConcurrentReaders)
+{
+   StringTimeIndex   index {};
+   std::atomic<bool> done {false};
+
+   std::thread reader(
+      [&]()
+      {
+         while (!done)
+         {
+            auto snapshot = index.snapshot();
+            EXPECT_TRUE(std::is_sorted(
+               snapshot->cbegin(),
+               snapshot->cend(),
+               [](const auto& a, const auto& b) { return a.time_ < b.time_; }));
+
+            auto result = index.FindBounded(Time(500));
+            if (result.has_value())
+            {
+               EXPECT_LE(result->time_, Time(500));
+            }
+         }
+      });
+
+   for (int i = 0; i < 1000; i += 2)
+   {
+      index.Merge({Time(1999 - i), Time(i)});
+   }
+
+   done = true;
+   reader.join();
+
+   EXPECT_EQ(index.size(), 1000u);
+}
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
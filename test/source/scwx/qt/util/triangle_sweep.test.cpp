@@ -0,0 +1,504 @@
+#include <scwx/qt/util/triangle_sweep.hpp>
+#include <scwx/common/constants.hpp>
+#include <scwx/wsr88d/ar2v_file.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <random>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace qt
+{
+namespace util
+{
+
+static constexpr float         kGateSize_     = 250.0f;
+static constexpr float         kLatitude_     = 38.7f;
+static constexpr float         kLongitude_    = -90.7f;
+static constexpr std::uint16_t kSnrThreshold_ = 2u;
+
+static const std::vector<float> kCoordinates_ = []()
+{
+   // Distinct values for each coordinate, such that any difference in the
+   // coordinates referenced by a vertex is detected
+   std::vector<float> coordinates(common::MAX_0_5_DEGREE_RADIALS *
+                                  common::MAX_DATA_MOMENT_GATES * 2);
+   std::iota(coordinates.begin(), coordinates.end(), 0.0f);
+   return coordinates;
+}();
+
+/**
+ * Reference implementation, from the per-gate loop previously used to compute
+ * the sweep in Level2ProductView.
+ */
+static TriangleSweep ReferenceSweep(const std::vector<PolarRadial>& radials,
+                                    const std::vector<float>& coordinates,
+                                    std::size_t               vertexRadials,
+                                    float                     gateSizeMeters,
+                                    float                     latitude,
+                                    float                     longitude,
+                                    std::uint16_t             snrThreshold)
+{
+   static constexpr std::uint16_t RANGE_FOLDED      = 1u;
+   static constexpr std::uint32_t VERTICES_PER_BIN  = 6u;
+   static constexpr std::uint32_t VALUES_PER_VERTEX = 2u;
+
+   TriangleSweep sweep {};
+
+   const PolarRadial& radial0 = radials.front();
+
+   std::size_t radialCount = std::min<std::size_t>(
+      radials.back().index_ + 1, common::MAX_0_5_DEGREE_RADIALS);
+
+   const std::size_t gates = radial0.gateCount_;
+
+   std::vector<float>& vertices = sweep.vertices_;
+   std::size_t         vIndex   = 0;
+   vertices.resize(vertexRadials * gates * VERTICES_PER_BIN *
+                   VALUES_PER_VERTEX);
+
+   std::vector<std::uint8_t>&  dataMoments8  = sweep.dataMoments8_;
+   std::vector<std::uint16_t>& dataMoments16 = sweep.dataMoments16_;
+   std::vector<std::uint8_t>&  cfpMoments    = sweep.cfpMoments_;
+   std::size_t                 mIndex        = 0;
+
+   if (radial0.moments8_ != nullptr)
+   {
+      dataMoments8.resize(radialCount * gates * VERTICES_PER_BIN);
+   }
+   else
+   {
+      dataMoments16.resize(radialCount * gates * VERTICES_PER_BIN);
+   }
+
+   if (radial0.cfpMoments_ != nullptr)
+   {
+      cfpMoments.resize(radialCount * gates * VERTICES_PER_BIN);
+   }
+
+   constexpr std::uint16_t startRadial = 0u;
+
+   for (const PolarRadial& radialData : radials)
+   {
+      std::uint16_t radial = radialData.index_;
+
+      if ((radial0.moments8_ == nullptr) != (radialData.moments8_ == nullptr))
+      {
+         continue;
+      }
+
+      const std::int32_t dataMomentInterval  = radialData.gateInterval_;
+      const std::int32_t dataMomentIntervalH = dataMomentInterval / 2;
+      const std::int32_t dataMomentRange = std::max<std::int32_t>(
+         radialData.firstGateRange_, dataMomentIntervalH);
+
+      const std::int32_t gateSizeM = static_cast<std::int32_t>(gateSizeMeters);
+      const std::int32_t gateSize =
+         std::max<std::int32_t>(1, dataMomentInterval / gateSizeM);
+
+      const std::int32_t startGate =
+         (dataMomentRange - dataMomentIntervalH) / gateSizeM;
+      const std::int32_t numberOfDataMomentGates = std::min<std::int32_t>(
+         static_cast<std::int32_t>(radialData.gateCount_),
+         static_cast<std::int32_t>(gates));
+      const std::int32_t endGate = std::min<std::int32_t>(
+         startGate + numberOfDataMomentGates * gateSize,
+         static_cast<std::int32_t>(common::MAX_DATA_MOMENT_GATES));
+
+      const std::uint8_t*  dataMomentsArray8  = radialData.moments8_;
+      const std::uint16_t* dataMomentsArray16 = radialData.moments16_;
+      const std::uint8_t*  cfpMomentsArray    = nullptr;
+
+      if (cfpMoments.size() > 0)
+      {
+         cfpMomentsArray = radialData.cfpMoments_;
+      }
+
+      for (std::int32_t gate = startGate, i = 0; gate + gateSize <= endGate;
+           gate += gateSize, ++i)
+      {
+         if (gate < 0)
+         {
+            continue;
+         }
+
+         std::size_t vertexCount = (gate > 0) ? 6 : 3;
+
+         if (dataMomentsArray8 != nullptr)
+         {
+            std::uint8_t dataValue = dataMomentsArray8[i];
+            if (dataValue < snrThreshold && dataValue != RANGE_FOLDED)
+            {
+               continue;
+            }
+
+            for (std::size_t m = 0; m < vertexCount; m++)
+            {
+               dataMoments8[mIndex++] = dataMomentsArray8[i];
+
+               if (cfpMomentsArray != nullptr)
+               {
+                  cfpMoments[mIndex - 1] = cfpMomentsArray[i];
+               }
+            }
+         }
+         else
+         {
+            std::uint16_t dataValue = dataMomentsArray16[i];
+            if (dataValue < snrThreshold && dataValue != RANGE_FOLDED)
+            {
+               continue;
+            }
+
+            for (std::size_t m = 0; m < vertexCount; m++)
+            {
+               dataMoments16[mIndex++] = dataMomentsArray16[i];
+            }
+         }
+
+         if (gate > 0)
+         {
+            const std::int32_t baseCoord = gate - 1;
+
+            std::size_t offset1 = ((startRadial + radial) % vertexRadials *
+                                      common::MAX_DATA_MOMENT_GATES +
+                                   baseCoord) *
+                                  2;
+            std::size_t offset2 = offset1 + gateSize * 2;
+            std::size_t offset3 =
+               (((startRadial + radial + 1) % vertexRadials) *
+                   common::MAX_DATA_MOMENT_GATES +
+                baseCoord) *
+               2;
+            std::size_t offset4 = offset3 + gateSize * 2;
+
+            vertices[vIndex++] = coordinates[offset1];
+            vertices[vIndex++] = coordinates[offset1 + 1];
+            vertices[vIndex++] = coordinates[offset2];
+            vertices[vIndex++] = coordinates[offset2 + 1];
+            vertices[vIndex++] = coordinates[offset3];
+            vertices[vIndex++] = coordinates[offset3 + 1];
+            vertices[vIndex++] = coordinates[offset3];
+            vertices[vIndex++] = coordinates[offset3 + 1];
+            vertices[vIndex++] = coordinates[offset4];
+            vertices[vIndex++] = coordinates[offset4 + 1];
+            vertices[vIndex++] = coordinates[offset2];
+            vertices[vIndex++] = coordinates[offset2 + 1];
+         }
+         else
+         {
+            const std::int32_t baseCoord = gate;
+
+            std::size_t offset1 = ((startRadial + radial) % vertexRadials *
+                                      common::MAX_DATA_MOMENT_GATES +
+                                   baseCoord) *
+                                  2;
+            std::size_t offset2 =
+               (((startRadial + radial + 1) % vertexRadials) *
+                   common::MAX_DATA_MOMENT_GATES +
+                baseCoord) *
+               2;
+
+            vertices[vIndex++] = latitude;
+            vertices[vIndex++] = longitude;
+            vertices[vIndex++] = coordinates[offset1];
+            vertices[vIndex++] = coordinates[offset1 + 1];
+            vertices[vIndex++] = coordinates[offset2];
+            vertices[vIndex++] = coordinates[offset2 + 1];
+         }
+      }
+   }
+
+   vertices.resize(vIndex);
+
+   if (radial0.moments8_ != nullptr)
+   {
+      dataMoments8.resize(mIndex);
+   }
+   else
+   {
+      dataMoments16.resize(mIndex);
+   }
+
+   if (cfpMoments.size() > 0)
+   {
+      cfpMoments.resize(mIndex);
+   }
+
+   return sweep;
+}
+
+static void ExpectIdentical(const TriangleSweep& actual,
+                            const TriangleSweep& expected)
+{
+   ASSERT_EQ(actual.vertices_.size(), expected.vertices_.size());
+
+   // Compare the bit patterns of vertices
+   EXPECT_EQ(std::memcmp(actual.vertices_.data(),
+                         expected.vertices_.data(),
+                         actual.vertices_.size() * sizeof(float)),
+             0);
+   EXPECT_EQ(actual.dataMoments8_, expected.dataMoments8_);
+   EXPECT_EQ(actual.dataMoments16_, expected.dataMoments16_);
+   EXPECT_EQ(actual.cfpMoments_, expected.cfpMoments_);
+}
+
+static void ExpectIdentical(const std::vector<PolarRadial>& radials,
+                            std::size_t                     vertexRadials,
+                            std::uint16_t snrThreshold = kSnrThreshold_)
+{
+   TriangleSweep actual = BuildTriangleSweep(radials,
+                                             kCoordinates_,
+                                             vertexRadials,
+                                             kGateSize_,
+                                             kLatitude_,
+                                             kLongitude_,
+                                             snrThreshold);
+   TriangleSweep expected = ReferenceSweep(radials,
+                                           kCoordinates_,
+                                           vertexRadials,
+                                           kGateSize_,
+                                           kLatitude_,
+                                           kLongitude_,
+                                           snrThreshold);
+
+   ExpectIdentical(actual, expected);
+}
+
+static PolarRadial CreateRadial(std::uint16_t                    index,
+                                const std::vector<std::uint8_t>& moments,
+                                std::int32_t firstGateRange = 125,
+                                std::int32_t gateInterval   = 250)
+{
+   PolarRadial radial {};
+   radial.index_          = index;
+   radial.firstGateRange_ = firstGateRange;
+   radial.gateInterval_   = gateInterval;
+   radial.gateCount_      = moments.size();
+   radial.moments8_       = moments.data();
+   return radial;
+}
+
+TEST(TriangleSweepTest, Bins)
+{
+   std::vector<std::uint8_t> moments {10, 0, 1, 20};
+   std::vector<PolarRadial>  radials {CreateRadial(0, moments),
+                                     CreateRadial(1, moments)};
+
+   TriangleSweep sweep = BuildTriangleSweep(
+      radials, kCoordinates_, 2, kGateSize_, kLatitude_, kLongitude_, 2);
+
+   // The first bin starts at the radar site, and is a single triangle. The
+   // second bin is below the threshold, and the third bin is range folded.
+   ASSERT_EQ(sweep.dataMoments8_.size(), 2u * (3u + 6u + 6u));
+   EXPECT_TRUE(sweep.dataMoments16_.empty());
+   EXPECT_TRUE(sweep.cfpMoments_.empty());
+   EXPECT_EQ(sweep.vertices_.size(), sweep.dataMoments8_.size() * 2u);
+
+   EXPECT_EQ(sweep.dataMoments8_[0], 10u);
+   EXPECT_EQ(sweep.dataMoments8_[2], 10u);
+   EXPECT_EQ(sweep.dataMoments8_[3], 1u);
+   EXPECT_EQ(sweep.dataMoments8_[9], 20u);
+   EXPECT_EQ(sweep.dataMoments8_[14], 20u);
+
+   EXPECT_EQ(sweep.vertices_[0], kLatitude_);
+   EXPECT_EQ(sweep.vertices_[1], kLongitude_);
+
+   ExpectIdentical(radials, 2);
+}
+
+TEST(TriangleSweepTest, CoarseGates)
+{
+   // 1 km gates, with the first gate centered at the radar site and beyond
+   std::vector<std::uint8_t> moments(100);
+   std::iota(moments.begin(), moments.end(), std::uint8_t {0});
+
+   for (std::int32_t firstGateRange : {0, 500, 2125, -1000})
+   {
+      std::vector<PolarRadial> radials {};
+      for (std::uint16_t i = 0; i < 10; ++i)
+      {
+         radials.push_back(CreateRadial(i, moments, firstGateRange, 1000));
+      }
+
+      ExpectIdentical(radials, 11);
+   }
+}
+
+TEST(TriangleSweepTest, WordSizeAndCfp)
+{
+   std::mt19937                                 generator {42u};
+   std::uniform_int_distribution<std::uint16_t> distribution {0u, 8u};
+
+   // Values near the threshold, in runs longer and shorter than a block
+   std::vector<std::uint8_t>  moments8(1832);
+   std::vector<std::uint16_t> moments16(1832);
+   std::vector<std::uint8_t>  cfpMoments(1832);
+
+   for (std::size_t i = 0; i < moments8.size(); ++i)
+   {
+      const std::size_t   run   = i / 40 % 3;
+      const std::uint16_t value = (run == 0) ? 0u :
+                                  (run == 1) ? 100u :
+                                               distribution(generator);
+      moments8[i]   = static_cast<std::uint8_t>(value);
+      moments16[i]  = value;
+      cfpMoments[i] = static_cast<std::uint8_t>(i);
+   }
+
+   std::vector<PolarRadial> radials8 {};
+   std::vector<PolarRadial> radials16 {};
+
+   for (std::uint16_t i = 0; i < 720; ++i)
+   {
+      PolarRadial& radial8 = radials8.emplace_back(CreateRadial(i, moments8));
+      radial8.cfpMoments_  = cfpMoments.data();
+
+      PolarRadial& radial16 = radials16.emplace_back(radial8);
+      radial16.moments8_    = nullptr;
+      radial16.moments16_   = moments16.data();
+      radial16.cfpMoments_  = nullptr;
+   }
+
+   for (std::uint16_t snrThreshold :
+        std::initializer_list<std::uint16_t> {0u, 2u, 5u, 300u})
+   {
+      ExpectIdentical(radials8, 720, snrThreshold);
+      ExpectIdentical(radials16, 720, snrThreshold);
+
+      radials8[0].cfpMoments_ = nullptr;
+      ExpectIdentical(radials8, 720, snrThreshold);
+      radials8[0].cfpMoments_ = cfpMoments.data();
+   }
+}
+
+TEST(TriangleSweepTest, MixedWordSize)
+{
+   std::vector<std::uint8_t>  moments8 {10, 20, 30};
+   std::vector<std::uint16_t> moments16 {10, 20, 30};
+
+   std::vector<PolarRadial> radials {CreateRadial(0, moments8),
+                                     CreateRadial(1, moments8),
+                                     CreateRadial(2, moments8)};
+   radials[1].moments8_  = nullptr;
+   radials[1].moments16_ = moments16.data();
+
+   TriangleSweep sweep = BuildTriangleSweep(
+      radials, kCoordinates_, 3, kGateSize_, kLatitude_, kLongitude_, 2);
+
+   // The radial with a different word size is skipped
+   EXPECT_EQ(sweep.dataMoments8_.size(), 2u * (3u + 6u + 6u));
+
+   ExpectIdentical(radials, 3);
+}
+
+TEST(TriangleSweepTest, Empty)
+{
+   TriangleSweep sweep = BuildTriangleSweep(
+      {}, kCoordinates_, 0, kGateSize_, kLatitude_, kLongitude_, 2);
+
+   EXPECT_TRUE(sweep.vertices_.empty());
+   EXPECT_TRUE(sweep.dataMoments8_.empty());
+   EXPECT_TRUE(sweep.dataMoments16_.empty());
+   EXPECT_TRUE(sweep.cfpMoments_.empty());
+}
+
+class TriangleSweepSampleTest : public testing::TestWithParam<std::string>
+{
+};
+
+TEST_P(TriangleSweepSampleTest, Identical)
+{
+   auto file = std::make_shared<wsr88d::Ar2vFile>();
+   ASSERT_TRUE(file->LoadFile(std::string(SCWX_TEST_DATA_DIR) + GetParam()));
+
+   std::size_t sweeps = 0;
+
+   for (auto& elevationPair : file->radar_data())
+   {
+      auto& radarData = elevationPair.second;
+
+      for (wsr88d::rda::DataBlockType dataBlockType :
+           wsr88d::rda::MomentDataBlockTypeIterator())
+      {
+         auto radarData0  = radarData->cbegin()->second;
+         auto momentData0 = radarData0->moment_data_block(dataBlockType);
+
+         if (momentData0 == nullptr)
+         {
+            continue;
+         }
+
+         const bool cfpEnabled =
+            dataBlockType == wsr88d::rda::DataBlockType::MomentRef &&
+            radarData0->moment_data_block(
+               wsr88d::rda::DataBlockType::MomentCfp) != nullptr;
+
+         // Describe each radial, as Level2ProductView does
+         std::vector<PolarRadial> radials {};
+
+         for (auto& radialPair : *radarData)
+         {
+            auto& radialData = radialPair.second;
+            auto  momentData = radialData->moment_data_block(dataBlockType);
+
+            if (momentData == nullptr ||
+                momentData->data_word_size() != momentData0->data_word_size())
+            {
+               continue;
+            }
+
+            PolarRadial& radial    = radials.emplace_back();
+            radial.index_          = radialPair.first;
+            radial.firstGateRange_ = momentData->data_moment_range_raw();
+            radial.gateInterval_ =
+               momentData->data_moment_range_sample_interval_raw();
+            radial.gateCount_ = momentData->number_of_data_moment_gates();
+
+            if (momentData->data_word_size() == 8)
+            {
+               radial.moments8_ = reinterpret_cast<const std::uint8_t*>(
+                  momentData->data_moments());
+            }
+            else
+            {
+               radial.moments16_ = reinterpret_cast<const std::uint16_t*>(
+                  momentData->data_moments());
+            }
+
+            if (cfpEnabled)
+            {
+               auto cfpData = radialData->moment_data_block(
+                  wsr88d::rda::DataBlockType::MomentCfp);
+               radial.cfpMoments_ = reinterpret_cast<const std::uint8_t*>(
+                  cfpData->data_moments());
+            }
+         }
+
+         const std::uint16_t snrThreshold =
+            std::max<std::int16_t>(2, momentData0->snr_threshold_raw());
+         const std::size_t vertexRadials = std::min<std::size_t>(
+            radarData->crbegin()->first + 1, common::MAX_0_5_DEGREE_RADIALS);
+
+         ExpectIdentical(radials, vertexRadials, snrThreshold);
+         ++sweeps;
+      }
+   }
+
+   EXPECT_GT(sweeps, 0u);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+   TriangleSweepTest,
+   TriangleSweepSampleTest,
+   testing::Values("/nexrad/level2/KCLE20021110_221234",
+                   "/nexrad/level2/Level2_KLSX_20210527_1757.ar2v",
+                   "/nexrad/level2/Level2_TSTL_20220213_2357.ar2v"));
+
+} // namespace util
+} // namespace qt
+} // namespace scwx
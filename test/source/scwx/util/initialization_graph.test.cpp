@@ -0,0 +1,136 @@
+#include <scwx/util/initialization_graph.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace util
+{
+
+TEST(InitializationGraphTest, DependencyOrder)
+{
+   InitializationGraph graph {"test"};
+
+   std::mutex               m {};
+   std::vector<std::string> order {};
+
+   auto Record = [&](const std::string& name)
+   {
+      return [&, name]()
+      {
+         std::unique_lock lock {m};
+         order.push_back(name);
+      };
+   };
+
+   // Dependencies are added after their dependents
+   graph.AddStep("d", Record("d"), {"b", "c"});
+   graph.AddStep("b", Record("b"), {"a"});
+   graph.AddStep("c", Record("c"), {"a"});
+   graph.AddStep("a", Record("a"));
+
+   EXPECT_TRUE(graph.Run());
+
+   ASSERT_EQ(order.size(), 4u);
+   EXPECT_EQ(order.front(), "a");
+   EXPECT_EQ(order.back(), "d");
+
+   auto trace = graph.trace();
+   ASSERT_EQ(trace.size(), 4u);
+   EXPECT_EQ(trace.front().name_, "a");
+   EXPECT_TRUE(trace.front().succeeded_);
+   EXPECT_GE(trace.back().start_,
+             trace.front().start_ + trace.front().duration_);
+}
+
+TEST(InitializationGraphTest, IndependentStepsRunInParallel)
+{
+   InitializationGraph graph {"test", 2u};
+
+   std::atomic<int> arrived {0};
+
+   // Each step waits for the other to start, which only completes if both run
+   // concurrently
+   auto Rendezvous = [&]()
+   {
+      ++arrived;
+      auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+      while (arrived < 2 && std::chrono::steady_clock::now() < timeout)
+      {
+         std::this_thread::yield();
+      }
+      if (arrived < 2)
+      {
+         throw std::runtime_error("Steps did not run in parallel");
+      }
+   };
+
+   graph.AddStep("a", Rendezvous);
+   graph.AddStep("b", Rendezvous);
+
+   EXPECT_TRUE(graph.Run());
+}
+
+TEST(InitializationGraphTest, CallerAffinity)
+{
+   InitializationGraph graph {"test"};
+
+   const std::thread::id callerId = std::this_thread::get_id();
+   std::thread::id       workerId {};
+   std::thread::id       mainId {};
+
+   graph.AddStep("worker", [&]() { workerId = std::this_thread::get_id(); });
+   graph.AddStep(
+      "main",
+      [&]() { mainId = std::this_thread::get_id(); },
+      {"worker"},
+      InitializationGraph::ThreadAffinity::Caller);
+
+   EXPECT_TRUE(graph.Run());
+   EXPECT_EQ(mainId, callerId);
+   EXPECT_NE(workerId, callerId);
+}
+
+TEST(InitializationGraphTest, FailedStep)
+{
+   InitializationGraph graph {"test"};
+
+   bool dependentRan = false;
+
+   graph.AddStep("a", []() { throw std::runtime_error("failure"); });
+   graph.AddStep("b", [&]() { dependentRan = true; }, {"a"});
+
+   EXPECT_FALSE(graph.Run());
+   EXPECT_TRUE(dependentRan);
+
+   auto trace = graph.trace();
+   ASSERT_EQ(trace.size(), 2u);
+   EXPECT_FALSE(trace[0].succeeded_);
+   EXPECT_TRUE(trace[1].succeeded_);
+}
+
+TEST(InitializationGraphTest, InvalidGraph)
+{
+   InitializationGraph unknown {"test"};
+   unknown.AddStep("a", []() {}, {"b"});
+   EXPECT_THROW(unknown.Run(), std::invalid_argument);
+
+   InitializationGraph cycle {"test"};
+   cycle.AddStep("a", []() {}, {"c"});
+   cycle.AddStep("b", []() {}, {"a"});
+   cycle.AddStep("c", []() {}, {"b"});
+   EXPECT_THROW(cycle.Run(), std::invalid_argument);
+
+   InitializationGraph duplicate {"test"};
+   duplicate.AddStep("a", []() {});
+   duplicate.AddStep("a", []() {});
+   EXPECT_THROW(duplicate.Run(), std::invalid_argument);
+}
+
+} // namespace util
+} // namespace scwx
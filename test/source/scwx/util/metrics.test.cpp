@@ -0,0 +1,130 @@
+#include <scwx/util/metrics.hpp>
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace util
+{
+namespace metrics
+{
+
+TEST(MetricsTest, BucketBounds)
+{
+   for (std::uint64_t value :
+        {0ull, 1ull, 15ull, 16ull, 17ull, 31ull, 32ull, 33ull, 1000ull,
+         123456789ull, 0xFFFFFFFFFFFFFFFFull})
+   {
+      std::size_t index = Histogram::BucketIndex(value);
+
+      EXPECT_LT(index, Histogram::kBucketCount);
+      EXPECT_GE(Histogram::BucketUpperBound(index), value);
+
+      if (index > 0)
+      {
+         EXPECT_LT(Histogram::BucketUpperBound(index - 1), value);
+      }
+   }
+}
+
+TEST(MetricsTest, HistogramQuantiles)
+{
+   Histogram histogram {};
+
+   for (std::uint64_t i = 1; i <= 1000; ++i)
+   {
+      histogram.Record(i * 1000u);
+   }
+
+   EXPECT_EQ(histogram.count(), 1000u);
+   EXPECT_EQ(histogram.max(), 1'000'000u);
+   EXPECT_EQ(histogram.sum(), 500'500'000u);
+
+   // Values are accurate to within 1/16
+   EXPECT_NEAR(static_cast<double>(histogram.ValueAtQuantile(0.5)),
+               500'000.0,
+               500'000.0 / 16.0);
+   EXPECT_NEAR(static_cast<double>(histogram.ValueAtQuantile(0.99)),
+               990'000.0,
+               990'000.0 / 16.0);
+   EXPECT_EQ(histogram.ValueAtQuantile(1.0), 1'000'000u);
+
+   histogram.Reset();
+
+   EXPECT_EQ(histogram.count(), 0u);
+   EXPECT_EQ(histogram.ValueAtQuantile(0.5), 0u);
+}
+
+TEST(MetricsTest, ConcurrentRecord)
+{
+   Histogram histogram {};
+   Counter   counter {};
+
+   std::vector<std::thread> threads {};
+
+   for (int t = 0; t < 4; ++t)
+   {
+      threads.emplace_back(
+         [&]()
+         {
+            for (std::uint64_t i = 0; i < 10000; ++i)
+            {
+               histogram.Record(i);
+               counter.Increment();
+            }
+         });
+   }
+
+   for (auto& thread : threads)
+   {
+      thread.join();
+   }
+
+   EXPECT_EQ(histogram.count(), 40000u);
+   EXPECT_EQ(histogram.max(), 9999u);
+   EXPECT_EQ(counter.value(), 40000u);
+}
+
+TEST(MetricsTest, Registry)
+{
+   Registry registry {};
+
+   Counter&   counter   = registry.GetCounter(MetricName("download", "KLSX"));
+   Gauge&     gauge     = registry.GetGauge("records");
+   Histogram& histogram = registry.GetHistogram("parse");
+
+   EXPECT_EQ(&counter, &registry.GetCounter("download[KLSX]"));
+
+   counter.Increment(3);
+   gauge.Set(5);
+   gauge.Add(-2);
+
+   {
+      ScopedTimer timer {histogram};
+   }
+
+   std::vector<MetricSnapshot> snapshot = registry.Snapshot();
+
+   ASSERT_EQ(snapshot.size(), 3u);
+   EXPECT_EQ(snapshot[0].name_, "download[KLSX]");
+   EXPECT_EQ(snapshot[0].type_, MetricType::Counter);
+   EXPECT_EQ(snapshot[0].value_, 3);
+   EXPECT_EQ(snapshot[1].name_, "parse");
+   EXPECT_EQ(snapshot[1].type_, MetricType::Histogram);
+   EXPECT_EQ(snapshot[1].count_, 1u);
+   EXPECT_EQ(snapshot[2].name_, "records");
+   EXPECT_EQ(snapshot[2].type_, MetricType::Gauge);
+   EXPECT_EQ(snapshot[2].value_, 3);
+
+   registry.Reset();
+
+   EXPECT_EQ(counter.value(), 0u);
+   EXPECT_EQ(histogram.count(), 0u);
+   EXPECT_EQ(gauge.value(), 3);
+}
+
+} // namespace metrics
+} // namespace util
+} // namespace scwx
@@ -0,0 +1,172 @@
+#include <scwx/util/record_layout.hpp>
+
+#include <limits>
+#include <map>
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace util
+{
+
+struct TestPoint
+{
+   std::int16_t x_ {0};
+   std::int16_t y_ {0};
+};
+
+using TestPointLayout = RecordLayout<4,
+                                     Field<&TestPoint::x_, 0>,  // 0-1
+                                     Field<&TestPoint::y_, 2>>; // 2-3
+
+struct TestRecord
+{
+   std::string                  name_ {};
+   std::uint32_t                id_ {0};
+   float                        value_ {0.0f};
+   std::uint8_t                 flags_ {0};
+   std::array<std::uint16_t, 3> samples_ {};
+   std::map<int, std::uint16_t> channels_ {};
+   TestPoint                    point_ {};
+};
+
+using TestRecordLayout =
+   RecordLayout<36,
+                Field<&TestRecord::name_, 0, FixedString<6>>,     // 0-5
+                Field<&TestRecord::id_, 6>,                       // 6-9
+                Field<&TestRecord::value_, 10>,                   // 10-13
+                Field<&TestRecord::flags_, 14>,                   // 14
+                Field<&TestRecord::samples_, 16>,                 // 16-21
+                ElementField<&TestRecord::channels_, 1, 22, 3>,   // 22-27
+                Field<&TestRecord::point_, 28, TestPointLayout>>; // 28-31
+
+static const std::array<std::uint8_t, 36> kTestRecordData_ {
+   'K', 'L', 'S', 'X', 0, 0,   // name
+   0x01, 0x02, 0x03, 0x04,     // id
+   0x3f, 0xc0, 0x00, 0x00,     // value (1.5)
+   0x80, 0x00,                 // flags, spare
+   0x00, 0x01, 0x00, 0x02,     // samples
+   0xff, 0xfe,                 //
+   0x00, 0x0a, 0x00, 0x0b,     // channels
+   0x00, 0x0c,                 //
+   0xff, 0xff, 0x00, 0x10,     // point
+   0x00, 0x00, 0x00, 0x00};    // spare
+
+TEST(RecordLayoutTest, ByteSwap)
+{
+   static_assert(ByteSwap(std::uint16_t {0x0102}) == 0x0201);
+   static_assert(ByteSwap(std::uint32_t {0x01020304}) == 0x04030201);
+   static_assert(ByteSwap(std::int16_t {-2}) == std::int16_t {-257});
+
+   EXPECT_EQ(ByteSwap(std::uint64_t {0x0102030405060708ull}),
+             0x0807060504030201ull);
+   EXPECT_EQ(ByteSwap(ByteSwap(1.5f)), 1.5f);
+}
+
+TEST(RecordLayoutTest, BigEndianToNativeSpan)
+{
+   const std::array<std::uint8_t, 10> data {
+      0x00, 0x01, 0x00, 0x02, 0x01, 0x00, 0xff, 0xfe, 0x80, 0x00};
+
+   std::vector<std::uint16_t> values(data.size() / 2);
+   std::memcpy(values.data(), data.data(), data.size());
+   BigEndianToNative(std::span {values});
+
+   EXPECT_EQ(values,
+             (std::vector<std::uint16_t> {1u, 2u, 256u, 65534u, 32768u}));
+}
+
+TEST(RecordLayoutTest, Load)
+{
+   TestRecord record {};
+   TestRecordLayout::Load(kTestRecordData_.data(), record);
+
+   EXPECT_EQ(record.name_, std::string("KLSX\0\0", 6));
+   EXPECT_EQ(record.id_, 0x01020304u);
+   EXPECT_EQ(record.value_, 1.5f);
+   EXPECT_EQ(record.flags_, 0x80u);
+   EXPECT_EQ(record.samples_,
+             (std::array<std::uint16_t, 3> {1u, 2u, 65534u}));
+   EXPECT_EQ(record.channels_,
+             (std::map<int, std::uint16_t> {{1, 10u}, {2, 11u}, {3, 12u}}));
+   EXPECT_EQ(record.point_.x_, -1);
+   EXPECT_EQ(record.point_.y_, 16);
+}
+
+TEST(RecordLayoutTest, StoreRoundTrip)
+{
+   TestRecord record {};
+   TestRecordLayout::Load(kTestRecordData_.data(), record);
+
+   std::array<std::uint8_t, TestRecordLayout::kSize> data {};
+   data.fill(0xaa);
+   TestRecordLayout::Store(record, data.data());
+
+   EXPECT_EQ(data, kTestRecordData_);
+}
+
+TEST(RecordLayoutTest, StoreMissingMapKey)
+{
+   TestRecord record {};
+   record.channels_[2] = 0x1234u;
+
+   std::array<std::uint8_t, TestRecordLayout::kSize> data {};
+   TestRecordLayout::Store(record, data.data());
+
+   EXPECT_EQ(LoadBigEndian<std::uint16_t>(&data[22]), 0u);
+   EXPECT_EQ(LoadBigEndian<std::uint16_t>(&data[24]), 0x1234u);
+   EXPECT_EQ(LoadBigEndian<std::uint16_t>(&data[26]), 0u);
+}
+
+TEST(RecordLayoutTest, Read)
+{
+   std::istringstream is {std::string(kTestRecordData_.cbegin(),
+                                      kTestRecordData_.cend()) +
+                          "next"};
+
+   TestRecord record {};
+   EXPECT_TRUE(TestRecordLayout::Read(is, record));
+   EXPECT_EQ(record.id_, 0x01020304u);
+   EXPECT_EQ(is.tellg(), std::streampos {TestRecordLayout::kSize});
+}
+
+TEST(RecordLayoutTest, ReadTruncated)
+{
+   std::istringstream is {
+      std::string(kTestRecordData_.cbegin(), kTestRecordData_.cend() - 1)};
+
+   TestRecord record {};
+   record.id_ = 42u;
+
+   EXPECT_FALSE(TestRecordLayout::Read(is, record));
+   EXPECT_TRUE(is.fail());
+   EXPECT_EQ(record.id_, 42u);
+   EXPECT_TRUE(record.name_.empty());
+}
+
+TEST(RecordLayoutTest, RecordViewBounds)
+{
+   RecordView view {kTestRecordData_};
+
+   EXPECT_EQ(view.Get<std::uint32_t>(6), 0x01020304u);
+   EXPECT_EQ(view.Get<std::int16_t>(34), std::int16_t {0});
+   EXPECT_FALSE(view.Get<std::uint32_t>(34).has_value());
+   EXPECT_FALSE(view.Get<std::uint8_t>(36).has_value());
+   EXPECT_FALSE(view.contains(1, std::numeric_limits<std::size_t>::max()));
+
+   TestPoint point {};
+   EXPECT_TRUE(view.Load<TestPointLayout>(28, point));
+   EXPECT_EQ(point.y_, 16);
+   EXPECT_FALSE(view.Load<TestPointLayout>(33, point));
+
+   auto subview = view.subview(28, 4);
+   ASSERT_TRUE(subview.has_value());
+   EXPECT_EQ(subview->size(), 4u);
+   EXPECT_EQ(subview->Get<std::int16_t>(0), std::int16_t {-1});
+   EXPECT_FALSE(view.subview(30, 8).has_value());
+}
+
+} // namespace util
+} // namespace scwx
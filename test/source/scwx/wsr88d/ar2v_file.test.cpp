@@ -1,5 +1,13 @@
 #include <scwx/wsr88d/ar2v_file.hpp>
+#include <scwx/util/time.hpp>
 
+#include <fstream>
+#include <sstream>
+
+#include <boost/iostreams/copy.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
+#include <boost/iostreams/filter/bzip2.hpp>
+#include <boost/iostreams/filtering_streambuf.hpp>
 #include <gtest/gtest.h>
 
 namespace scwx
@@ -24,6 +32,233 @@ TEST_P(Ar2vValidFileTest, ValidFile)
    EXPECT_EQ(file.message_count(), param.second);
 }
 
+TEST_P(Ar2vValidFileTest, LazyLoad)
+{
+   auto& param = GetParam();
+
+   Ar2vFile eagerFile;
+   Ar2vFile lazyFile {true};
+   bool     eagerFileValid =
+      eagerFile.LoadFile(std::string(SCWX_TEST_DATA_DIR) + param.first);
+   bool lazyFileValid =
+      lazyFile.LoadFile(std::string(SCWX_TEST_DATA_DIR) + param.first);
+
+   EXPECT_EQ(eagerFileValid, true);
+   EXPECT_EQ(lazyFileValid, true);
+   EXPECT_EQ(lazyFile.message_count(), param.second);
+   EXPECT_EQ(lazyFile.end_time(), eagerFile.end_time());
+
+   for (rda::DataBlockType dataBlockType : rda::MomentDataBlockTypeIterator())
+   {
+      auto [eagerScan, eagerCut, eagerCuts] = eagerFile.GetElevationScan(
+         dataBlockType, 0.5f, std::chrono::system_clock::time_point {});
+      auto [lazyScan, lazyCut, lazyCuts] = lazyFile.GetElevationScan(
+         dataBlockType, 0.5f, std::chrono::system_clock::time_point {});
+
+      EXPECT_EQ(lazyCut, eagerCut);
+      EXPECT_EQ(lazyCuts, eagerCuts);
+      ASSERT_EQ(lazyScan == nullptr, eagerScan == nullptr);
+
+      if (lazyScan != nullptr)
+      {
+         EXPECT_EQ(lazyScan->size(), eagerScan->size());
+      }
+   }
+
+   auto eagerRadarData = eagerFile.radar_data();
+   auto lazyRadarData  = lazyFile.radar_data();
+
+   ASSERT_EQ(lazyRadarData.size(), eagerRadarData.size());
+
+   for (auto& elevation : eagerRadarData)
+   {
+      ASSERT_TRUE(lazyRadarData.contains(elevation.first));
+      EXPECT_EQ(lazyRadarData.at(elevation.first)->size(),
+                elevation.second->size());
+   }
+
+   // Once each elevation is parsed, only valid radials are counted
+   EXPECT_EQ(lazyFile.message_count(), eagerFile.message_count());
+}
+
+TEST_P(Ar2vValidFileTest, LoadChunks)
+{
+   auto& param = GetParam();
+
+   std::ifstream      f {std::string(SCWX_TEST_DATA_DIR) + param.first,
+                    std::ios_base::binary};
+   std::ostringstream data {};
+   data << f.rdbuf();
+   const std::string fileData = data.str();
+
+   Ar2vFile file;
+   ASSERT_TRUE(
+      file.LoadFile(std::string(SCWX_TEST_DATA_DIR) + param.first));
+
+   // Chunk boundaries do not align with LDM records
+   for (std::size_t chunkSize : {1021u, 65536u})
+   {
+      Ar2vFile streamedFile {true};
+
+      for (std::size_t offset = 0; offset < fileData.size();
+           offset += chunkSize)
+      {
+         ASSERT_TRUE(streamedFile.LoadChunk(
+            std::string_view {fileData}.substr(offset, chunkSize)));
+      }
+
+      EXPECT_TRUE(streamedFile.FinishLoad());
+      EXPECT_EQ(streamedFile.message_count(), param.second);
+      EXPECT_EQ(streamedFile.icao(), file.icao());
+      EXPECT_EQ(streamedFile.start_time(), file.start_time());
+      EXPECT_EQ(streamedFile.end_time(), file.end_time());
+
+      auto radarData         = file.radar_data();
+      auto streamedRadarData = streamedFile.radar_data();
+
+      ASSERT_EQ(streamedRadarData.size(), radarData.size());
+
+      for (auto& elevation : radarData)
+      {
+         ASSERT_TRUE(streamedRadarData.contains(elevation.first));
+         EXPECT_EQ(streamedRadarData.at(elevation.first)->size(),
+                   elevation.second->size());
+      }
+   }
+}
+
+TEST(Ar2vFile, LoadChunksTruncatedHeader)
+{
+   Ar2vFile file;
+
+   EXPECT_TRUE(file.LoadChunk("AR2V0006."));
+   EXPECT_FALSE(file.FinishLoad());
+}
+
+static void AppendBigEndian(std::string& data, std::uint32_t value, int size)
+{
+   for (int i = size - 1; i >= 0; --i)
+   {
+      data.push_back(static_cast<char>((value >> (i * 8)) & 0xffu));
+   }
+}
+
+// Creates a Message Type 31 radial containing only the fields read when
+// indexing a lazily loaded file. If truncated, the message ends after the
+// data block pointers.
+static std::string CreateRadial(std::uint16_t elevationNumber,
+                                std::uint16_t modifiedJulianDate,
+                                std::uint32_t collectionTime,
+                                bool          truncated)
+{
+   static constexpr std::uint32_t kDataBlockCount = 4;
+   static constexpr std::uint32_t kRadialHeaderSize =
+      32 + kDataBlockCount * 4;
+   static constexpr std::uint32_t kMessageSize =
+      16 + kRadialHeaderSize + kDataBlockCount * 4;
+
+   std::string data {};
+
+   // Communications manager header
+   data.append(12, '\0');
+
+   // Level 2 message header
+   AppendBigEndian(data, kMessageSize / 2, 2); // Message size (halfwords)
+   AppendBigEndian(data, 0, 1);                // Redundant channel
+   AppendBigEndian(data, 31, 1);               // Message type
+   AppendBigEndian(data, 0, 2);                // Sequence number
+   AppendBigEndian(data, modifiedJulianDate, 2);
+   AppendBigEndian(data, collectionTime, 4);
+   AppendBigEndian(data, 1, 2); // Number of message segments
+   AppendBigEndian(data, 1, 2); // Message segment number
+
+   // Digital radar data generic header
+   data.append("KTST");
+   AppendBigEndian(data, collectionTime, 4);
+   AppendBigEndian(data, modifiedJulianDate, 2);
+   AppendBigEndian(data, 1, 2); // Azimuth number
+   data.append(4, '\0');        // Azimuth angle
+   AppendBigEndian(data, 0, 1); // Compression indicator
+   data.append(5, '\0');        // Spare, radial length, resolution, status
+   AppendBigEndian(data, elevationNumber, 1);
+   data.append(7, '\0'); // Cut sector, elevation angle, blanking, indexing
+   AppendBigEndian(data, kDataBlockCount, 2);
+
+   for (std::uint32_t b = 0; b < kDataBlockCount; ++b)
+   {
+      AppendBigEndian(data, kRadialHeaderSize + b * 4, 4);
+   }
+
+   if (!truncated)
+   {
+      data.append("RVOL");
+      data.append("RELV");
+      data.append("RRAD");
+      data.append("DREF");
+   }
+
+   return data;
+}
+
+static std::string CreateArchive(const std::string& record)
+{
+   std::string compressed {};
+
+   {
+      boost::iostreams::filtering_streambuf<boost::iostreams::output> out;
+      out.push(boost::iostreams::bzip2_compressor());
+      out.push(boost::iostreams::back_inserter(compressed));
+
+      std::istringstream in {record};
+      boost::iostreams::copy(in, out);
+   }
+
+   std::string data {"AR2V0006.001"};
+   AppendBigEndian(data, 19000, 4); // Julian date
+   AppendBigEndian(data, 0, 4);     // Milliseconds
+   data.append("KTST");
+
+   AppendBigEndian(data, static_cast<std::uint32_t>(compressed.size()), 4);
+   data.append(compressed);
+
+   return data;
+}
+
+TEST(Ar2vFile, LazyLoadTruncatedRadial)
+{
+   static constexpr std::uint16_t kModifiedJulianDate = 19000;
+   static constexpr std::uint32_t kCollectionTime     = 3'600'000;
+
+   // A complete radial of the first elevation is followed by a truncated
+   // radial of the second elevation
+   const std::string data = CreateArchive(
+      CreateRadial(1, kModifiedJulianDate, kCollectionTime, false) +
+      CreateRadial(2, kModifiedJulianDate, kCollectionTime + 1000, true));
+
+   std::istringstream is {data};
+   Ar2vFile           file {true};
+
+   EXPECT_TRUE(file.LoadData(is));
+   EXPECT_EQ(file.message_count(), 1u);
+
+   // The truncated radial does not create an empty second elevation
+   EXPECT_EQ(file.end_time(),
+             util::TimePoint(kModifiedJulianDate, kCollectionTime));
+
+   auto radarData = file.radar_data();
+   EXPECT_EQ(radarData.size(), 1u);
+   EXPECT_TRUE(radarData.contains(0));
+   EXPECT_FALSE(radarData.contains(1));
+
+   // The same result is produced when streamed
+   Ar2vFile streamedFile {true};
+
+   EXPECT_TRUE(streamedFile.LoadChunk(data));
+   EXPECT_TRUE(streamedFile.FinishLoad());
+   EXPECT_EQ(streamedFile.message_count(), 1u);
+   EXPECT_EQ(streamedFile.end_time(), file.end_time());
+}
+
 INSTANTIATE_TEST_SUITE_P(
    Ar2vFile,
    Ar2vValidFileTest,
@@ -1,4 +1,6 @@
 #include <scwx/wsr88d/level3_file.hpp>
+#include <scwx/wsr88d/rpg/graphic_product_message.hpp>
+#include <scwx/wsr88d/rpg/scit_data_packet.hpp>
 
 #include <gtest/gtest.h>
 
@@ -29,6 +31,70 @@ TEST_P(Level3ValidFileTest, ValidFile)
    EXPECT_EQ(message->header().message_code(), param.first);
 }
 
+TEST(Level3File, PacketArena)
+{
+   auto file = std::make_shared<Level3File>();
+
+   ASSERT_TRUE(
+      file->LoadFile(std::string(SCWX_TEST_DATA_DIR) +
+                     "/nexrad/level3/KLSX_SDUS33_NSTLSX_202112110215"));
+
+   auto message =
+      std::dynamic_pointer_cast<rpg::GraphicProductMessage>(file->message());
+   ASSERT_NE(message, nullptr);
+
+   auto symbologyBlock = message->symbology_block();
+   ASSERT_NE(symbologyBlock, nullptr);
+
+   std::weak_ptr<rpg::PacketArena> arena = message->packet_arena();
+   std::shared_ptr<rpg::Packet>    packet {nullptr};
+   std::size_t                     packetCount = 0u;
+
+   for (std::uint16_t i = 0; i < symbologyBlock->number_of_layers(); ++i)
+   {
+      for (auto& layerPacket : symbologyBlock->packet_list(i))
+      {
+         auto scitDataPacket =
+            std::dynamic_pointer_cast<rpg::ScitDataPacket>(layerPacket);
+         if (scitDataPacket != nullptr)
+         {
+            packetCount += scitDataPacket->packet_list().size();
+         }
+
+         packet = layerPacket;
+         ++packetCount;
+      }
+   }
+
+   auto graphicBlock = message->graphic_block();
+   if (graphicBlock != nullptr)
+   {
+      for (auto& page : graphicBlock->page_list())
+      {
+         packetCount += page.size();
+      }
+      graphicBlock.reset();
+   }
+
+   ASSERT_NE(packet, nullptr);
+   EXPECT_EQ(arena.lock()->object_count(), packetCount);
+   EXPECT_GT(arena.lock()->bytes_allocated(), 0u);
+
+   // Packet handles keep the arena alive after the message is released
+   const std::uint16_t packetCode = packet->packet_code();
+
+   symbologyBlock.reset();
+   message.reset();
+   file.reset();
+
+   EXPECT_FALSE(arena.expired());
+   EXPECT_EQ(packet->packet_code(), packetCode);
+
+   packet.reset();
+
+   EXPECT_TRUE(arena.expired());
+}
+
 INSTANTIATE_TEST_SUITE_P(
    Level3File,
    Level3ValidFileTest,
@@ -1,6 +1,10 @@
 #include <scwx/wsr88d/nexrad_file_factory.hpp>
 #include <scwx/wsr88d/ar2v_file.hpp>
 #include <scwx/wsr88d/level3_file.hpp>
+#include <scwx/wsr88d/nexrad_file_loader.hpp>
+
+#include <fstream>
+#include <sstream>
 
 #include <gtest/gtest.h>
 
@@ -50,5 +54,54 @@ TEST(NexradFileFactory, Level3)
    EXPECT_NE(level3File, nullptr);
 }
 
+class NexradFileLoaderTest :
+    public testing::TestWithParam<std::pair<std::string, bool>>
+{
+};
+
+TEST_P(NexradFileLoaderTest, LoadChunks)
+{
+   auto& [filename, level2] = GetParam();
+
+   std::ifstream      f {std::string(SCWX_TEST_DATA_DIR) + filename,
+                    std::ios_base::binary};
+   std::ostringstream data {};
+   data << f.rdbuf();
+   const std::string fileData = data.str();
+
+   ASSERT_FALSE(fileData.empty());
+
+   NexradFileLoader loader {};
+
+   for (std::size_t offset = 0; offset < fileData.size(); offset += 3)
+   {
+      ASSERT_TRUE(loader.Write(std::string_view {fileData}.substr(offset, 3)));
+   }
+
+   std::shared_ptr<NexradFile> file = loader.Finish();
+
+   ASSERT_NE(file, nullptr);
+   EXPECT_EQ(std::dynamic_pointer_cast<Ar2vFile>(file) != nullptr, level2);
+   EXPECT_EQ(std::dynamic_pointer_cast<Level3File>(file) != nullptr, !level2);
+}
+
+TEST(NexradFileLoader, Empty)
+{
+   NexradFileLoader loader {};
+
+   EXPECT_EQ(loader.Finish(), nullptr);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+   NexradFileLoader,
+   NexradFileLoaderTest,
+   testing::Values(
+      std::pair<std::string, bool> //
+      {"/nexrad/level2/Level2_KLSX_20210527_1757.ar2v", true},
+      std::pair<std::string, bool> //
+      {"/nexrad/level2/KLSX20130206_175044_V06.gz", true},
+      std::pair<std::string, bool> //
+      {"/nexrad/level3/KLSX_SDUS23_N2QLSX_202112110250", false}));
+
 } // namespace wsr88d
 } // namespace scwx
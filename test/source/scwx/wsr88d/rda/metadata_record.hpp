@@ -0,0 +1,146 @@
+#pragma once
+
+#include <scwx/wsr88d/rda/level2_message_factory.hpp>
+#include <scwx/wsr88d/rda/level2_message_header.hpp>
+
+#include <bit>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+
+#include <boost/iostreams/copy.hpp>
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
+#include <boost/iostreams/filter/bzip2.hpp>
+#include <boost/iostreams/filtering_streambuf.hpp>
+
+namespace scwx
+{
+namespace wsr88d
+{
+namespace rda
+{
+namespace test
+{
+
+/**
+ * Reads a big-endian field from a message body
+ */
+template<class T>
+T ReadField(const std::string& data, std::size_t offset)
+{
+   std::uint32_t value = 0;
+   for (std::size_t i = 0; i < sizeof(T); ++i)
+   {
+      value = (value << 8) | static_cast<std::uint8_t>(data.at(offset + i));
+   }
+
+   if constexpr (sizeof(T) == 4)
+   {
+      return std::bit_cast<T>(value);
+   }
+   else
+   {
+      return static_cast<T>(value);
+   }
+}
+
+/**
+ * Message from the metadata record of a Level 2 volume
+ */
+struct MetadataMessage
+{
+   std::shared_ptr<Level2Message> message_ {nullptr};
+
+   // Message body of each segment following the message header, used to read
+   // fields independently of the message parser
+   std::string data_ {};
+};
+
+/**
+ * Reads the messages of the metadata record, the first LDM record of a
+ * Level 2 volume. Each metadata message is stored in 2432 byte segments.
+ */
+inline std::map<std::uint8_t, MetadataMessage>
+LoadMetadataRecord(const std::string& filename)
+{
+   static constexpr std::size_t kVolumeHeaderSize   = 24;
+   static constexpr std::size_t kControlWordSize    = 4;
+   static constexpr std::size_t kCtmHeaderSize      = 12;
+   static constexpr std::size_t kDefaultSegmentSize = 2432;
+
+   std::map<std::uint8_t, MetadataMessage> messages {};
+
+   std::ifstream      f {filename, std::ios_base::binary};
+   std::ostringstream file {};
+   file << f.rdbuf();
+   const std::string fileData = file.str();
+
+   if (fileData.size() < kVolumeHeaderSize + kControlWordSize)
+   {
+      return messages;
+   }
+
+   const std::size_t recordSize = static_cast<std::size_t>(
+      std::abs(ReadField<std::int32_t>(fileData, kVolumeHeaderSize)));
+   const std::size_t recordOffset = kVolumeHeaderSize + kControlWordSize;
+
+   if (fileData.size() < recordOffset + recordSize)
+   {
+      return messages;
+   }
+
+   boost::iostreams::filtering_streambuf<boost::iostreams::input> in;
+   in.push(boost::iostreams::bzip2_decompressor());
+   in.push(boost::iostreams::array_source {fileData.data() + recordOffset,
+                                           recordSize});
+
+   std::string record {};
+   boost::iostreams::copy(in, boost::iostreams::back_inserter(record));
+
+   std::istringstream is {record};
+   auto               ctx = Level2MessageFactory::CreateContext();
+
+   for (std::size_t offset = 0;
+        offset + kDefaultSegmentSize <= record.size();
+        offset += kDefaultSegmentSize)
+   {
+      const std::size_t headerOffset = offset + kCtmHeaderSize;
+
+      is.clear();
+      is.seekg(static_cast<std::streamoff>(headerOffset), std::ios_base::beg);
+
+      Level2MessageHeader header {};
+      if (!header.Parse(is) || header.message_size() * 2u <
+                                  Level2MessageHeader::SIZE)
+      {
+         continue;
+      }
+
+      MetadataMessage& message = messages[header.message_type()];
+
+      message.data_.append(
+         record,
+         headerOffset + Level2MessageHeader::SIZE,
+         header.message_size() * 2u - Level2MessageHeader::SIZE);
+
+      // The message is created once its final segment has been parsed
+      is.seekg(static_cast<std::streamoff>(headerOffset), std::ios_base::beg);
+
+      Level2MessageInfo info = Level2MessageFactory::Create(is, ctx);
+      if (info.messageValid && info.message != nullptr)
+      {
+         message.message_ = info.message;
+      }
+   }
+
+   return messages;
+}
+
+} // namespace test
+} // namespace rda
+} // namespace wsr88d
+} // namespace scwx
@@ -0,0 +1,81 @@
+#include <scwx/wsr88d/rda/performance_maintenance_data.hpp>
+#include <scwx/wsr88d/rda/rda_types.hpp>
+
+#include "metadata_record.hpp"
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace wsr88d
+{
+namespace rda
+{
+
+static const std::string kLevel2File_ {
+   "/nexrad/level2/Level2_KLSX_20210527_1757.ar2v"};
+
+TEST(PerformanceMaintenanceDataTest, MetadataRecord)
+{
+   auto messages =
+      test::LoadMetadataRecord(std::string(SCWX_TEST_DATA_DIR) + kLevel2File_);
+
+   auto it = messages.find(
+      static_cast<std::uint8_t>(MessageId::PerformanceMaintenanceData));
+   ASSERT_NE(it, messages.cend());
+
+   auto performance = std::dynamic_pointer_cast<PerformanceMaintenanceData>(
+      it->second.message_);
+   const std::string& data = it->second.data_;
+
+   ASSERT_NE(performance, nullptr);
+   ASSERT_GE(data.size(), 960u);
+
+   // Fields are compared with the data at their ICD offsets, spanning each
+   // section of the message
+   using test::ReadField;
+
+   // Communications
+   EXPECT_EQ(performance->loop_back_set_status(),
+             ReadField<std::uint16_t>(data, 2));
+   EXPECT_EQ(performance->t1_output_frames(),
+             ReadField<std::uint32_t>(data, 4));
+   EXPECT_EQ(performance->gps_satellites(), ReadField<std::int32_t>(data, 96));
+
+   // AME
+   EXPECT_EQ(performance->ame_internal_temperature(),
+             ReadField<float>(data, 116));
+
+   // RCP/SPIP
+   EXPECT_EQ(performance->rcp_string(), data.substr(198, 16));
+
+   // Transmitter
+   for (unsigned i = 0; i < 8; ++i)
+   {
+      EXPECT_EQ(performance->one_test_bit(i),
+                ReadField<std::uint16_t>(data, 386 + i * 2));
+   }
+   EXPECT_EQ(performance->xmtr_recycle_count(),
+             ReadField<std::uint32_t>(data, 432));
+
+   // Receiver and calibration
+   EXPECT_EQ(performance->vertical_noise_temperature(),
+             ReadField<float>(data, 720));
+   EXPECT_EQ(performance->short_pulse_horizontal_dbz0(),
+             ReadField<float>(data, 748));
+
+   // RSP and version
+   EXPECT_EQ(performance->cpu1_temperature(),
+             ReadField<std::uint8_t>(data, 896));
+   EXPECT_EQ(performance->cpu2_temperature(),
+             ReadField<std::uint8_t>(data, 897));
+   EXPECT_EQ(performance->cpu1_fan_speed(),
+             ReadField<std::uint16_t>(data, 898));
+   EXPECT_EQ(performance->performance_check_time(),
+             ReadField<std::uint32_t>(data, 936));
+   EXPECT_EQ(performance->version(), ReadField<std::uint16_t>(data, 958));
+}
+
+} // namespace rda
+} // namespace wsr88d
+} // namespace scwx
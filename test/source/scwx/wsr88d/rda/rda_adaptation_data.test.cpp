@@ -0,0 +1,105 @@
+#include <scwx/wsr88d/rda/rda_adaptation_data.hpp>
+#include <scwx/wsr88d/rda/rda_types.hpp>
+
+#include "metadata_record.hpp"
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace wsr88d
+{
+namespace rda
+{
+
+static const std::string kLevel2File_ {
+   "/nexrad/level2/Level2_KLSX_20210527_1757.ar2v"};
+
+// KLSX radar site location
+static constexpr double kSiteLatitude_  = 38.6986863;
+static constexpr double kSiteLongitude_ = -90.682877;
+
+TEST(RdaAdaptationDataTest, MetadataRecord)
+{
+   auto messages =
+      test::LoadMetadataRecord(std::string(SCWX_TEST_DATA_DIR) + kLevel2File_);
+
+   auto it =
+      messages.find(static_cast<std::uint8_t>(MessageId::RdaAdaptationData));
+   ASSERT_NE(it, messages.cend());
+
+   auto adaptation =
+      std::dynamic_pointer_cast<RdaAdaptationData>(it->second.message_);
+   const std::string& data = it->second.data_;
+
+   ASSERT_NE(adaptation, nullptr);
+   ASSERT_GE(data.size(), 9048u);
+
+   // Known values of the radar site
+   EXPECT_EQ(adaptation->site_name(), "KLSX");
+   EXPECT_EQ(adaptation->slatdir(), 'N');
+   EXPECT_EQ(adaptation->slondir(), 'W');
+
+   const double latitude = adaptation->slatdeg() +
+                           adaptation->slatmin() / 60.0 +
+                           adaptation->slatsec() / 3600.0;
+   const double longitude = adaptation->slondeg() +
+                            adaptation->slonmin() / 60.0 +
+                            adaptation->slonsec() / 3600.0;
+
+   EXPECT_NEAR(latitude, kSiteLatitude_, 0.01);
+   EXPECT_NEAR(-longitude, kSiteLongitude_, 0.01);
+
+   // Fields are compared with the data at their ICD offsets, spanning each
+   // section of the message
+   using test::ReadField;
+
+   EXPECT_EQ(adaptation->adap_file_name(), data.substr(0, 12));
+   EXPECT_EQ(adaptation->adap_date(), data.substr(20, 12));
+   EXPECT_EQ(adaptation->parkaz(), ReadField<float>(data, 60));
+   EXPECT_EQ(adaptation->parkel(), ReadField<float>(data, 64));
+   EXPECT_EQ(adaptation->rpg_co_located(), data[176] == 'T');
+
+   for (unsigned i = 0; i < 104; ++i)
+   {
+      EXPECT_EQ(adaptation->atten_table(i),
+                ReadField<float>(data, 228 + i * 4));
+   }
+
+   EXPECT_EQ(adaptation->path_losses(7), ReadField<float>(data, 668));
+   for (unsigned i = 0; i < 8; ++i)
+   {
+      EXPECT_EQ(adaptation->path_losses(42 + i),
+                ReadField<float>(data, 808 + i * 4));
+   }
+
+   for (unsigned i = 0; i < 13; ++i)
+   {
+      EXPECT_EQ(adaptation->h_rnscale(i), ReadField<float>(data, 940 + i * 4));
+   }
+
+   EXPECT_EQ(adaptation->antenna_gain(), ReadField<float>(data, 1136));
+   EXPECT_EQ(adaptation->slatsec(), ReadField<float>(data, 1288));
+   EXPECT_EQ(adaptation->slatdeg(), ReadField<std::uint32_t>(data, 1300));
+   EXPECT_EQ(adaptation->az_correction_factor(), ReadField<float>(data, 8360));
+   EXPECT_EQ(adaptation->site_name(), data.substr(8368, 4));
+
+   // The velocity range scale is split around the velocity and width
+   // thresholds
+   for (unsigned i = 0; i < 11; ++i)
+   {
+      EXPECT_EQ(adaptation->v_rnscale(i), ReadField<float>(data, 8700 + i * 4));
+   }
+   for (unsigned i = 11; i < 13; ++i)
+   {
+      EXPECT_EQ(adaptation->v_rnscale(i),
+                ReadField<float>(data, 8752 + (i - 11) * 4));
+   }
+
+   EXPECT_EQ(adaptation->gen_installed(), data[8808] == 'T');
+   EXPECT_EQ(adaptation->txb_alarm_thresh(), ReadField<float>(data, 9044));
+}
+
+} // namespace rda
+} // namespace wsr88d
+} // namespace scwx
@@ -0,0 +1,113 @@
+#include <scwx/wsr88d/rda/rda_status_data.hpp>
+#include <scwx/wsr88d/rda/rda_types.hpp>
+#include <scwx/wsr88d/rda/volume_coverage_pattern_data.hpp>
+
+#include "metadata_record.hpp"
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace wsr88d
+{
+namespace rda
+{
+
+static const std::string kLevel2File_ {
+   "/nexrad/level2/Level2_KLSX_20210527_1757.ar2v"};
+
+TEST(RdaStatusDataTest, MetadataRecord)
+{
+   auto messages =
+      test::LoadMetadataRecord(std::string(SCWX_TEST_DATA_DIR) + kLevel2File_);
+
+   auto it =
+      messages.find(static_cast<std::uint8_t>(MessageId::RdaStatusData));
+   ASSERT_NE(it, messages.cend());
+
+   auto status = std::dynamic_pointer_cast<RdaStatusData>(it->second.message_);
+   const std::string& data = it->second.data_;
+
+   ASSERT_NE(status, nullptr);
+   ASSERT_GE(data.size(), 80u);
+
+   // Each field is compared with the halfword at its ICD offset
+   using test::ReadField;
+
+   EXPECT_EQ(status->rda_status(), ReadField<std::uint16_t>(data, 0));
+   EXPECT_EQ(status->operability_status(), ReadField<std::uint16_t>(data, 2));
+   EXPECT_EQ(status->control_status(), ReadField<std::uint16_t>(data, 4));
+   EXPECT_EQ(status->auxiliary_power_generator_state(),
+             ReadField<std::uint16_t>(data, 6));
+   EXPECT_EQ(status->average_transmitter_power(),
+             ReadField<std::uint16_t>(data, 8));
+   EXPECT_FLOAT_EQ(status->horizontal_reflectivity_calibration_correction(),
+                   ReadField<std::int16_t>(data, 10) * 0.01f);
+   EXPECT_EQ(status->data_transmission_enabled(),
+             ReadField<std::uint16_t>(data, 12));
+   EXPECT_EQ(status->volume_coverage_pattern_number(),
+             ReadField<std::uint16_t>(data, 14));
+   EXPECT_EQ(status->rda_control_authorization(),
+             ReadField<std::uint16_t>(data, 16));
+   EXPECT_EQ(status->rda_build_number(), ReadField<std::uint16_t>(data, 18));
+   EXPECT_EQ(status->operational_mode(), ReadField<std::uint16_t>(data, 20));
+   EXPECT_EQ(status->super_resolution_status(),
+             ReadField<std::uint16_t>(data, 22));
+   EXPECT_EQ(status->clutter_mitigation_decision_status(),
+             ReadField<std::uint16_t>(data, 24));
+   EXPECT_EQ(status->avset_ebc_rda_log_data_status(),
+             ReadField<std::uint16_t>(data, 26));
+   EXPECT_EQ(status->rda_alarm_summary(), ReadField<std::uint16_t>(data, 28));
+   EXPECT_EQ(status->command_acknowledgement(),
+             ReadField<std::uint16_t>(data, 30));
+   EXPECT_EQ(status->channel_control_status(),
+             ReadField<std::uint16_t>(data, 32));
+   EXPECT_EQ(status->spot_blanking_status(),
+             ReadField<std::uint16_t>(data, 34));
+   EXPECT_EQ(status->bypass_map_generation_date(),
+             ReadField<std::uint16_t>(data, 36));
+   EXPECT_EQ(status->bypass_map_generation_time(),
+             ReadField<std::uint16_t>(data, 38));
+   EXPECT_EQ(status->clutter_filter_map_generation_date(),
+             ReadField<std::uint16_t>(data, 40));
+   EXPECT_EQ(status->clutter_filter_map_generation_time(),
+             ReadField<std::uint16_t>(data, 42));
+   EXPECT_FLOAT_EQ(status->vertical_reflectivity_calibration_correction(),
+                   ReadField<std::int16_t>(data, 44) * 0.01f);
+   EXPECT_EQ(status->transition_power_source_status(),
+             ReadField<std::uint16_t>(data, 46));
+   EXPECT_EQ(status->rms_control_status(), ReadField<std::uint16_t>(data, 48));
+   EXPECT_EQ(status->performance_check_status(),
+             ReadField<std::uint16_t>(data, 50));
+
+   for (unsigned i = 0; i < 14; ++i)
+   {
+      EXPECT_EQ(status->alarm_codes(i),
+                ReadField<std::uint16_t>(data, 52 + i * 2));
+   }
+
+   // RDA Build 18.0 extension
+   if (data.size() >= 120u)
+   {
+      EXPECT_EQ(status->signal_processing_options(),
+                ReadField<std::uint16_t>(data, 80));
+      EXPECT_EQ(status->status_version(), ReadField<std::uint16_t>(data, 118));
+   }
+
+   // The status reports the volume coverage pattern of the volume
+   auto vcpIt = messages.find(
+      static_cast<std::uint8_t>(MessageId::VolumeCoveragePatternData));
+   ASSERT_NE(vcpIt, messages.cend());
+
+   auto vcp = std::dynamic_pointer_cast<VolumeCoveragePatternData>(
+      vcpIt->second.message_);
+   ASSERT_NE(vcp, nullptr);
+
+   EXPECT_EQ(std::abs(static_cast<std::int16_t>(
+                status->volume_coverage_pattern_number())),
+             vcp->pattern_number());
+}
+
+} // namespace rda
+} // namespace wsr88d
+} // namespace scwx
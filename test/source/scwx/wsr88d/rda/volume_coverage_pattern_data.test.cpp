@@ -0,0 +1,130 @@
+#include <scwx/wsr88d/rda/volume_coverage_pattern_data.hpp>
+#include <scwx/wsr88d/rda/level2_message_header.hpp>
+
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace wsr88d
+{
+namespace rda
+{
+
+// Synthetic Message Type 5 with one elevation cut, encoded at ICD offsets
+static const std::vector<std::uint8_t> kVcpData_ {
+   0x00, 0x22, // 1: Message size (34 halfwords)
+   0x00, 0x02, // 2: Pattern type
+   0x00, 0xd4, // 3: Pattern number (212)
+   0x00, 0x01, // 4: Number of elevation cuts
+   0x13, 0x01, // 5: Version, clutter map group number
+   0x02, 0x02, // 6: Doppler velocity resolution, pulse width
+   0x00, 0x00, // 7: Spare
+   0x00, 0x00, // 8: Spare
+   0x20, 0x0e, // 9: VCP sequencing
+   0x10, 0x23, // 10: VCP supplemental data
+   0x00, 0x00, // 11: Spare
+   0x00, 0x5b, // E1: Elevation angle
+   0x01, 0x04, // E2: Channel configuration, waveform type
+   0x07, 0x01, // E3: Super resolution control, surveillance PRF number
+   0x00, 0x0f, // E4: Surveillance PRF pulse count/radial
+   0xff, 0xf6, // E5: Azimuth rate (negative)
+   0x00, 0x10, // E6: Reflectivity threshold
+   0x00, 0x18, // E7: Velocity threshold
+   0x00, 0x20, // E8: Spectrum width threshold
+   0x00, 0x28, // E9: Differential reflectivity threshold
+   0x00, 0x30, // E10: Differential phase threshold
+   0x00, 0x38, // E11: Correlation coefficient threshold
+   0x01, 0x00, // E12: Sector 1 edge angle
+   0x00, 0x05, // E13: Sector 1 Doppler PRF number
+   0x00, 0x2d, // E14: Sector 1 Doppler PRF pulse count/radial
+   0x04, 0x01, // E15: Supplemental data
+   0x02, 0x00, // E16: Sector 2 edge angle
+   0x00, 0x06, // E17: Sector 2 Doppler PRF number
+   0x00, 0x2e, // E18: Sector 2 Doppler PRF pulse count/radial
+   0x00, 0x2d, // E19: EBC angle
+   0x03, 0x00, // E20: Sector 3 edge angle
+   0x00, 0x07, // E21: Sector 3 Doppler PRF number
+   0x00, 0x2f, // E22: Sector 3 Doppler PRF pulse count/radial
+   0x00, 0x00  // E23: Spare
+};
+
+static std::shared_ptr<VolumeCoveragePatternData>
+ParseVcp(const std::vector<std::uint8_t>& data)
+{
+   std::istringstream is {std::string(data.cbegin(), data.cend())};
+
+   Level2MessageHeader header {};
+   header.set_message_size(static_cast<std::uint16_t>(
+      (Level2MessageHeader::SIZE + data.size()) / 2));
+
+   return VolumeCoveragePatternData::Create(std::move(header), is);
+}
+
+TEST(VolumeCoveragePatternDataTest, Parse)
+{
+   auto vcp = ParseVcp(kVcpData_);
+
+   ASSERT_NE(vcp, nullptr);
+   EXPECT_EQ(vcp->pattern_type(), 2u);
+   EXPECT_EQ(vcp->pattern_number(), 212u);
+   EXPECT_EQ(vcp->version(), 0x13u);
+   EXPECT_EQ(vcp->clutter_map_group_number(), 1u);
+   EXPECT_EQ(vcp->doppler_velocity_resolution(), 0.5f);
+   EXPECT_EQ(vcp->pulse_width(), 2u);
+   EXPECT_EQ(vcp->vcp_sequencing(), 0x200eu);
+   EXPECT_EQ(vcp->number_of_elevations(), 14u);
+   EXPECT_TRUE(vcp->sequence_active());
+   EXPECT_EQ(vcp->vcp_supplemental_data(), 0x1023u);
+   EXPECT_TRUE(vcp->sails_vcp());
+   EXPECT_EQ(vcp->number_of_sails_cuts(), 1u);
+   EXPECT_TRUE(vcp->base_tilt_vcp());
+
+   ASSERT_EQ(vcp->number_of_elevation_cuts(), 1u);
+   EXPECT_EQ(vcp->elevation_angle_raw(0), 0x005bu);
+   EXPECT_EQ(vcp->channel_configuration(0), 1u);
+   EXPECT_EQ(vcp->waveform_type_raw(0), 4u);
+   EXPECT_EQ(vcp->super_resolution_control(0), 7u);
+   EXPECT_EQ(vcp->surveillance_prf_number(0), 1u);
+   EXPECT_EQ(vcp->surveillance_prf_pulse_count_radial(0), 15u);
+   EXPECT_LT(vcp->azimuth_rate(0), 0.0);
+   EXPECT_EQ(vcp->reflectivity_threshold(0), 2.0f);
+   EXPECT_EQ(vcp->velocity_threshold(0), 3.0f);
+   EXPECT_EQ(vcp->spectrum_width_threshold(0), 4.0f);
+   EXPECT_EQ(vcp->differential_reflectivity_threshold(0), 5.0f);
+   EXPECT_EQ(vcp->differential_phase_threshold(0), 6.0f);
+   EXPECT_EQ(vcp->correlation_coefficient_threshold(0), 7.0f);
+   EXPECT_EQ(vcp->supplemental_data(0), 0x0401u);
+   EXPECT_TRUE(vcp->sails_cut(0));
+   EXPECT_TRUE(vcp->base_tilt_cut(0));
+
+   for (std::uint16_t s = 0; s < 3; ++s)
+   {
+      EXPECT_EQ(vcp->doppler_prf_number(0, s), 5u + s);
+      EXPECT_EQ(vcp->doppler_prf_pulse_count_radial(0, s), 45u + s);
+      EXPECT_GT(vcp->edge_angle(0, s), 0.0);
+   }
+   EXPECT_LT(vcp->edge_angle(0, 0), vcp->edge_angle(0, 1));
+   EXPECT_LT(vcp->edge_angle(0, 1), vcp->edge_angle(0, 2));
+}
+
+TEST(VolumeCoveragePatternDataTest, InvalidElevationCuts)
+{
+   std::vector<std::uint8_t> data {kVcpData_};
+   data[7] = 33u; // More than 32 elevation cuts
+
+   EXPECT_EQ(ParseVcp(data), nullptr);
+}
+
+TEST(VolumeCoveragePatternDataTest, Truncated)
+{
+   std::vector<std::uint8_t> data {kVcpData_.cbegin(),
+                                   kVcpData_.cend() - 10};
+
+   EXPECT_EQ(ParseVcp(data), nullptr);
+}
+
+} // namespace rda
+} // namespace wsr88d
+} // namespace scwx
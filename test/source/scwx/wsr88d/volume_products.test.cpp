@@ -0,0 +1,355 @@
+#include <scwx/wsr88d/volume_products.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <random>
+
+#include <gtest/gtest.h>
+
+namespace scwx
+{
+namespace wsr88d
+{
+
+static constexpr double kEffectiveEarthRadius_ = 6'371'000.0 * 4.0 / 3.0;
+
+// Reflectivity data moment levels
+static constexpr std::uint8_t kRef10_ = 86;
+static constexpr std::uint8_t kRef30_ = 126;
+static constexpr std::uint8_t kRef50_ = 166;
+
+static VolumeProducts::Grid CreateGrid()
+{
+   // 100 km
+   VolumeProducts::Grid grid {};
+   grid.radials_        = 8;
+   grid.gates_          = 400;
+   grid.firstGateRange_ = 125.0f;
+   grid.gateSpacing_    = 250.0f;
+   return grid;
+}
+
+static VolumeProducts::Cut CreateCut(float elevation, std::uint8_t value)
+{
+   const VolumeProducts::Grid grid = CreateGrid();
+
+   VolumeProducts::Cut cut {};
+   cut.elevation_ = elevation;
+   cut.data_.resize(grid.radials_ * grid.gates_, value);
+   return cut;
+}
+
+static std::vector<VolumeProducts::Cut> CreateRandomVolume()
+{
+   const VolumeProducts::Grid grid = CreateGrid();
+
+   std::mt19937                                 generator {1234u};
+   std::uniform_int_distribution<std::uint32_t> distribution {0u, 255u};
+
+   std::vector<VolumeProducts::Cut> cuts {};
+   for (float elevation : {0.5f, 0.9f, 1.3f, 1.8f, 2.4f, 3.1f, 4.0f, 6.4f})
+   {
+      VolumeProducts::Cut& cut = cuts.emplace_back();
+      cut.elevation_           = elevation;
+      cut.data_.resize(grid.radials_ * grid.gates_);
+
+      for (std::uint8_t& value : cut.data_)
+      {
+         value = static_cast<std::uint8_t>(distribution(generator));
+      }
+   }
+
+   return cuts;
+}
+
+static float Decode(common::Level2Product product, std::uint8_t level)
+{
+   return (level - VolumeProducts::GetOffset(product)) /
+          VolumeProducts::GetScale(product);
+}
+
+TEST(VolumeProductsTest, Cuts)
+{
+   std::vector<VolumeProducts::Cut> cuts {};
+   cuts.push_back(CreateCut(3.0f, kRef10_));
+   cuts.push_back(CreateCut(0.5f, kRef50_));
+   cuts.push_back(CreateCut(1.5f, kRef30_));
+
+   VolumeProducts volume {CreateGrid(), std::move(cuts)};
+
+   ASSERT_EQ(volume.cuts().size(), 3u);
+   EXPECT_EQ(volume.cuts()[0].elevation_, 0.5f);
+   EXPECT_EQ(volume.cuts()[1].elevation_, 1.5f);
+   EXPECT_EQ(volume.cuts()[2].elevation_, 3.0f);
+}
+
+TEST(VolumeProductsTest, BeamHeight)
+{
+   std::vector<VolumeProducts::Cut> cuts {};
+   cuts.push_back(CreateCut(0.5f, kRef50_));
+   cuts.push_back(CreateCut(3.0f, kRef50_));
+
+   VolumeProducts volume {CreateGrid(), std::move(cuts)};
+
+   // Compare against the height computed from slant range, which is within
+   // 0.5% of ground range at low elevation angles
+   for (std::size_t cut = 0; cut < volume.cuts().size(); ++cut)
+   {
+      const double theta =
+         volume.cuts()[cut].elevation_ * std::numbers::pi / 180.0;
+
+      for (std::size_t gate : {0u, 199u, 399u})
+      {
+         const double range = 125.0 + 250.0 * gate;
+         const double height =
+            std::sqrt(range * range +
+                      kEffectiveEarthRadius_ * kEffectiveEarthRadius_ +
+                      2.0 * range * kEffectiveEarthRadius_ * std::sin(theta)) -
+            kEffectiveEarthRadius_;
+
+         EXPECT_NEAR(volume.beam_height(cut)[gate], height, height * 0.005);
+      }
+   }
+
+   // Approximately 50 km
+   EXPECT_NEAR(volume.beam_height(0)[199], 582.0f, 5.0f);
+   EXPECT_NEAR(volume.beam_height(1)[199], 2765.0f, 10.0f);
+}
+
+TEST(VolumeProductsTest, CompositeReflectivity)
+{
+   std::vector<VolumeProducts::Cut> cuts {};
+   cuts.push_back(CreateCut(0.5f, kRef30_));
+   cuts.push_back(CreateCut(1.5f, kRef50_));
+   cuts.push_back(CreateCut(3.0f, 0u));
+
+   // No data on the lowest cut, range folded data on the second cut
+   cuts[0].data_[10] = 0u;
+   cuts[1].data_[10] = 1u;
+
+   VolumeProducts volume {CreateGrid(), std::move(cuts)};
+
+   const std::vector<std::uint8_t> data =
+      volume.Compute(common::Level2Product::CompositeReflectivity);
+
+   ASSERT_EQ(data.size(), 8u * 400u);
+   EXPECT_EQ(data[0], kRef50_);
+   EXPECT_EQ(data[10], 1u);
+   EXPECT_FLOAT_EQ(
+      Decode(common::Level2Product::CompositeReflectivity, data[0]), 50.0f);
+}
+
+TEST(VolumeProductsTest, EchoTops)
+{
+   std::vector<VolumeProducts::Cut> cuts {};
+   cuts.push_back(CreateCut(0.5f, kRef50_));
+   cuts.push_back(CreateCut(1.5f, kRef30_));
+   cuts.push_back(CreateCut(3.0f, kRef10_));
+
+   // Below the threshold on each cut
+   for (auto& cut : cuts)
+   {
+      cut.data_[10] = kRef10_;
+   }
+
+   VolumeProducts volume {CreateGrid(), std::move(cuts)};
+
+   const std::vector<std::uint8_t> data =
+      volume.Compute(common::Level2Product::EchoTops);
+
+   // The 1.5 degree beam is centered near 1.45 km at 50 km
+   EXPECT_EQ(data[199], 17u);
+   EXPECT_NEAR(
+      Decode(common::Level2Product::EchoTops, data[199]), 1.45f, 0.05f);
+   EXPECT_EQ(data[10], 0u);
+}
+
+TEST(VolumeProductsTest, VerticallyIntegratedLiquid)
+{
+   std::vector<VolumeProducts::Cut> cuts {};
+   cuts.push_back(CreateCut(0.5f, kRef50_));
+   cuts.push_back(CreateCut(1.5f, kRef50_));
+
+   VolumeProducts volume {CreateGrid(), std::move(cuts)};
+
+   const std::vector<std::uint8_t> data =
+      volume.Compute(common::Level2Product::VerticallyIntegratedLiquid);
+
+   // 3.44e-6 * (10^5)^(4/7) kg/m^3 over the 870 m layer between beams at 50 km
+   EXPECT_NEAR(Decode(common::Level2Product::VerticallyIntegratedLiquid,
+                      data[199]),
+               2.15f,
+               0.3f);
+
+   // No data
+   VolumeProducts empty {CreateGrid(),
+                         {CreateCut(0.5f, 0u), CreateCut(1.5f, 0u)}};
+   const std::vector<std::uint8_t> emptyData =
+      empty.Compute(common::Level2Product::VerticallyIntegratedLiquid);
+   EXPECT_TRUE(std::all_of(emptyData.cbegin(),
+                           emptyData.cend(),
+                           [](std::uint8_t value) { return value == 0u; }));
+}
+
+TEST(VolumeProductsTest, Reference)
+{
+   // Compare each product against a scalar reference implementation over a
+   // volume of random data moments
+   VolumeProducts volume {CreateGrid(), CreateRandomVolume()};
+
+   const auto& cuts = volume.cuts();
+   const auto& grid = volume.grid();
+   const auto  cr =
+      volume.Compute(common::Level2Product::CompositeReflectivity);
+   const auto et = volume.Compute(common::Level2Product::EchoTops);
+   const auto vil =
+      volume.Compute(common::Level2Product::VerticallyIntegratedLiquid);
+
+   auto linearZ = [](std::uint8_t level)
+   {
+      if (level < 2)
+      {
+         return 0.0;
+      }
+      return std::pow(10.0, std::min((level - 66.0) / 2.0, 56.0) / 10.0);
+   };
+
+   for (std::size_t radial = 0; radial < grid.radials_; ++radial)
+   {
+      for (std::size_t gate = 0; gate < grid.gates_; ++gate)
+      {
+         const std::size_t i = radial * grid.gates_ + gate;
+
+         std::uint8_t maxLevel = 0;
+         double       top      = -1.0;
+         double       liquid   = 0.0;
+
+         for (std::size_t c = 0; c < cuts.size(); ++c)
+         {
+            maxLevel = std::max(maxLevel, cuts[c].data_[i]);
+
+            if (cuts[c].data_[i] >= 102)
+            {
+               top = volume.beam_height(c)[gate];
+            }
+
+            if (c + 1 < cuts.size())
+            {
+               const double z = (linearZ(cuts[c].data_[i]) +
+                                 linearZ(cuts[c + 1].data_[i])) /
+                                2.0;
+               liquid += 3.44e-6 * std::pow(z, 4.0 / 7.0) *
+                         (volume.beam_height(c + 1)[gate] -
+                          volume.beam_height(c)[gate]);
+            }
+         }
+
+         EXPECT_EQ(cr[i], maxLevel);
+
+         if (top < 0.0)
+         {
+            EXPECT_EQ(et[i], 0u);
+         }
+         else
+         {
+            EXPECT_EQ(et[i], std::lround(top * 0.001 * 10.0) + 2);
+         }
+
+         const long vilLevel = std::lround(liquid * 2.0);
+         EXPECT_LE(std::abs((vilLevel > 0 ? vilLevel + 2 : 0) - vil[i]), 1);
+      }
+   }
+}
+
+TEST(VolumeProductsTest, ElevationScan)
+{
+   VolumeProducts volume {CreateGrid(), CreateRandomVolume()};
+
+   const auto data = volume.Compute(common::Level2Product::EchoTops);
+   const auto elevationScan =
+      volume.CreateElevationScan(common::Level2Product::EchoTops);
+
+   ASSERT_NE(elevationScan, nullptr);
+   ASSERT_EQ(elevationScan->size(), 8u);
+
+   for (auto& [radial, radialData] : *elevationScan)
+   {
+      EXPECT_FLOAT_EQ(radialData->azimuth_angle().value(),
+                      radial * 45.0f + 22.5f);
+
+      auto momentData =
+         radialData->moment_data_block(rda::DataBlockType::MomentRef);
+      ASSERT_NE(momentData, nullptr);
+      EXPECT_EQ(momentData->number_of_data_moment_gates(), 400u);
+      EXPECT_EQ(momentData->data_moment_range_raw(), 125);
+      EXPECT_EQ(momentData->data_moment_range_sample_interval_raw(), 250u);
+      EXPECT_EQ(momentData->data_word_size(), 8u);
+      EXPECT_EQ(momentData->scale(), 10.0f);
+      EXPECT_EQ(momentData->offset(), 2.0f);
+
+      const std::uint8_t* moments =
+         static_cast<const std::uint8_t*>(momentData->data_moments());
+      EXPECT_TRUE(std::equal(moments,
+                             moments + 400,
+                             data.cbegin() + radial * 400u));
+
+      EXPECT_EQ(radialData->moment_data_block(rda::DataBlockType::MomentVel),
+                nullptr);
+   }
+
+   EXPECT_TRUE(volume.Compute(common::Level2Product::Velocity).empty());
+   EXPECT_EQ(volume.CreateElevationScan(common::Level2Product::Velocity),
+             nullptr);
+   EXPECT_EQ(VolumeProducts::Create(nullptr), nullptr);
+}
+
+TEST(VolumeProductsTest, SampleVolume)
+{
+   auto file = std::make_shared<Ar2vFile>();
+   ASSERT_TRUE(file->LoadFile(std::string(SCWX_TEST_DATA_DIR) +
+                              "/nexrad/level2/Level2_KLSX_20210527_1757.ar2v"));
+
+   auto volume = VolumeProducts::Create(file);
+   ASSERT_NE(volume, nullptr);
+   ASSERT_GT(volume->cuts().size(), 1u);
+
+   const auto& grid = volume->grid();
+   EXPECT_EQ(grid.radials_, 720u);
+   EXPECT_EQ(grid.gateSpacing_, 250.0f);
+
+   const auto cr =
+      volume->Compute(common::Level2Product::CompositeReflectivity);
+   const auto et = volume->Compute(common::Level2Product::EchoTops);
+   const auto vil =
+      volume->Compute(common::Level2Product::VerticallyIntegratedLiquid);
+
+   ASSERT_EQ(cr.size(), grid.radials_ * grid.gates_);
+
+   std::size_t echoTops = 0;
+
+   for (std::size_t i = 0; i < cr.size(); ++i)
+   {
+      // Composite reflectivity is at least the reflectivity of each cut
+      for (const auto& cut : volume->cuts())
+      {
+         ASSERT_GE(cr[i], cut.data_[i]);
+      }
+
+      // Echo tops are only present where the threshold is met
+      ASSERT_EQ(et[i] != 0u, cr[i] >= 102u);
+
+      if (et[i] != 0u)
+      {
+         ++echoTops;
+      }
+   }
+
+   EXPECT_GT(echoTops, 0u);
+   EXPECT_TRUE(std::any_of(vil.cbegin(),
+                           vil.cend(),
+                           [](std::uint8_t value) { return value != 0u; }));
+}
+
+} // namespace wsr88d
+} // namespace scwx
@@ -12,32 +12,60 @@ set(SRC_AWIPS_TESTS source/scwx/awips/coded_location.test.cpp
                     source/scwx/awips/coded_time_motion_location.test.cpp
                     source/scwx/awips/pvtec.test.cpp
                     source/scwx/awips/text_product_file.test.cpp
-                    source/scwx/awips/ugc.test.cpp)
+                    source/scwx/awips/text_product_message.test.cpp
+                    source/scwx/awips/ugc.test.cpp
+                    source/scwx/awips/wmo_header.test.cpp)
 set(SRC_COMMON_TESTS source/scwx/common/color_table.test.cpp
                      source/scwx/common/products.test.cpp)
 set(SRC_GR_TESTS source/scwx/gr/placefile.test.cpp)
-set(SRC_NETWORK_TESTS source/scwx/network/dir_list.test.cpp)
+set(SRC_NETWORK_TESTS source/scwx/network/dir_list.test.cpp
+                      source/scwx/network/replay_transport.test.cpp
+                      source/scwx/network/transport.test.cpp)
 set(SRC_PROVIDER_TESTS source/scwx/provider/aws_level2_data_provider.test.cpp
                        source/scwx/provider/aws_level3_data_provider.test.cpp
                        source/scwx/provider/warnings_provider.test.cpp)
 set(SRC_QT_CONFIG_TESTS source/scwx/qt/config/county_database.test.cpp
+                        source/scwx/qt/config/county_store.test.cpp
                         source/scwx/qt/config/radar_site.test.cpp)
+set(SRC_QT_GL_TESTS source/scwx/qt/gl/upload_context.test.cpp)
 set(SRC_QT_MANAGER_TESTS source/scwx/qt/manager/settings_manager.test.cpp
                          source/scwx/qt/manager/update_manager.test.cpp)
-set(SRC_QT_MAP_TESTS source/scwx/qt/map/map_provider.test.cpp)
+set(SRC_QT_MAP_TESTS source/scwx/qt/map/map_provider.test.cpp
+                     source/scwx/qt/map/overlay_geometry.test.cpp)
 set(SRC_QT_MODEL_TESTS source/scwx/qt/model/imgui_context_model.test.cpp)
 set(SRC_QT_SETTINGS_TESTS source/scwx/qt/settings/settings_container.test.cpp
                           source/scwx/qt/settings/settings_variable.test.cpp)
 set(SRC_QT_UTIL_TESTS source/scwx/qt/util/q_file_input_stream.test.cpp
-                      source/scwx/qt/util/geographic_lib.test.cpp)
+                      source/scwx/qt/util/atlas_packer.test.cpp
+                      source/scwx/qt/util/coalescing_cache.test.cpp
+                      source/scwx/qt/util/cross_section.test.cpp
+                      source/scwx/qt/util/geo_grid_index.test.cpp
+                      source/scwx/qt/util/geographic_lib.test.cpp
+                      source/scwx/qt/util/image_cache.test.cpp
+                      source/scwx/qt/util/mosaic_grid.test.cpp
+                      source/scwx/qt/util/polar_sweep.test.cpp
+                      source/scwx/qt/util/prepared_area.test.cpp
+                      source/scwx/qt/util/sweep_rasterizer.test.cpp
+                      source/scwx/qt/util/text_event_store.test.cpp
+                      source/scwx/qt/util/time_index.test.cpp
+                      source/scwx/qt/util/triangle_sweep.test.cpp)
 set(SRC_UTIL_TESTS source/scwx/util/float.test.cpp
+                   source/scwx/util/initialization_graph.test.cpp
+                   source/scwx/util/metrics.test.cpp
                    source/scwx/util/rangebuf.test.cpp
+                   source/scwx/util/record_layout.test.cpp
                    source/scwx/util/streams.test.cpp
                    source/scwx/util/strings.test.cpp
                    source/scwx/util/vectorbuf.test.cpp)
 set(SRC_WSR88D_TESTS source/scwx/wsr88d/ar2v_file.test.cpp
                      source/scwx/wsr88d/level3_file.test.cpp
-                     source/scwx/wsr88d/nexrad_file_factory.test.cpp)
+                     source/scwx/wsr88d/nexrad_file_factory.test.cpp
+                     source/scwx/wsr88d/volume_products.test.cpp)
+set(SRC_WSR88D_RDA_TESTS source/scwx/wsr88d/rda/metadata_record.hpp
+                         source/scwx/wsr88d/rda/performance_maintenance_data.test.cpp
+                         source/scwx/wsr88d/rda/rda_adaptation_data.test.cpp
+                         source/scwx/wsr88d/rda/rda_status_data.test.cpp
+                         source/scwx/wsr88d/rda/volume_coverage_pattern_data.test.cpp)
 
 set(CMAKE_FILES test.cmake)
 
@@ -48,6 +76,7 @@ add_executable(wxtest ${SRC_MAIN}
                       ${SRC_NETWORK_TESTS}
                       ${SRC_PROVIDER_TESTS}
                       ${SRC_QT_CONFIG_TESTS}
+                      ${SRC_QT_GL_TESTS}
                       ${SRC_QT_MANAGER_TESTS}
                       ${SRC_QT_MAP_TESTS}
                       ${SRC_QT_MODEL_TESTS}
@@ -55,6 +84,7 @@ add_executable(wxtest ${SRC_MAIN}
                       ${SRC_QT_UTIL_TESTS}
                       ${SRC_UTIL_TESTS}
                       ${SRC_WSR88D_TESTS}
+                      ${SRC_WSR88D_RDA_TESTS}
                       ${CMAKE_FILES})
 
 source_group("Source Files\\main"         FILES ${SRC_MAIN})
@@ -64,6 +94,7 @@ source_group("Source Files\\gr"           FILES ${SRC_GR_TESTS})
 source_group("Source Files\\network"      FILES ${SRC_NETWORK_TESTS})
 source_group("Source Files\\provider"     FILES ${SRC_PROVIDER_TESTS})
 source_group("Source Files\\qt\\config"   FILES ${SRC_QT_CONFIG_TESTS})
+source_group("Source Files\\qt\\gl"       FILES ${SRC_QT_GL_TESTS})
 source_group("Source Files\\qt\\manager"  FILES ${SRC_QT_MANAGER_TESTS})
 source_group("Source Files\\qt\\map"      FILES ${SRC_QT_MAP_TESTS})
 source_group("Source Files\\qt\\model"    FILES ${SRC_QT_MODEL_TESTS})
@@ -71,6 +102,7 @@ source_group("Source Files\\qt\\settings" FILES ${SRC_QT_SETTINGS_TESTS})
 source_group("Source Files\\qt\\util"     FILES ${SRC_QT_UTIL_TESTS})
 source_group("Source Files\\util"         FILES ${SRC_UTIL_TESTS})
 source_group("Source Files\\wsr88d"       FILES ${SRC_WSR88D_TESTS})
+source_group("Source Files\\wsr88d\\rda"  FILES ${SRC_WSR88D_RDA_TESTS})
 
 target_include_directories(wxtest PRIVATE ${GTest_INCLUDE_DIRS})
 
@@ -5,6 +5,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #if defined(__clang__)
@@ -28,7 +29,9 @@ class CodedLocationImpl;
 class CodedLocation
 {
 public:
-   typedef boost::any_range<std::string, boost::forward_traversal_tag>
+   typedef boost::any_range<std::string_view,
+                            boost::forward_traversal_tag,
+                            std::string_view>
       StringRange;
 
    explicit CodedLocation();
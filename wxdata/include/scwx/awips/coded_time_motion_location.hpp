@@ -6,6 +6,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #if defined(__clang__)
@@ -29,7 +30,9 @@ class CodedTimeMotionLocationImpl;
 class CodedTimeMotionLocation
 {
 public:
-   typedef boost::any_range<std::string, boost::forward_traversal_tag>
+   typedef boost::any_range<std::string_view,
+                            boost::forward_traversal_tag,
+                            std::string_view>
       StringRange;
 
    explicit CodedTimeMotionLocation();
@@ -12,6 +12,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <string_view>
 
 namespace scwx
 {
@@ -20,8 +21,8 @@ namespace awips
 
 struct Vtec
 {
-   PVtec       pVtec_;
-   std::string hVtec_;
+   PVtec            pVtec_;
+   std::string_view hVtec_;
 
    Vtec() : pVtec_ {}, hVtec_ {} {}
 
@@ -34,11 +35,11 @@ struct Vtec
 
 struct SegmentHeader
 {
-   std::vector<std::string> ugcString_;
-   Ugc                      ugc_;
-   std::vector<Vtec>        vtecString_;
-   std::vector<std::string> ugcNames_;
-   std::string              issuanceDateTime_;
+   std::vector<std::string_view> ugcString_;
+   Ugc                           ugc_;
+   std::vector<Vtec>             vtecString_;
+   std::vector<std::string_view> ugcNames_;
+   std::string_view              issuanceDateTime_;
 
    SegmentHeader() :
        ugcString_ {},
@@ -56,11 +57,18 @@ struct SegmentHeader
    SegmentHeader& operator=(SegmentHeader&&) noexcept = default;
 };
 
+/**
+ * @brief Text Product Segment
+ *
+ * Segment text is stored as views into the product text, which is shared by
+ * all segments of the product and remains valid for the life of the segment.
+ */
 struct Segment
 {
+   std::shared_ptr<const std::string>     text_ {};
    std::shared_ptr<WmoHeader>             wmoHeader_ {};
    std::optional<SegmentHeader>           header_ {};
-   std::vector<std::string>               productContent_ {};
+   std::vector<std::string_view>          productContent_ {};
    std::optional<CodedLocation>           codedLocation_ {};
    std::optional<CodedTimeMotionLocation> codedMotion_ {};
 
@@ -95,6 +103,7 @@ public:
    TextProductMessage& operator=(TextProductMessage&&) noexcept;
 
    std::string                                 message_content() const;
+   std::shared_ptr<const std::string>          raw_text() const;
    std::shared_ptr<WmoHeader>                  wmo_header() const;
    std::vector<std::string>                    mnd_header() const;
    std::vector<std::string>                    overview_block() const;
@@ -1,7 +1,9 @@
 #pragma once
 
 #include <memory>
+#include <span>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace scwx
@@ -28,6 +30,7 @@ public:
    std::string              product_expiration() const;
 
    bool Parse(const std::vector<std::string>& ugcString);
+   bool Parse(std::span<const std::string_view> ugcString);
 
 private:
    std::unique_ptr<UgcImpl> p;
@@ -1,7 +1,10 @@
 #pragma once
 
+#include <chrono>
 #include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
 
 namespace scwx
 {
@@ -45,8 +48,29 @@ public:
    std::string product_category() const;
    std::string product_designator() const;
 
+   /**
+    * Gets the issuance time of the product. The WMO header specifies only the
+    * day of the month, which is resolved to the latest matching date not after
+    * the end time hint. If no hint is given, the current time is used.
+    *
+    * @param [in] endTimeHint Latest time at which the product may be issued
+    *
+    * @return Issuance time, or the epoch if the header time is invalid
+    */
+   std::chrono::system_clock::time_point GetDateTime(
+      std::optional<std::chrono::system_clock::time_point> endTimeHint =
+         std::nullopt) const;
+
    bool Parse(std::istream& is);
 
+   /**
+    * Parses the header from lines previously read from the product. The
+    * sequence line is empty if the product has no transmission header.
+    */
+   bool Parse(std::string_view sequenceLine,
+              std::string_view wmoLine,
+              std::string_view awipsLine);
+
 private:
    std::unique_ptr<WmoHeaderImpl> p;
 };
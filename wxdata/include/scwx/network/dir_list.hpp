@@ -23,7 +23,11 @@ struct DirListRecord
  * @brief Retrieve Directory Listing
  *
  * Retrieves a directory listing. Supports default Apache-style directory
- * listings only.
+ * listings only. The listing is parsed as it is transferred.
+ *
+ * Listings returned with an ETag or Last-Modified header are cached, and
+ * subsequent requests for the same URL are conditional. If the listing is not
+ * modified, the cached records are returned.
  */
 std::vector<DirListRecord> DirList(const std::string& baseUrl);
 
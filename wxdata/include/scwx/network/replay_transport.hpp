@@ -0,0 +1,58 @@
+#pragma once
+
+#include <scwx/network/transport.hpp>
+
+#include <filesystem>
+
+namespace scwx
+{
+namespace network
+{
+
+/**
+ * @brief Replay Transport
+ *
+ * Replays network data recorded to a local directory, without network access.
+ * Objects in bucket "<bucket>" are read from "<root>/s3/<bucket>/<key>", and
+ * resources at "http[s]://<host>/<path>" are read from
+ * "<root>/http/<host>/<path>". HTTP requests for directories return an
+ * Apache-style directory listing, and query parameters are ignored.
+ *
+ * HTTP responses include ETag and Last-Modified headers, and conditional
+ * requests (If-None-Match, If-Modified-Since) for unmodified resources return
+ * 304 Not Modified.
+ *
+ * The modification time of each recorded file is its original modification
+ * time. Files modified after the current clock time are hidden, such that a
+ * recorded event is revealed as the replay clock advances.
+ */
+class ReplayTransport : public Transport
+{
+public:
+   explicit ReplayTransport(const std::filesystem::path& root);
+   ~ReplayTransport();
+
+   ReplayTransport(const ReplayTransport&)            = delete;
+   ReplayTransport& operator=(const ReplayTransport&) = delete;
+
+   std::shared_ptr<ObjectStore>
+   OpenObjectStore(const std::string& bucketName,
+                   const std::string& region) override;
+
+   HttpResponse Get(const std::string&       url,
+                    const ::cpr::Header&     header     = {},
+                    const ::cpr::Parameters& parameters = {}) override;
+
+   /**
+    * Gets the modification time of a recorded file, in system time.
+    */
+   static std::chrono::system_clock::time_point
+   GetLastModified(const std::filesystem::path& path);
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace network
+} // namespace scwx
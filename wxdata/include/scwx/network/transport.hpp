@@ -0,0 +1,163 @@
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <istream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <cpr/cprtypes.h>
+#include <cpr/parameters.h>
+
+namespace scwx
+{
+namespace network
+{
+
+struct ObjectRecord
+{
+   std::string                           key_ {};
+   std::chrono::system_clock::time_point lastModified_ {};
+   std::size_t                           size_ {0u};
+};
+
+struct ObjectListing
+{
+   std::vector<ObjectRecord> objects_ {};
+   std::vector<std::string>  commonPrefixes_ {};
+};
+
+struct ObjectData
+{
+   std::shared_ptr<std::istream> body_ {nullptr};
+   std::size_t                   size_ {0u};
+};
+
+struct HttpResponse
+{
+   long          statusCode_ {0};
+   std::string   text_ {};
+   ::cpr::Header header_ {}; ///< Response header
+   std::string   error_ {};  ///< Error message or status line, if unsuccessful
+};
+
+/**
+ * Receives a chunk of a response body as it is transferred. Returns false to
+ * abort the transfer.
+ */
+typedef std::function<bool(std::string_view data)> WriteFunction;
+
+/**
+ * @brief Object Store
+ *
+ * A bucket of keyed objects, such as an AWS S3 bucket.
+ */
+class ObjectStore
+{
+public:
+   explicit ObjectStore() = default;
+   virtual ~ObjectStore() = default;
+
+   ObjectStore(const ObjectStore&)            = delete;
+   ObjectStore& operator=(const ObjectStore&) = delete;
+
+   /**
+    * Lists objects with keys beginning with the prefix.
+    *
+    * @param prefix Key prefix
+    * @param delimiter If not empty, keys containing the delimiter after the
+    * prefix are grouped into common prefixes rather than listed
+    *
+    * @return Object listing, or empty if the listing failed
+    */
+   virtual std::optional<ObjectListing>
+   ListObjects(const std::string& prefix,
+               const std::string& delimiter = {}) = 0;
+
+   /**
+    * Gets an object by key.
+    *
+    * @param key Object key
+    *
+    * @return Object data, or empty if the request failed
+    */
+   virtual std::optional<ObjectData> GetObject(const std::string& key) = 0;
+
+   /**
+    * Gets an object, or a byte range of an object, by key. The object body is
+    * passed to the write function as it is transferred, rather than buffered.
+    * The body of an error response is not written.
+    *
+    * Bytes passed to the write function are not repeated, so an
+    * implementation does not retry a request internally once any bytes have
+    * been written. A failed transfer may be resumed by the caller, beginning
+    * at the byte following the last byte written.
+    *
+    * The default implementation reads the body of GetObject in chunks.
+    *
+    * @param key Object key
+    * @param write Receives each chunk of the object body
+    * @param offset Offset of the first byte to get
+    * @param length Number of bytes to get, or 0 to get the remainder of the
+    * object
+    *
+    * @return true if the requested bytes were transferred completely
+    */
+   virtual bool GetObjectStream(const std::string&   key,
+                                const WriteFunction& write,
+                                std::size_t          offset = 0u,
+                                std::size_t          length = 0u);
+};
+
+/**
+ * @brief Network Transport
+ *
+ * All network data passes through the installed transport. The default
+ * transport accesses AWS S3 buckets and HTTP servers. An alternate transport,
+ * such as a replay transport backed by recorded data, may be installed before
+ * providers are created.
+ */
+class Transport
+{
+public:
+   explicit Transport() = default;
+   virtual ~Transport() = default;
+
+   Transport(const Transport&)            = delete;
+   Transport& operator=(const Transport&) = delete;
+
+   virtual std::shared_ptr<ObjectStore>
+   OpenObjectStore(const std::string& bucketName,
+                   const std::string& region) = 0;
+
+   virtual HttpResponse Get(const std::string&       url,
+                            const ::cpr::Header&     header     = {},
+                            const ::cpr::Parameters& parameters = {}) = 0;
+
+   /**
+    * Performs an HTTP GET request, passing the response body to the write
+    * function as it is transferred rather than storing it in the response.
+    * Only the body of a successful (2xx) response is written. The body of an
+    * unsuccessful response is discarded.
+    *
+    * The default implementation writes the complete body of Get in a single
+    * chunk.
+    */
+   virtual HttpResponse GetStream(const std::string&       url,
+                                  const WriteFunction&     write,
+                                  const ::cpr::Header&     header     = {},
+                                  const ::cpr::Parameters& parameters = {});
+};
+
+/**
+ * @brief Gets the installed transport. If no transport has been installed,
+ * the default network transport is installed.
+ */
+std::shared_ptr<Transport> GetTransport();
+void                       SetTransport(std::shared_ptr<Transport> transport);
+
+} // namespace network
+} // namespace scwx
@@ -1,15 +1,8 @@
 #pragma once
 
+#include <scwx/network/transport.hpp>
 #include <scwx/provider/nexrad_data_provider.hpp>
 
-namespace Aws
-{
-namespace S3
-{
-class S3Client;
-} // namespace S3
-} // namespace Aws
-
 namespace scwx
 {
 namespace provider
@@ -47,8 +40,14 @@ public:
                              LoadObjectByKey(const std::string& key) override;
    std::pair<size_t, size_t> Refresh() override;
 
+   /**
+    * @brief Sets the maximum number of parallel ranged requests used to get a
+    * large object. A count of 1 gets each object with a single request.
+    */
+   void SetRangeRequestCount(std::size_t count);
+
 protected:
-   std::shared_ptr<Aws::S3::S3Client> client();
+   std::shared_ptr<network::ObjectStore> object_store();
 
    virtual std::string
    GetPrefix(std::chrono::system_clock::time_point date) = 0;
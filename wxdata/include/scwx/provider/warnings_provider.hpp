@@ -27,6 +27,12 @@ public:
    std::vector<std::shared_ptr<awips::TextProductFile>>
    LoadUpdatedFiles(std::chrono::system_clock::time_point newerThan = {});
 
+   /**
+    * @brief Gets the start time of the latest warnings file in the most recent
+    * listing, or the epoch if no files were listed.
+    */
+   std::chrono::system_clock::time_point latest_start_time() const;
+
 private:
    class Impl;
    std::unique_ptr<Impl> p;
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+
+namespace scwx
+{
+namespace util
+{
+namespace clock
+{
+
+/**
+ * @brief A controllable clock, used to replay recorded data. The clock runs
+ * from a start time at a multiple of real time. It may also be paused and
+ * advanced manually, such that replay is deterministic.
+ */
+class ReplayClock
+{
+public:
+   /**
+    * @param [in] startTime Clock time at construction
+    * @param [in] speed Multiple of real time
+    */
+   explicit ReplayClock(std::chrono::system_clock::time_point startTime,
+                        double                                speed = 1.0);
+   ~ReplayClock();
+
+   ReplayClock(const ReplayClock&)            = delete;
+   ReplayClock& operator=(const ReplayClock&) = delete;
+
+   ReplayClock(ReplayClock&&) noexcept;
+   ReplayClock& operator=(ReplayClock&&) noexcept;
+
+   std::chrono::system_clock::time_point now() const;
+   bool                                  paused() const;
+   double                                speed() const;
+
+   void Advance(std::chrono::system_clock::duration duration);
+   void Pause();
+   void Resume();
+   void SetSpeed(double speed);
+   void SetTime(std::chrono::system_clock::time_point time);
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+/**
+ * @brief Gets the current time. If a replay clock is installed, the replay
+ * clock time is returned, otherwise the system time is returned.
+ */
+std::chrono::system_clock::time_point Now();
+
+/**
+ * @brief Converts an interval in clock time to real time, for scheduling
+ * timers. Intervals are shortened in proportion to the replay clock speed.
+ */
+std::chrono::milliseconds RealInterval(std::chrono::milliseconds interval);
+
+std::shared_ptr<ReplayClock> GetReplayClock();
+void SetReplayClock(std::shared_ptr<ReplayClock> replayClock);
+
+} // namespace clock
+} // namespace util
+} // namespace scwx
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace scwx
+{
+namespace util
+{
+
+/**
+ * @brief A set of initialization steps with explicit dependencies.
+ *
+ * Steps run as soon as each of their dependencies has completed. Independent
+ * steps run in parallel on worker threads, unless they must run on the thread
+ * calling Run(). The start time and duration of each step are recorded, and
+ * published to the metrics registry as "init[<graph>.<step>]".
+ */
+class InitializationGraph
+{
+public:
+   typedef std::function<void()> StepFunction;
+
+   enum class ThreadAffinity
+   {
+      Any,   ///< Run on any worker thread
+      Caller ///< Run on the thread calling Run()
+   };
+
+   struct StepTrace
+   {
+      std::string                         name_ {};
+      std::chrono::steady_clock::duration start_ {}; ///< Relative to Run()
+      std::chrono::steady_clock::duration duration_ {};
+      bool                                succeeded_ {false};
+   };
+
+   /**
+    * @param [in] name Graph name, used for logging and metrics
+    * @param [in] threadCount Number of worker threads
+    */
+   explicit InitializationGraph(const std::string& name,
+                                std::size_t        threadCount = 4u);
+   ~InitializationGraph();
+
+   InitializationGraph(const InitializationGraph&)            = delete;
+   InitializationGraph& operator=(const InitializationGraph&) = delete;
+
+   InitializationGraph(InitializationGraph&&) noexcept;
+   InitializationGraph& operator=(InitializationGraph&&) noexcept;
+
+   /**
+    * @brief Adds a step to the graph. Dependencies may be added after the
+    * step which depends on them.
+    *
+    * @param [in] name Unique step name
+    * @param [in] function Step function
+    * @param [in] dependencies Names of steps which must complete first
+    * @param [in] affinity Thread on which the step must run
+    */
+   void AddStep(const std::string&              name,
+                StepFunction                    function,
+                const std::vector<std::string>& dependencies = {},
+                ThreadAffinity affinity = ThreadAffinity::Any);
+
+   /**
+    * @brief Runs each step, blocking until all steps have completed. A step
+    * which throws an exception is logged as failed, and does not prevent its
+    * dependents from running.
+    *
+    * @return true if all steps succeeded
+    *
+    * @throws std::invalid_argument if a step has an unknown dependency, or
+    * the dependencies form a cycle
+    */
+   bool Run();
+
+   /**
+    * @brief Gets the trace of the most recent run, in order of completion.
+    */
+   std::vector<StepTrace> trace() const;
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace util
+} // namespace scwx
@@ -0,0 +1,202 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace scwx
+{
+namespace util
+{
+namespace metrics
+{
+
+enum class MetricType
+{
+   Counter,
+   Gauge,
+   Histogram
+};
+
+/**
+ * @brief A monotonically increasing count. Updates are lock-free.
+ */
+class Counter
+{
+public:
+   explicit Counter() = default;
+   ~Counter()         = default;
+
+   Counter(const Counter&)            = delete;
+   Counter& operator=(const Counter&) = delete;
+
+   std::uint64_t value() const;
+
+   void Increment(std::uint64_t n = 1);
+   void Reset();
+
+private:
+   std::atomic<std::uint64_t> value_ {0};
+};
+
+/**
+ * @brief A value which may increase or decrease. Updates are lock-free.
+ */
+class Gauge
+{
+public:
+   explicit Gauge() = default;
+   ~Gauge()         = default;
+
+   Gauge(const Gauge&)            = delete;
+   Gauge& operator=(const Gauge&) = delete;
+
+   std::int64_t value() const;
+
+   void Add(std::int64_t n);
+   void Set(std::int64_t value);
+
+private:
+   std::atomic<std::int64_t> value_ {0};
+};
+
+/**
+ * @brief A latency histogram with logarithmic buckets, each power of two being
+ * subdivided into linear sub-buckets (similar to HdrHistogram). Values are
+ * recorded in nanoseconds with a relative error of at most 1/16. Recording is
+ * lock-free.
+ */
+class Histogram
+{
+public:
+   static constexpr std::size_t kSubBucketBits  = 4;
+   static constexpr std::size_t kSubBucketCount = 1u << kSubBucketBits;
+   static constexpr std::size_t kBucketCount =
+      (64 - kSubBucketBits + 1) * kSubBucketCount;
+
+   explicit Histogram() = default;
+   ~Histogram()         = default;
+
+   Histogram(const Histogram&)            = delete;
+   Histogram& operator=(const Histogram&) = delete;
+
+   std::uint64_t count() const;
+   std::uint64_t max() const;
+   std::uint64_t sum() const;
+
+   /**
+    * @brief Gets the value at the given quantile.
+    *
+    * @param [in] quantile Quantile, from 0.0 to 1.0
+    *
+    * @return Upper bound of the bucket containing the quantile, in
+    * nanoseconds. Returns 0 if no values have been recorded.
+    */
+   std::uint64_t ValueAtQuantile(double quantile) const;
+
+   void Record(std::uint64_t nanoseconds);
+   void Record(std::chrono::steady_clock::duration duration);
+   void Reset();
+
+   static std::size_t   BucketIndex(std::uint64_t value);
+   static std::uint64_t BucketUpperBound(std::size_t index);
+
+private:
+   std::array<std::atomic<std::uint64_t>, kBucketCount> buckets_ {};
+
+   std::atomic<std::uint64_t> count_ {0};
+   std::atomic<std::uint64_t> sum_ {0};
+   std::atomic<std::uint64_t> max_ {0};
+};
+
+/**
+ * @brief Records the lifetime of the timer into a histogram.
+ */
+class ScopedTimer
+{
+public:
+   explicit ScopedTimer(Histogram& histogram);
+   ~ScopedTimer();
+
+   ScopedTimer(const ScopedTimer&)            = delete;
+   ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+   /**
+    * @brief Records the elapsed time now rather than on destruction.
+    */
+   void Stop();
+
+private:
+   Histogram*                            histogram_;
+   std::chrono::steady_clock::time_point start_;
+};
+
+struct MetricSnapshot
+{
+   std::string name_ {};
+   MetricType  type_ {MetricType::Counter};
+
+   // Counter and gauge value
+   std::int64_t value_ {0};
+
+   // Histogram values, in nanoseconds
+   std::uint64_t count_ {0};
+   std::uint64_t mean_ {0};
+   std::uint64_t p50_ {0};
+   std::uint64_t p90_ {0};
+   std::uint64_t p99_ {0};
+   std::uint64_t max_ {0};
+};
+
+/**
+ * @brief Registry of named metrics. Looking up a metric by name takes a lock,
+ * so frequently updated metrics should be looked up once and the reference
+ * retained. Metrics are never removed, and references remain valid for the
+ * lifetime of the program.
+ */
+class Registry
+{
+public:
+   explicit Registry();
+   ~Registry();
+
+   Registry(const Registry&)            = delete;
+   Registry& operator=(const Registry&) = delete;
+
+   Counter&   GetCounter(const std::string& name);
+   Gauge&     GetGauge(const std::string& name);
+   Histogram& GetHistogram(const std::string& name);
+
+   /**
+    * @brief Resets all counters and histograms. Gauges are unaffected.
+    */
+   void Reset();
+
+   /**
+    * @brief Captures the current value of all metrics, sorted by name.
+    */
+   std::vector<MetricSnapshot> Snapshot() const;
+
+   static Registry& Instance();
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+/**
+ * @brief Formats a metric name from a pipeline stage and an optional label,
+ * such as a product or pane (e.g., "sweep_compute[L2 REF]").
+ */
+std::string MetricName(std::string_view stage, std::string_view label = {});
+
+const std::string& GetMetricTypeName(MetricType type);
+
+} // namespace metrics
+} // namespace util
+} // namespace scwx
@@ -0,0 +1,503 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <optional>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace scwx
+{
+namespace util
+{
+
+namespace detail
+{
+
+template<std::size_t Size>
+struct UnsignedOfSize;
+
+template<>
+struct UnsignedOfSize<2>
+{
+   using type = std::uint16_t;
+};
+
+template<>
+struct UnsignedOfSize<4>
+{
+   using type = std::uint32_t;
+};
+
+template<>
+struct UnsignedOfSize<8>
+{
+   using type = std::uint64_t;
+};
+
+template<typename T>
+struct MemberPointerTraits;
+
+template<typename C, typename T>
+struct MemberPointerTraits<T C::*>
+{
+   using Object = C;
+   using Member = T;
+};
+
+template<auto Member>
+using MemberElement = std::remove_cvref_t<decltype(std::declval<
+   typename MemberPointerTraits<decltype(Member)>::Member&>()[0])>;
+
+} // namespace detail
+
+/**
+ * Reverses the byte order of an arithmetic value.
+ */
+template<typename T>
+   requires std::is_arithmetic_v<T>
+constexpr T ByteSwap(T value) noexcept
+{
+   if constexpr (sizeof(T) == 1)
+   {
+      return value;
+   }
+   else
+   {
+      using U = typename detail::UnsignedOfSize<sizeof(T)>::type;
+
+      U u = std::bit_cast<U>(value);
+
+      if constexpr (sizeof(T) == 2)
+      {
+         u = static_cast<U>((u >> 8) | (u << 8));
+      }
+      else if constexpr (sizeof(T) == 4)
+      {
+         u = ((u & 0xff000000u) >> 24) | ((u & 0x00ff0000u) >> 8) |
+             ((u & 0x0000ff00u) << 8) | ((u & 0x000000ffu) << 24);
+      }
+      else
+      {
+         u = ((u & 0xff00000000000000ull) >> 56) |
+             ((u & 0x00ff000000000000ull) >> 40) |
+             ((u & 0x0000ff0000000000ull) >> 24) |
+             ((u & 0x000000ff00000000ull) >> 8) |
+             ((u & 0x00000000ff000000ull) << 8) |
+             ((u & 0x0000000000ff0000ull) << 24) |
+             ((u & 0x000000000000ff00ull) << 40) |
+             ((u & 0x00000000000000ffull) << 56);
+      }
+
+      return std::bit_cast<T>(u);
+   }
+}
+
+/**
+ * Converts an arithmetic value between big-endian and native byte order.
+ */
+template<typename T>
+   requires std::is_arithmetic_v<T>
+constexpr T BigEndianToNative(T value) noexcept
+{
+   if constexpr (std::endian::native == std::endian::big)
+   {
+      return value;
+   }
+   else
+   {
+      return ByteSwap(value);
+   }
+}
+
+/**
+ * Converts a contiguous range of big-endian values to native byte order in
+ * place. The loop has no dependencies between elements, and is vectorized by
+ * the compiler.
+ */
+template<typename T>
+   requires std::is_arithmetic_v<T>
+void BigEndianToNative(std::span<T> values) noexcept
+{
+   if constexpr (sizeof(T) > 1 && std::endian::native == std::endian::little)
+   {
+      T* data = values.data();
+
+      for (std::size_t i = 0; i < values.size(); ++i)
+      {
+         data[i] = ByteSwap(data[i]);
+      }
+   }
+}
+
+/**
+ * Reads a big-endian value from unaligned memory.
+ */
+template<typename T>
+   requires std::is_arithmetic_v<T>
+T LoadBigEndian(const std::uint8_t* data) noexcept
+{
+   T value;
+   std::memcpy(&value, data, sizeof(T));
+   return BigEndianToNative(value);
+}
+
+/**
+ * Writes a big-endian value to unaligned memory.
+ */
+template<typename T>
+   requires std::is_arithmetic_v<T>
+void StoreBigEndian(T value, std::uint8_t* data) noexcept
+{
+   value = BigEndianToNative(value);
+   std::memcpy(data, &value, sizeof(T));
+}
+
+/**
+ * @brief Big-Endian Codec
+ *
+ * Encodes an arithmetic value, or an array of arithmetic values, in big-endian
+ * byte order.
+ */
+template<typename T>
+struct BigEndian
+{
+   static_assert(std::is_arithmetic_v<T>, "Unsupported big-endian type");
+
+   static constexpr std::size_t kSize = sizeof(T);
+
+   static void Load(const std::uint8_t* data, T& value) noexcept
+   {
+      value = LoadBigEndian<T>(data);
+   }
+   static void Store(const T& value, std::uint8_t* data) noexcept
+   {
+      StoreBigEndian<T>(value, data);
+   }
+};
+
+template<typename T, std::size_t N>
+struct BigEndian<std::array<T, N>>
+{
+   static_assert(std::is_arithmetic_v<T>, "Unsupported big-endian type");
+
+   static constexpr std::size_t kSize = sizeof(T) * N;
+
+   static void Load(const std::uint8_t* data, std::array<T, N>& value) noexcept
+   {
+      std::memcpy(value.data(), data, kSize);
+      BigEndianToNative(std::span<T> {value});
+   }
+   static void Store(const std::array<T, N>& value,
+                     std::uint8_t*            data) noexcept
+   {
+      for (std::size_t i = 0; i < N; ++i)
+      {
+         StoreBigEndian<T>(value[i], data + i * sizeof(T));
+      }
+   }
+};
+
+/**
+ * @brief Fixed String Codec
+ *
+ * Encodes a string of exactly Size characters. Embedded null characters are
+ * preserved on load, and short strings are null padded on store.
+ */
+template<std::size_t Size>
+struct FixedString
+{
+   static constexpr std::size_t kSize = Size;
+
+   static void Load(const std::uint8_t* data, std::string& value)
+   {
+      value.assign(reinterpret_cast<const char*>(data), Size);
+   }
+   static void Store(const std::string& value, std::uint8_t* data) noexcept
+   {
+      const std::size_t length = std::min(value.size(), Size);
+      std::memcpy(data, value.data(), length);
+      std::fill(data + length, data + Size, std::uint8_t {0});
+   }
+};
+
+/**
+ * @brief Record Field
+ *
+ * Maps a data member to a byte offset within a record.
+ *
+ * @tparam Member Pointer to data member
+ * @tparam Offset Byte offset within the record
+ * @tparam Codec Encoding of the member, big-endian by default. A record layout
+ * may be used to encode a nested structure.
+ */
+template<auto Member,
+         std::size_t Offset,
+         typename Codec = BigEndian<
+            typename detail::MemberPointerTraits<decltype(Member)>::Member>>
+struct Field
+{
+   using Object =
+      typename detail::MemberPointerTraits<decltype(Member)>::Object;
+
+   static constexpr std::size_t kOffset = Offset;
+   static constexpr std::size_t kSize   = Codec::kSize;
+
+   static void Load(const std::uint8_t* record, Object& object)
+   {
+      Codec::Load(record + Offset, object.*Member);
+   }
+   static void Store(const Object& object, std::uint8_t* record)
+   {
+      Codec::Store(object.*Member, record + Offset);
+   }
+};
+
+/**
+ * @brief Record Element Field
+ *
+ * Maps Count consecutive elements of an indexed data member, beginning at
+ * Index, to a byte offset within a record. The member may be any container
+ * supporting operator[], such as an array or map.
+ *
+ * @tparam Member Pointer to data member
+ * @tparam Index Index of the first element
+ * @tparam Offset Byte offset of the first element within the record
+ * @tparam Count Number of consecutive elements
+ * @tparam Codec Encoding of each element, big-endian by default
+ */
+template<auto        Member,
+         std::size_t Index,
+         std::size_t Offset,
+         std::size_t Count = 1,
+         typename Codec    = BigEndian<detail::MemberElement<Member>>>
+struct ElementField
+{
+   using Object =
+      typename detail::MemberPointerTraits<decltype(Member)>::Object;
+   using Container =
+      typename detail::MemberPointerTraits<decltype(Member)>::Member;
+   using Element = detail::MemberElement<Member>;
+
+   static constexpr std::size_t kOffset = Offset;
+   static constexpr std::size_t kSize   = Codec::kSize * Count;
+
+   static void Load(const std::uint8_t* record, Object& object)
+   {
+      for (std::size_t i = 0; i < Count; ++i)
+      {
+         Codec::Load(record + Offset + i * Codec::kSize,
+                     (object.*Member)[Key(i)]);
+      }
+   }
+   static void Store(const Object& object, std::uint8_t* record)
+   {
+      const Container& container = object.*Member;
+
+      for (std::size_t i = 0; i < Count; ++i)
+      {
+         std::uint8_t* data = record + Offset + i * Codec::kSize;
+
+         if constexpr (requires { container.find(Key(i)); })
+         {
+            // Missing map elements are stored as default values
+            auto it = container.find(Key(i));
+            Codec::Store(it != container.cend() ? it->second : Element {},
+                         data);
+         }
+         else
+         {
+            Codec::Store(container[Key(i)], data);
+         }
+      }
+   }
+
+private:
+   static constexpr auto Key(std::size_t i) noexcept
+   {
+      if constexpr (requires { typename Container::key_type; })
+      {
+         return static_cast<typename Container::key_type>(Index + i);
+      }
+      else
+      {
+         return Index + i;
+      }
+   }
+};
+
+/**
+ * @brief Record Layout
+ *
+ * Declares the fields of a fixed size record. The layout is validated at
+ * compile time: fields must be listed in offset order, must not overlap, and
+ * must lie within the record. Bytes not covered by a field are spare, and are
+ * ignored on load and zeroed on store.
+ *
+ * A record is read from a stream with a single read, and each field is
+ * decoded from the buffered record.
+ *
+ * @tparam Size Record size in bytes
+ * @tparam Fields Record fields
+ */
+template<std::size_t Size, typename... Fields>
+class RecordLayout
+{
+public:
+   static constexpr std::size_t kSize = Size;
+
+   /**
+    * Decodes a record from memory of at least kSize bytes.
+    */
+   template<typename T>
+   static void Load(const std::uint8_t* data, T& object)
+   {
+      (Fields::Load(data, object), ...);
+   }
+
+   /**
+    * Encodes a record to memory of at least kSize bytes.
+    */
+   template<typename T>
+   static void Store(const T& object, std::uint8_t* data)
+   {
+      std::fill(data, data + Size, std::uint8_t {0});
+      (Fields::Store(object, data), ...);
+   }
+
+   /**
+    * Reads and decodes a record from an input stream. If the record cannot be
+    * read, the stream fail bit is set, and the object is not modified.
+    *
+    * @return true if the record was read, otherwise false
+    */
+   template<typename T>
+   static bool Read(std::istream& is, T& object)
+   {
+      std::array<std::uint8_t, Size> buffer;
+      is.read(reinterpret_cast<char*>(buffer.data()), Size);
+
+      if (!is)
+      {
+         return false;
+      }
+
+      Load(buffer.data(), object);
+      return true;
+   }
+
+private:
+   static consteval bool IsValid()
+   {
+      constexpr std::array<std::size_t, sizeof...(Fields)> offsets {
+         Fields::kOffset...};
+      constexpr std::array<std::size_t, sizeof...(Fields)> sizes {
+         Fields::kSize...};
+
+      std::size_t end = 0;
+
+      for (std::size_t i = 0; i < offsets.size(); ++i)
+      {
+         if (offsets[i] < end || offsets[i] + sizes[i] > Size)
+         {
+            return false;
+         }
+         end = offsets[i] + sizes[i];
+      }
+
+      return true;
+   }
+
+   static_assert(IsValid(),
+                 "Record fields must be ordered, must not overlap, and must "
+                 "lie within the record");
+};
+
+/**
+ * @brief Record View
+ *
+ * Bounds-checked, read-only access to big-endian data in a span of bytes.
+ * Accesses outside of the span fail rather than reading past the end.
+ */
+class RecordView
+{
+public:
+   constexpr RecordView() noexcept = default;
+   constexpr explicit RecordView(std::span<const std::uint8_t> data) noexcept :
+       data_ {data}
+   {
+   }
+
+   constexpr std::span<const std::uint8_t> data() const noexcept
+   {
+      return data_;
+   }
+   constexpr std::size_t size() const noexcept { return data_.size(); }
+
+   /**
+    * Returns true if count bytes beginning at offset lie within the view.
+    */
+   constexpr bool contains(std::size_t offset, std::size_t count) const noexcept
+   {
+      return offset <= data_.size() && count <= data_.size() - offset;
+   }
+
+   /**
+    * Reads a big-endian value at a byte offset.
+    *
+    * @return Value, or empty if the value lies outside of the view
+    */
+   template<typename T>
+      requires std::is_arithmetic_v<T>
+   std::optional<T> Get(std::size_t offset) const noexcept
+   {
+      if (!contains(offset, sizeof(T)))
+      {
+         return std::nullopt;
+      }
+      return LoadBigEndian<T>(data_.data() + offset);
+   }
+
+   /**
+    * Decodes a record at a byte offset.
+    *
+    * @return true if the record lies within the view, otherwise false
+    */
+   template<typename Layout, typename T>
+   bool Load(std::size_t offset, T& object) const
+   {
+      if (!contains(offset, Layout::kSize))
+      {
+         return false;
+      }
+      Layout::Load(data_.data() + offset, object);
+      return true;
+   }
+
+   /**
+    * Returns a view of count bytes beginning at offset.
+    *
+    * @return Sub-view, or empty if the range lies outside of the view
+    */
+   std::optional<RecordView> subview(std::size_t offset,
+                                     std::size_t count) const noexcept
+   {
+      if (!contains(offset, count))
+      {
+         return std::nullopt;
+      }
+      return RecordView {data_.subspan(offset, count)};
+   }
+
+private:
+   std::span<const std::uint8_t> data_ {};
+};
+
+} // namespace util
+} // namespace scwx
@@ -7,6 +7,7 @@
 #include <chrono>
 #include <memory>
 #include <string>
+#include <string_view>
 
 namespace scwx
 {
@@ -23,7 +24,14 @@ class Ar2vFileImpl;
 class Ar2vFile : public NexradFile
 {
 public:
-   explicit Ar2vFile();
+   /**
+    * @brief Constructs an Archive II file.
+    *
+    * @param lazyLoad When true, LoadData performs a fast first pass that only
+    * records the location of each radial within the decompressed LDM records.
+    * Radial data for an elevation is parsed on first access, and cached.
+    */
+   explicit Ar2vFile(bool lazyLoad = false);
    ~Ar2vFile();
 
    Ar2vFile(const Ar2vFile&)            = delete;
@@ -36,11 +44,20 @@ public:
    std::uint32_t milliseconds() const;
    std::string   icao() const;
 
+   /**
+    * @brief Returns the number of valid messages in the file. If the file was
+    * lazy loaded, radials are counted when indexed, and a radial found to be
+    * invalid when its elevation is parsed is no longer counted.
+    */
    std::size_t message_count() const;
 
    std::chrono::system_clock::time_point start_time() const;
    std::chrono::system_clock::time_point end_time() const;
 
+   /**
+    * @brief Returns the radar data for all elevations. If the file was lazy
+    * loaded, this parses any elevations which have not yet been accessed.
+    */
    std::map<std::uint16_t, std::shared_ptr<rda::ElevationScan>>
                                                          radar_data() const;
    std::shared_ptr<const rda::VolumeCoveragePatternData> vcp_data() const;
@@ -53,6 +70,28 @@ public:
    bool LoadFile(const std::string& filename);
    bool LoadData(std::istream& is);
 
+   /**
+    * @brief Loads data incrementally as it is received, such as from a network
+    * transfer, as an alternative to LoadData.
+    *
+    * Each LDM record is decompressed asynchronously as soon as it has been
+    * received, and decompressed records are parsed in order. When the maximum
+    * number of records are pending decompression, this blocks until the
+    * oldest record has been parsed, limiting buffered data.
+    *
+    * @param data Next chunk of data
+    *
+    * @return false if the data is invalid, and no further data is required
+    */
+   bool LoadChunk(std::string_view data);
+
+   /**
+    * @brief Completes loading data received by LoadChunk.
+    *
+    * @return true if the data was valid
+    */
+   bool FinishLoad();
+
 private:
    std::unique_ptr<Ar2vFileImpl> p;
 };
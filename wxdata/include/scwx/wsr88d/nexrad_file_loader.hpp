@@ -0,0 +1,53 @@
+#pragma once
+
+#include <scwx/wsr88d/nexrad_file.hpp>
+
+#include <memory>
+#include <string_view>
+
+namespace scwx
+{
+namespace wsr88d
+{
+
+/**
+ * @brief Loads a NEXRAD file incrementally from data as it is received, such
+ * as from a network transfer.
+ *
+ * Archive II data is loaded as it is received, overlapping decompression and
+ * parsing with the transfer. Other data is buffered, and loaded by the NEXRAD
+ * file factory when complete.
+ */
+class NexradFileLoader
+{
+public:
+   explicit NexradFileLoader();
+   ~NexradFileLoader();
+
+   NexradFileLoader(const NexradFileLoader&)            = delete;
+   NexradFileLoader& operator=(const NexradFileLoader&) = delete;
+
+   NexradFileLoader(NexradFileLoader&&) noexcept;
+   NexradFileLoader& operator=(NexradFileLoader&&) noexcept;
+
+   /**
+    * @brief Loads the next chunk of data.
+    *
+    * @return false if the data is invalid, and no further data is required
+    */
+   bool Write(std::string_view data);
+
+   /**
+    * @brief Completes loading after all data has been written.
+    *
+    * @return NEXRAD file, or nullptr if the data was invalid
+    */
+   std::shared_ptr<NexradFile> Finish();
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace wsr88d
+} // namespace scwx
@@ -55,6 +55,8 @@ public:
    static std::shared_ptr<DigitalRadarDataGeneric>
    Create(Level2MessageHeader&& header, std::istream& is);
 
+   static DataBlockType GetDataBlockType(const std::string& dataName);
+
 private:
    class Impl;
    std::unique_ptr<Impl> p;
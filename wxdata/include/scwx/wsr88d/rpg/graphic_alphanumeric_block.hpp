@@ -2,6 +2,7 @@
 
 #include <scwx/awips/message.hpp>
 #include <scwx/wsr88d/rpg/packet.hpp>
+#include <scwx/wsr88d/rpg/packet_arena.hpp>
 
 #include <cstdint>
 #include <memory>
@@ -19,7 +20,13 @@ class GraphicAlphanumericBlockImpl;
 class GraphicAlphanumericBlock : public awips::Message
 {
 public:
-   explicit GraphicAlphanumericBlock();
+   /**
+    * @brief Creates a graphic alphanumeric block.
+    *
+    * @param arena Arena in which to construct packets. If null, packets are
+    * allocated individually.
+    */
+   explicit GraphicAlphanumericBlock(PacketArena* arena = nullptr);
    ~GraphicAlphanumericBlock();
 
    GraphicAlphanumericBlock(const GraphicAlphanumericBlock&) = delete;
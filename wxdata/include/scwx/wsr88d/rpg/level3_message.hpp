@@ -2,6 +2,7 @@
 
 #include <scwx/awips/message.hpp>
 #include <scwx/wsr88d/rpg/level3_message_header.hpp>
+#include <scwx/wsr88d/rpg/packet_arena.hpp>
 #include <scwx/wsr88d/rpg/product_description_block.hpp>
 
 namespace scwx
@@ -35,6 +36,12 @@ public:
 
    virtual std::shared_ptr<ProductDescriptionBlock> description_block() const;
 
+   /**
+    * @brief Arena owning each packet of the message. Packets are destroyed
+    * together, when the message and all packet handles have been released.
+    */
+   const std::shared_ptr<PacketArena>& packet_arena() const;
+
 private:
    std::unique_ptr<Level3MessageImpl> p;
 };
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace scwx
+{
+namespace wsr88d
+{
+namespace rpg
+{
+
+/**
+ * @brief Monotonic arena owning each packet of a Level 3 message.
+ *
+ * Packets are constructed in blocks of arena memory, and are destroyed
+ * together with the arena. Handles to packets share ownership of the arena,
+ * rather than of the individual packet, so copying a handle does not allocate.
+ */
+class PacketArena : public std::enable_shared_from_this<PacketArena>
+{
+public:
+   ~PacketArena();
+
+   PacketArena(const PacketArena&)            = delete;
+   PacketArena& operator=(const PacketArena&) = delete;
+
+   PacketArena(PacketArena&&) noexcept            = delete;
+   PacketArena& operator=(PacketArena&&) noexcept = delete;
+
+   /**
+    * @brief Number of objects constructed in the arena
+    */
+   std::size_t object_count() const;
+
+   /**
+    * @brief Number of bytes allocated from the arena
+    */
+   std::size_t bytes_allocated() const;
+
+   /**
+    * @brief Constructs an object in the arena.
+    *
+    * @return Handle to the object, sharing ownership of the arena
+    */
+   template<class T, class... Args>
+   std::shared_ptr<T> New(Args&&... args)
+   {
+      void* memory = Allocate(sizeof(T), alignof(T));
+      T*    object = ::new (memory) T(std::forward<Args>(args)...);
+
+      AddDestructor(object,
+                    [](void* o) { static_cast<T*>(o)->~T(); });
+
+      return std::shared_ptr<T>(shared_from_this(), object);
+   }
+
+   static std::shared_ptr<PacketArena> Create();
+
+private:
+   explicit PacketArena();
+
+   void* Allocate(std::size_t size, std::size_t alignment);
+   void  AddDestructor(void* object, void (*destroy)(void*));
+
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace rpg
+} // namespace wsr88d
+} // namespace scwx
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <scwx/wsr88d/rpg/packet.hpp>
+#include <scwx/wsr88d/rpg/packet_arena.hpp>
 
 namespace scwx
 {
@@ -22,7 +23,17 @@ private:
    PacketFactory& operator=(PacketFactory&&) noexcept = delete;
 
 public:
-   static std::shared_ptr<Packet> Create(std::istream& is);
+   /**
+    * @brief Creates the next packet in the stream.
+    *
+    * @param is Input stream
+    * @param arena Arena in which to construct the packet. If null, the packet
+    * is allocated individually.
+    *
+    * @return Packet, or nullptr if the packet was invalid
+    */
+   static std::shared_ptr<Packet> Create(std::istream& is,
+                                         PacketArena*  arena = nullptr);
 };
 
 } // namespace rpg
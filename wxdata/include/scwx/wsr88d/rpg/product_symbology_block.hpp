@@ -2,9 +2,11 @@
 
 #include <scwx/awips/message.hpp>
 #include <scwx/wsr88d/rpg/packet.hpp>
+#include <scwx/wsr88d/rpg/packet_arena.hpp>
 
 #include <cstdint>
 #include <memory>
+#include <span>
 
 namespace scwx
 {
@@ -18,7 +20,13 @@ class ProductSymbologyBlockImpl;
 class ProductSymbologyBlock : public awips::Message
 {
 public:
-   explicit ProductSymbologyBlock();
+   /**
+    * @brief Creates a product symbology block.
+    *
+    * @param arena Arena in which to construct packets. If null, packets are
+    * allocated individually.
+    */
+   explicit ProductSymbologyBlock(PacketArena* arena = nullptr);
    ~ProductSymbologyBlock();
 
    ProductSymbologyBlock(const ProductSymbologyBlock&) = delete;
@@ -30,7 +38,7 @@ public:
    int16_t  block_divider() const;
    uint16_t number_of_layers() const;
 
-   std::vector<std::shared_ptr<Packet>> packet_list(uint16_t i) const;
+   std::span<const std::shared_ptr<Packet>> packet_list(uint16_t i) const;
 
    size_t data_size() const override;
 
@@ -1,9 +1,11 @@
 #pragma once
 
+#include <scwx/wsr88d/rpg/packet_arena.hpp>
 #include <scwx/wsr88d/rpg/special_graphic_symbol_packet.hpp>
 
 #include <cstdint>
 #include <memory>
+#include <span>
 
 namespace scwx
 {
@@ -15,7 +17,13 @@ namespace rpg
 class ScitDataPacket : public SpecialGraphicSymbolPacket
 {
 public:
-   explicit ScitDataPacket();
+   /**
+    * @brief Creates a SCIT data packet.
+    *
+    * @param arena Arena in which to construct subpackets, which must contain
+    * this packet. If null, subpackets are allocated individually.
+    */
+   explicit ScitDataPacket(PacketArena* arena = nullptr);
    ~ScitDataPacket();
 
    ScitDataPacket(const ScitDataPacket&)            = delete;
@@ -24,7 +32,13 @@ public:
    ScitDataPacket(ScitDataPacket&&) noexcept;
    ScitDataPacket& operator=(ScitDataPacket&&) noexcept;
 
-   std::vector<std::shared_ptr<Packet>> packet_list() const;
+   /**
+    * @brief Subpackets of the SCIT data packet. Subpackets are owned by this
+    * packet, or by the arena containing it, and are valid while this packet
+    * is referenced. A handle to a subpacket should alias the handle to this
+    * packet.
+    */
+   std::span<Packet* const> packet_list() const;
 
    std::size_t RecordCount() const override;
 
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <scwx/common/products.hpp>
+#include <scwx/wsr88d/ar2v_file.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace scwx
+{
+namespace wsr88d
+{
+
+/**
+ * @brief Products derived from each elevation cut of a Level 2 reflectivity
+ * volume: composite reflectivity, echo tops and vertically integrated liquid.
+ *
+ * When the volume is created, each elevation cut is resampled onto a common
+ * polar grid, indexed by ground range, and the height of the beam above each
+ * gate is computed using the 4/3 effective earth radius model. Products are
+ * computed by kernels operating on contiguous gate arrays of each cut, in
+ * parallel across blocks of radials. The volume is immutable once created, and
+ * may be used concurrently.
+ */
+class VolumeProducts
+{
+public:
+   struct Grid
+   {
+      std::size_t radials_ {720};
+      std::size_t gates_ {0};
+
+      // Ground range to the center of the first gate and gate spacing, in
+      // meters
+      float firstGateRange_ {2125.0f};
+      float gateSpacing_ {250.0f};
+   };
+
+   struct Cut
+   {
+      // Elevation angle of the cut, in degrees
+      float elevation_ {0.0f};
+
+      // Reflectivity data moments, ordered by radial then gate. Data moments
+      // below the signal threshold are stored as 0, and range folded data as 1.
+      std::vector<std::uint8_t> data_ {};
+   };
+
+   /**
+    * @brief Creates a volume from a set of elevation cuts which have been
+    * resampled onto a common grid.
+    *
+    * @param [in] grid Common polar grid
+    * @param [in] cuts Elevation cuts, in any order
+    * @param [in] referenceRadial Radial from which the time and volume
+    * coverage pattern of derived products are taken (optional)
+    */
+   explicit VolumeProducts(
+      const Grid&                                  grid,
+      std::vector<Cut>                             cuts,
+      std::shared_ptr<const rda::GenericRadarData> referenceRadial = nullptr);
+   ~VolumeProducts();
+
+   VolumeProducts(const VolumeProducts&)            = delete;
+   VolumeProducts& operator=(const VolumeProducts&) = delete;
+
+   VolumeProducts(VolumeProducts&&) noexcept;
+   VolumeProducts& operator=(VolumeProducts&&) noexcept;
+
+   const Grid& grid() const;
+
+   /**
+    * @brief Elevation cuts, ordered by elevation angle
+    */
+   const std::vector<Cut>& cuts() const;
+
+   /**
+    * @brief Height of the center of the beam above radar level for each gate
+    * of an elevation cut, in meters.
+    */
+   const std::vector<float>& beam_height(std::size_t cut) const;
+
+   /**
+    * @brief Computes a derived product.
+    *
+    * @param [in] product Composite reflectivity, echo tops or vertically
+    * integrated liquid
+    *
+    * @return Data moments ordered by radial then gate, encoded using the scale
+    * and offset of the product. A value of 0 indicates no data. Empty if the
+    * product is not a derived product.
+    */
+   std::vector<std::uint8_t> Compute(common::Level2Product product) const;
+
+   /**
+    * @brief Computes a derived product, as a single elevation scan with a
+    * reflectivity moment data block for each radial of the grid.
+    *
+    * @param [in] product Composite reflectivity, echo tops or vertically
+    * integrated liquid
+    *
+    * @return Elevation scan, or nullptr if the product is not a derived product
+    */
+   std::shared_ptr<rda::ElevationScan>
+   CreateElevationScan(common::Level2Product product) const;
+
+   static bool  IsDerivedProduct(common::Level2Product product);
+   static float GetScale(common::Level2Product product);
+   static float GetOffset(common::Level2Product product);
+
+   /**
+    * @brief Creates a volume from each reflectivity elevation cut of a Level 2
+    * file. The grid matches the gate spacing and extent of the lowest cut.
+    *
+    * @param [in] file Level 2 file
+    *
+    * @return Volume, or nullptr if reflectivity is not present
+    */
+   static std::shared_ptr<VolumeProducts>
+   Create(const std::shared_ptr<Ar2vFile>& file);
+
+private:
+   class Impl;
+   std::unique_ptr<Impl> p;
+};
+
+} // namespace wsr88d
+} // namespace scwx
@@ -45,10 +45,10 @@ bool CodedLocation::Parse(const StringRange& lines, const std::string& wfo)
 
    std::vector<std::string> tokenList;
 
-   for (std::string line : lines)
+   for (std::string_view line : lines)
    {
       std::string        token;
-      std::istringstream tokenStream {line};
+      std::istringstream tokenStream {std::string {line}};
 
       while (tokenStream >> token)
       {
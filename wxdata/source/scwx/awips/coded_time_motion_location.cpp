@@ -80,10 +80,10 @@ bool CodedTimeMotionLocation::Parse(const StringRange& lines,
 
    std::vector<std::string> tokenList;
 
-   for (std::string line : lines)
+   for (std::string_view line : lines)
    {
       std::string        token;
-      std::istringstream tokenStream {line};
+      std::istringstream tokenStream {std::string {line}};
 
       while (tokenStream >> token)
       {
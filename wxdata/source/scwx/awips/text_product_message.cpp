@@ -1,7 +1,6 @@
 #include <scwx/awips/text_product_message.hpp>
 #include <scwx/common/characters.hpp>
 #include <scwx/util/logger.hpp>
-#include <scwx/util/streams.hpp>
 
 #include <algorithm>
 #include <istream>
@@ -9,7 +8,6 @@
 
 #include <boost/algorithm/string/replace.hpp>
 #include <boost/algorithm/string/trim.hpp>
-#include <re2/re2.h>
 
 namespace scwx
 {
@@ -19,28 +17,57 @@ namespace awips
 static const std::string logPrefix_ = "scwx::awips::text_product_message";
 static const auto        logger_    = scwx::util::Logger::Create(logPrefix_);
 
-// Issuance date/time takes one of the following forms:
-// * <hhmm>_xM_<tz>_day_mon_<dd>_year
-// * <hhmm>_UTC_day_mon_<dd>_year
-// Segment Header only:
-// * <hhmm>_xM_<tz1>_day_mon_<dd>_year_/<hhmm>_xM_<tz2>_day_mon_<dd>_year/
-// Look for hhmm (xM|UTC) to key the date/time string
-static constexpr LazyRE2 reDateTimeString = {"^[0-9]{3,4} ([AP]M|UTC)"};
+/**
+ * @brief Text Scanner
+ *
+ * Scans lines from product text without copying. Lines are terminated by LF,
+ * or by one or more CR optionally followed by LF, consistent with
+ * util::getline.
+ */
+class TextScanner
+{
+public:
+   explicit TextScanner(std::string_view text) : text_ {text} {}
+
+   bool eof() const { return position_ >= text_.size(); }
+   int  peek() const
+   {
+      return eof() ? std::char_traits<char>::eof() :
+                     std::char_traits<char>::to_int_type(text_[position_]);
+   }
+   std::size_t tell() const { return position_; }
+   void        seek(std::size_t position) { position_ = position; }
+
+   std::string_view GetLine();
+
+private:
+   std::string_view text_;
+   std::size_t      position_ {0};
+};
 
 static void ParseCodedInformation(std::shared_ptr<Segment> segment,
                                   const std::string&       wfo);
-static std::vector<std::string>     ParseProductContent(std::istream& is);
-static void                         SkipBlankLines(std::istream& is);
-static bool                         TryParseEndOfProduct(std::istream& is);
-static std::vector<std::string>     TryParseMndHeader(std::istream& is);
-static std::vector<std::string>     TryParseOverviewBlock(std::istream& is);
-static std::optional<SegmentHeader> TryParseSegmentHeader(std::istream& is);
-static std::optional<Vtec>          TryParseVtecString(std::istream& is);
+static std::vector<std::string_view> ParseProductContent(TextScanner& scanner);
+static bool ParseWmoHeader(TextScanner& scanner, WmoHeader& wmoHeader);
+static void SkipBlankLines(TextScanner& scanner);
+static bool TryParseEndOfProduct(TextScanner& scanner);
+static std::vector<std::string_view> TryParseMndHeader(TextScanner& scanner);
+static std::vector<std::string_view>
+TryParseOverviewBlock(TextScanner& scanner);
+static std::optional<SegmentHeader> TryParseSegmentHeader(TextScanner& scanner);
+static std::optional<Vtec>          TryParseVtecString(TextScanner& scanner);
+
+static bool IsDateTimeString(std::string_view line);
+static bool IsHVtecString(std::string_view line);
+static bool IsPVtecString(std::string_view line);
+static bool IsUgcExpiration(std::string_view line);
+static bool IsUgcString(std::string_view line);
 
 class TextProductMessageImpl
 {
 public:
    explicit TextProductMessageImpl() :
+       text_ {},
        messageContent_ {},
        wmoHeader_ {},
        mndHeader_ {},
@@ -50,10 +77,11 @@ public:
    }
    ~TextProductMessageImpl() = default;
 
-   std::string                           messageContent_;
+   std::shared_ptr<const std::string>    text_;
+   std::string_view                      messageContent_;
    std::shared_ptr<WmoHeader>            wmoHeader_;
-   std::vector<std::string>              mndHeader_;
-   std::vector<std::string>              overviewBlock_;
+   std::vector<std::string_view>         mndHeader_;
+   std::vector<std::string_view>         overviewBlock_;
    std::vector<std::shared_ptr<Segment>> segments_;
 };
 
@@ -69,7 +97,24 @@ TextProductMessage::operator=(TextProductMessage&&) noexcept = default;
 
 std::string TextProductMessage::message_content() const
 {
-   return p->messageContent_;
+   std::string messageContent {p->messageContent_};
+
+   // Trim extra characters from raw message
+   while (messageContent.size() > 0 &&
+          (messageContent.back() == common::Characters::NUL ||
+           messageContent.back() == common::Characters::ETX))
+   {
+      messageContent.resize(messageContent.size() - 1);
+   }
+   boost::replace_all(messageContent, "\r\r\n", "\n");
+   boost::trim(messageContent);
+
+   return messageContent;
+}
+
+std::shared_ptr<const std::string> TextProductMessage::raw_text() const
+{
+   return p->text_;
 }
 
 std::shared_ptr<WmoHeader> TextProductMessage::wmo_header() const
@@ -79,12 +124,12 @@ std::shared_ptr<WmoHeader> TextProductMessage::wmo_header() const
 
 std::vector<std::string> TextProductMessage::mnd_header() const
 {
-   return p->mndHeader_;
+   return {p->mndHeader_.cbegin(), p->mndHeader_.cend()};
 }
 
 std::vector<std::string> TextProductMessage::overview_block() const
 {
-   return p->overviewBlock_;
+   return {p->overviewBlock_.cbegin(), p->overviewBlock_.cend()};
 }
 
 size_t TextProductMessage::segment_count() const
@@ -215,49 +260,56 @@ bool TextProductMessage::Parse(std::istream& is)
 {
    bool dataValid = true;
 
-   std::streampos messageStart = is.tellg();
+   // Read the product in a single pass through the end of text, or the end of
+   // the stream. Segment text references the product text.
+   auto text = std::make_shared<std::string>();
+   std::getline(is, *text, common::Characters::ETX);
+
+   TextScanner scanner {*text};
 
+   p->text_      = text;
    p->wmoHeader_ = std::make_shared<WmoHeader>();
-   dataValid     = p->wmoHeader_->Parse(is);
+   dataValid     = ParseWmoHeader(scanner, *p->wmoHeader_);
 
-   for (size_t i = 0; dataValid && !is.eof(); i++)
+   for (size_t i = 0; dataValid && !scanner.eof(); i++)
    {
-      if (i != 0 && TryParseEndOfProduct(is))
+      if (i != 0 && TryParseEndOfProduct(scanner))
       {
          break;
       }
 
       std::shared_ptr<Segment> segment = std::make_shared<Segment>();
+      segment->text_                   = text;
       segment->wmoHeader_              = p->wmoHeader_;
 
       if (i == 0)
       {
-         if (is.peek() != '\r')
+         if (scanner.peek() != '\r')
          {
-            segment->header_ = TryParseSegmentHeader(is);
+            segment->header_ = TryParseSegmentHeader(scanner);
          }
 
-         SkipBlankLines(is);
+         SkipBlankLines(scanner);
 
-         p->mndHeader_ = TryParseMndHeader(is);
-         SkipBlankLines(is);
+         p->mndHeader_ = TryParseMndHeader(scanner);
+         SkipBlankLines(scanner);
 
          // Optional overview block appears between MND and segment header
          if (!segment->header_.has_value())
          {
-            p->overviewBlock_ = TryParseOverviewBlock(is);
-            SkipBlankLines(is);
+            p->overviewBlock_ = TryParseOverviewBlock(scanner);
+            SkipBlankLines(scanner);
          }
       }
 
       if (!segment->header_.has_value())
       {
-         segment->header_ = TryParseSegmentHeader(is);
-         SkipBlankLines(is);
+         segment->header_ = TryParseSegmentHeader(scanner);
+         SkipBlankLines(scanner);
       }
 
-      segment->productContent_ = ParseProductContent(is);
-      SkipBlankLines(is);
+      segment->productContent_ = ParseProductContent(scanner);
+      SkipBlankLines(scanner);
 
       ParseCodedInformation(segment, p->wmoHeader_->icao());
 
@@ -269,50 +321,16 @@ bool TextProductMessage::Parse(std::istream& is)
 
    if (dataValid)
    {
-      // Store raw message content
-      if (is.good())
-      {
-         // Read content equal to the message size
-         std::streampos  messageEnd  = is.tellg();
-         std::streamsize messageSize = messageEnd - messageStart;
-         p->messageContent_.resize(messageEnd - messageStart);
-         is.seekg(messageStart);
-         if (is.peek() == common::Characters::SOH)
-         {
-            is.seekg(std::streamoff {1}, std::ios_base::cur);
-            messageSize--;
-         }
-         is.read(p->messageContent_.data(), messageSize);
-      }
-      else
-      {
-         // Read remaining content in the input stream
-         is.clear();
-         is.seekg(messageStart);
-         if (is.peek() == common::Characters::SOH)
-         {
-            is.seekg(std::streamoff {1}, std::ios_base::cur);
-         }
-
-         constexpr std::istreambuf_iterator<char> eos;
-         p->messageContent_ = {std::istreambuf_iterator<char>(is), eos};
-      }
-
-      // Trim extra characters from raw message
-      while (p->messageContent_.size() > 0 &&
-             (p->messageContent_.back() == common::Characters::NUL ||
-              p->messageContent_.back() == common::Characters::ETX))
+      // Store raw message content, excluding the start of heading
+      p->messageContent_ = *text;
+      if (p->messageContent_.starts_with(common::Characters::SOH))
       {
-         p->messageContent_.resize(p->messageContent_.size() - 1);
+         p->messageContent_.remove_prefix(1);
       }
-      boost::replace_all(p->messageContent_, "\r\r\n", "\n");
-      boost::trim(p->messageContent_);
-      p->messageContent_.shrink_to_fit();
    }
    else
    {
-      p->messageContent_.resize(0);
-      p->messageContent_.shrink_to_fit();
+      p->messageContent_ = {};
    }
 
    return dataValid;
@@ -321,7 +339,7 @@ bool TextProductMessage::Parse(std::istream& is)
 void ParseCodedInformation(std::shared_ptr<Segment> segment,
                            const std::string&       wfo)
 {
-   typedef std::vector<std::string>::const_iterator StringIterator;
+   typedef std::vector<std::string_view>::const_iterator StringIterator;
 
    static constexpr std::size_t kThreatCategoryTagCount = 4;
    static const std::array<std::string, kThreatCategoryTagCount>
@@ -331,7 +349,7 @@ void ParseCodedInformation(std::shared_ptr<Segment> segment,
                            "TORNADO DAMAGE THREAT..."};
    std::array<std::string, kThreatCategoryTagCount>::const_iterator threatTagIt;
 
-   std::vector<std::string>& productContent = segment->productContent_;
+   std::vector<std::string_view>& productContent = segment->productContent_;
 
    StringIterator codedLocationBegin = productContent.cend();
    StringIterator codedLocationEnd   = productContent.cend();
@@ -386,8 +404,8 @@ void ParseCodedInformation(std::shared_ptr<Segment> segment,
                                            })) != kThreatCategoryTags.cend() &&
                it->length() > threatTagIt->length())
       {
-         const std::string threatCategoryName =
-            it->substr(threatTagIt->length());
+         const std::string threatCategoryName {
+            it->substr(threatTagIt->length())};
 
          ibw::ThreatCategory threatCategory =
             ibw::GetThreatCategory(threatCategoryName);
@@ -425,14 +443,13 @@ void ParseCodedInformation(std::shared_ptr<Segment> segment,
    }
 }
 
-std::vector<std::string> ParseProductContent(std::istream& is)
+std::vector<std::string_view> ParseProductContent(TextScanner& scanner)
 {
-   std::vector<std::string> productContent;
-   std::string              line;
+   std::vector<std::string_view> productContent;
 
-   while (!is.eof() && is.peek() != common::Characters::ETX)
+   while (!scanner.eof())
    {
-      util::getline(is, line);
+      std::string_view line = scanner.GetLine();
 
       if (!productContent.empty() || !line.starts_with("$$"))
       {
@@ -454,73 +471,74 @@ std::vector<std::string> ParseProductContent(std::istream& is)
    return productContent;
 }
 
-void SkipBlankLines(std::istream& is)
+bool ParseWmoHeader(TextScanner& scanner, WmoHeader& wmoHeader)
 {
-   std::string line;
+   std::string_view sequenceLine {};
 
-   while (is.peek() == '\r')
+   if (scanner.peek() == common::Characters::SOH)
    {
-      util::getline(is, line);
+      scanner.GetLine();
+      sequenceLine = scanner.GetLine();
    }
-}
 
-bool TryParseEndOfProduct(std::istream& is)
-{
-   std::string    line;
-   std::streampos isBegin     = is.tellg();
-   bool           endOfStream = false;
+   // Consistent with util::getline, the header is incomplete if the AWIPS
+   // identifier line is read at the end of the product
+   std::string_view wmoLine      = scanner.GetLine();
+   const bool       endOfProduct = scanner.eof();
+   std::string_view awipsLine    = scanner.GetLine();
 
-   if (is.peek() == common::Characters::ETX)
+   if (endOfProduct)
    {
-      is.get();
-      endOfStream = true;
+      logger_->trace("Reached end of product");
+      return false;
    }
-   else if (is.peek() == EOF)
+
+   return wmoHeader.Parse(sequenceLine, wmoLine, awipsLine);
+}
+
+void SkipBlankLines(TextScanner& scanner)
+{
+   while (scanner.peek() == '\r')
    {
-      endOfStream = true;
+      scanner.GetLine();
    }
+}
 
-   if (!endOfStream)
+bool TryParseEndOfProduct(TextScanner& scanner)
+{
+   std::size_t begin        = scanner.tell();
+   bool        endOfProduct = scanner.eof();
+
+   if (!endOfProduct)
    {
       // Optional Forecast Identifier
-      util::getline(is, line);
-      SkipBlankLines(is);
+      scanner.GetLine();
+      SkipBlankLines(scanner);
 
-      if (is.peek() == common::Characters::ETX)
-      {
-         is.get();
-         endOfStream = true;
-      }
-      else if (is.peek() == EOF)
-      {
-         endOfStream = true;
-      }
+      endOfProduct = scanner.eof();
    }
 
-   if (!endOfStream)
+   if (!endOfProduct)
    {
-      // End of Product was not found, so reset the istream to the original
+      // End of Product was not found, so reset the scanner to the original
       // state
-      is.seekg(isBegin, std::ios_base::beg);
+      scanner.seek(begin);
    }
 
-   return endOfStream;
+   return endOfProduct;
 }
 
-std::vector<std::string> TryParseMndHeader(std::istream& is)
+std::vector<std::string_view> TryParseMndHeader(TextScanner& scanner)
 {
-   std::vector<std::string> mndHeader;
-   std::string              line;
-   std::streampos           isBegin = is.tellg();
+   std::vector<std::string_view> mndHeader;
+   std::size_t                   begin = scanner.tell();
 
-   while (!is.eof() && is.peek() != '\r')
+   while (!scanner.eof() && scanner.peek() != '\r')
    {
-      util::getline(is, line);
-      mndHeader.push_back(line);
+      mndHeader.push_back(scanner.GetLine());
    }
 
-   if (!mndHeader.empty() &&
-       !RE2::PartialMatch(mndHeader.back(), *reDateTimeString))
+   if (!mndHeader.empty() && !IsDateTimeString(mndHeader.back()))
    {
       // MND Header should end with an Issuance Date/Time Line
       mndHeader.clear();
@@ -528,58 +546,48 @@ std::vector<std::string> TryParseMndHeader(std::istream& is)
 
    if (mndHeader.empty())
    {
-      // MND header was not found, so reset the istream to the original state
-      is.seekg(isBegin, std::ios_base::beg);
+      // MND header was not found, so reset the scanner to the original state
+      scanner.seek(begin);
    }
 
    return mndHeader;
 }
 
-std::vector<std::string> TryParseOverviewBlock(std::istream& is)
+std::vector<std::string_view> TryParseOverviewBlock(TextScanner& scanner)
 {
    // Optional overview block contains text in the following format:
    // ...OVERVIEW HEADLINE... /OPTIONAL/
    // .OVERVIEW WITH GENERAL INFORMATION / OPTIONAL /
    // Key off the block beginning with .
-   std::vector<std::string> overviewBlock;
-   std::string              line;
+   std::vector<std::string_view> overviewBlock;
 
-   if (is.peek() == '.')
+   if (scanner.peek() == '.')
    {
-      while (!is.eof() && is.peek() != '\r')
+      while (!scanner.eof() && scanner.peek() != '\r')
       {
-         util::getline(is, line);
-         overviewBlock.push_back(line);
+         overviewBlock.push_back(scanner.GetLine());
       }
    }
 
    return overviewBlock;
 }
 
-std::optional<SegmentHeader> TryParseSegmentHeader(std::istream& is)
+std::optional<SegmentHeader> TryParseSegmentHeader(TextScanner& scanner)
 {
-   // UGC takes the form SSFNNN-NNN>NNN-SSFNNN-DDHHMM- (NWSI 10-1702)
-   // Look for SSF(NNN)?[->] to key the UGC string
-   // Look for DDHHMM- to end the UGC string
-   static constexpr LazyRE2 reUgcString     = {"^[A-Z]{2}[CZ]([0-9]{3})?[->]"};
-   static constexpr LazyRE2 reUgcExpiration = {"[0-9]{6}-$"};
-
    std::optional<SegmentHeader> header = std::nullopt;
-   std::string                  line;
-   std::streampos               isBegin = is.tellg();
-
-   util::getline(is, line);
+   std::size_t                  begin  = scanner.tell();
+   std::string_view             line   = scanner.GetLine();
 
-   if (RE2::PartialMatch(line, *reUgcString))
+   if (IsUgcString(line))
    {
       header = SegmentHeader();
       header->ugcString_.push_back(line);
 
       // If UGC is multi-line, continue parsing
-      while (!is.eof() && is.peek() != '\r' &&
-             !RE2::PartialMatch(line, *reUgcExpiration))
+      while (!scanner.eof() && scanner.peek() != '\r' &&
+             !IsUgcExpiration(line))
       {
-         util::getline(is, line);
+         line = scanner.GetLine();
          header->ugcString_.push_back(line);
       }
 
@@ -590,21 +598,21 @@ std::optional<SegmentHeader> TryParseSegmentHeader(std::istream& is)
    if (header.has_value())
    {
       std::optional<Vtec> vtec;
-      while ((vtec = TryParseVtecString(is)) != std::nullopt)
+      while ((vtec = TryParseVtecString(scanner)) != std::nullopt)
       {
          header->vtecString_.push_back(std::move(*vtec));
       }
 
-      while (!is.eof() && is.peek() != '\r')
+      while (!scanner.eof() && scanner.peek() != '\r')
       {
-         util::getline(is, line);
-         if (!RE2::PartialMatch(line, *reDateTimeString))
+         line = scanner.GetLine();
+         if (!IsDateTimeString(line))
          {
             header->ugcNames_.push_back(line);
          }
          else
          {
-            header->issuanceDateTime_.swap(line);
+            header->issuanceDateTime_ = line;
             break;
          }
       }
@@ -612,52 +620,39 @@ std::optional<SegmentHeader> TryParseSegmentHeader(std::istream& is)
 
    if (!header.has_value())
    {
-      // We did not find a valid segment header, so we reset the istream to the
-      // original state
-      is.seekg(isBegin, std::ios_base::beg);
+      // We did not find a valid segment header, so we reset the scanner to
+      // the original state
+      scanner.seek(begin);
    }
 
    return header;
 }
 
-std::optional<Vtec> TryParseVtecString(std::istream& is)
+std::optional<Vtec> TryParseVtecString(TextScanner& scanner)
 {
-   // P-VTEC takes the form /k.aaa.cccc.pp.s.####.yymmddThhnnZB-yymmddThhnnZE/
-   // (NWSI 10-1703)
-   // Look for /k. to key the P-VTEC string
-   static constexpr LazyRE2 rePVtecString = {"^/[OTEX]\\."};
-
-   // H-VTEC takes the form
-   // /nwsli.s.ic.yymmddThhnnZB.yymmddThhnnZC.yymmddThhnnZE.fr/ (NWSI 10-1703)
-   // Look for /nwsli. to key the H-VTEC string
-   static constexpr LazyRE2 reHVtecString = {"^/[A-Z0-9]{5}\\."};
-
-   std::optional<Vtec> vtec = std::nullopt;
-   std::string         line;
-   std::streampos      isBegin = is.tellg();
-
-   util::getline(is, line);
+   std::optional<Vtec> vtec  = std::nullopt;
+   std::size_t         begin = scanner.tell();
+   std::string_view    line  = scanner.GetLine();
 
-   if (RE2::PartialMatch(line, *rePVtecString))
+   if (IsPVtecString(line))
    {
       bool vtecValid;
 
       vtec      = Vtec();
-      vtecValid = vtec->pVtec_.Parse(line);
+      vtecValid = vtec->pVtec_.Parse(std::string {line});
 
-      isBegin = is.tellg();
+      begin = scanner.tell();
+      line  = scanner.GetLine();
 
-      util::getline(is, line);
-
-      if (RE2::PartialMatch(line, *reHVtecString))
+      if (IsHVtecString(line))
       {
-         vtec->hVtec_.swap(line);
+         vtec->hVtec_ = line;
       }
       else
       {
-         // H-VTEC was not found, so reset the istream to the beginning of
-         // the line
-         is.seekg(isBegin, std::ios_base::beg);
+         // H-VTEC was not found, so reset the scanner to the beginning of the
+         // line
+         scanner.seek(begin);
       }
 
       if (!vtecValid)
@@ -667,13 +662,121 @@ std::optional<Vtec> TryParseVtecString(std::istream& is)
    }
    else
    {
-      // P-VTEC was not found, so reset the istream to the original state
-      is.seekg(isBegin, std::ios_base::beg);
+      // P-VTEC was not found, so reset the scanner to the original state
+      scanner.seek(begin);
    }
 
    return vtec;
 }
 
+static bool IsDigit(char c)
+{
+   return c >= '0' && c <= '9';
+}
+
+static bool IsUpper(char c)
+{
+   return c >= 'A' && c <= 'Z';
+}
+
+bool IsDateTimeString(std::string_view line)
+{
+   // Issuance date/time takes one of the following forms:
+   // * <hhmm>_xM_<tz>_day_mon_<dd>_year
+   // * <hhmm>_UTC_day_mon_<dd>_year
+   // Segment Header only:
+   // * <hhmm>_xM_<tz1>_day_mon_<dd>_year_/<hhmm>_xM_<tz2>_day_mon_<dd>_year/
+   // Look for hhmm (xM|UTC) to key the date/time string
+   const std::size_t digits =
+      std::find_if_not(line.cbegin(), line.cend(), IsDigit) - line.cbegin();
+
+   if ((digits != 3 && digits != 4) || line.size() <= digits ||
+       line[digits] != ' ')
+   {
+      return false;
+   }
+
+   const std::string_view zone = line.substr(digits + 1);
+
+   return zone.starts_with("AM") || zone.starts_with("PM") ||
+          zone.starts_with("UTC");
+}
+
+bool IsHVtecString(std::string_view line)
+{
+   // H-VTEC takes the form
+   // /nwsli.s.ic.yymmddThhnnZB.yymmddThhnnZC.yymmddThhnnZE.fr/ (NWSI 10-1703)
+   // Look for /nwsli. to key the H-VTEC string
+   return line.size() >= 7 && line[0] == '/' &&
+          std::all_of(line.cbegin() + 1,
+                      line.cbegin() + 6,
+                      [](char c) { return IsUpper(c) || IsDigit(c); }) &&
+          line[6] == '.';
+}
+
+bool IsPVtecString(std::string_view line)
+{
+   // P-VTEC takes the form /k.aaa.cccc.pp.s.####.yymmddThhnnZB-yymmddThhnnZE/
+   // (NWSI 10-1703)
+   // Look for /k. to key the P-VTEC string
+   return line.size() >= 3 && line[0] == '/' &&
+          std::string_view {"OTEX"}.find(line[1]) != std::string_view::npos &&
+          line[2] == '.';
+}
+
+bool IsUgcExpiration(std::string_view line)
+{
+   // Look for DDHHMM- to end the UGC string
+   return line.size() >= 7 && line.ends_with('-') &&
+          std::all_of(line.cend() - 7, line.cend() - 1, IsDigit);
+}
+
+bool IsUgcString(std::string_view line)
+{
+   // UGC takes the form SSFNNN-NNN>NNN-SSFNNN-DDHHMM- (NWSI 10-1702)
+   // Look for SSF(NNN)?[->] to key the UGC string
+   auto isDelimiter = [](char c) { return c == '-' || c == '>'; };
+
+   if (line.size() < 4 || !IsUpper(line[0]) || !IsUpper(line[1]) ||
+       (line[2] != 'C' && line[2] != 'Z'))
+   {
+      return false;
+   }
+
+   return isDelimiter(line[3]) ||
+          (line.size() >= 7 && IsDigit(line[3]) && IsDigit(line[4]) &&
+           IsDigit(line[5]) && isDelimiter(line[6]));
+}
+
+std::string_view TextScanner::GetLine()
+{
+   const std::size_t begin = position_;
+   const std::size_t end   = text_.find_first_of("\r\n", begin);
+
+   if (end == std::string_view::npos)
+   {
+      position_ = text_.size();
+      return text_.substr(std::min(begin, text_.size()));
+   }
+
+   position_ = end + 1;
+
+   if (text_[end] == '\r')
+   {
+      // Consume repeated carriage returns, and a single line feed
+      while (position_ < text_.size() && text_[position_] == '\r')
+      {
+         ++position_;
+      }
+      if (position_ < text_.size() && text_[position_] == '\n')
+      {
+         ++position_;
+      }
+   }
+
+   return text_.substr(begin, end - begin);
+}
+
 std::shared_ptr<TextProductMessage> TextProductMessage::Create(std::istream& is)
 {
    std::shared_ptr<TextProductMessage> message =
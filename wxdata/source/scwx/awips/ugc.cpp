@@ -1,13 +1,12 @@
 #include <scwx/awips/ugc.hpp>
 #include <scwx/util/logger.hpp>
 
+#include <algorithm>
 #include <map>
 
 #include <boost/assign.hpp>
 #include <boost/bimap.hpp>
 #include <boost/bimap/unordered_set_of.hpp>
-#include <boost/tokenizer.hpp>
-#include <re2/re2.h>
 
 namespace scwx
 {
@@ -34,6 +33,15 @@ static const UgcFormatBimap ugcFormatMap_ =
    (UgcFormat::Zones, 'Z')                          //
    (UgcFormat::Unknown, '?');
 
+static bool          IsAnyFipsId(std::string_view token);
+static bool          IsDigits(std::string_view token);
+static bool          IsProductExpiration(std::string_view token);
+static bool          IsSpecificFipsId(std::string_view token);
+static bool          IsUpper(char c);
+static std::uint16_t ParseFipsId(std::string_view fipsId);
+static std::vector<std::string_view> SplitTokens(std::string_view s,
+                                                 char             delimiter);
+
 class UgcImpl
 {
 public:
@@ -100,38 +108,31 @@ std::string Ugc::product_expiration() const
 }
 
 bool Ugc::Parse(const std::vector<std::string>& ugcString)
+{
+   const std::vector<std::string_view> ugcLines(ugcString.cbegin(),
+                                                ugcString.cend());
+   return Parse(ugcLines);
+}
+
+bool Ugc::Parse(std::span<const std::string_view> ugcString)
 {
    bool dataValid = false;
 
    // UGC takes the form SSFNNN-NNN>NNN-SSFNNN-DDHHMM- (NWSI 10-1702)
-   static constexpr LazyRE2 reStart          = {"[A-Z]{2}[CZ]([0-9]{3}|ALL)"};
-   static constexpr LazyRE2 reAnyFipsId      = {"([0-9]{3}|ALL)"};
-   static constexpr LazyRE2 reSpecificFipsId = {"[0-9]{3}"};
-   static constexpr LazyRE2 reProductExpiration = {"[0-9]{6}"};
-
-   std::stringstream ugcStream;
-   for (auto& line : ugcString)
-   {
-      ugcStream << line;
-   }
 
    // Concatenate UGC lines into a single string
    std::string ugc {};
-   for (const std::string& line : ugcString)
+   for (const std::string_view& line : ugcString)
    {
       ugc += line;
    }
 
-   boost::char_separator<char> sectionDelimiter("-");
-   boost::char_separator<char> rangeDelimiter(">");
-   boost::tokenizer            tokens(ugc, sectionDelimiter);
-
-   std::string currentState {};
+   std::string_view currentState {};
 
-   for (auto& token : tokens)
+   for (std::string_view token : SplitTokens(ugc, '-'))
    {
       // Product Expiration is the final token
-      if (RE2::FullMatch(token, *reProductExpiration))
+      if (IsProductExpiration(token))
       {
          p->productExpiration_ = token;
          dataValid             = true;
@@ -140,20 +141,22 @@ bool Ugc::Parse(const std::vector<std::string>& ugcString)
 
       // Tokenize string again by ">" (note there will always be at least one
       // range token)
-      boost::tokenizer rangeTokens(token, rangeDelimiter);
-      const size_t     numRangeTokens =
-         std::distance(rangeTokens.begin(), rangeTokens.end());
-      bool        tokenValid = true;
-      bool        allFipsIds = false;
-      auto        tokenIt    = rangeTokens.begin();
-      std::string firstToken {tokenIt.current_token()};
-      UgcFormat   currentFormat {p->format_};
-      std::string firstFipsId {};
-      std::string secondFipsId {};
+      const std::vector<std::string_view> rangeTokens =
+         SplitTokens(token, '>');
+      const size_t     numRangeTokens = rangeTokens.size();
+      bool             tokenValid     = true;
+      bool             allFipsIds     = false;
+      std::string_view firstToken {rangeTokens.empty() ? "" : rangeTokens[0]};
+      UgcFormat        currentFormat {p->format_};
+      std::string_view firstFipsId {};
+      std::string_view secondFipsId {};
 
       // Look for the start of the UGC string (may be multiple per UGC string
       // for multiple states, territories, or marine area)
-      if (RE2::FullMatch(firstToken, *reStart))
+      if (firstToken.size() == 6 && IsUpper(firstToken[0]) &&
+          IsUpper(firstToken[1]) &&
+          (firstToken[2] == 'C' || firstToken[2] == 'Z') &&
+          IsAnyFipsId(firstToken.substr(3)))
       {
          currentState  = firstToken.substr(0, 2);
          currentFormat = ugcFormatMap_.right.at(firstToken.at(2));
@@ -166,8 +169,7 @@ bool Ugc::Parse(const std::vector<std::string>& ugcString)
          }
       }
       // Look for additional FIPS IDs in the UGC string
-      else if (!currentState.empty() &&
-               RE2::FullMatch(firstToken, *reAnyFipsId))
+      else if (!currentState.empty() && IsAnyFipsId(firstToken))
       {
          firstFipsId = firstToken;
       }
@@ -186,10 +188,9 @@ bool Ugc::Parse(const std::vector<std::string>& ugcString)
       // Parse the second token in a range (i.e., NNN>XXX)
       if (numRangeTokens == 2)
       {
-         std::string secondToken {(++tokenIt).current_token()};
+         const std::string_view secondToken {rangeTokens[1]};
 
-         if (RE2::FullMatch(secondToken, *reSpecificFipsId) &&
-             secondToken != "000")
+         if (IsSpecificFipsId(secondToken) && secondToken != "000")
          {
             secondFipsId = secondToken;
          }
@@ -208,7 +209,7 @@ bool Ugc::Parse(const std::vector<std::string>& ugcString)
       }
 
       p->format_    = currentFormat;
-      auto& fipsIds = p->fipsIdMap_[currentState];
+      auto& fipsIds = p->fipsIdMap_[std::string {currentState}];
 
       if (allFipsIds)
       {
@@ -217,15 +218,14 @@ bool Ugc::Parse(const std::vector<std::string>& ugcString)
       else
       {
          // Insert the FIPS ID (NNN) from the token
-         fipsIds.push_back(static_cast<uint16_t>(std::stoul(firstFipsId)));
+         fipsIds.push_back(ParseFipsId(firstFipsId));
 
          if (numRangeTokens == 2)
          {
             // Insert the remainder of the FIPS IDs in the range given by the
             // token (NNN>XXX)
             const uint16_t first = fipsIds.back();
-            const uint16_t last =
-               static_cast<uint16_t>(std::stoul(secondFipsId));
+            const uint16_t last  = ParseFipsId(secondFipsId);
 
             for (uint16_t i = first + 1; i <= last; i++)
             {
@@ -245,5 +245,67 @@ bool Ugc::Parse(const std::vector<std::string>& ugcString)
    return dataValid;
 }
 
+bool IsAnyFipsId(std::string_view token)
+{
+   // ([0-9]{3}|ALL)
+   return IsSpecificFipsId(token) || token == "ALL";
+}
+
+bool IsDigits(std::string_view token)
+{
+   return std::all_of(token.cbegin(),
+                      token.cend(),
+                      [](char c) { return c >= '0' && c <= '9'; });
+}
+
+bool IsProductExpiration(std::string_view token)
+{
+   // DDHHMM
+   return token.size() == 6 && IsDigits(token);
+}
+
+bool IsSpecificFipsId(std::string_view token)
+{
+   // NNN
+   return token.size() == 3 && IsDigits(token);
+}
+
+bool IsUpper(char c)
+{
+   return c >= 'A' && c <= 'Z';
+}
+
+std::uint16_t ParseFipsId(std::string_view fipsId)
+{
+   std::uint16_t id = 0;
+   for (char c : fipsId)
+   {
+      id = static_cast<std::uint16_t>(id * 10 + (c - '0'));
+   }
+   return id;
+}
+
+std::vector<std::string_view> SplitTokens(std::string_view s, char delimiter)
+{
+   // Empty tokens are discarded
+   std::vector<std::string_view> tokens {};
+
+   while (!s.empty())
+   {
+      const std::size_t end = s.find(delimiter);
+      if (end != 0)
+      {
+         tokens.push_back(s.substr(0, end));
+      }
+      if (end == std::string_view::npos)
+      {
+         break;
+      }
+      s.remove_prefix(end + 1);
+   }
+
+   return tokens;
+}
+
 } // namespace awips
 } // namespace scwx
@@ -1,10 +1,12 @@
 #include <scwx/awips/wmo_header.hpp>
+#include <scwx/util/clock.hpp>
 #include <scwx/util/logger.hpp>
 #include <scwx/util/streams.hpp>
 
+#include <algorithm>
 #include <istream>
-#include <sstream>
 #include <string>
+#include <vector>
 
 #ifdef _WIN32
 #   include <WinSock2.h>
@@ -104,6 +106,54 @@ std::string WmoHeader::date_time() const
    return p->dateTime_;
 }
 
+std::chrono::system_clock::time_point WmoHeader::GetDateTime(
+   std::optional<std::chrono::system_clock::time_point> endTimeHint) const
+{
+   using namespace std::chrono;
+
+   const std::string& dateTime = p->dateTime_;
+
+   // Date/time: ddhhmm
+   if (dateTime.size() != 6 ||
+       !std::all_of(dateTime.cbegin(),
+                    dateTime.cend(),
+                    [](char c) { return c >= '0' && c <= '9'; }))
+   {
+      return {};
+   }
+
+   auto value = [&dateTime](std::size_t pos)
+   { return (dateTime[pos] - '0') * 10 + (dateTime[pos + 1] - '0'); };
+
+   const day     dd {static_cast<unsigned int>(value(0))};
+   const hours   hh {value(2)};
+   const minutes mm {value(4)};
+
+   if (hh >= 24h || mm >= 60min)
+   {
+      return {};
+   }
+
+   const system_clock::time_point endTime =
+      endTimeHint.value_or(util::clock::Now());
+   const year_month_day endDate {floor<days>(endTime)};
+
+   // A day of month later than the end time was issued in a prior month
+   year_month yearMonth = endDate.year() / endDate.month();
+   if (dd > endDate.day())
+   {
+      yearMonth -= months {1};
+   }
+
+   const year_month_day issuanceDate = yearMonth / dd;
+   if (!issuanceDate.ok())
+   {
+      return {};
+   }
+
+   return sys_days {issuanceDate} + hh + mm;
+}
+
 std::string WmoHeader::bbb_indicator() const
 {
    return p->bbbIndicator_;
@@ -121,8 +171,6 @@ std::string WmoHeader::product_designator() const
 
 bool WmoHeader::Parse(std::istream& is)
 {
-   bool headerValid = true;
-
    std::string sohLine;
    std::string sequenceLine;
    std::string wmoLine;
@@ -140,22 +188,29 @@ bool WmoHeader::Parse(std::istream& is)
    if (is.eof())
    {
       logger_->trace("Reached end of file");
-      headerValid = false;
+      return false;
    }
-   else
+
+   return Parse(sequenceLine, wmoLine, awipsLine);
+}
+
+bool WmoHeader::Parse(std::string_view sequenceLine,
+                      std::string_view wmoLine,
+                      std::string_view awipsLine)
+{
+   bool headerValid = true;
+
+   // Remove delimiters from the end of the line
+   while (sequenceLine.ends_with(' '))
    {
-      // Remove delimiters from the end of the line
-      while (sequenceLine.ends_with(' '))
-      {
-         sequenceLine.erase(sequenceLine.length() - 1);
-      }
+      sequenceLine.remove_suffix(1);
    }
 
    // Transmission Header:
    // [SOH]
    // nnn
 
-   if (headerValid && !sequenceLine.empty())
+   if (!sequenceLine.empty())
    {
       p->sequenceNumber_ = sequenceLine;
    }
@@ -163,59 +218,59 @@ bool WmoHeader::Parse(std::istream& is)
    // WMO Abbreviated Heading Line:
    // T1T2A1A2ii CCCC YYGGgg (BBB)
 
-   if (headerValid)
+   std::vector<std::string_view> wmoTokenList;
+
+   static constexpr std::string_view kWhitespace {" \t\n\v\f\r"};
+   for (std::size_t begin = wmoLine.find_first_not_of(kWhitespace);
+        begin != std::string_view::npos;
+        begin = wmoLine.find_first_not_of(kWhitespace, begin))
    {
-      std::string              token;
-      std::istringstream       wmoTokens(wmoLine);
-      std::vector<std::string> wmoTokenList;
+      const std::size_t end = wmoLine.find_first_of(kWhitespace, begin);
+      wmoTokenList.push_back(wmoLine.substr(begin, end - begin));
+      begin = end;
+   }
 
-      while (wmoTokens >> token)
-      {
-         wmoTokenList.push_back(token);
-      }
+   if (wmoTokenList.size() < 3 || wmoTokenList.size() > 4)
+   {
+      logger_->warn("Invalid number of WMO tokens");
+      headerValid = false;
+   }
+   else if (wmoTokenList[0].size() != 6)
+   {
+      logger_->warn("WMO identifier malformed");
+      headerValid = false;
+   }
+   else if (wmoTokenList[1].size() != 4)
+   {
+      logger_->warn("ICAO malformed");
+      headerValid = false;
+   }
+   else if (wmoTokenList[2].size() != 6)
+   {
+      logger_->warn("Date/time malformed");
+      headerValid = false;
+   }
+   else if (wmoTokenList.size() == 4 && wmoTokenList[3].size() != 3)
+   {
+      // BBB indicator is optional
+      logger_->warn("BBB indicator malformed");
+      headerValid = false;
+   }
+   else
+   {
+      p->dataType_             = wmoTokenList[0].substr(0, 2);
+      p->geographicDesignator_ = wmoTokenList[0].substr(2, 2);
+      p->bulletinId_           = wmoTokenList[0].substr(4, 2);
+      p->icao_                 = wmoTokenList[1];
+      p->dateTime_             = wmoTokenList[2];
 
-      if (wmoTokenList.size() < 3 || wmoTokenList.size() > 4)
-      {
-         logger_->warn("Invalid number of WMO tokens");
-         headerValid = false;
-      }
-      else if (wmoTokenList[0].size() != 6)
-      {
-         logger_->warn("WMO identifier malformed");
-         headerValid = false;
-      }
-      else if (wmoTokenList[1].size() != 4)
-      {
-         logger_->warn("ICAO malformed");
-         headerValid = false;
-      }
-      else if (wmoTokenList[2].size() != 6)
+      if (wmoTokenList.size() == 4)
       {
-         logger_->warn("Date/time malformed");
-         headerValid = false;
-      }
-      else if (wmoTokenList.size() == 4 && wmoTokenList[3].size() != 3)
-      {
-         // BBB indicator is optional
-         logger_->warn("BBB indicator malformed");
-         headerValid = false;
+         p->bbbIndicator_ = wmoTokenList[3];
       }
       else
       {
-         p->dataType_             = wmoTokenList[0].substr(0, 2);
-         p->geographicDesignator_ = wmoTokenList[0].substr(2, 2);
-         p->bulletinId_           = wmoTokenList[0].substr(4, 2);
-         p->icao_                 = wmoTokenList[1];
-         p->dateTime_             = wmoTokenList[2];
-
-         if (wmoTokenList.size() == 4)
-         {
-            p->bbbIndicator_ = wmoTokenList[3];
-         }
-         else
-         {
-            p->bbbIndicator_ = "";
-         }
+         p->bbbIndicator_ = "";
       }
    }
 
@@ -20,6 +20,9 @@ static const std::unordered_map<Level2Product, std::string> level2Name_ {
    {Level2Product::DifferentialPhase, "PHI"},
    {Level2Product::CorrelationCoefficient, "RHO"},
    {Level2Product::ClutterFilterPowerRemoved, "CFP"},
+   {Level2Product::CompositeReflectivity, "CR"},
+   {Level2Product::EchoTops, "ET"},
+   {Level2Product::VerticallyIntegratedLiquid, "VIL"},
    {Level2Product::Unknown, "?"}};
 
 static const std::unordered_map<Level2Product, std::string> level2Description_ {
@@ -30,6 +33,9 @@ static const std::unordered_map<Level2Product, std::string> level2Description_ {
    {Level2Product::DifferentialPhase, "Differential Phase"},
    {Level2Product::CorrelationCoefficient, "Correlation Coefficient"},
    {Level2Product::ClutterFilterPowerRemoved, "Clutter Filter Power Removed"},
+   {Level2Product::CompositeReflectivity, "Composite Reflectivity"},
+   {Level2Product::EchoTops, "Echo Tops"},
+   {Level2Product::VerticallyIntegratedLiquid, "Vertically Integrated Liquid"},
    {Level2Product::Unknown, "?"}};
 
 static const std::unordered_map<Level2Product, std::string> level2Palette_ {
@@ -40,6 +46,9 @@ static const std::unordered_map<Level2Product, std::string> level2Palette_ {
    {Level2Product::DifferentialPhase, "PHI2"},
    {Level2Product::CorrelationCoefficient, "CC"},
    {Level2Product::ClutterFilterPowerRemoved, "???"},
+   {Level2Product::CompositeReflectivity, "BR"},
+   {Level2Product::EchoTops, "ET"},
+   {Level2Product::VerticallyIntegratedLiquid, "VIL"},
    {Level2Product::Unknown, "???"}};
 
 static const std::unordered_map<int, std::string> level3ProductCodeMap_ {
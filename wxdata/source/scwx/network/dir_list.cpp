@@ -1,14 +1,18 @@
 #define LIBXML_HTML_ENABLED
 
 #include <scwx/network/dir_list.hpp>
+#include <scwx/network/transport.hpp>
 #include <scwx/util/logger.hpp>
 
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
 #if defined(_MSC_VER)
 #   pragma warning(push, 0)
 #endif
 
 #include <boost/algorithm/string/trim.hpp>
-#include <cpr/cpr.h>
 #include <libxml/HTMLparser.h>
 
 #if (__cpp_lib_chrono < 201907L)
@@ -27,10 +31,6 @@ namespace network
 static const std::string logPrefix_ = "scwx::network::dir_list";
 static const auto        logger_    = util::Logger::Create(logPrefix_);
 
-static const cpr::SslOptions  kSslOptions_ = cpr::Ssl(cpr::ssl::TLSv1_2 {});
-static const cpr::HttpVersion kHttpVersion_ {
-   cpr::HttpVersionCode::VERSION_2_0_TLS};
-
 class DirListSAXHandler
 {
 public:
@@ -41,6 +41,7 @@ public:
    StartElement(void* userData, const xmlChar* name, const xmlChar** attrs);
    static void EndElement(void* userData, const xmlChar* name);
    static void Characters(void* userData, const xmlChar* ch, int len);
+   static void ProcessCharacters(void* userData);
    static void Warning(void* userData, const char* msg, ...);
    static void Error(void* userData, const char* msg, ...);
    static void Critical(void* userData, const char* msg, ...);
@@ -60,9 +61,30 @@ struct DirListSAXData
    size_t errorCount_ {0u};
    size_t criticalCount_ {0u};
 
+   // Character data may be split across chunks, and is processed at the next
+   // element boundary
+   std::string characters_ {};
+
    std::vector<DirListRecord> records_;
 };
 
+struct DirListCacheEntry
+{
+   std::string                url_ {};
+   std::string                eTag_ {};
+   std::string                lastModified_ {};
+   std::vector<DirListRecord> records_ {};
+};
+
+typedef std::list<DirListCacheEntry> DirListCache;
+
+static constexpr std::size_t kMaxCacheEntries_ = 32u;
+
+// Cached listings are ordered from most to least recently used
+static std::mutex   cacheMutex_ {};
+static DirListCache cache_ {};
+static std::unordered_map<std::string, DirListCache::iterator> cacheIndex_ {};
+
 // Unspecified fields are initialized to zero, ignore warning
 #if defined(__GNUC__)
 #   pragma GCC diagnostic push
@@ -81,46 +103,177 @@ static htmlSAXHandler saxHandler_ //
 #   pragma GCC diagnostic pop
 #endif
 
-std::vector<DirListRecord> DirList(const std::string& baseUrl)
+static DirListCache::iterator FindCacheEntry(const std::string& baseUrl);
+static void                   StoreCacheEntry(DirListCacheEntry&& entry);
+static void                   RemoveCacheEntry(const std::string& baseUrl);
+static HttpResponse           GetListing(const std::string&   baseUrl,
+                                         const ::cpr::Header& header,
+                                         DirListSAXData&      saxData);
+
+static std::string GetHeaderValue(const ::cpr::Header& header,
+                                  const std::string&   key)
 {
-   using namespace std::chrono;
+   auto it = header.find(key);
+   return (it != header.cend()) ? it->second : std::string {};
+}
 
+std::vector<DirListRecord> DirList(const std::string& baseUrl)
+{
    logger_->trace("DirList: {}", baseUrl);
 
-   cpr::Response response =
-      cpr::Get(cpr::Url {baseUrl}, kSslOptions_, kHttpVersion_);
+   // Revalidate a previous listing of the same URL
+   ::cpr::Header header {};
+   {
+      std::unique_lock lock {cacheMutex_};
+
+      auto it = FindCacheEntry(baseUrl);
+      if (it != cache_.end())
+      {
+         if (!it->eTag_.empty())
+         {
+            header.emplace("If-None-Match", it->eTag_);
+         }
+         if (!it->lastModified_.empty())
+         {
+            header.emplace("If-Modified-Since", it->lastModified_);
+         }
+      }
+   }
+
    DirListSAXData saxData {};
+   HttpResponse   response = GetListing(baseUrl, header, saxData);
+
+   std::unique_lock lock {cacheMutex_};
+
+   if (response.statusCode_ == 304)
+   {
+      auto it = FindCacheEntry(baseUrl);
+      if (it != cache_.end())
+      {
+         logger_->trace("Not modified: {}", baseUrl);
+         return it->records_;
+      }
+
+      // The cached listing was evicted or replaced after the request was
+      // made, and must be transferred again
+      logger_->debug("Listing not cached, refetching: {}", baseUrl);
+
+      lock.unlock();
+      saxData  = {};
+      response = GetListing(baseUrl, {}, saxData);
+      lock.lock();
+   }
 
-   if (response.status_code != cpr::status::HTTP_OK)
+   if (response.statusCode_ != 200)
    {
       logger_->warn("Bad response from {}: {} ({})",
                     baseUrl,
-                    response.error.message,
-                    response.status_code);
+                    response.error_,
+                    response.statusCode_);
+      return {};
+   }
+
+   DirListCacheEntry entry {baseUrl,
+                            GetHeaderValue(response.header_, "ETag"),
+                            GetHeaderValue(response.header_, "Last-Modified"),
+                            saxData.records_};
+
+   if (entry.eTag_.empty() && entry.lastModified_.empty())
+   {
+      // The listing cannot be revalidated
+      RemoveCacheEntry(baseUrl);
    }
    else
    {
-      htmlParserCtxtPtr ctxt = htmlNewSAXParserCtxt(&saxHandler_, &saxData);
-      htmlDocPtr        doc  = nullptr;
+      StoreCacheEntry(std::move(entry));
+   }
 
-      if (ctxt != nullptr)
-      {
-         doc = htmlCtxtReadDoc(
-            ctxt,
-            reinterpret_cast<const xmlChar*>(response.text.c_str()),
-            baseUrl.c_str(),
-            nullptr,
-            HTML_PARSE_NONET);
-         htmlFreeParserCtxt(ctxt);
-      }
+   return std::move(saxData.records_);
+}
 
-      if (doc != nullptr)
+static HttpResponse GetListing(const std::string&   baseUrl,
+                               const ::cpr::Header& header,
+                               DirListSAXData&      saxData)
+{
+   // Parse the listing as it is transferred
+   htmlParserCtxtPtr ctxt = htmlCreatePushParserCtxt(&saxHandler_,
+                                                     &saxData,
+                                                     nullptr,
+                                                     0,
+                                                     baseUrl.c_str(),
+                                                     XML_CHAR_ENCODING_NONE);
+
+   if (ctxt == nullptr)
+   {
+      logger_->error("Could not create parser context: {}", baseUrl);
+      return {};
+   }
+
+   htmlCtxtUseOptions(ctxt, HTML_PARSE_NONET);
+
+   HttpResponse response = GetTransport()->GetStream(
+      baseUrl,
+      [ctxt](std::string_view data)
       {
-         xmlFreeDoc(doc);
-      }
+         htmlParseChunk(ctxt, data.data(), static_cast<int>(data.size()), 0);
+         return true;
+      },
+      header);
+
+   htmlParseChunk(ctxt, nullptr, 0, 1);
+   DirListSAXHandler::ProcessCharacters(&saxData);
+
+   if (ctxt->myDoc != nullptr)
+   {
+      xmlFreeDoc(ctxt->myDoc);
+      ctxt->myDoc = nullptr;
+   }
+   htmlFreeParserCtxt(ctxt);
+
+   return response;
+}
+
+static DirListCache::iterator FindCacheEntry(const std::string& baseUrl)
+{
+   auto it = cacheIndex_.find(baseUrl);
+   if (it == cacheIndex_.cend())
+   {
+      return cache_.end();
+   }
+
+   // Mark the entry as most recently used
+   cache_.splice(cache_.begin(), cache_, it->second);
+   return it->second;
+}
+
+static void StoreCacheEntry(DirListCacheEntry&& entry)
+{
+   auto it = FindCacheEntry(entry.url_);
+   if (it != cache_.end())
+   {
+      *it = std::move(entry);
+      return;
    }
 
-   return saxData.records_;
+   // Evict the least recently used entry
+   if (cache_.size() >= kMaxCacheEntries_)
+   {
+      cacheIndex_.erase(cache_.back().url_);
+      cache_.pop_back();
+   }
+
+   cache_.push_front(std::move(entry));
+   cacheIndex_.emplace(cache_.front().url_, cache_.begin());
+}
+
+static void RemoveCacheEntry(const std::string& baseUrl)
+{
+   auto it = cacheIndex_.find(baseUrl);
+   if (it != cacheIndex_.cend())
+   {
+      cache_.erase(it->second);
+      cacheIndex_.erase(it);
+   }
 }
 
 void DirListSAXHandler::StartElement(void*           userData,
@@ -130,6 +283,8 @@ void DirListSAXHandler::StartElement(void*           userData,
    logger_->trace("SAX: Start Element: {}",
                   reinterpret_cast<const char*>(name));
 
+   ProcessCharacters(userData);
+
    DirListSAXData* data = reinterpret_cast<DirListSAXData*>(userData);
 
    if (strcmp(reinterpret_cast<const char*>(name), "a") == 0)
@@ -179,6 +334,8 @@ void DirListSAXHandler::EndElement(void* userData, const xmlChar* name)
 {
    logger_->trace("SAX: End Element: {}", reinterpret_cast<const char*>(name));
 
+   ProcessCharacters(userData);
+
    DirListSAXData* data = reinterpret_cast<DirListSAXData*>(userData);
 
    if (data->state_ == DirListSAXData::State::FoundLink &&
@@ -191,11 +348,24 @@ void DirListSAXHandler::EndElement(void* userData, const xmlChar* name)
 
 void DirListSAXHandler::Characters(void* userData, const xmlChar* ch, int len)
 {
-   std::string characters(reinterpret_cast<const char*>(ch), len);
-   logger_->trace("SAX: Characters: {}", characters);
+   DirListSAXData* data = reinterpret_cast<DirListSAXData*>(userData);
+   data->characters_.append(reinterpret_cast<const char*>(ch), len);
+}
 
+void DirListSAXHandler::ProcessCharacters(void* userData)
+{
    DirListSAXData* data = reinterpret_cast<DirListSAXData*>(userData);
 
+   if (data->characters_.empty())
+   {
+      return;
+   }
+
+   const std::string characters {std::move(data->characters_)};
+   data->characters_.clear();
+
+   logger_->trace("SAX: Characters: {}", characters);
+
    if (data->state_ == DirListSAXData::State::UpdateLinkTimestamp)
    {
       using namespace std::chrono;
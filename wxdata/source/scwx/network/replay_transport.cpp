@@ -0,0 +1,445 @@
+#include <scwx/network/replay_transport.hpp>
+#include <scwx/util/clock.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <set>
+#include <sstream>
+
+#include <fmt/chrono.h>
+#include <fmt/format.h>
+
+#if (__cpp_lib_chrono < 201907L)
+#   include <date/date.h>
+#endif
+
+namespace scwx
+{
+namespace network
+{
+
+static const std::string logPrefix_ = "scwx::network::replay_transport";
+static const auto        logger_    = util::Logger::Create(logPrefix_);
+
+static const std::string kObjectStoreDirectory_ = "s3";
+static const std::string kHttpDirectory_        = "http";
+
+// HTTP date format (RFC 9110), in GMT
+static const std::string kHttpDateFormat_ = "%a, %d %b %Y %H:%M:%S GMT";
+
+static bool IsRelativePathSafe(const std::filesystem::path& path);
+
+class ReplayObjectStore : public ObjectStore
+{
+public:
+   explicit ReplayObjectStore(const std::filesystem::path& bucketPath) :
+       bucketPath_ {bucketPath}
+   {
+   }
+   ~ReplayObjectStore() = default;
+
+   std::optional<ObjectListing>
+   ListObjects(const std::string& prefix,
+               const std::string& delimiter) override;
+   std::optional<ObjectData> GetObject(const std::string& key) override;
+
+private:
+   std::filesystem::path bucketPath_;
+};
+
+class ReplayTransport::Impl
+{
+public:
+   explicit Impl(const std::filesystem::path& root) : root_ {root} {}
+   ~Impl() = default;
+
+   HttpResponse ListDirectory(const std::filesystem::path& directory,
+                              const std::string&           path);
+
+   static void
+   SetValidators(HttpResponse&                         response,
+                 std::chrono::system_clock::time_point lastModified);
+   static void EvaluateConditions(HttpResponse&        response,
+                                  const ::cpr::Header& header);
+
+   std::filesystem::path root_;
+};
+
+ReplayTransport::ReplayTransport(const std::filesystem::path& root) :
+    p(std::make_unique<Impl>(root))
+{
+   logger_->info("Replaying network data from: {}", root.string());
+}
+ReplayTransport::~ReplayTransport() = default;
+
+std::shared_ptr<ObjectStore>
+ReplayTransport::OpenObjectStore(const std::string& bucketName,
+                                 const std::string& /* region */)
+{
+   return std::make_shared<ReplayObjectStore>(p->root_ /
+                                              kObjectStoreDirectory_ /
+                                              bucketName);
+}
+
+HttpResponse ReplayTransport::Get(const std::string&   url,
+                                  const ::cpr::Header& header,
+                                  const ::cpr::Parameters& /* parameters */)
+{
+   logger_->trace("Get: {}", url);
+
+   // Remove the scheme, query and fragment
+   std::string location {url};
+
+   if (std::size_t scheme = location.find("://"); scheme != std::string::npos)
+   {
+      location.erase(0, scheme + 3);
+   }
+   if (std::size_t query = location.find_first_of("?#");
+       query != std::string::npos)
+   {
+      location.erase(query);
+   }
+
+   // Split the host and path
+   const std::size_t separator = location.find('/');
+   const std::string host      = location.substr(0, separator);
+   const std::string path =
+      (separator == std::string::npos) ? "" : location.substr(separator + 1);
+
+   HttpResponse response {};
+
+   if (host.empty() || !IsRelativePathSafe(host) || !IsRelativePathSafe(path))
+   {
+      response.statusCode_ = 400;
+      response.error_      = "HTTP/1.1 400 Bad Request";
+      return response;
+   }
+
+   const std::filesystem::path filePath =
+      p->root_ / kHttpDirectory_ / host / path;
+
+   std::error_code ec {};
+
+   if (std::filesystem::is_directory(filePath, ec))
+   {
+      response = p->ListDirectory(filePath, path);
+      Impl::EvaluateConditions(response, header);
+      return response;
+   }
+
+   const auto lastModified = GetLastModified(filePath);
+
+   if (std::filesystem::is_regular_file(filePath, ec) &&
+       lastModified <= util::clock::Now())
+   {
+      std::ifstream      file {filePath, std::ios_base::binary};
+      std::ostringstream text {};
+      text << file.rdbuf();
+
+      if (file.good() || file.eof())
+      {
+         response.statusCode_ = 200;
+         response.text_       = text.str();
+         Impl::SetValidators(response, lastModified);
+         Impl::EvaluateConditions(response, header);
+         return response;
+      }
+   }
+
+   response.statusCode_ = 404;
+   response.error_      = "HTTP/1.1 404 Not Found";
+   return response;
+}
+
+HttpResponse
+ReplayTransport::Impl::ListDirectory(const std::filesystem::path& directory,
+                                     const std::string&           path)
+{
+   struct Entry
+   {
+      std::string                           name_;
+      bool                                  isDirectory_;
+      std::chrono::system_clock::time_point lastModified_;
+      std::uintmax_t                        size_;
+   };
+
+   const auto now = util::clock::Now();
+
+   std::vector<Entry> entries {};
+   std::error_code    ec {};
+
+   // The listing is modified when its latest entry is modified
+   std::chrono::system_clock::time_point listingModified {};
+
+   for (auto it = std::filesystem::directory_iterator {directory, ec};
+        it != std::filesystem::directory_iterator {};
+        it.increment(ec))
+   {
+      const bool isDirectory = it->is_directory(ec);
+      const auto lastModified =
+         std::min(ReplayTransport::GetLastModified(it->path()), now);
+
+      if (isDirectory)
+      {
+         entries.push_back(
+            {it->path().filename().string(), true, lastModified, 0u});
+      }
+      else if (it->is_regular_file(ec) &&
+               ReplayTransport::GetLastModified(it->path()) <= now)
+      {
+         entries.push_back({it->path().filename().string(),
+                            false,
+                            lastModified,
+                            it->file_size(ec)});
+      }
+      else
+      {
+         continue;
+      }
+
+      listingModified = std::max(listingModified, lastModified);
+   }
+
+   std::sort(entries.begin(),
+             entries.end(),
+             [](const Entry& a, const Entry& b) { return a.name_ < b.name_; });
+
+   // Apache-style directory listing
+   std::string text = fmt::format("<html><head><title>Index of /{0}</title>"
+                                  "</head><body><h1>Index of /{0}</h1><table>\n"
+                                  "<tr><th>Name</th><th>Last modified</th>"
+                                  "<th>Size</th></tr>\n",
+                                  path);
+
+   for (const Entry& entry : entries)
+   {
+      const std::string href =
+         entry.isDirectory_ ? entry.name_ + "/" : entry.name_;
+      const std::string size =
+         entry.isDirectory_ ? "-" : std::to_string(entry.size_);
+
+      text += fmt::format(
+         "<tr><td><a href=\"{0}\">{0}</a></td>"
+         "<td align=\"right\">{1:%Y-%m-%d %H:%M}  </td>"
+         "<td align=\"right\">{2}</td></tr>\n",
+         href,
+         fmt::gmtime(std::chrono::system_clock::to_time_t(entry.lastModified_)),
+         size);
+   }
+
+   text += "</table></body></html>\n";
+
+   HttpResponse response {};
+   response.statusCode_ = 200;
+   response.text_       = std::move(text);
+   SetValidators(response, listingModified);
+   return response;
+}
+
+void ReplayTransport::Impl::SetValidators(
+   HttpResponse& response, std::chrono::system_clock::time_point lastModified)
+{
+   // Entity tag derived from the response body
+   response.header_.insert_or_assign(
+      "ETag",
+      fmt::format("\"{:016x}\"", std::hash<std::string> {}(response.text_)));
+
+   if (lastModified != std::chrono::system_clock::time_point {})
+   {
+      response.header_.insert_or_assign(
+         "Last-Modified",
+         fmt::format(
+            "{:%a, %d %b %Y %H:%M:%S} GMT",
+            fmt::gmtime(std::chrono::system_clock::to_time_t(lastModified))));
+   }
+}
+
+void ReplayTransport::Impl::EvaluateConditions(HttpResponse&        response,
+                                               const ::cpr::Header& header)
+{
+   using namespace std::chrono;
+
+#if (__cpp_lib_chrono < 201907L)
+   using namespace date;
+#endif
+
+   if (response.statusCode_ != 200)
+   {
+      return;
+   }
+
+   bool notModified = false;
+
+   // If-None-Match takes precedence over If-Modified-Since
+   if (auto ifNoneMatch = header.find("If-None-Match");
+       ifNoneMatch != header.cend())
+   {
+      auto eTag   = response.header_.find("ETag");
+      notModified = (ifNoneMatch->second == "*" ||
+                     (eTag != response.header_.cend() &&
+                      ifNoneMatch->second.find(eTag->second) !=
+                         std::string::npos));
+   }
+   else if (auto ifModifiedSince = header.find("If-Modified-Since");
+            ifModifiedSince != header.cend())
+   {
+      auto lastModified = response.header_.find("Last-Modified");
+      if (lastModified != response.header_.cend())
+      {
+         std::istringstream ssSince {ifModifiedSince->second};
+         std::istringstream ssModified {lastModified->second};
+         sys_seconds        since {};
+         sys_seconds        modified {};
+
+         ssSince >> parse(kHttpDateFormat_, since);
+         ssModified >> parse(kHttpDateFormat_, modified);
+
+         notModified =
+            !ssSince.fail() && !ssModified.fail() && modified <= since;
+      }
+   }
+
+   if (notModified)
+   {
+      response.statusCode_ = 304;
+      response.text_.clear();
+   }
+}
+
+std::chrono::system_clock::time_point
+ReplayTransport::GetLastModified(const std::filesystem::path& path)
+{
+   std::error_code ec {};
+   auto            fileTime = std::filesystem::last_write_time(path, ec);
+
+   if (ec)
+   {
+      return {};
+   }
+
+#if (__cpp_lib_chrono >= 201907L)
+   return std::chrono::time_point_cast<std::chrono::system_clock::duration>(
+      std::chrono::clock_cast<std::chrono::system_clock>(fileTime));
+#else
+   return std::chrono::time_point_cast<std::chrono::system_clock::duration>(
+      std::chrono::file_clock::to_sys(fileTime));
+#endif
+}
+
+std::optional<ObjectListing>
+ReplayObjectStore::ListObjects(const std::string& prefix,
+                               const std::string& delimiter)
+{
+   logger_->trace("ListObjects: {}", prefix);
+
+   ObjectListing listing {};
+
+   // Key separators map to directories. Begin with the deepest directory
+   // containing all keys with the prefix.
+   const std::size_t separator = prefix.rfind('/');
+   const std::string directoryKey =
+      (separator == std::string::npos) ? "" : prefix.substr(0, separator + 1);
+
+   if (!IsRelativePathSafe(directoryKey))
+   {
+      return listing;
+   }
+
+   const auto      now = util::clock::Now();
+   std::error_code ec {};
+
+   std::set<std::string> commonPrefixes {};
+
+   for (auto it = std::filesystem::recursive_directory_iterator {
+           bucketPath_ / directoryKey, ec};
+        it != std::filesystem::recursive_directory_iterator {};
+        it.increment(ec))
+   {
+      std::string key =
+         it->path().lexically_relative(bucketPath_).generic_string();
+
+      if (it->is_directory(ec))
+      {
+         // Skip directories which cannot contain keys with the prefix
+         key += '/';
+         if (!key.starts_with(prefix) && !prefix.starts_with(key))
+         {
+            it.disable_recursion_pending();
+         }
+         continue;
+      }
+
+      if (!it->is_regular_file(ec) || !key.starts_with(prefix))
+      {
+         continue;
+      }
+
+      const auto lastModified = ReplayTransport::GetLastModified(it->path());
+      if (lastModified > now)
+      {
+         // The object has not yet been written
+         continue;
+      }
+
+      if (!delimiter.empty())
+      {
+         std::size_t position = key.find(delimiter, prefix.size());
+         if (position != std::string::npos)
+         {
+            commonPrefixes.insert(key.substr(0, position + delimiter.size()));
+            continue;
+         }
+      }
+
+      listing.objects_.push_back(
+         {key, lastModified, static_cast<std::size_t>(it->file_size(ec))});
+   }
+
+   // Objects are listed in key order
+   std::sort(listing.objects_.begin(),
+             listing.objects_.end(),
+             [](const ObjectRecord& a, const ObjectRecord& b)
+             { return a.key_ < b.key_; });
+
+   listing.commonPrefixes_.assign(commonPrefixes.cbegin(),
+                                  commonPrefixes.cend());
+
+   return listing;
+}
+
+std::optional<ObjectData> ReplayObjectStore::GetObject(const std::string& key)
+{
+   logger_->trace("GetObject: {}", key);
+
+   const std::filesystem::path path = bucketPath_ / key;
+   std::error_code             ec {};
+
+   if (!IsRelativePathSafe(key) ||
+       !std::filesystem::is_regular_file(path, ec) ||
+       ReplayTransport::GetLastModified(path) > util::clock::Now())
+   {
+      logger_->warn("Could not get object: {}", key);
+      return std::nullopt;
+   }
+
+   ObjectData data {};
+   data.size_ = static_cast<std::size_t>(std::filesystem::file_size(path, ec));
+   data.body_ = std::make_shared<std::ifstream>(path, std::ios_base::binary);
+
+   return data;
+}
+
+static bool IsRelativePathSafe(const std::filesystem::path& path)
+{
+   // Recorded data must not be read from outside of the replay directory
+   return !path.has_root_path() &&
+          std::none_of(path.begin(),
+                       path.end(),
+                       [](const std::filesystem::path& component)
+                       { return component == ".."; });
+}
+
+} // namespace network
+} // namespace scwx
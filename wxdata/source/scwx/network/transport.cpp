@@ -0,0 +1,550 @@
+#define _SILENCE_STDEXT_ARR_ITERS_DEPRECATION_WARNING
+
+#include <scwx/network/transport.hpp>
+#include <scwx/util/environment.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <mutex>
+#include <streambuf>
+
+#include <fmt/format.h>
+
+#if defined(_MSC_VER)
+#   pragma warning(push, 0)
+#endif
+
+#include <aws/core/auth/AWSCredentials.h>
+#include <aws/core/client/DefaultRetryStrategy.h>
+#include <aws/core/http/HttpResponse.h>
+#include <aws/s3/S3Client.h>
+#include <aws/s3/model/GetObjectRequest.h>
+#include <aws/s3/model/ListObjectsV2Request.h>
+#include <cpr/cpr.h>
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+namespace scwx
+{
+namespace network
+{
+
+static const std::string logPrefix_ = "scwx::network::transport";
+static const auto        logger_    = util::Logger::Create(logPrefix_);
+
+static const char* kAllocationTag_ = "scwx::network::transport";
+
+static constexpr std::size_t kObjectChunkSize_ = 64u * 1024u;
+
+static const cpr::SslOptions  kSslOptions_ = cpr::Ssl(cpr::ssl::TLSv1_2 {});
+static const cpr::HttpVersion kHttpVersion_ {
+   cpr::HttpVersionCode::VERSION_2_0_TLS};
+
+static std::shared_ptr<Transport> transport_ {nullptr};
+static std::mutex                 transportMutex_ {};
+
+class AwsObjectStore : public ObjectStore
+{
+public:
+   explicit AwsObjectStore(const std::string& bucketName,
+                           const std::string& region) :
+       bucketName_ {bucketName}
+   {
+      // Disable HTTP request for region
+      util::SetEnvironment("AWS_EC2_METADATA_DISABLED", "true");
+
+      // Use anonymous credentials
+      Aws::Auth::AWSCredentials credentials {};
+
+      Aws::Client::ClientConfiguration config;
+      config.region           = region;
+      config.connectTimeoutMs = 10000;
+
+      client_ = std::make_shared<Aws::S3::S3Client>(
+         credentials,
+         Aws::MakeShared<Aws::S3::S3EndpointProvider>(
+            Aws::S3::S3Client::GetAllocationTag()),
+         config);
+
+      // A retried request writes the body to the response stream again from
+      // the beginning, which cannot be undone once passed to a write
+      // function. Streamed requests are not retried by the client, and are
+      // instead resumed by the caller from the last byte received.
+      config.retryStrategy =
+         Aws::MakeShared<Aws::Client::DefaultRetryStrategy>(kAllocationTag_,
+                                                            0);
+
+      streamClient_ = std::make_shared<Aws::S3::S3Client>(
+         credentials,
+         Aws::MakeShared<Aws::S3::S3EndpointProvider>(
+            Aws::S3::S3Client::GetAllocationTag()),
+         config);
+   }
+   ~AwsObjectStore() = default;
+
+   std::optional<ObjectListing>
+   ListObjects(const std::string& prefix,
+               const std::string& delimiter) override;
+   std::optional<ObjectData> GetObject(const std::string& key) override;
+   bool GetObjectStream(const std::string&   key,
+                        const WriteFunction& write,
+                        std::size_t          offset,
+                        std::size_t          length) override;
+
+private:
+   std::string                        bucketName_;
+   std::shared_ptr<Aws::S3::S3Client> client_ {nullptr};
+   std::shared_ptr<Aws::S3::S3Client> streamClient_ {nullptr};
+};
+
+/**
+ * Output stream buffer passing each write to a write function. The response
+ * body is held until the response is known to be successful, and the body of
+ * an unsuccessful response is discarded.
+ */
+class WriteFunctionBuf : public std::streambuf
+{
+public:
+   explicit WriteFunctionBuf(const WriteFunction& write) : write_ {write} {}
+   ~WriteFunctionBuf() = default;
+
+   std::size_t bytes_written() const { return bytesWritten_; }
+
+   /**
+    * Sets whether the response was successful. Any body held before the
+    * status was known is written if successful, and discarded otherwise.
+    */
+   bool SetSuccess(bool success)
+   {
+      status_ = success ? Status::Success : Status::Error;
+      return Flush();
+   }
+
+   bool SetStatusCode(long statusCode)
+   {
+      return SetSuccess(IsSuccess(statusCode));
+   }
+
+   /**
+    * Parses the HTTP status code from a response header line. Each status
+    * line, such as for an interim or redirected response, replaces the status
+    * of the previous line.
+    */
+   void ParseHeader(std::string_view header)
+   {
+      static constexpr std::string_view kHttpPrefix_ = "HTTP/";
+
+      if (header.starts_with(kHttpPrefix_))
+      {
+         const std::size_t codeStart = header.find(' ');
+         long              statusCode {0};
+
+         if (codeStart != std::string_view::npos)
+         {
+            std::from_chars(header.data() + codeStart + 1,
+                            header.data() + header.size(),
+                            statusCode);
+         }
+
+         status_ = IsSuccess(statusCode) ? Status::Success : Status::Error;
+         held_.clear();
+      }
+   }
+
+protected:
+   std::streamsize xsputn(const char* s, std::streamsize n) override
+   {
+      const std::string_view data {s, static_cast<std::size_t>(n)};
+
+      switch (status_)
+      {
+      case Status::Unknown:
+         held_.append(data);
+         break;
+
+      case Status::Success:
+         if (!Write(data))
+         {
+            return 0;
+         }
+         break;
+
+      case Status::Error:
+         // The error body is not part of the requested data
+         break;
+      }
+
+      return n;
+   }
+
+   int_type overflow(int_type ch) override
+   {
+      if (traits_type::eq_int_type(ch, traits_type::eof()))
+      {
+         return traits_type::not_eof(ch);
+      }
+
+      const char c = traits_type::to_char_type(ch);
+      return (xsputn(&c, 1) == 1) ? ch : traits_type::eof();
+   }
+
+private:
+   enum class Status
+   {
+      Unknown,
+      Success,
+      Error
+   };
+
+   static bool IsSuccess(long statusCode)
+   {
+      return statusCode >= 200 && statusCode < 300;
+   }
+
+   bool Flush()
+   {
+      bool success = true;
+
+      if (status_ == Status::Success && !held_.empty())
+      {
+         success = Write(held_);
+      }
+
+      held_.clear();
+      return success;
+   }
+
+   bool Write(std::string_view data)
+   {
+      if (!write_(data))
+      {
+         return false;
+      }
+
+      bytesWritten_ += data.size();
+      return true;
+   }
+
+   const WriteFunction& write_;
+   Status               status_ {Status::Unknown};
+   std::string          held_ {};
+   std::size_t          bytesWritten_ {0u};
+};
+
+class NetworkTransport : public Transport
+{
+public:
+   explicit NetworkTransport() = default;
+   ~NetworkTransport()         = default;
+
+   std::shared_ptr<ObjectStore>
+   OpenObjectStore(const std::string& bucketName,
+                   const std::string& region) override;
+
+   HttpResponse Get(const std::string&       url,
+                    const ::cpr::Header&     header,
+                    const ::cpr::Parameters& parameters) override;
+   HttpResponse GetStream(const std::string&       url,
+                          const WriteFunction&     write,
+                          const ::cpr::Header&     header,
+                          const ::cpr::Parameters& parameters) override;
+};
+
+static HttpResponse CreateHttpResponse(cpr::Response&& response);
+
+std::optional<ObjectListing>
+AwsObjectStore::ListObjects(const std::string& prefix,
+                            const std::string& delimiter)
+{
+   Aws::S3::Model::ListObjectsV2Request request;
+   request.SetBucket(bucketName_);
+   request.SetPrefix(prefix);
+
+   if (!delimiter.empty())
+   {
+      request.SetDelimiter(delimiter);
+   }
+
+   auto outcome = client_->ListObjectsV2(request);
+
+   if (!outcome.IsSuccess())
+   {
+      logger_->warn("Could not list objects: {}",
+                    outcome.GetError().GetMessage());
+      return std::nullopt;
+   }
+
+   auto& objects  = outcome.GetResult().GetContents();
+   auto& prefixes = outcome.GetResult().GetCommonPrefixes();
+
+   ObjectListing listing {};
+   listing.objects_.reserve(objects.size());
+   listing.commonPrefixes_.reserve(prefixes.size());
+
+   for (const Aws::S3::Model::Object& object : objects)
+   {
+      listing.objects_.push_back(
+         {object.GetKey(),
+          std::chrono::system_clock::time_point {
+             std::chrono::seconds {object.GetLastModified().Seconds()}},
+          static_cast<std::size_t>(object.GetSize())});
+   }
+
+   for (const Aws::S3::Model::CommonPrefix& commonPrefix : prefixes)
+   {
+      listing.commonPrefixes_.push_back(commonPrefix.GetPrefix());
+   }
+
+   return listing;
+}
+
+std::optional<ObjectData> AwsObjectStore::GetObject(const std::string& key)
+{
+   Aws::S3::Model::GetObjectRequest request;
+   request.SetBucket(bucketName_);
+   request.SetKey(key);
+
+   auto outcome = client_->GetObject(request);
+
+   if (!outcome.IsSuccess())
+   {
+      logger_->warn("Could not get object: {}",
+                    outcome.GetError().GetMessage());
+      return std::nullopt;
+   }
+
+   // The body stream is owned by the result
+   auto result = std::make_shared<Aws::S3::Model::GetObjectResult>(
+      outcome.GetResultWithOwnership());
+
+   ObjectData data {};
+   data.size_ = static_cast<std::size_t>(result->GetContentLength());
+   data.body_ = std::shared_ptr<std::istream>(result, &result->GetBody());
+
+   return data;
+}
+
+bool AwsObjectStore::GetObjectStream(const std::string&   key,
+                                     const WriteFunction& write,
+                                     std::size_t          offset,
+                                     std::size_t          length)
+{
+   Aws::S3::Model::GetObjectRequest request;
+   request.SetBucket(bucketName_);
+   request.SetKey(key);
+
+   if (offset > 0u || length > 0u)
+   {
+      request.SetRange(
+         (length > 0u) ? fmt::format("bytes={}-{}", offset, offset + length - 1)
+                       : fmt::format("bytes={}-", offset));
+   }
+
+   // Write the body as it is received, rather than to a buffer, once the
+   // response is known to be successful
+   WriteFunctionBuf writeBuf {write};
+   request.SetResponseStreamFactory(
+      [&writeBuf]()
+      { return Aws::New<Aws::IOStream>(kAllocationTag_, &writeBuf); });
+   request.SetHeadersReceivedEventHandler(
+      [&writeBuf](const Aws::Http::HttpRequest* /* request */,
+                  Aws::Http::HttpResponse* response)
+      {
+         writeBuf.SetStatusCode(
+            static_cast<long>(response->GetResponseCode()));
+      });
+
+   auto outcome = streamClient_->GetObject(request);
+
+   if (!outcome.IsSuccess())
+   {
+      logger_->warn("Could not get object: {}",
+                    outcome.GetError().GetMessage());
+      return false;
+   }
+
+   // Write any body held if the headers were not reported
+   if (!writeBuf.SetSuccess(true))
+   {
+      return false;
+   }
+
+   const std::size_t contentLength =
+      static_cast<std::size_t>(outcome.GetResult().GetContentLength());
+
+   if (writeBuf.bytes_written() != contentLength ||
+       (length > 0u && contentLength != length))
+   {
+      logger_->warn("Incomplete object: {} ({} of {} bytes)",
+                    key,
+                    writeBuf.bytes_written(),
+                    (length > 0u) ? length : contentLength);
+      return false;
+   }
+
+   return true;
+}
+
+bool ObjectStore::GetObjectStream(const std::string&   key,
+                                  const WriteFunction& write,
+                                  std::size_t          offset,
+                                  std::size_t          length)
+{
+   std::optional<ObjectData> object = GetObject(key);
+
+   if (!object.has_value() || object->body_ == nullptr)
+   {
+      return false;
+   }
+
+   std::istream& body = *object->body_;
+
+   if (offset > 0u)
+   {
+      body.seekg(static_cast<std::streamoff>(offset), std::ios_base::beg);
+   }
+
+   std::vector<char> buffer(kObjectChunkSize_);
+   std::size_t       remaining = length;
+
+   // Read the requested length, or until the end of the body
+   while (length == 0u || remaining > 0u)
+   {
+      std::size_t chunkSize = buffer.size();
+      if (length > 0u)
+      {
+         chunkSize = std::min(chunkSize, remaining);
+      }
+
+      body.read(buffer.data(), static_cast<std::streamsize>(chunkSize));
+
+      const std::size_t bytesRead = static_cast<std::size_t>(body.gcount());
+
+      if (bytesRead == 0u)
+      {
+         break;
+      }
+      if (!write(std::string_view {buffer.data(), bytesRead}))
+      {
+         return false;
+      }
+
+      remaining -= std::min(remaining, bytesRead);
+   }
+
+   return remaining == 0u;
+}
+
+std::shared_ptr<ObjectStore>
+NetworkTransport::OpenObjectStore(const std::string& bucketName,
+                                  const std::string& region)
+{
+   return std::make_shared<AwsObjectStore>(bucketName, region);
+}
+
+HttpResponse NetworkTransport::Get(const std::string&       url,
+                                   const ::cpr::Header&     header,
+                                   const ::cpr::Parameters& parameters)
+{
+   return CreateHttpResponse(cpr::Get(
+      cpr::Url {url}, header, parameters, kSslOptions_, kHttpVersion_));
+}
+
+HttpResponse NetworkTransport::GetStream(const std::string&       url,
+                                         const WriteFunction&     write,
+                                         const ::cpr::Header&     header,
+                                         const ::cpr::Parameters& parameters)
+{
+   // Only the body of a successful response is written
+   WriteFunctionBuf writeBuf {write};
+
+   HttpResponse response = CreateHttpResponse(cpr::Get(
+      cpr::Url {url},
+      header,
+      parameters,
+      kSslOptions_,
+      kHttpVersion_,
+      cpr::HeaderCallback(
+         [&writeBuf](const std::string_view& data, std::intptr_t /* userdata */)
+         {
+            writeBuf.ParseHeader(data);
+            return true;
+         }),
+      cpr::WriteCallback(
+         [&writeBuf](const std::string_view& data, std::intptr_t /* userdata */)
+         {
+            return writeBuf.sputn(data.data(),
+                                  static_cast<std::streamsize>(data.size())) ==
+                   static_cast<std::streamsize>(data.size());
+         })));
+
+   if (response.statusCode_ != 0)
+   {
+      writeBuf.SetStatusCode(response.statusCode_);
+   }
+
+   return response;
+}
+
+HttpResponse Transport::GetStream(const std::string&       url,
+                                  const WriteFunction&     write,
+                                  const ::cpr::Header&     header,
+                                  const ::cpr::Parameters& parameters)
+{
+   HttpResponse response = Get(url, header, parameters);
+
+   // Only the body of a successful response is written
+   if (cpr::status::is_success(response.statusCode_) &&
+       !response.text_.empty())
+   {
+      write(response.text_);
+   }
+   response.text_.clear();
+
+   return response;
+}
+
+static HttpResponse CreateHttpResponse(cpr::Response&& response)
+{
+   HttpResponse result {};
+   result.statusCode_ = response.status_code;
+   result.text_       = std::move(response.text);
+   result.header_     = std::move(response.header);
+
+   if (response.status_code == 0)
+   {
+      result.error_ = response.error.message;
+   }
+   else if (!cpr::status::is_success(response.status_code))
+   {
+      result.error_ = response.status_line;
+   }
+
+   return result;
+}
+
+std::shared_ptr<Transport> GetTransport()
+{
+   std::unique_lock lock {transportMutex_};
+
+   if (transport_ == nullptr)
+   {
+      transport_ = std::make_shared<NetworkTransport>();
+   }
+
+   return transport_;
+}
+
+void SetTransport(std::shared_ptr<Transport> transport)
+{
+   logger_->debug("SetTransport");
+
+   std::unique_lock lock {transportMutex_};
+   transport_ = std::move(transport);
+}
+
+} // namespace network
+} // namespace scwx
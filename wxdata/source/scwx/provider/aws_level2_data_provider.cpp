@@ -21,6 +21,9 @@ static const auto logger_ = util::Logger::Create(logPrefix_);
 static const std::string kDefaultBucketName_ = "noaa-nexrad-level2";
 static const std::string kDefaultRegion_     = "us-east-1";
 
+// Large volume scans are retrieved with parallel ranged requests
+static constexpr std::size_t kRangeRequestCount_ = 4u;
+
 class AwsLevel2DataProvider::Impl
 {
 public:
@@ -41,6 +44,7 @@ AwsLevel2DataProvider::AwsLevel2DataProvider(const std::string& radarSite,
     AwsNexradDataProvider(radarSite, bucketName, region),
     p(std::make_unique<Impl>(radarSite))
 {
+   SetRangeRequestCount(kRangeRequestCount_);
 }
 AwsLevel2DataProvider::~AwsLevel2DataProvider() = default;
 
@@ -7,8 +7,6 @@
 
 #include <shared_mutex>
 
-#include <aws/s3/S3Client.h>
-#include <aws/s3/model/ListObjectsV2Request.h>
 #include <fmt/chrono.h>
 #include <fmt/format.h>
 
@@ -170,14 +168,9 @@ void AwsLevel3DataProvider::Impl::ListProducts()
    // Prefix format: GGG_
    const std::string prefix = fmt::format("{0}_", siteId_);
 
-   Aws::S3::Model::ListObjectsV2Request request;
-   request.SetBucket(bucketName_);
-   request.SetPrefix(prefix);
-   request.SetDelimiter(delimiter);
+   auto listing = self_->object_store()->ListObjects(prefix, delimiter);
 
-   auto outcome = self_->client()->ListObjectsV2(request);
-
-   if (outcome.IsSuccess())
+   if (listing.has_value())
    {
       std::unique_lock writeLock(productMutex_);
 
@@ -187,7 +180,7 @@ void AwsLevel3DataProvider::Impl::ListProducts()
          return;
       }
 
-      auto& prefixes = outcome.GetResult().GetCommonPrefixes();
+      auto& prefixes = listing->commonPrefixes_;
 
       // Create a vector with reserved capacity
       std::vector<std::string> productList;
@@ -195,12 +188,11 @@ void AwsLevel3DataProvider::Impl::ListProducts()
 
       std::for_each(prefixes.cbegin(),
                     prefixes.cend(),
-                    [&](const Aws::S3::Model::CommonPrefix& commonPrefix)
+                    [&](const std::string& commonPrefix)
                     {
                        // Prefix format: GGG_PPP_
-                       std::string prefix = commonPrefix.GetPrefix();
-                       size_t      left   = prefix.find('_');
-                       size_t      right  = prefix.rfind('_');
+                       size_t left  = commonPrefix.find('_');
+                       size_t right = commonPrefix.rfind('_');
 
                        // If left != npos, right != npos
                        if (left != std::string::npos && right > left)
@@ -209,7 +201,7 @@ void AwsLevel3DataProvider::Impl::ListProducts()
                           // ends before the right delimeter.
                           ++left;
                           productList.push_back(
-                             prefix.substr(left, right - left));
+                             commonPrefix.substr(left, right - left));
                        }
                     });
 
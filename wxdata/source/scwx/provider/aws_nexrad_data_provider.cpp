@@ -1,18 +1,21 @@
 #define _SILENCE_STDEXT_ARR_ITERS_DEPRECATION_WARNING
 
 #include <scwx/provider/aws_nexrad_data_provider.hpp>
-#include <scwx/util/environment.hpp>
+#include <scwx/util/clock.hpp>
 #include <scwx/util/logger.hpp>
 #include <scwx/util/map.hpp>
+#include <scwx/util/metrics.hpp>
 #include <scwx/util/time.hpp>
-#include <scwx/wsr88d/nexrad_file_factory.hpp>
+#include <scwx/wsr88d/nexrad_file_loader.hpp>
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <list>
 #include <shared_mutex>
 
-#include <aws/core/auth/AWSCredentials.h>
-#include <aws/s3/S3Client.h>
-#include <aws/s3/model/GetObjectRequest.h>
-#include <aws/s3/model/ListObjectsV2Request.h>
+#include <boost/asio/post.hpp>
+#include <boost/asio/thread_pool.hpp>
 #include <fmt/chrono.h>
 
 namespace scwx
@@ -29,6 +32,18 @@ static const auto logger_ = util::Logger::Create(logPrefix_);
 static const size_t kMinDatesBeforePruning_ = 6;
 static const size_t kMaxObjects_            = 2500;
 
+// Objects are only split into ranged requests if each range is at least this
+// size
+static constexpr std::size_t kMinRangeSize_ = 2u * 1024u * 1024u;
+
+// Maximum number of bytes of each range received ahead of the range being
+// written. A range request waits for the range to be written once full.
+static constexpr std::size_t kMaxRangeBufferSize_ = 1024u * 1024u;
+
+// Maximum number of attempts to get an object, resuming from the last byte
+// received after each failed attempt
+static constexpr std::size_t kMaxStreamAttempts_ = 3u;
+
 class AwsNexradDataProvider::Impl
 {
 public:
@@ -36,14 +51,26 @@ public:
    {
       explicit ObjectRecord(
          const std::string&                    key,
-         std::chrono::system_clock::time_point lastModified) :
-          key_ {key}, lastModified_ {lastModified}
+         std::chrono::system_clock::time_point lastModified,
+         std::size_t                           size) :
+          key_ {key}, lastModified_ {lastModified}, size_ {size}
       {
       }
       ~ObjectRecord() = default;
 
       std::string                           key_;
       std::chrono::system_clock::time_point lastModified_;
+      std::size_t                           size_;
+   };
+
+   struct RangeBuffer
+   {
+      std::mutex              mutex_ {};
+      std::condition_variable cv_ {};
+      std::deque<std::string> chunks_ {};
+      std::size_t             size_ {0u};
+      bool                    complete_ {false};
+      bool                    transferred_ {false};
    };
 
    explicit Impl(const std::string& radarSite,
@@ -52,7 +79,8 @@ public:
        radarSite_ {radarSite},
        bucketName_ {bucketName},
        region_ {region},
-       client_ {nullptr},
+       objectStore_ {
+          network::GetTransport()->OpenObjectStore(bucketName, region)},
        objects_ {},
        objectsMutex_ {},
        objectDates_ {},
@@ -61,34 +89,29 @@ public:
        lastModified_ {},
        updatePeriod_ {}
    {
-      // Disable HTTP request for region
-      util::SetEnvironment("AWS_EC2_METADATA_DISABLED", "true");
-
-      // Use anonymous credentials
-      Aws::Auth::AWSCredentials credentials {};
-
-      Aws::Client::ClientConfiguration config;
-      config.region           = region_;
-      config.connectTimeoutMs = 10000;
-
-      client_ = std::make_shared<Aws::S3::S3Client>(
-         credentials,
-         Aws::MakeShared<Aws::S3::S3EndpointProvider>(
-            Aws::S3::S3Client::GetAllocationTag()),
-         config);
    }
 
    ~Impl() {}
 
-   void PruneObjects();
-   void UpdateMetadata();
+   bool        GetObjectStream(const std::string&            key,
+                               const network::WriteFunction& write,
+                               std::size_t                   offset = 0u,
+                               std::size_t                   length = 0u);
+   bool        GetObjectRanges(const std::string&            key,
+                               std::size_t                   objectSize,
+                               std::size_t                   rangeCount,
+                               const network::WriteFunction& write);
+   std::size_t GetObjectSize(const std::string&                    key,
+                             std::chrono::system_clock::time_point time);
+   void        PruneObjects();
+   void        UpdateMetadata();
    void UpdateObjectDates(std::chrono::system_clock::time_point date);
 
    std::string radarSite_;
    std::string bucketName_;
    std::string region_;
 
-   std::shared_ptr<Aws::S3::S3Client> client_;
+   std::shared_ptr<network::ObjectStore> objectStore_;
 
    std::map<std::chrono::system_clock::time_point, ObjectRecord> objects_;
    std::shared_mutex                                             objectsMutex_;
@@ -99,6 +122,8 @@ public:
 
    std::chrono::system_clock::time_point lastModified_;
    std::chrono::seconds                  updatePeriod_;
+
+   std::atomic<std::size_t> rangeRequestCount_ {1u};
 };
 
 AwsNexradDataProvider::AwsNexradDataProvider(const std::string& radarSite,
@@ -119,9 +144,14 @@ size_t AwsNexradDataProvider::cache_size() const
    return p->objects_.size();
 }
 
-std::shared_ptr<Aws::S3::S3Client> AwsNexradDataProvider::client()
+std::shared_ptr<network::ObjectStore> AwsNexradDataProvider::object_store()
+{
+   return p->objectStore_;
+}
+
+void AwsNexradDataProvider::SetRangeRequestCount(std::size_t count)
 {
-   return p->client_;
+   p->rangeRequestCount_ = std::max<std::size_t>(count, 1u);
 }
 
 std::chrono::seconds AwsNexradDataProvider::update_period() const
@@ -231,18 +261,14 @@ AwsNexradDataProvider::ListObjects(std::chrono::system_clock::time_point date)
 
    logger_->debug("ListObjects: {}", prefix);
 
-   Aws::S3::Model::ListObjectsV2Request request;
-   request.SetBucket(p->bucketName_);
-   request.SetPrefix(prefix);
-
-   auto outcome = p->client_->ListObjectsV2(request);
+   auto listing = p->objectStore_->ListObjects(prefix);
 
    size_t newObjects   = 0;
    size_t totalObjects = 0;
 
-   if (outcome.IsSuccess())
+   if (listing.has_value())
    {
-      auto& objects = outcome.GetResult().GetContents();
+      auto& objects = listing->objects_;
 
       logger_->debug("Found {} objects", objects.size());
 
@@ -250,24 +276,20 @@ AwsNexradDataProvider::ListObjects(std::chrono::system_clock::time_point date)
       std::for_each( //
          objects.cbegin(),
          objects.cend(),
-         [&](const Aws::S3::Model::Object& object)
+         [&](const network::ObjectRecord& object)
          {
-            std::string key = object.GetKey();
+            const std::string& key = object.key_;
 
             if (key.find("NWS_NEXRAD_") == std::string::npos &&
                 !key.ends_with("_MDM"))
             {
                auto time = GetTimePointByKey(key);
 
-               std::chrono::seconds lastModifiedSeconds {
-                  object.GetLastModified().Seconds()};
-               std::chrono::system_clock::time_point lastModified {
-                  lastModifiedSeconds};
-
                std::unique_lock lock(p->objectsMutex_);
 
                auto [it, inserted] = p->objects_.insert_or_assign(
-                  time, Impl::ObjectRecord {key, lastModified});
+                  time,
+                  Impl::ObjectRecord {key, object.lastModified_, object.size_});
 
                if (inserted)
                {
@@ -285,48 +307,239 @@ AwsNexradDataProvider::ListObjects(std::chrono::system_clock::time_point date)
          p->UpdateMetadata();
       }
    }
-   else
-   {
-      logger_->warn("Could not list objects: {}",
-                    outcome.GetError().GetMessage());
-   }
 
-   return {outcome.IsSuccess(), newObjects, totalObjects};
+   return {listing.has_value(), newObjects, totalObjects};
 }
 
 std::shared_ptr<wsr88d::NexradFile>
 AwsNexradDataProvider::LoadObjectByKey(const std::string& key)
 {
-   std::shared_ptr<wsr88d::NexradFile> nexradFile = nullptr;
-
-   Aws::S3::Model::GetObjectRequest request;
-   request.SetBucket(p->bucketName_);
-   request.SetKey(key);
+   util::metrics::ScopedTimer downloadTimer {
+      util::metrics::Registry::Instance().GetHistogram(
+         util::metrics::MetricName("download", p->bucketName_))};
 
-   auto outcome = p->client_->GetObject(request);
+   // Load the object as it is received, such that decompression and parsing
+   // overlap with the download
+   wsr88d::NexradFileLoader loader {};
+   std::size_t              bytesReceived = 0u;
 
-   if (outcome.IsSuccess())
+   const network::WriteFunction write = [&](std::string_view data)
    {
-      auto& body = outcome.GetResultWithOwnership().GetBody();
+      bytesReceived += data.size();
+      return loader.Write(data);
+   };
+
+   const std::size_t objectSize =
+      p->GetObjectSize(key, GetTimePointByKey(key));
+   const std::size_t rangeCount =
+      std::min<std::size_t>(p->rangeRequestCount_, objectSize / kMinRangeSize_);
+
+   bool transferred;
 
-      nexradFile = wsr88d::NexradFileFactory::Create(body);
+   if (rangeCount > 1u)
+   {
+      transferred = p->GetObjectRanges(key, objectSize, rangeCount, write);
    }
    else
    {
-      logger_->warn("Could not get object: {}",
-                    outcome.GetError().GetMessage());
+      transferred = p->GetObjectStream(key, write);
+   }
+
+   // Complete any decompression and parsing which is still pending
+   std::shared_ptr<wsr88d::NexradFile> nexradFile = loader.Finish();
+
+   downloadTimer.Stop();
+
+   util::metrics::Registry::Instance()
+      .GetCounter(util::metrics::MetricName("download_bytes", p->bucketName_))
+      .Increment(static_cast<std::uint64_t>(bytesReceived));
+
+   if (!transferred)
+   {
+      logger_->warn("Could not load object: {}", key);
+      nexradFile = nullptr;
    }
 
    return nexradFile;
 }
 
+bool AwsNexradDataProvider::Impl::GetObjectStream(
+   const std::string&            key,
+   const network::WriteFunction& write,
+   std::size_t                   offset,
+   std::size_t                   length)
+{
+   std::size_t bytesWritten = 0u;
+   bool        aborted      = false;
+
+   const network::WriteFunction countedWrite = [&](std::string_view data)
+   {
+      if (!write(data))
+      {
+         aborted = true;
+         return false;
+      }
+
+      bytesWritten += data.size();
+      return true;
+   };
+
+   for (std::size_t attempt = 1u;; ++attempt)
+   {
+      // Request only the bytes which have not been written
+      const std::size_t remaining =
+         (length > 0u) ? length - bytesWritten : 0u;
+
+      if (objectStore_->GetObjectStream(
+             key, countedWrite, offset + bytesWritten, remaining))
+      {
+         return true;
+      }
+
+      if (aborted || attempt >= kMaxStreamAttempts_ ||
+          (length > 0u && bytesWritten >= length))
+      {
+         return false;
+      }
+
+      logger_->debug("Resuming {} at byte {} (attempt {})",
+                     key,
+                     offset + bytesWritten,
+                     attempt + 1u);
+   }
+}
+
+bool AwsNexradDataProvider::Impl::GetObjectRanges(
+   const std::string&            key,
+   std::size_t                   objectSize,
+   std::size_t                   rangeCount,
+   const network::WriteFunction& write)
+{
+   logger_->debug("Getting {} in {} ranges", key, rangeCount);
+
+   const std::size_t rangeSize = (objectSize + rangeCount - 1) / rangeCount;
+   const std::size_t remainingRanges = (objectSize - 1) / rangeSize;
+
+   std::deque<RangeBuffer> buffers(remainingRanges);
+   std::atomic<bool>       cancelled {false};
+
+   // Get the remaining ranges in parallel, while the first range is written as
+   // it is received. Each range is held in a bounded buffer until the
+   // preceding ranges have been written.
+   boost::asio::thread_pool threadPool {remainingRanges};
+
+   for (std::size_t i = 0; i < remainingRanges; ++i)
+   {
+      const std::size_t offset = (i + 1) * rangeSize;
+      const std::size_t length = std::min(rangeSize, objectSize - offset);
+
+      boost::asio::post(
+         threadPool,
+         [&, offset, length, i]()
+         {
+            RangeBuffer& buffer = buffers[i];
+
+            const bool transferred = GetObjectStream(
+               key,
+               [&](std::string_view chunk)
+               {
+                  std::unique_lock lock {buffer.mutex_};
+                  buffer.cv_.wait(
+                     lock,
+                     [&]()
+                     {
+                        return buffer.size_ < kMaxRangeBufferSize_ ||
+                               cancelled;
+                     });
+
+                  if (cancelled)
+                  {
+                     return false;
+                  }
+
+                  buffer.chunks_.emplace_back(chunk);
+                  buffer.size_ += chunk.size();
+                  buffer.cv_.notify_all();
+                  return true;
+               },
+               offset,
+               length);
+
+            std::unique_lock lock {buffer.mutex_};
+            buffer.complete_    = true;
+            buffer.transferred_ = transferred;
+            buffer.cv_.notify_all();
+         });
+   }
+
+   bool transferred = GetObjectStream(key, write, 0u, rangeSize);
+
+   // Write the remaining ranges in order
+   for (std::size_t i = 0; transferred && i < remainingRanges; ++i)
+   {
+      RangeBuffer& buffer = buffers[i];
+
+      while (transferred)
+      {
+         std::unique_lock lock {buffer.mutex_};
+         buffer.cv_.wait(lock,
+                         [&]()
+                         {
+                            return !buffer.chunks_.empty() ||
+                                   buffer.complete_;
+                         });
+
+         if (buffer.chunks_.empty())
+         {
+            transferred = buffer.transferred_;
+            break;
+         }
+
+         std::string chunk = std::move(buffer.chunks_.front());
+         buffer.chunks_.pop_front();
+         buffer.size_ -= chunk.size();
+         buffer.cv_.notify_all();
+         lock.unlock();
+
+         transferred = write(chunk);
+      }
+   }
+
+   if (!transferred)
+   {
+      // Abort the range requests which are waiting to be written
+      cancelled = true;
+
+      for (RangeBuffer& buffer : buffers)
+      {
+         std::unique_lock lock {buffer.mutex_};
+         buffer.cv_.notify_all();
+      }
+   }
+
+   threadPool.join();
+
+   return transferred;
+}
+
+std::size_t AwsNexradDataProvider::Impl::GetObjectSize(
+   const std::string& key, std::chrono::system_clock::time_point time)
+{
+   std::shared_lock lock(objectsMutex_);
+
+   auto it = objects_.find(time);
+
+   return (it != objects_.cend() && it->second.key_ == key) ? it->second.size_
+                                                           : 0u;
+}
+
 std::pair<size_t, size_t> AwsNexradDataProvider::Refresh()
 {
    using namespace std::chrono;
 
    logger_->debug("Refresh()");
 
-   auto today     = floor<days>(system_clock::now());
+   auto today     = floor<days>(util::clock::Now());
    auto yesterday = today - days {1};
 
    std::unique_lock lock(p->refreshMutex_);
@@ -362,7 +575,7 @@ void AwsNexradDataProvider::Impl::PruneObjects()
 {
    using namespace std::chrono;
 
-   auto today     = floor<days>(system_clock::now());
+   auto today     = floor<days>(util::clock::Now());
    auto yesterday = today - days {1};
 
    std::unique_lock lock(objectsMutex_);
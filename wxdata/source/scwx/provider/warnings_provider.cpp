@@ -1,7 +1,9 @@
 #include <scwx/provider/warnings_provider.hpp>
 #include <scwx/network/dir_list.hpp>
+#include <scwx/network/transport.hpp>
 #include <scwx/util/logger.hpp>
 
+#include <future>
 #include <ranges>
 #include <shared_mutex>
 
@@ -9,9 +11,6 @@
 #   pragma warning(push, 0)
 #endif
 
-#define LIBXML_HTML_ENABLED
-#include <cpr/cpr.h>
-#include <libxml/HTMLparser.h>
 #include <re2/re2.h>
 
 #if (__cpp_lib_chrono < 201907L)
@@ -162,7 +161,11 @@ WarningsProvider::LoadUpdatedFiles(
 
    std::vector<std::shared_ptr<awips::TextProductFile>> updatedFiles;
 
-   std::vector<std::pair<std::string, cpr::AsyncResponse>> asyncResponses;
+   std::vector<std::pair<std::string, std::future<network::HttpResponse>>>
+      asyncResponses;
+
+   // Take a copy of the current transport
+   std::shared_ptr<network::Transport> transport = network::GetTransport();
 
    std::unique_lock lock(p->filesMutex_);
 
@@ -175,7 +178,9 @@ WarningsProvider::LoadUpdatedFiles(
          // Retrieve warning file
          asyncResponses.emplace_back(
             record.first,
-            cpr::GetAsync(cpr::Url {p->baseUrl_ + "/" + record.first}));
+            std::async(std::launch::async,
+                       [transport, url = p->baseUrl_ + "/" + record.first]()
+                       { return transport->Get(url); }));
 
          // Clear updated flag
          record.second.updated_ = false;
@@ -187,15 +192,15 @@ WarningsProvider::LoadUpdatedFiles(
    // Wait for warning files to load
    for (auto& asyncResponse : asyncResponses)
    {
-      cpr::Response response = asyncResponse.second.get();
-      if (response.status_code == cpr::status::HTTP_OK)
+      network::HttpResponse response = asyncResponse.second.get();
+      if (response.statusCode_ == 200)
       {
          logger_->debug("Loading file: {}", asyncResponse.first);
 
          // Load file
          std::shared_ptr<awips::TextProductFile> textProductFile {
             std::make_shared<awips::TextProductFile>()};
-         std::istringstream responseBody {response.text};
+         std::istringstream responseBody {response.text_};
          if (textProductFile->LoadData(responseBody))
          {
             updatedFiles.push_back(textProductFile);
@@ -206,5 +211,20 @@ WarningsProvider::LoadUpdatedFiles(
    return updatedFiles;
 }
 
+std::chrono::system_clock::time_point
+WarningsProvider::latest_start_time() const
+{
+   std::shared_lock lock(p->filesMutex_);
+
+   std::chrono::system_clock::time_point latestStartTime {};
+
+   for (auto& record : p->files_)
+   {
+      latestStartTime = std::max(latestStartTime, record.second.startTime_);
+   }
+
+   return latestStartTime;
+}
+
 } // namespace provider
 } // namespace scwx
@@ -0,0 +1,174 @@
+#include <scwx/util/clock.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+
+namespace scwx
+{
+namespace util
+{
+namespace clock
+{
+
+static std::shared_ptr<ReplayClock> replayClock_ {nullptr};
+static std::atomic<bool>            replayClockActive_ {false};
+static std::shared_mutex            replayClockMutex_ {};
+
+class ReplayClock::Impl
+{
+public:
+   explicit Impl(std::chrono::system_clock::time_point startTime,
+                 double                                speed) :
+       baseTime_ {startTime},
+       baseRealTime_ {std::chrono::steady_clock::now()},
+       speed_ {speed}
+   {
+   }
+   ~Impl() = default;
+
+   std::chrono::system_clock::time_point
+   Now(std::chrono::steady_clock::time_point realTime) const;
+   void Rebase();
+
+   std::chrono::system_clock::time_point baseTime_;
+   std::chrono::steady_clock::time_point baseRealTime_;
+   double                                speed_;
+   bool                                  paused_ {false};
+
+   mutable std::mutex mutex_ {};
+};
+
+ReplayClock::ReplayClock(std::chrono::system_clock::time_point startTime,
+                         double                                speed) :
+    p(std::make_unique<Impl>(startTime, speed))
+{
+}
+ReplayClock::~ReplayClock() = default;
+
+ReplayClock::ReplayClock(ReplayClock&&) noexcept            = default;
+ReplayClock& ReplayClock::operator=(ReplayClock&&) noexcept = default;
+
+std::chrono::system_clock::time_point ReplayClock::now() const
+{
+   std::unique_lock lock {p->mutex_};
+   return p->Now(std::chrono::steady_clock::now());
+}
+
+bool ReplayClock::paused() const
+{
+   std::unique_lock lock {p->mutex_};
+   return p->paused_;
+}
+
+double ReplayClock::speed() const
+{
+   std::unique_lock lock {p->mutex_};
+   return p->speed_;
+}
+
+void ReplayClock::Advance(std::chrono::system_clock::duration duration)
+{
+   std::unique_lock lock {p->mutex_};
+   p->Rebase();
+   p->baseTime_ += duration;
+}
+
+void ReplayClock::Pause()
+{
+   std::unique_lock lock {p->mutex_};
+   p->Rebase();
+   p->paused_ = true;
+}
+
+void ReplayClock::Resume()
+{
+   std::unique_lock lock {p->mutex_};
+   p->Rebase();
+   p->paused_ = false;
+}
+
+void ReplayClock::SetSpeed(double speed)
+{
+   std::unique_lock lock {p->mutex_};
+   p->Rebase();
+   p->speed_ = speed;
+}
+
+void ReplayClock::SetTime(std::chrono::system_clock::time_point time)
+{
+   std::unique_lock lock {p->mutex_};
+   p->Rebase();
+   p->baseTime_ = time;
+}
+
+std::chrono::system_clock::time_point
+ReplayClock::Impl::Now(std::chrono::steady_clock::time_point realTime) const
+{
+   if (paused_)
+   {
+      return baseTime_;
+   }
+
+   return baseTime_ +
+          std::chrono::duration_cast<std::chrono::system_clock::duration>(
+             std::chrono::duration<double, std::nano> {realTime -
+                                                       baseRealTime_} *
+             speed_);
+}
+
+void ReplayClock::Impl::Rebase()
+{
+   // Fold the elapsed time into the base time, such that changes to the clock
+   // take effect from the current time
+   const auto realTime = std::chrono::steady_clock::now();
+   baseTime_           = Now(realTime);
+   baseRealTime_       = realTime;
+}
+
+std::chrono::system_clock::time_point Now()
+{
+   if (replayClockActive_.load(std::memory_order_acquire))
+   {
+      std::shared_lock lock {replayClockMutex_};
+      if (replayClock_ != nullptr)
+      {
+         return replayClock_->now();
+      }
+   }
+
+   return std::chrono::system_clock::now();
+}
+
+std::chrono::milliseconds RealInterval(std::chrono::milliseconds interval)
+{
+   std::shared_ptr<ReplayClock> replayClock = GetReplayClock();
+
+   if (replayClock == nullptr || replayClock->paused() ||
+       replayClock->speed() <= 0.0)
+   {
+      return interval;
+   }
+
+   return std::max(std::chrono::milliseconds {1},
+                   std::chrono::duration_cast<std::chrono::milliseconds>(
+                      interval / replayClock->speed()));
+}
+
+std::shared_ptr<ReplayClock> GetReplayClock()
+{
+   std::shared_lock lock {replayClockMutex_};
+   return replayClock_;
+}
+
+void SetReplayClock(std::shared_ptr<ReplayClock> replayClock)
+{
+   std::unique_lock lock {replayClockMutex_};
+   replayClockActive_.store(replayClock != nullptr, std::memory_order_release);
+   replayClock_ = std::move(replayClock);
+}
+
+} // namespace clock
+} // namespace util
+} // namespace scwx
@@ -0,0 +1,334 @@
+#include <scwx/util/initialization_graph.hpp>
+#include <scwx/util/logger.hpp>
+#include <scwx/util/metrics.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+
+#include <fmt/format.h>
+
+namespace scwx
+{
+namespace util
+{
+
+static const std::string logPrefix_ = "scwx::util::initialization_graph";
+static const auto        logger_    = Logger::Create(logPrefix_);
+
+class InitializationGraph::Impl
+{
+public:
+   struct Step
+   {
+      std::string              name_;
+      StepFunction             function_;
+      std::vector<std::string> dependencies_;
+      ThreadAffinity           affinity_;
+
+      std::vector<std::size_t> dependents_ {};
+      std::size_t              remainingDependencies_ {0u};
+   };
+
+   explicit Impl(const std::string& name, std::size_t threadCount) :
+       name_ {name}, threadCount_ {std::max<std::size_t>(1u, threadCount)}
+   {
+   }
+   ~Impl() = default;
+
+   void Complete(std::size_t index);
+   void Execute(std::size_t index);
+   void Prepare();
+   void Schedule(std::size_t index);
+   void WorkerLoop();
+
+   std::string name_;
+   std::size_t threadCount_;
+
+   std::vector<Step> steps_ {};
+
+   std::mutex              mutex_ {};
+   std::condition_variable condition_ {};
+
+   std::deque<std::size_t> workerQueue_ {};
+   std::deque<std::size_t> callerQueue_ {};
+   std::size_t             completed_ {0u};
+   bool                    succeeded_ {true};
+
+   std::chrono::steady_clock::time_point runStart_ {};
+   std::vector<StepTrace>                trace_ {};
+};
+
+InitializationGraph::InitializationGraph(const std::string& name,
+                                         std::size_t        threadCount) :
+    p(std::make_unique<Impl>(name, threadCount))
+{
+}
+InitializationGraph::~InitializationGraph() = default;
+
+InitializationGraph::InitializationGraph(InitializationGraph&&) noexcept =
+   default;
+InitializationGraph&
+InitializationGraph::operator=(InitializationGraph&&) noexcept = default;
+
+void InitializationGraph::AddStep(const std::string&              name,
+                                  StepFunction                    function,
+                                  const std::vector<std::string>& dependencies,
+                                  ThreadAffinity                  affinity)
+{
+   p->steps_.push_back({name, std::move(function), dependencies, affinity});
+}
+
+void InitializationGraph::Impl::Prepare()
+{
+   std::unordered_map<std::string, std::size_t> stepIndex {};
+
+   for (std::size_t i = 0; i < steps_.size(); ++i)
+   {
+      if (!stepIndex.emplace(steps_[i].name_, i).second)
+      {
+         throw std::invalid_argument(
+            fmt::format("Duplicate initialization step: {}", steps_[i].name_));
+      }
+
+      steps_[i].dependents_.clear();
+   }
+
+   for (std::size_t i = 0; i < steps_.size(); ++i)
+   {
+      Step& step                  = steps_[i];
+      step.remainingDependencies_ = step.dependencies_.size();
+
+      for (const std::string& dependency : step.dependencies_)
+      {
+         auto it = stepIndex.find(dependency);
+         if (it == stepIndex.cend())
+         {
+            throw std::invalid_argument(
+               fmt::format("Unknown dependency of initialization step {}: {}",
+                           step.name_,
+                           dependency));
+         }
+
+         steps_[it->second].dependents_.push_back(i);
+      }
+   }
+
+   // Verify the graph is acyclic, by removing steps without dependencies
+   std::vector<std::size_t> remaining(steps_.size());
+   std::vector<std::size_t> ready {};
+   std::size_t              visited = 0u;
+
+   for (std::size_t i = 0; i < steps_.size(); ++i)
+   {
+      remaining[i] = steps_[i].remainingDependencies_;
+      if (remaining[i] == 0u)
+      {
+         ready.push_back(i);
+      }
+   }
+
+   while (!ready.empty())
+   {
+      const std::size_t i = ready.back();
+      ready.pop_back();
+      ++visited;
+
+      for (std::size_t dependent : steps_[i].dependents_)
+      {
+         if (--remaining[dependent] == 0u)
+         {
+            ready.push_back(dependent);
+         }
+      }
+   }
+
+   if (visited != steps_.size())
+   {
+      throw std::invalid_argument(
+         fmt::format("Initialization graph {} contains a cycle", name_));
+   }
+}
+
+bool InitializationGraph::Run()
+{
+   p->Prepare();
+
+   std::unique_lock lock {p->mutex_};
+
+   p->workerQueue_.clear();
+   p->callerQueue_.clear();
+   p->completed_ = 0u;
+   p->succeeded_ = true;
+   p->trace_.clear();
+   p->runStart_ = std::chrono::steady_clock::now();
+
+   for (std::size_t i = 0; i < p->steps_.size(); ++i)
+   {
+      if (p->steps_[i].remainingDependencies_ == 0u)
+      {
+         p->Schedule(i);
+      }
+   }
+
+   lock.unlock();
+
+   std::vector<std::thread> workers {};
+   for (std::size_t i = 0; i < p->threadCount_; ++i)
+   {
+      workers.emplace_back([this]() { p->WorkerLoop(); });
+   }
+
+   // Run steps which must execute on the calling thread
+   lock.lock();
+
+   while (p->completed_ < p->steps_.size())
+   {
+      p->condition_.wait(lock,
+                         [this]()
+                         {
+                            return !p->callerQueue_.empty() ||
+                                   p->completed_ == p->steps_.size();
+                         });
+
+      if (!p->callerQueue_.empty())
+      {
+         const std::size_t index = p->callerQueue_.front();
+         p->callerQueue_.pop_front();
+
+         lock.unlock();
+         p->Execute(index);
+         lock.lock();
+
+         p->Complete(index);
+      }
+   }
+
+   lock.unlock();
+
+   for (auto& worker : workers)
+   {
+      worker.join();
+   }
+
+   const auto elapsed = std::chrono::steady_clock::now() - p->runStart_;
+   logger_->info(
+      "{} initialization completed in {} ms",
+      p->name_,
+      std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count());
+
+   return p->succeeded_;
+}
+
+void InitializationGraph::Impl::WorkerLoop()
+{
+   std::unique_lock lock {mutex_};
+
+   while (true)
+   {
+      condition_.wait(lock,
+                      [this]()
+                      {
+                         return !workerQueue_.empty() ||
+                                completed_ == steps_.size();
+                      });
+
+      if (workerQueue_.empty())
+      {
+         // All steps have completed
+         break;
+      }
+
+      const std::size_t index = workerQueue_.front();
+      workerQueue_.pop_front();
+
+      lock.unlock();
+      Execute(index);
+      lock.lock();
+
+      Complete(index);
+   }
+}
+
+void InitializationGraph::Impl::Schedule(std::size_t index)
+{
+   if (steps_[index].affinity_ == ThreadAffinity::Caller)
+   {
+      callerQueue_.push_back(index);
+   }
+   else
+   {
+      workerQueue_.push_back(index);
+   }
+}
+
+void InitializationGraph::Impl::Execute(std::size_t index)
+{
+   Step& step = steps_[index];
+
+   logger_->debug("{}: Starting {}", name_, step.name_);
+
+   StepTrace trace {};
+   trace.name_ = step.name_;
+
+   const auto start = std::chrono::steady_clock::now();
+   trace.start_     = start - runStart_;
+
+   try
+   {
+      step.function_();
+      trace.succeeded_ = true;
+   }
+   catch (const std::exception& ex)
+   {
+      logger_->error("{}: {} failed: {}", name_, step.name_, ex.what());
+   }
+
+   trace.duration_ = std::chrono::steady_clock::now() - start;
+
+   logger_->info(
+      "{}: {} completed in {} ms (started at {} ms)",
+      name_,
+      step.name_,
+      std::chrono::duration_cast<std::chrono::milliseconds>(trace.duration_)
+         .count(),
+      std::chrono::duration_cast<std::chrono::milliseconds>(trace.start_)
+         .count());
+
+   metrics::Registry::Instance()
+      .GetHistogram(metrics::MetricName(
+         "init", fmt::format("{}.{}", name_, step.name_)))
+      .Record(trace.duration_);
+
+   std::unique_lock lock {mutex_};
+   succeeded_ = succeeded_ && trace.succeeded_;
+   trace_.push_back(std::move(trace));
+}
+
+void InitializationGraph::Impl::Complete(std::size_t index)
+{
+   ++completed_;
+
+   for (std::size_t dependent : steps_[index].dependents_)
+   {
+      if (--steps_[dependent].remainingDependencies_ == 0u)
+      {
+         Schedule(dependent);
+      }
+   }
+
+   condition_.notify_all();
+}
+
+std::vector<InitializationGraph::StepTrace> InitializationGraph::trace() const
+{
+   std::unique_lock lock {p->mutex_};
+   return p->trace_;
+}
+
+} // namespace util
+} // namespace scwx
@@ -0,0 +1,332 @@
+#include <scwx/util/metrics.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <map>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+#include <fmt/format.h>
+
+namespace scwx
+{
+namespace util
+{
+namespace metrics
+{
+
+static const std::unordered_map<MetricType, std::string> metricTypeName_ {
+   {MetricType::Counter, "counter"},
+   {MetricType::Gauge, "gauge"},
+   {MetricType::Histogram, "histogram"}};
+
+std::uint64_t Counter::value() const
+{
+   return value_.load(std::memory_order_relaxed);
+}
+
+void Counter::Increment(std::uint64_t n)
+{
+   value_.fetch_add(n, std::memory_order_relaxed);
+}
+
+void Counter::Reset()
+{
+   value_.store(0, std::memory_order_relaxed);
+}
+
+std::int64_t Gauge::value() const
+{
+   return value_.load(std::memory_order_relaxed);
+}
+
+void Gauge::Add(std::int64_t n)
+{
+   value_.fetch_add(n, std::memory_order_relaxed);
+}
+
+void Gauge::Set(std::int64_t value)
+{
+   value_.store(value, std::memory_order_relaxed);
+}
+
+std::uint64_t Histogram::count() const
+{
+   return count_.load(std::memory_order_relaxed);
+}
+
+std::uint64_t Histogram::max() const
+{
+   return max_.load(std::memory_order_relaxed);
+}
+
+std::uint64_t Histogram::sum() const
+{
+   return sum_.load(std::memory_order_relaxed);
+}
+
+std::size_t Histogram::BucketIndex(std::uint64_t value)
+{
+   if (value < kSubBucketCount)
+   {
+      // Values smaller than the sub-bucket count are recorded exactly
+      return static_cast<std::size_t>(value);
+   }
+
+   // Shift the value such that the most significant bit lies at the top of
+   // the sub-bucket range, and use the remaining bits as the sub-bucket
+   const std::size_t shift =
+      static_cast<std::size_t>(std::bit_width(value)) - kSubBucketBits - 1;
+   const std::size_t subBucket =
+      static_cast<std::size_t>(value >> shift) - kSubBucketCount;
+
+   return (shift + 1) * kSubBucketCount + subBucket;
+}
+
+std::uint64_t Histogram::BucketUpperBound(std::size_t index)
+{
+   if (index < kSubBucketCount)
+   {
+      return index;
+   }
+
+   const std::size_t   shift = index / kSubBucketCount - 1;
+   const std::uint64_t mantissa =
+      kSubBucketCount + static_cast<std::uint64_t>(index % kSubBucketCount);
+
+   return ((mantissa + 1) << shift) - 1;
+}
+
+std::uint64_t Histogram::ValueAtQuantile(double quantile) const
+{
+   const std::uint64_t totalCount = count();
+
+   if (totalCount == 0)
+   {
+      return 0;
+   }
+
+   quantile = std::clamp(quantile, 0.0, 1.0);
+
+   // Rank of the requested value, from 1 to the total count
+   const std::uint64_t rank = std::max<std::uint64_t>(
+      1, static_cast<std::uint64_t>(quantile * static_cast<double>(totalCount) +
+                                    0.5));
+
+   std::uint64_t cumulativeCount = 0;
+
+   for (std::size_t i = 0; i < buckets_.size(); ++i)
+   {
+      cumulativeCount += buckets_[i].load(std::memory_order_relaxed);
+
+      if (cumulativeCount >= rank)
+      {
+         // Don't report a value larger than has been recorded
+         return std::min(BucketUpperBound(i), max());
+      }
+   }
+
+   // Values were recorded concurrently with the count being read
+   return max();
+}
+
+void Histogram::Record(std::uint64_t nanoseconds)
+{
+   buckets_[BucketIndex(nanoseconds)].fetch_add(1, std::memory_order_relaxed);
+   count_.fetch_add(1, std::memory_order_relaxed);
+   sum_.fetch_add(nanoseconds, std::memory_order_relaxed);
+
+   std::uint64_t currentMax = max_.load(std::memory_order_relaxed);
+   while (nanoseconds > currentMax &&
+          !max_.compare_exchange_weak(
+             currentMax, nanoseconds, std::memory_order_relaxed))
+   {
+   }
+}
+
+void Histogram::Record(std::chrono::steady_clock::duration duration)
+{
+   Record(static_cast<std::uint64_t>(std::max<std::int64_t>(
+      0,
+      std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count())));
+}
+
+void Histogram::Reset()
+{
+   for (auto& bucket : buckets_)
+   {
+      bucket.store(0, std::memory_order_relaxed);
+   }
+
+   count_.store(0, std::memory_order_relaxed);
+   sum_.store(0, std::memory_order_relaxed);
+   max_.store(0, std::memory_order_relaxed);
+}
+
+ScopedTimer::ScopedTimer(Histogram& histogram) :
+    histogram_ {&histogram}, start_ {std::chrono::steady_clock::now()}
+{
+}
+
+ScopedTimer::~ScopedTimer()
+{
+   Stop();
+}
+
+void ScopedTimer::Stop()
+{
+   if (histogram_ != nullptr)
+   {
+      histogram_->Record(std::chrono::steady_clock::now() - start_);
+      histogram_ = nullptr;
+   }
+}
+
+class Registry::Impl
+{
+public:
+   explicit Impl() {}
+   ~Impl() = default;
+
+   template<class T>
+   T& GetMetric(std::map<std::string, std::unique_ptr<T>>& metrics,
+                const std::string&                         name);
+
+   mutable std::shared_mutex mutex_ {};
+
+   std::map<std::string, std::unique_ptr<Counter>>   counters_ {};
+   std::map<std::string, std::unique_ptr<Gauge>>     gauges_ {};
+   std::map<std::string, std::unique_ptr<Histogram>> histograms_ {};
+};
+
+Registry::Registry() : p(std::make_unique<Impl>()) {}
+Registry::~Registry() = default;
+
+Registry& Registry::Instance()
+{
+   static Registry registry_ {};
+   return registry_;
+}
+
+template<class T>
+T& Registry::Impl::GetMetric(std::map<std::string, std::unique_ptr<T>>& metrics,
+                             const std::string&                         name)
+{
+   {
+      std::shared_lock lock {mutex_};
+
+      auto it = metrics.find(name);
+      if (it != metrics.cend())
+      {
+         return *it->second;
+      }
+   }
+
+   std::unique_lock lock {mutex_};
+
+   auto& metric = metrics[name];
+   if (metric == nullptr)
+   {
+      metric = std::make_unique<T>();
+   }
+
+   return *metric;
+}
+
+Counter& Registry::GetCounter(const std::string& name)
+{
+   return p->GetMetric(p->counters_, name);
+}
+
+Gauge& Registry::GetGauge(const std::string& name)
+{
+   return p->GetMetric(p->gauges_, name);
+}
+
+Histogram& Registry::GetHistogram(const std::string& name)
+{
+   return p->GetMetric(p->histograms_, name);
+}
+
+void Registry::Reset()
+{
+   std::shared_lock lock {p->mutex_};
+
+   for (auto& counter : p->counters_)
+   {
+      counter.second->Reset();
+   }
+   for (auto& histogram : p->histograms_)
+   {
+      histogram.second->Reset();
+   }
+}
+
+std::vector<MetricSnapshot> Registry::Snapshot() const
+{
+   std::vector<MetricSnapshot> snapshot {};
+
+   std::shared_lock lock {p->mutex_};
+
+   snapshot.reserve(p->counters_.size() + p->gauges_.size() +
+                    p->histograms_.size());
+
+   for (auto& counter : p->counters_)
+   {
+      MetricSnapshot& metric = snapshot.emplace_back();
+      metric.name_           = counter.first;
+      metric.type_           = MetricType::Counter;
+      metric.value_ = static_cast<std::int64_t>(counter.second->value());
+   }
+
+   for (auto& gauge : p->gauges_)
+   {
+      MetricSnapshot& metric = snapshot.emplace_back();
+      metric.name_           = gauge.first;
+      metric.type_           = MetricType::Gauge;
+      metric.value_          = gauge.second->value();
+   }
+
+   for (auto& histogram : p->histograms_)
+   {
+      const Histogram& h      = *histogram.second;
+      MetricSnapshot&  metric = snapshot.emplace_back();
+      metric.name_            = histogram.first;
+      metric.type_            = MetricType::Histogram;
+      metric.count_           = h.count();
+      metric.mean_ = (metric.count_ > 0) ? h.sum() / metric.count_ : 0;
+      metric.p50_             = h.ValueAtQuantile(0.50);
+      metric.p90_             = h.ValueAtQuantile(0.90);
+      metric.p99_             = h.ValueAtQuantile(0.99);
+      metric.max_             = h.max();
+   }
+
+   lock.unlock();
+
+   std::sort(snapshot.begin(),
+             snapshot.end(),
+             [](const MetricSnapshot& a, const MetricSnapshot& b)
+             { return a.name_ < b.name_; });
+
+   return snapshot;
+}
+
+std::string MetricName(std::string_view stage, std::string_view label)
+{
+   if (label.empty())
+   {
+      return std::string {stage};
+   }
+
+   return fmt::format("{}[{}]", stage, label);
+}
+
+const std::string& GetMetricTypeName(MetricType type)
+{
+   return metricTypeName_.at(type);
+}
+
+} // namespace metrics
+} // namespace util
+} // namespace scwx
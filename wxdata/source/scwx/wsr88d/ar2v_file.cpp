@@ -1,13 +1,22 @@
 #include <scwx/wsr88d/ar2v_file.hpp>
 #include <scwx/wsr88d/rda/digital_radar_data.hpp>
+#include <scwx/wsr88d/rda/digital_radar_data_generic.hpp>
 #include <scwx/wsr88d/rda/level2_message_factory.hpp>
 #include <scwx/wsr88d/rda/rda_types.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/metrics.hpp>
 #include <scwx/util/rangebuf.hpp>
 #include <scwx/util/time.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <deque>
 #include <fstream>
+#include <future>
+#include <mutex>
 #include <sstream>
+#include <thread>
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -20,9 +29,14 @@
 #endif
 
 #include <boost/algorithm/string/trim.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/thread_pool.hpp>
 #include <boost/iostreams/copy.hpp>
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
 #include <boost/iostreams/filtering_streambuf.hpp>
 #include <boost/iostreams/filter/bzip2.hpp>
+#include <boost/iostreams/stream.hpp>
 
 #if defined(__GNUC__)
 #   pragma GCC diagnostic pop
@@ -40,18 +54,96 @@ namespace wsr88d
 static const std::string logPrefix_ = "scwx::wsr88d::ar2v_file";
 static const auto        logger_    = util::Logger::Create(logPrefix_);
 
+static auto& decompressTime_ = util::metrics::Registry::Instance().GetHistogram(
+   util::metrics::MetricName("decompress", "Level 2"));
+static auto& parseTime_ = util::metrics::Registry::Instance().GetHistogram(
+   util::metrics::MetricName("parse", "Level 2"));
+static auto& parseElevationTime_ =
+   util::metrics::Registry::Instance().GetHistogram(
+      util::metrics::MetricName("parse_elevation", "Level 2"));
+static auto& indexTime_ = util::metrics::Registry::Instance().GetHistogram(
+   util::metrics::MetricName("index", "Level 2"));
+
+typedef std::vector<char> LdmRecord;
+typedef boost::iostreams::stream<boost::iostreams::array_source>
+   LdmRecordStream;
+
+static constexpr std::size_t kVolumeHeaderSize_  = 24;
+static constexpr std::size_t kControlWordSize_   = 4;
+static const std::size_t     kMaxPendingRecords_ = std::max(
+   static_cast<std::size_t>(std::thread::hardware_concurrency()),
+   std::size_t {2u});
+
+struct RadialLocation
+{
+   std::shared_ptr<const LdmRecord> record_ {nullptr};
+   std::streamoff                   offset_ {0};
+   std::uint32_t                    collectionTime_ {0};
+   std::uint16_t                    modifiedJulianDate_ {0};
+};
+
+struct StreamState
+{
+   enum class Stage
+   {
+      VolumeHeader,
+      LdmRecords,
+      Uncompressed,
+      Complete
+   };
+
+   Stage       stage_ {Stage::VolumeHeader};
+   std::string buffer_ {}; ///< Partially received header or record
+   std::size_t recordCount_ {0};
+
+   std::deque<std::future<std::shared_ptr<const LdmRecord>>> pending_ {};
+
+   // Decompresses records while the stream is loading
+   std::unique_ptr<boost::asio::thread_pool> threadPool_ {nullptr};
+};
+
+struct LazyElevation
+{
+   std::map<std::uint16_t, RadialLocation> radials_ {};
+   std::vector<rda::DataBlockType>         radial0DataBlocks_ {};
+
+   std::once_flag                      parseFlag_ {};
+   std::shared_ptr<rda::ElevationScan> elevationScan_ {nullptr};
+};
+
 class Ar2vFileImpl
 {
 public:
-   explicit Ar2vFileImpl() {};
+   explicit Ar2vFileImpl(bool lazyLoad) : lazyLoad_ {lazyLoad} {};
    ~Ar2vFileImpl() = default;
 
    std::size_t DecompressLDMRecords(std::istream& is);
-   void        HandleMessage(std::shared_ptr<rda::Level2Message>& message);
-   void        IndexFile();
-   void        ParseLDMRecords();
-   void        ParseLDMRecord(std::istream& is);
+   bool        ReadVolumeHeader(std::istream& is);
+   void        ParsePendingRecord();
+   void        SplitLDMRecords();
+   std::shared_ptr<rda::ElevationScan>
+        GetElevation(std::uint16_t elevationIndex);
+   void HandleMessage(std::shared_ptr<rda::Level2Message>& message);
+   void IndexElevation(std::uint16_t                          elevationIndex,
+                       const std::vector<rda::DataBlockType>& dataBlocks,
+                       std::uint16_t                          elevationAngle,
+                       rda::WaveformType                      waveformType);
+   void IndexFile();
+   void ParseLDMRecords();
+   void ParseLDMRecord(std::istream&                           is,
+                       const std::shared_ptr<const LdmRecord>& record);
    void ProcessRadarData(const std::shared_ptr<rda::GenericRadarData>& message);
+   bool ScanRadarData(std::istream&                           is,
+                      const std::shared_ptr<const LdmRecord>& record,
+                      std::streampos                          messageStart);
+
+   static std::shared_ptr<const LdmRecord>
+   DecompressLDMRecord(const std::string& compressed, std::size_t recordNumber);
+   static std::shared_ptr<rda::ElevationScan>
+   ParseElevation(LazyElevation&            lazyElevation,
+                  std::atomic<std::size_t>& messageCount);
+
+   const bool lazyLoad_;
 
    std::string   tapeFilename_ {};
    std::string   extensionNumber_ {};
@@ -59,19 +151,24 @@ public:
    std::uint32_t milliseconds_ {0};
    std::string   icao_ {};
 
-   std::size_t messageCount_ {0};
+   std::atomic<std::size_t> messageCount_ {0};
 
    std::shared_ptr<rda::VolumeCoveragePatternData>              vcpData_ {};
    std::map<std::uint16_t, std::shared_ptr<rda::ElevationScan>> radarData_ {};
+   std::map<std::uint16_t, LazyElevation> lazyElevations_ {};
 
-   std::map<rda::DataBlockType,
-            std::map<std::uint16_t, std::shared_ptr<rda::ElevationScan>>>
+   std::map<rda::DataBlockType, std::map<std::uint16_t, std::uint16_t>>
       index_ {};
 
-   std::list<std::stringstream> rawRecords_ {};
+   std::list<std::shared_ptr<const LdmRecord>> rawRecords_ {};
+
+   StreamState stream_ {};
 };
 
-Ar2vFile::Ar2vFile() : p(std::make_unique<Ar2vFileImpl>()) {}
+Ar2vFile::Ar2vFile(bool lazyLoad) :
+    p(std::make_unique<Ar2vFileImpl>(lazyLoad))
+{
+}
 Ar2vFile::~Ar2vFile() = default;
 
 Ar2vFile::Ar2vFile(Ar2vFile&&) noexcept            = default;
@@ -106,10 +203,33 @@ std::chrono::system_clock::time_point Ar2vFile::end_time() const
 {
    std::chrono::system_clock::time_point endTime {};
 
-   if (p->radarData_.size() > 0)
+   // Find the last elevation containing radials, skipping any elevation left
+   // empty by an incomplete or invalid message
+   auto lazyIt = std::find_if(
+      p->lazyElevations_.crbegin(),
+      p->lazyElevations_.crend(),
+      [](const auto& elevation) { return !elevation.second.radials_.empty(); });
+   auto radarIt = std::find_if(p->radarData_.crbegin(),
+                               p->radarData_.crend(),
+                               [](const auto& elevation)
+                               {
+                                  return elevation.second != nullptr &&
+                                         !elevation.second->empty();
+                               });
+
+   if (lazyIt != p->lazyElevations_.crend() &&
+       (radarIt == p->radarData_.crend() || lazyIt->first > radarIt->first))
+   {
+      const RadialLocation& lastRadial =
+         lazyIt->second.radials_.crbegin()->second;
+
+      endTime = util::TimePoint(lastRadial.modifiedJulianDate_,
+                                lastRadial.collectionTime_);
+   }
+   else if (radarIt != p->radarData_.crend())
    {
       std::shared_ptr<rda::GenericRadarData> lastRadial =
-         p->radarData_.crbegin()->second->crbegin()->second;
+         radarIt->second->crbegin()->second;
 
       endTime = util::TimePoint(lastRadial->modified_julian_date(),
                                 lastRadial->collection_time());
@@ -121,7 +241,15 @@ std::chrono::system_clock::time_point Ar2vFile::end_time() const
 std::map<std::uint16_t, std::shared_ptr<rda::ElevationScan>>
 Ar2vFile::radar_data() const
 {
-   return p->radarData_;
+   std::map<std::uint16_t, std::shared_ptr<rda::ElevationScan>> radarData =
+      p->radarData_;
+
+   for (auto& lazyElevation : p->lazyElevations_)
+   {
+      radarData[lazyElevation.first] = p->GetElevation(lazyElevation.first);
+   }
+
+   return radarData;
 }
 
 std::shared_ptr<const rda::VolumeCoveragePatternData> Ar2vFile::vcp_data() const
@@ -175,12 +303,12 @@ Ar2vFile::GetElevationScan(rda::DataBlockType dataBlockType,
 
       if (lowerDelta < upperDelta)
       {
-         elevationScan = scans.at(lowerBound);
+         elevationScan = p->GetElevation(scans.at(lowerBound));
          elevationCut  = lowerBound / scaleFactor;
       }
       else
       {
-         elevationScan = scans.at(upperBound);
+         elevationScan = p->GetElevation(scans.at(upperBound));
          elevationCut  = upperBound / scaleFactor;
       }
    }
@@ -212,21 +340,147 @@ bool Ar2vFile::LoadData(std::istream& is)
 {
    logger_->debug("Loading Data");
 
+   bool dataValid = p->ReadVolumeHeader(is);
+
+   if (dataValid)
+   {
+      util::metrics::ScopedTimer decompressTimer {decompressTime_};
+      size_t decompressedRecords = p->DecompressLDMRecords(is);
+      decompressTimer.Stop();
+
+      util::metrics::ScopedTimer parseTimer {parseTime_};
+      if (decompressedRecords == 0)
+      {
+         // Uncompressed data is not retained, and cannot be lazy loaded
+         p->ParseLDMRecord(is, nullptr);
+      }
+      else
+      {
+         p->ParseLDMRecords();
+      }
+   }
+
+   util::metrics::ScopedTimer indexTimer {indexTime_};
+   p->IndexFile();
+
+   return dataValid;
+}
+
+bool Ar2vFile::LoadChunk(std::string_view data)
+{
+   StreamState& stream    = p->stream_;
+   bool         dataValid = true;
+
+   switch (stream.stage_)
+   {
+   case StreamState::Stage::VolumeHeader:
+      stream.buffer_.append(data);
+
+      if (stream.buffer_.size() >= kVolumeHeaderSize_)
+      {
+         LdmRecordStream is {stream.buffer_.data(), kVolumeHeaderSize_};
+
+         dataValid = p->ReadVolumeHeader(is);
+
+         if (dataValid)
+         {
+            stream.buffer_.erase(0, kVolumeHeaderSize_);
+            stream.stage_ = StreamState::Stage::LdmRecords;
+            p->SplitLDMRecords();
+         }
+      }
+      break;
+
+   case StreamState::Stage::LdmRecords:
+      stream.buffer_.append(data);
+      p->SplitLDMRecords();
+      break;
+
+   case StreamState::Stage::Uncompressed:
+      stream.buffer_.append(data);
+      break;
+
+   case StreamState::Stage::Complete:
+      break;
+   }
+
+   // Parse each record which has completed decompression, without waiting
+   while (!stream.pending_.empty() &&
+          stream.pending_.front().wait_for(std::chrono::seconds {0}) ==
+             std::future_status::ready)
+   {
+      p->ParsePendingRecord();
+   }
+
+   return dataValid;
+}
+
+bool Ar2vFile::FinishLoad()
+{
+   logger_->debug("Finishing Load");
+
+   StreamState& stream    = p->stream_;
+   bool         dataValid = true;
+
+   if (stream.stage_ == StreamState::Stage::VolumeHeader)
+   {
+      logger_->warn("Could not read Volume Header Record");
+      dataValid = false;
+   }
+   else if (stream.stage_ == StreamState::Stage::Uncompressed)
+   {
+      // Uncompressed data is not retained, and cannot be lazy loaded
+      LdmRecordStream is {stream.buffer_.data(), stream.buffer_.size()};
+      p->ParseLDMRecord(is, nullptr);
+   }
+   else if (!stream.buffer_.empty())
+   {
+      logger_->warn("Incomplete LDM record: {} bytes", stream.buffer_.size());
+   }
+
+   while (!stream.pending_.empty())
+   {
+      p->ParsePendingRecord();
+   }
+
+   logger_->debug("Loaded {} LDM Records", stream.recordCount_);
+
+   if (stream.threadPool_ != nullptr)
+   {
+      stream.threadPool_->join();
+      stream.threadPool_.reset();
+   }
+
+   stream.stage_ = StreamState::Stage::Complete;
+   stream.buffer_.clear();
+   stream.buffer_.shrink_to_fit();
+
+   if (dataValid)
+   {
+      util::metrics::ScopedTimer indexTimer {indexTime_};
+      p->IndexFile();
+   }
+
+   return dataValid;
+}
+
+bool Ar2vFileImpl::ReadVolumeHeader(std::istream& is)
+{
    bool dataValid = true;
 
    // Read Volume Header Record
-   p->tapeFilename_.resize(9, ' ');
-   p->extensionNumber_.resize(3, ' ');
-   p->icao_.resize(4, ' ');
+   tapeFilename_.resize(9, ' ');
+   extensionNumber_.resize(3, ' ');
+   icao_.resize(4, ' ');
 
-   is.read(&p->tapeFilename_[0], 9);
-   is.read(&p->extensionNumber_[0], 3);
-   is.read(reinterpret_cast<char*>(&p->julianDate_), 4);
-   is.read(reinterpret_cast<char*>(&p->milliseconds_), 4);
-   is.read(&p->icao_[0], 4);
+   is.read(&tapeFilename_[0], 9);
+   is.read(&extensionNumber_[0], 3);
+   is.read(reinterpret_cast<char*>(&julianDate_), 4);
+   is.read(reinterpret_cast<char*>(&milliseconds_), 4);
+   is.read(&icao_[0], 4);
 
-   p->julianDate_   = ntohl(p->julianDate_);
-   p->milliseconds_ = ntohl(p->milliseconds_);
+   julianDate_   = ntohl(julianDate_);
+   milliseconds_ = ntohl(milliseconds_);
 
    if (is.eof())
    {
@@ -235,31 +489,124 @@ bool Ar2vFile::LoadData(std::istream& is)
    }
 
    // Trim spaces and null characters from the end of the ICAO
-   boost::trim_right_if(p->icao_,
+   boost::trim_right_if(icao_,
                         [](char x) { return std::isspace(x) || x == '\0'; });
 
    if (dataValid)
    {
-      logger_->debug("Filename:  {}", p->tapeFilename_);
-      logger_->debug("Extension: {}", p->extensionNumber_);
-      logger_->debug("Date:      {}", p->julianDate_);
-      logger_->debug("Time:      {}", p->milliseconds_);
-      logger_->debug("ICAO:      {}", p->icao_);
+      logger_->debug("Filename:  {}", tapeFilename_);
+      logger_->debug("Extension: {}", extensionNumber_);
+      logger_->debug("Date:      {}", julianDate_);
+      logger_->debug("Time:      {}", milliseconds_);
+      logger_->debug("ICAO:      {}", icao_);
+   }
 
-      size_t decompressedRecords = p->DecompressLDMRecords(is);
-      if (decompressedRecords == 0)
+   return dataValid;
+}
+
+void Ar2vFileImpl::SplitLDMRecords()
+{
+   std::string& buffer = stream_.buffer_;
+   std::size_t  offset = 0;
+
+   while (stream_.stage_ == StreamState::Stage::LdmRecords &&
+          buffer.size() - offset >= kControlWordSize_)
+   {
+      std::int32_t controlWord = 0;
+      std::memcpy(&controlWord, buffer.data() + offset, kControlWordSize_);
+
+      controlWord = ntohl(controlWord);
+      std::size_t recordSize = std::abs(controlWord);
+
+      if (recordSize == 0)
       {
-         p->ParseLDMRecord(is);
+         if (stream_.recordCount_ == 0)
+         {
+            // The remaining data is not compressed, and is parsed when loading
+            // is finished
+            stream_.stage_ = StreamState::Stage::Uncompressed;
+         }
+         else
+         {
+            stream_.stage_ = StreamState::Stage::Complete;
+            offset         = buffer.size();
+         }
+         break;
       }
-      else
+
+      if (buffer.size() - offset - kControlWordSize_ < recordSize)
       {
-         p->ParseLDMRecords();
+         // Wait for the remainder of the record
+         break;
       }
+
+      logger_->trace("LDM Record Found: Size = {} bytes", recordSize);
+
+      // Limit the number of records pending decompression
+      while (stream_.pending_.size() >= kMaxPendingRecords_)
+      {
+         ParsePendingRecord();
+      }
+
+      if (stream_.threadPool_ == nullptr)
+      {
+         stream_.threadPool_ =
+            std::make_unique<boost::asio::thread_pool>(kMaxPendingRecords_);
+      }
+
+      auto task = std::make_shared<
+         std::packaged_task<std::shared_ptr<const LdmRecord>()>>(
+         [compressed = buffer.substr(offset + kControlWordSize_, recordSize),
+          recordNumber = stream_.recordCount_]()
+         { return DecompressLDMRecord(compressed, recordNumber); });
+
+      stream_.pending_.push_back(task->get_future());
+      boost::asio::post(*stream_.threadPool_, [task]() { (*task)(); });
+
+      ++stream_.recordCount_;
+      offset += kControlWordSize_ + recordSize;
    }
 
-   p->IndexFile();
+   buffer.erase(0, offset);
+}
 
-   return dataValid;
+void Ar2vFileImpl::ParsePendingRecord()
+{
+   std::shared_ptr<const LdmRecord> record = stream_.pending_.front().get();
+   stream_.pending_.pop_front();
+
+   if (record != nullptr)
+   {
+      LdmRecordStream ss {record->data(), record->size()};
+      ParseLDMRecord(ss, record);
+   }
+}
+
+std::shared_ptr<const LdmRecord>
+Ar2vFileImpl::DecompressLDMRecord(const std::string& compressed,
+                                  std::size_t        recordNumber)
+{
+   boost::iostreams::filtering_streambuf<boost::iostreams::input> in;
+   in.push(boost::iostreams::bzip2_decompressor());
+   in.push(boost::iostreams::array_source {compressed.data(),
+                                           compressed.size()});
+
+   try
+   {
+      auto            record = std::make_shared<LdmRecord>();
+      std::streamsize bytesCopied = boost::iostreams::copy(
+         in, boost::iostreams::back_inserter(*record));
+      logger_->trace("Decompressed record size = {} bytes", bytesCopied);
+
+      return record;
+   }
+   catch (const boost::iostreams::bzip2_error& ex)
+   {
+      logger_->warn(
+         "Error decompressing record {}: {}", recordNumber, ex.what());
+   }
+
+   return nullptr;
 }
 
 std::size_t Ar2vFileImpl::DecompressLDMRecords(std::istream& is)
@@ -294,11 +641,12 @@ std::size_t Ar2vFileImpl::DecompressLDMRecords(std::istream& is)
 
       try
       {
-         std::stringstream ss;
-         std::streamsize   bytesCopied = boost::iostreams::copy(in, ss);
+         auto            record = std::make_shared<LdmRecord>();
+         std::streamsize bytesCopied =
+            boost::iostreams::copy(in, boost::iostreams::back_inserter(*record));
          logger_->trace("Decompressed record size = {} bytes", bytesCopied);
 
-         rawRecords_.push_back(std::move(ss));
+         rawRecords_.push_back(std::move(record));
       }
       catch (const boost::iostreams::bzip2_error& ex)
       {
@@ -325,17 +673,20 @@ void Ar2vFileImpl::ParseLDMRecords()
 
    for (auto it = rawRecords_.begin(); it != rawRecords_.end(); it++)
    {
-      std::stringstream& ss = *it;
+      const std::shared_ptr<const LdmRecord>& record = *it;
+      LdmRecordStream ss {record->data(), record->size()};
 
       logger_->trace("Record {}", count++);
 
-      ParseLDMRecord(ss);
+      ParseLDMRecord(ss, record);
    }
 
+   // If lazy loading, records remain referenced by each unparsed elevation
    rawRecords_.clear();
 }
 
-void Ar2vFileImpl::ParseLDMRecord(std::istream& is)
+void Ar2vFileImpl::ParseLDMRecord(
+   std::istream& is, const std::shared_ptr<const LdmRecord>& record)
 {
    static constexpr std::size_t kDefaultSegmentSize = 2432;
    static constexpr std::size_t kCtmHeaderSize      = 12;
@@ -382,13 +733,26 @@ void Ar2vFileImpl::ParseLDMRecord(std::istream& is)
             }
          }
 
-         // Parse the current message
-         rda::Level2MessageInfo msgInfo =
-            rda::Level2MessageFactory::Create(is, ctx);
-
-         if (msgInfo.messageValid)
+         if (lazyLoad_ && record != nullptr &&
+             messageType == static_cast<std::uint8_t>(
+                               rda::MessageId::DigitalRadarDataGeneric))
+         {
+            // Defer parsing radial data until the elevation is requested
+            if (ScanRadarData(is, record, messageStart))
+            {
+               ++messageCount_;
+            }
+         }
+         else
          {
-            HandleMessage(msgInfo.message);
+            // Parse the current message
+            rda::Level2MessageInfo msgInfo =
+               rda::Level2MessageFactory::Create(is, ctx);
+
+            if (msgInfo.messageValid)
+            {
+               HandleMessage(msgInfo.message);
+            }
          }
       }
 
@@ -398,6 +762,175 @@ void Ar2vFileImpl::ParseLDMRecord(std::istream& is)
    }
 }
 
+bool Ar2vFileImpl::ScanRadarData(std::istream&                           is,
+                                 const std::shared_ptr<const LdmRecord>& record,
+                                 std::streampos messageStart)
+{
+   static constexpr std::uint16_t kMaxDataBlocks = 10;
+
+   std::uint32_t collectionTime     = 0;
+   std::uint16_t modifiedJulianDate = 0;
+   std::uint16_t azimuthNumber      = 0;
+   std::uint8_t  compressionIndicator {0};
+   std::uint8_t  elevationNumber {0};
+   std::uint16_t dataBlockCount = 0;
+
+   std::array<std::uint32_t, kMaxDataBlocks> dataBlockPointer {0};
+
+   // Read only the fields of the Message Type 31 header required to index the
+   // radial, skipping the Level 2 message header
+   std::streampos radialStart =
+      messageStart +
+      static_cast<std::streamoff>(rda::Level2MessageHeader::SIZE);
+
+   is.seekg(radialStart + std::streamoff(4), std::ios_base::beg);
+   is.read(reinterpret_cast<char*>(&collectionTime), 4);       // 4-7
+   is.read(reinterpret_cast<char*>(&modifiedJulianDate), 2);   // 8-9
+   is.read(reinterpret_cast<char*>(&azimuthNumber), 2);        // 10-11
+   is.seekg(4, std::ios_base::cur);                            // 12-15
+   is.read(reinterpret_cast<char*>(&compressionIndicator), 1); // 16
+   is.seekg(5, std::ios_base::cur);                            // 17-21
+   is.read(reinterpret_cast<char*>(&elevationNumber), 1);      // 22
+   is.seekg(7, std::ios_base::cur);                            // 23-29
+   is.read(reinterpret_cast<char*>(&dataBlockCount), 2);       // 30-31
+
+   collectionTime     = ntohl(collectionTime);
+   modifiedJulianDate = ntohs(modifiedJulianDate);
+   azimuthNumber      = ntohs(azimuthNumber);
+   dataBlockCount     = ntohs(dataBlockCount);
+
+   if (is.fail() || azimuthNumber < 1 || azimuthNumber > 720 ||
+       elevationNumber < 1 || elevationNumber > 32 || dataBlockCount < 4 ||
+       dataBlockCount > kMaxDataBlocks || compressionIndicator != 0)
+   {
+      // Let the full parser report the error if the elevation is requested
+      logger_->trace("Invalid radial header, skipping");
+      is.clear();
+      return false;
+   }
+
+   is.read(reinterpret_cast<char*>(dataBlockPointer.data()),
+           dataBlockCount * 4);
+
+   std::uint16_t azimuthIndex   = azimuthNumber - 1;
+   std::uint16_t elevationIndex = elevationNumber - 1;
+
+   std::vector<rda::DataBlockType> radial0DataBlocks {};
+
+   if (azimuthIndex == 0)
+   {
+      // Record the moment data blocks present in the first radial for indexing
+      for (std::uint16_t b = 0; b < dataBlockCount; ++b)
+      {
+         std::string dataName(3, 0);
+
+         is.seekg(radialStart + std::streamoff(ntohl(dataBlockPointer[b]) + 1),
+                  std::ios_base::beg);
+         is.read(&dataName[0], 3);
+
+         rda::DataBlockType dataBlockType =
+            rda::DigitalRadarDataGeneric::GetDataBlockType(dataName);
+
+         if (dataBlockType >= rda::DataBlockType::MomentRef &&
+             dataBlockType <= rda::DataBlockType::MomentCfp)
+         {
+            radial0DataBlocks.push_back(dataBlockType);
+         }
+      }
+   }
+
+   if (is.fail())
+   {
+      // Do not create the elevation until a radial has been read successfully
+      logger_->trace("Truncated radial, skipping");
+      is.clear();
+      return false;
+   }
+
+   LazyElevation& lazyElevation = lazyElevations_[elevationIndex];
+
+   if (azimuthIndex == 0)
+   {
+      lazyElevation.radial0DataBlocks_ = std::move(radial0DataBlocks);
+   }
+
+   lazyElevation.radials_[azimuthIndex] = {
+      record, messageStart, collectionTime, modifiedJulianDate};
+
+   return true;
+}
+
+std::shared_ptr<rda::ElevationScan>
+Ar2vFileImpl::GetElevation(std::uint16_t elevationIndex)
+{
+   std::shared_ptr<rda::ElevationScan> elevationScan = nullptr;
+
+   auto lazyIt = lazyElevations_.find(elevationIndex);
+   if (lazyIt != lazyElevations_.end())
+   {
+      elevationScan = ParseElevation(lazyIt->second, messageCount_);
+   }
+   else
+   {
+      auto it = radarData_.find(elevationIndex);
+      if (it != radarData_.end())
+      {
+         elevationScan = it->second;
+      }
+   }
+
+   return elevationScan;
+}
+
+std::shared_ptr<rda::ElevationScan>
+Ar2vFileImpl::ParseElevation(LazyElevation&            lazyElevation,
+                             std::atomic<std::size_t>& messageCount)
+{
+   std::call_once(
+      lazyElevation.parseFlag_,
+      [&lazyElevation, &messageCount]()
+      {
+         logger_->debug("Parsing {} deferred radials",
+                        lazyElevation.radials_.size());
+
+         util::metrics::ScopedTimer timer {parseElevationTime_};
+
+         auto ctx           = rda::Level2MessageFactory::CreateContext();
+         auto elevationScan = std::make_shared<rda::ElevationScan>();
+
+         for (auto& radial : lazyElevation.radials_)
+         {
+            RadialLocation& location = radial.second;
+            LdmRecordStream is {location.record_->data(),
+                                location.record_->size()};
+
+            is.seekg(location.offset_, std::ios_base::beg);
+
+            rda::Level2MessageInfo msgInfo =
+               rda::Level2MessageFactory::Create(is, ctx);
+
+            if (msgInfo.messageValid)
+            {
+               (*elevationScan)[radial.first] =
+                  std::static_pointer_cast<rda::GenericRadarData>(
+                     msgInfo.message);
+            }
+            else
+            {
+               // The radial was counted when indexed
+               --messageCount;
+            }
+
+            // Release the reference to the decompressed record
+            location.record_.reset();
+         }
+
+         lazyElevation.elevationScan_ = std::move(elevationScan);
+      });
+
+   return lazyElevation.elevationScan_;
+}
+
 void Ar2vFileImpl::HandleMessage(std::shared_ptr<rda::Level2Message>& message)
 {
    ++messageCount_;
@@ -472,26 +1005,61 @@ void Ar2vFileImpl::IndexFile()
          return;
       }
 
+      std::vector<rda::DataBlockType> dataBlocks {};
+
       for (rda::DataBlockType dataBlockType :
            rda::MomentDataBlockTypeIterator())
       {
-         if (dataBlockType == rda::DataBlockType::MomentRef &&
-             waveformType ==
-                rda::WaveformType::ContiguousDopplerWithAmbiguityResolution)
+         if (radial0->moment_data_block(dataBlockType) != nullptr)
          {
-            // Reflectivity data is contained within both surveillance and
-            // doppler modes.  Surveillance mode produces a better image.
-            continue;
+            dataBlocks.push_back(dataBlockType);
          }
+      }
 
-         auto momentData = radial0->moment_data_block(dataBlockType);
+      IndexElevation(
+         elevationCut.first, dataBlocks, elevationAngle, waveformType);
+   }
 
-         if (momentData != nullptr)
-         {
-            // TODO: Handle multiple elevation scans
-            index_[dataBlockType][elevationAngle] = elevationCut.second;
-         }
+   for (auto& lazyElevation : lazyElevations_)
+   {
+      if (!lazyElevation.second.radials_.contains(0))
+      {
+         logger_->warn("Empty radial data");
+         continue;
       }
+
+      if (vcpData_ == nullptr)
+      {
+         logger_->warn("Cannot index file without VCP data");
+         return;
+      }
+
+      IndexElevation(lazyElevation.first,
+                     lazyElevation.second.radial0DataBlocks_,
+                     vcpData_->elevation_angle_raw(lazyElevation.first),
+                     vcpData_->waveform_type(lazyElevation.first));
+   }
+}
+
+void Ar2vFileImpl::IndexElevation(
+   std::uint16_t                          elevationIndex,
+   const std::vector<rda::DataBlockType>& dataBlocks,
+   std::uint16_t                          elevationAngle,
+   rda::WaveformType                      waveformType)
+{
+   for (rda::DataBlockType dataBlockType : dataBlocks)
+   {
+      if (dataBlockType == rda::DataBlockType::MomentRef &&
+          waveformType ==
+             rda::WaveformType::ContiguousDopplerWithAmbiguityResolution)
+      {
+         // Reflectivity data is contained within both surveillance and
+         // doppler modes.  Surveillance mode produces a better image.
+         continue;
+      }
+
+      // TODO: Handle multiple elevation scans
+      index_[dataBlockType][elevationAngle] = elevationIndex;
    }
 }
 
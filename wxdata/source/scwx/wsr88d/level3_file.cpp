@@ -2,6 +2,7 @@
 #include <scwx/wsr88d/rpg/ccb_header.hpp>
 #include <scwx/wsr88d/rpg/level3_message_factory.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/metrics.hpp>
 
 #include <fstream>
 #include <sstream>
@@ -37,6 +38,11 @@ namespace wsr88d
 static const std::string logPrefix_ = "scwx::wsr88d::level3_file";
 static const auto        logger_    = util::Logger::Create(logPrefix_);
 
+static auto& decompressTime_ = util::metrics::Registry::Instance().GetHistogram(
+   util::metrics::MetricName("decompress", "Level 3"));
+static auto& parseTime_ = util::metrics::Registry::Instance().GetHistogram(
+   util::metrics::MetricName("parse", "Level 3"));
+
 class Level3FileImpl
 {
 public:
@@ -110,15 +116,19 @@ bool Level3File::LoadData(std::istream& is)
       {
          std::stringstream ss;
 
+         util::metrics::ScopedTimer decompressTimer {decompressTime_};
          dataValid = p->DecompressFile(is, ss);
+         decompressTimer.Stop();
 
          if (dataValid)
          {
+            util::metrics::ScopedTimer parseTimer {parseTime_};
             dataValid = p->LoadFileData(ss);
          }
       }
       else
       {
+         util::metrics::ScopedTimer parseTimer {parseTime_};
          dataValid = p->LoadFileData(is);
       }
    }
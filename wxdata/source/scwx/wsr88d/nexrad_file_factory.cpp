@@ -116,7 +116,7 @@ std::shared_ptr<NexradFile> NexradFileFactory::Create(std::istream& is)
    {
       if (buffer.starts_with("AR2V") || buffer.starts_with("ARCHIVE2"))
       {
-         message = std::make_shared<Ar2vFile>();
+         message = std::make_shared<Ar2vFile>(true);
       }
       else
       {
@@ -0,0 +1,101 @@
+#include <scwx/wsr88d/nexrad_file_loader.hpp>
+#include <scwx/wsr88d/ar2v_file.hpp>
+#include <scwx/wsr88d/nexrad_file_factory.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <sstream>
+
+namespace scwx
+{
+namespace wsr88d
+{
+
+static const std::string logPrefix_ = "scwx::wsr88d::nexrad_file_loader";
+static const auto        logger_    = util::Logger::Create(logPrefix_);
+
+// Number of bytes required to identify the file format
+static constexpr std::size_t kSignatureSize_ = 8;
+
+class NexradFileLoader::Impl
+{
+public:
+   explicit Impl() = default;
+   ~Impl()         = default;
+
+   std::string               buffer_ {};
+   std::shared_ptr<Ar2vFile> ar2vFile_ {nullptr};
+   bool                      buffered_ {false};
+   bool                      dataValid_ {true};
+};
+
+NexradFileLoader::NexradFileLoader() : p(std::make_unique<Impl>()) {}
+NexradFileLoader::~NexradFileLoader() = default;
+
+NexradFileLoader::NexradFileLoader(NexradFileLoader&&) noexcept = default;
+NexradFileLoader&
+NexradFileLoader::operator=(NexradFileLoader&&) noexcept = default;
+
+bool NexradFileLoader::Write(std::string_view data)
+{
+   if (!p->dataValid_)
+   {
+      return false;
+   }
+
+   if (p->ar2vFile_ != nullptr)
+   {
+      p->dataValid_ = p->ar2vFile_->LoadChunk(data);
+      return p->dataValid_;
+   }
+
+   p->buffer_.append(data);
+
+   if (!p->buffered_ && p->buffer_.size() >= kSignatureSize_)
+   {
+      if (p->buffer_.starts_with("AR2V") || p->buffer_.starts_with("ARCHIVE2"))
+      {
+         logger_->trace("Loading Archive II data as received");
+
+         p->ar2vFile_  = std::make_shared<Ar2vFile>(true);
+         p->dataValid_ = p->ar2vFile_->LoadChunk(p->buffer_);
+
+         p->buffer_.clear();
+         p->buffer_.shrink_to_fit();
+      }
+      else
+      {
+         // Compressed or Level 3 data is loaded when complete
+         p->buffered_ = true;
+      }
+   }
+
+   return p->dataValid_;
+}
+
+std::shared_ptr<NexradFile> NexradFileLoader::Finish()
+{
+   std::shared_ptr<NexradFile> nexradFile = nullptr;
+
+   if (p->ar2vFile_ != nullptr)
+   {
+      // Pending records are always completed, even if the data was invalid
+      if (p->ar2vFile_->FinishLoad() && p->dataValid_)
+      {
+         nexradFile = p->ar2vFile_;
+      }
+   }
+   else if (p->dataValid_)
+   {
+      std::istringstream is {std::move(p->buffer_)};
+      nexradFile = NexradFileFactory::Create(is);
+   }
+
+   p->ar2vFile_.reset();
+   p->buffer_.clear();
+   p->dataValid_ = false;
+
+   return nexradFile;
+}
+
+} // namespace wsr88d
+} // namespace scwx
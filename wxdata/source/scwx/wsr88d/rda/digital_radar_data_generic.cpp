@@ -1,5 +1,6 @@
 #include <scwx/wsr88d/rda/digital_radar_data_generic.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/record_layout.hpp>
 
 namespace scwx
 {
@@ -177,25 +178,21 @@ bool DigitalRadarDataGeneric::MomentDataBlock::Parse(std::istream& is)
 {
    bool dataBlockValid = true;
 
-   is.seekg(4, std::ios_base::cur);                                   // 4-7
-   is.read(reinterpret_cast<char*>(&p->numberOfDataMomentGates_), 2); // 8-9
-   is.read(reinterpret_cast<char*>(&p->dataMomentRange_), 2);         // 10-11
-   is.read(reinterpret_cast<char*>(&p->dataMomentRangeSampleInterval_),
-           2);                                             // 12-13
-   is.read(reinterpret_cast<char*>(&p->tover_), 2);        // 14-15
-   is.read(reinterpret_cast<char*>(&p->snrThreshold_), 2); // 16-17
-   is.read(reinterpret_cast<char*>(&p->controlFlags_), 1); // 18
-   is.read(reinterpret_cast<char*>(&p->dataWordSize_), 1); // 19
-   is.read(reinterpret_cast<char*>(&p->scale_), 4);        // 20-23
-   is.read(reinterpret_cast<char*>(&p->offset_), 4);       // 24-27
-
-   p->numberOfDataMomentGates_       = ntohs(p->numberOfDataMomentGates_);
-   p->dataMomentRange_               = ntohs(p->dataMomentRange_);
-   p->dataMomentRangeSampleInterval_ = ntohs(p->dataMomentRangeSampleInterval_);
-   p->tover_                         = ntohs(p->tover_);
-   p->snrThreshold_                  = ntohs(p->snrThreshold_);
-   p->scale_                         = awips::Message::SwapFloat(p->scale_);
-   p->offset_                        = awips::Message::SwapFloat(p->offset_);
+   using util::Field;
+
+   using Layout = util::RecordLayout<
+      24,
+      Field<&Impl::numberOfDataMomentGates_, 4>,       // 8-9
+      Field<&Impl::dataMomentRange_, 6>,               // 10-11
+      Field<&Impl::dataMomentRangeSampleInterval_, 8>, // 12-13
+      Field<&Impl::tover_, 10>,                        // 14-15
+      Field<&Impl::snrThreshold_, 12>,                 // 16-17
+      Field<&Impl::controlFlags_, 14>,                 // 18
+      Field<&Impl::dataWordSize_, 15>,                 // 19
+      Field<&Impl::scale_, 16>,                        // 20-23
+      Field<&Impl::offset_, 20>>;                      // 24-27
+
+   Layout::Read(is, *p); // 4-27
 
    if (p->numberOfDataMomentGates_ <= 1840)
    {
@@ -210,7 +207,7 @@ bool DigitalRadarDataGeneric::MomentDataBlock::Parse(std::istream& is)
          p->momentGates16_.resize(p->numberOfDataMomentGates_);
          is.read(reinterpret_cast<char*>(p->momentGates16_.data()),
                  p->numberOfDataMomentGates_ * 2);
-         awips::Message::SwapVector(p->momentGates16_);
+         util::BigEndianToNative(std::span {p->momentGates16_});
       }
       else
       {
@@ -299,38 +296,26 @@ bool DigitalRadarDataGeneric::VolumeDataBlock::Parse(std::istream& is)
 {
    bool dataBlockValid = true;
 
-   is.read(reinterpret_cast<char*>(&p->lrtup_), 2);               // 4-5
-   is.read(reinterpret_cast<char*>(&p->versionNumberMajor_), 1);  // 6
-   is.read(reinterpret_cast<char*>(&p->versionNumberMinor_), 1);  // 7
-   is.read(reinterpret_cast<char*>(&p->latitude_), 4);            // 8-11
-   is.read(reinterpret_cast<char*>(&p->longitude_), 4);           // 12-15
-   is.read(reinterpret_cast<char*>(&p->siteHeight_), 2);          // 16-17
-   is.read(reinterpret_cast<char*>(&p->feedhornHeight_), 2);      // 18-19
-   is.read(reinterpret_cast<char*>(&p->calibrationConstant_), 4); // 20-23
-   is.read(reinterpret_cast<char*>(&p->horizontaShvTxPower_), 4); // 24-27
-   is.read(reinterpret_cast<char*>(&p->verticalShvTxPower_), 4);  // 28-31
-   is.read(reinterpret_cast<char*>(&p->systemDifferentialReflectivity_),
-           4); // 32-35
-   is.read(reinterpret_cast<char*>(&p->initialSystemDifferentialPhase_),
-           4); // 36-39
-   is.read(reinterpret_cast<char*>(&p->volumeCoveragePatternNumber_),
-           2);                                                 // 40-41
-   is.read(reinterpret_cast<char*>(&p->processingStatus_), 2); // 42-43
-
-   p->lrtup_               = ntohs(p->lrtup_);
-   p->latitude_            = awips::Message::SwapFloat(p->latitude_);
-   p->longitude_           = awips::Message::SwapFloat(p->longitude_);
-   p->siteHeight_          = ntohs(p->siteHeight_);
-   p->feedhornHeight_      = ntohs(p->feedhornHeight_);
-   p->calibrationConstant_ = awips::Message::SwapFloat(p->calibrationConstant_);
-   p->horizontaShvTxPower_ = awips::Message::SwapFloat(p->horizontaShvTxPower_);
-   p->verticalShvTxPower_  = awips::Message::SwapFloat(p->verticalShvTxPower_);
-   p->systemDifferentialReflectivity_ =
-      awips::Message::SwapFloat(p->systemDifferentialReflectivity_);
-   p->initialSystemDifferentialPhase_ =
-      awips::Message::SwapFloat(p->initialSystemDifferentialPhase_);
-   p->volumeCoveragePatternNumber_ = ntohs(p->volumeCoveragePatternNumber_);
-   p->processingStatus_            = ntohs(p->processingStatus_);
+   using util::Field;
+
+   using Layout = util::RecordLayout<
+      40,
+      Field<&Impl::lrtup_, 0>,                           // 4-5
+      Field<&Impl::versionNumberMajor_, 2>,              // 6
+      Field<&Impl::versionNumberMinor_, 3>,              // 7
+      Field<&Impl::latitude_, 4>,                        // 8-11
+      Field<&Impl::longitude_, 8>,                       // 12-15
+      Field<&Impl::siteHeight_, 12>,                     // 16-17
+      Field<&Impl::feedhornHeight_, 14>,                 // 18-19
+      Field<&Impl::calibrationConstant_, 16>,            // 20-23
+      Field<&Impl::horizontaShvTxPower_, 20>,            // 24-27
+      Field<&Impl::verticalShvTxPower_, 24>,             // 28-31
+      Field<&Impl::systemDifferentialReflectivity_, 28>, // 32-35
+      Field<&Impl::initialSystemDifferentialPhase_, 32>, // 36-39
+      Field<&Impl::volumeCoveragePatternNumber_, 36>,    // 40-41
+      Field<&Impl::processingStatus_, 38>>;              // 42-43
+
+   Layout::Read(is, *p);
 
    return dataBlockValid;
 }
@@ -379,13 +364,15 @@ bool DigitalRadarDataGeneric::ElevationDataBlock::Parse(std::istream& is)
 {
    bool dataBlockValid = true;
 
-   is.read(reinterpret_cast<char*>(&p->lrtup_), 2);               // 4-5
-   is.read(reinterpret_cast<char*>(&p->atmos_), 2);               // 6-7
-   is.read(reinterpret_cast<char*>(&p->calibrationConstant_), 4); // 8-11
+   using util::Field;
 
-   p->lrtup_               = ntohs(p->lrtup_);
-   p->atmos_               = ntohs(p->atmos_);
-   p->calibrationConstant_ = awips::Message::SwapFloat(p->calibrationConstant_);
+   using Layout =
+      util::RecordLayout<8,
+                         Field<&Impl::lrtup_, 0>,                // 4-5
+                         Field<&Impl::atmos_, 2>,                // 6-7
+                         Field<&Impl::calibrationConstant_, 4>>; // 8-11
+
+   Layout::Read(is, *p);
 
    return dataBlockValid;
 }
@@ -444,28 +431,20 @@ bool DigitalRadarDataGeneric::RadialDataBlock::Parse(std::istream& is)
 {
    bool dataBlockValid = true;
 
-   is.read(reinterpret_cast<char*>(&p->lrtup_), 2);                // 4-5
-   is.read(reinterpret_cast<char*>(&p->unambigiousRange_), 2);     // 6-7
-   is.read(reinterpret_cast<char*>(&p->noiseLevelHorizontal_), 4); // 8-11
-   is.read(reinterpret_cast<char*>(&p->noiseLevelVertical_), 4);   // 12-15
-   is.read(reinterpret_cast<char*>(&p->nyquistVelocity_), 2);      // 16-17
-   is.read(reinterpret_cast<char*>(&p->radialFlags_), 2);          // 18-19
-   is.read(reinterpret_cast<char*>(&p->calibrationConstantHorizontal_),
-           4); // 20-23
-   is.read(reinterpret_cast<char*>(&p->calibrationConstantVertical_),
-           4); // 24-27
-
-   p->lrtup_            = ntohs(p->lrtup_);
-   p->unambigiousRange_ = ntohs(p->unambigiousRange_);
-   p->noiseLevelHorizontal_ =
-      awips::Message::SwapFloat(p->noiseLevelHorizontal_);
-   p->noiseLevelVertical_ = awips::Message::SwapFloat(p->noiseLevelVertical_);
-   p->nyquistVelocity_    = ntohs(p->nyquistVelocity_);
-   p->radialFlags_        = ntohs(p->radialFlags_);
-   p->calibrationConstantHorizontal_ =
-      awips::Message::SwapFloat(p->calibrationConstantHorizontal_);
-   p->calibrationConstantVertical_ =
-      awips::Message::SwapFloat(p->calibrationConstantVertical_);
+   using util::Field;
+
+   using Layout = util::RecordLayout<
+      24,
+      Field<&Impl::lrtup_, 0>,                          // 4-5
+      Field<&Impl::unambigiousRange_, 2>,               // 6-7
+      Field<&Impl::noiseLevelHorizontal_, 4>,           // 8-11
+      Field<&Impl::noiseLevelVertical_, 8>,             // 12-15
+      Field<&Impl::nyquistVelocity_, 12>,               // 16-17
+      Field<&Impl::radialFlags_, 14>,                   // 18-19
+      Field<&Impl::calibrationConstantHorizontal_, 16>, // 20-23
+      Field<&Impl::calibrationConstantVertical_, 20>>;  // 24-27
+
+   Layout::Read(is, *p);
 
    return dataBlockValid;
 }
@@ -639,32 +618,28 @@ bool DigitalRadarDataGeneric::Parse(std::istream& is)
 
    std::streampos isBegin = is.tellg();
 
-   p->radarIdentifier_.resize(4);
-
-   is.read(&p->radarIdentifier_[0], 4);                                // 0-3
-   is.read(reinterpret_cast<char*>(&p->collectionTime_), 4);           // 4-7
-   is.read(reinterpret_cast<char*>(&p->modifiedJulianDate_), 2);       // 8-9
-   is.read(reinterpret_cast<char*>(&p->azimuthNumber_), 2);            // 10-11
-   is.read(reinterpret_cast<char*>(&p->azimuthAngle_), 4);             // 12-15
-   is.read(reinterpret_cast<char*>(&p->compressionIndicator_), 1);     // 16
-   is.seekg(1, std::ios_base::cur);                                    // 17
-   is.read(reinterpret_cast<char*>(&p->radialLength_), 2);             // 18-19
-   is.read(reinterpret_cast<char*>(&p->azimuthResolutionSpacing_), 1); // 20
-   is.read(reinterpret_cast<char*>(&p->radialStatus_), 1);             // 21
-   is.read(reinterpret_cast<char*>(&p->elevationNumber_), 1);          // 22
-   is.read(reinterpret_cast<char*>(&p->cutSectorNumber_), 1);          // 23
-   is.read(reinterpret_cast<char*>(&p->elevationAngle_), 4);           // 24-27
-   is.read(reinterpret_cast<char*>(&p->radialSpotBlankingStatus_), 1); // 28
-   is.read(reinterpret_cast<char*>(&p->azimuthIndexingMode_), 1);      // 29
-   is.read(reinterpret_cast<char*>(&p->dataBlockCount_), 2);           // 30-31
-
-   p->collectionTime_     = ntohl(p->collectionTime_);
-   p->modifiedJulianDate_ = ntohs(p->modifiedJulianDate_);
-   p->azimuthNumber_      = ntohs(p->azimuthNumber_);
-   p->azimuthAngle_       = SwapFloat(p->azimuthAngle_);
-   p->radialLength_       = ntohs(p->radialLength_);
-   p->elevationAngle_     = SwapFloat(p->elevationAngle_);
-   p->dataBlockCount_     = ntohs(p->dataBlockCount_);
+   using util::Field;
+   using util::FixedString;
+
+   using Layout = util::RecordLayout<
+      32,
+      Field<&Impl::radarIdentifier_, 0, FixedString<4>>, // 0-3
+      Field<&Impl::collectionTime_, 4>,                  // 4-7
+      Field<&Impl::modifiedJulianDate_, 8>,              // 8-9
+      Field<&Impl::azimuthNumber_, 10>,                  // 10-11
+      Field<&Impl::azimuthAngle_, 12>,                   // 12-15
+      Field<&Impl::compressionIndicator_, 16>,           // 16
+      Field<&Impl::radialLength_, 18>,                   // 18-19
+      Field<&Impl::azimuthResolutionSpacing_, 20>,       // 20
+      Field<&Impl::radialStatus_, 21>,                   // 21
+      Field<&Impl::elevationNumber_, 22>,                // 22
+      Field<&Impl::cutSectorNumber_, 23>,                // 23
+      Field<&Impl::elevationAngle_, 24>,                 // 24-27
+      Field<&Impl::radialSpotBlankingStatus_, 28>,       // 28
+      Field<&Impl::azimuthIndexingMode_, 29>,            // 29
+      Field<&Impl::dataBlockCount_, 30>>;                // 30-31
+
+   Layout::Read(is, *p);
 
    if (p->azimuthNumber_ < 1 || p->azimuthNumber_ > 720)
    {
@@ -695,27 +670,21 @@ bool DigitalRadarDataGeneric::Parse(std::istream& is)
    is.read(reinterpret_cast<char*>(&p->dataBlockPointer_),
            p->dataBlockCount_ * 4);
 
-   SwapArray(p->dataBlockPointer_, p->dataBlockCount_);
+   util::BigEndianToNative(
+      std::span {p->dataBlockPointer_.data(), p->dataBlockCount_});
 
    for (uint16_t b = 0; b < p->dataBlockCount_; ++b)
    {
       is.seekg(isBegin + std::streamoff(p->dataBlockPointer_[b]),
                std::ios_base::beg);
 
-      std::string dataBlockType(1, 0);
-      std::string dataName(3, 0);
+      std::array<char, 4> blockHeader {};
+      is.read(blockHeader.data(), blockHeader.size());
 
-      is.read(&dataBlockType[0], 1);
-      is.read(&dataName[0], 3);
+      std::string dataBlockType(blockHeader.data(), 1);
+      std::string dataName(blockHeader.data() + 1, 3);
 
-      DataBlockType dataBlock = DataBlockType::Unknown;
-      try
-      {
-         dataBlock = strToDataBlock_.at(dataName);
-      }
-      catch (const std::exception&)
-      {
-      }
+      DataBlockType dataBlock = GetDataBlockType(dataName);
 
       switch (dataBlock)
       {
@@ -771,6 +740,20 @@ DigitalRadarDataGeneric::Create(Level2MessageHeader&& header, std::istream& is)
    return message;
 }
 
+DataBlockType
+DigitalRadarDataGeneric::GetDataBlockType(const std::string& dataName)
+{
+   DataBlockType dataBlock = DataBlockType::Unknown;
+
+   auto it = strToDataBlock_.find(dataName);
+   if (it != strToDataBlock_.cend())
+   {
+      dataBlock = it->second;
+   }
+
+   return dataBlock;
+}
+
 } // namespace rda
 } // namespace wsr88d
 } // namespace scwx
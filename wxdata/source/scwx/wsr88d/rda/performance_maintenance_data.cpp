@@ -1,5 +1,6 @@
 #include <scwx/wsr88d/rda/performance_maintenance_data.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/record_layout.hpp>
 
 #include <array>
 
@@ -1828,636 +1829,289 @@ bool PerformanceMaintenanceData::Parse(std::istream& is)
    bool   messageValid = true;
    size_t bytesRead    = 0;
 
-   p->rcpString_.resize(16);
-
-   // Communications
-   is.seekg(2, std::ios_base::cur);                                   // 1
-   is.read(reinterpret_cast<char*>(&p->loopBackSetStatus_), 2);       // 2
-   is.read(reinterpret_cast<char*>(&p->t1OutputFrames_), 4);          // 3-4
-   is.read(reinterpret_cast<char*>(&p->t1InputFrames_), 4);           // 5-6
-   is.read(reinterpret_cast<char*>(&p->routerMemoryUsed_), 4);        // 7-8
-   is.read(reinterpret_cast<char*>(&p->routerMemoryFree_), 4);        // 9-10
-   is.read(reinterpret_cast<char*>(&p->routerMemoryUtilization_), 2); // 11
-   is.read(reinterpret_cast<char*>(&p->routeToRpg_), 2);              // 12
-   is.read(reinterpret_cast<char*>(&p->csuLossOfSignal_), 4);         // 13-14
-   is.read(reinterpret_cast<char*>(&p->csuLossOfFrames_), 4);         // 15-16
-   is.read(reinterpret_cast<char*>(&p->csuYellowAlarms_), 4);         // 17-18
-   is.read(reinterpret_cast<char*>(&p->csuBlueAlarms_), 4);           // 19-20
-   is.read(reinterpret_cast<char*>(&p->csu24HrErroredSeconds_), 4);   // 21-22
-   is.read(reinterpret_cast<char*>(&p->csu24HrSeverelyErroredSeconds_),
-           4); // 23-24
-   is.read(reinterpret_cast<char*>(&p->csu24HrSeverelyErroredFramingSeconds_),
-           4);                                                          // 25-26
-   is.read(reinterpret_cast<char*>(&p->csu24HrUnavailableSeconds_), 4); // 27-28
-   is.read(reinterpret_cast<char*>(&p->csu24HrControlledSlipSeconds_),
-           4); // 29-30
-   is.read(reinterpret_cast<char*>(&p->csu24HrPathCodingViolations_),
-           4);                                                          // 31-32
-   is.read(reinterpret_cast<char*>(&p->csu24HrLineErroredSeconds_), 4); // 33-34
-   is.read(reinterpret_cast<char*>(&p->csu24HrBurstyErroredSeconds_),
-           4);                                                        // 35-36
-   is.read(reinterpret_cast<char*>(&p->csu24HrDegradedMinutes_), 4);  // 37-38
-   is.seekg(4, std::ios_base::cur);                                   // 39-40
-   is.read(reinterpret_cast<char*>(&p->lanSwitchCpuUtilization_), 4); // 41-42
-   is.read(reinterpret_cast<char*>(&p->lanSwitchMemoryUtilization_), 2); // 43
-   is.seekg(2, std::ios_base::cur);                                      // 44
-   is.read(reinterpret_cast<char*>(&p->ifdrChasisTemperature_), 2);      // 45
-   is.read(reinterpret_cast<char*>(&p->ifdrFpgaTemperature_), 2);        // 46
-   is.seekg(4, std::ios_base::cur);                                   // 47-48
-   is.read(reinterpret_cast<char*>(&p->gpsSatellites_), 4);           // 49-50
-   is.seekg(4, std::ios_base::cur);                                   // 51-52
-   is.read(reinterpret_cast<char*>(&p->ipcStatus_), 2);               // 53
-   is.read(reinterpret_cast<char*>(&p->commandedChannelControl_), 2); // 54
-   is.seekg(6, std::ios_base::cur);                                   // 55-57
-
-   // AME
-   is.read(reinterpret_cast<char*>(&p->polarization_), 2);           // 58
-   is.read(reinterpret_cast<char*>(&p->ameInternalTemperature_), 4); // 59-60
-   is.read(reinterpret_cast<char*>(&p->ameReceiverModuleTemperature_),
-           4); // 61-62
-   is.read(reinterpret_cast<char*>(&p->ameBiteCalModuleTemperature_),
-           4); // 63-64
-   is.read(reinterpret_cast<char*>(&p->amePeltierPulseWidthModulation_),
-           2);                                                     // 65
-   is.read(reinterpret_cast<char*>(&p->amePeltierStatus_), 2);     // 66
-   is.read(reinterpret_cast<char*>(&p->ameADConverterStatus_), 2); // 67
-   is.read(reinterpret_cast<char*>(&p->ameState_), 2);             // 68
-   is.read(reinterpret_cast<char*>(&p->ame3_3VPsVoltage_), 4);     // 69-70
-   is.read(reinterpret_cast<char*>(&p->ame5VPsVoltage_), 4);       // 71-72
-   is.read(reinterpret_cast<char*>(&p->ame6_5VPsVoltage_), 4);     // 73-74
-   is.read(reinterpret_cast<char*>(&p->ame15VPsVoltage_), 4);      // 75-76
-   is.read(reinterpret_cast<char*>(&p->ame48VPsVoltage_), 4);      // 77-78
-   is.read(reinterpret_cast<char*>(&p->ameStaloPower_), 4);        // 79-80
-   is.read(reinterpret_cast<char*>(&p->peltierCurrent_), 4);       // 81-82
-   is.read(reinterpret_cast<char*>(&p->adcCalibrationReferenceVoltage_),
-           4);                                               // 83-84
-   is.read(reinterpret_cast<char*>(&p->ameMode_), 2);        // 85
-   is.read(reinterpret_cast<char*>(&p->amePeltierMode_), 2); // 86
-   is.read(reinterpret_cast<char*>(&p->amePeltierInsideFanCurrent_),
-           4); // 87-88
-   is.read(reinterpret_cast<char*>(&p->amePeltierOutsideFanCurrent_),
-           4); // 89-90
-   is.read(reinterpret_cast<char*>(&p->horizontalTrLimiterVoltage_),
-           4);                                                         // 91-92
-   is.read(reinterpret_cast<char*>(&p->verticalTrLimiterVoltage_), 4); // 93-94
-   is.read(reinterpret_cast<char*>(&p->adcCalibrationOffsetVoltage_),
-           4); // 95-96
-   is.read(reinterpret_cast<char*>(&p->adcCalibrationGainCorrection_),
-           4); // 97-98
-
-   // RCP/SPIP Power Button Status
-   is.read(reinterpret_cast<char*>(&p->rcpStatus_), 2);        // 99
-   is.read(&p->rcpString_[0], 16);                             // 100-107
-   is.read(reinterpret_cast<char*>(&p->spipPowerButtons_), 2); // 108
-   is.seekg(4, std::ios_base::cur);                            // 109-110
-
-   // Power
-   is.read(reinterpret_cast<char*>(&p->masterPowerAdministratorLoad_),
-           4); // 111-112
-   is.read(reinterpret_cast<char*>(&p->expansionPowerAdministratorLoad_),
-           4);                       // 113-114
-   is.seekg(44, std::ios_base::cur); // 115-136
-
-   // Transmitter
-   is.read(reinterpret_cast<char*>(&p->_5VdcPs_), 2);                    // 137
-   is.read(reinterpret_cast<char*>(&p->_15VdcPs_), 2);                   // 138
-   is.read(reinterpret_cast<char*>(&p->_28VdcPs_), 2);                   // 139
-   is.read(reinterpret_cast<char*>(&p->neg15VdcPs_), 2);                 // 140
-   is.read(reinterpret_cast<char*>(&p->_45VdcPs_), 2);                   // 141
-   is.read(reinterpret_cast<char*>(&p->filamentPsVoltage_), 2);          // 142
-   is.read(reinterpret_cast<char*>(&p->vacuumPumpPsVoltage_), 2);        // 143
-   is.read(reinterpret_cast<char*>(&p->focusCoilPsVoltage_), 2);         // 144
-   is.read(reinterpret_cast<char*>(&p->filamentPs_), 2);                 // 145
-   is.read(reinterpret_cast<char*>(&p->klystronWarmup_), 2);             // 146
-   is.read(reinterpret_cast<char*>(&p->transmitterAvailable_), 2);       // 147
-   is.read(reinterpret_cast<char*>(&p->wgSwitchPosition_), 2);           // 148
-   is.read(reinterpret_cast<char*>(&p->wgPfnTransferInterlock_), 2);     // 149
-   is.read(reinterpret_cast<char*>(&p->maintenanceMode_), 2);            // 150
-   is.read(reinterpret_cast<char*>(&p->maintenanceRequired_), 2);        // 151
-   is.read(reinterpret_cast<char*>(&p->pfnSwitchPosition_), 2);          // 152
-   is.read(reinterpret_cast<char*>(&p->modulatorOverload_), 2);          // 153
-   is.read(reinterpret_cast<char*>(&p->modulatorInvCurrent_), 2);        // 154
-   is.read(reinterpret_cast<char*>(&p->modulatorSwitchFail_), 2);        // 155
-   is.read(reinterpret_cast<char*>(&p->mainPowerVoltage_), 2);           // 156
-   is.read(reinterpret_cast<char*>(&p->chargingSystemFail_), 2);         // 157
-   is.read(reinterpret_cast<char*>(&p->inverseDiodeCurrent_), 2);        // 158
-   is.read(reinterpret_cast<char*>(&p->triggerAmplifier_), 2);           // 159
-   is.read(reinterpret_cast<char*>(&p->circulatorTemperature_), 2);      // 160
-   is.read(reinterpret_cast<char*>(&p->spectrumFilterPressure_), 2);     // 161
-   is.read(reinterpret_cast<char*>(&p->wgArcVswr_), 2);                  // 162
-   is.read(reinterpret_cast<char*>(&p->cabinetInterlock_), 2);           // 163
-   is.read(reinterpret_cast<char*>(&p->cabinetAirTemperature_), 2);      // 164
-   is.read(reinterpret_cast<char*>(&p->cabinetAirflow_), 2);             // 165
-   is.read(reinterpret_cast<char*>(&p->klystronCurrent_), 2);            // 166
-   is.read(reinterpret_cast<char*>(&p->klystronFilamentCurrent_), 2);    // 167
-   is.read(reinterpret_cast<char*>(&p->klystronVacionCurrent_), 2);      // 168
-   is.read(reinterpret_cast<char*>(&p->klystronAirTemperature_), 2);     // 169
-   is.read(reinterpret_cast<char*>(&p->klystronAirflow_), 2);            // 170
-   is.read(reinterpret_cast<char*>(&p->modulatorSwitchMaintenance_), 2); // 171
-   is.read(reinterpret_cast<char*>(&p->postChargeRegulatorMaintenance_),
-           2);                                                            // 172
-   is.read(reinterpret_cast<char*>(&p->wgPressureHumidity_), 2);          // 173
-   is.read(reinterpret_cast<char*>(&p->transmitterOvervoltage_), 2);      // 174
-   is.read(reinterpret_cast<char*>(&p->transmitterOvercurrent_), 2);      // 175
-   is.read(reinterpret_cast<char*>(&p->focusCoilCurrent_), 2);            // 176
-   is.read(reinterpret_cast<char*>(&p->focusCoilAirflow_), 2);            // 177
-   is.read(reinterpret_cast<char*>(&p->oilTemperature_), 2);              // 178
-   is.read(reinterpret_cast<char*>(&p->prfLimit_), 2);                    // 179
-   is.read(reinterpret_cast<char*>(&p->transmitterOilLevel_), 2);         // 180
-   is.read(reinterpret_cast<char*>(&p->transmitterBatteryCharging_), 2);  // 181
-   is.read(reinterpret_cast<char*>(&p->highVoltageStatus_), 2);           // 182
-   is.read(reinterpret_cast<char*>(&p->transmitterRecyclingSummary_), 2); // 183
-   is.read(reinterpret_cast<char*>(&p->transmitterInoperable_), 2);       // 184
-   is.read(reinterpret_cast<char*>(&p->transmitterAirFilter_), 2);        // 185
-   is.read(reinterpret_cast<char*>(&p->zeroTestBit_[0]),
-           p->zeroTestBit_.size() * 2); // 186-193
-   is.read(reinterpret_cast<char*>(&p->oneTestBit_[0]),
-           p->oneTestBit_.size() * 2);                          // 194-201
-   is.read(reinterpret_cast<char*>(&p->xmtrSpipInterface_), 2); // 202
-   is.read(reinterpret_cast<char*>(&p->transmitterSummaryStatus_), 2); // 203
-   is.seekg(2, std::ios_base::cur);                                    // 204
-   is.read(reinterpret_cast<char*>(&p->transmitterRfPower_), 4);      // 205-206
-   is.read(reinterpret_cast<char*>(&p->horizontalXmtrPeakPower_), 4); // 207-208
-   is.read(reinterpret_cast<char*>(&p->xmtrPeakPower_), 4);           // 209-210
-   is.read(reinterpret_cast<char*>(&p->verticalXmtrPeakPower_), 4);   // 211-212
-   is.read(reinterpret_cast<char*>(&p->xmtrRfAvgPower_), 4);          // 213-214
-   is.seekg(4, std::ios_base::cur);                                   // 215-216
-   is.read(reinterpret_cast<char*>(&p->xmtrRecycleCount_), 4);        // 217-218
-   is.read(reinterpret_cast<char*>(&p->receiverBias_), 4);            // 219-220
-   is.read(reinterpret_cast<char*>(&p->transmitImbalance_), 4);       // 221-222
-   is.read(reinterpret_cast<char*>(&p->xmtrPowerMeterZero_), 4);      // 223-224
-   is.seekg(8, std::ios_base::cur);                                   // 225-228
-
-   // Tower/Utilities
-   is.read(reinterpret_cast<char*>(&p->acUnit1CompressorShutOff_), 2); // 229
-   is.read(reinterpret_cast<char*>(&p->acUnit2CompressorShutOff_), 2); // 230
-   is.read(reinterpret_cast<char*>(&p->generatorMaintenanceRequired_),
-           2);                                                          // 231
-   is.read(reinterpret_cast<char*>(&p->generatorBatteryVoltage_), 2);   // 232
-   is.read(reinterpret_cast<char*>(&p->generatorEngine_), 2);           // 233
-   is.read(reinterpret_cast<char*>(&p->generatorVoltFrequency_), 2);    // 234
-   is.read(reinterpret_cast<char*>(&p->powerSource_), 2);               // 235
-   is.read(reinterpret_cast<char*>(&p->transitionalPowerSource_), 2);   // 236
-   is.read(reinterpret_cast<char*>(&p->generatorAutoRunOffSwitch_), 2); // 237
-   is.read(reinterpret_cast<char*>(&p->aircraftHazardLighting_), 2);    // 238
-   is.seekg(22, std::ios_base::cur); // 239-249
-
-   // Equipment Shelter
-   is.read(reinterpret_cast<char*>(&p->equipmentShelterFireDetectionSystem_),
-           2);                                                           // 250
-   is.read(reinterpret_cast<char*>(&p->equipmentShelterFireSmoke_), 2);  // 251
-   is.read(reinterpret_cast<char*>(&p->generatorShelterFireSmoke_), 2);  // 252
-   is.read(reinterpret_cast<char*>(&p->utilityVoltageFrequency_), 2);    // 253
-   is.read(reinterpret_cast<char*>(&p->siteSecurityAlarm_), 2);          // 254
-   is.read(reinterpret_cast<char*>(&p->securityEquipment_), 2);          // 255
-   is.read(reinterpret_cast<char*>(&p->securitySystem_), 2);             // 256
-   is.read(reinterpret_cast<char*>(&p->receiverConnectedToAntenna_), 2); // 257
-   is.read(reinterpret_cast<char*>(&p->radomeHatch_), 2);                // 258
-   is.read(reinterpret_cast<char*>(&p->acUnit1FilterDirty_), 2);         // 259
-   is.read(reinterpret_cast<char*>(&p->acUnit2FilterDirty_), 2);         // 260
-   is.read(reinterpret_cast<char*>(&p->equipmentShelterTemperature_),
-           4); // 261-262
-   is.read(reinterpret_cast<char*>(&p->outsideAmbientTemperature_),
-           4); // 263-264
-   is.read(reinterpret_cast<char*>(&p->transmitterLeavingAirTemp_),
-           4);                                                        // 265-266
-   is.read(reinterpret_cast<char*>(&p->acUnit1DischargeAirTemp_), 4); // 267-268
-   is.read(reinterpret_cast<char*>(&p->generatorShelterTemperature_),
-           4);                                                        // 269-270
-   is.read(reinterpret_cast<char*>(&p->radomeAirTemperature_), 4);    // 271-272
-   is.read(reinterpret_cast<char*>(&p->acUnit2DischargeAirTemp_), 4); // 273-274
-   is.read(reinterpret_cast<char*>(&p->spip15VPs_), 4);               // 275-276
-   is.read(reinterpret_cast<char*>(&p->spipNeg15VPs_), 4);            // 277-278
-   is.read(reinterpret_cast<char*>(&p->spip28VPsStatus_), 2);         // 279
-   is.seekg(2, std::ios_base::cur);                                   // 280
-   is.read(reinterpret_cast<char*>(&p->spip5VPs_), 4);                // 281-282
-   is.read(reinterpret_cast<char*>(&p->convertedGeneratorFuelLevel_), 2); // 283
-   is.seekg(32, std::ios_base::cur); // 284-299
-
-   // Antenna/Pedestal
-   is.read(reinterpret_cast<char*>(&p->elevationPosDeadLimit_), 2);    // 300
-   is.read(reinterpret_cast<char*>(&p->_150VOvervoltage_), 2);         // 301
-   is.read(reinterpret_cast<char*>(&p->_150VUndervoltage_), 2);        // 302
-   is.read(reinterpret_cast<char*>(&p->elevationServoAmpInhibit_), 2); // 303
-   is.read(reinterpret_cast<char*>(&p->elevationServoAmpShortCircuit_),
-           2);                                                            // 304
-   is.read(reinterpret_cast<char*>(&p->elevationServoAmpOvertemp_), 2);   // 305
-   is.read(reinterpret_cast<char*>(&p->elevationMotorOvertemp_), 2);      // 306
-   is.read(reinterpret_cast<char*>(&p->elevationStowPin_), 2);            // 307
-   is.read(reinterpret_cast<char*>(&p->elevationHousing5VPs_), 2);        // 308
-   is.read(reinterpret_cast<char*>(&p->elevationNegDeadLimit_), 2);       // 309
-   is.read(reinterpret_cast<char*>(&p->elevationPosNormalLimit_), 2);     // 310
-   is.read(reinterpret_cast<char*>(&p->elevationNegNormalLimit_), 2);     // 311
-   is.read(reinterpret_cast<char*>(&p->elevationEncoderLight_), 2);       // 312
-   is.read(reinterpret_cast<char*>(&p->elevationGearboxOil_), 2);         // 313
-   is.read(reinterpret_cast<char*>(&p->elevationHandwheel_), 2);          // 314
-   is.read(reinterpret_cast<char*>(&p->elevationAmpPs_), 2);              // 315
-   is.read(reinterpret_cast<char*>(&p->azimuthServoAmpInhibit_), 2);      // 316
-   is.read(reinterpret_cast<char*>(&p->azimuthServoAmpShortCircuit_), 2); // 317
-   is.read(reinterpret_cast<char*>(&p->azimuthServoAmpOvertemp_), 2);     // 318
-   is.read(reinterpret_cast<char*>(&p->azimuthMotorOvertemp_), 2);        // 319
-   is.read(reinterpret_cast<char*>(&p->azimuthStowPin_), 2);              // 320
-   is.read(reinterpret_cast<char*>(&p->azimuthHousing5VPs_), 2);          // 321
-   is.read(reinterpret_cast<char*>(&p->azimuthEncoderLight_), 2);         // 322
-   is.read(reinterpret_cast<char*>(&p->azimuthGearboxOil_), 2);           // 323
-   is.read(reinterpret_cast<char*>(&p->azimuthBullGearOil_), 2);          // 324
-   is.read(reinterpret_cast<char*>(&p->azimuthHandwheel_), 2);            // 325
-   is.read(reinterpret_cast<char*>(&p->azimuthServoAmpPs_), 2);           // 326
-   is.read(reinterpret_cast<char*>(&p->servo_), 2);                       // 327
-   is.read(reinterpret_cast<char*>(&p->pedestalInterlockSwitch_), 2);     // 328
-   is.seekg(24, std::ios_base::cur); // 329-340
-
-   // RF Generator/Receiver
-   is.read(reinterpret_cast<char*>(&p->cohoClock_), 2); // 341
-   is.read(reinterpret_cast<char*>(&p->rfGeneratorFrequencySelectOscillator_),
-           2);                                                            // 342
-   is.read(reinterpret_cast<char*>(&p->rfGeneratorRfStalo_), 2);          // 343
-   is.read(reinterpret_cast<char*>(&p->rfGeneratorPhaseShiftedCoho_), 2); // 344
-   is.read(reinterpret_cast<char*>(&p->_9VReceiverPs_), 2);               // 345
-   is.read(reinterpret_cast<char*>(&p->_5VReceiverPs_), 2);               // 346
-   is.read(reinterpret_cast<char*>(&p->_18VReceiverPs_), 2);              // 347
-   is.read(reinterpret_cast<char*>(&p->neg9VReceiverPs_), 2);             // 348
-   is.read(reinterpret_cast<char*>(&p->_5VSingleChannelRdaiuPs_), 2);     // 349
-   is.seekg(2, std::ios_base::cur);                                       // 350
-   is.read(reinterpret_cast<char*>(&p->horizontalShortPulseNoise_),
-           4); // 351-352
-   is.read(reinterpret_cast<char*>(&p->horizontalLongPulseNoise_),
-           4); // 353-354
-   is.read(reinterpret_cast<char*>(&p->horizontalNoiseTemperature_),
-           4);                                                        // 355-356
-   is.read(reinterpret_cast<char*>(&p->verticalShortPulseNoise_), 4); // 357-358
-   is.read(reinterpret_cast<char*>(&p->verticalLongPulseNoise_), 4);  // 359-360
-   is.read(reinterpret_cast<char*>(&p->verticalNoiseTemperature_),
-           4); // 361-362
-
-   // Calibration
-   is.read(reinterpret_cast<char*>(&p->horizontalLinearity_), 4);    // 363-364
-   is.read(reinterpret_cast<char*>(&p->horizontalDynamicRange_), 4); // 365-366
-   is.read(reinterpret_cast<char*>(&p->horizontalDeltaDbz0_), 4);    // 367-368
-   is.read(reinterpret_cast<char*>(&p->verticalDeltaDbz0_), 4);      // 369-370
-   is.read(reinterpret_cast<char*>(&p->kdPeakMeasured_), 4);         // 371-372
-   is.seekg(4, std::ios_base::cur);                                  // 373-374
-   is.read(reinterpret_cast<char*>(&p->shortPulseHorizontalDbz0_),
-           4);                                                        // 375-376
-   is.read(reinterpret_cast<char*>(&p->longPulseHorizontalDbz0_), 4); // 377-378
-   is.read(reinterpret_cast<char*>(&p->velocityProcessed_), 2);       // 379
-   is.read(reinterpret_cast<char*>(&p->widthProcessed_), 2);          // 380
-   is.read(reinterpret_cast<char*>(&p->velocityRfGen_), 2);           // 381
-   is.read(reinterpret_cast<char*>(&p->widthRfGen_), 2);              // 382
-   is.read(reinterpret_cast<char*>(&p->horizontalI0_), 4);            // 383-384
-   is.read(reinterpret_cast<char*>(&p->verticalI0_), 4);              // 385-386
-   is.read(reinterpret_cast<char*>(&p->verticalDynamicRange_), 4);    // 387-388
-   is.read(reinterpret_cast<char*>(&p->shortPulseVerticalDbz0_), 4);  // 389-390
-   is.read(reinterpret_cast<char*>(&p->longPulseVerticalDbz0_), 4);   // 391-392
-   is.seekg(8, std::ios_base::cur);                                   // 393-396
-   is.read(reinterpret_cast<char*>(&p->horizontalPowerSense_), 4);    // 397-398
-   is.read(reinterpret_cast<char*>(&p->verticalPowerSense_), 4);      // 399-400
-   is.read(reinterpret_cast<char*>(&p->zdrBias_), 4);                 // 401-402
-   is.seekg(12, std::ios_base::cur);                                  // 403-408
-   is.read(reinterpret_cast<char*>(&p->clutterSuppressionDelta_), 4); // 409-410
-   is.read(reinterpret_cast<char*>(&p->clutterSuppressionUnfilteredPower_),
-           4); // 411-412
-   is.read(reinterpret_cast<char*>(&p->clutterSuppressionFilteredPower_),
-           4);                                                  // 413-414
-   is.seekg(20, std::ios_base::cur);                            // 415-424
-   is.read(reinterpret_cast<char*>(&p->verticalLinearity_), 4); // 425-426
-   is.seekg(8, std::ios_base::cur);                             // 427-430
-
-   // File Status
-   is.read(reinterpret_cast<char*>(&p->stateFileReadStatus_), 2);      // 431
-   is.read(reinterpret_cast<char*>(&p->stateFileWriteStatus_), 2);     // 432
-   is.read(reinterpret_cast<char*>(&p->bypassMapFileReadStatus_), 2);  // 433
-   is.read(reinterpret_cast<char*>(&p->bypassMapFileWriteStatus_), 2); // 434
-   is.seekg(4, std::ios_base::cur); // 435-436
-   is.read(reinterpret_cast<char*>(&p->currentAdaptationFileReadStatus_),
-           2); // 437
-   is.read(reinterpret_cast<char*>(&p->currentAdaptationFileWriteStatus_),
-           2);                                                          // 438
-   is.read(reinterpret_cast<char*>(&p->censorZoneFileReadStatus_), 2);  // 439
-   is.read(reinterpret_cast<char*>(&p->censorZoneFileWriteStatus_), 2); // 440
-   is.read(reinterpret_cast<char*>(&p->remoteVcpFileReadStatus_), 2);   // 441
-   is.read(reinterpret_cast<char*>(&p->remoteVcpFileWriteStatus_), 2);  // 442
-   is.read(reinterpret_cast<char*>(&p->baselineAdaptationFileReadStatus_),
-           2);                                                    // 443
-   is.read(reinterpret_cast<char*>(&p->readStatusOfPrfSets_), 2); // 444
-   is.read(reinterpret_cast<char*>(&p->clutterFilterMapFileReadStatus_),
-           2); // 445
-   is.read(reinterpret_cast<char*>(&p->clutterFilterMapFileWriteStatus_),
-           2);                                                       // 446
-   is.read(reinterpret_cast<char*>(&p->generatlDiskIoError_), 2);    // 447
-   is.read(reinterpret_cast<char*>(&p->rspStatus_), 1);              // 448
-   is.read(reinterpret_cast<char*>(&p->motherboardTemperature_), 1); // 448
-   is.read(reinterpret_cast<char*>(&p->cpu1Temperature_), 1);        // 449
-   is.read(reinterpret_cast<char*>(&p->cpu2Temperature_), 1);        // 449
-   is.read(reinterpret_cast<char*>(&p->cpu1FanSpeed_), 2);           // 450
-   is.read(reinterpret_cast<char*>(&p->cpu2FanSpeed_), 2);           // 451
-   is.read(reinterpret_cast<char*>(&p->rspFan1Speed_), 2);           // 452
-   is.read(reinterpret_cast<char*>(&p->rspFan2Speed_), 2);           // 453
-   is.read(reinterpret_cast<char*>(&p->rspFan3Speed_), 2);           // 454
-   is.seekg(12, std::ios_base::cur);                                 // 455-460
-
-   // Device Status
-   is.read(reinterpret_cast<char*>(&p->spipCommStatus_), 2); // 461
-   is.read(reinterpret_cast<char*>(&p->hciCommStatus_), 2);  // 462
-   is.seekg(2, std::ios_base::cur);                          // 463
-   is.read(reinterpret_cast<char*>(&p->signalProcessorCommandStatus_),
-           2);                                                       // 464
-   is.read(reinterpret_cast<char*>(&p->ameCommunicationStatus_), 2); // 465
-   is.read(reinterpret_cast<char*>(&p->rmsLinkStatus_), 2);          // 466
-   is.read(reinterpret_cast<char*>(&p->rpgLinkStatus_), 2);          // 467
-   is.read(reinterpret_cast<char*>(&p->interpanelLinkStatus_), 2);   // 468
-   is.read(reinterpret_cast<char*>(&p->performanceCheckTime_), 4);   // 469
-   is.seekg(18, std::ios_base::cur);                                 // 471-479
-   is.read(reinterpret_cast<char*>(&p->version_), 2);                // 480
-
-   bytesRead += 960;
-
-   // Communications
-   p->loopBackSetStatus_             = ntohs(p->loopBackSetStatus_);
-   p->t1OutputFrames_                = ntohl(p->t1OutputFrames_);
-   p->t1InputFrames_                 = ntohl(p->t1InputFrames_);
-   p->routerMemoryUsed_              = ntohl(p->routerMemoryUsed_);
-   p->routerMemoryFree_              = ntohl(p->routerMemoryFree_);
-   p->routerMemoryUtilization_       = ntohs(p->routerMemoryUtilization_);
-   p->routeToRpg_                    = ntohs(p->routeToRpg_);
-   p->csuLossOfSignal_               = ntohl(p->csuLossOfSignal_);
-   p->csuLossOfFrames_               = ntohl(p->csuLossOfFrames_);
-   p->csuYellowAlarms_               = ntohl(p->csuYellowAlarms_);
-   p->csuBlueAlarms_                 = ntohl(p->csuBlueAlarms_);
-   p->csu24HrErroredSeconds_         = ntohl(p->csu24HrErroredSeconds_);
-   p->csu24HrSeverelyErroredSeconds_ = ntohl(p->csu24HrSeverelyErroredSeconds_);
-   p->csu24HrSeverelyErroredFramingSeconds_ =
-      ntohl(p->csu24HrSeverelyErroredFramingSeconds_);
-   p->csu24HrUnavailableSeconds_    = ntohl(p->csu24HrUnavailableSeconds_);
-   p->csu24HrControlledSlipSeconds_ = ntohl(p->csu24HrControlledSlipSeconds_);
-   p->csu24HrPathCodingViolations_  = ntohl(p->csu24HrPathCodingViolations_);
-   p->csu24HrLineErroredSeconds_    = ntohl(p->csu24HrLineErroredSeconds_);
-   p->csu24HrBurstyErroredSeconds_  = ntohl(p->csu24HrBurstyErroredSeconds_);
-   p->csu24HrDegradedMinutes_       = ntohl(p->csu24HrDegradedMinutes_);
-   p->lanSwitchCpuUtilization_      = ntohl(p->lanSwitchCpuUtilization_);
-   p->lanSwitchMemoryUtilization_   = ntohs(p->lanSwitchMemoryUtilization_);
-   p->ifdrChasisTemperature_        = ntohs(p->ifdrChasisTemperature_);
-   p->ifdrFpgaTemperature_          = ntohs(p->ifdrFpgaTemperature_);
-   p->gpsSatellites_                = ntohl(p->gpsSatellites_);
-   p->ipcStatus_                    = ntohs(p->ipcStatus_);
-   p->commandedChannelControl_      = ntohs(p->commandedChannelControl_);
-
-   // AME
-   p->polarization_           = ntohs(p->polarization_);
-   p->ameInternalTemperature_ = SwapFloat(p->ameInternalTemperature_);
-   p->ameReceiverModuleTemperature_ =
-      SwapFloat(p->ameReceiverModuleTemperature_);
-   p->ameBiteCalModuleTemperature_ = SwapFloat(p->ameBiteCalModuleTemperature_);
-   p->amePeltierPulseWidthModulation_ =
-      ntohs(p->amePeltierPulseWidthModulation_);
-   p->amePeltierStatus_     = ntohs(p->amePeltierStatus_);
-   p->ameADConverterStatus_ = ntohs(p->ameADConverterStatus_);
-   p->ameState_             = ntohs(p->ameState_);
-   p->ame3_3VPsVoltage_     = SwapFloat(p->ame3_3VPsVoltage_);
-   p->ame5VPsVoltage_       = SwapFloat(p->ame5VPsVoltage_);
-   p->ame6_5VPsVoltage_     = SwapFloat(p->ame6_5VPsVoltage_);
-   p->ame15VPsVoltage_      = SwapFloat(p->ame15VPsVoltage_);
-   p->ame48VPsVoltage_      = SwapFloat(p->ame48VPsVoltage_);
-   p->ameStaloPower_        = SwapFloat(p->ameStaloPower_);
-   p->peltierCurrent_       = SwapFloat(p->peltierCurrent_);
-   p->adcCalibrationReferenceVoltage_ =
-      SwapFloat(p->adcCalibrationReferenceVoltage_);
-   p->ameMode_                     = ntohs(p->ameMode_);
-   p->amePeltierMode_              = ntohs(p->amePeltierMode_);
-   p->amePeltierInsideFanCurrent_  = SwapFloat(p->amePeltierInsideFanCurrent_);
-   p->amePeltierOutsideFanCurrent_ = SwapFloat(p->amePeltierOutsideFanCurrent_);
-   p->horizontalTrLimiterVoltage_  = SwapFloat(p->horizontalTrLimiterVoltage_);
-   p->verticalTrLimiterVoltage_    = SwapFloat(p->verticalTrLimiterVoltage_);
-   p->adcCalibrationOffsetVoltage_ = SwapFloat(p->adcCalibrationOffsetVoltage_);
-   p->adcCalibrationGainCorrection_ =
-      SwapFloat(p->adcCalibrationGainCorrection_);
-
-   // RCP/SPIP Power Button Status
-   p->rcpStatus_        = ntohs(p->rcpStatus_);
-   p->spipPowerButtons_ = ntohs(p->spipPowerButtons_);
-
-   // Power
-   p->masterPowerAdministratorLoad_ =
-      SwapFloat(p->masterPowerAdministratorLoad_);
-   p->expansionPowerAdministratorLoad_ =
-      SwapFloat(p->expansionPowerAdministratorLoad_);
-
-   // Transmitter
-   p->_5VdcPs_                    = ntohs(p->_5VdcPs_);
-   p->_15VdcPs_                   = ntohs(p->_15VdcPs_);
-   p->_28VdcPs_                   = ntohs(p->_28VdcPs_);
-   p->neg15VdcPs_                 = ntohs(p->neg15VdcPs_);
-   p->_45VdcPs_                   = ntohs(p->_45VdcPs_);
-   p->filamentPsVoltage_          = ntohs(p->filamentPsVoltage_);
-   p->vacuumPumpPsVoltage_        = ntohs(p->vacuumPumpPsVoltage_);
-   p->focusCoilPsVoltage_         = ntohs(p->focusCoilPsVoltage_);
-   p->filamentPs_                 = ntohs(p->filamentPs_);
-   p->klystronWarmup_             = ntohs(p->klystronWarmup_);
-   p->transmitterAvailable_       = ntohs(p->transmitterAvailable_);
-   p->wgSwitchPosition_           = ntohs(p->wgSwitchPosition_);
-   p->wgPfnTransferInterlock_     = ntohs(p->wgPfnTransferInterlock_);
-   p->maintenanceMode_            = ntohs(p->maintenanceMode_);
-   p->maintenanceRequired_        = ntohs(p->maintenanceRequired_);
-   p->pfnSwitchPosition_          = ntohs(p->pfnSwitchPosition_);
-   p->modulatorOverload_          = ntohs(p->modulatorOverload_);
-   p->modulatorInvCurrent_        = ntohs(p->modulatorInvCurrent_);
-   p->modulatorSwitchFail_        = ntohs(p->modulatorSwitchFail_);
-   p->mainPowerVoltage_           = ntohs(p->mainPowerVoltage_);
-   p->chargingSystemFail_         = ntohs(p->chargingSystemFail_);
-   p->inverseDiodeCurrent_        = ntohs(p->inverseDiodeCurrent_);
-   p->triggerAmplifier_           = ntohs(p->triggerAmplifier_);
-   p->circulatorTemperature_      = ntohs(p->circulatorTemperature_);
-   p->spectrumFilterPressure_     = ntohs(p->spectrumFilterPressure_);
-   p->wgArcVswr_                  = ntohs(p->wgArcVswr_);
-   p->cabinetInterlock_           = ntohs(p->cabinetInterlock_);
-   p->cabinetAirTemperature_      = ntohs(p->cabinetAirTemperature_);
-   p->cabinetAirflow_             = ntohs(p->cabinetAirflow_);
-   p->klystronCurrent_            = ntohs(p->klystronCurrent_);
-   p->klystronFilamentCurrent_    = ntohs(p->klystronFilamentCurrent_);
-   p->klystronVacionCurrent_      = ntohs(p->klystronVacionCurrent_);
-   p->klystronAirTemperature_     = ntohs(p->klystronAirTemperature_);
-   p->klystronAirflow_            = ntohs(p->klystronAirflow_);
-   p->modulatorSwitchMaintenance_ = ntohs(p->modulatorSwitchMaintenance_);
-   p->postChargeRegulatorMaintenance_ =
-      ntohs(p->postChargeRegulatorMaintenance_);
-   p->wgPressureHumidity_          = ntohs(p->wgPressureHumidity_);
-   p->transmitterOvervoltage_      = ntohs(p->transmitterOvervoltage_);
-   p->transmitterOvercurrent_      = ntohs(p->transmitterOvercurrent_);
-   p->focusCoilCurrent_            = ntohs(p->focusCoilCurrent_);
-   p->focusCoilAirflow_            = ntohs(p->focusCoilAirflow_);
-   p->oilTemperature_              = ntohs(p->oilTemperature_);
-   p->prfLimit_                    = ntohs(p->prfLimit_);
-   p->transmitterOilLevel_         = ntohs(p->transmitterOilLevel_);
-   p->transmitterBatteryCharging_  = ntohs(p->transmitterBatteryCharging_);
-   p->highVoltageStatus_           = ntohs(p->highVoltageStatus_);
-   p->transmitterRecyclingSummary_ = ntohs(p->transmitterRecyclingSummary_);
-   p->transmitterInoperable_       = ntohs(p->transmitterInoperable_);
-   p->transmitterAirFilter_        = ntohs(p->transmitterAirFilter_);
-   SwapArray(p->zeroTestBit_);
-   SwapArray(p->oneTestBit_);
-   p->xmtrSpipInterface_        = ntohs(p->xmtrSpipInterface_);
-   p->transmitterSummaryStatus_ = ntohs(p->transmitterSummaryStatus_);
-   p->transmitterRfPower_       = SwapFloat(p->transmitterRfPower_);
-   p->horizontalXmtrPeakPower_  = SwapFloat(p->horizontalXmtrPeakPower_);
-   p->xmtrPeakPower_            = SwapFloat(p->xmtrPeakPower_);
-   p->verticalXmtrPeakPower_    = SwapFloat(p->verticalXmtrPeakPower_);
-   p->xmtrRfAvgPower_           = SwapFloat(p->xmtrRfAvgPower_);
-   p->xmtrRecycleCount_         = ntohl(p->xmtrRecycleCount_);
-   p->receiverBias_             = SwapFloat(p->receiverBias_);
-   p->transmitImbalance_        = SwapFloat(p->transmitImbalance_);
-   p->xmtrPowerMeterZero_       = SwapFloat(p->xmtrPowerMeterZero_);
-
-   // Tower/Utilities
-   p->acUnit1CompressorShutOff_     = ntohs(p->acUnit1CompressorShutOff_);
-   p->acUnit2CompressorShutOff_     = ntohs(p->acUnit2CompressorShutOff_);
-   p->generatorMaintenanceRequired_ = ntohs(p->generatorMaintenanceRequired_);
-   p->generatorBatteryVoltage_      = ntohs(p->generatorBatteryVoltage_);
-   p->generatorEngine_              = ntohs(p->generatorEngine_);
-   p->generatorVoltFrequency_       = ntohs(p->generatorVoltFrequency_);
-   p->powerSource_                  = ntohs(p->powerSource_);
-   p->transitionalPowerSource_      = ntohs(p->transitionalPowerSource_);
-   p->generatorAutoRunOffSwitch_    = ntohs(p->generatorAutoRunOffSwitch_);
-   p->aircraftHazardLighting_       = ntohs(p->aircraftHazardLighting_);
-
-   // Equipment Shelter
-   p->equipmentShelterFireDetectionSystem_ =
-      ntohs(p->equipmentShelterFireDetectionSystem_);
-   p->equipmentShelterFireSmoke_   = ntohs(p->equipmentShelterFireSmoke_);
-   p->generatorShelterFireSmoke_   = ntohs(p->generatorShelterFireSmoke_);
-   p->utilityVoltageFrequency_     = ntohs(p->utilityVoltageFrequency_);
-   p->siteSecurityAlarm_           = ntohs(p->siteSecurityAlarm_);
-   p->securityEquipment_           = ntohs(p->securityEquipment_);
-   p->securitySystem_              = ntohs(p->securitySystem_);
-   p->receiverConnectedToAntenna_  = ntohs(p->receiverConnectedToAntenna_);
-   p->radomeHatch_                 = ntohs(p->radomeHatch_);
-   p->acUnit1FilterDirty_          = ntohs(p->acUnit1FilterDirty_);
-   p->acUnit2FilterDirty_          = ntohs(p->acUnit2FilterDirty_);
-   p->equipmentShelterTemperature_ = SwapFloat(p->equipmentShelterTemperature_);
-   p->outsideAmbientTemperature_   = SwapFloat(p->outsideAmbientTemperature_);
-   p->transmitterLeavingAirTemp_   = SwapFloat(p->transmitterLeavingAirTemp_);
-   p->acUnit1DischargeAirTemp_     = SwapFloat(p->acUnit1DischargeAirTemp_);
-   p->generatorShelterTemperature_ = SwapFloat(p->generatorShelterTemperature_);
-   p->radomeAirTemperature_        = SwapFloat(p->radomeAirTemperature_);
-   p->acUnit2DischargeAirTemp_     = SwapFloat(p->acUnit2DischargeAirTemp_);
-   p->spip15VPs_                   = SwapFloat(p->spip15VPs_);
-   p->spipNeg15VPs_                = SwapFloat(p->spipNeg15VPs_);
-   p->spip28VPsStatus_             = ntohs(p->spip28VPsStatus_);
-   p->spip5VPs_                    = SwapFloat(p->spip5VPs_);
-   p->convertedGeneratorFuelLevel_ = ntohs(p->convertedGeneratorFuelLevel_);
-
-   // Antenna/Pedestal
-   p->elevationPosDeadLimit_         = ntohs(p->elevationPosDeadLimit_);
-   p->_150VOvervoltage_              = ntohs(p->_150VOvervoltage_);
-   p->_150VUndervoltage_             = ntohs(p->_150VUndervoltage_);
-   p->elevationServoAmpInhibit_      = ntohs(p->elevationServoAmpInhibit_);
-   p->elevationServoAmpShortCircuit_ = ntohs(p->elevationServoAmpShortCircuit_);
-   p->elevationServoAmpOvertemp_     = ntohs(p->elevationServoAmpOvertemp_);
-   p->elevationMotorOvertemp_        = ntohs(p->elevationMotorOvertemp_);
-   p->elevationStowPin_              = ntohs(p->elevationStowPin_);
-   p->elevationHousing5VPs_          = ntohs(p->elevationHousing5VPs_);
-   p->elevationNegDeadLimit_         = ntohs(p->elevationNegDeadLimit_);
-   p->elevationPosNormalLimit_       = ntohs(p->elevationPosNormalLimit_);
-   p->elevationNegNormalLimit_       = ntohs(p->elevationNegNormalLimit_);
-   p->elevationEncoderLight_         = ntohs(p->elevationEncoderLight_);
-   p->elevationGearboxOil_           = ntohs(p->elevationGearboxOil_);
-   p->elevationHandwheel_            = ntohs(p->elevationHandwheel_);
-   p->elevationAmpPs_                = ntohs(p->elevationAmpPs_);
-   p->azimuthServoAmpInhibit_        = ntohs(p->azimuthServoAmpInhibit_);
-   p->azimuthServoAmpShortCircuit_   = ntohs(p->azimuthServoAmpShortCircuit_);
-   p->azimuthServoAmpOvertemp_       = ntohs(p->azimuthServoAmpOvertemp_);
-   p->azimuthMotorOvertemp_          = ntohs(p->azimuthMotorOvertemp_);
-   p->azimuthStowPin_                = ntohs(p->azimuthStowPin_);
-   p->azimuthHousing5VPs_            = ntohs(p->azimuthHousing5VPs_);
-   p->azimuthEncoderLight_           = ntohs(p->azimuthEncoderLight_);
-   p->azimuthGearboxOil_             = ntohs(p->azimuthGearboxOil_);
-   p->azimuthBullGearOil_            = ntohs(p->azimuthBullGearOil_);
-   p->azimuthHandwheel_              = ntohs(p->azimuthHandwheel_);
-   p->azimuthServoAmpPs_             = ntohs(p->azimuthServoAmpPs_);
-   p->servo_                         = ntohs(p->servo_);
-   p->pedestalInterlockSwitch_       = ntohs(p->pedestalInterlockSwitch_);
-
-   // RF Generator/Receiver
-   p->cohoClock_ = ntohs(p->cohoClock_);
-   p->rfGeneratorFrequencySelectOscillator_ =
-      ntohs(p->rfGeneratorFrequencySelectOscillator_);
-   p->rfGeneratorRfStalo_          = ntohs(p->rfGeneratorRfStalo_);
-   p->rfGeneratorPhaseShiftedCoho_ = ntohs(p->rfGeneratorPhaseShiftedCoho_);
-   p->_9VReceiverPs_               = ntohs(p->_9VReceiverPs_);
-   p->_5VReceiverPs_               = ntohs(p->_5VReceiverPs_);
-   p->_18VReceiverPs_              = ntohs(p->_18VReceiverPs_);
-   p->neg9VReceiverPs_             = ntohs(p->neg9VReceiverPs_);
-   p->_5VSingleChannelRdaiuPs_     = ntohs(p->_5VSingleChannelRdaiuPs_);
-   p->horizontalShortPulseNoise_   = SwapFloat(p->horizontalShortPulseNoise_);
-   p->horizontalLongPulseNoise_    = SwapFloat(p->horizontalLongPulseNoise_);
-   p->horizontalNoiseTemperature_  = SwapFloat(p->horizontalNoiseTemperature_);
-   p->verticalShortPulseNoise_     = SwapFloat(p->verticalShortPulseNoise_);
-   p->verticalLongPulseNoise_      = SwapFloat(p->verticalLongPulseNoise_);
-   p->verticalNoiseTemperature_    = SwapFloat(p->verticalNoiseTemperature_);
-
-   // Calibration
-   p->horizontalLinearity_      = SwapFloat(p->horizontalLinearity_);
-   p->horizontalDynamicRange_   = SwapFloat(p->horizontalDynamicRange_);
-   p->horizontalDeltaDbz0_      = SwapFloat(p->horizontalDeltaDbz0_);
-   p->verticalDeltaDbz0_        = SwapFloat(p->verticalDeltaDbz0_);
-   p->kdPeakMeasured_           = SwapFloat(p->kdPeakMeasured_);
-   p->shortPulseHorizontalDbz0_ = SwapFloat(p->shortPulseHorizontalDbz0_);
-   p->longPulseHorizontalDbz0_  = SwapFloat(p->longPulseHorizontalDbz0_);
-   p->velocityProcessed_        = ntohs(p->velocityProcessed_);
-   p->widthProcessed_           = ntohs(p->widthProcessed_);
-   p->velocityRfGen_            = ntohs(p->velocityRfGen_);
-   p->widthRfGen_               = ntohs(p->widthRfGen_);
-   p->horizontalI0_             = SwapFloat(p->horizontalI0_);
-   p->verticalI0_               = SwapFloat(p->verticalI0_);
-   p->verticalDynamicRange_     = SwapFloat(p->verticalDynamicRange_);
-   p->shortPulseVerticalDbz0_   = SwapFloat(p->shortPulseVerticalDbz0_);
-   p->longPulseVerticalDbz0_    = SwapFloat(p->longPulseVerticalDbz0_);
-   p->horizontalPowerSense_     = SwapFloat(p->horizontalPowerSense_);
-   p->verticalPowerSense_       = SwapFloat(p->verticalPowerSense_);
-   p->zdrBias_                  = SwapFloat(p->zdrBias_);
-   p->clutterSuppressionDelta_  = SwapFloat(p->clutterSuppressionDelta_);
-   p->clutterSuppressionUnfilteredPower_ =
-      SwapFloat(p->clutterSuppressionUnfilteredPower_);
-   p->clutterSuppressionFilteredPower_ =
-      SwapFloat(p->clutterSuppressionFilteredPower_);
-   p->verticalLinearity_ = SwapFloat(p->verticalLinearity_);
-
-   // File Status
-   p->stateFileReadStatus_      = ntohs(p->stateFileReadStatus_);
-   p->stateFileWriteStatus_     = ntohs(p->stateFileWriteStatus_);
-   p->bypassMapFileReadStatus_  = ntohs(p->bypassMapFileReadStatus_);
-   p->bypassMapFileWriteStatus_ = ntohs(p->bypassMapFileWriteStatus_);
-   p->currentAdaptationFileReadStatus_ =
-      ntohs(p->currentAdaptationFileReadStatus_);
-   p->currentAdaptationFileWriteStatus_ =
-      ntohs(p->currentAdaptationFileWriteStatus_);
-   p->censorZoneFileReadStatus_  = ntohs(p->censorZoneFileReadStatus_);
-   p->censorZoneFileWriteStatus_ = ntohs(p->censorZoneFileWriteStatus_);
-   p->remoteVcpFileReadStatus_   = ntohs(p->remoteVcpFileReadStatus_);
-   p->remoteVcpFileWriteStatus_  = ntohs(p->remoteVcpFileWriteStatus_);
-   p->baselineAdaptationFileReadStatus_ =
-      ntohs(p->baselineAdaptationFileReadStatus_);
-   p->readStatusOfPrfSets_ = ntohs(p->readStatusOfPrfSets_);
-   p->clutterFilterMapFileReadStatus_ =
-      ntohs(p->clutterFilterMapFileReadStatus_);
-   p->clutterFilterMapFileWriteStatus_ =
-      ntohs(p->clutterFilterMapFileWriteStatus_);
-   p->generatlDiskIoError_ = ntohs(p->generatlDiskIoError_);
-   p->cpu1FanSpeed_        = ntohs(p->cpu1FanSpeed_);
-   p->cpu2FanSpeed_        = ntohs(p->cpu2FanSpeed_);
-   p->rspFan1Speed_        = ntohs(p->rspFan1Speed_);
-   p->rspFan2Speed_        = ntohs(p->rspFan2Speed_);
-   p->rspFan3Speed_        = ntohs(p->rspFan3Speed_);
-
-   // Device Status
-   p->spipCommStatus_               = ntohs(p->spipCommStatus_);
-   p->hciCommStatus_                = ntohs(p->hciCommStatus_);
-   p->signalProcessorCommandStatus_ = ntohs(p->signalProcessorCommandStatus_);
-   p->ameCommunicationStatus_       = ntohs(p->ameCommunicationStatus_);
-   p->rmsLinkStatus_                = ntohs(p->rmsLinkStatus_);
-   p->rpgLinkStatus_                = ntohs(p->rpgLinkStatus_);
-   p->interpanelLinkStatus_         = ntohs(p->interpanelLinkStatus_);
-   p->performanceCheckTime_         = ntohl(p->performanceCheckTime_);
-   p->version_                      = ntohs(p->version_);
+   using Impl = PerformanceMaintenanceDataImpl;
+   using util::Field;
+   using util::FixedString;
+
+   using Layout = util::RecordLayout<
+      960,
+      // Communications
+      Field<&Impl::loopBackSetStatus_, 2>,                     // 2
+      Field<&Impl::t1OutputFrames_, 4>,                        // 3-4
+      Field<&Impl::t1InputFrames_, 8>,                         // 5-6
+      Field<&Impl::routerMemoryUsed_, 12>,                     // 7-8
+      Field<&Impl::routerMemoryFree_, 16>,                     // 9-10
+      Field<&Impl::routerMemoryUtilization_, 20>,              // 11
+      Field<&Impl::routeToRpg_, 22>,                           // 12
+      Field<&Impl::csuLossOfSignal_, 24>,                      // 13-14
+      Field<&Impl::csuLossOfFrames_, 28>,                      // 15-16
+      Field<&Impl::csuYellowAlarms_, 32>,                      // 17-18
+      Field<&Impl::csuBlueAlarms_, 36>,                        // 19-20
+      Field<&Impl::csu24HrErroredSeconds_, 40>,                // 21-22
+      Field<&Impl::csu24HrSeverelyErroredSeconds_, 44>,        // 23-24
+      Field<&Impl::csu24HrSeverelyErroredFramingSeconds_, 48>, // 25-26
+      Field<&Impl::csu24HrUnavailableSeconds_, 52>,            // 27-28
+      Field<&Impl::csu24HrControlledSlipSeconds_, 56>,         // 29-30
+      Field<&Impl::csu24HrPathCodingViolations_, 60>,          // 31-32
+      Field<&Impl::csu24HrLineErroredSeconds_, 64>,            // 33-34
+      Field<&Impl::csu24HrBurstyErroredSeconds_, 68>,          // 35-36
+      Field<&Impl::csu24HrDegradedMinutes_, 72>,               // 37-38
+      Field<&Impl::lanSwitchCpuUtilization_, 80>,              // 41-42
+      Field<&Impl::lanSwitchMemoryUtilization_, 84>,           // 43
+      Field<&Impl::ifdrChasisTemperature_, 88>,                // 45
+      Field<&Impl::ifdrFpgaTemperature_, 90>,                  // 46
+      Field<&Impl::gpsSatellites_, 96>,                        // 49-50
+      Field<&Impl::ipcStatus_, 104>,                           // 53
+      Field<&Impl::commandedChannelControl_, 106>,             // 54
+
+      // AME
+      Field<&Impl::polarization_, 114>,                   // 58
+      Field<&Impl::ameInternalTemperature_, 116>,         // 59-60
+      Field<&Impl::ameReceiverModuleTemperature_, 120>,   // 61-62
+      Field<&Impl::ameBiteCalModuleTemperature_, 124>,    // 63-64
+      Field<&Impl::amePeltierPulseWidthModulation_, 128>, // 65
+      Field<&Impl::amePeltierStatus_, 130>,               // 66
+      Field<&Impl::ameADConverterStatus_, 132>,           // 67
+      Field<&Impl::ameState_, 134>,                       // 68
+      Field<&Impl::ame3_3VPsVoltage_, 136>,               // 69-70
+      Field<&Impl::ame5VPsVoltage_, 140>,                 // 71-72
+      Field<&Impl::ame6_5VPsVoltage_, 144>,               // 73-74
+      Field<&Impl::ame15VPsVoltage_, 148>,                // 75-76
+      Field<&Impl::ame48VPsVoltage_, 152>,                // 77-78
+      Field<&Impl::ameStaloPower_, 156>,                  // 79-80
+      Field<&Impl::peltierCurrent_, 160>,                 // 81-82
+      Field<&Impl::adcCalibrationReferenceVoltage_, 164>, // 83-84
+      Field<&Impl::ameMode_, 168>,                        // 85
+      Field<&Impl::amePeltierMode_, 170>,                 // 86
+      Field<&Impl::amePeltierInsideFanCurrent_, 172>,     // 87-88
+      Field<&Impl::amePeltierOutsideFanCurrent_, 176>,    // 89-90
+      Field<&Impl::horizontalTrLimiterVoltage_, 180>,     // 91-92
+      Field<&Impl::verticalTrLimiterVoltage_, 184>,       // 93-94
+      Field<&Impl::adcCalibrationOffsetVoltage_, 188>,    // 95-96
+      Field<&Impl::adcCalibrationGainCorrection_, 192>,   // 97-98
+
+      // RCP/SPIP Power Button Status
+      Field<&Impl::rcpStatus_, 196>,                  // 99
+      Field<&Impl::rcpString_, 198, FixedString<16>>, // 100-107
+      Field<&Impl::spipPowerButtons_, 214>,           // 108
+
+      // Power
+      Field<&Impl::masterPowerAdministratorLoad_, 220>,    // 111-112
+      Field<&Impl::expansionPowerAdministratorLoad_, 224>, // 113-114
+
+      // Transmitter
+      Field<&Impl::_5VdcPs_, 272>,                        // 137
+      Field<&Impl::_15VdcPs_, 274>,                       // 138
+      Field<&Impl::_28VdcPs_, 276>,                       // 139
+      Field<&Impl::neg15VdcPs_, 278>,                     // 140
+      Field<&Impl::_45VdcPs_, 280>,                       // 141
+      Field<&Impl::filamentPsVoltage_, 282>,              // 142
+      Field<&Impl::vacuumPumpPsVoltage_, 284>,            // 143
+      Field<&Impl::focusCoilPsVoltage_, 286>,             // 144
+      Field<&Impl::filamentPs_, 288>,                     // 145
+      Field<&Impl::klystronWarmup_, 290>,                 // 146
+      Field<&Impl::transmitterAvailable_, 292>,           // 147
+      Field<&Impl::wgSwitchPosition_, 294>,               // 148
+      Field<&Impl::wgPfnTransferInterlock_, 296>,         // 149
+      Field<&Impl::maintenanceMode_, 298>,                // 150
+      Field<&Impl::maintenanceRequired_, 300>,            // 151
+      Field<&Impl::pfnSwitchPosition_, 302>,              // 152
+      Field<&Impl::modulatorOverload_, 304>,              // 153
+      Field<&Impl::modulatorInvCurrent_, 306>,            // 154
+      Field<&Impl::modulatorSwitchFail_, 308>,            // 155
+      Field<&Impl::mainPowerVoltage_, 310>,               // 156
+      Field<&Impl::chargingSystemFail_, 312>,             // 157
+      Field<&Impl::inverseDiodeCurrent_, 314>,            // 158
+      Field<&Impl::triggerAmplifier_, 316>,               // 159
+      Field<&Impl::circulatorTemperature_, 318>,          // 160
+      Field<&Impl::spectrumFilterPressure_, 320>,         // 161
+      Field<&Impl::wgArcVswr_, 322>,                      // 162
+      Field<&Impl::cabinetInterlock_, 324>,               // 163
+      Field<&Impl::cabinetAirTemperature_, 326>,          // 164
+      Field<&Impl::cabinetAirflow_, 328>,                 // 165
+      Field<&Impl::klystronCurrent_, 330>,                // 166
+      Field<&Impl::klystronFilamentCurrent_, 332>,        // 167
+      Field<&Impl::klystronVacionCurrent_, 334>,          // 168
+      Field<&Impl::klystronAirTemperature_, 336>,         // 169
+      Field<&Impl::klystronAirflow_, 338>,                // 170
+      Field<&Impl::modulatorSwitchMaintenance_, 340>,     // 171
+      Field<&Impl::postChargeRegulatorMaintenance_, 342>, // 172
+      Field<&Impl::wgPressureHumidity_, 344>,             // 173
+      Field<&Impl::transmitterOvervoltage_, 346>,         // 174
+      Field<&Impl::transmitterOvercurrent_, 348>,         // 175
+      Field<&Impl::focusCoilCurrent_, 350>,               // 176
+      Field<&Impl::focusCoilAirflow_, 352>,               // 177
+      Field<&Impl::oilTemperature_, 354>,                 // 178
+      Field<&Impl::prfLimit_, 356>,                       // 179
+      Field<&Impl::transmitterOilLevel_, 358>,            // 180
+      Field<&Impl::transmitterBatteryCharging_, 360>,     // 181
+      Field<&Impl::highVoltageStatus_, 362>,              // 182
+      Field<&Impl::transmitterRecyclingSummary_, 364>,    // 183
+      Field<&Impl::transmitterInoperable_, 366>,          // 184
+      Field<&Impl::transmitterAirFilter_, 368>,           // 185
+      Field<&Impl::zeroTestBit_, 370>,                    // 186-193
+      Field<&Impl::oneTestBit_, 386>,                     // 194-201
+      Field<&Impl::xmtrSpipInterface_, 402>,              // 202
+      Field<&Impl::transmitterSummaryStatus_, 404>,       // 203
+      Field<&Impl::transmitterRfPower_, 408>,             // 205-206
+      Field<&Impl::horizontalXmtrPeakPower_, 412>,        // 207-208
+      Field<&Impl::xmtrPeakPower_, 416>,                  // 209-210
+      Field<&Impl::verticalXmtrPeakPower_, 420>,          // 211-212
+      Field<&Impl::xmtrRfAvgPower_, 424>,                 // 213-214
+      Field<&Impl::xmtrRecycleCount_, 432>,               // 217-218
+      Field<&Impl::receiverBias_, 436>,                   // 219-220
+      Field<&Impl::transmitImbalance_, 440>,              // 221-222
+      Field<&Impl::xmtrPowerMeterZero_, 444>,             // 223-224
+
+      // Tower/Utilities
+      Field<&Impl::acUnit1CompressorShutOff_, 456>,     // 229
+      Field<&Impl::acUnit2CompressorShutOff_, 458>,     // 230
+      Field<&Impl::generatorMaintenanceRequired_, 460>, // 231
+      Field<&Impl::generatorBatteryVoltage_, 462>,      // 232
+      Field<&Impl::generatorEngine_, 464>,              // 233
+      Field<&Impl::generatorVoltFrequency_, 466>,       // 234
+      Field<&Impl::powerSource_, 468>,                  // 235
+      Field<&Impl::transitionalPowerSource_, 470>,      // 236
+      Field<&Impl::generatorAutoRunOffSwitch_, 472>,    // 237
+      Field<&Impl::aircraftHazardLighting_, 474>,       // 238
+
+      // Equipment Shelter
+      Field<&Impl::equipmentShelterFireDetectionSystem_, 498>, // 250
+      Field<&Impl::equipmentShelterFireSmoke_, 500>,           // 251
+      Field<&Impl::generatorShelterFireSmoke_, 502>,           // 252
+      Field<&Impl::utilityVoltageFrequency_, 504>,             // 253
+      Field<&Impl::siteSecurityAlarm_, 506>,                   // 254
+      Field<&Impl::securityEquipment_, 508>,                   // 255
+      Field<&Impl::securitySystem_, 510>,                      // 256
+      Field<&Impl::receiverConnectedToAntenna_, 512>,          // 257
+      Field<&Impl::radomeHatch_, 514>,                         // 258
+      Field<&Impl::acUnit1FilterDirty_, 516>,                  // 259
+      Field<&Impl::acUnit2FilterDirty_, 518>,                  // 260
+      Field<&Impl::equipmentShelterTemperature_, 520>,         // 261-262
+      Field<&Impl::outsideAmbientTemperature_, 524>,           // 263-264
+      Field<&Impl::transmitterLeavingAirTemp_, 528>,           // 265-266
+      Field<&Impl::acUnit1DischargeAirTemp_, 532>,             // 267-268
+      Field<&Impl::generatorShelterTemperature_, 536>,         // 269-270
+      Field<&Impl::radomeAirTemperature_, 540>,                // 271-272
+      Field<&Impl::acUnit2DischargeAirTemp_, 544>,             // 273-274
+      Field<&Impl::spip15VPs_, 548>,                           // 275-276
+      Field<&Impl::spipNeg15VPs_, 552>,                        // 277-278
+      Field<&Impl::spip28VPsStatus_, 556>,                     // 279
+      Field<&Impl::spip5VPs_, 560>,                            // 281-282
+      Field<&Impl::convertedGeneratorFuelLevel_, 564>,         // 283
+
+      // Antenna/Pedestal
+      Field<&Impl::elevationPosDeadLimit_, 598>,         // 300
+      Field<&Impl::_150VOvervoltage_, 600>,              // 301
+      Field<&Impl::_150VUndervoltage_, 602>,             // 302
+      Field<&Impl::elevationServoAmpInhibit_, 604>,      // 303
+      Field<&Impl::elevationServoAmpShortCircuit_, 606>, // 304
+      Field<&Impl::elevationServoAmpOvertemp_, 608>,     // 305
+      Field<&Impl::elevationMotorOvertemp_, 610>,        // 306
+      Field<&Impl::elevationStowPin_, 612>,              // 307
+      Field<&Impl::elevationHousing5VPs_, 614>,          // 308
+      Field<&Impl::elevationNegDeadLimit_, 616>,         // 309
+      Field<&Impl::elevationPosNormalLimit_, 618>,       // 310
+      Field<&Impl::elevationNegNormalLimit_, 620>,       // 311
+      Field<&Impl::elevationEncoderLight_, 622>,         // 312
+      Field<&Impl::elevationGearboxOil_, 624>,           // 313
+      Field<&Impl::elevationHandwheel_, 626>,            // 314
+      Field<&Impl::elevationAmpPs_, 628>,                // 315
+      Field<&Impl::azimuthServoAmpInhibit_, 630>,        // 316
+      Field<&Impl::azimuthServoAmpShortCircuit_, 632>,   // 317
+      Field<&Impl::azimuthServoAmpOvertemp_, 634>,       // 318
+      Field<&Impl::azimuthMotorOvertemp_, 636>,          // 319
+      Field<&Impl::azimuthStowPin_, 638>,                // 320
+      Field<&Impl::azimuthHousing5VPs_, 640>,            // 321
+      Field<&Impl::azimuthEncoderLight_, 642>,           // 322
+      Field<&Impl::azimuthGearboxOil_, 644>,             // 323
+      Field<&Impl::azimuthBullGearOil_, 646>,            // 324
+      Field<&Impl::azimuthHandwheel_, 648>,              // 325
+      Field<&Impl::azimuthServoAmpPs_, 650>,             // 326
+      Field<&Impl::servo_, 652>,                         // 327
+      Field<&Impl::pedestalInterlockSwitch_, 654>,       // 328
+
+      // RF Generator/Receiver
+      Field<&Impl::cohoClock_, 680>,                            // 341
+      Field<&Impl::rfGeneratorFrequencySelectOscillator_, 682>, // 342
+      Field<&Impl::rfGeneratorRfStalo_, 684>,                   // 343
+      Field<&Impl::rfGeneratorPhaseShiftedCoho_, 686>,          // 344
+      Field<&Impl::_9VReceiverPs_, 688>,                        // 345
+      Field<&Impl::_5VReceiverPs_, 690>,                        // 346
+      Field<&Impl::_18VReceiverPs_, 692>,                       // 347
+      Field<&Impl::neg9VReceiverPs_, 694>,                      // 348
+      Field<&Impl::_5VSingleChannelRdaiuPs_, 696>,              // 349
+      Field<&Impl::horizontalShortPulseNoise_, 700>,            // 351-352
+      Field<&Impl::horizontalLongPulseNoise_, 704>,             // 353-354
+      Field<&Impl::horizontalNoiseTemperature_, 708>,           // 355-356
+      Field<&Impl::verticalShortPulseNoise_, 712>,              // 357-358
+      Field<&Impl::verticalLongPulseNoise_, 716>,               // 359-360
+      Field<&Impl::verticalNoiseTemperature_, 720>,             // 361-362
+
+      // Calibration
+      Field<&Impl::horizontalLinearity_, 724>,               // 363-364
+      Field<&Impl::horizontalDynamicRange_, 728>,            // 365-366
+      Field<&Impl::horizontalDeltaDbz0_, 732>,               // 367-368
+      Field<&Impl::verticalDeltaDbz0_, 736>,                 // 369-370
+      Field<&Impl::kdPeakMeasured_, 740>,                    // 371-372
+      Field<&Impl::shortPulseHorizontalDbz0_, 748>,          // 375-376
+      Field<&Impl::longPulseHorizontalDbz0_, 752>,           // 377-378
+      Field<&Impl::velocityProcessed_, 756>,                 // 379
+      Field<&Impl::widthProcessed_, 758>,                    // 380
+      Field<&Impl::velocityRfGen_, 760>,                     // 381
+      Field<&Impl::widthRfGen_, 762>,                        // 382
+      Field<&Impl::horizontalI0_, 764>,                      // 383-384
+      Field<&Impl::verticalI0_, 768>,                        // 385-386
+      Field<&Impl::verticalDynamicRange_, 772>,              // 387-388
+      Field<&Impl::shortPulseVerticalDbz0_, 776>,            // 389-390
+      Field<&Impl::longPulseVerticalDbz0_, 780>,             // 391-392
+      Field<&Impl::horizontalPowerSense_, 792>,              // 397-398
+      Field<&Impl::verticalPowerSense_, 796>,                // 399-400
+      Field<&Impl::zdrBias_, 800>,                           // 401-402
+      Field<&Impl::clutterSuppressionDelta_, 816>,           // 409-410
+      Field<&Impl::clutterSuppressionUnfilteredPower_, 820>, // 411-412
+      Field<&Impl::clutterSuppressionFilteredPower_, 824>,   // 413-414
+      Field<&Impl::verticalLinearity_, 848>,                 // 425-426
+
+      // File Status
+      Field<&Impl::stateFileReadStatus_, 860>,              // 431
+      Field<&Impl::stateFileWriteStatus_, 862>,             // 432
+      Field<&Impl::bypassMapFileReadStatus_, 864>,          // 433
+      Field<&Impl::bypassMapFileWriteStatus_, 866>,         // 434
+      Field<&Impl::currentAdaptationFileReadStatus_, 872>,  // 437
+      Field<&Impl::currentAdaptationFileWriteStatus_, 874>, // 438
+      Field<&Impl::censorZoneFileReadStatus_, 876>,         // 439
+      Field<&Impl::censorZoneFileWriteStatus_, 878>,        // 440
+      Field<&Impl::remoteVcpFileReadStatus_, 880>,          // 441
+      Field<&Impl::remoteVcpFileWriteStatus_, 882>,         // 442
+      Field<&Impl::baselineAdaptationFileReadStatus_, 884>, // 443
+      Field<&Impl::readStatusOfPrfSets_, 886>,              // 444
+      Field<&Impl::clutterFilterMapFileReadStatus_, 888>,   // 445
+      Field<&Impl::clutterFilterMapFileWriteStatus_, 890>,  // 446
+      Field<&Impl::generatlDiskIoError_, 892>,              // 447
+      Field<&Impl::rspStatus_, 894>,                        // 448
+      Field<&Impl::motherboardTemperature_, 895>,           // 448
+      Field<&Impl::cpu1Temperature_, 896>,                  // 449
+      Field<&Impl::cpu2Temperature_, 897>,                  // 449
+      Field<&Impl::cpu1FanSpeed_, 898>,                     // 450
+      Field<&Impl::cpu2FanSpeed_, 900>,                     // 451
+      Field<&Impl::rspFan1Speed_, 902>,                     // 452
+      Field<&Impl::rspFan2Speed_, 904>,                     // 453
+      Field<&Impl::rspFan3Speed_, 906>,                     // 454
+
+      // Device Status
+      Field<&Impl::spipCommStatus_, 920>,               // 461
+      Field<&Impl::hciCommStatus_, 922>,                // 462
+      Field<&Impl::signalProcessorCommandStatus_, 926>, // 464
+      Field<&Impl::ameCommunicationStatus_, 928>,       // 465
+      Field<&Impl::rmsLinkStatus_, 930>,                // 466
+      Field<&Impl::rpgLinkStatus_, 932>,                // 467
+      Field<&Impl::interpanelLinkStatus_, 934>,         // 468
+      Field<&Impl::performanceCheckTime_, 936>,         // 469
+      Field<&Impl::version_, 958>>;                     // 480
+
+   Layout::Read(is, *p);
+   bytesRead += Layout::kSize;
 
    if (!ValidateMessage(is, bytesRead))
    {
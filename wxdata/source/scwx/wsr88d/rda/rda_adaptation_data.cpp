@@ -1,5 +1,6 @@
 #include <scwx/wsr88d/rda/rda_adaptation_data.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/record_layout.hpp>
 
 namespace scwx
 {
@@ -31,6 +32,47 @@ struct AntManualSetup
    }
 };
 
+using AntManualSetupLayout =
+   util::RecordLayout<24,
+                      util::Field<&AntManualSetup::ielmin_, 0>,
+                      util::Field<&AntManualSetup::ielmax_, 4>,
+                      util::Field<&AntManualSetup::fazvelmax_, 8>,
+                      util::Field<&AntManualSetup::felvelmax_, 12>,
+                      util::Field<&AntManualSetup::igndHgt_, 16>,
+                      util::Field<&AntManualSetup::iradHgt_, 20>>;
+
+// Booleans are encoded as 4 characters, beginning with 'T' if true
+struct AdaptationBoolean
+{
+   static constexpr std::size_t kSize = 4;
+
+   static void Load(const std::uint8_t* data, bool& value)
+   {
+      value = (data[0] == 'T');
+   }
+   static void Store(const bool& value, std::uint8_t* data)
+   {
+      data[0] = value ? 'T' : 'F';
+      std::fill(data + 1, data + kSize, ' ');
+   }
+};
+
+// Characters are padded to 4 characters
+struct AdaptationChar
+{
+   static constexpr std::size_t kSize = 4;
+
+   static void Load(const std::uint8_t* data, char& value)
+   {
+      value = static_cast<char>(data[0]);
+   }
+   static void Store(const char& value, std::uint8_t* data)
+   {
+      data[0] = static_cast<std::uint8_t>(value);
+      std::fill(data + 1, data + kSize, ' ');
+   }
+};
+
 class RdaAdaptationDataImpl
 {
 public:
@@ -1271,470 +1313,220 @@ bool RdaAdaptationData::Parse(std::istream& is)
    bool   messageValid = true;
    size_t bytesRead    = 0;
 
-   p->adapFileName_.resize(12);
-   p->adapFormat_.resize(4);
-   p->adapRevision_.resize(4);
-   p->adapDate_.resize(12);
-   p->adapTime_.resize(12);
-   p->siteName_.resize(4);
-
-   is.read(&p->adapFileName_[0], 12); // 0-11
-   is.read(&p->adapFormat_[0], 4);    // 12-15
-   is.read(&p->adapRevision_[0], 4);  // 16-19
-   is.read(&p->adapDate_[0], 12);     // 20-31
-   is.read(&p->adapTime_[0], 12);     // 32-43
-
-   is.read(reinterpret_cast<char*>(&p->lowerPreLimit_), 4); // 44-47
-   is.read(reinterpret_cast<char*>(&p->azLat_), 4);         // 48-51
-   is.read(reinterpret_cast<char*>(&p->upperPreLimit_), 4); // 52-55
-   is.read(reinterpret_cast<char*>(&p->elLat_), 4);         // 56-59
-   is.read(reinterpret_cast<char*>(&p->parkaz_), 4);        // 60-63
-   is.read(reinterpret_cast<char*>(&p->parkel_), 4);        // 64-67
-
-   is.read(reinterpret_cast<char*>(&p->aFuelConv_[0]),
-           p->aFuelConv_.size() * 4); // 68-111
-
-   is.read(reinterpret_cast<char*>(&p->aMinShelterTemp_), 4);       // 112-115
-   is.read(reinterpret_cast<char*>(&p->aMaxShelterTemp_), 4);       // 116-119
-   is.read(reinterpret_cast<char*>(&p->aMinShelterAcTempDiff_), 4); // 120-123
-   is.read(reinterpret_cast<char*>(&p->aMaxXmtrAirTemp_), 4);       // 124-127
-   is.read(reinterpret_cast<char*>(&p->aMaxRadTemp_), 4);           // 128-131
-   is.read(reinterpret_cast<char*>(&p->aMaxRadTempRise_), 4);       // 132-135
-   is.read(reinterpret_cast<char*>(&p->lowerDeadLimit_), 4);        // 136-139
-   is.read(reinterpret_cast<char*>(&p->upperDeadLimit_), 4);        // 140-143
-
-   is.seekg(4, std::ios_base::cur); // 144-147
-
-   is.read(reinterpret_cast<char*>(&p->aMinGenRoomTemp_), 4); // 148-151
-   is.read(reinterpret_cast<char*>(&p->aMaxGenRoomTemp_), 4); // 152-155
-   is.read(reinterpret_cast<char*>(&p->spip5VRegLim_), 4);    // 156-159
-   is.read(reinterpret_cast<char*>(&p->spip15VRegLim_), 4);   // 160-163
-
-   is.seekg(12, std::ios_base::cur); // 164-175
-
-   ReadBoolean(is, p->rpgCoLocated_);        // 176-179
-   ReadBoolean(is, p->specFilterInstalled_); // 180-183
-   ReadBoolean(is, p->tpsInstalled_);        // 184-187
-   ReadBoolean(is, p->rmsInstalled_);        // 188-191
-
-   is.read(reinterpret_cast<char*>(&p->aHvdlTstInt_), 4);           // 192-195
-   is.read(reinterpret_cast<char*>(&p->aRpgLtInt_), 4);             // 196-199
-   is.read(reinterpret_cast<char*>(&p->aMinStabUtilPwrTime_), 4);   // 200-203
-   is.read(reinterpret_cast<char*>(&p->aGenAutoExerInterval_), 4);  // 204-207
-   is.read(reinterpret_cast<char*>(&p->aUtilPwrSwReqInterval_), 4); // 208-211
-   is.read(reinterpret_cast<char*>(&p->aLowFuelLevel_), 4);         // 212-215
-   is.read(reinterpret_cast<char*>(&p->configChanNumber_), 4);      // 216-219
-
-   is.seekg(4, std::ios_base::cur); // 220-223
-
-   is.read(reinterpret_cast<char*>(&p->redundantChanConfig_), 4); // 224-227
-
-   is.read(reinterpret_cast<char*>(&p->attenTable_[0]),
-           p->attenTable_.size() * 4); // 228-643
-
-   is.seekg(24, std::ios_base::cur);                         // 644-667
-   is.read(reinterpret_cast<char*>(&p->pathLosses_[7]), 4);  // 668-671
-   is.seekg(20, std::ios_base::cur);                         // 672-691
-   is.read(reinterpret_cast<char*>(&p->pathLosses_[13]), 4); // 692-695
-   is.seekg(56, std::ios_base::cur);                         // 696-751
-   is.read(reinterpret_cast<char*>(&p->pathLosses_[28]), 4); // 752-755
-   is.read(reinterpret_cast<char*>(&p->pathLosses_[29]), 4); // 756-759
-   is.seekg(8, std::ios_base::cur);                          // 760-767
-   is.read(reinterpret_cast<char*>(&p->pathLosses_[32]), 4); // 768-771
-   is.read(reinterpret_cast<char*>(&p->pathLosses_[33]), 4); // 772-775
-   is.seekg(4, std::ios_base::cur);                          // 776-779
-   is.read(reinterpret_cast<char*>(&p->pathLosses_[35]), 4); // 780-783
-   is.seekg(12, std::ios_base::cur);                         // 784-795
-   is.read(reinterpret_cast<char*>(&p->pathLosses_[39]), 4); // 796-799
-   is.read(reinterpret_cast<char*>(&p->pathLosses_[40]), 4); // 800-803
-   is.seekg(4, std::ios_base::cur);                          // 804-807
-   is.read(reinterpret_cast<char*>(&p->pathLosses_[42]), 4); // 808-811
-   is.read(reinterpret_cast<char*>(&p->pathLosses_[43]), 4); // 812-815
-   is.read(reinterpret_cast<char*>(&p->pathLosses_[44]), 4); // 816-819
-   is.read(reinterpret_cast<char*>(&p->pathLosses_[45]), 4); // 820-823
-   is.read(reinterpret_cast<char*>(&p->pathLosses_[46]), 4); // 824-827
-   is.read(reinterpret_cast<char*>(&p->pathLosses_[47]), 4); // 828-831
-   is.read(reinterpret_cast<char*>(&p->pathLosses_[48]), 4); // 832-835
-   is.read(reinterpret_cast<char*>(&p->pathLosses_[49]), 4); // 836-839
-   is.seekg(4, std::ios_base::cur);                          // 840-843
-   is.read(reinterpret_cast<char*>(&p->pathLosses_[51]), 4); // 844-847
-   is.read(reinterpret_cast<char*>(&p->pathLosses_[52]), 4); // 848-851
-   is.read(reinterpret_cast<char*>(&p->pathLosses_[53]), 4); // 852-855
-   is.seekg(8, std::ios_base::cur);                          // 856-863
-   is.read(reinterpret_cast<char*>(&p->pathLosses_[56]), 4); // 864-867
-   is.read(reinterpret_cast<char*>(&p->pathLosses_[57]), 4); // 868-871
-   is.read(reinterpret_cast<char*>(&p->pathLosses_[58]), 4); // 872-875
-   is.read(reinterpret_cast<char*>(&p->pathLosses_[59]), 4); // 876-879
-   is.read(reinterpret_cast<char*>(&p->pathLosses_[60]), 4); // 880-883
-   is.read(reinterpret_cast<char*>(&p->pathLosses_[61]), 4); // 884-887
-   is.seekg(4, std::ios_base::cur);                          // 888-891
-   is.read(reinterpret_cast<char*>(&p->pathLosses_[63]), 4); // 892-895
-   is.read(reinterpret_cast<char*>(&p->pathLosses_[64]), 4); // 896-899
-   is.read(reinterpret_cast<char*>(&p->pathLosses_[65]), 4); // 900-903
-   is.read(reinterpret_cast<char*>(&p->pathLosses_[66]), 4); // 904-907
-   is.read(reinterpret_cast<char*>(&p->pathLosses_[67]), 4); // 908-911
-   is.read(reinterpret_cast<char*>(&p->pathLosses_[68]), 4); // 912-915
-   is.seekg(4, std::ios_base::cur);                          // 916-919
-   is.read(reinterpret_cast<char*>(&p->pathLosses_[70]), 4); // 920-923
-   is.read(reinterpret_cast<char*>(&p->pathLosses_[71]), 4); // 924-927
-
-   is.seekg(8, std::ios_base::cur); // 928-935
-
-   is.read(reinterpret_cast<char*>(&p->vTsCw_), 4); // 936-939
-
-   is.read(reinterpret_cast<char*>(&p->hRnscale_[0]),
-           p->hRnscale_.size() * 4); // 940-991
-
-   is.read(reinterpret_cast<char*>(&p->atmos_[0]),
-           p->atmos_.size() * 4); // 992-1043
-
-   is.read(reinterpret_cast<char*>(&p->elIndex_[0]),
-           p->elIndex_.size() * 4); // 1044-1091
-
-   is.read(reinterpret_cast<char*>(&p->tfreqMhz_), 4);      // 1092-1095
-   is.read(reinterpret_cast<char*>(&p->baseDataTcn_), 4);   // 1096-1099
-   is.read(reinterpret_cast<char*>(&p->reflDataTover_), 4); // 1100-1103
-   is.read(reinterpret_cast<char*>(&p->tarHDbz0Lp_), 4);    // 1104-1107
-   is.read(reinterpret_cast<char*>(&p->tarVDbz0Lp_), 4);    // 1108-1111
-   is.read(reinterpret_cast<char*>(&p->initPhiDp_), 4);     // 1112-1115
-   is.read(reinterpret_cast<char*>(&p->normInitPhiDp_), 4); // 1116-1119
-   is.read(reinterpret_cast<char*>(&p->lxLp_), 4);          // 1120-1123
-   is.read(reinterpret_cast<char*>(&p->lxSp_), 4);          // 1124-1127
-   is.read(reinterpret_cast<char*>(&p->meteorParam_), 4);   // 1128-1131
-
-   is.seekg(4, std::ios_base::cur); // 1132-1135
-
-   is.read(reinterpret_cast<char*>(&p->antennaGain_), 4); // 1136-1139
-
-   is.seekg(12, std::ios_base::cur); // 1140-1151
-
-   is.read(reinterpret_cast<char*>(&p->velDegradLimit_), 4);       // 1152-1155
-   is.read(reinterpret_cast<char*>(&p->wthDegradLimit_), 4);       // 1156-1159
-   is.read(reinterpret_cast<char*>(&p->hNoisetempDgradLimit_), 4); // 1160-1163
-   is.read(reinterpret_cast<char*>(&p->hMinNoisetemp_), 4);        // 1164-1167
-   is.read(reinterpret_cast<char*>(&p->vNoisetempDgradLimit_), 4); // 1168-1171
-   is.read(reinterpret_cast<char*>(&p->vMinNoisetemp_), 4);        // 1172-1175
-   is.read(reinterpret_cast<char*>(&p->klyDegradeLimit_), 4);      // 1176-1179
-   is.read(reinterpret_cast<char*>(&p->tsCoho_), 4);               // 1180-1183
-   is.read(reinterpret_cast<char*>(&p->hTsCw_), 4);                // 1184-1187
-
-   is.seekg(8, std::ios_base::cur); // 1188-1195
-
-   is.read(reinterpret_cast<char*>(&p->tsStalo_), 4);              // 1196-1199
-   is.read(reinterpret_cast<char*>(&p->ameHNoiseEnr_), 4);         // 1200-1203
-   is.read(reinterpret_cast<char*>(&p->xmtrPeakPwrHighLimit_), 4); // 1204-1207
-   is.read(reinterpret_cast<char*>(&p->xmtrPeakPwrLowLimit_), 4);  // 1208-1211
-   is.read(reinterpret_cast<char*>(&p->hDbz0DeltaLimit_), 4);      // 1212-1215
-   is.read(reinterpret_cast<char*>(&p->threshold1_), 4);           // 1216-1219
-   is.read(reinterpret_cast<char*>(&p->threshold2_), 4);           // 1220-1223
-   is.read(reinterpret_cast<char*>(&p->clutSuppDgradLim_), 4);     // 1224-1227
-
-   is.seekg(4, std::ios_base::cur); // 1228-1231
-
-   is.read(reinterpret_cast<char*>(&p->range0Value_), 4);     // 1232-1235
-   is.read(reinterpret_cast<char*>(&p->xmtrPwrMtrScale_), 4); // 1236-1239
-   is.read(reinterpret_cast<char*>(&p->vDbz0DeltaLimit_), 4); // 1240-1243
-   is.read(reinterpret_cast<char*>(&p->tarHDbz0Sp_), 4);      // 1244-1247
-   is.read(reinterpret_cast<char*>(&p->tarVDbz0Sp_), 4);      // 1248-1251
-   is.read(reinterpret_cast<char*>(&p->deltaprf_), 4);        // 1252-1255
-
-   is.seekg(8, std::ios_base::cur); // 1256-1263
-
-   is.read(reinterpret_cast<char*>(&p->tauSp_), 4);       // 1264-1267
-   is.read(reinterpret_cast<char*>(&p->tauLp_), 4);       // 1268-1271
-   is.read(reinterpret_cast<char*>(&p->ncDeadValue_), 4); // 1272-1275
-   is.read(reinterpret_cast<char*>(&p->tauRfSp_), 4);     // 1276-1279
-   is.read(reinterpret_cast<char*>(&p->tauRfLp_), 4);     // 1280-1283
-   is.read(reinterpret_cast<char*>(&p->seg1Lim_), 4);     // 1284-1287
-   is.read(reinterpret_cast<char*>(&p->slatsec_), 4);     // 1288-1291
-   is.read(reinterpret_cast<char*>(&p->slonsec_), 4);     // 1292-1295
-
-   is.seekg(4, std::ios_base::cur); // 1296-1299
-
-   is.read(reinterpret_cast<char*>(&p->slatdeg_), 4); // 1300-1303
-   is.read(reinterpret_cast<char*>(&p->slatmin_), 4); // 1304-1307
-   is.read(reinterpret_cast<char*>(&p->slondeg_), 4); // 1308-1311
-   is.read(reinterpret_cast<char*>(&p->slonmin_), 4); // 1312-1315
-   ReadChar(is, p->slatdir_);                         // 1316-1319
-   ReadChar(is, p->slondir_);                         // 1320-1323
-
-   is.seekg(7036, std::ios_base::cur); // 1324-8359
-
-   is.read(reinterpret_cast<char*>(&p->azCorrectionFactor_), 4); // 8360-8363
-   is.read(reinterpret_cast<char*>(&p->elCorrectionFactor_), 4); // 8364-8367
-   is.read(&p->siteName_[0], 4);                                 // 8368-8371
-   is.read(reinterpret_cast<char*>(&p->antManualSetup_.ielmin_),
-           4); // 8372-8375
-   is.read(reinterpret_cast<char*>(&p->antManualSetup_.ielmax_),
-           4); // 8376-8379
-   is.read(reinterpret_cast<char*>(&p->antManualSetup_.fazvelmax_),
-           4); // 8380-8383
-   is.read(reinterpret_cast<char*>(&p->antManualSetup_.felvelmax_),
-           4); // 8384-8387
-   is.read(reinterpret_cast<char*>(&p->antManualSetup_.igndHgt_),
-           4); // 8388-8391
-   is.read(reinterpret_cast<char*>(&p->antManualSetup_.iradHgt_),
-           4);                                                   // 8392-8395
-   is.read(reinterpret_cast<char*>(&p->azPosSustainDrive_), 4);  // 8396-8399
-   is.read(reinterpret_cast<char*>(&p->azNegSustainDrive_), 4);  // 8400-8403
-   is.read(reinterpret_cast<char*>(&p->azNomPosDriveSlope_), 4); // 8404-8407
-   is.read(reinterpret_cast<char*>(&p->azNomNegDriveSlope_), 4); // 8408-8411
-   is.read(reinterpret_cast<char*>(&p->azFeedbackSlope_), 4);    // 8412-8415
-   is.read(reinterpret_cast<char*>(&p->elPosSustainDrive_), 4);  // 8416-8419
-   is.read(reinterpret_cast<char*>(&p->elNegSustainDrive_), 4);  // 8420-8423
-   is.read(reinterpret_cast<char*>(&p->elNomPosDriveSlope_), 4); // 8424-8427
-   is.read(reinterpret_cast<char*>(&p->elNomNegDriveSlope_), 4); // 8428-8431
-   is.read(reinterpret_cast<char*>(&p->elFeedbackSlope_), 4);    // 8432-8435
-   is.read(reinterpret_cast<char*>(&p->elFirstSlope_), 4);       // 8436-8439
-   is.read(reinterpret_cast<char*>(&p->elSecondSlope_), 4);      // 8440-8443
-   is.read(reinterpret_cast<char*>(&p->elThirdSlope_), 4);       // 8444-8447
-   is.read(reinterpret_cast<char*>(&p->elDroopPos_), 4);         // 8448-8451
-   is.read(reinterpret_cast<char*>(&p->elOffNeutralDrive_), 4);  // 8452-8455
-   is.read(reinterpret_cast<char*>(&p->azIntertia_), 4);         // 8456-8459
-   is.read(reinterpret_cast<char*>(&p->elInertia_), 4);          // 8460-8463
-
-   is.seekg(232, std::ios_base::cur); // 8464-8695
-
-   is.read(reinterpret_cast<char*>(&p->rvp8nvIwaveguideLength_),
-           4); // 8696-8699
-
-   is.read(reinterpret_cast<char*>(&p->vRnscale_[0]),
-           11 * 4); // 8700-8743
-
-   is.read(reinterpret_cast<char*>(&p->velDataTover_), 4);     // 8744-8747
-   is.read(reinterpret_cast<char*>(&p->widthDataTover_), 4);   // 8748-8751
-   is.read(reinterpret_cast<char*>(&p->vRnscale_[11]), 2 * 4); // 8752-8759
-
-   is.seekg(4, std::ios_base::cur); // 8760-8763
-
-   is.read(reinterpret_cast<char*>(&p->dopplerRangeStart_), 4); // 8764-8767
-   is.read(reinterpret_cast<char*>(&p->maxElIndex_), 4);        // 8768-8771
-   is.read(reinterpret_cast<char*>(&p->seg2Lim_), 4);           // 8772-8775
-   is.read(reinterpret_cast<char*>(&p->seg3Lim_), 4);           // 8776-8779
-   is.read(reinterpret_cast<char*>(&p->seg4Lim_), 4);           // 8780-8783
-   is.read(reinterpret_cast<char*>(&p->nbrElSegments_), 4);     // 8784-8787
-   is.read(reinterpret_cast<char*>(&p->hNoiseLong_), 4);        // 8788-8791
-   is.read(reinterpret_cast<char*>(&p->antNoiseTemp_), 4);      // 8792-8795
-   is.read(reinterpret_cast<char*>(&p->hNoiseShort_), 4);       // 8796-8799
-   is.read(reinterpret_cast<char*>(&p->hNoiseTolerance_), 4);   // 8800-8803
-   is.read(reinterpret_cast<char*>(&p->minHDynRange_), 4);      // 8804-8807
-   ReadBoolean(is, p->genInstalled_);                           // 8808-8811
-   ReadBoolean(is, p->genExercise_);                            // 8812-8815
-   is.read(reinterpret_cast<char*>(&p->vNoiseTolerance_), 4);   // 8816-8819
-   is.read(reinterpret_cast<char*>(&p->minVDynRange_), 4);      // 8820-8823
-   is.read(reinterpret_cast<char*>(&p->zdrBiasDgradLim_), 4);   // 8824-8827
-   is.read(reinterpret_cast<char*>(&p->baselineZdrBias_), 4);   // 8828-8831
-
-   is.seekg(12, std::ios_base::cur); // 8832-8843
-
-   is.read(reinterpret_cast<char*>(&p->vNoiseLong_), 4);           // 8844-8847
-   is.read(reinterpret_cast<char*>(&p->vNoiseShort_), 4);          // 8848-8851
-   is.read(reinterpret_cast<char*>(&p->zdrDataTover_), 4);         // 8852-8855
-   is.read(reinterpret_cast<char*>(&p->phiDataTover_), 4);         // 8856-8859
-   is.read(reinterpret_cast<char*>(&p->rhoDataTover_), 4);         // 8860-8863
-   is.read(reinterpret_cast<char*>(&p->staloPowerDgradLimit_), 4); // 8864-8867
-   is.read(reinterpret_cast<char*>(&p->staloPowerMaintLimit_), 4); // 8868-8871
-   is.read(reinterpret_cast<char*>(&p->minHPwrSense_), 4);         // 8872-8875
-   is.read(reinterpret_cast<char*>(&p->minVPwrSense_), 4);         // 8876-8879
-   is.read(reinterpret_cast<char*>(&p->hPwrSenseOffset_), 4);      // 8880-8883
-   is.read(reinterpret_cast<char*>(&p->vPwrSenseOffset_), 4);      // 8884-8887
-   is.read(reinterpret_cast<char*>(&p->psGainRef_), 4);            // 8888-8891
-   is.read(reinterpret_cast<char*>(&p->rfPalletBroadLoss_), 4);    // 8892-8895
-
-   is.seekg(64, std::ios_base::cur); // 8896-8959
-
-   is.read(reinterpret_cast<char*>(&p->amePsTolerance_), 4);      // 8960-8963
-   is.read(reinterpret_cast<char*>(&p->ameMaxTemp_), 4);          // 8964-8967
-   is.read(reinterpret_cast<char*>(&p->ameMinTemp_), 4);          // 8968-8971
-   is.read(reinterpret_cast<char*>(&p->rcvrModMaxTemp_), 4);      // 8972-8975
-   is.read(reinterpret_cast<char*>(&p->rcvrModMinTemp_), 4);      // 8976-8979
-   is.read(reinterpret_cast<char*>(&p->biteModMaxTemp_), 4);      // 8980-8983
-   is.read(reinterpret_cast<char*>(&p->biteModMinTemp_), 4);      // 8984-8987
-   is.read(reinterpret_cast<char*>(&p->defaultPolarization_), 4); // 8988-8991
-   is.read(reinterpret_cast<char*>(&p->trLimitDgradLimit_), 4);   // 8992-8995
-   is.read(reinterpret_cast<char*>(&p->trLimitFailLimit_), 4);    // 8996-8999
-   ReadBoolean(is, p->rfpStepperEnabled_);                        // 9000-9003
-
-   is.seekg(4, std::ios_base::cur); // 9004-9007
-
-   is.read(reinterpret_cast<char*>(&p->ameCurrentTolerance_), 4); // 9008-9011
-   is.read(reinterpret_cast<char*>(&p->hOnlyPolarization_), 4);   // 9012-9015
-   is.read(reinterpret_cast<char*>(&p->vOnlyPolarization_), 4);   // 9016-9019
-
-   is.seekg(8, std::ios_base::cur); // 9020-9027
-
-   is.read(reinterpret_cast<char*>(&p->sunBias_), 4);             // 9028-9031
-   is.read(reinterpret_cast<char*>(&p->aMinShelterTempWarn_), 4); // 9032-9035
-   is.read(reinterpret_cast<char*>(&p->powerMeterZero_), 4);      // 9036-9039
-   is.read(reinterpret_cast<char*>(&p->txbBaseline_), 4);         // 9040-9043
-   is.read(reinterpret_cast<char*>(&p->txbAlarmThresh_), 4);      // 9044-9047
-
-   is.seekg(420, std::ios_base::cur); // 9048-9467
-
-   bytesRead += 9468;
-
-   p->lowerPreLimit_ = SwapFloat(p->lowerPreLimit_);
-   p->azLat_         = SwapFloat(p->azLat_);
-   p->upperPreLimit_ = SwapFloat(p->upperPreLimit_);
-   p->elLat_         = SwapFloat(p->elLat_);
-   p->parkaz_        = SwapFloat(p->parkaz_);
-   p->parkel_        = SwapFloat(p->parkel_);
-
-   SwapArray(p->aFuelConv_);
-
-   p->aMinShelterTemp_       = SwapFloat(p->aMinShelterTemp_);
-   p->aMaxShelterTemp_       = SwapFloat(p->aMaxShelterTemp_);
-   p->aMinShelterAcTempDiff_ = SwapFloat(p->aMinShelterAcTempDiff_);
-   p->aMaxXmtrAirTemp_       = SwapFloat(p->aMaxXmtrAirTemp_);
-   p->aMaxRadTemp_           = SwapFloat(p->aMaxRadTemp_);
-   p->aMaxRadTempRise_       = SwapFloat(p->aMaxRadTempRise_);
-   p->lowerDeadLimit_        = SwapFloat(p->lowerDeadLimit_);
-   p->upperDeadLimit_        = SwapFloat(p->upperDeadLimit_);
-   p->aMinGenRoomTemp_       = SwapFloat(p->aMinGenRoomTemp_);
-   p->aMaxGenRoomTemp_       = SwapFloat(p->aMaxGenRoomTemp_);
-   p->spip5VRegLim_          = SwapFloat(p->spip5VRegLim_);
-   p->spip15VRegLim_         = SwapFloat(p->spip15VRegLim_);
-   p->aHvdlTstInt_           = ntohl(p->aHvdlTstInt_);
-   p->aRpgLtInt_             = ntohl(p->aRpgLtInt_);
-   p->aMinStabUtilPwrTime_   = ntohl(p->aMinStabUtilPwrTime_);
-   p->aGenAutoExerInterval_  = ntohl(p->aGenAutoExerInterval_);
-   p->aUtilPwrSwReqInterval_ = ntohl(p->aUtilPwrSwReqInterval_);
-   p->aLowFuelLevel_         = SwapFloat(p->aLowFuelLevel_);
-   p->configChanNumber_      = ntohl(p->configChanNumber_);
-   p->redundantChanConfig_   = ntohl(p->redundantChanConfig_);
-
-   SwapArray(p->attenTable_);
-   SwapMap(p->pathLosses_);
-
-   p->vTsCw_ = SwapFloat(p->vTsCw_);
-
-   SwapArray(p->hRnscale_);
-   SwapArray(p->atmos_);
-   SwapArray(p->elIndex_);
-
-   p->tfreqMhz_                  = ntohl(p->tfreqMhz_);
-   p->baseDataTcn_               = SwapFloat(p->baseDataTcn_);
-   p->reflDataTover_             = SwapFloat(p->reflDataTover_);
-   p->tarHDbz0Lp_                = SwapFloat(p->tarHDbz0Lp_);
-   p->tarVDbz0Lp_                = SwapFloat(p->tarVDbz0Lp_);
-   p->initPhiDp_                 = ntohl(p->initPhiDp_);
-   p->normInitPhiDp_             = ntohl(p->normInitPhiDp_);
-   p->lxLp_                      = SwapFloat(p->lxLp_);
-   p->lxSp_                      = SwapFloat(p->lxSp_);
-   p->meteorParam_               = SwapFloat(p->meteorParam_);
-   p->antennaGain_               = SwapFloat(p->antennaGain_);
-   p->velDegradLimit_            = SwapFloat(p->velDegradLimit_);
-   p->wthDegradLimit_            = SwapFloat(p->wthDegradLimit_);
-   p->hNoisetempDgradLimit_      = SwapFloat(p->hNoisetempDgradLimit_);
-   p->hMinNoisetemp_             = ntohl(p->hMinNoisetemp_);
-   p->vNoisetempDgradLimit_      = SwapFloat(p->vNoisetempDgradLimit_);
-   p->vMinNoisetemp_             = ntohl(p->vMinNoisetemp_);
-   p->klyDegradeLimit_           = SwapFloat(p->klyDegradeLimit_);
-   p->tsCoho_                    = SwapFloat(p->tsCoho_);
-   p->hTsCw_                     = SwapFloat(p->hTsCw_);
-   p->tsStalo_                   = SwapFloat(p->tsStalo_);
-   p->ameHNoiseEnr_              = SwapFloat(p->ameHNoiseEnr_);
-   p->xmtrPeakPwrHighLimit_      = SwapFloat(p->xmtrPeakPwrHighLimit_);
-   p->xmtrPeakPwrLowLimit_       = SwapFloat(p->xmtrPeakPwrLowLimit_);
-   p->hDbz0DeltaLimit_           = SwapFloat(p->hDbz0DeltaLimit_);
-   p->threshold1_                = SwapFloat(p->threshold1_);
-   p->threshold2_                = SwapFloat(p->threshold2_);
-   p->clutSuppDgradLim_          = SwapFloat(p->clutSuppDgradLim_);
-   p->range0Value_               = SwapFloat(p->range0Value_);
-   p->xmtrPwrMtrScale_           = SwapFloat(p->xmtrPwrMtrScale_);
-   p->vDbz0DeltaLimit_           = SwapFloat(p->vDbz0DeltaLimit_);
-   p->tarHDbz0Sp_                = SwapFloat(p->tarHDbz0Sp_);
-   p->tarVDbz0Sp_                = SwapFloat(p->tarVDbz0Sp_);
-   p->deltaprf_                  = ntohl(p->deltaprf_);
-   p->tauSp_                     = ntohl(p->tauSp_);
-   p->tauLp_                     = ntohl(p->tauLp_);
-   p->ncDeadValue_               = ntohl(p->ncDeadValue_);
-   p->tauRfSp_                   = ntohl(p->tauRfSp_);
-   p->tauRfLp_                   = ntohl(p->tauRfLp_);
-   p->seg1Lim_                   = SwapFloat(p->seg1Lim_);
-   p->slatsec_                   = SwapFloat(p->slatsec_);
-   p->slonsec_                   = SwapFloat(p->slonsec_);
-   p->slatdeg_                   = ntohl(p->slatdeg_);
-   p->slatmin_                   = ntohl(p->slatmin_);
-   p->slondeg_                   = ntohl(p->slondeg_);
-   p->slonmin_                   = ntohl(p->slonmin_);
-   p->azCorrectionFactor_        = SwapFloat(p->azCorrectionFactor_);
-   p->elCorrectionFactor_        = SwapFloat(p->elCorrectionFactor_);
-   p->antManualSetup_.ielmin_    = ntohl(p->antManualSetup_.ielmin_);
-   p->antManualSetup_.ielmax_    = ntohl(p->antManualSetup_.ielmax_);
-   p->antManualSetup_.fazvelmax_ = ntohl(p->antManualSetup_.fazvelmax_);
-   p->antManualSetup_.felvelmax_ = ntohl(p->antManualSetup_.felvelmax_);
-   p->antManualSetup_.igndHgt_   = ntohl(p->antManualSetup_.igndHgt_);
-   p->antManualSetup_.iradHgt_   = ntohl(p->antManualSetup_.iradHgt_);
-   p->azPosSustainDrive_         = SwapFloat(p->azPosSustainDrive_);
-   p->azNegSustainDrive_         = SwapFloat(p->azNegSustainDrive_);
-   p->azNomPosDriveSlope_        = SwapFloat(p->azNomPosDriveSlope_);
-   p->azNomNegDriveSlope_        = SwapFloat(p->azNomNegDriveSlope_);
-   p->azFeedbackSlope_           = SwapFloat(p->azFeedbackSlope_);
-   p->elPosSustainDrive_         = SwapFloat(p->elPosSustainDrive_);
-   p->elNegSustainDrive_         = SwapFloat(p->elNegSustainDrive_);
-   p->elNomPosDriveSlope_        = SwapFloat(p->elNomPosDriveSlope_);
-   p->elNomNegDriveSlope_        = SwapFloat(p->elNomNegDriveSlope_);
-   p->elFeedbackSlope_           = SwapFloat(p->elFeedbackSlope_);
-   p->elFirstSlope_              = SwapFloat(p->elFirstSlope_);
-   p->elSecondSlope_             = SwapFloat(p->elSecondSlope_);
-   p->elThirdSlope_              = SwapFloat(p->elThirdSlope_);
-   p->elDroopPos_                = SwapFloat(p->elDroopPos_);
-   p->elOffNeutralDrive_         = SwapFloat(p->elOffNeutralDrive_);
-   p->azIntertia_                = SwapFloat(p->azIntertia_);
-   p->elInertia_                 = SwapFloat(p->elInertia_);
-   p->rvp8nvIwaveguideLength_    = ntohl(p->rvp8nvIwaveguideLength_);
-
-   SwapArray(p->vRnscale_);
-
-   p->velDataTover_         = SwapFloat(p->velDataTover_);
-   p->widthDataTover_       = SwapFloat(p->widthDataTover_);
-   p->dopplerRangeStart_    = SwapFloat(p->dopplerRangeStart_);
-   p->maxElIndex_           = ntohl(p->maxElIndex_);
-   p->seg2Lim_              = SwapFloat(p->seg2Lim_);
-   p->seg3Lim_              = SwapFloat(p->seg3Lim_);
-   p->seg4Lim_              = SwapFloat(p->seg4Lim_);
-   p->nbrElSegments_        = ntohl(p->nbrElSegments_);
-   p->hNoiseLong_           = SwapFloat(p->hNoiseLong_);
-   p->antNoiseTemp_         = SwapFloat(p->antNoiseTemp_);
-   p->hNoiseShort_          = SwapFloat(p->hNoiseShort_);
-   p->hNoiseTolerance_      = SwapFloat(p->hNoiseTolerance_);
-   p->minHDynRange_         = SwapFloat(p->minHDynRange_);
-   p->vNoiseTolerance_      = SwapFloat(p->vNoiseTolerance_);
-   p->minVDynRange_         = SwapFloat(p->minVDynRange_);
-   p->zdrBiasDgradLim_      = SwapFloat(p->zdrBiasDgradLim_);
-   p->baselineZdrBias_      = SwapFloat(p->baselineZdrBias_);
-   p->vNoiseLong_           = SwapFloat(p->vNoiseLong_);
-   p->vNoiseShort_          = SwapFloat(p->vNoiseShort_);
-   p->zdrDataTover_         = SwapFloat(p->zdrDataTover_);
-   p->phiDataTover_         = SwapFloat(p->phiDataTover_);
-   p->rhoDataTover_         = SwapFloat(p->rhoDataTover_);
-   p->staloPowerDgradLimit_ = SwapFloat(p->staloPowerDgradLimit_);
-   p->staloPowerMaintLimit_ = SwapFloat(p->staloPowerMaintLimit_);
-   p->minHPwrSense_         = SwapFloat(p->minHPwrSense_);
-   p->minVPwrSense_         = SwapFloat(p->minVPwrSense_);
-   p->hPwrSenseOffset_      = SwapFloat(p->hPwrSenseOffset_);
-   p->vPwrSenseOffset_      = SwapFloat(p->vPwrSenseOffset_);
-   p->psGainRef_            = SwapFloat(p->psGainRef_);
-   p->rfPalletBroadLoss_    = SwapFloat(p->rfPalletBroadLoss_);
-   p->amePsTolerance_       = SwapFloat(p->amePsTolerance_);
-   p->ameMaxTemp_           = SwapFloat(p->ameMaxTemp_);
-   p->ameMinTemp_           = SwapFloat(p->ameMinTemp_);
-   p->rcvrModMaxTemp_       = SwapFloat(p->rcvrModMaxTemp_);
-   p->rcvrModMinTemp_       = SwapFloat(p->rcvrModMinTemp_);
-   p->biteModMaxTemp_       = SwapFloat(p->biteModMaxTemp_);
-   p->biteModMinTemp_       = SwapFloat(p->biteModMinTemp_);
-   p->defaultPolarization_  = ntohl(p->defaultPolarization_);
-   p->trLimitDgradLimit_    = SwapFloat(p->trLimitDgradLimit_);
-   p->trLimitFailLimit_     = SwapFloat(p->trLimitFailLimit_);
-   p->ameCurrentTolerance_  = SwapFloat(p->ameCurrentTolerance_);
-   p->hOnlyPolarization_    = ntohl(p->hOnlyPolarization_);
-   p->vOnlyPolarization_    = ntohl(p->vOnlyPolarization_);
-   p->sunBias_              = SwapFloat(p->sunBias_);
-   p->aMinShelterTempWarn_  = SwapFloat(p->aMinShelterTempWarn_);
-   p->powerMeterZero_       = SwapFloat(p->powerMeterZero_);
-   p->txbBaseline_          = SwapFloat(p->txbBaseline_);
-   p->txbAlarmThresh_       = SwapFloat(p->txbAlarmThresh_);
+   using Impl = RdaAdaptationDataImpl;
+   using util::ElementField;
+   using util::Field;
+   using util::FixedString;
+
+   using Layout = util::RecordLayout<
+      9468,
+      Field<&Impl::adapFileName_, 0, FixedString<12>>, // 0-11
+      Field<&Impl::adapFormat_, 12, FixedString<4>>,   // 12-15
+      Field<&Impl::adapRevision_, 16, FixedString<4>>, // 16-19
+      Field<&Impl::adapDate_, 20, FixedString<12>>,    // 20-31
+      Field<&Impl::adapTime_, 32, FixedString<12>>,    // 32-43
+
+      Field<&Impl::lowerPreLimit_, 44>, // 44-47
+      Field<&Impl::azLat_, 48>,         // 48-51
+      Field<&Impl::upperPreLimit_, 52>, // 52-55
+      Field<&Impl::elLat_, 56>,         // 56-59
+      Field<&Impl::parkaz_, 60>,        // 60-63
+      Field<&Impl::parkel_, 64>,        // 64-67
+
+      Field<&Impl::aFuelConv_, 68>, // 68-111
+
+      Field<&Impl::aMinShelterTemp_, 112>,       // 112-115
+      Field<&Impl::aMaxShelterTemp_, 116>,       // 116-119
+      Field<&Impl::aMinShelterAcTempDiff_, 120>, // 120-123
+      Field<&Impl::aMaxXmtrAirTemp_, 124>,       // 124-127
+      Field<&Impl::aMaxRadTemp_, 128>,           // 128-131
+      Field<&Impl::aMaxRadTempRise_, 132>,       // 132-135
+      Field<&Impl::lowerDeadLimit_, 136>,        // 136-139
+      Field<&Impl::upperDeadLimit_, 140>,        // 140-143
+
+      Field<&Impl::aMinGenRoomTemp_, 148>, // 148-151
+      Field<&Impl::aMaxGenRoomTemp_, 152>, // 152-155
+      Field<&Impl::spip5VRegLim_, 156>,    // 156-159
+      Field<&Impl::spip15VRegLim_, 160>,   // 160-163
+
+      Field<&Impl::rpgCoLocated_, 176, AdaptationBoolean>,        // 176-179
+      Field<&Impl::specFilterInstalled_, 180, AdaptationBoolean>, // 180-183
+      Field<&Impl::tpsInstalled_, 184, AdaptationBoolean>,        // 184-187
+      Field<&Impl::rmsInstalled_, 188, AdaptationBoolean>,        // 188-191
+
+      Field<&Impl::aHvdlTstInt_, 192>,           // 192-195
+      Field<&Impl::aRpgLtInt_, 196>,             // 196-199
+      Field<&Impl::aMinStabUtilPwrTime_, 200>,   // 200-203
+      Field<&Impl::aGenAutoExerInterval_, 204>,  // 204-207
+      Field<&Impl::aUtilPwrSwReqInterval_, 208>, // 208-211
+      Field<&Impl::aLowFuelLevel_, 212>,         // 212-215
+      Field<&Impl::configChanNumber_, 216>,      // 216-219
+
+      Field<&Impl::redundantChanConfig_, 224>, // 224-227
+
+      Field<&Impl::attenTable_, 228>, // 228-643
+
+      ElementField<&Impl::pathLosses_, 7, 668>,     // 668-671
+      ElementField<&Impl::pathLosses_, 13, 692>,    // 692-695
+      ElementField<&Impl::pathLosses_, 28, 752, 2>, // 752-759
+      ElementField<&Impl::pathLosses_, 32, 768, 2>, // 768-775
+      ElementField<&Impl::pathLosses_, 35, 780>,    // 780-783
+      ElementField<&Impl::pathLosses_, 39, 796, 2>, // 796-803
+      ElementField<&Impl::pathLosses_, 42, 808, 8>, // 808-839
+      ElementField<&Impl::pathLosses_, 51, 844, 3>, // 844-855
+      ElementField<&Impl::pathLosses_, 56, 864, 6>, // 864-887
+      ElementField<&Impl::pathLosses_, 63, 892, 6>, // 892-915
+      ElementField<&Impl::pathLosses_, 70, 920, 2>, // 920-927
+
+      Field<&Impl::vTsCw_, 936>, // 936-939
+
+      Field<&Impl::hRnscale_, 940>, // 940-991
+
+      Field<&Impl::atmos_, 992>, // 992-1043
+
+      Field<&Impl::elIndex_, 1044>, // 1044-1091
+
+      Field<&Impl::tfreqMhz_, 1092>,      // 1092-1095
+      Field<&Impl::baseDataTcn_, 1096>,   // 1096-1099
+      Field<&Impl::reflDataTover_, 1100>, // 1100-1103
+      Field<&Impl::tarHDbz0Lp_, 1104>,    // 1104-1107
+      Field<&Impl::tarVDbz0Lp_, 1108>,    // 1108-1111
+      Field<&Impl::initPhiDp_, 1112>,     // 1112-1115
+      Field<&Impl::normInitPhiDp_, 1116>, // 1116-1119
+      Field<&Impl::lxLp_, 1120>,          // 1120-1123
+      Field<&Impl::lxSp_, 1124>,          // 1124-1127
+      Field<&Impl::meteorParam_, 1128>,   // 1128-1131
+
+      Field<&Impl::antennaGain_, 1136>, // 1136-1139
+
+      Field<&Impl::velDegradLimit_, 1152>,       // 1152-1155
+      Field<&Impl::wthDegradLimit_, 1156>,       // 1156-1159
+      Field<&Impl::hNoisetempDgradLimit_, 1160>, // 1160-1163
+      Field<&Impl::hMinNoisetemp_, 1164>,        // 1164-1167
+      Field<&Impl::vNoisetempDgradLimit_, 1168>, // 1168-1171
+      Field<&Impl::vMinNoisetemp_, 1172>,        // 1172-1175
+      Field<&Impl::klyDegradeLimit_, 1176>,      // 1176-1179
+      Field<&Impl::tsCoho_, 1180>,               // 1180-1183
+      Field<&Impl::hTsCw_, 1184>,                // 1184-1187
+
+      Field<&Impl::tsStalo_, 1196>,              // 1196-1199
+      Field<&Impl::ameHNoiseEnr_, 1200>,         // 1200-1203
+      Field<&Impl::xmtrPeakPwrHighLimit_, 1204>, // 1204-1207
+      Field<&Impl::xmtrPeakPwrLowLimit_, 1208>,  // 1208-1211
+      Field<&Impl::hDbz0DeltaLimit_, 1212>,      // 1212-1215
+      Field<&Impl::threshold1_, 1216>,           // 1216-1219
+      Field<&Impl::threshold2_, 1220>,           // 1220-1223
+      Field<&Impl::clutSuppDgradLim_, 1224>,     // 1224-1227
+
+      Field<&Impl::range0Value_, 1232>,     // 1232-1235
+      Field<&Impl::xmtrPwrMtrScale_, 1236>, // 1236-1239
+      Field<&Impl::vDbz0DeltaLimit_, 1240>, // 1240-1243
+      Field<&Impl::tarHDbz0Sp_, 1244>,      // 1244-1247
+      Field<&Impl::tarVDbz0Sp_, 1248>,      // 1248-1251
+      Field<&Impl::deltaprf_, 1252>,        // 1252-1255
+
+      Field<&Impl::tauSp_, 1264>,       // 1264-1267
+      Field<&Impl::tauLp_, 1268>,       // 1268-1271
+      Field<&Impl::ncDeadValue_, 1272>, // 1272-1275
+      Field<&Impl::tauRfSp_, 1276>,     // 1276-1279
+      Field<&Impl::tauRfLp_, 1280>,     // 1280-1283
+      Field<&Impl::seg1Lim_, 1284>,     // 1284-1287
+      Field<&Impl::slatsec_, 1288>,     // 1288-1291
+      Field<&Impl::slonsec_, 1292>,     // 1292-1295
+
+      Field<&Impl::slatdeg_, 1300>,                 // 1300-1303
+      Field<&Impl::slatmin_, 1304>,                 // 1304-1307
+      Field<&Impl::slondeg_, 1308>,                 // 1308-1311
+      Field<&Impl::slonmin_, 1312>,                 // 1312-1315
+      Field<&Impl::slatdir_, 1316, AdaptationChar>, // 1316-1319
+      Field<&Impl::slondir_, 1320, AdaptationChar>, // 1320-1323
+
+      Field<&Impl::azCorrectionFactor_, 8360>,                   // 8360-8363
+      Field<&Impl::elCorrectionFactor_, 8364>,                   // 8364-8367
+      Field<&Impl::siteName_, 8368, FixedString<4>>,             // 8368-8371
+      Field<&Impl::antManualSetup_, 8372, AntManualSetupLayout>, // 8372-8395
+      Field<&Impl::azPosSustainDrive_, 8396>,                    // 8396-8399
+      Field<&Impl::azNegSustainDrive_, 8400>,                    // 8400-8403
+      Field<&Impl::azNomPosDriveSlope_, 8404>,                   // 8404-8407
+      Field<&Impl::azNomNegDriveSlope_, 8408>,                   // 8408-8411
+      Field<&Impl::azFeedbackSlope_, 8412>,                      // 8412-8415
+      Field<&Impl::elPosSustainDrive_, 8416>,                    // 8416-8419
+      Field<&Impl::elNegSustainDrive_, 8420>,                    // 8420-8423
+      Field<&Impl::elNomPosDriveSlope_, 8424>,                   // 8424-8427
+      Field<&Impl::elNomNegDriveSlope_, 8428>,                   // 8428-8431
+      Field<&Impl::elFeedbackSlope_, 8432>,                      // 8432-8435
+      Field<&Impl::elFirstSlope_, 8436>,                         // 8436-8439
+      Field<&Impl::elSecondSlope_, 8440>,                        // 8440-8443
+      Field<&Impl::elThirdSlope_, 8444>,                         // 8444-8447
+      Field<&Impl::elDroopPos_, 8448>,                           // 8448-8451
+      Field<&Impl::elOffNeutralDrive_, 8452>,                    // 8452-8455
+      Field<&Impl::azIntertia_, 8456>,                           // 8456-8459
+      Field<&Impl::elInertia_, 8460>,                            // 8460-8463
+
+      Field<&Impl::rvp8nvIwaveguideLength_, 8696>, // 8696-8699
+
+      ElementField<&Impl::vRnscale_, 0, 8700, 11>, // 8700-8743
+
+      Field<&Impl::velDataTover_, 8744>,           // 8744-8747
+      Field<&Impl::widthDataTover_, 8748>,         // 8748-8751
+      ElementField<&Impl::vRnscale_, 11, 8752, 2>, // 8752-8759
+
+      Field<&Impl::dopplerRangeStart_, 8764>,               // 8764-8767
+      Field<&Impl::maxElIndex_, 8768>,                      // 8768-8771
+      Field<&Impl::seg2Lim_, 8772>,                         // 8772-8775
+      Field<&Impl::seg3Lim_, 8776>,                         // 8776-8779
+      Field<&Impl::seg4Lim_, 8780>,                         // 8780-8783
+      Field<&Impl::nbrElSegments_, 8784>,                   // 8784-8787
+      Field<&Impl::hNoiseLong_, 8788>,                      // 8788-8791
+      Field<&Impl::antNoiseTemp_, 8792>,                    // 8792-8795
+      Field<&Impl::hNoiseShort_, 8796>,                     // 8796-8799
+      Field<&Impl::hNoiseTolerance_, 8800>,                 // 8800-8803
+      Field<&Impl::minHDynRange_, 8804>,                    // 8804-8807
+      Field<&Impl::genInstalled_, 8808, AdaptationBoolean>, // 8808-8811
+      Field<&Impl::genExercise_, 8812, AdaptationBoolean>,  // 8812-8815
+      Field<&Impl::vNoiseTolerance_, 8816>,                 // 8816-8819
+      Field<&Impl::minVDynRange_, 8820>,                    // 8820-8823
+      Field<&Impl::zdrBiasDgradLim_, 8824>,                 // 8824-8827
+      Field<&Impl::baselineZdrBias_, 8828>,                 // 8828-8831
+
+      Field<&Impl::vNoiseLong_, 8844>,           // 8844-8847
+      Field<&Impl::vNoiseShort_, 8848>,          // 8848-8851
+      Field<&Impl::zdrDataTover_, 8852>,         // 8852-8855
+      Field<&Impl::phiDataTover_, 8856>,         // 8856-8859
+      Field<&Impl::rhoDataTover_, 8860>,         // 8860-8863
+      Field<&Impl::staloPowerDgradLimit_, 8864>, // 8864-8867
+      Field<&Impl::staloPowerMaintLimit_, 8868>, // 8868-8871
+      Field<&Impl::minHPwrSense_, 8872>,         // 8872-8875
+      Field<&Impl::minVPwrSense_, 8876>,         // 8876-8879
+      Field<&Impl::hPwrSenseOffset_, 8880>,      // 8880-8883
+      Field<&Impl::vPwrSenseOffset_, 8884>,      // 8884-8887
+      Field<&Impl::psGainRef_, 8888>,            // 8888-8891
+      Field<&Impl::rfPalletBroadLoss_, 8892>,    // 8892-8895
+
+      Field<&Impl::amePsTolerance_, 8960>,                       // 8960-8963
+      Field<&Impl::ameMaxTemp_, 8964>,                           // 8964-8967
+      Field<&Impl::ameMinTemp_, 8968>,                           // 8968-8971
+      Field<&Impl::rcvrModMaxTemp_, 8972>,                       // 8972-8975
+      Field<&Impl::rcvrModMinTemp_, 8976>,                       // 8976-8979
+      Field<&Impl::biteModMaxTemp_, 8980>,                       // 8980-8983
+      Field<&Impl::biteModMinTemp_, 8984>,                       // 8984-8987
+      Field<&Impl::defaultPolarization_, 8988>,                  // 8988-8991
+      Field<&Impl::trLimitDgradLimit_, 8992>,                    // 8992-8995
+      Field<&Impl::trLimitFailLimit_, 8996>,                     // 8996-8999
+      Field<&Impl::rfpStepperEnabled_, 9000, AdaptationBoolean>, // 9000-9003
+
+      Field<&Impl::ameCurrentTolerance_, 9008>, // 9008-9011
+      Field<&Impl::hOnlyPolarization_, 9012>,   // 9012-9015
+      Field<&Impl::vOnlyPolarization_, 9016>,   // 9016-9019
+
+      Field<&Impl::sunBias_, 9028>,             // 9028-9031
+      Field<&Impl::aMinShelterTempWarn_, 9032>, // 9032-9035
+      Field<&Impl::powerMeterZero_, 9036>,      // 9036-9039
+      Field<&Impl::txbBaseline_, 9040>,         // 9040-9043
+      Field<&Impl::txbAlarmThresh_, 9044>>;     // 9044-9047
+
+   Layout::Read(is, *p);
+   bytesRead += Layout::kSize;
 
    if (!ValidateMessage(is, bytesRead))
    {
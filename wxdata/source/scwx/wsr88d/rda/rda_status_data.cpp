@@ -1,5 +1,6 @@
 #include <scwx/wsr88d/rda/rda_status_data.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/record_layout.hpp>
 
 namespace scwx
 {
@@ -238,86 +239,53 @@ bool RdaStatusData::Parse(std::istream& is)
    bool   messageValid = true;
    size_t bytesRead    = 0;
 
-   is.read(reinterpret_cast<char*>(&p->rdaStatus_), 2);                    // 1
-   is.read(reinterpret_cast<char*>(&p->operabilityStatus_), 2);            // 2
-   is.read(reinterpret_cast<char*>(&p->controlStatus_), 2);                // 3
-   is.read(reinterpret_cast<char*>(&p->auxiliaryPowerGeneratorState_), 2); // 4
-   is.read(reinterpret_cast<char*>(&p->averageTransmitterPower_), 2);      // 5
-   is.read(
-      reinterpret_cast<char*>(&p->horizontalReflectivityCalibrationCorrection_),
-      2);                                                                 // 6
-   is.read(reinterpret_cast<char*>(&p->dataTransmissionEnabled_), 2);     // 7
-   is.read(reinterpret_cast<char*>(&p->volumeCoveragePatternNumber_), 2); // 8
-   is.read(reinterpret_cast<char*>(&p->rdaControlAuthorization_), 2);     // 9
-   is.read(reinterpret_cast<char*>(&p->rdaBuildNumber_), 2);              // 10
-   is.read(reinterpret_cast<char*>(&p->operationalMode_), 2);             // 11
-   is.read(reinterpret_cast<char*>(&p->superResolutionStatus_), 2);       // 12
-   is.read(reinterpret_cast<char*>(&p->clutterMitigationDecisionStatus_),
-           2);                                                         // 13
-   is.read(reinterpret_cast<char*>(&p->avsetEbcRdaLogDataStatus_), 2); // 14
-   is.read(reinterpret_cast<char*>(&p->rdaAlarmSummary_), 2);          // 15
-   is.read(reinterpret_cast<char*>(&p->commandAcknowledgement_), 2);   // 16
-   is.read(reinterpret_cast<char*>(&p->channelControlStatus_), 2);     // 17
-   is.read(reinterpret_cast<char*>(&p->spotBlankingStatus_), 2);       // 18
-   is.read(reinterpret_cast<char*>(&p->bypassMapGenerationDate_), 2);  // 19
-   is.read(reinterpret_cast<char*>(&p->bypassMapGenerationTime_), 2);  // 20
-   is.read(reinterpret_cast<char*>(&p->clutterFilterMapGenerationDate_),
-           2); // 21
-   is.read(reinterpret_cast<char*>(&p->clutterFilterMapGenerationTime_),
-           2); // 22
-   is.read(
-      reinterpret_cast<char*>(&p->verticalReflectivityCalibrationCorrection_),
-      2);                                                                 // 23
-   is.read(reinterpret_cast<char*>(&p->transitionPowerSourceStatus_), 2); // 24
-   is.read(reinterpret_cast<char*>(&p->rmsControlStatus_), 2);            // 25
-   is.read(reinterpret_cast<char*>(&p->performanceCheckStatus_), 2);      // 26
-   is.read(reinterpret_cast<char*>(&p->alarmCodes_),
-           p->alarmCodes_.size() * 2); // 27-40
-   bytesRead += 80;
-
-   p->rdaStatus_                    = ntohs(p->rdaStatus_);
-   p->operabilityStatus_            = ntohs(p->operabilityStatus_);
-   p->controlStatus_                = ntohs(p->controlStatus_);
-   p->auxiliaryPowerGeneratorState_ = ntohs(p->auxiliaryPowerGeneratorState_);
-   p->averageTransmitterPower_      = ntohs(p->averageTransmitterPower_);
-   p->horizontalReflectivityCalibrationCorrection_ =
-      ntohs(p->horizontalReflectivityCalibrationCorrection_);
-   p->dataTransmissionEnabled_     = ntohs(p->dataTransmissionEnabled_);
-   p->volumeCoveragePatternNumber_ = ntohs(p->volumeCoveragePatternNumber_);
-   p->rdaControlAuthorization_     = ntohs(p->rdaControlAuthorization_);
-   p->rdaBuildNumber_              = ntohs(p->rdaBuildNumber_);
-   p->operationalMode_             = ntohs(p->operationalMode_);
-   p->superResolutionStatus_       = ntohs(p->superResolutionStatus_);
-   p->clutterMitigationDecisionStatus_ =
-      ntohs(p->clutterMitigationDecisionStatus_);
-   p->avsetEbcRdaLogDataStatus_ = ntohs(p->avsetEbcRdaLogDataStatus_);
-   p->rdaAlarmSummary_          = ntohs(p->rdaAlarmSummary_);
-   p->commandAcknowledgement_   = ntohs(p->commandAcknowledgement_);
-   p->channelControlStatus_     = ntohs(p->channelControlStatus_);
-   p->spotBlankingStatus_       = ntohs(p->spotBlankingStatus_);
-   p->bypassMapGenerationDate_  = ntohs(p->bypassMapGenerationDate_);
-   p->bypassMapGenerationTime_  = ntohs(p->bypassMapGenerationTime_);
-   p->clutterFilterMapGenerationDate_ =
-      ntohs(p->clutterFilterMapGenerationDate_);
-   p->clutterFilterMapGenerationTime_ =
-      ntohs(p->clutterFilterMapGenerationTime_);
-   p->verticalReflectivityCalibrationCorrection_ =
-      ntohs(p->verticalReflectivityCalibrationCorrection_);
-   p->transitionPowerSourceStatus_ = ntohs(p->transitionPowerSourceStatus_);
-   p->rmsControlStatus_            = ntohs(p->rmsControlStatus_);
-   p->performanceCheckStatus_      = ntohs(p->performanceCheckStatus_);
-   SwapArray(p->alarmCodes_);
+   using Impl = RdaStatusDataImpl;
+   using util::Field;
+
+   using Layout = util::RecordLayout<
+      80,
+      Field<&Impl::rdaStatus_, 0>,                                    // 1
+      Field<&Impl::operabilityStatus_, 2>,                            // 2
+      Field<&Impl::controlStatus_, 4>,                                // 3
+      Field<&Impl::auxiliaryPowerGeneratorState_, 6>,                 // 4
+      Field<&Impl::averageTransmitterPower_, 8>,                      // 5
+      Field<&Impl::horizontalReflectivityCalibrationCorrection_, 10>, // 6
+      Field<&Impl::dataTransmissionEnabled_, 12>,                     // 7
+      Field<&Impl::volumeCoveragePatternNumber_, 14>,                 // 8
+      Field<&Impl::rdaControlAuthorization_, 16>,                     // 9
+      Field<&Impl::rdaBuildNumber_, 18>,                              // 10
+      Field<&Impl::operationalMode_, 20>,                             // 11
+      Field<&Impl::superResolutionStatus_, 22>,                       // 12
+      Field<&Impl::clutterMitigationDecisionStatus_, 24>,             // 13
+      Field<&Impl::avsetEbcRdaLogDataStatus_, 26>,                    // 14
+      Field<&Impl::rdaAlarmSummary_, 28>,                             // 15
+      Field<&Impl::commandAcknowledgement_, 30>,                      // 16
+      Field<&Impl::channelControlStatus_, 32>,                        // 17
+      Field<&Impl::spotBlankingStatus_, 34>,                          // 18
+      Field<&Impl::bypassMapGenerationDate_, 36>,                     // 19
+      Field<&Impl::bypassMapGenerationTime_, 38>,                     // 20
+      Field<&Impl::clutterFilterMapGenerationDate_, 40>,              // 21
+      Field<&Impl::clutterFilterMapGenerationTime_, 42>,              // 22
+      Field<&Impl::verticalReflectivityCalibrationCorrection_, 44>,   // 23
+      Field<&Impl::transitionPowerSourceStatus_, 46>,                 // 24
+      Field<&Impl::rmsControlStatus_, 48>,                            // 25
+      Field<&Impl::performanceCheckStatus_, 50>,                      // 26
+      Field<&Impl::alarmCodes_, 52>>;                                 // 27-40
+
+   // RDA Build 18.0 extension
+   using ExtensionLayout =
+      util::RecordLayout<40,
+                         Field<&Impl::signalProcessingOptions_, 0>, // 41
+                         Field<&Impl::statusVersion_, 38>>;         // 60
+
+   Layout::Read(is, *p);
+   bytesRead += Layout::kSize;
 
    // RDA Build 18.0 increased the size of the message from 80 to 120 bytes
    if (header().message_size() * 2 > Level2MessageHeader::SIZE + 80)
    {
-      is.read(reinterpret_cast<char*>(&p->signalProcessingOptions_), 2); // 41
-      is.seekg(36, std::ios_base::cur);                        // 42-59
-      is.read(reinterpret_cast<char*>(&p->statusVersion_), 2); // 60
-      bytesRead += 40;
-
-      p->signalProcessingOptions_ = ntohs(p->signalProcessingOptions_);
-      p->statusVersion_           = ntohs(p->statusVersion_);
+      ExtensionLayout::Read(is, *p);
+      bytesRead += ExtensionLayout::kSize;
    }
 
    if (!ValidateMessage(is, bytesRead))
@@ -1,5 +1,6 @@
 #include <scwx/wsr88d/rda/volume_coverage_pattern_data.hpp>
 #include <scwx/util/logger.hpp>
+#include <scwx/util/record_layout.hpp>
 
 namespace scwx
 {
@@ -12,11 +13,6 @@ static const std::string logPrefix_ =
    "scwx::wsr88d::rda::volume_coverage_pattern_data";
 static const auto logger_ = util::Logger::Create(logPrefix_);
 
-struct Sector;
-
-static void ReadSector(std::istream& is, Sector& s);
-static void SwapSector(Sector& s);
-
 struct Sector
 {
    uint16_t edgeAngle_;
@@ -95,6 +91,33 @@ public:
    std::vector<ElevationCut> elevationCuts_;
 };
 
+using SectorLayout = util::RecordLayout<
+   6,
+   util::Field<&Sector::edgeAngle_, 0>,                   // S1
+   util::Field<&Sector::dopplerPrfNumber_, 2>,            // S2
+   util::Field<&Sector::dopplerPrfPulseCountRadial_, 4>>; // S3
+
+using ElevationCutLayout = util::RecordLayout<
+   46,
+   util::Field<&ElevationCut::elevationAngle_, 0>,                      // E1
+   util::Field<&ElevationCut::channelConfiguration_, 2>,                // E2
+   util::Field<&ElevationCut::waveformType_, 3>,                        // E2
+   util::Field<&ElevationCut::superResolutionControl_, 4>,              // E3
+   util::Field<&ElevationCut::surveillancePrfNumber_, 5>,               // E3
+   util::Field<&ElevationCut::surveillancePrfPulseCountRadial_, 6>,     // E4
+   util::Field<&ElevationCut::azimuthRate_, 8>,                         // E5
+   util::Field<&ElevationCut::reflectivityThreshold_, 10>,              // E6
+   util::Field<&ElevationCut::velocityThreshold_, 12>,                  // E7
+   util::Field<&ElevationCut::spectrumWidthThreshold_, 14>,             // E8
+   util::Field<&ElevationCut::differentialReflectivityThreshold_, 16>,  // E9
+   util::Field<&ElevationCut::differentialPhaseThreshold_, 18>,         // E10
+   util::Field<&ElevationCut::correlationCoefficientThreshold_, 20>,    // E11
+   util::ElementField<&ElevationCut::sector_, 0, 22, 1, SectorLayout>,  // E12
+   util::Field<&ElevationCut::supplementalData_, 28>,                   // E15
+   util::ElementField<&ElevationCut::sector_, 1, 30, 1, SectorLayout>,  // E16
+   util::Field<&ElevationCut::ebcAngle_, 36>,                           // E19
+   util::ElementField<&ElevationCut::sector_, 2, 38, 1, SectorLayout>>; // E20
+
 VolumeCoveragePatternData::VolumeCoveragePatternData() :
     Level2Message(), p(std::make_unique<VolumeCoveragePatternDataImpl>())
 {
@@ -395,29 +418,30 @@ bool VolumeCoveragePatternData::Parse(std::istream& is)
    bool   messageValid = true;
    size_t bytesRead    = 0;
 
-   uint16_t messageSize           = 0;
-   uint16_t numberOfElevationCuts = 0;
-
-   is.read(reinterpret_cast<char*>(&messageSize), 2);                   // 1
-   is.read(reinterpret_cast<char*>(&p->patternType_), 2);               // 2
-   is.read(reinterpret_cast<char*>(&p->patternNumber_), 2);             // 3
-   is.read(reinterpret_cast<char*>(&numberOfElevationCuts), 2);         // 4
-   is.read(reinterpret_cast<char*>(&p->version_), 1);                   // 5
-   is.read(reinterpret_cast<char*>(&p->clutterMapGroupNumber_), 1);     // 5
-   is.read(reinterpret_cast<char*>(&p->dopplerVelocityResolution_), 1); // 6
-   is.read(reinterpret_cast<char*>(&p->pulseWidth_), 1);                // 6
-   is.seekg(4, std::ios_base::cur);                                     // 7-8
-   is.read(reinterpret_cast<char*>(&p->vcpSequencing_), 2);             // 9
-   is.read(reinterpret_cast<char*>(&p->vcpSupplementalData_), 2);       // 10
-   is.seekg(2, std::ios_base::cur);                                     // 11
-   bytesRead += 22;
-
-   messageSize             = ntohs(messageSize);
-   p->patternType_         = ntohs(p->patternType_);
-   p->patternNumber_       = ntohs(p->patternNumber_);
-   numberOfElevationCuts   = ntohs(numberOfElevationCuts);
-   p->vcpSequencing_       = ntohs(p->vcpSequencing_);
-   p->vcpSupplementalData_ = ntohs(p->vcpSupplementalData_);
+   using Impl = VolumeCoveragePatternDataImpl;
+   using util::Field;
+
+   using HeaderLayout = util::RecordLayout<
+      22,
+      Field<&Impl::patternType_, 2>,                // 2
+      Field<&Impl::patternNumber_, 4>,              // 3
+      Field<&Impl::version_, 8>,                    // 5
+      Field<&Impl::clutterMapGroupNumber_, 9>,      // 5
+      Field<&Impl::dopplerVelocityResolution_, 10>, // 6
+      Field<&Impl::pulseWidth_, 11>,                // 6
+      Field<&Impl::vcpSequencing_, 16>,             // 9
+      Field<&Impl::vcpSupplementalData_, 18>>;      // 10
+
+   std::array<std::uint8_t, HeaderLayout::kSize> header {};
+   is.read(reinterpret_cast<char*>(header.data()), header.size());
+   bytesRead += header.size();
+
+   HeaderLayout::Load(header.data(), *p);
+
+   const std::uint16_t messageSize =
+      util::LoadBigEndian<std::uint16_t>(&header[0]); // 1
+   std::uint16_t numberOfElevationCuts =
+      util::LoadBigEndian<std::uint16_t>(&header[6]); // 4
 
    if (messageSize == 0)
    {
@@ -446,53 +470,20 @@ bool VolumeCoveragePatternData::Parse(std::istream& is)
 
    p->elevationCuts_.resize(numberOfElevationCuts);
 
-   for (uint16_t e = 0; e < numberOfElevationCuts; ++e)
+   // Read all elevation cuts at once
+   std::vector<std::uint8_t> cutData(numberOfElevationCuts *
+                                     ElevationCutLayout::kSize);
+   is.read(reinterpret_cast<char*>(cutData.data()),
+           static_cast<std::streamsize>(cutData.size()));
+   bytesRead += cutData.size();
+
+   if (is)
    {
-      ElevationCut& c = p->elevationCuts_[e];
-
-      is.read(reinterpret_cast<char*>(&c.elevationAngle_), 2);         // E1
-      is.read(reinterpret_cast<char*>(&c.channelConfiguration_), 1);   // E2
-      is.read(reinterpret_cast<char*>(&c.waveformType_), 1);           // E2
-      is.read(reinterpret_cast<char*>(&c.superResolutionControl_), 1); // E3
-      is.read(reinterpret_cast<char*>(&c.surveillancePrfNumber_), 1);  // E3
-      is.read(reinterpret_cast<char*>(&c.surveillancePrfPulseCountRadial_),
-              2);                                                      // E4
-      is.read(reinterpret_cast<char*>(&c.azimuthRate_), 2);            // E5
-      is.read(reinterpret_cast<char*>(&c.reflectivityThreshold_), 2);  // E6
-      is.read(reinterpret_cast<char*>(&c.velocityThreshold_), 2);      // E7
-      is.read(reinterpret_cast<char*>(&c.spectrumWidthThreshold_), 2); // E8
-      is.read(reinterpret_cast<char*>(&c.differentialReflectivityThreshold_),
-              2); // E9
-      is.read(reinterpret_cast<char*>(&c.differentialPhaseThreshold_),
-              2); // E10
-      is.read(reinterpret_cast<char*>(&c.correlationCoefficientThreshold_),
-              2);                                                // E11
-      ReadSector(is, c.sector_[0]);                              // E12-E14
-      is.read(reinterpret_cast<char*>(&c.supplementalData_), 2); // E15
-      ReadSector(is, c.sector_[1]);                              // E16-E18
-      is.read(reinterpret_cast<char*>(&c.ebcAngle_), 2);         // E19
-      ReadSector(is, c.sector_[2]);                              // E20-E22
-      is.seekg(2, std::ios_base::cur);                           // E23
-      bytesRead += 46;
-
-      c.elevationAngle_ = ntohs(c.elevationAngle_);
-      c.surveillancePrfPulseCountRadial_ =
-         ntohs(c.surveillancePrfPulseCountRadial_);
-      c.azimuthRate_            = ntohs(c.azimuthRate_);
-      c.reflectivityThreshold_  = ntohs(c.reflectivityThreshold_);
-      c.velocityThreshold_      = ntohs(c.velocityThreshold_);
-      c.spectrumWidthThreshold_ = ntohs(c.spectrumWidthThreshold_);
-      c.differentialReflectivityThreshold_ =
-         ntohs(c.differentialReflectivityThreshold_);
-      c.differentialPhaseThreshold_ = ntohs(c.differentialPhaseThreshold_);
-      c.correlationCoefficientThreshold_ =
-         ntohs(c.correlationCoefficientThreshold_);
-      c.supplementalData_ = ntohs(c.supplementalData_);
-      c.ebcAngle_         = ntohs(c.ebcAngle_);
-
-      for (size_t s = 0; s < c.sector_.size(); s++)
+      for (uint16_t e = 0; e < numberOfElevationCuts; ++e)
       {
-         SwapSector(c.sector_[s]);
+         ElevationCutLayout::Load(cutData.data() +
+                                     e * ElevationCutLayout::kSize,
+                                  p->elevationCuts_[e]);
       }
    }
 
@@ -533,20 +524,6 @@ VolumeCoveragePatternData::Create(Level2MessageHeader&& header,
    return message;
 }
 
-static void ReadSector(std::istream& is, Sector& s)
-{
-   is.read(reinterpret_cast<char*>(&s.edgeAngle_), 2);                  // S1
-   is.read(reinterpret_cast<char*>(&s.dopplerPrfNumber_), 2);           // S2
-   is.read(reinterpret_cast<char*>(&s.dopplerPrfPulseCountRadial_), 2); // S3
-}
-
-static void SwapSector(Sector& s)
-{
-   s.edgeAngle_                  = ntohs(s.edgeAngle_);
-   s.dopplerPrfNumber_           = ntohs(s.dopplerPrfNumber_);
-   s.dopplerPrfPulseCountRadial_ = ntohs(s.dopplerPrfPulseCountRadial_);
-}
-
 } // namespace rda
 } // namespace wsr88d
 } // namespace scwx
@@ -19,7 +19,8 @@ static const auto logger_ = util::Logger::Create(logPrefix_);
 class GraphicAlphanumericBlockImpl
 {
 public:
-   explicit GraphicAlphanumericBlockImpl() :
+   explicit GraphicAlphanumericBlockImpl(PacketArena* arena) :
+       arena_ {arena},
        blockDivider_ {0},
        blockId_ {0},
        lengthOfBlock_ {0},
@@ -29,6 +30,8 @@ public:
    }
    ~GraphicAlphanumericBlockImpl() = default;
 
+   PacketArena* arena_;
+
    int16_t  blockDivider_;
    int16_t  blockId_;
    uint32_t lengthOfBlock_;
@@ -37,8 +40,8 @@ public:
    std::vector<std::vector<std::shared_ptr<Packet>>> pageList_;
 };
 
-GraphicAlphanumericBlock::GraphicAlphanumericBlock() :
-    Message(), p(std::make_unique<GraphicAlphanumericBlockImpl>())
+GraphicAlphanumericBlock::GraphicAlphanumericBlock(PacketArena* arena) :
+    Message(), p(std::make_unique<GraphicAlphanumericBlockImpl>(arena))
 {
 }
 GraphicAlphanumericBlock::~GraphicAlphanumericBlock() = default;
@@ -139,7 +142,8 @@ bool GraphicAlphanumericBlock::Parse(std::istream& is)
 
          while (bytesRead < lengthOfPage)
          {
-            std::shared_ptr<Packet> packet = PacketFactory::Create(is);
+            std::shared_ptr<Packet> packet =
+               PacketFactory::Create(is, p->arena_);
             if (packet != nullptr)
             {
                packetList.push_back(packet);
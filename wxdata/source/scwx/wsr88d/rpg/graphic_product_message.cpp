@@ -51,7 +51,7 @@ public:
    }
    ~GraphicProductMessageImpl() = default;
 
-   bool LoadBlocks(std::istream& is);
+   bool LoadBlocks(std::istream& is, PacketArena* arena);
 
    std::shared_ptr<ProductDescriptionBlock>  descriptionBlock_;
    std::shared_ptr<ProductSymbologyBlock>    symbologyBlock_;
@@ -124,7 +124,7 @@ bool GraphicProductMessage::Parse(std::istream& is)
             std::streamsize   bytesCopied = boost::iostreams::copy(in, ss);
             logger_->trace("Decompressed data size = {} bytes", bytesCopied);
 
-            dataValid = p->LoadBlocks(ss);
+            dataValid = p->LoadBlocks(ss, packet_arena().get());
          }
          catch (const boost::iostreams::bzip2_error& ex)
          {
@@ -135,7 +135,7 @@ bool GraphicProductMessage::Parse(std::istream& is)
       }
       else
       {
-         dataValid = p->LoadBlocks(is);
+         dataValid = p->LoadBlocks(is, packet_arena().get());
       }
    }
 
@@ -148,7 +148,8 @@ bool GraphicProductMessage::Parse(std::istream& is)
    return dataValid;
 }
 
-bool GraphicProductMessageImpl::LoadBlocks(std::istream& is)
+bool GraphicProductMessageImpl::LoadBlocks(std::istream& is,
+                                           PacketArena*  arena)
 {
    bool symbologyValid = true;
    bool graphicValid   = true;
@@ -167,7 +168,7 @@ bool GraphicProductMessageImpl::LoadBlocks(std::istream& is)
 
    if (offsetToSymbology >= offsetBase)
    {
-      symbologyBlock_ = std::make_shared<ProductSymbologyBlock>();
+      symbologyBlock_ = std::make_shared<ProductSymbologyBlock>(arena);
 
       is.seekg(offsetToSymbology - offsetBase, std::ios_base::cur);
       symbologyValid = symbologyBlock_->Parse(is);
@@ -183,7 +184,7 @@ bool GraphicProductMessageImpl::LoadBlocks(std::istream& is)
 
    if (offsetToGraphic >= offsetBase)
    {
-      graphicBlock_ = std::make_shared<GraphicAlphanumericBlock>();
+      graphicBlock_ = std::make_shared<GraphicAlphanumericBlock>(arena);
 
       is.seekg(offsetToGraphic - offsetBase, std::ios_base::cur);
       graphicValid = graphicBlock_->Parse(is);
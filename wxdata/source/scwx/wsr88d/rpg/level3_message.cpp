@@ -12,10 +12,12 @@ static const std::string logPrefix_ = "scwx::wsr88d::rpg::level3_message";
 class Level3MessageImpl
 {
 public:
-   explicit Level3MessageImpl() : header_() {};
+   explicit Level3MessageImpl() :
+       header_(), packetArena_ {PacketArena::Create()} {};
    ~Level3MessageImpl() = default;
 
-   Level3MessageHeader header_;
+   Level3MessageHeader          header_;
+   std::shared_ptr<PacketArena> packetArena_;
 };
 
 Level3Message::Level3Message() :
@@ -48,6 +50,11 @@ Level3Message::description_block() const
    return nullptr;
 }
 
+const std::shared_ptr<PacketArena>& Level3Message::packet_arena() const
+{
+   return p->packetArena_;
+}
+
 } // namespace rpg
 } // namespace wsr88d
 } // namespace scwx
@@ -0,0 +1,83 @@
+#include <scwx/wsr88d/rpg/packet_arena.hpp>
+
+#include <memory_resource>
+
+namespace scwx
+{
+namespace wsr88d
+{
+namespace rpg
+{
+
+// Large enough for the packets of most radial and raster products, which hold
+// their data outside of the arena
+static constexpr std::size_t kInitialBufferSize_ = 4u * 1024u;
+
+class PacketArena::Impl
+{
+public:
+   struct Destructor
+   {
+      void*       object_;
+      void        (*destroy_)(void*);
+      Destructor* next_;
+   };
+
+   explicit Impl() = default;
+   ~Impl()
+   {
+      // Objects are destroyed in reverse order of construction
+      for (Destructor* d = destructors_; d != nullptr; d = d->next_)
+      {
+         d->destroy_(d->object_);
+      }
+   }
+
+   Impl(const Impl&)            = delete;
+   Impl& operator=(const Impl&) = delete;
+
+   std::pmr::monotonic_buffer_resource resource_ {kInitialBufferSize_};
+   Destructor*                         destructors_ {nullptr};
+
+   std::size_t objectCount_ {0u};
+   std::size_t bytesAllocated_ {0u};
+};
+
+PacketArena::PacketArena() : p(std::make_unique<Impl>()) {}
+PacketArena::~PacketArena() = default;
+
+std::shared_ptr<PacketArena> PacketArena::Create()
+{
+   return std::shared_ptr<PacketArena>(new PacketArena());
+}
+
+std::size_t PacketArena::object_count() const
+{
+   return p->objectCount_;
+}
+
+std::size_t PacketArena::bytes_allocated() const
+{
+   return p->bytesAllocated_;
+}
+
+void* PacketArena::Allocate(std::size_t size, std::size_t alignment)
+{
+   p->bytesAllocated_ += size;
+   return p->resource_.allocate(size, alignment);
+}
+
+void PacketArena::AddDestructor(void* object, void (*destroy)(void*))
+{
+   void* memory =
+      Allocate(sizeof(Impl::Destructor), alignof(Impl::Destructor));
+
+   p->destructors_ =
+      ::new (memory) Impl::Destructor {object, destroy, p->destructors_};
+
+   ++p->objectCount_;
+}
+
+} // namespace rpg
+} // namespace wsr88d
+} // namespace scwx
@@ -25,6 +25,7 @@
 #include <scwx/wsr88d/rpg/vector_arrow_data_packet.hpp>
 #include <scwx/wsr88d/rpg/wind_barb_data_packet.hpp>
 
+#include <type_traits>
 #include <unordered_map>
 
 namespace scwx
@@ -37,46 +38,51 @@ namespace rpg
 static const std::string logPrefix_ = "scwx::wsr88d::rpg::packet_factory";
 static const auto        logger_    = util::Logger::Create(logPrefix_);
 
-typedef std::function<std::shared_ptr<Packet>(std::istream&)>
+typedef std::function<std::shared_ptr<Packet>(std::istream&, PacketArena*)>
    CreateMessageFunction;
 
+template<class T>
+static std::shared_ptr<Packet> CreatePacket(std::istream& is,
+                                            PacketArena*  arena);
+
 static const std::unordered_map<unsigned int, CreateMessageFunction> create_ {
-   {1, TextAndSpecialSymbolPacket::Create},
-   {2, TextAndSpecialSymbolPacket::Create},
-   {3, MesocycloneSymbolPacket::Create},
-   {4, WindBarbDataPacket::Create},
-   {5, VectorArrowDataPacket::Create},
-   {6, LinkedVectorPacket::Create},
-   {7, UnlinkedVectorPacket::Create},
-   {8, TextAndSpecialSymbolPacket::Create},
-   {9, LinkedVectorPacket::Create},
-   {10, UnlinkedVectorPacket::Create},
-   {11, MesocycloneSymbolPacket::Create},
-   {12, PointGraphicSymbolPacket::Create},
-   {13, PointGraphicSymbolPacket::Create},
-   {14, PointGraphicSymbolPacket::Create},
-   {15, StormIdSymbolPacket::Create},
-   {16, DigitalRadialDataArrayPacket::Create},
-   {17, DigitalPrecipitationDataArrayPacket::Create},
-   {18, PrecipitationRateDataArrayPacket::Create},
-   {19, HdaHailSymbolPacket::Create},
-   {20, PointFeatureSymbolPacket::Create},
-   {21, CellTrendDataPacket::Create},
-   {22, CellTrendVolumeScanTimes::Create},
-   {23, ScitDataPacket::Create},
-   {24, ScitDataPacket::Create},
-   {25, StiCircleSymbolPacket::Create},
-   {26, PointGraphicSymbolPacket::Create},
-   {28, GenericDataPacket::Create},
-   {29, GenericDataPacket::Create},
-   {0x0802, SetColorLevelPacket::Create},
-   {0x0E03, LinkedContourVectorPacket::Create},
-   {0x3501, UnlinkedContourVectorPacket::Create},
-   {0xAF1F, RadialDataPacket::Create},
-   {0xBA07, RasterDataPacket::Create},
-   {0xBA0F, RasterDataPacket::Create}};
-
-std::shared_ptr<Packet> PacketFactory::Create(std::istream& is)
+   {1, CreatePacket<TextAndSpecialSymbolPacket>},
+   {2, CreatePacket<TextAndSpecialSymbolPacket>},
+   {3, CreatePacket<MesocycloneSymbolPacket>},
+   {4, CreatePacket<WindBarbDataPacket>},
+   {5, CreatePacket<VectorArrowDataPacket>},
+   {6, CreatePacket<LinkedVectorPacket>},
+   {7, CreatePacket<UnlinkedVectorPacket>},
+   {8, CreatePacket<TextAndSpecialSymbolPacket>},
+   {9, CreatePacket<LinkedVectorPacket>},
+   {10, CreatePacket<UnlinkedVectorPacket>},
+   {11, CreatePacket<MesocycloneSymbolPacket>},
+   {12, CreatePacket<PointGraphicSymbolPacket>},
+   {13, CreatePacket<PointGraphicSymbolPacket>},
+   {14, CreatePacket<PointGraphicSymbolPacket>},
+   {15, CreatePacket<StormIdSymbolPacket>},
+   {16, CreatePacket<DigitalRadialDataArrayPacket>},
+   {17, CreatePacket<DigitalPrecipitationDataArrayPacket>},
+   {18, CreatePacket<PrecipitationRateDataArrayPacket>},
+   {19, CreatePacket<HdaHailSymbolPacket>},
+   {20, CreatePacket<PointFeatureSymbolPacket>},
+   {21, CreatePacket<CellTrendDataPacket>},
+   {22, CreatePacket<CellTrendVolumeScanTimes>},
+   {23, CreatePacket<ScitDataPacket>},
+   {24, CreatePacket<ScitDataPacket>},
+   {25, CreatePacket<StiCircleSymbolPacket>},
+   {26, CreatePacket<PointGraphicSymbolPacket>},
+   {28, CreatePacket<GenericDataPacket>},
+   {29, CreatePacket<GenericDataPacket>},
+   {0x0802, CreatePacket<SetColorLevelPacket>},
+   {0x0E03, CreatePacket<LinkedContourVectorPacket>},
+   {0x3501, CreatePacket<UnlinkedContourVectorPacket>},
+   {0xAF1F, CreatePacket<RadialDataPacket>},
+   {0xBA07, CreatePacket<RasterDataPacket>},
+   {0xBA0F, CreatePacket<RasterDataPacket>}};
+
+std::shared_ptr<Packet> PacketFactory::Create(std::istream& is,
+                                              PacketArena*  arena)
 {
    std::shared_ptr<Packet> packet      = nullptr;
    bool                    packetValid = true;
@@ -102,7 +108,37 @@ std::shared_ptr<Packet> PacketFactory::Create(std::istream& is)
    if (packetValid)
    {
       logger_->trace("Found packet code: {0} (0x{0:x})", packetCode);
-      packet = create_.at(packetCode)(is);
+      packet = create_.at(packetCode)(is, arena);
+   }
+
+   return packet;
+}
+
+template<class T>
+static std::shared_ptr<Packet> CreatePacket(std::istream& is,
+                                            PacketArena*  arena)
+{
+   if (arena == nullptr)
+   {
+      return T::Create(is);
+   }
+
+   std::shared_ptr<T> packet;
+
+   // Packets containing other packets construct them in the same arena
+   if constexpr (std::is_constructible_v<T, PacketArena*>)
+   {
+      packet = arena->New<T>(arena);
+   }
+   else
+   {
+      packet = arena->New<T>();
+   }
+
+   // An invalid packet remains in the arena until the arena is destroyed
+   if (!packet->Parse(is))
+   {
+      packet.reset();
    }
 
    return packet;
@@ -19,7 +19,8 @@ static const auto logger_ = util::Logger::Create(logPrefix_);
 class ProductSymbologyBlockImpl
 {
 public:
-   explicit ProductSymbologyBlockImpl() :
+   explicit ProductSymbologyBlockImpl(PacketArena* arena) :
+       arena_ {arena},
        blockDivider_ {0},
        blockId_ {0},
        lengthOfBlock_ {0},
@@ -29,6 +30,8 @@ public:
    }
    ~ProductSymbologyBlockImpl() = default;
 
+   PacketArena* arena_;
+
    int16_t  blockDivider_;
    int16_t  blockId_;
    uint32_t lengthOfBlock_;
@@ -37,8 +40,8 @@ public:
    std::vector<std::vector<std::shared_ptr<Packet>>> layerList_;
 };
 
-ProductSymbologyBlock::ProductSymbologyBlock() :
-    Message(), p(std::make_unique<ProductSymbologyBlockImpl>())
+ProductSymbologyBlock::ProductSymbologyBlock(PacketArena* arena) :
+    Message(), p(std::make_unique<ProductSymbologyBlockImpl>(arena))
 {
 }
 ProductSymbologyBlock::~ProductSymbologyBlock() = default;
@@ -58,7 +61,7 @@ uint16_t ProductSymbologyBlock::number_of_layers() const
    return p->numberOfLayers_;
 }
 
-std::vector<std::shared_ptr<Packet>>
+std::span<const std::shared_ptr<Packet>>
 ProductSymbologyBlock::packet_list(uint16_t i) const
 {
    return p->layerList_[i];
@@ -138,7 +141,8 @@ bool ProductSymbologyBlock::Parse(std::istream& is)
 
          while (bytesRead < lengthOfDataLayer)
          {
-            std::shared_ptr<Packet> packet = PacketFactory::Create(is);
+            std::shared_ptr<Packet> packet =
+               PacketFactory::Create(is, p->arena_);
             if (packet != nullptr)
             {
                packetList.push_back(packet);
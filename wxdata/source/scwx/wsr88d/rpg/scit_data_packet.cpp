@@ -21,19 +21,26 @@ static const std::set<std::uint16_t> packetCodes_ = {23, 24};
 class ScitDataPacket::Impl
 {
 public:
-   explicit Impl() {}
+   explicit Impl(PacketArena* arena) : arena_ {arena} {}
    ~Impl() = default;
 
-   std::vector<std::shared_ptr<Packet>> packetList_ {};
+   PacketArena*         arena_;
+   std::vector<Packet*> packetList_ {};
+
+   // Subpackets allocated individually, when not constructed in an arena
+   std::vector<std::shared_ptr<Packet>> ownedPackets_ {};
 };
 
-ScitDataPacket::ScitDataPacket() : p(std::make_unique<Impl>()) {}
+ScitDataPacket::ScitDataPacket(PacketArena* arena) :
+    p(std::make_unique<Impl>(arena))
+{
+}
 ScitDataPacket::~ScitDataPacket() = default;
 
 ScitDataPacket::ScitDataPacket(ScitDataPacket&&) noexcept            = default;
 ScitDataPacket& ScitDataPacket::operator=(ScitDataPacket&&) noexcept = default;
 
-std::vector<std::shared_ptr<Packet>> ScitDataPacket::packet_list() const
+std::span<Packet* const> ScitDataPacket::packet_list() const
 {
    return p->packetList_;
 }
@@ -63,10 +70,18 @@ bool ScitDataPacket::ParseData(std::istream& is)
 
       while (bytesRead < lengthOfBlock)
       {
-         std::shared_ptr<Packet> packet = PacketFactory::Create(is);
+         std::shared_ptr<Packet> packet = PacketFactory::Create(is, p->arena_);
          if (packet != nullptr)
          {
-            p->packetList_.push_back(packet);
+            // A subpacket constructed in the arena is owned by the arena, and
+            // a handle held by this packet would prevent the arena from being
+            // destroyed
+            if (p->arena_ == nullptr)
+            {
+               p->ownedPackets_.push_back(packet);
+            }
+
+            p->packetList_.push_back(packet.get());
             bytesRead += static_cast<std::uint32_t>(packet->data_size());
          }
          else
@@ -0,0 +1,779 @@
+#include <scwx/wsr88d/volume_products.hpp>
+#include <scwx/util/logger.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <execution>
+#include <numbers>
+#include <numeric>
+
+namespace scwx
+{
+namespace wsr88d
+{
+
+static const std::string logPrefix_ = "scwx::wsr88d::volume_products";
+static const auto        logger_    = util::Logger::Create(logPrefix_);
+
+// 4/3 effective earth radius, in meters
+static constexpr double kEffectiveEarthRadius_ = 6'371'000.0 * 4.0 / 3.0;
+
+// Radials processed by a single task
+static constexpr std::size_t kBlockRadials_ = 16u;
+
+// Maximum angle between a grid radial and the nearest radial of a cut
+static constexpr float kMaxAzimuthGap_ = 1.0f;
+
+static constexpr std::uint8_t kRangeFolded_ = 1u;
+
+// Reflectivity data moment encoding
+static constexpr float kReflectivityScale_  = 2.0f;
+static constexpr float kReflectivityOffset_ = 66.0f;
+
+// Echo tops are the height of the highest beam meeting the threshold, encoded
+// in 0.1 km increments
+static constexpr float        kEchoTopThreshold_ = 18.0f; // dBZ
+static constexpr std::uint8_t kEchoTopThresholdLevel_ =
+   static_cast<std::uint8_t>(kEchoTopThreshold_ * kReflectivityScale_ +
+                             kReflectivityOffset_);
+static constexpr float kEchoTopsScale_  = 10.0f;
+static constexpr float kEchoTopsOffset_ = 2.0f;
+
+// Vertically integrated liquid, encoded in 0.5 kg/m^2 increments. Reflectivity
+// is capped to limit the contribution of hail.
+static constexpr float kVilCoefficient_     = 3.44e-6f;
+static constexpr float kVilMaxReflectivity_ = 56.0f; // dBZ
+static constexpr float kVilScale_           = 2.0f;
+static constexpr float kVilOffset_          = 2.0f;
+
+static float BeamHeight(float groundRange, float elevation);
+static float SlantRange(float groundRange, float elevation);
+static const std::vector<float>& VilLayerTable();
+
+class VolumeProductMomentDataBlock :
+    public rda::GenericRadarData::MomentDataBlock
+{
+public:
+   explicit VolumeProductMomentDataBlock(
+      std::shared_ptr<const std::vector<std::uint8_t>> data,
+      std::size_t                                      radial,
+      const VolumeProducts::Grid&                      grid,
+      float                                            scale,
+      float                                            offset) :
+       data_ {std::move(data)},
+       moments_ {data_->data() + radial * grid.gates_},
+       grid_ {grid},
+       scale_ {scale},
+       offset_ {offset}
+   {
+   }
+   ~VolumeProductMomentDataBlock() = default;
+
+   std::uint16_t number_of_data_moment_gates() const override
+   {
+      return static_cast<std::uint16_t>(grid_.gates_);
+   }
+   units::kilometers<float> data_moment_range() const override
+   {
+      return units::kilometers<float> {grid_.firstGateRange_ * 0.001f};
+   }
+   std::int16_t data_moment_range_raw() const override
+   {
+      return static_cast<std::int16_t>(grid_.firstGateRange_);
+   }
+   units::kilometers<float> data_moment_range_sample_interval() const override
+   {
+      return units::kilometers<float> {grid_.gateSpacing_ * 0.001f};
+   }
+   std::uint16_t data_moment_range_sample_interval_raw() const override
+   {
+      return static_cast<std::uint16_t>(grid_.gateSpacing_);
+   }
+   std::int16_t snr_threshold_raw() const override { return 2; }
+   std::uint8_t data_word_size() const override { return 8u; }
+   float        scale() const override { return scale_; }
+   float        offset() const override { return offset_; }
+   const void*  data_moments() const override { return moments_; }
+
+private:
+   std::shared_ptr<const std::vector<std::uint8_t>> data_;
+   const std::uint8_t*                              moments_;
+
+   VolumeProducts::Grid grid_;
+   float                scale_;
+   float                offset_;
+};
+
+class VolumeProductRadialData : public rda::GenericRadarData
+{
+public:
+   explicit VolumeProductRadialData(
+      std::shared_ptr<VolumeProductMomentDataBlock>       momentDataBlock,
+      std::uint16_t                                       azimuthNumber,
+      float                                               azimuthAngle,
+      const std::shared_ptr<const rda::GenericRadarData>& referenceRadial) :
+       momentDataBlock_ {std::move(momentDataBlock)},
+       azimuthNumber_ {azimuthNumber},
+       azimuthAngle_ {azimuthAngle}
+   {
+      if (referenceRadial != nullptr)
+      {
+         collectionTime_     = referenceRadial->collection_time();
+         modifiedJulianDate_ = referenceRadial->modified_julian_date();
+         vcp_ = referenceRadial->volume_coverage_pattern_number();
+      }
+   }
+   ~VolumeProductRadialData() = default;
+
+   std::uint32_t collection_time() const override { return collectionTime_; }
+   std::uint16_t modified_julian_date() const override
+   {
+      return modifiedJulianDate_;
+   }
+   units::degrees<float> azimuth_angle() const override
+   {
+      return units::degrees<float> {azimuthAngle_};
+   }
+   std::uint16_t azimuth_number() const override { return azimuthNumber_; }
+   std::uint16_t elevation_number() const override { return 1u; }
+   std::uint16_t volume_coverage_pattern_number() const override
+   {
+      return vcp_;
+   }
+
+   std::shared_ptr<MomentDataBlock>
+   moment_data_block(rda::DataBlockType type) const override
+   {
+      if (type == rda::DataBlockType::MomentRef)
+      {
+         return momentDataBlock_;
+      }
+      return nullptr;
+   }
+
+   bool Parse(std::istream& /* is */) override
+   {
+      // Derived products are not transmitted
+      return false;
+   }
+
+private:
+   std::shared_ptr<VolumeProductMomentDataBlock> momentDataBlock_;
+
+   std::uint16_t azimuthNumber_;
+   float         azimuthAngle_;
+   std::uint32_t collectionTime_ {0u};
+   std::uint16_t modifiedJulianDate_ {0u};
+   std::uint16_t vcp_ {0u};
+};
+
+class VolumeProducts::Impl
+{
+public:
+   explicit Impl(const Grid&                                  grid,
+                 std::vector<Cut>                             cuts,
+                 std::shared_ptr<const rda::GenericRadarData> referenceRadial) :
+       grid_ {grid},
+       cuts_ {std::move(cuts)},
+       referenceRadial_ {std::move(referenceRadial)}
+   {
+      std::stable_sort(cuts_.begin(),
+                       cuts_.end(),
+                       [](const Cut& a, const Cut& b)
+                       { return a.elevation_ < b.elevation_; });
+
+      const std::size_t gridSize = grid_.radials_ * grid_.gates_;
+
+      beamHeights_.resize(cuts_.size());
+      echoTopLevels_.resize(cuts_.size());
+
+      for (std::size_t i = 0; i < cuts_.size(); ++i)
+      {
+         Cut& cut = cuts_[i];
+
+         if (cut.data_.size() != gridSize)
+         {
+            logger_->warn("Cut {} does not match the grid", cut.elevation_);
+            cut.data_.resize(gridSize, 0u);
+         }
+
+         std::vector<float>&        heights = beamHeights_[i];
+         std::vector<std::uint8_t>& levels  = echoTopLevels_[i];
+         heights.resize(grid_.gates_);
+         levels.resize(grid_.gates_);
+
+         for (std::size_t gate = 0; gate < grid_.gates_; ++gate)
+         {
+            heights[gate] = BeamHeight(
+               grid_.firstGateRange_ + grid_.gateSpacing_ * gate,
+               cut.elevation_);
+
+            // Meters to encoded kilometers
+            const long level = std::clamp<long>(
+               std::lround(heights[gate] * 0.001f * kEchoTopsScale_),
+               0,
+               255 - static_cast<long>(kEchoTopsOffset_));
+            levels[gate] = static_cast<std::uint8_t>(level + kEchoTopsOffset_);
+         }
+      }
+   }
+   ~Impl() = default;
+
+   void ComputeCompositeReflectivity(std::size_t                firstRadial,
+                                     std::size_t                lastRadial,
+                                     std::vector<std::uint8_t>& output) const;
+   void ComputeEchoTops(std::size_t                firstRadial,
+                        std::size_t                lastRadial,
+                        std::vector<std::uint8_t>& output) const;
+   void ComputeVil(std::size_t                firstRadial,
+                   std::size_t                lastRadial,
+                   std::vector<std::uint8_t>& output) const;
+
+   static Cut
+   ResampleCut(const Grid&                             grid,
+               float                                   elevation,
+               const rda::ElevationScan&               scan,
+               rda::GenericRadarData::MomentDataBlock& momentData0);
+
+   Grid                                         grid_;
+   std::vector<Cut>                             cuts_;
+   std::vector<std::vector<float>>              beamHeights_ {};
+   std::vector<std::vector<std::uint8_t>>       echoTopLevels_ {};
+   std::shared_ptr<const rda::GenericRadarData> referenceRadial_;
+};
+
+VolumeProducts::VolumeProducts(
+   const Grid&                                  grid,
+   std::vector<Cut>                             cuts,
+   std::shared_ptr<const rda::GenericRadarData> referenceRadial) :
+    p(std::make_unique<Impl>(grid, std::move(cuts), std::move(referenceRadial)))
+{
+}
+VolumeProducts::~VolumeProducts() = default;
+
+VolumeProducts::VolumeProducts(VolumeProducts&&) noexcept            = default;
+VolumeProducts& VolumeProducts::operator=(VolumeProducts&&) noexcept = default;
+
+const VolumeProducts::Grid& VolumeProducts::grid() const
+{
+   return p->grid_;
+}
+
+const std::vector<VolumeProducts::Cut>& VolumeProducts::cuts() const
+{
+   return p->cuts_;
+}
+
+const std::vector<float>& VolumeProducts::beam_height(std::size_t cut) const
+{
+   return p->beamHeights_.at(cut);
+}
+
+bool VolumeProducts::IsDerivedProduct(common::Level2Product product)
+{
+   switch (product)
+   {
+   case common::Level2Product::CompositeReflectivity:
+   case common::Level2Product::EchoTops:
+   case common::Level2Product::VerticallyIntegratedLiquid:
+      return true;
+
+   default:
+      return false;
+   }
+}
+
+float VolumeProducts::GetScale(common::Level2Product product)
+{
+   switch (product)
+   {
+   case common::Level2Product::EchoTops:
+      return kEchoTopsScale_;
+
+   case common::Level2Product::VerticallyIntegratedLiquid:
+      return kVilScale_;
+
+   default:
+      return kReflectivityScale_;
+   }
+}
+
+float VolumeProducts::GetOffset(common::Level2Product product)
+{
+   switch (product)
+   {
+   case common::Level2Product::EchoTops:
+      return kEchoTopsOffset_;
+
+   case common::Level2Product::VerticallyIntegratedLiquid:
+      return kVilOffset_;
+
+   default:
+      return kReflectivityOffset_;
+   }
+}
+
+std::vector<std::uint8_t>
+VolumeProducts::Compute(common::Level2Product product) const
+{
+   if (!IsDerivedProduct(product))
+   {
+      return {};
+   }
+
+   const std::size_t radials = p->grid_.radials_;
+
+   std::vector<std::uint8_t> output(radials * p->grid_.gates_, 0u);
+
+   // Each task computes a block of radials, writing to a disjoint region of
+   // the output
+   std::vector<std::size_t> blocks((radials + kBlockRadials_ - 1) /
+                                   kBlockRadials_);
+   std::iota(blocks.begin(), blocks.end(), 0u);
+
+   std::for_each(std::execution::par,
+                 blocks.cbegin(),
+                 blocks.cend(),
+                 [&](std::size_t block)
+                 {
+                    const std::size_t firstRadial = block * kBlockRadials_;
+                    const std::size_t lastRadial =
+                       std::min(firstRadial + kBlockRadials_, radials);
+
+                    switch (product)
+                    {
+                    case common::Level2Product::CompositeReflectivity:
+                       p->ComputeCompositeReflectivity(
+                          firstRadial, lastRadial, output);
+                       break;
+
+                    case common::Level2Product::EchoTops:
+                       p->ComputeEchoTops(firstRadial, lastRadial, output);
+                       break;
+
+                    case common::Level2Product::VerticallyIntegratedLiquid:
+                       p->ComputeVil(firstRadial, lastRadial, output);
+                       break;
+
+                    default:
+                       break;
+                    }
+                 });
+
+   return output;
+}
+
+// The kernels below operate on contiguous gate arrays of a single radial
+// without branches, such that they may be vectorized by the compiler. The VIL
+// kernel replaces the power function with a lookup into a table indexed by
+// both data moments.
+
+static void CompositeReflectivityKernel(const std::uint8_t* input,
+                                        std::uint8_t*       output,
+                                        std::size_t         gates)
+{
+   for (std::size_t i = 0; i < gates; ++i)
+   {
+      output[i] = std::max(output[i], input[i]);
+   }
+}
+
+static void EchoTopKernel(const std::uint8_t* input,
+                          const std::uint8_t* heightLevel,
+                          std::uint8_t*       output,
+                          std::size_t         gates)
+{
+   // Beam height increases with elevation at a given ground range, such that
+   // the echo top is the maximum height of each beam meeting the threshold
+   for (std::size_t i = 0; i < gates; ++i)
+   {
+      const std::uint8_t mask = static_cast<std::uint8_t>(
+         -static_cast<int>(input[i] >= kEchoTopThresholdLevel_));
+      output[i] =
+         std::max(output[i], static_cast<std::uint8_t>(heightLevel[i] & mask));
+   }
+}
+
+static void VilKernel(const std::uint8_t* lower,
+                      const std::uint8_t* upper,
+                      const float*        lowerHeight,
+                      const float*        upperHeight,
+                      const float*        layerTable,
+                      float*              vil,
+                      std::size_t         gates)
+{
+   for (std::size_t i = 0; i < gates; ++i)
+   {
+      vil[i] += layerTable[(static_cast<std::size_t>(lower[i]) << 8) |
+                           upper[i]] *
+                (upperHeight[i] - lowerHeight[i]);
+   }
+}
+
+void VolumeProducts::Impl::ComputeCompositeReflectivity(
+   std::size_t                firstRadial,
+   std::size_t                lastRadial,
+   std::vector<std::uint8_t>& output) const
+{
+   const std::size_t gates = grid_.gates_;
+
+   for (std::size_t radial = firstRadial; radial < lastRadial; ++radial)
+   {
+      std::uint8_t* radialOutput = output.data() + radial * gates;
+
+      for (const Cut& cut : cuts_)
+      {
+         CompositeReflectivityKernel(
+            cut.data_.data() + radial * gates, radialOutput, gates);
+      }
+   }
+}
+
+void VolumeProducts::Impl::ComputeEchoTops(
+   std::size_t                firstRadial,
+   std::size_t                lastRadial,
+   std::vector<std::uint8_t>& output) const
+{
+   const std::size_t gates = grid_.gates_;
+
+   for (std::size_t radial = firstRadial; radial < lastRadial; ++radial)
+   {
+      std::uint8_t* radialOutput = output.data() + radial * gates;
+
+      for (std::size_t i = 0; i < cuts_.size(); ++i)
+      {
+         EchoTopKernel(cuts_[i].data_.data() + radial * gates,
+                       echoTopLevels_[i].data(),
+                       radialOutput,
+                       gates);
+      }
+   }
+}
+
+void VolumeProducts::Impl::ComputeVil(std::size_t                firstRadial,
+                                      std::size_t                lastRadial,
+                                      std::vector<std::uint8_t>& output) const
+{
+   const std::size_t         gates      = grid_.gates_;
+   const std::vector<float>& layerTable = VilLayerTable();
+
+   std::vector<float> vil(gates);
+
+   for (std::size_t radial = firstRadial; radial < lastRadial; ++radial)
+   {
+      std::fill(vil.begin(), vil.end(), 0.0f);
+
+      // Integrate each layer between adjacent beams
+      for (std::size_t i = 0; i + 1 < cuts_.size(); ++i)
+      {
+         VilKernel(cuts_[i].data_.data() + radial * gates,
+                   cuts_[i + 1].data_.data() + radial * gates,
+                   beamHeights_[i].data(),
+                   beamHeights_[i + 1].data(),
+                   layerTable.data(),
+                   vil.data(),
+                   gates);
+      }
+
+      std::uint8_t* radialOutput = output.data() + radial * gates;
+
+      for (std::size_t gate = 0; gate < gates; ++gate)
+      {
+         // Values which round to 0 are considered to have no data
+         const long level = std::lround(vil[gate] * kVilScale_);
+         if (level > 0)
+         {
+            radialOutput[gate] = static_cast<std::uint8_t>(std::min<long>(
+               level + static_cast<long>(kVilOffset_), 255));
+         }
+      }
+   }
+}
+
+std::shared_ptr<rda::ElevationScan>
+VolumeProducts::CreateElevationScan(common::Level2Product product) const
+{
+   if (!IsDerivedProduct(product))
+   {
+      return nullptr;
+   }
+
+   auto data = std::make_shared<const std::vector<std::uint8_t>>(
+      Compute(product));
+
+   const float scale         = GetScale(product);
+   const float offset        = GetOffset(product);
+   const float radialWidth   = 360.0f / p->grid_.radials_;
+   auto        elevationScan = std::make_shared<rda::ElevationScan>();
+
+   for (std::size_t radial = 0; radial < p->grid_.radials_; ++radial)
+   {
+      auto momentDataBlock = std::make_shared<VolumeProductMomentDataBlock>(
+         data, radial, p->grid_, scale, offset);
+
+      (*elevationScan)[static_cast<std::uint16_t>(radial)] =
+         std::make_shared<VolumeProductRadialData>(
+            std::move(momentDataBlock),
+            static_cast<std::uint16_t>(radial + 1),
+            (radial + 0.5f) * radialWidth,
+            p->referenceRadial_);
+   }
+
+   return elevationScan;
+}
+
+std::shared_ptr<VolumeProducts>
+VolumeProducts::Create(const std::shared_ptr<Ar2vFile>& file)
+{
+   if (file == nullptr)
+   {
+      return nullptr;
+   }
+
+   constexpr rda::DataBlockType dataBlockType = rda::DataBlockType::MomentRef;
+
+   struct Scan
+   {
+      float                                                   elevation_;
+      std::shared_ptr<rda::ElevationScan>                     scan_;
+      std::shared_ptr<rda::GenericRadarData::MomentDataBlock> momentData0_;
+   };
+
+   std::vector<float> elevationCuts;
+   std::tie(std::ignore, std::ignore, elevationCuts) =
+      file->GetElevationScan(dataBlockType, 0.0f, {});
+
+   std::vector<Scan> scans {};
+   scans.reserve(elevationCuts.size());
+
+   // Elevation scans are retrieved sequentially, as a lazy loaded file parses
+   // each elevation on first access
+   for (float elevationCut : elevationCuts)
+   {
+      std::shared_ptr<rda::ElevationScan> scan;
+      float                               elevation;
+      std::tie(scan, elevation, std::ignore) =
+         file->GetElevationScan(dataBlockType, elevationCut, {});
+
+      if (scan == nullptr || scan->empty())
+      {
+         continue;
+      }
+
+      auto momentData0 =
+         scan->cbegin()->second->moment_data_block(dataBlockType);
+      if (momentData0 == nullptr || momentData0->data_word_size() != 8)
+      {
+         continue;
+      }
+
+      scans.push_back({elevation, scan, momentData0});
+   }
+
+   if (scans.empty())
+   {
+      return nullptr;
+   }
+
+   std::sort(scans.begin(),
+             scans.end(),
+             [](const Scan& a, const Scan& b)
+             { return a.elevation_ < b.elevation_; });
+
+   // The grid matches the lowest cut, where the ground range and slant range
+   // are nearly equal
+   const auto& lowestMomentData = scans.front().momentData0_;
+
+   Grid grid {};
+   grid.gates_          = lowestMomentData->number_of_data_moment_gates();
+   grid.firstGateRange_ =
+      static_cast<float>(lowestMomentData->data_moment_range_raw());
+   grid.gateSpacing_ = static_cast<float>(
+      lowestMomentData->data_moment_range_sample_interval_raw());
+
+   if (grid.gates_ == 0 || grid.gateSpacing_ <= 0.0f)
+   {
+      return nullptr;
+   }
+
+   std::vector<Cut> cuts(scans.size());
+
+   std::transform(std::execution::par,
+                  scans.cbegin(),
+                  scans.cend(),
+                  cuts.begin(),
+                  [&](const Scan& scan)
+                  {
+                     return Impl::ResampleCut(
+                        grid, scan.elevation_, *scan.scan_, *scan.momentData0_);
+                  });
+
+   logger_->debug("Created volume with {} cuts", cuts.size());
+
+   return std::make_shared<VolumeProducts>(
+      grid, std::move(cuts), scans.front().scan_->cbegin()->second);
+}
+
+VolumeProducts::Cut VolumeProducts::Impl::ResampleCut(
+   const Grid&                             grid,
+   float                                   elevation,
+   const rda::ElevationScan&               scan,
+   rda::GenericRadarData::MomentDataBlock& momentData0)
+{
+   constexpr rda::DataBlockType dataBlockType = rda::DataBlockType::MomentRef;
+
+   Cut cut {};
+   cut.elevation_ = elevation;
+   cut.data_.resize(grid.radials_ * grid.gates_, 0u);
+
+   // Radials of the cut, ordered by azimuth
+   std::vector<std::pair<float, const std::uint8_t*>> radials {};
+   radials.reserve(scan.size());
+
+   for (auto& radialPair : scan)
+   {
+      auto momentData = radialPair.second->moment_data_block(dataBlockType);
+      if (momentData != nullptr && momentData->data_word_size() == 8)
+      {
+         radials.emplace_back(
+            radialPair.second->azimuth_angle().value(),
+            static_cast<const std::uint8_t*>(momentData->data_moments()));
+      }
+   }
+
+   if (radials.empty())
+   {
+      return cut;
+   }
+
+   std::sort(radials.begin(),
+             radials.end(),
+             [](const auto& a, const auto& b) { return a.first < b.first; });
+
+   // Source gate for each grid gate. Each radial of the cut is assumed to
+   // share the gate geometry of the first radial.
+   const float firstGateRange =
+      static_cast<float>(momentData0.data_moment_range_raw());
+   const float gateSpacing =
+      static_cast<float>(momentData0.data_moment_range_sample_interval_raw());
+   const std::int32_t gateCount = momentData0.number_of_data_moment_gates();
+   const std::uint8_t threshold = static_cast<std::uint8_t>(
+      std::clamp<std::int16_t>(momentData0.snr_threshold_raw(), 2, 255));
+
+   if (gateSpacing <= 0.0f)
+   {
+      return cut;
+   }
+
+   std::vector<std::int32_t> gateMap(grid.gates_);
+   for (std::size_t gate = 0; gate < grid.gates_; ++gate)
+   {
+      const float slantRange = SlantRange(
+         grid.firstGateRange_ + grid.gateSpacing_ * gate, elevation);
+      const std::int32_t sourceGate = static_cast<std::int32_t>(
+         std::lround((slantRange - firstGateRange) / gateSpacing));
+
+      gateMap[gate] =
+         (sourceGate >= 0 && sourceGate < gateCount) ? sourceGate : -1;
+   }
+
+   const float radialWidth = 360.0f / grid.radials_;
+
+   for (std::size_t radial = 0; radial < grid.radials_; ++radial)
+   {
+      const float azimuth = (radial + 0.5f) * radialWidth;
+
+      // Find the nearest radial, wrapping at 0/360 degrees
+      auto next = std::lower_bound(radials.cbegin(),
+                                   radials.cend(),
+                                   azimuth,
+                                   [](const auto& a, float b)
+                                   { return a.first < b; });
+      auto prev = (next == radials.cbegin()) ? radials.cend() - 1 : next - 1;
+      if (next == radials.cend())
+      {
+         next = radials.cbegin();
+      }
+
+      const float nextDelta =
+         std::abs(std::remainder(next->first - azimuth, 360.0f));
+      const float prevDelta =
+         std::abs(std::remainder(prev->first - azimuth, 360.0f));
+      const auto& nearest = (nextDelta < prevDelta) ? *next : *prev;
+
+      if (std::min(nextDelta, prevDelta) > kMaxAzimuthGap_)
+      {
+         continue;
+      }
+
+      const std::uint8_t* input  = nearest.second;
+      std::uint8_t*       output = cut.data_.data() + radial * grid.gates_;
+
+      for (std::size_t gate = 0; gate < grid.gates_; ++gate)
+      {
+         const std::int32_t sourceGate = gateMap[gate];
+         if (sourceGate >= 0)
+         {
+            const std::uint8_t value = input[sourceGate];
+            output[gate] =
+               (value < threshold && value != kRangeFolded_) ? 0u : value;
+         }
+      }
+   }
+
+   return cut;
+}
+
+static float BeamHeight(float groundRange, float elevation)
+{
+   const double theta = elevation * std::numbers::pi / 180.0;
+   const double phi   = groundRange / kEffectiveEarthRadius_;
+
+   return static_cast<float>(kEffectiveEarthRadius_ *
+                             (std::cos(theta) / std::cos(theta + phi) - 1.0));
+}
+
+static float SlantRange(float groundRange, float elevation)
+{
+   const double theta = elevation * std::numbers::pi / 180.0;
+   const double phi   = groundRange / kEffectiveEarthRadius_;
+
+   return static_cast<float>(kEffectiveEarthRadius_ * std::sin(phi) /
+                             std::cos(theta + phi));
+}
+
+static const std::vector<float>& VilLayerTable()
+{
+   // Contribution of a layer per meter of depth, indexed by the reflectivity
+   // data moments of the lower and upper beams. Reflectivity is averaged in
+   // linear units (mm^6/m^3) before applying the Z-M relationship.
+   static const std::vector<float> layerTable = []()
+   {
+      std::array<double, 256> z {};
+      for (std::size_t level = 2; level < z.size(); ++level)
+      {
+         const double dbz = std::min<double>(
+            (level - kReflectivityOffset_) / kReflectivityScale_,
+            kVilMaxReflectivity_);
+         z[level] = std::pow(10.0, dbz / 10.0);
+      }
+
+      std::vector<float> table(256u * 256u);
+      for (std::size_t lower = 0; lower < 256u; ++lower)
+      {
+         for (std::size_t upper = 0; upper < 256u; ++upper)
+         {
+            table[(lower << 8) | upper] = static_cast<float>(
+               kVilCoefficient_ *
+               std::pow((z[lower] + z[upper]) * 0.5, 4.0 / 7.0));
+         }
+      }
+      return table;
+   }();
+
+   return layerTable;
+}
+
+} // namespace wsr88d
+} // namespace scwx
@@ -54,9 +54,13 @@ set(HDR_GR include/scwx/gr/color.hpp
 set(SRC_GR source/scwx/gr/color.cpp
            source/scwx/gr/placefile.cpp)
 set(HDR_NETWORK include/scwx/network/cpr.hpp
-                include/scwx/network/dir_list.hpp)
+                include/scwx/network/dir_list.hpp
+                include/scwx/network/replay_transport.hpp
+                include/scwx/network/transport.hpp)
 set(SRC_NETWORK source/scwx/network/cpr.cpp
-                source/scwx/network/dir_list.cpp)
+                source/scwx/network/dir_list.cpp
+                source/scwx/network/replay_transport.cpp
+                source/scwx/network/transport.cpp)
 set(HDR_PROVIDER include/scwx/provider/aws_level2_data_provider.hpp
                  include/scwx/provider/aws_level3_data_provider.hpp
                  include/scwx/provider/aws_nexrad_data_provider.hpp
@@ -69,25 +73,32 @@ set(SRC_PROVIDER source/scwx/provider/aws_level2_data_provider.cpp
                  source/scwx/provider/nexrad_data_provider.cpp
                  source/scwx/provider/nexrad_data_provider_factory.cpp
                  source/scwx/provider/warnings_provider.cpp)
-set(HDR_UTIL include/scwx/util/digest.hpp
+set(HDR_UTIL include/scwx/util/clock.hpp
+             include/scwx/util/digest.hpp
              include/scwx/util/enum.hpp
              include/scwx/util/environment.hpp
              include/scwx/util/float.hpp
              include/scwx/util/hash.hpp
+             include/scwx/util/initialization_graph.hpp
              include/scwx/util/iterator.hpp
              include/scwx/util/logger.hpp
              include/scwx/util/map.hpp
+             include/scwx/util/metrics.hpp
              include/scwx/util/rangebuf.hpp
+             include/scwx/util/record_layout.hpp
              include/scwx/util/streams.hpp
              include/scwx/util/strings.hpp
              include/scwx/util/threads.hpp
              include/scwx/util/time.hpp
              include/scwx/util/vectorbuf.hpp)
-set(SRC_UTIL source/scwx/util/digest.cpp
+set(SRC_UTIL source/scwx/util/clock.cpp
+             source/scwx/util/digest.cpp
              source/scwx/util/environment.cpp
              source/scwx/util/float.cpp
              source/scwx/util/hash.cpp
+             source/scwx/util/initialization_graph.cpp
              source/scwx/util/logger.cpp
+             source/scwx/util/metrics.cpp
              source/scwx/util/rangebuf.cpp
              source/scwx/util/streams.cpp
              source/scwx/util/strings.cpp
@@ -98,11 +109,15 @@ set(HDR_WSR88D include/scwx/wsr88d/ar2v_file.hpp
                include/scwx/wsr88d/level3_file.hpp
                include/scwx/wsr88d/nexrad_file.hpp
                include/scwx/wsr88d/nexrad_file_factory.hpp
+               include/scwx/wsr88d/nexrad_file_loader.hpp
+               include/scwx/wsr88d/volume_products.hpp
                include/scwx/wsr88d/wsr88d_types.hpp)
 set(SRC_WSR88D source/scwx/wsr88d/ar2v_file.cpp
                source/scwx/wsr88d/level3_file.cpp
                source/scwx/wsr88d/nexrad_file.cpp
                source/scwx/wsr88d/nexrad_file_factory.cpp
+               source/scwx/wsr88d/nexrad_file_loader.cpp
+               source/scwx/wsr88d/volume_products.cpp
                source/scwx/wsr88d/wsr88d_types.cpp)
 set(HDR_WSR88D_RDA include/scwx/wsr88d/rda/clutter_filter_bypass_map.hpp
                    include/scwx/wsr88d/rda/clutter_filter_map.hpp
@@ -147,6 +162,7 @@ set(HDR_WSR88D_RPG include/scwx/wsr88d/rpg/ccb_header.hpp
                    include/scwx/wsr88d/rpg/linked_vector_packet.hpp
                    include/scwx/wsr88d/rpg/mesocyclone_symbol_packet.hpp
                    include/scwx/wsr88d/rpg/packet.hpp
+                   include/scwx/wsr88d/rpg/packet_arena.hpp
                    include/scwx/wsr88d/rpg/packet_factory.hpp
                    include/scwx/wsr88d/rpg/point_feature_symbol_packet.hpp
                    include/scwx/wsr88d/rpg/point_graphic_symbol_packet.hpp
@@ -188,6 +204,7 @@ set(SRC_WSR88D_RPG source/scwx/wsr88d/rpg/ccb_header.cpp
                    source/scwx/wsr88d/rpg/linked_vector_packet.cpp
                    source/scwx/wsr88d/rpg/mesocyclone_symbol_packet.cpp
                    source/scwx/wsr88d/rpg/packet.cpp
+                   source/scwx/wsr88d/rpg/packet_arena.cpp
                    source/scwx/wsr88d/rpg/packet_factory.cpp
                    source/scwx/wsr88d/rpg/point_feature_symbol_packet.cpp
                    source/scwx/wsr88d/rpg/point_graphic_symbol_packet.cpp